@@ -98,20 +98,28 @@
         'bslalg/bslalg_dequeimputil.h',
         'bslalg/bslalg_dequeiterator.h',
         'bslalg/bslalg_dequeprimitives.h',
+        'bslalg/bslalg_dequesegmentutil.h',
+        'bslalg/bslalg_eytzingerarray.h',
         'bslalg/bslalg_functoradapter.h',
         'bslalg/bslalg_hashtableanchor.h',
         'bslalg/bslalg_hashtablebucket.h',
         'bslalg/bslalg_hashtableimputil.h',
         'bslalg/bslalg_hashutil.h',
         'bslalg/bslalg_hastrait.h',
+        'bslalg/bslalg_parallelutil.h',
         'bslalg/bslalg_rangecompare.h',
         'bslalg/bslalg_rbtreeanchor.h',
+        'bslalg/bslalg_rbtreecountutil.h',
         'bslalg/bslalg_rbtreenode.h',
         'bslalg/bslalg_rbtreeutil.h',
         'bslalg/bslalg_scalardestructionprimitives.h',
         'bslalg/bslalg_scalarprimitives.h',
+        'bslalg/bslalg_searchutil.h',
         'bslalg/bslalg_selecttrait.h',
+        'bslalg/bslalg_sortutil.h',
         'bslalg/bslalg_swaputil.h',
+        'bslalg/bslalg_taskscheduler.h',
+        'bslalg/bslalg_threadimputil.h',
         'bslalg/bslalg_typetraitbitwisecopyable.h',
         'bslalg/bslalg_typetraitbitwiseequalitycomparable.h',
         'bslalg/bslalg_typetraitbitwisemoveable.h',
@@ -128,6 +136,7 @@
         'bslma/bslma_autodeallocator.h',
         'bslma/bslma_autodestructor.h',
         'bslma/bslma_autorawdeleter.h',
+        'bslma/bslma_countingallocator.h',
         'bslma/bslma_deallocatorguard.h',
         'bslma/bslma_deallocatorproctor.h',
         'bslma/bslma_default.h',
@@ -135,8 +144,10 @@
         'bslma/bslma_deleterhelper.h',
         'bslma/bslma_destructorguard.h',
         'bslma/bslma_destructorproctor.h',
+        'bslma/bslma_epochreclaimer.h',
         'bslma/bslma_mallocfreeallocator.h',
         'bslma/bslma_newdeleteallocator.h',
+        'bslma/bslma_profilingallocator.h',
         'bslma/bslma_rawdeleterguard.h',
         'bslma/bslma_rawdeleterproctor.h',
         'bslma/bslma_testallocator.h',
@@ -232,9 +243,13 @@
         'bsls/bsls_bsltestutil.h',
         'bsls/bsls_buildtarget.h',
         'bsls/bsls_byteorder.h',
+        'bsls/bsls_cachelinepadded.h',
+        'bsls/bsls_coarseclock.h',
         'bsls/bsls_compilerfeatures.h',
+        'bsls/bsls_eventtrace.h',
         'bsls/bsls_exceptionutil.h',
         'bsls/bsls_ident.h',
+        'bsls/bsls_latencyhistogram.h',
         'bsls/bsls_macroincrement.h',
         'bsls/bsls_nativestd.h',
         'bsls/bsls_nullptr.h',
@@ -242,6 +257,8 @@
         'bsls/bsls_performancehint.h',
         'bsls/bsls_platform.h',
         'bsls/bsls_protocoltest.h',
+        'bsls/bsls_shardedcounter.h',
+        'bsls/bsls_spinlock.h',
         'bsls/bsls_stopwatch.h',
         'bsls/bsls_timeutil.h',
         'bsls/bsls_types.h',
@@ -253,6 +270,7 @@
         'bslstl/bslstl_allocatortraits.h',
         'bslstl/bslstl_bidirectionaliterator.h',
         'bslstl/bslstl_bidirectionalnodepool.h',
+        'bslstl/bslstl_boundedqueue.h',
         'bslstl/bslstl_deque.h',
         'bslstl/bslstl_equalto.h',
         'bslstl/bslstl_forwarditerator.h',
@@ -260,6 +278,7 @@
         'bslstl/bslstl_hashtable.h',
         'bslstl/bslstl_hashtablebucketiterator.h',
         'bslstl/bslstl_hashtableiterator.h',
+        'bslstl/bslstl_indexedpriorityqueue.h',
         'bslstl/bslstl_iosfwd.h',
         'bslstl/bslstl_istringstream.h',
         'bslstl/bslstl_iterator.h',
@@ -274,6 +293,7 @@
         'bslstl/bslstl_priorityqueue.h',
         'bslstl/bslstl_queue.h',
         'bslstl/bslstl_randomaccessiterator.h',
+        'bslstl/bslstl_rankedset.h',
         'bslstl/bslstl_set.h',
         'bslstl/bslstl_setcomparator.h',
         'bslstl/bslstl_simplepool.h',
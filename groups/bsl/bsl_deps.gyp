@@ -9,6 +9,8 @@
       # XXX: when generating .gyp from bde metadata, need to special-case
       'conditions': [  # (bsls_timeutil uses POSIX realtime API clock_gettime())
         [ 'OS == "linux"', { 'link_settings': { 'libraries': [ '-lrt' ] } } ],
+        # (bslalg_parallelutil starts worker threads using POSIX threads)
+        [ 'OS != "win"', { 'link_settings': { 'libraries': ['-lpthread'] } } ],
       ],
     },
   ],
@@ -14,20 +14,28 @@
       'bslalg_dequeimputil.cpp',
       'bslalg_dequeiterator.cpp',
       'bslalg_dequeprimitives.cpp',
+      'bslalg_dequesegmentutil.cpp',
+      'bslalg_eytzingerarray.cpp',
       'bslalg_functoradapter.cpp',
       'bslalg_hashtableanchor.cpp',
       'bslalg_hashtablebucket.cpp',
       'bslalg_hashtableimputil.cpp',
       'bslalg_hashutil.cpp',
       'bslalg_hastrait.cpp',
+      'bslalg_parallelutil.cpp',
       'bslalg_rangecompare.cpp',
       'bslalg_rbtreeanchor.cpp',
+      'bslalg_rbtreecountutil.cpp',
       'bslalg_rbtreenode.cpp',
       'bslalg_rbtreeutil.cpp',
       'bslalg_scalardestructionprimitives.cpp',
       'bslalg_scalarprimitives.cpp',
+      'bslalg_searchutil.cpp',
       'bslalg_selecttrait.cpp',
+      'bslalg_sortutil.cpp',
       'bslalg_swaputil.cpp',
+      'bslalg_taskscheduler.cpp',
+      'bslalg_threadimputil.cpp',
       'bslalg_typetraitbitwisecopyable.cpp',
       'bslalg_typetraitbitwiseequalitycomparable.cpp',
       'bslalg_typetraitbitwisemoveable.cpp',
@@ -53,20 +61,28 @@
       'bslalg_dequeimputil.t',
       'bslalg_dequeiterator.t',
       'bslalg_dequeprimitives.t',
+      'bslalg_dequesegmentutil.t',
+      'bslalg_eytzingerarray.t',
       'bslalg_functoradapter.t',
       'bslalg_hashtableanchor.t',
       'bslalg_hashtablebucket.t',
       'bslalg_hashtableimputil.t',
       'bslalg_hashutil.t',
       'bslalg_hastrait.t',
+      'bslalg_parallelutil.t',
       'bslalg_rangecompare.t',
       'bslalg_rbtreeanchor.t',
+      'bslalg_rbtreecountutil.t',
       'bslalg_rbtreenode.t',
       'bslalg_rbtreeutil.t',
       'bslalg_scalardestructionprimitives.t',
       'bslalg_scalarprimitives.t',
+      'bslalg_searchutil.t',
       'bslalg_selecttrait.t',
+      'bslalg_sortutil.t',
       'bslalg_swaputil.t',
+      'bslalg_taskscheduler.t',
+      'bslalg_threadimputil.t',
       'bslalg_typetraitbitwisecopyable.t',
       'bslalg_typetraitbitwiseequalitycomparable.t',
       'bslalg_typetraitbitwisemoveable.t',
@@ -92,20 +108,28 @@
       '<(PRODUCT_DIR)/bslalg_dequeimputil.t',
       '<(PRODUCT_DIR)/bslalg_dequeiterator.t',
       '<(PRODUCT_DIR)/bslalg_dequeprimitives.t',
+      '<(PRODUCT_DIR)/bslalg_dequesegmentutil.t',
+      '<(PRODUCT_DIR)/bslalg_eytzingerarray.t',
       '<(PRODUCT_DIR)/bslalg_functoradapter.t',
       '<(PRODUCT_DIR)/bslalg_hashtableanchor.t',
       '<(PRODUCT_DIR)/bslalg_hashtablebucket.t',
       '<(PRODUCT_DIR)/bslalg_hashtableimputil.t',
       '<(PRODUCT_DIR)/bslalg_hashutil.t',
       '<(PRODUCT_DIR)/bslalg_hastrait.t',
+      '<(PRODUCT_DIR)/bslalg_parallelutil.t',
       '<(PRODUCT_DIR)/bslalg_rangecompare.t',
       '<(PRODUCT_DIR)/bslalg_rbtreeanchor.t',
+      '<(PRODUCT_DIR)/bslalg_rbtreecountutil.t',
       '<(PRODUCT_DIR)/bslalg_rbtreenode.t',
       '<(PRODUCT_DIR)/bslalg_rbtreeutil.t',
       '<(PRODUCT_DIR)/bslalg_scalardestructionprimitives.t',
       '<(PRODUCT_DIR)/bslalg_scalarprimitives.t',
+      '<(PRODUCT_DIR)/bslalg_searchutil.t',
       '<(PRODUCT_DIR)/bslalg_selecttrait.t',
+      '<(PRODUCT_DIR)/bslalg_sortutil.t',
       '<(PRODUCT_DIR)/bslalg_swaputil.t',
+      '<(PRODUCT_DIR)/bslalg_taskscheduler.t',
+      '<(PRODUCT_DIR)/bslalg_threadimputil.t',
       '<(PRODUCT_DIR)/bslalg_typetraitbitwisecopyable.t',
       '<(PRODUCT_DIR)/bslalg_typetraitbitwiseequalitycomparable.t',
       '<(PRODUCT_DIR)/bslalg_typetraitbitwisemoveable.t',
@@ -281,6 +305,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_dequeprimitives.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_dequesegmentutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_dequesegmentutil.t.cpp' ],
+    },
+    {
+      'target_name': 'bslalg_eytzingerarray.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_eytzingerarray.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_functoradapter.t',
       'type': 'executable',
@@ -329,6 +369,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_hastrait.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_parallelutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_parallelutil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_rangecompare.t',
       'type': 'executable',
@@ -345,6 +393,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_rbtreeanchor.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_rbtreecountutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_rbtreecountutil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_rbtreenode.t',
       'type': 'executable',
@@ -377,6 +433,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_scalarprimitives.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_searchutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_searchutil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_selecttrait.t',
       'type': 'executable',
@@ -385,6 +449,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_selecttrait.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_sortutil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_sortutil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_swaputil.t',
       'type': 'executable',
@@ -393,6 +465,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslalg_swaputil.t.cpp' ],
     },
+    {
+      'target_name': 'bslalg_taskscheduler.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_taskscheduler.t.cpp' ],
+    },
+    {
+      'target_name': 'bslalg_threadimputil.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslalg_pkgdeps)', 'bslalg' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslalg_threadimputil.t.cpp' ],
+    },
     {
       'target_name': 'bslalg_typetraitbitwisecopyable.t',
       'type': 'executable',
@@ -110,27 +110,86 @@ BSLS_IDENT("$Id$ $CSID$")
 //      ::type
 //  defaultConstruct(TARGET_TYPE *begin, ...);
 //..
+//
+///Non-temporal stores
+///-------------------
+// The non-temporal copy and fill below store 64 bytes (one cache line on
+// current x86 processors) per iteration using four 16-byte SSE2 streaming
+// stores, after filling the bytes before the first 16-byte aligned address
+// using 'std::memcpy' or 'std::memset'.  Streaming stores are weakly ordered,
+// so each operation ends with a store fence, after which the stored bytes are
+// visible as if written by ordinary stores.  A copy prefetches its source
+// four cache lines ahead: on a Xeon with a large shared cache, this brought a
+// 16MB copy from about 10% slower to about 10% faster than 'std::memcpy' (the
+// non-temporal prefetch hint was measurably slower than 'T0').
+//
+// A non-temporal 'bitwiseFillN' cannot copy the destination onto itself, as
+// the doubling copy does, since the bytes stored would have to be read back
+// from memory.  Instead, it first uses the doubling copy to initialize a
+// prefix longer than a block of '64 * numBytesInitialized' bytes, which is a
+// whole number of both patterns and 64-byte units, and then repeatedly
+// streams that (cache-resident) block to the rest of the destination: the
+// source of the 64 bytes at offset 'i' from 'begin' is at offset
+// 'i % blockSize'.  Patterns longer than 'MAX_NON_TEMPORAL_PATTERN' bytes
+// (i.e., elements of such size) use the doubling copy.
+//
+// The copy loop above loses to glibc's 'memcpy' on ranges much larger than
+// the cache (a 256MB copy took about 20% longer), since 'memcpy' switches to
+// its own, more elaborate, non-temporal loop at about three quarters of the
+// size of the last-level cache ('x86_non_temporal_threshold'; newer versions
+// switch earlier).  So a bit-wise copy at or above that size is handed to
+// 'memcpy', and the loop above serves only the sizes between the non-temporal
+// threshold (when set lower than its default) and that point, and platforms
+// whose 'memcpy' never streams.  'memset' is not handed off, as glibc's
+// streams only in recent versions.
 
 #include <bslmf_assert.h>
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <cstring>
 
-namespace BloombergLP {
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+#include <windows.h>        // GetLogicalProcessorInformation
+#include <cstdlib>          // malloc, free
+#elif defined(BSLS_PLATFORM_OS_DARWIN)
+#include <sys/types.h>
+#include <sys/sysctl.h>     // sysctlbyname
+#elif defined(BSLS_PLATFORM_OS_UNIX)
+#include <unistd.h>         // sysconf
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)                  \
+ || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES 1
+#endif
 
-namespace bslalg {
+namespace BloombergLP {
 
-// CLASS METHODS
-void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
-                                       size_type  numBytesInitialized,
-                                       size_type  numBytes)
+namespace {
+
+enum {
+    VECTOR_SIZE              = 16,   // bytes per streaming store
+    BLOCK_SIZE               = 64,   // bytes per loop iteration
+    PREFETCH_DISTANCE        = 256,  // bytes ahead of a copy to prefetch
+    MAX_NON_TEMPORAL_PATTERN = 64    // longest pattern filled non-temporally
+};
+
+typedef bslalg::ArrayPrimitives_Imp::size_type size_type;
+
+void fillByDoubling(char      *begin,
+                    size_type  numBytesInitialized,
+                    size_type  numBytes)
+    // Fill the specified 'numBytes' in the array starting at the specified
+    // 'begin' address by bit-wise copying the specified 'numBytesInitialized'
+    // at every offset that is a multiple of 'numBytesInitialized', copying the
+    // destination onto itself.  The behavior is undefined unless
+    // '0 < numBytesInitialized <= numBytes'.
 {
-    BSLS_ASSERT_SAFE(begin || 0 == numBytes);
-    BSLS_ASSERT(numBytesInitialized <= numBytes);
-
     // Copy the destination onto itself, doubling size at every iteration.
 
     char *end = begin + numBytesInitialized;
@@ -147,6 +206,301 @@ void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
     }
 }
 
+inline
+size_type bytesToAlignment(const void *address)
+    // Return the number of bytes from the specified 'address' to the next
+    // address (inclusive) that is a multiple of 'VECTOR_SIZE'.
+{
+    return (VECTOR_SIZE - reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                                % VECTOR_SIZE)
+                                                                % VECTOR_SIZE;
+}
+
+#if defined(BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES)
+void fillNonTemporal(char      *begin,
+                     size_type  numBytesInitialized,
+                     size_type  numBytes)
+    // Fill the specified 'numBytes' in the array starting at the specified
+    // 'begin' address by bit-wise copying the specified 'numBytesInitialized'
+    // at every offset that is a multiple of 'numBytesInitialized', using
+    // non-temporal stores for all but a prefix.  The behavior is undefined
+    // unless '0 < numBytesInitialized <= MAX_NON_TEMPORAL_PATTERN' and
+    // 'numBytesInitialized <= numBytes'.
+{
+    typedef bslalg::ArrayPrimitives_Imp Imp;
+
+    const size_type prefixSize = Imp::nonTemporalFillPrefixSize(
+                                                         begin,
+                                                         numBytesInitialized);
+    if (numBytes < prefixSize + BLOCK_SIZE) {
+        fillByDoubling(begin, numBytesInitialized, numBytes);
+        return;                                                       // RETURN
+    }
+    fillByDoubling(begin, numBytesInitialized, prefixSize);
+
+    char      *to     = begin + prefixSize;
+    size_type  offset = prefixSize % (BLOCK_SIZE * numBytesInitialized);
+    numBytes -= prefixSize;
+
+    for (; numBytes >= BLOCK_SIZE; numBytes -= BLOCK_SIZE) {
+        const __m128i *from = reinterpret_cast<const __m128i *>(begin
+                                                                + offset);
+        __m128i       *dest = reinterpret_cast<__m128i *>(to);
+
+        const __m128i a = _mm_loadu_si128(from);
+        const __m128i b = _mm_loadu_si128(from + 1);
+        const __m128i c = _mm_loadu_si128(from + 2);
+        const __m128i d = _mm_loadu_si128(from + 3);
+        _mm_stream_si128(dest,     a);
+        _mm_stream_si128(dest + 1, b);
+        _mm_stream_si128(dest + 2, c);
+        _mm_stream_si128(dest + 3, d);
+
+        to     += BLOCK_SIZE;
+        offset  = Imp::nonTemporalFillNextOffset(offset, numBytesInitialized);
+    }
+    _mm_sfence();
+
+    std::memcpy(to, begin + offset, numBytes);
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bslalg {
+
+                       // --------------------------
+                       // struct ArrayPrimitives_Imp
+                       // --------------------------
+
+// CLASS DATA
+bsls::AtomicOperations::AtomicTypes::Int64
+ArrayPrimitives_Imp::s_nonTemporalThreshold = { 0 };
+
+bsls::AtomicOperations::AtomicTypes::Int64
+ArrayPrimitives_Imp::s_memcpyNonTemporalThreshold = { 0 };
+
+// CLASS METHODS
+void ArrayPrimitives_Imp::bitwiseFillN(char      *begin,
+                                       size_type  numBytesInitialized,
+                                       size_type  numBytes)
+{
+    BSLS_ASSERT_SAFE(begin || 0 == numBytes);
+    BSLS_ASSERT(numBytesInitialized <= numBytes);
+
+    if (0 == numBytesInitialized) {
+        return;                                                       // RETURN
+    }
+
+#if defined(BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES)
+    if (numBytes >= ArrayPrimitives::nonTemporalThreshold()
+     && numBytesInitialized <= MAX_NON_TEMPORAL_PATTERN) {
+        fillNonTemporal(begin, numBytesInitialized, numBytes);
+        return;                                                       // RETURN
+    }
+#endif
+
+    fillByDoubling(begin, numBytesInitialized, numBytes);
+}
+
+void ArrayPrimitives_Imp::initNonTemporalThresholds()
+{
+    size_type cacheSize = lastLevelCacheSize();
+    if (0 == cacheSize) {
+        cacheSize = DEFAULT_NON_TEMPORAL_THRESHOLD;
+    }
+
+#if defined(__GLIBC__) && defined(BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES)
+    const bsls::Types::Int64 memcpyThreshold =
+                            static_cast<bsls::Types::Int64>(cacheSize / 4) * 3;
+#else
+    const bsls::Types::Int64 memcpyThreshold = -1;
+#endif
+
+    bsls::AtomicOperations::setInt64Relaxed(&s_memcpyNonTemporalThreshold,
+                                            memcpyThreshold);
+
+    // Do not overwrite a threshold set concurrently by
+    // 'ArrayPrimitives::setNonTemporalThreshold'.
+
+    bsls::AtomicOperations::testAndSwapInt64(
+                                 &s_nonTemporalThreshold,
+                                 0,
+                                 static_cast<bsls::Types::Int64>(cacheSize));
+}
+
+ArrayPrimitives_Imp::size_type ArrayPrimitives_Imp::lastLevelCacheSize()
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    DWORD length = 0;
+    if (GetLogicalProcessorInformation(0, &length)
+     || ERROR_INSUFFICIENT_BUFFER != GetLastError()) {
+        return 0;                                                     // RETURN
+    }
+
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info =
+                  static_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION *>(
+                                                         std::malloc(length));
+    if (!info) {
+        return 0;                                                     // RETURN
+    }
+
+    size_type cacheSize = 0;
+    BYTE      level     = 0;
+    if (GetLogicalProcessorInformation(info, &length)) {
+        const DWORD numEntries = length / sizeof *info;
+        for (DWORD i = 0; i < numEntries; ++i) {
+            const CACHE_DESCRIPTOR& cache = info[i].Cache;
+            if (RelationCache != info[i].Relationship
+             || CacheInstruction == cache.Type
+             || cache.Level < level) {
+                continue;                                           // CONTINUE
+            }
+            if (cache.Level > level || cache.Size > cacheSize) {
+                cacheSize = cache.Size;
+            }
+            level = cache.Level;
+        }
+    }
+    std::free(info);
+    return cacheSize;
+#elif defined(BSLS_PLATFORM_OS_DARWIN)
+    const char *const NAMES[] = { "hw.l3cachesize", "hw.l2cachesize" };
+
+    for (int i = 0; i < 2; ++i) {
+        bsls::Types::Int64 cacheSize = 0;
+        std::size_t        length    = sizeof cacheSize;
+        if (0 == ::sysctlbyname(NAMES[i], &cacheSize, &length, 0, 0)
+         && 0 < cacheSize) {
+            return static_cast<size_type>(cacheSize);                 // RETURN
+        }
+    }
+    return 0;
+#elif defined(_SC_LEVEL3_CACHE_SIZE)
+    long cacheSize = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (cacheSize <= 0) {
+        cacheSize = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+    }
+    return 0 < cacheSize ? static_cast<size_type>(cacheSize) : 0;
+#else
+    return 0;
+#endif
+}
+
+ArrayPrimitives_Imp::size_type
+ArrayPrimitives_Imp::nonTemporalFillPrefixSize(
+                                          const char *begin,
+                                          size_type   numBytesInitialized)
+{
+    BSLS_ASSERT_SAFE(0 < numBytesInitialized);
+    BSLS_ASSERT_SAFE(numBytesInitialized <= MAX_NON_TEMPORAL_PATTERN);
+
+    // Initialize at least a block, plus the 64 bytes that may be read from
+    // the last offset within the block, up to an aligned address.
+
+    const size_type prefixSize = BLOCK_SIZE * numBytesInitialized + BLOCK_SIZE;
+    return prefixSize + bytesToAlignment(begin + prefixSize);
+}
+
+ArrayPrimitives_Imp::size_type
+ArrayPrimitives_Imp::nonTemporalFillNextOffset(
+                                            size_type offset,
+                                            size_type numBytesInitialized)
+{
+    BSLS_ASSERT_SAFE(0 < numBytesInitialized);
+    BSLS_ASSERT_SAFE(numBytesInitialized <= MAX_NON_TEMPORAL_PATTERN);
+
+    // The prefix, and hence every offset, is a multiple of 'BLOCK_SIZE' only
+    // if 'begin' is aligned, so an offset may step past the end of the block
+    // rather than onto it.
+
+    const size_type blockSize = BLOCK_SIZE * numBytesInitialized;
+
+    offset += BLOCK_SIZE;
+    if (offset >= blockSize) {
+        offset -= blockSize;
+    }
+    return offset;
+}
+
+void ArrayPrimitives_Imp::nonTemporalCopy(void       *destination,
+                                          const void *source,
+                                          size_type   numBytes)
+{
+    BSLS_ASSERT_SAFE(destination || 0 == numBytes);
+    BSLS_ASSERT_SAFE(source || 0 == numBytes);
+
+    char       *to   = static_cast<char *>(destination);
+    const char *from = static_cast<const char *>(source);
+
+#if defined(BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES)
+    const size_type headSize = bytesToAlignment(to);
+    if (numBytes >= headSize + BLOCK_SIZE) {
+        std::memcpy(to, from, headSize);
+        to       += headSize;
+        from     += headSize;
+        numBytes -= headSize;
+
+        for (; numBytes >= BLOCK_SIZE; numBytes -= BLOCK_SIZE) {
+            if (numBytes >= PREFETCH_DISTANCE + BLOCK_SIZE) {
+                _mm_prefetch(from + PREFETCH_DISTANCE, _MM_HINT_T0);
+            }
+
+            const __m128i *src  = reinterpret_cast<const __m128i *>(from);
+            __m128i       *dest = reinterpret_cast<__m128i *>(to);
+
+            const __m128i a = _mm_loadu_si128(src);
+            const __m128i b = _mm_loadu_si128(src + 1);
+            const __m128i c = _mm_loadu_si128(src + 2);
+            const __m128i d = _mm_loadu_si128(src + 3);
+            _mm_stream_si128(dest,     a);
+            _mm_stream_si128(dest + 1, b);
+            _mm_stream_si128(dest + 2, c);
+            _mm_stream_si128(dest + 3, d);
+
+            to   += BLOCK_SIZE;
+            from += BLOCK_SIZE;
+        }
+        _mm_sfence();
+    }
+#endif
+
+    std::memcpy(to, from, numBytes);
+}
+
+void ArrayPrimitives_Imp::nonTemporalSet(void      *destination,
+                                         int        value,
+                                         size_type  numBytes)
+{
+    BSLS_ASSERT_SAFE(destination || 0 == numBytes);
+
+    char *to = static_cast<char *>(destination);
+
+#if defined(BSLALG_ARRAYPRIMITIVES_NON_TEMPORAL_STORES)
+    const size_type headSize = bytesToAlignment(to);
+    if (numBytes >= headSize + BLOCK_SIZE) {
+        std::memset(to, value, headSize);
+        to       += headSize;
+        numBytes -= headSize;
+
+        const __m128i bytes = _mm_set1_epi8(static_cast<char>(value));
+        for (; numBytes >= BLOCK_SIZE; numBytes -= BLOCK_SIZE) {
+            __m128i *dest = reinterpret_cast<__m128i *>(to);
+
+            _mm_stream_si128(dest,     bytes);
+            _mm_stream_si128(dest + 1, bytes);
+            _mm_stream_si128(dest + 2, bytes);
+            _mm_stream_si128(dest + 3, bytes);
+
+            to += BLOCK_SIZE;
+        }
+        _mm_sfence();
+    }
+#endif
+
+    std::memset(to, value, numBytes);
+}
+
 void ArrayPrimitives_Imp::uninitializedFillN(
                         short                                     *begin,
                         short                                      value,
@@ -163,7 +517,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
 
     const char *valueBuffer = (const char *) &value;
     if (valueBuffer[0] == valueBuffer[1]) {  // 0, but also -1, 257, etc.
-        std::memset(begin, value, numElements * sizeof value);
+        bitwiseSet(begin, value, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -190,7 +544,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         valueShortBuffer[0] == valueShortBuffer[1]) {
         // The two tests above make sure all four bytes of value are identical.
 
-        std::memset(begin, value, numElements * sizeof value);
+        bitwiseSet(begin, value, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -221,9 +575,9 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         // The three tests above make sure all eight bytes of value are
         // identical.
 
-        std::memset(begin,
-                    static_cast<int>(value),
-                    numElements * sizeof value);
+        bitwiseSet(begin,
+                   static_cast<int>(value),
+                   numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -244,7 +598,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         return;                                                      // RETURN
     }
     if (0 == value) {
-        std::memset(begin, 0, numElements * sizeof value);
+        bitwiseSet(begin, 0, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -265,7 +619,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         return;                                                      // RETURN
     }
     if (0 == value) {
-        std::memset(begin, 0, numElements * sizeof value);
+        bitwiseSet(begin, 0, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -286,7 +640,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         return;                                                      // RETURN
     }
     if (0 == value) {
-        std::memset(begin, 0, numElements * sizeof value);
+        bitwiseSet(begin, 0, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -307,7 +661,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         return;                                                      // RETURN
     }
     if (0 == value) {
-        std::memset(begin, 0, numElements * sizeof value);
+        bitwiseSet(begin, 0, numElements * sizeof value);
     }
     else {
         *begin = value;
@@ -328,7 +682,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
         return;                                                      // RETURN
     }
     if (0 == value) {
-        std::memset(begin, 0, numElements * sizeof value);
+        bitwiseSet(begin, 0, numElements * sizeof value);
     }
     else {
         *begin = value;
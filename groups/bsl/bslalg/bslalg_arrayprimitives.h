@@ -110,6 +110,33 @@ BSLS_IDENT("$Id$ $CSID$")
 // containers, for which the standard explicitly says that 'first' and 'last'
 // shall not be iterators into the container.
 //
+///Large Ranges
+///------------
+// A bit-wise copy, move, or fill of a range of at least
+// 'ArrayPrimitives::nonTemporalThreshold()' bytes uses non-temporal
+// (streaming) stores, where the platform supports them, instead of
+// 'std::memcpy' and 'std::memset'.  Non-temporal stores write to memory
+// without first reading the target into the cache, and do not displace the
+// data other code is working on, which a range larger than the cache would
+// otherwise evict entirely.  The source of a copy is prefetched ahead of use,
+// also without displacing other data.  Note that the target of a streamed
+// range is not cached afterwards, so code that reads the range back soon
+// after writing it pays for a miss on every line.
+//
+// By default, the threshold is the size of the last-level cache of the
+// machine, determined at run time (or 8MB, if it cannot be determined), so
+// that a range that would fit in the cache is written through it.  The
+// threshold can be changed using 'ArrayPrimitives::setNonTemporalThreshold',
+// e.g., to the largest 'size_type' value to disable non-temporal stores.
+//
+// Where the C library's 'memcpy' itself switches to non-temporal stores for
+// large copies (as does that of glibc on x86, from about three quarters of
+// the size of the last-level cache), a bit-wise copy of at least that size is
+// handed to 'std::memcpy', which is typically faster at those sizes than the
+// streaming loop of this component.  Note that non-temporal stores are
+// currently supported only on x86 platforms, where SSE2 is always available
+// on 64-bit processors, and is required of 32-bit builds.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -351,6 +378,10 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
 #ifndef INCLUDED_BSLS_OBJECTBUFFER
 #include <bsls_objectbuffer.h>
 #endif
@@ -653,6 +684,21 @@ struct ArrayPrimitives {
         // exception during this process, all of the elements in
         // '[ first, last )' will have unspecified, but valid, values.  The
         // behavior is undefined unless 'first <= middle <= last'.
+
+    static size_type nonTemporalThreshold();
+        // Return the number of bytes at or above which a range is copied,
+        // moved, or filled bit-wise using non-temporal stores, where
+        // supported.  Unless set otherwise, this is the size of the
+        // last-level cache, determined on first use.  See {Large Ranges}.
+
+    static void setNonTemporalThreshold(size_type numBytes);
+        // Set to the specified 'numBytes' the number of bytes at or above
+        // which a range is copied, moved, or filled bit-wise using
+        // non-temporal stores, where supported.  If 'numBytes' is 0, restore
+        // the default threshold, based on the size of the last-level cache.
+        // Note that this function is intended to be called at startup, and
+        // that operations already in progress, or executing concurrently on
+        // other threads, may use the previous threshold.
 };
 
                      // ==========================
@@ -692,6 +738,25 @@ struct ArrayPrimitives_Imp {
         INPLACE_BUFFER_SIZE = 16 * bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
     };
 
+    enum {
+        // Number of bytes at or above which bit-wise copies and fills use
+        // non-temporal stores, unless set otherwise, if the size of the
+        // last-level cache cannot be determined.
+
+        DEFAULT_NON_TEMPORAL_THRESHOLD = 8 * 1024 * 1024
+    };
+
+    // CLASS DATA
+    static bsls::AtomicOperations::AtomicTypes::Int64 s_nonTemporalThreshold;
+                                 // bytes at or above which non-temporal stores
+                                 // are used, or 0 if not yet determined
+
+    static bsls::AtomicOperations::AtomicTypes::Int64
+                                                s_memcpyNonTemporalThreshold;
+                                 // bytes at or above which 'std::memcpy' is
+                                 // expected to use non-temporal stores itself,
+                                 // -1 if never, or 0 if not yet determined
+
     // CLASS METHODS
     template <class TARGET_TYPE, class ALLOCATOR>
     static void defaultConstruct(
@@ -724,10 +789,82 @@ struct ArrayPrimitives_Imp {
         // Fill the specified 'numBytes' in the array starting at the specified
         // 'begin' address, as if by bit-wise copying the specified
         // 'numBytesInitialized' at every offset that is a multiple of
-        // 'numBytesInitialized' within the output array.  The behavior is
-        // undefined unless 'numBytesInitialized <= numBytes'.  Note that
-        // 'numBytes' usually is, but does not have to be, a multiple of
-        // 'numBytesInitialized'.
+        // 'numBytesInitialized' within the output array, using non-temporal
+        // stores if 'numBytes' is at least the non-temporal threshold.  The
+        // behavior is undefined unless 'numBytesInitialized <= numBytes'.
+        // Note that 'numBytes' usually is, but does not have to be, a
+        // multiple of 'numBytesInitialized'.
+
+    static void bitwiseCopy(void       *destination,
+                            const void *source,
+                            size_type   numBytes);
+        // Copy the specified 'numBytes' from the specified 'source' address
+        // to the specified 'destination' address, as if by 'std::memcpy',
+        // using non-temporal stores if 'numBytes' is at least the
+        // non-temporal threshold, and by 'std::memcpy' itself if 'numBytes'
+        // is at least 'memcpyNonTemporalThreshold()'.  The behavior is
+        // undefined unless the two ranges do not overlap.
+
+    static void bitwiseSet(void *destination, int value, size_type numBytes);
+        // Set each of the specified 'numBytes' starting at the specified
+        // 'destination' address to the specified 'value' converted to
+        // 'unsigned char', as if by 'std::memset', using non-temporal stores
+        // if 'numBytes' is at least the non-temporal threshold.
+
+    static void initNonTemporalThresholds();
+        // Determine the size of the last-level cache and, from it, the default
+        // non-temporal threshold and the value of
+        // 'memcpyNonTemporalThreshold()'.  Set the non-temporal threshold to
+        // its default if it is 0, i.e., if it has not yet been determined or
+        // was reset, and otherwise leave it unchanged.
+
+    static size_type lastLevelCacheSize();
+        // Return the size in bytes of the largest cache of the processor that
+        // is executing this function, or 0 if it cannot be determined.  Note
+        // that this function queries the operating system on every call.
+
+    static size_type memcpyNonTemporalThreshold();
+        // Return the number of bytes at or above which 'std::memcpy' is
+        // expected to use non-temporal stores itself, or the largest
+        // 'size_type' value if it does not use them, or if this component
+        // does not know how it behaves.
+
+    static size_type nonTemporalFillPrefixSize(
+                                         const char *begin,
+                                         size_type   numBytesInitialized);
+        // Return the number of bytes at the start of the array at the
+        // specified 'begin' address that a non-temporal 'bitwiseFillN' with
+        // the specified 'numBytesInitialized' fills using ordinary stores,
+        // before streaming copies of them to the rest of the array.  The
+        // behavior is undefined unless '0 < numBytesInitialized <= 64'.  Note
+        // that this function is exposed only for testing.
+
+    static size_type nonTemporalFillNextOffset(
+                                            size_type offset,
+                                            size_type numBytesInitialized);
+        // Return the offset, from the start of the array, of the bytes that
+        // a non-temporal 'bitwiseFillN' with the specified
+        // 'numBytesInitialized' copies to the 64 bytes following those it
+        // copies from the specified 'offset'.  The behavior is undefined
+        // unless '0 < numBytesInitialized <= 64' and
+        // 'offset < 64 * numBytesInitialized'.  Note that this function is
+        // exposed only for testing.
+
+    static void nonTemporalCopy(void       *destination,
+                                const void *source,
+                                size_type   numBytes);
+        // Copy the specified 'numBytes' from the specified 'source' address
+        // to the specified 'destination' address using non-temporal stores,
+        // where supported, and 'std::memcpy' otherwise.  The behavior is
+        // undefined unless the two ranges do not overlap.
+
+    static void nonTemporalSet(void      *destination,
+                               int        value,
+                               size_type  numBytes);
+        // Set each of the specified 'numBytes' starting at the specified
+        // 'destination' address to the specified 'value' converted to
+        // 'unsigned char' using non-temporal stores, where supported, and
+        // 'std::memset' otherwise.
 
     static void uninitializedFillN(
                         bool                                      *begin,
@@ -1554,11 +1691,73 @@ void ArrayPrimitives::rotate(TARGET_TYPE *first,
                                 (bslmf::MetaInt<VALUE>*)0);
 }
 
+inline
+ArrayPrimitives::size_type ArrayPrimitives::nonTemporalThreshold()
+{
+    bsls::Types::Int64 threshold = bsls::AtomicOperations::getInt64Relaxed(
+                                 &ArrayPrimitives_Imp::s_nonTemporalThreshold);
+    if (0 == threshold) {
+        ArrayPrimitives_Imp::initNonTemporalThresholds();
+        threshold = bsls::AtomicOperations::getInt64Relaxed(
+                                 &ArrayPrimitives_Imp::s_nonTemporalThreshold);
+    }
+    return static_cast<size_type>(threshold);
+}
+
+inline
+void ArrayPrimitives::setNonTemporalThreshold(size_type numBytes)
+{
+    bsls::AtomicOperations::setInt64Relaxed(
+                                 &ArrayPrimitives_Imp::s_nonTemporalThreshold,
+                                 static_cast<bsls::Types::Int64>(numBytes));
+}
+
                      // --------------------------
                      // struct ArrayPrimitives_Imp
                      // --------------------------
 
 // CLASS METHODS
+inline
+void ArrayPrimitives_Imp::bitwiseCopy(void       *destination,
+                                      const void *source,
+                                      size_type   numBytes)
+{
+    if (numBytes < ArrayPrimitives::nonTemporalThreshold()
+     || numBytes >= memcpyNonTemporalThreshold()) {
+        std::memcpy(destination, source, numBytes);
+    }
+    else {
+        nonTemporalCopy(destination, source, numBytes);
+    }
+}
+
+inline
+ArrayPrimitives_Imp::size_type
+ArrayPrimitives_Imp::memcpyNonTemporalThreshold()
+{
+    bsls::Types::Int64 threshold = bsls::AtomicOperations::getInt64Relaxed(
+                                                &s_memcpyNonTemporalThreshold);
+    if (0 == threshold) {
+        initNonTemporalThresholds();
+        threshold = bsls::AtomicOperations::getInt64Relaxed(
+                                                &s_memcpyNonTemporalThreshold);
+    }
+    return static_cast<size_type>(threshold);
+}
+
+inline
+void ArrayPrimitives_Imp::bitwiseSet(void      *destination,
+                                     int        value,
+                                     size_type  numBytes)
+{
+    if (numBytes < ArrayPrimitives::nonTemporalThreshold()) {
+        std::memset(destination, value, numBytes);
+    }
+    else {
+        nonTemporalSet(destination, value, numBytes);
+    }
+}
+
 
               // *** 'defaultConstruct' overloads: ***
 
@@ -1573,7 +1772,7 @@ void ArrayPrimitives_Imp::defaultConstruct(
     BSLS_ASSERT_SAFE(begin || 0 == numElements);
     BSLMF_ASSERT((bsl::is_same<size_type, std::size_t>::value));
 
-    std::memset((void *)begin, 0, sizeof(TARGET_TYPE) * numElements);
+    bitwiseSet((void *)begin, 0, sizeof(TARGET_TYPE) * numElements);
 }
 
 template <class TARGET_TYPE, class ALLOCATOR>
@@ -1626,7 +1825,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
     BSLS_ASSERT_SAFE(begin || 0 == numElements);
     BSLMF_ASSERT((bsl::is_same<size_type, std::size_t>::value));
 
-    std::memset((char *)begin, (char)value, numElements);
+    bitwiseSet((char *)begin, (char)value, numElements);
 }
 
 inline
@@ -1640,7 +1839,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
     BSLS_ASSERT_SAFE(begin || 0 == numElements);
     BSLMF_ASSERT((bsl::is_same<size_type, std::size_t>::value));
 
-    std::memset(begin, value, numElements);
+    bitwiseSet(begin, value, numElements);
 }
 
 inline
@@ -1654,7 +1853,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
     BSLS_ASSERT_SAFE(begin || 0 == numElements);
     BSLMF_ASSERT((bsl::is_same<size_type, std::size_t>::value));
 
-    std::memset(begin, value, numElements);
+    bitwiseSet(begin, value, numElements);
 }
 
 inline
@@ -1668,7 +1867,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
     BSLS_ASSERT_SAFE(begin || 0 == numElements);
     BSLMF_ASSERT((bsl::is_same<size_type, std::size_t>::value));
 
-    std::memset(begin, value, numElements);
+    bitwiseSet(begin, value, numElements);
 }
 
 inline
@@ -1860,7 +2059,7 @@ void ArrayPrimitives_Imp::uninitializedFillN(
     }
 
     if (index == sizeof value) {
-        std::memset(begin, valueBuffer[0], sizeof(TARGET_TYPE) * numElements);
+        bitwiseSet(begin, valueBuffer[0], sizeof(TARGET_TYPE) * numElements);
     } else {
         std::memcpy(begin, valueBuffer, sizeof(TARGET_TYPE));
         bitwiseFillN((char *)begin,
@@ -1931,7 +2130,7 @@ void ArrayPrimitives_Imp::copyConstruct(
                                                           fromEnd));
 
     const size_type numBytes = (const char*)fromEnd - (const char*)fromBegin;
-    std::memcpy(toBegin, fromBegin, numBytes);
+    bitwiseCopy(toBegin, fromBegin, numBytes);
 }
 
 template <class TARGET_TYPE, class FWD_ITER, class ALLOCATOR>
@@ -1974,7 +2173,7 @@ void ArrayPrimitives_Imp::destructiveMove(
                                                           fromEnd));
 
     const size_type numBytes = (const char*)fromEnd - (const char*)fromBegin;
-    std::memcpy(toBegin, fromBegin, numBytes);
+    bitwiseCopy(toBegin, fromBegin, numBytes);
 }
 
 template <class TARGET_TYPE, class ALLOCATOR>
@@ -2325,7 +2524,7 @@ void ArrayPrimitives_Imp::insert(
     //  Transformation: _______ABCDE => tuvwxyzABCDE (no overlap).
     //..
 
-    std::memcpy(toBegin, fromBegin, numElements * sizeof(TARGET_TYPE));
+    bitwiseCopy(toBegin, fromBegin, numElements * sizeof(TARGET_TYPE));
 }
 
 template <class TARGET_TYPE, class FWD_ITER, class ALLOCATOR>
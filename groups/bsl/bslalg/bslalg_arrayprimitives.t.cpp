@@ -10,6 +10,7 @@
 #include <bslma_testallocator.h>          // for testing only
 #include <bslma_testallocatorexception.h> // for testing only
 #include <bsls_alignmentutil.h>           // for testing only
+#include <bsls_atomic.h>                  // for testing only
 #include <bsls_objectbuffer.h>            // for testing only
 #include <bsls_platform.h>                // for testing only
 #include <bsls_stopwatch.h>               // for testing only
@@ -21,6 +22,14 @@
 #include <cstring>     // strlen()
 #include <ctype.h>     // isalpha()
 
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>   // CreateThread()
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
 using namespace BloombergLP;
 using namespace std;
 
@@ -61,9 +70,16 @@ using namespace std;
 // [ 4] void destructiveMoveAndMoveInsert(...);
 // [ 7] void erase(T *srcE, T *srcPos, T *srcE, *a);
 // [ 8] void rotate(T *dstB, T *dstE, n, *a);
+// [ 9] size_type nonTemporalThreshold();
+// [ 9] void setNonTemporalThreshold(size_type numBytes);
+// [ 9] size_type lastLevelCacheSize();
+// [ 9] size_type memcpyNonTemporalThreshold();
+// [ 9] size_type nonTemporalFillPrefixSize(const char *, size_type);
+// [ 9] size_type nonTemporalFillNextOffset(size_type, size_type);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] LARGE RANGES
+// [10] USAGE EXAMPLE
 
 //=============================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -1273,6 +1289,133 @@ void testRotate(bool bitwiseMoveableFlag,
     }
 }
 
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR CASE -2
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+class WorkingSetWalker {
+    // This class models a cache-resident workload: a working set of a
+    // specified size that can be walked, one cache line at a time, either
+    // once by the caller or repeatedly by a background thread.
+
+    // DATA
+    int               *d_data_p;       // working set
+    int                d_numInts;      // size of the working set, in 'int'
+    int                d_sum;          // result of the walks (unused)
+    bsls::AtomicInt    d_stopFlag;     // set to stop the background thread
+    bsls::AtomicInt    d_numPasses;    // walks made by the background thread
+    my_thread_t        d_thread;       // background thread
+    bslma::Allocator  *d_allocator_p;  // allocator for the working set
+
+    // PRIVATE CLASS METHODS
+    static void *threadFunction(void *arg);
+        // Walk the working set of the 'WorkingSetWalker' object pointed to by
+        // the specified 'arg' repeatedly until its stop flag is set.
+
+  private:
+    // NOT IMPLEMENTED
+    WorkingSetWalker(const WorkingSetWalker&);
+    WorkingSetWalker& operator=(const WorkingSetWalker&);
+
+  public:
+    // CREATORS
+    WorkingSetWalker(int numBytes, bslma::Allocator *basicAllocator)
+        // Create a walker over a working set of the specified 'numBytes',
+        // using the specified 'basicAllocator' to supply memory.
+    : d_numInts(numBytes / (int)sizeof(int))
+    , d_sum(0)
+    , d_stopFlag(0)
+    , d_numPasses(0)
+    , d_allocator_p(basicAllocator)
+    {
+        d_data_p = (int *)d_allocator_p->allocate(d_numInts * sizeof(int));
+        memset(d_data_p, 0, d_numInts * sizeof(int));
+    }
+
+    ~WorkingSetWalker()
+        // Destroy this object.
+    {
+        d_allocator_p->deallocate(d_data_p);
+    }
+
+    // MANIPULATORS
+    void walk()
+        // Read and modify one 'int' in every cache line of the working set.
+    {
+        enum { STRIDE = 64 / sizeof(int) };
+        for (int i = 0; i < d_numInts; i += STRIDE) {
+            d_sum += ++d_data_p[i];
+        }
+    }
+
+    void start()
+        // Start walking the working set repeatedly in a background thread.
+    {
+        d_stopFlag = 0;
+        d_numPasses = 0;
+        int rc = myCreateThread(&d_thread, &threadFunction, this);
+        ASSERT(0 == rc);
+    }
+
+    int stop()
+        // Stop the background thread, and return the number of walks it
+        // completed since 'start' was called.
+    {
+        d_stopFlag = 1;
+        myJoinThread(d_thread);
+        return d_numPasses;
+    }
+};
+
+void *WorkingSetWalker::threadFunction(void *arg)
+{
+    WorkingSetWalker *walker = static_cast<WorkingSetWalker *>(arg);
+    while (!walker->d_stopFlag) {
+        walker->walk();
+        ++walker->d_numPasses;
+    }
+    return 0;
+}
+
+typedef void (*CopyFunction)(void           *destination,
+                             const void     *source,
+                             Obj::size_type  numBytes);
+
+static void copyByMemcpy(void           *destination,
+                         const void     *source,
+                         Obj::size_type  numBytes)
+    // Copy the specified 'numBytes' from the specified 'source' address to
+    // the specified 'destination' address using 'memcpy'.
+{
+    memcpy(destination, source, numBytes);
+}
+
 //=============================================================================
 //                  GLOBAL HELPER FUNCTIONS FOR CASE 7
 //-----------------------------------------------------------------------------
@@ -3116,7 +3259,7 @@ int main(int argc, char *argv[])
     Z = &testAllocator;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -3161,6 +3304,292 @@ int main(int argc, char *argv[])
             ASSERT(u[i] == DATA[i]);
         }
       }
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING LARGE RANGES
+        //
+        // Concerns:
+        //: 1 The default non-temporal threshold is the size of the last-level
+        //:   cache, or 8MB if that cannot be determined.
+        //:   'setNonTemporalThreshold' changes the value returned by
+        //:   'nonTemporalThreshold', and restores the default if passed 0.
+        //:
+        //: 2 The size of the last-level cache, if determined, is plausible,
+        //:   and copies are handed to 'memcpy' only at or above a size no
+        //:   larger than the default threshold.
+        //:
+        //: 3 The non-temporal copy and set produce the same bytes as 'memcpy'
+        //:   and 'memset', for any length and any relative alignment of the
+        //:   source and destination, and do not write outside the range.
+        //:
+        //: 4 A pattern fill above the threshold replicates the pattern over
+        //:   the whole range, whatever the size of the pattern.
+        //:
+        //: 5 The bit-wise algorithms of the public interface produce the same
+        //:   result above the threshold as below it.
+        //:
+        //: 6 A non-temporal pattern fill reads the source of each streamed 64
+        //:   bytes from the prefix filled by ordinary stores (which is still
+        //:   cached), and never from bytes it has streamed, whatever the
+        //:   alignment of the array; the source holds the same bytes of the
+        //:   pattern as the destination.
+        //
+        // Plan:
+        //: 1 Verify the default value of the threshold, then set it to a few
+        //:   values and read it back, and reset it with 0.  (C-1)
+        //:
+        //: 2 Verify that the size of the last-level cache is 0 or between
+        //:   64KB and 4GB, and that 'memcpyNonTemporalThreshold' is either
+        //:   the largest 'size_type' value or at most the default threshold.
+        //:   (C-2)
+        //:
+        //: 3 With a threshold of 1, copy and set every length up to a few
+        //:   hundred bytes at every offset up to 15 into a guarded buffer,
+        //:   and compare to the expected bytes and guards.  (C-3)
+        //:
+        //: 4 With a threshold of 1, fill ranges of various lengths with
+        //:   patterns of various sizes, and verify every byte.  (C-4)
+        //:
+        //: 5 With a threshold of 1, exercise 'copyConstruct',
+        //:   'destructiveMove', 'uninitializedFillN', and 'defaultConstruct'
+        //:   on ranges of fundamental types, and verify the resulting values.
+        //:   (C-5)
+        //:
+        //: 6 For every pattern size that is filled non-temporally, and for
+        //:   every misalignment of the array, step through the source offsets
+        //:   of the first few blocks streamed, and verify that each source
+        //:   lies within the prefix, and is congruent to the destination
+        //:   modulo the pattern size.  (C-6)
+        //
+        // Testing:
+        //   size_type nonTemporalThreshold();
+        //   void setNonTemporalThreshold(size_type numBytes);
+        //   size_type lastLevelCacheSize();
+        //   size_type memcpyNonTemporalThreshold();
+        //   size_type nonTemporalFillPrefixSize(const char *, size_type);
+        //   size_type nonTemporalFillNextOffset(size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING LARGE RANGES"
+                            "\n====================\n");
+
+        typedef bslalg::ArrayPrimitives_Imp Imp;
+
+        const Obj::size_type CACHE_SIZE = Imp::lastLevelCacheSize();
+        const Obj::size_type DEFAULT    = CACHE_SIZE
+                                        ? CACHE_SIZE
+                                        : 8 * 1024 * 1024;
+
+        const Obj::size_type MEMCPY     = Imp::memcpyNonTemporalThreshold();
+
+        if (veryVerbose) {
+            printf("\tCACHE_SIZE = %lu, MEMCPY = %lu\n",
+                   (unsigned long)CACHE_SIZE,
+                   (unsigned long)MEMCPY);
+        }
+
+        if (verbose) printf("\tDefault value and round trip.\n");
+        {
+            ASSERT(DEFAULT == Obj::nonTemporalThreshold());
+
+            Obj::setNonTemporalThreshold(1);
+            ASSERT(1 == Obj::nonTemporalThreshold());
+
+            Obj::setNonTemporalThreshold(12345);
+            ASSERT(12345 == Obj::nonTemporalThreshold());
+
+            Obj::setNonTemporalThreshold(0);
+            ASSERT(DEFAULT == Obj::nonTemporalThreshold());
+
+            Obj::setNonTemporalThreshold(DEFAULT);
+            ASSERT(DEFAULT == Obj::nonTemporalThreshold());
+        }
+
+        if (verbose) printf("\tCache size and 'memcpy' hand-off.\n");
+        {
+            const bsls::Types::Uint64 MIN_CACHE_SIZE = 64 * 1024;
+            const bsls::Types::Uint64 MAX_CACHE_SIZE =
+                                    static_cast<bsls::Types::Uint64>(4) << 30;
+
+            ASSERT(0 == CACHE_SIZE || (MIN_CACHE_SIZE <= CACHE_SIZE
+                                    && CACHE_SIZE <= MAX_CACHE_SIZE));
+
+            ASSERT((Obj::size_type)-1 == MEMCPY || MEMCPY <= DEFAULT);
+            ASSERT(0 < MEMCPY);
+        }
+
+        Obj::setNonTemporalThreshold(1);
+
+        if (verbose) printf("\tNon-temporal copy and set.\n");
+        {
+            enum { MAX_LEN = 300, MAX_OFFSET = 16, GUARD = 64 };
+            const int SIZE = MAX_LEN + MAX_OFFSET + 2 * GUARD;
+
+            char source[SIZE];
+            char buffer[SIZE];
+            char expected[SIZE];
+
+            for (int i = 0; i < SIZE; ++i) {
+                source[i] = (char)(i * 7 + 3);
+            }
+
+            for (int len = 0; len <= MAX_LEN; ++len) {
+                for (int dst = 0; dst < MAX_OFFSET; ++dst) {
+                    for (int src = 0; src < MAX_OFFSET; ++src) {
+                        memset(buffer, '#', SIZE);
+                        memset(expected, '#', SIZE);
+                        memcpy(expected + GUARD + dst, source + src, len);
+
+                        Imp::bitwiseCopy(buffer + GUARD + dst,
+                                         source + src,
+                                         len);
+                        LOOP3_ASSERT(len, dst, src,
+                                     0 == memcmp(expected, buffer, SIZE));
+                    }
+
+                    memset(buffer, '#', SIZE);
+                    memset(expected, '#', SIZE);
+                    memset(expected + GUARD + dst, 0xA5, len);
+
+                    Imp::bitwiseSet(buffer + GUARD + dst, 0xA5, len);
+                    LOOP2_ASSERT(len, dst,
+                                 0 == memcmp(expected, buffer, SIZE));
+                }
+            }
+        }
+
+        if (verbose) printf("\tPattern fill.\n");
+        {
+            const int PATTERNS[] = { 1, 2, 3, 4, 7, 8, 12, 16, 24, 64, 65 };
+            const int NUM_PATTERNS = sizeof PATTERNS / sizeof *PATTERNS;
+
+            enum { GUARD = 64, MAX_LEN = 4096 };
+            const int SIZE = MAX_LEN + 2 * GUARD;
+
+            char *buffer = (char *)Z->allocate(SIZE);
+
+            for (int ti = 0; ti < NUM_PATTERNS; ++ti) {
+                const int PATTERN = PATTERNS[ti];
+
+                for (int len = PATTERN; len <= MAX_LEN; len += 37) {
+                    memset(buffer, '#', SIZE);
+                    char *begin = buffer + GUARD + ti;
+                    for (int i = 0; i < PATTERN; ++i) {
+                        begin[i] = (char)(i + 1);
+                    }
+
+                    Imp::bitwiseFillN(begin, PATTERN, len);
+
+                    for (int i = 0; i < len; ++i) {
+                        LOOP3_ASSERT(PATTERN, len, i,
+                                     (char)(i % PATTERN + 1) == begin[i]);
+                    }
+                    for (char *p = buffer; p < begin; ++p) {
+                        LOOP2_ASSERT(PATTERN, len, '#' == *p);
+                    }
+                    for (char *p = begin + len; p < buffer + SIZE; ++p) {
+                        LOOP2_ASSERT(PATTERN, len, '#' == *p);
+                    }
+                }
+            }
+
+            Z->deallocate(buffer);
+        }
+
+        if (verbose) printf("\tSources of a non-temporal fill.\n");
+        {
+            enum { BLOCK = 64, MAX_PATTERN = 64, NUM_BLOCKS = 4 };
+
+            static bsls::AlignmentUtil::MaxAlignedType buffer[BLOCK];
+            const char *base = reinterpret_cast<const char *>(buffer);
+
+            for (Obj::size_type pattern = 1; pattern <= MAX_PATTERN;
+                                                                  ++pattern) {
+                const Obj::size_type blockSize = BLOCK * pattern;
+
+                for (int misalign = 0; misalign < 16; ++misalign) {
+                    const char *begin = base + misalign;
+
+                    const Obj::size_type prefixSize =
+                             Imp::nonTemporalFillPrefixSize(begin, pattern);
+
+                    LOOP2_ASSERT(pattern, misalign,
+                                 blockSize + BLOCK <= prefixSize);
+                    LOOP2_ASSERT(pattern, misalign,
+                                 prefixSize < blockSize + BLOCK + 16);
+                    LOOP2_ASSERT(pattern, misalign,
+                                 0 == (bsls::Types::UintPtr)(begin
+                                                         + prefixSize) % 16);
+
+                    Obj::size_type offset = prefixSize % blockSize;
+                    for (Obj::size_type to = prefixSize;
+                         to < prefixSize + NUM_BLOCKS * blockSize;
+                         to += BLOCK) {
+                        LOOP3_ASSERT(pattern, misalign, to,
+                                     offset + BLOCK <= prefixSize);
+                        LOOP3_ASSERT(pattern, misalign, to,
+                                     offset < blockSize);
+                        LOOP3_ASSERT(pattern, misalign, to,
+                                     offset % pattern == to % pattern);
+
+                        offset = Imp::nonTemporalFillNextOffset(offset,
+                                                                pattern);
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("\tPublic interface.\n");
+        {
+            enum { NUM_ELEMENTS = 25 * 1024 + 3 };
+
+            int *source = (int *)Z->allocate(NUM_ELEMENTS * sizeof(int));
+            int *buffer = (int *)Z->allocate(NUM_ELEMENTS * sizeof(int));
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                source[i] = i * 13 - 5;
+            }
+
+            Obj::copyConstruct(buffer, source, source + NUM_ELEMENTS, Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, source[i] == buffer[i]);
+            }
+
+            memset(source, 0, NUM_ELEMENTS * sizeof(int));
+            Obj::destructiveMove(source, buffer, buffer + NUM_ELEMENTS, Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, i * 13 - 5 == source[i]);
+            }
+
+            Obj::uninitializedFillN(buffer, NUM_ELEMENTS, 0, Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, 0 == buffer[i]);
+            }
+
+            Obj::uninitializedFillN(buffer, NUM_ELEMENTS, 0x1234567, Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, 0x1234567 == buffer[i]);
+            }
+
+            Obj::uninitializedFillN((char *)buffer,
+                                    NUM_ELEMENTS,
+                                    (char)'x',
+                                    Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, 'x' == ((char *)buffer)[i]);
+            }
+
+            Obj::defaultConstruct(source, NUM_ELEMENTS, Z);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                LOOP_ASSERT(i, 0 == source[i]);
+            }
+
+            Z->deallocate(buffer);
+            Z->deallocate(source);
+        }
+
+        Obj::setNonTemporalThreshold(DEFAULT);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING rotate
@@ -3728,6 +4157,142 @@ int main(int argc, char *argv[])
         Z->deallocate(rawBuffer);
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // NON-TEMPORAL COPY BENCHMARK
+        //
+        // Concerns:
+        //   Above the non-temporal threshold, bit-wise copies should run at
+        //   least at the bandwidth of 'memcpy', while evicting less of the
+        //   cache-resident working set of the rest of the program.
+        //
+        // Plan:
+        //   For 'memcpy', the non-temporal copy loop, and 'bitwiseCopy' with
+        //   the default thresholds (which hands large copies to 'memcpy'
+        //   where 'memcpy' streams them itself), time copying a large range,
+        //   then time one pass over a warm working set made just after a
+        //   copy, and finally measure the throughput of a thread walking
+        //   that working set while the main thread copies.  Note that the
+        //   last measure is only meaningful on a machine with more than one
+        //   CPU, since otherwise the threads merely share time slices.
+        //
+        // Testing:
+        //   NON-TEMPORAL COPY BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nNON-TEMPORAL COPY BENCHMARK"
+                            "\n===========================\n");
+
+        enum {
+            RANGE_SIZE       = 256 * 1024 * 1024,
+            WORKING_SET_SIZE = 1024 * 1024,
+            NUM_ITER         = 4
+        };
+
+        const int rangeSize = (argc > 2) ? atoi(argv[2]) : RANGE_SIZE;
+        const int workingSetSize = (argc > 3) ? atoi(argv[3])
+                                              : WORKING_SET_SIZE;
+        const int numIter = (argc > 4) ? atoi(argv[4]) : NUM_ITER;
+
+        printf("\nUsage: %s -2 [rangeSize] [workingSetSize] [numIter]"
+               "\n\trangeSize\tin bytes (default: 268435456)"
+               "\n\tworkingSetSize\tin bytes (default: 1048576)"
+               "\n\tnumIter\t\tto be repeated (default: 4 times)\n",
+               __FILE__);
+
+        const int numElements = rangeSize / (int)sizeof(int);
+
+        // Use the default allocator to keep the allocations out of the
+        // bookkeeping of the test allocator.
+
+        bslma::Allocator *da = bslma::Default::defaultAllocator();
+        int *source = (int *)da->allocate(numElements * sizeof(int));
+        int *buffer = (int *)da->allocate(numElements * sizeof(int));
+        memset(source, 1, numElements * sizeof(int));
+        memset(buffer, 0, numElements * sizeof(int));
+
+        WorkingSetWalker walker(workingSetSize, da);
+
+        typedef bslalg::ArrayPrimitives_Imp Imp;
+
+        const Obj::size_type numBytes = numElements * sizeof(int);
+
+        if (verbose) {
+            printf("\n\tlast-level cache size          : %u"
+                   "\n\tnon-temporal threshold         : %u"
+                   "\n\tmemcpy non-temporal threshold  : %u\n",
+                   (unsigned)Imp::lastLevelCacheSize(),
+                   (unsigned)Obj::nonTemporalThreshold(),
+                   (unsigned)Imp::memcpyNonTemporalThreshold());
+        }
+
+        const struct {
+            const char   *d_name;
+            CopyFunction  d_copy;
+        } MODES[] = {
+            { "memcpy      ", &copyByMemcpy          },
+            { "non-temporal", &Imp::nonTemporalCopy  },
+            { "bitwiseCopy ", &Imp::bitwiseCopy      }
+        };
+        const int NUM_MODES = sizeof MODES / sizeof *MODES;
+
+        double baseline = 0;
+        for (int i = 0; i < 8; ++i) {
+            walker.walk();
+            bsls::Stopwatch timer;
+            timer.start();
+            walker.walk();
+            timer.stop();
+            if (0 == i || timer.elapsedTime() < baseline) {
+                baseline = timer.elapsedTime();
+            }
+        }
+        printf("\n\twarm pass over working set     : %f\n", baseline);
+
+        for (int ti = 0; ti < NUM_MODES; ++ti) {
+            const CopyFunction copy = MODES[ti].d_copy;
+
+            printf("\n\t%s\n", MODES[ti].d_name);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < numIter; ++i) {
+                copy(buffer, source, numBytes);
+            }
+            timer.stop();
+            const double elapsed = timer.elapsedTime();
+            printf("\tcopy time                      : %f\n", elapsed);
+            printf("\tcopy bandwidth (MB/s)          : %f\n",
+                   elapsed > 0 ? numIter * (rangeSize / 1048576.0) / elapsed
+                               : 0.0);
+
+            walker.walk();
+            copy(buffer, source, numBytes);
+            timer.reset();
+            timer.start();
+            walker.walk();
+            timer.stop();
+            printf("\tpass over working set after    : %f (x%f)\n",
+                   timer.elapsedTime(),
+                   baseline > 0 ? timer.elapsedTime() / baseline : 0.0);
+
+            walker.start();
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numIter; ++i) {
+                copy(buffer, source, numBytes);
+            }
+            timer.stop();
+            const int numPasses = walker.stop();
+            printf("\tconcurrent passes per second   : %f\n",
+                   timer.elapsedTime() > 0
+                                      ? numPasses / timer.elapsedTime()
+                                      : 0.0);
+        }
+
+        da->deallocate(buffer);
+        da->deallocate(source);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -326,14 +326,17 @@ class ContainerBase : public
 
     void deallocate(pointer p, size_type n = 1);
         // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the mechanism object.
-        // The 'n' argument is ignored by this allocator type.
+        // mechanism object by calling 'deallocate' on the mechanism object,
+        // passing the specified number of objects 'n'.  The behavior is
+        // undefined unless 'p' was obtained from a call to 'allocate' with an
+        // argument of 'n'.
 
     template <class T>
     void deallocateN(T *p, size_type n)
         // Return 'n' objects of type 'T', starting at 'p' to the allocator
         // returned by 'allocator'.  Does not call destructors on the
-        // deallocated objects.
+        // deallocated objects.  The behavior is undefined unless 'p' was
+        // obtained from a call to 'allocateN' with an argument of 'n'.
     {
         rebindAllocator(p).deallocate(p, n);
     }
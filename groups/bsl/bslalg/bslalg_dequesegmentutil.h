@@ -0,0 +1,617 @@
+// bslalg_dequesegmentutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLALG_DEQUESEGMENTUTIL
+#define INCLUDED_BSLALG_DEQUESEGMENTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide algorithms that process deque ranges one block at a time.
+//
+//@CLASSES:
+//  bslalg::DequeSegmentUtil: namespace for segmented deque algorithms
+//
+//@SEE_ALSO: bslalg_dequeiterator, bslalg_dequeprimitives, bslalg_rangecompare
+//
+//@DESCRIPTION: This component provides a namespace, 'DequeSegmentUtil', for
+// algorithms ('find', 'count', 'fill', 'forEach', 'copy', 'equal', and
+// 'lexicographical') on ranges of a deque specified by a pair of
+// 'bslalg::DequeIterator' objects.  A generic algorithm applied to deque
+// iterators must check for the end of a block at every increment, which adds
+// a branch to each step and prevents the compiler from vectorizing the loop.
+// Instead, the algorithms of this component split the range into its
+// *segments*, i.e., the maximal sub-ranges lying in a single block, each of
+// which is a contiguous array of elements, and process each segment with a
+// loop over raw pointers.  When two ranges are involved, each step processes
+// the longest prefix of both ranges that is contiguous in both.
+//
+// Where the value type permits, a segment is processed by a single call to a
+// bulk primitive, as shown in the table below, where 'Rc' stands for
+// 'bslalg::RangeCompare':
+//..
+//  Algorithm        Bulk primitive used per segment
+//  ---------------  ----------------------------------------------------------
+//  find             'std::memchr' for fundamental types of size 1
+//
+//  fill             'std::memset' for fundamental types of size 1
+//
+//  copy             'std::memmove' if 'bsl::is_trivially_copyable'
+//
+//  equal            'Rc::equal' ('std::memcmp' if
+//                   'bslmf::IsBitwiseEqualityComparable')
+//
+//  lexicographical  'Rc::lexicographical' ('std::memcmp' for character types,
+//                   a bit-wise search for fundamental types)
+//..
+// Other value types use a loop over the elements of each segment, which the
+// compiler is then free to unroll or vectorize.  Like 'bslalg_dequeiterator',
+// this component is for use by the 'bslstl' package.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Range of a Deque
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we are handed a deque of characters as an array of blocks, and
+// want to count and locate the occurrences of a character in it.
+//
+// First, we create three blocks of four characters each and an array of
+// pointers to these blocks, which is the structure that 'bsl::deque' uses:
+//..
+//  typedef bslalg::DequeImpUtil<char, 4>  ImpUtil;
+//  typedef bslalg::DequeIterator<char, 4> Iterator;
+//
+//  ImpUtil::Block     blocks[3];
+//  ImpUtil::BlockPtr  blockPtrs[3] = { &blocks[0], &blocks[1], &blocks[2] };
+//..
+// Then, we create iterators to the range of ten characters starting at the
+// second element of the first block, and fill it with a text:
+//..
+//  Iterator first(blockPtrs, blocks[0].d_data + 1);
+//  Iterator last(blockPtrs + 2, blocks[2].d_data + 3);
+//  assert(10 == last - first);
+//
+//  const char *TEXT = "abracadabr";
+//  Iterator it = first;
+//  for (int i = 0; i < 10; ++i, ++it) {
+//      *it = TEXT[i];
+//  }
+//..
+// Now, we count and locate the occurrences of 'r' in the range, which spans
+// the three blocks; each block is searched using 'std::memchr':
+//..
+//  assert(2 == bslalg::DequeSegmentUtil::count(first, last, 'r'));
+//
+//  Iterator r1 = bslalg::DequeSegmentUtil::find(first, last, 'r');
+//  assert(2 == r1 - first);
+//
+//  Iterator r2 = bslalg::DequeSegmentUtil::find(r1 + 1, last, 'r');
+//  assert(9 == r2 - first);
+//
+//  assert(last == bslalg::DequeSegmentUtil::find(first, last, 'z'));
+//..
+// Finally, we replace the last four characters, and compare the range to
+// itself shifted by one block:
+//..
+//  bslalg::DequeSegmentUtil::fill(first + 6, last, 'x');
+//  assert('a' == *(first + 5));
+//  assert('x' == *(first + 6));
+//
+//  assert(bslalg::DequeSegmentUtil::equal(first, first + 3, first + 7)
+//                                                                 == false);
+//  assert(bslalg::DequeSegmentUtil::lexicographical(first, first + 3,
+//                                                   first + 6, last) < 0);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_DEQUEITERATOR
+#include <bslalg_dequeiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISFUNDAMENTAL
+#include <bslmf_isfundamental.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>  // std::memchr, std::memmove, std::memset
+#define INCLUDED_CSTRING
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                          // =======================
+                          // struct DequeSegmentUtil
+                          // =======================
+
+struct DequeSegmentUtil {
+    // This 'struct' provides a namespace for algorithms on ranges of a deque,
+    // specified as a pair of 'DequeIterator' objects, that process each
+    // contiguous segment of the range as an array.  In all the methods below,
+    // the behavior is undefined unless each range is a valid range of
+    // elements in a deque, i.e., 'last' is reachable from 'first' by
+    // incrementing it, and every block pointer in between (including that of
+    // 'last') refers to an allocated block.
+
+    // CLASS METHODS
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static std::size_t count(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                             DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                             const VALUE_TYPE&                       value);
+        // Return the number of elements in the range '[first, last)' that
+        // compare equal to the specified 'value' using 'operator=='.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static DequeIterator<VALUE_TYPE, BLOCK_LENGTH>
+    find(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+         DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+         const VALUE_TYPE&                       value);
+        // Return an iterator to the first element in the specified range
+        // '[first, last)' that compares equal to the specified 'value' using
+        // 'operator==', or 'last' if there is no such element.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static void fill(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                     DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                     const VALUE_TYPE&                       value);
+        // Assign the specified 'value' to each element in the specified range
+        // '[first, last)'.  Note that 'value' may refer to an element of the
+        // range.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH, class FUNCTOR>
+    static FUNCTOR forEach(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                           DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                           FUNCTOR                                 functor);
+        // Invoke the specified 'functor' on each element in the specified
+        // range '[first, last)', in order, and return 'functor'.  'FUNCTOR'
+        // must be invocable with a single argument of type 'VALUE_TYPE&'.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static DequeIterator<VALUE_TYPE, BLOCK_LENGTH>
+    copy(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+         DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+         DequeIterator<VALUE_TYPE, BLOCK_LENGTH> result);
+        // Assign the elements in the specified range '[first, last)', in
+        // order, to the elements of the range of the same length starting at
+        // the specified 'result', and return an iterator to the end of that
+        // range.  The behavior is undefined unless 'result' is not in the
+        // range '[first, last)'.  Note that this operation uses
+        // 'std::memmove' if 'VALUE_TYPE' is bit-wise copyable.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static bool equal(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first1,
+                      DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last1,
+                      DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first2);
+        // Return 'true' if each element in the specified range
+        // '[first1, last1)' compares equal to the corresponding element in
+        // the range of the same length starting at the specified 'first2', and
+        // 'false' otherwise.  Note that this operation compares each segment
+        // using 'RangeCompare::equal', and thus bit-wise if 'VALUE_TYPE' has
+        // the bit-wise equality-comparable trait.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static int lexicographical(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first1,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last1,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first2,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last2);
+        // Return a negative value if the specified range '[first1, last1)'
+        // compares lexicographically less than the specified range
+        // '[first2, last2)', 0 if they have the same length and compare
+        // lexicographically equal, and a positive value otherwise, using
+        // 'operator<' to compare elements.  Note that this operation compares
+        // each segment using 'RangeCompare::lexicographical'.
+};
+
+                        // ===========================
+                        // struct DequeSegmentUtil_Imp
+                        // ===========================
+
+struct DequeSegmentUtil_Imp {
+    // This 'struct' provides a namespace for the implementation of the
+    // methods of 'DequeSegmentUtil' on a single segment, with overloads
+    // selected by the traits of the value type.  Each method operates on the
+    // array of elements starting at 'begin' and ending immediately before
+    // 'end'.
+
+    // CLASS METHODS
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static void advance(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> *iterator,
+                        std::ptrdiff_t                           offset);
+        // Advance the specified 'iterator' by the specified 'offset', moving
+        // it to the first element of the next block if it reaches the end of
+        // its block, as 'operator+=' does.  The behavior is undefined unless
+        // '0 <= offset <= iterator->remainingInBlock()'.  Note that this
+        // method is cheaper than 'operator+=', which must handle any offset.
+
+    template <class VALUE_TYPE, int BLOCK_LENGTH>
+    static VALUE_TYPE *segmentEnd(
+                        const DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& first,
+                        const DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& last);
+        // Return the address one past the last element of the segment of the
+        // range '[first, last)' that starts at 'first', i.e., the address of
+        // 'last' if it is in the block of 'first', and the end of the block of
+        // 'first' otherwise.
+
+    template <class VALUE_TYPE>
+    static VALUE_TYPE *find(VALUE_TYPE        *begin,
+                            VALUE_TYPE        *end,
+                            const VALUE_TYPE&  value,
+                            bsl::true_type);
+    template <class VALUE_TYPE>
+    static VALUE_TYPE *find(VALUE_TYPE        *begin,
+                            VALUE_TYPE        *end,
+                            const VALUE_TYPE&  value,
+                            bsl::false_type);
+        // Return the address of the first element equal to the specified
+        // 'value', or 'end' if there is no such element, using 'std::memchr'
+        // if the last argument is 'bsl::true_type', and a loop otherwise.
+
+    template <class VALUE_TYPE>
+    static void fill(VALUE_TYPE        *begin,
+                     VALUE_TYPE        *end,
+                     const VALUE_TYPE&  value,
+                     bsl::true_type);
+    template <class VALUE_TYPE>
+    static void fill(VALUE_TYPE        *begin,
+                     VALUE_TYPE        *end,
+                     const VALUE_TYPE&  value,
+                     bsl::false_type);
+        // Assign the specified 'value' to each element, using 'std::memset'
+        // if the last argument is 'bsl::true_type', and a loop otherwise.
+
+    template <class VALUE_TYPE>
+    static void copy(VALUE_TYPE       *result,
+                     const VALUE_TYPE *begin,
+                     const VALUE_TYPE *end,
+                     bsl::true_type);
+    template <class VALUE_TYPE>
+    static void copy(VALUE_TYPE       *result,
+                     const VALUE_TYPE *begin,
+                     const VALUE_TYPE *end,
+                     bsl::false_type);
+        // Assign each element to the corresponding element of the array
+        // starting at the specified 'result', using 'std::memmove' if the last
+        // argument is 'bsl::true_type', and a loop otherwise.
+};
+
+// ===========================================================================
+//                 INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                        // ---------------------------
+                        // struct DequeSegmentUtil_Imp
+                        // ---------------------------
+
+// CLASS METHODS
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+inline
+void DequeSegmentUtil_Imp::advance(
+                            DequeIterator<VALUE_TYPE, BLOCK_LENGTH> *iterator,
+                            std::ptrdiff_t                           offset)
+{
+    BSLS_ASSERT_SAFE(0 <= offset);
+    BSLS_ASSERT_SAFE(offset <= iterator->blockEnd() - iterator->valuePtr());
+
+    VALUE_TYPE *valuePtr = iterator->valuePtr() + offset;
+    if (valuePtr == iterator->blockEnd()) {
+        iterator->nextBlock();
+    }
+    else {
+        *iterator = DequeIterator<VALUE_TYPE, BLOCK_LENGTH>(
+                                                        iterator->blockPtr(),
+                                                        valuePtr);
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+inline
+VALUE_TYPE *DequeSegmentUtil_Imp::segmentEnd(
+                         const DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& first,
+                         const DequeIterator<VALUE_TYPE, BLOCK_LENGTH>& last)
+{
+    BSLS_ASSERT_SAFE(first.blockPtr() <= last.blockPtr());
+
+    return first.blockPtr() == last.blockPtr() ? last.valuePtr()
+                                               : first.blockEnd();
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *DequeSegmentUtil_Imp::find(VALUE_TYPE        *begin,
+                                       VALUE_TYPE        *end,
+                                       const VALUE_TYPE&  value,
+                                       bsl::true_type)
+{
+    void *result = std::memchr(begin,
+                               static_cast<unsigned char>(value),
+                               end - begin);
+    return result ? static_cast<VALUE_TYPE *>(result) : end;
+}
+
+template <class VALUE_TYPE>
+inline
+VALUE_TYPE *DequeSegmentUtil_Imp::find(VALUE_TYPE        *begin,
+                                       VALUE_TYPE        *end,
+                                       const VALUE_TYPE&  value,
+                                       bsl::false_type)
+{
+    for (; begin != end; ++begin) {
+        if (*begin == value) {
+            break;
+        }
+    }
+    return begin;
+}
+
+template <class VALUE_TYPE>
+inline
+void DequeSegmentUtil_Imp::fill(VALUE_TYPE        *begin,
+                                VALUE_TYPE        *end,
+                                const VALUE_TYPE&  value,
+                                bsl::true_type)
+{
+    std::memset(begin, static_cast<unsigned char>(value), end - begin);
+}
+
+template <class VALUE_TYPE>
+inline
+void DequeSegmentUtil_Imp::fill(VALUE_TYPE        *begin,
+                                VALUE_TYPE        *end,
+                                const VALUE_TYPE&  value,
+                                bsl::false_type)
+{
+    for (; begin != end; ++begin) {
+        *begin = value;
+    }
+}
+
+template <class VALUE_TYPE>
+inline
+void DequeSegmentUtil_Imp::copy(VALUE_TYPE       *result,
+                                const VALUE_TYPE *begin,
+                                const VALUE_TYPE *end,
+                                bsl::true_type)
+{
+    std::memmove(static_cast<void *>(result),
+                 static_cast<const void *>(begin),
+                 (end - begin) * sizeof(VALUE_TYPE));
+}
+
+template <class VALUE_TYPE>
+inline
+void DequeSegmentUtil_Imp::copy(VALUE_TYPE       *result,
+                                const VALUE_TYPE *begin,
+                                const VALUE_TYPE *end,
+                                bsl::false_type)
+{
+    for (; begin != end; ++begin, ++result) {
+        *result = *begin;
+    }
+}
+
+                          // -----------------------
+                          // struct DequeSegmentUtil
+                          // -----------------------
+
+// CLASS METHODS
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+std::size_t DequeSegmentUtil::count(
+                                DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                                DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                                const VALUE_TYPE&                       value)
+{
+    std::size_t result = 0;
+    while (!(first == last)) {
+        const VALUE_TYPE *begin = first.valuePtr();
+        const VALUE_TYPE *end   = DequeSegmentUtil_Imp::segmentEnd(first,
+                                                                   last);
+        for (; begin != end; ++begin) {
+            if (*begin == value) {
+                ++result;
+            }
+        }
+        DequeSegmentUtil_Imp::advance(&first, end - first.valuePtr());
+    }
+    return result;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+DequeIterator<VALUE_TYPE, BLOCK_LENGTH> DequeSegmentUtil::find(
+                                DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                                DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                                const VALUE_TYPE&                       value)
+{
+    typedef bsl::integral_constant<bool,
+                                   bslmf::IsFundamental<VALUE_TYPE>::value
+                                   && 1 == sizeof(VALUE_TYPE)> IsByte;
+
+    while (!(first == last)) {
+        VALUE_TYPE *end = DequeSegmentUtil_Imp::segmentEnd(first, last);
+        VALUE_TYPE *hit = DequeSegmentUtil_Imp::find(first.valuePtr(),
+                                                     end,
+                                                     value,
+                                                     IsByte());
+        if (hit != end) {
+            first = DequeIterator<VALUE_TYPE, BLOCK_LENGTH>(first.blockPtr(),
+                                                            hit);
+            break;
+        }
+        DequeSegmentUtil_Imp::advance(&first, end - first.valuePtr());
+    }
+    return first;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void DequeSegmentUtil::fill(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                            DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                            const VALUE_TYPE&                       value)
+{
+    typedef bsl::integral_constant<bool,
+                                   bslmf::IsFundamental<VALUE_TYPE>::value
+                                   && 1 == sizeof(VALUE_TYPE)> IsByte;
+
+    while (!(first == last)) {
+        VALUE_TYPE *end = DequeSegmentUtil_Imp::segmentEnd(first, last);
+        DequeSegmentUtil_Imp::fill(first.valuePtr(), end, value, IsByte());
+        DequeSegmentUtil_Imp::advance(&first, end - first.valuePtr());
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH, class FUNCTOR>
+FUNCTOR DequeSegmentUtil::forEach(
+                              DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                              DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                              FUNCTOR                                 functor)
+{
+    while (!(first == last)) {
+        VALUE_TYPE *begin = first.valuePtr();
+        VALUE_TYPE *end   = DequeSegmentUtil_Imp::segmentEnd(first, last);
+        for (; begin != end; ++begin) {
+            functor(*begin);
+        }
+        DequeSegmentUtil_Imp::advance(&first, end - first.valuePtr());
+    }
+    return functor;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+DequeIterator<VALUE_TYPE, BLOCK_LENGTH> DequeSegmentUtil::copy(
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> result)
+{
+    typedef typename bsl::is_trivially_copyable<VALUE_TYPE>::type IsBitwise;
+
+    while (!(first == last)) {
+        std::ptrdiff_t length =
+                  DequeSegmentUtil_Imp::segmentEnd(first, last) -
+                                                             first.valuePtr();
+        if (length > result.blockEnd() - result.valuePtr()) {
+            length = result.blockEnd() - result.valuePtr();
+        }
+        DequeSegmentUtil_Imp::copy(result.valuePtr(),
+                                   first.valuePtr(),
+                                   first.valuePtr() + length,
+                                   IsBitwise());
+        DequeSegmentUtil_Imp::advance(&first, length);
+        DequeSegmentUtil_Imp::advance(&result, length);
+    }
+    return result;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+bool DequeSegmentUtil::equal(DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first1,
+                             DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last1,
+                             DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first2)
+{
+    while (!(first1 == last1)) {
+        std::ptrdiff_t length =
+                  DequeSegmentUtil_Imp::segmentEnd(first1, last1) -
+                                                            first1.valuePtr();
+        if (length > first2.blockEnd() - first2.valuePtr()) {
+            length = first2.blockEnd() - first2.valuePtr();
+        }
+
+        const VALUE_TYPE *begin1 = first1.valuePtr();
+        const VALUE_TYPE *begin2 = first2.valuePtr();
+        if (!RangeCompare::equal(begin1, begin1 + length, begin2)) {
+            return false;                                             // RETURN
+        }
+        DequeSegmentUtil_Imp::advance(&first1, length);
+        DequeSegmentUtil_Imp::advance(&first2, length);
+    }
+    return true;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+int DequeSegmentUtil::lexicographical(
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first1,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last1,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> first2,
+                               DequeIterator<VALUE_TYPE, BLOCK_LENGTH> last2)
+{
+    const std::ptrdiff_t length1 = last1 - first1;
+    const std::ptrdiff_t length2 = last2 - first2;
+
+    DequeIterator<VALUE_TYPE, BLOCK_LENGTH> end1 =
+                                     length1 <= length2
+                                     ? last1
+                                     : first1 + length2;
+
+    while (!(first1 == end1)) {
+        std::ptrdiff_t length =
+                   DequeSegmentUtil_Imp::segmentEnd(first1, end1) -
+                                                            first1.valuePtr();
+        if (length > first2.blockEnd() - first2.valuePtr()) {
+            length = first2.blockEnd() - first2.valuePtr();
+        }
+
+        const VALUE_TYPE *begin1 = first1.valuePtr();
+        const VALUE_TYPE *begin2 = first2.valuePtr();
+        const int result = RangeCompare::lexicographical(begin1,
+                                                         begin1 + length,
+                                                         begin2,
+                                                         begin2 + length);
+        if (result) {
+            return result;                                            // RETURN
+        }
+        DequeSegmentUtil_Imp::advance(&first1, length);
+        DequeSegmentUtil_Imp::advance(&first2, length);
+    }
+    return length1 < length2 ? -1 : length1 > length2 ? 1 : 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
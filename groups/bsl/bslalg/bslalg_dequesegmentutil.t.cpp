@@ -0,0 +1,1007 @@
+// bslalg_dequesegmentutil.t.cpp                                      -*-C++-*-
+
+#include <bslalg_dequesegmentutil.h>
+
+#include <bslalg_dequeimputil.h>
+#include <bslalg_dequeiterator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides algorithms on ranges of a deque that
+// process each contiguous segment of the range separately.  We verify each
+// algorithm against the equivalent loop incrementing a 'DequeIterator' one
+// element at a time, over every sub-range (or pair of sub-ranges) of a small
+// array of blocks, for a block length of one and for a longer block length,
+// so that ranges start and end at every offset in a block and span from zero
+// to several blocks.  Each algorithm is exercised with a value type for which
+// a bulk primitive is used ('char', 'bool', or 'int'), and with a class type
+// that counts its assignments and comparisons and must be processed one
+// element at a time.  A performance test (negative case) compares each
+// algorithm to the element-by-element loop on a large range.
+//-----------------------------------------------------------------------------
+// [ 2] size_t count(DequeIterator first, DequeIterator last, const V&);
+// [ 2] DequeIterator find(DequeIterator first, last, const V& value);
+// [ 3] void fill(DequeIterator first, DequeIterator last, const V&);
+// [ 3] FUNCTOR forEach(DequeIterator first, last, FUNCTOR functor);
+// [ 4] DequeIterator copy(DequeIterator first, last, result);
+// [ 5] bool equal(DequeIterator first1, last1, first2);
+// [ 5] int lexicographical(DequeIterator first1, last1, first2, last2);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: SEGMENTED VS. ELEMENT-WISE ALGORITHMS
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::DequeSegmentUtil Obj;
+
+static bool verbose;
+static bool veryVerbose;
+
+//=============================================================================
+//                       GLOBAL CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+class Counted {
+    // This class holds an 'int' value, and counts its assignments and
+    // equality comparisons.  It is not bit-wise copyable.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CLASS DATA
+    static int s_numAssignments;
+    static int s_numComparisons;
+
+    // CREATORS
+    Counted() : d_value(0) {}
+    Counted(int value) : d_value(value) {}                          // IMPLICIT
+    Counted(const Counted& original) : d_value(original.d_value) {}
+
+    // MANIPULATORS
+    Counted& operator=(const Counted& rhs)
+    {
+        ++s_numAssignments;
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+int Counted::s_numAssignments = 0;
+int Counted::s_numComparisons = 0;
+
+bool operator==(const Counted& lhs, const Counted& rhs)
+{
+    ++Counted::s_numComparisons;
+    return lhs.value() == rhs.value();
+}
+
+bool operator<(const Counted& lhs, const Counted& rhs)
+{
+    ++Counted::s_numComparisons;
+    return lhs.value() < rhs.value();
+}
+
+template <class VALUE_TYPE>
+VALUE_TYPE makeValue(int i)
+    // Return a value of the parameterized 'VALUE_TYPE' computed from the
+    // specified 'i', such that consecutive values of 'i' yield few distinct
+    // values.
+{
+    return VALUE_TYPE(i % 3 + 'a');
+}
+
+template <>
+bool makeValue<bool>(int i)
+{
+    return 0 == i % 3;
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+class TestBlocks {
+    // This class provides an array of 'NUM_BLOCKS' blocks of the
+    // parameterized 'VALUE_TYPE', and iterators to its elements, which are
+    // numbered consecutively across blocks.  Like in a deque, an additional
+    // block holds the position one past the last element.
+
+  public:
+    // TYPES
+    enum { NUM_BLOCKS = 5, SIZE = NUM_BLOCKS * BLOCK_LENGTH };
+
+    typedef bslalg::DequeImpUtil<VALUE_TYPE, BLOCK_LENGTH>  ImpUtil;
+    typedef bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> Iterator;
+
+  private:
+    // DATA
+    typename ImpUtil::Block    d_blocks[NUM_BLOCKS + 1];
+    typename ImpUtil::BlockPtr d_blockPtrs[NUM_BLOCKS + 1];
+
+  public:
+    // CREATORS
+    TestBlocks()
+    {
+        for (int i = 0; i <= NUM_BLOCKS; ++i) {
+            d_blockPtrs[i] = &d_blocks[i];
+        }
+    }
+
+    // MANIPULATORS
+    void setValues(int seed)
+        // Set the element at each index 'i' to 'makeValue(i + seed)'.
+    {
+        for (int i = 0; i < SIZE; ++i) {
+            *at(i) = makeValue<VALUE_TYPE>(i + seed);
+        }
+    }
+
+    // ACCESSORS
+    Iterator at(int index) const
+        // Return an iterator to the element at the specified 'index', which
+        // may be 'SIZE'.
+    {
+        typename ImpUtil::BlockPtr *blockPtr =
+                  const_cast<typename ImpUtil::BlockPtr *>(d_blockPtrs) +
+                                                         index / BLOCK_LENGTH;
+        return Iterator(blockPtr, (*blockPtr)->d_data + index % BLOCK_LENGTH);
+    }
+};
+
+struct Accumulator {
+    // This functor adds each value it is invoked with, weighted by its
+    // position, and increments it.
+
+    // DATA
+    int d_sum;
+    int d_count;
+
+    // CREATORS
+    Accumulator() : d_sum(0), d_count(0) {}
+
+    // MANIPULATORS
+    template <class VALUE_TYPE>
+    void operator()(VALUE_TYPE& value)
+    {
+        ++d_count;
+        d_sum += d_count * (int)value;
+        value = VALUE_TYPE((int)value + 1);
+    }
+
+    void operator()(Counted& value)
+    {
+        ++d_count;
+        d_sum += d_count * value.value();
+        value = Counted(value.value() + 1);
+    }
+};
+
+//=============================================================================
+//                           TEST FUNCTIONS
+//-----------------------------------------------------------------------------
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void testCountAndFind()
+    // Verify 'count' and 'find' over every sub-range of a 'TestBlocks'.
+{
+    typedef TestBlocks<VALUE_TYPE, BLOCK_LENGTH> Blocks;
+    typedef typename Blocks::Iterator            Iterator;
+
+    Blocks blocks;
+    blocks.setValues(0);
+
+    const VALUE_TYPE VALUES[] = {
+        makeValue<VALUE_TYPE>(0),
+        makeValue<VALUE_TYPE>(1),
+        VALUE_TYPE('z')
+    };
+
+    for (int b = 0; b <= Blocks::SIZE; ++b) {
+        for (int e = b; e <= Blocks::SIZE; ++e) {
+            for (int v = 0; v < 3; ++v) {
+                const Iterator   FIRST = blocks.at(b);
+                const Iterator   LAST  = blocks.at(e);
+                const VALUE_TYPE VALUE = VALUES[v];
+
+                std::size_t expCount = 0;
+                Iterator    expFind  = LAST;
+                for (Iterator it = FIRST; !(it == LAST); ++it) {
+                    if (*it == VALUE) {
+                        if (0 == expCount) {
+                            expFind = it;
+                        }
+                        ++expCount;
+                    }
+                }
+
+                LOOP3_ASSERT(b, e, v,
+                             expCount == Obj::count(FIRST, LAST, VALUE));
+
+                const Iterator result = Obj::find(FIRST, LAST, VALUE);
+                LOOP3_ASSERT(b, e, v, expFind == result);
+                LOOP3_ASSERT(b, e, v,
+                            expFind.valuePtr() == result.valuePtr());
+            }
+        }
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void testFillAndForEach()
+    // Verify 'fill' and 'forEach' over every sub-range of a 'TestBlocks'.
+{
+    typedef TestBlocks<VALUE_TYPE, BLOCK_LENGTH> Blocks;
+
+    Blocks blocks;
+    Blocks expected;
+
+    for (int b = 0; b <= Blocks::SIZE; ++b) {
+        for (int e = b; e <= Blocks::SIZE; ++e) {
+            const VALUE_TYPE VALUE = makeValue<VALUE_TYPE>(1);
+
+            blocks.setValues(0);
+            expected.setValues(0);
+            for (int i = b; i < e; ++i) {
+                *expected.at(i) = VALUE;
+            }
+
+            Obj::fill(blocks.at(b), blocks.at(e), VALUE);
+            for (int i = 0; i < Blocks::SIZE; ++i) {
+                LOOP3_ASSERT(b, e, i, *expected.at(i) == *blocks.at(i));
+            }
+
+            // Fill from a value in the range.
+
+            if (b < e) {
+                blocks.setValues(0);
+                expected.setValues(0);
+                const VALUE_TYPE EXP = *expected.at(b);
+                for (int i = b; i < e; ++i) {
+                    *expected.at(i) = EXP;
+                }
+
+                Obj::fill(blocks.at(b), blocks.at(e), *blocks.at(b));
+                for (int i = 0; i < Blocks::SIZE; ++i) {
+                    LOOP3_ASSERT(b, e, i, *expected.at(i) == *blocks.at(i));
+                }
+            }
+
+            blocks.setValues(0);
+            expected.setValues(0);
+            Accumulator expAcc;
+            for (int i = b; i < e; ++i) {
+                expAcc(*expected.at(i));
+            }
+
+            Accumulator acc = Obj::forEach(blocks.at(b),
+                                           blocks.at(e),
+                                           Accumulator());
+            LOOP2_ASSERT(b, e, expAcc.d_count == acc.d_count);
+            LOOP2_ASSERT(b, e, expAcc.d_sum   == acc.d_sum);
+            for (int i = 0; i < Blocks::SIZE; ++i) {
+                LOOP3_ASSERT(b, e, i, *expected.at(i) == *blocks.at(i));
+            }
+        }
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void testCopy()
+    // Verify 'copy' from every sub-range of a 'TestBlocks' to every position
+    // of another 'TestBlocks' at which the destination range fits.
+{
+    typedef TestBlocks<VALUE_TYPE, BLOCK_LENGTH> Blocks;
+    typedef typename Blocks::Iterator            Iterator;
+
+    Blocks source;
+    Blocks blocks;
+    Blocks expected;
+    source.setValues(1);
+
+    for (int b = 0; b <= Blocks::SIZE; ++b) {
+        for (int e = b; e <= Blocks::SIZE; ++e) {
+            for (int d = 0; d + (e - b) <= Blocks::SIZE; ++d) {
+                blocks.setValues(0);
+                expected.setValues(0);
+                for (int i = b; i < e; ++i) {
+                    *expected.at(d + i - b) = *source.at(i);
+                }
+
+                Iterator result = Obj::copy(source.at(b),
+                                            source.at(e),
+                                            blocks.at(d));
+                LOOP3_ASSERT(b, e, d, blocks.at(d + e - b) == result);
+                for (int i = 0; i < Blocks::SIZE; ++i) {
+                    LOOP4_ASSERT(b, e, d, i,
+                                 *expected.at(i) == *blocks.at(i));
+                }
+            }
+        }
+    }
+
+    // Overlapping ranges, copying towards the front.
+
+    for (int b = 0; b <= Blocks::SIZE; ++b) {
+        for (int e = b; e <= Blocks::SIZE; ++e) {
+            for (int d = 0; d <= b; ++d) {
+                blocks.setValues(0);
+                expected.setValues(0);
+                for (int i = b; i < e; ++i) {
+                    *expected.at(d + i - b) = *expected.at(i);
+                }
+
+                Obj::copy(blocks.at(b), blocks.at(e), blocks.at(d));
+                for (int i = 0; i < Blocks::SIZE; ++i) {
+                    LOOP4_ASSERT(b, e, d, i,
+                                 *expected.at(i) == *blocks.at(i));
+                }
+            }
+        }
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void testCompare()
+    // Verify 'equal' and 'lexicographical' for every pair of sub-ranges of
+    // two 'TestBlocks' having mostly equal elements.
+{
+    typedef TestBlocks<VALUE_TYPE, BLOCK_LENGTH> Blocks;
+    typedef typename Blocks::Iterator            Iterator;
+
+    Blocks blocks1;
+    Blocks blocks2;
+    blocks1.setValues(0);
+
+    const int SIZE = Blocks::SIZE;
+
+    for (int diff = -1; diff < SIZE; ++diff) {
+        // Make 'blocks2' a copy of 'blocks1', with a single element greater
+        // than its counterpart at index 'diff' (if not negative).
+
+        blocks2.setValues(0);
+        if (0 <= diff) {
+            *blocks2.at(diff) = VALUE_TYPE('z');
+        }
+
+        for (int b1 = 0; b1 <= SIZE; ++b1) {
+        for (int e1 = b1; e1 <= SIZE; ++e1) {
+        for (int b2 = b1 % 3; b2 <= SIZE; b2 += 3) {
+            const int maxE2 = b2 + (e1 - b1) + 2 < SIZE
+                            ? b2 + (e1 - b1) + 2
+                            : SIZE;
+            for (int e2 = b2; e2 <= maxE2; ++e2) {
+                const Iterator FIRST1 = blocks1.at(b1);
+                const Iterator LAST1  = blocks1.at(e1);
+                const Iterator FIRST2 = blocks2.at(b2);
+                const Iterator LAST2  = blocks2.at(e2);
+
+                int expected = 0;
+                Iterator it1 = FIRST1;
+                Iterator it2 = FIRST2;
+                for (; !(it1 == LAST1) && !(it2 == LAST2); ++it1, ++it2) {
+                    if (*it1 < *it2) {
+                        expected = -1;
+                        break;
+                    }
+                    if (*it2 < *it1) {
+                        expected = 1;
+                        break;
+                    }
+                }
+                if (0 == expected) {
+                    expected = (e1 - b1) < (e2 - b2) ? -1
+                             : (e1 - b1) > (e2 - b2) ?  1
+                             : 0;
+                }
+
+                const int result = Obj::lexicographical(FIRST1,
+                                                        LAST1,
+                                                        FIRST2,
+                                                        LAST2);
+                LOOP4_ASSERT(b1, e1, b2, e2,
+                             (expected < 0) == (result < 0));
+                LOOP4_ASSERT(b1, e1, b2, e2,
+                             (expected > 0) == (result > 0));
+
+                if (e2 - b2 == e1 - b1) {
+                    LOOP4_ASSERT(b1, e1, b2, e2,
+                                 (0 == expected) ==
+                                          Obj::equal(FIRST1, LAST1, FIRST2));
+                }
+            }
+        }
+        }
+        }
+    }
+}
+
+template <class VALUE_TYPE, int BLOCK_LENGTH>
+void benchmark(int numElements, int numIter, const char *label)
+    // Print the time taken by 'numIter' runs of each algorithm, and of the
+    // equivalent element-by-element loop, on two ranges of the specified
+    // 'numElements' of the parameterized 'VALUE_TYPE' in blocks of the
+    // parameterized 'BLOCK_LENGTH', using the specified 'label' to identify
+    // the results.
+{
+    typedef bslalg::DequeImpUtil<VALUE_TYPE, BLOCK_LENGTH>  ImpUtil;
+    typedef bslalg::DequeIterator<VALUE_TYPE, BLOCK_LENGTH> Iterator;
+    typedef typename ImpUtil::Block                         Block;
+    typedef typename ImpUtil::BlockPtr                      BlockPtr;
+
+    const int numBlocks = numElements / BLOCK_LENGTH + 1;
+
+    Block    *blocks1    = new Block[numBlocks];
+    Block    *blocks2    = new Block[numBlocks];
+    BlockPtr *blockPtrs1 = new BlockPtr[numBlocks];
+    BlockPtr *blockPtrs2 = new BlockPtr[numBlocks];
+    for (int i = 0; i < numBlocks; ++i) {
+        blockPtrs1[i] = &blocks1[i];
+        blockPtrs2[i] = &blocks2[i];
+    }
+
+    const Iterator first1(blockPtrs1, blocks1[0].d_data);
+    const Iterator last1 = first1 + numElements;
+    const Iterator first2(blockPtrs2, blocks2[0].d_data);
+    const Iterator last2 = first2 + numElements;
+
+    const VALUE_TYPE VALUE   = VALUE_TYPE(1);
+    const VALUE_TYPE MISSING = VALUE_TYPE(2);
+
+    Obj::fill(first1, last1, VALUE);
+    Obj::fill(first2, last2, VALUE);
+
+    printf("\n\t%s\t\telement-wise\tsegmented\n", label);
+
+    bsls::Stopwatch timer;
+    double          elementWise;
+    bsls::Types::Int64 sink = 0;
+
+    // 'count'
+
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        for (Iterator it = first1; !(it == last1); ++it) {
+            sink += *it == VALUE;
+        }
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        sink += Obj::count(first1, last1, VALUE);
+    }
+    printf("\tcount\t\t\t%f\t%f\n", elementWise, timer.elapsedTime());
+    timer.reset();
+
+    // 'find'
+
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Iterator it = first1;
+        while (!(it == last1) && !(*it == MISSING)) {
+            ++it;
+        }
+        sink += it - first1;
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        sink += Obj::find(first1, last1, MISSING) - first1;
+    }
+    printf("\tfind\t\t\t%f\t%f\n", elementWise, timer.elapsedTime());
+    timer.reset();
+
+    // 'fill'
+
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        for (Iterator it = first2; !(it == last2); ++it) {
+            *it = VALUE;
+        }
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Obj::fill(first2, last2, VALUE);
+    }
+    printf("\tfill\t\t\t%f\t%f\n", elementWise, timer.elapsedTime());
+    timer.reset();
+
+    // 'copy', with the destination offset from the source within a block
+
+    const Iterator dest = first2 + BLOCK_LENGTH / 2;
+    const Iterator end1 = last1 - BLOCK_LENGTH / 2;
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Iterator to = dest;
+        for (Iterator it = first1; !(it == end1); ++it, ++to) {
+            *to = *it;
+        }
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Obj::copy(first1, end1, dest);
+    }
+    printf("\tcopy\t\t\t%f\t%f\n", elementWise, timer.elapsedTime());
+    timer.reset();
+
+    // 'equal'
+
+    Obj::fill(first2, last2, VALUE);
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Iterator it2 = first2;
+        bool     result = true;
+        for (Iterator it = first1; !(it == last1); ++it, ++it2) {
+            if (!(*it == *it2)) {
+                result = false;
+                break;
+            }
+        }
+        sink += result;
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        sink += Obj::equal(first1, last1, first2);
+    }
+    printf("\tequal\t\t\t%f\t%f\n", elementWise, timer.elapsedTime());
+    timer.reset();
+
+    // 'lexicographical'
+
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        Iterator it2 = first2;
+        int      result = 0;
+        for (Iterator it = first1; !(it == last1); ++it, ++it2) {
+            if (*it < *it2) {
+                result = -1;
+                break;
+            }
+            if (*it2 < *it) {
+                result = 1;
+                break;
+            }
+        }
+        sink += result;
+    }
+    elementWise = timer.elapsedTime();
+    timer.reset();
+    timer.start();
+    for (int n = 0; n < numIter; ++n) {
+        sink += Obj::lexicographical(first1, last1, first2, last2);
+    }
+    printf("\tlexicographical\t\t%f\t%f\n",
+           elementWise,
+           timer.elapsedTime());
+
+    if (veryVerbose) {
+        P(sink);
+    }
+
+    delete[] blockPtrs2;
+    delete[] blockPtrs1;
+    delete[] blocks2;
+    delete[] blocks1;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Searching a Range of a Deque
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we are handed a deque of characters as an array of blocks, and
+// want to count and locate the occurrences of a character in it.
+//
+// First, we create three blocks of four characters each and an array of
+// pointers to these blocks, which is the structure that 'bsl::deque' uses:
+//..
+    typedef bslalg::DequeImpUtil<char, 4>  ImpUtil;
+    typedef bslalg::DequeIterator<char, 4> Iterator;
+
+    ImpUtil::Block     blocks[3];
+    ImpUtil::BlockPtr  blockPtrs[3] = { &blocks[0], &blocks[1], &blocks[2] };
+//..
+// Then, we create iterators to the range of ten characters starting at the
+// second element of the first block, and fill it with a text:
+//..
+    Iterator first(blockPtrs, blocks[0].d_data + 1);
+    Iterator last(blockPtrs + 2, blocks[2].d_data + 3);
+    ASSERT(10 == last - first);
+
+    const char *TEXT = "abracadabr";
+    Iterator it = first;
+    for (int i = 0; i < 10; ++i, ++it) {
+        *it = TEXT[i];
+    }
+//..
+// Now, we count and locate the occurrences of 'r' in the range, which spans
+// the three blocks; each block is searched using 'std::memchr':
+//..
+    ASSERT(2 == bslalg::DequeSegmentUtil::count(first, last, 'r'));
+
+    Iterator r1 = bslalg::DequeSegmentUtil::find(first, last, 'r');
+    ASSERT(2 == r1 - first);
+
+    Iterator r2 = bslalg::DequeSegmentUtil::find(r1 + 1, last, 'r');
+    ASSERT(9 == r2 - first);
+
+    ASSERT(last == bslalg::DequeSegmentUtil::find(first, last, 'z'));
+//..
+// Finally, we replace the last four characters, and compare the range to
+// itself shifted by one block:
+//..
+    bslalg::DequeSegmentUtil::fill(first + 6, last, 'x');
+    ASSERT('a' == *(first + 5));
+    ASSERT('x' == *(first + 6));
+
+    ASSERT(bslalg::DequeSegmentUtil::equal(first, first + 3, first + 7)
+                                                                   == false);
+    ASSERT(bslalg::DequeSegmentUtil::lexicographical(first, first + 3,
+                                                     first + 6, last) < 0);
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'equal' AND 'lexicographical'
+        //
+        // Concerns:
+        //: 1 'equal' returns 'true' if and only if the ranges have equal
+        //:   elements, for ranges starting at any offset in a block.
+        //:
+        //: 2 'lexicographical' returns a negative, zero, or positive value
+        //:   consistently with an element-by-element comparison, including
+        //:   for ranges of different lengths where one is a prefix of the
+        //:   other.
+        //
+        // Plan:
+        //: 1 For two arrays of blocks differing in at most one element, and
+        //:   every pair of sub-ranges of similar lengths, compare the results
+        //:   to an element-by-element comparison, for block lengths 1 and 8,
+        //:   and for 'char', 'int', and 'Counted'.  (C-1..2)
+        //
+        // Testing:
+        //   bool equal(DequeIterator first1, last1, first2);
+        //   int lexicographical(DequeIterator first1, last1, first2, last2);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'equal' AND 'lexicographical'"
+                            "\n=====================================\n");
+
+        testCompare<char,    1>();
+        testCompare<char,    8>();
+        testCompare<int,     1>();
+        testCompare<int,     8>();
+        testCompare<Counted, 8>();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'copy'
+        //
+        // Concerns:
+        //: 1 'copy' assigns each element of the source range to the
+        //:   corresponding element of the destination range, and no other,
+        //:   whatever the offsets of the two ranges in their blocks.
+        //:
+        //: 2 'copy' returns the end of the destination range.
+        //:
+        //: 3 'copy' supports a destination range overlapping the source range
+        //:   and starting before it.
+        //:
+        //: 4 Elements that are not bit-wise copyable are assigned once.
+        //
+        // Plan:
+        //: 1 Copy every sub-range of an array of blocks to every position of
+        //:   another array of blocks, and to every position before it in the
+        //:   same array, and compare to the expected values, for block lengths
+        //:   1 and 8, and for 'char', 'int', and 'Counted'.  (C-1..3)
+        //:
+        //: 2 Count the assignments of 'Counted' made by copying a range.
+        //:   (C-4)
+        //
+        // Testing:
+        //   DequeIterator copy(DequeIterator first, last, result);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'copy'"
+                            "\n==============\n");
+
+        testCopy<char,    1>();
+        testCopy<char,    8>();
+        testCopy<int,     1>();
+        testCopy<int,     8>();
+        testCopy<Counted, 8>();
+
+        {
+            TestBlocks<Counted, 8> source;
+            TestBlocks<Counted, 8> blocks;
+            source.setValues(0);
+
+            Counted::s_numAssignments = 0;
+            Obj::copy(source.at(3), source.at(30), blocks.at(5));
+            ASSERT(27 == Counted::s_numAssignments);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'fill' AND 'forEach'
+        //
+        // Concerns:
+        //: 1 'fill' assigns the value to each element of the range, and to no
+        //:   other element, whatever the offsets of the range in its blocks.
+        //:
+        //: 2 'fill' supports a value referring to an element of the range.
+        //:
+        //: 3 'forEach' invokes the functor on each element of the range, in
+        //:   order, passing a modifiable reference, and returns the functor.
+        //
+        // Plan:
+        //: 1 For every sub-range of an array of blocks, fill the range with a
+        //:   value, and with its first element, and compare to the expected
+        //:   values, for block lengths 1 and 8, and for 'char', 'bool',
+        //:   'int', and 'Counted'.  (C-1..2)
+        //:
+        //: 2 For every sub-range of an array of blocks, invoke a functor that
+        //:   accumulates an order-dependent checksum and increments each
+        //:   element, and compare to an element-by-element loop.  (C-3)
+        //
+        // Testing:
+        //   void fill(DequeIterator first, DequeIterator last, const V&);
+        //   FUNCTOR forEach(DequeIterator first, last, FUNCTOR functor);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'fill' AND 'forEach'"
+                            "\n============================\n");
+
+        testFillAndForEach<char,    1>();
+        testFillAndForEach<char,    8>();
+        testFillAndForEach<bool,    8>();
+        testFillAndForEach<int,     1>();
+        testFillAndForEach<int,     8>();
+        testFillAndForEach<Counted, 8>();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'count' AND 'find'
+        //
+        // Concerns:
+        //: 1 'count' returns the number of elements equal to the value.
+        //:
+        //: 2 'find' returns the first element equal to the value, or the end
+        //:   of the range if there is none, and the returned iterator is
+        //:   normalized like one obtained by incrementing.
+        //:
+        //: 3 Ranges may start and end at any offset in a block, and be empty.
+        //
+        // Plan:
+        //: 1 For every sub-range of an array of blocks and three values, one
+        //:   absent from the range, compare the results to an
+        //:   element-by-element loop, for block lengths 1 and 8, and for
+        //:   'char', 'unsigned char', 'bool', 'int', and 'Counted'.  (C-1..3)
+        //
+        // Testing:
+        //   size_t count(DequeIterator first, DequeIterator last, const V&);
+        //   DequeIterator find(DequeIterator first, last, const V& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'count' AND 'find'"
+                            "\n==========================\n");
+
+        testCountAndFind<char,          1>();
+        testCountAndFind<char,          8>();
+        testCountAndFind<unsigned char, 8>();
+        testCountAndFind<bool,          8>();
+        testCountAndFind<int,           1>();
+        testCountAndFind<int,           8>();
+        testCountAndFind<Counted,       8>();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Apply each algorithm to a range spanning three blocks.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef TestBlocks<int, 4> Blocks;
+        typedef Blocks::Iterator   Iterator;
+
+        Blocks blocks;
+        for (int i = 0; i < Blocks::SIZE; ++i) {
+            *blocks.at(i) = i;
+        }
+
+        const Iterator FIRST = blocks.at(2);
+        const Iterator LAST  = blocks.at(11);
+
+        ASSERT(1 == Obj::count(FIRST, LAST, 7));
+        ASSERT(0 == Obj::count(FIRST, LAST, 11));
+        ASSERT(blocks.at(7) == Obj::find(FIRST, LAST, 7));
+        ASSERT(LAST         == Obj::find(FIRST, LAST, 1));
+
+        Obj::fill(FIRST, blocks.at(6), 42);
+        ASSERT(1  == *blocks.at(1));
+        ASSERT(42 == *blocks.at(2));
+        ASSERT(42 == *blocks.at(5));
+        ASSERT(6  == *blocks.at(6));
+
+        ASSERT(blocks.at(20) == Obj::copy(FIRST, LAST, blocks.at(11)));
+        ASSERT(42 == *blocks.at(11));
+        ASSERT(10 == *blocks.at(19));
+
+        ASSERT( Obj::equal(blocks.at(2), blocks.at(7), blocks.at(11)));
+        ASSERT(!Obj::equal(blocks.at(2), blocks.at(7), blocks.at(12)));
+        ASSERT(0 == Obj::lexicographical(blocks.at(2),  blocks.at(6),
+                                         blocks.at(11), blocks.at(15)));
+        ASSERT(0 >  Obj::lexicographical(blocks.at(2),  blocks.at(6),
+                                         blocks.at(11), blocks.at(16)));
+        ASSERT(0 >  Obj::lexicographical(blocks.at(0),  blocks.at(6),
+                                         blocks.at(11), blocks.at(16)));
+
+        Accumulator acc = Obj::forEach(FIRST, LAST, Accumulator());
+        ASSERT(9 == acc.d_count);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SEGMENTED VS. ELEMENT-WISE ALGORITHMS
+        //
+        // Concerns:
+        //: 1 Processing a deque range one segment at a time is faster than
+        //:   incrementing a 'DequeIterator' one element at a time.
+        //
+        // Plan:
+        //: 1 For a range of 'char' and of 'int' spanning many blocks of the
+        //:   length used by 'bsl::deque' (200 bytes), time each algorithm and
+        //:   the equivalent element-by-element loop, and report both times.
+        //:   Optionally specify the number of elements and repetitions on the
+        //:   command line.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SEGMENTED VS. ELEMENT-WISE ALGORITHMS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: SEGMENTED VS. ELEMENT-WISE"
+                            "\n=======================================\n");
+
+        const int numElements = argc > 2 ? atoi(argv[2]) : 1 << 20;
+        const int numIter     = argc > 3 ? atoi(argv[3]) : 100;
+
+        printf("\nUsage: %s -1 [numElements] [numIter]\n", __FILE__);
+        printf("\tnumElements = %d, numIter = %d\n", numElements, numIter);
+
+        benchmark<char, 200>(numElements, numIter, "char, 200");
+        benchmark<int,   50>(numElements, numIter, "int,   50");
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
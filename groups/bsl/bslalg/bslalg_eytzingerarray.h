@@ -0,0 +1,627 @@
+// bslalg_eytzingerarray.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLALG_EYTZINGERARRAY
+#define INCLUDED_BSLALG_EYTZINGERARRAY
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a static sorted array stored in Eytzinger layout.
+//
+//@CLASSES:
+//  bslalg::EytzingerArray: immutable sorted array searched in Eytzinger layout
+//
+//@SEE_ALSO: bslalg_searchutil
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bslalg::EytzingerArray', holding a copy of a sorted range of elements,
+// which it stores in the *Eytzinger* (BFS) layout described in
+// 'bslalg_searchutil', and which it searches using the branchless,
+// prefetching searches of 'bslalg::SearchUtil'.  For arrays that do not fit
+// in the last-level cache, these searches are typically 2 to 3 times faster
+// than a binary search of the same elements in sorted order (see
+// 'bslalg_searchutil' for measurements).
+//
+// An 'EytzingerArray' is built from a sorted range of contiguous elements
+// (e.g., the elements of a sorted 'bsl::vector', obtained from 'data()'),
+// and is not modified afterwards except by assignment of a new range.  It
+// identifies its elements by their *index* in the layout: 'lowerBound' and
+// 'upperBound' return the index of the element found, or 'size()' if there
+// is none, 'operator[]' returns the element at an index, and 'beginIndex' and
+// 'nextIndex' visit the indices of the elements in sorted order.
+//
+// The elements are stored in memory obtained from the allocator supplied at
+// construction, which is aligned such that the descendants of each element
+// that a search prefetches share a single cache line (for elements whose
+// size divides 64 bytes).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Interval Containing a Value
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we classify trade sizes into tiers, each tier starting at a
+// given size, and that we look up the tier of each of a high volume of
+// trades.
+//
+// First, we define a comparator that orders sizes in decreasing order:
+//..
+//  struct Greater {
+//      bool operator()(int lhs, int rhs) const
+//      {
+//          return lhs > rhs;
+//      }
+//  };
+//..
+// Then, we define the sizes at which each tier starts, in decreasing order,
+// and build an 'EytzingerArray' holding them:
+//..
+//  const int tierStarts[] = { 50000, 10000, 5000, 1000, 500, 100, 0 };
+//  const int NUM_TIERS    = sizeof tierStarts / sizeof *tierStarts;
+//
+//  bslma::TestAllocator allocator;
+//
+//  bslalg::EytzingerArray<int> tiers(tierStarts,
+//                                    tierStarts + NUM_TIERS,
+//                                    &allocator);
+//  assert(NUM_TIERS == tiers.size());
+//..
+// Next, we find the tier of a trade, which starts at the first size, in
+// decreasing order, that is not greater than the size of the trade:
+//..
+//  assert(  500 == tiers[tiers.lowerBound(  750, Greater())]);
+//  assert( 1000 == tiers[tiers.lowerBound( 1000, Greater())]);
+//  assert(50000 == tiers[tiers.lowerBound(60000, Greater())]);
+//..
+// Finally, we visit the starts of the tiers below 5000, in sorted (that is,
+// decreasing) order:
+//..
+//  std::size_t index = tiers.lowerBound(4999, Greater());
+//  int         count = 0;
+//  while (index != tiers.size()) {
+//      assert(tierStarts[3 + count] == tiers[index]);
+//      index = tiers.nextIndex(index);
+//      ++count;
+//  }
+//  assert(4 == count);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SEARCHUTIL
+#include <bslalg_searchutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITS
+#include <bslalg_typetraits.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                         // ==========================
+                         // class EytzingerArray_Guard
+                         // ==========================
+
+template <class TYPE>
+class EytzingerArray_Guard {
+    // This class provides a proctor that, unless its 'release' method is
+    // invoked, destroys on its own destruction the elements of an Eytzinger
+    // layout that precede, in sorted order, the first element not yet
+    // constructed.
+
+    // DATA
+    TYPE        *d_array_p;      // layout (held, not owned)
+    std::size_t  d_numElements;  // number of elements of the layout
+    std::size_t  d_count;        // number of elements constructed
+
+  private:
+    // NOT IMPLEMENTED
+    EytzingerArray_Guard(const EytzingerArray_Guard&);
+    EytzingerArray_Guard& operator=(const EytzingerArray_Guard&);
+
+  public:
+    // CREATORS
+    EytzingerArray_Guard(TYPE *array, std::size_t numElements);
+        // Create a guard for the specified 'array' in Eytzinger layout of the
+        // specified 'numElements', none of which is yet constructed.
+
+    ~EytzingerArray_Guard();
+        // Destroy this guard and, unless 'release' has been called, the
+        // elements of the layout counted by this guard.
+
+    // MANIPULATORS
+    void operator++();
+        // Count the next element of the layout, in sorted order, as
+        // constructed.
+
+    void release();
+        // Release the elements of the layout from management by this guard.
+};
+
+                            // ====================
+                            // class EytzingerArray
+                            // ====================
+
+template <class TYPE>
+class EytzingerArray {
+    // This class template provides an immutable array of elements of the
+    // (template parameter) 'TYPE', copied from a sorted range, and stored and
+    // searched in Eytzinger layout.  'TYPE' must be copy-constructible.  See
+    // the component-level documentation for details.
+
+    // PRIVATE TYPES
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+    // DATA
+    void             *d_memory_p;     // allocated memory, or 0 (owned)
+    TYPE             *d_array_p;      // elements in Eytzinger layout
+    std::size_t       d_size;         // number of elements
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void allocate(std::size_t numElements);
+        // Allocate memory for the specified 'numElements', and load into
+        // 'd_memory_p' its address and into 'd_array_p' the aligned address
+        // of the first element.  The behavior is undefined unless no memory
+        // is allocated.
+
+  public:
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(EytzingerArray,
+                                 bslalg::TypeTraitUsesBslmaAllocator);
+
+    // CREATORS
+    explicit EytzingerArray(bslma::Allocator *basicAllocator = 0);
+        // Create an empty array.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    EytzingerArray(const TYPE       *first,
+                   const TYPE       *last,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create an array holding copies of the elements of the specified
+        // sorted range '[first, last)'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless the range is sorted in the order in which the
+        // array is searched.
+
+    EytzingerArray(const EytzingerArray&  original,
+                   bslma::Allocator      *basicAllocator = 0);
+        // Create an array holding copies of the elements of the specified
+        // 'original' array.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~EytzingerArray();
+        // Destroy this object.
+
+    // MANIPULATORS
+    EytzingerArray& operator=(const EytzingerArray& rhs);
+        // Assign to this object the elements of the specified 'rhs' array,
+        // and return a reference providing modifiable access to this object.
+
+    void assign(const TYPE *first, const TYPE *last);
+        // Replace the elements of this array by copies of the elements of the
+        // specified sorted range '[first, last)'.  The behavior is undefined
+        // unless the range is sorted in the order in which the array is
+        // searched.
+
+    void swap(EytzingerArray& other);
+        // Exchange the elements of this array with those of the specified
+        // 'other' array.  The behavior is undefined unless this array and
+        // 'other' use the same allocator.
+
+    // ACCESSORS
+    const TYPE& operator[](std::size_t index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index' in the layout of this array.  The behavior
+        // is undefined unless 'index < size()'.
+
+    std::size_t beginIndex() const;
+        // Return the index in the layout of this array of its first element
+        // in sorted order, or 'size()' if this array is empty.
+
+    std::size_t nextIndex(std::size_t index) const;
+        // Return the index in the layout of this array of the element
+        // following, in sorted order, the element at the specified 'index',
+        // or 'size()' if there is none.  The behavior is undefined unless
+        // 'index < size()'.
+
+    template <class VALUE>
+    std::size_t lowerBound(const VALUE& value) const;
+    template <class VALUE, class COMPARATOR>
+    std::size_t lowerBound(const VALUE& value, COMPARATOR comparator) const;
+        // Return the index in the layout of this array of its first element,
+        // in sorted order, that does not precede the specified 'value', or
+        // 'size()' if there is none.  Optionally specify a 'comparator' used
+        // to order elements and 'value'; if 'comparator' is not specified,
+        // 'operator<' is used.  See 'bslalg_searchutil' for the requirements
+        // on 'comparator'.
+
+    template <class VALUE>
+    std::size_t upperBound(const VALUE& value) const;
+    template <class VALUE, class COMPARATOR>
+    std::size_t upperBound(const VALUE& value, COMPARATOR comparator) const;
+        // Return the index in the layout of this array of its first element,
+        // in sorted order, that the specified 'value' precedes, or 'size()'
+        // if there is none.  Optionally specify a 'comparator' used to order
+        // elements and 'value'; if 'comparator' is not specified, 'operator<'
+        // is used.  See 'bslalg_searchutil' for the requirements on
+        // 'comparator'.
+
+    const TYPE *data() const;
+        // Return the address of the first element of the layout of this
+        // array, or 0 if this array is empty.
+
+    std::size_t size() const;
+        // Return the number of elements in this array.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this array to supply memory.
+};
+
+// FREE FUNCTIONS
+template <class TYPE>
+void swap(EytzingerArray<TYPE>& a, EytzingerArray<TYPE>& b);
+    // Exchange the elements of the specified 'a' and 'b' arrays.  The
+    // behavior is undefined unless 'a' and 'b' use the same allocator.
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                         // --------------------------
+                         // class EytzingerArray_Guard
+                         // --------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+EytzingerArray_Guard<TYPE>::EytzingerArray_Guard(TYPE        *array,
+                                                 std::size_t  numElements)
+: d_array_p(array)
+, d_numElements(numElements)
+, d_count(0)
+{
+}
+
+template <class TYPE>
+EytzingerArray_Guard<TYPE>::~EytzingerArray_Guard()
+{
+    if (!d_array_p) {
+        return;                                                       // RETURN
+    }
+
+    std::size_t index = SearchUtil::eytzingerBegin(d_numElements);
+    for (std::size_t i = 0; i < d_count; ++i) {
+        ScalarDestructionPrimitives::destroy(d_array_p + index);
+        index = SearchUtil::eytzingerNext(index, d_numElements);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void EytzingerArray_Guard<TYPE>::operator++()
+{
+    ++d_count;
+}
+
+template <class TYPE>
+inline
+void EytzingerArray_Guard<TYPE>::release()
+{
+    d_array_p = 0;
+}
+
+                            // --------------------
+                            // class EytzingerArray
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void EytzingerArray<TYPE>::allocate(std::size_t numElements)
+{
+    BSLS_ASSERT_SAFE(0 == d_memory_p);
+
+    // The (non-existent) element preceding the first is aligned to a cache
+    // line, so that the descendants of the element at each one-based position
+    // 'k', which start at a multiple of 'k', share a cache line.
+
+    d_memory_p = d_allocator_p->allocate((numElements + 1) * sizeof(TYPE)
+                                         + k_CACHE_LINE_SIZE - 1);
+
+    const bsls::Types::UintPtr line =
+                          (reinterpret_cast<bsls::Types::UintPtr>(d_memory_p)
+                           + k_CACHE_LINE_SIZE - 1)
+                        & ~static_cast<bsls::Types::UintPtr>(
+                                                        k_CACHE_LINE_SIZE - 1);
+
+    d_array_p = reinterpret_cast<TYPE *>(line) + 1;
+}
+
+// CREATORS
+template <class TYPE>
+inline
+EytzingerArray<TYPE>::EytzingerArray(bslma::Allocator *basicAllocator)
+: d_memory_p(0)
+, d_array_p(0)
+, d_size(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE>
+EytzingerArray<TYPE>::EytzingerArray(const TYPE       *first,
+                                     const TYPE       *last,
+                                     bslma::Allocator *basicAllocator)
+: d_memory_p(0)
+, d_array_p(0)
+, d_size(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    const std::size_t numElements = last - first;
+    if (0 == numElements) {
+        return;                                                       // RETURN
+    }
+
+    allocate(numElements);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_memory_p,
+                                                        d_allocator_p);
+
+    // The elements are constructed in sorted order, so that the guard can
+    // find those constructed by the same traversal.
+
+    EytzingerArray_Guard<TYPE> guard(d_array_p, numElements);
+
+    std::size_t index = SearchUtil::eytzingerBegin(numElements);
+    for (; first != last; ++first) {
+        ScalarPrimitives::copyConstruct(d_array_p + index,
+                                        *first,
+                                        d_allocator_p);
+        ++guard;
+        index = SearchUtil::eytzingerNext(index, numElements);
+    }
+
+    guard.release();
+    proctor.release();
+    d_size = numElements;
+}
+
+template <class TYPE>
+EytzingerArray<TYPE>::EytzingerArray(const EytzingerArray&  original,
+                                     bslma::Allocator      *basicAllocator)
+: d_memory_p(0)
+, d_array_p(0)
+, d_size(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    allocate(original.d_size);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_memory_p,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::copyConstruct(d_array_p,
+                                   original.d_array_p,
+                                   original.d_array_p + original.d_size,
+                                   d_allocator_p);
+
+    proctor.release();
+    d_size = original.d_size;
+}
+
+template <class TYPE>
+EytzingerArray<TYPE>::~EytzingerArray()
+{
+    if (d_memory_p) {
+        ArrayDestructionPrimitives::destroy(d_array_p, d_array_p + d_size);
+        d_allocator_p->deallocate(d_memory_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+EytzingerArray<TYPE>& EytzingerArray<TYPE>::operator=(
+                                                    const EytzingerArray& rhs)
+{
+    if (this != &rhs) {
+        EytzingerArray(rhs, d_allocator_p).swap(*this);
+    }
+    return *this;
+}
+
+template <class TYPE>
+void EytzingerArray<TYPE>::assign(const TYPE *first, const TYPE *last)
+{
+    EytzingerArray(first, last, d_allocator_p).swap(*this);
+}
+
+template <class TYPE>
+void EytzingerArray<TYPE>::swap(EytzingerArray& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    void        *memory = d_memory_p;
+    TYPE        *array  = d_array_p;
+    std::size_t  size   = d_size;
+
+    d_memory_p = other.d_memory_p;
+    d_array_p  = other.d_array_p;
+    d_size     = other.d_size;
+
+    other.d_memory_p = memory;
+    other.d_array_p  = array;
+    other.d_size     = size;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& EytzingerArray<TYPE>::operator[](std::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return d_array_p[index];
+}
+
+template <class TYPE>
+inline
+std::size_t EytzingerArray<TYPE>::beginIndex() const
+{
+    return SearchUtil::eytzingerBegin(d_size);
+}
+
+template <class TYPE>
+inline
+std::size_t EytzingerArray<TYPE>::nextIndex(std::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index < d_size);
+
+    return SearchUtil::eytzingerNext(index, d_size);
+}
+
+template <class TYPE>
+template <class VALUE>
+inline
+std::size_t EytzingerArray<TYPE>::lowerBound(const VALUE& value) const
+{
+    return SearchUtil::eytzingerLowerBound(d_array_p, d_size, value);
+}
+
+template <class TYPE>
+template <class VALUE, class COMPARATOR>
+inline
+std::size_t EytzingerArray<TYPE>::lowerBound(const VALUE& value,
+                                             COMPARATOR   comparator) const
+{
+    return SearchUtil::eytzingerLowerBound(d_array_p,
+                                           d_size,
+                                           value,
+                                           comparator);
+}
+
+template <class TYPE>
+template <class VALUE>
+inline
+std::size_t EytzingerArray<TYPE>::upperBound(const VALUE& value) const
+{
+    return SearchUtil::eytzingerUpperBound(d_array_p, d_size, value);
+}
+
+template <class TYPE>
+template <class VALUE, class COMPARATOR>
+inline
+std::size_t EytzingerArray<TYPE>::upperBound(const VALUE& value,
+                                             COMPARATOR   comparator) const
+{
+    return SearchUtil::eytzingerUpperBound(d_array_p,
+                                           d_size,
+                                           value,
+                                           comparator);
+}
+
+template <class TYPE>
+inline
+const TYPE *EytzingerArray<TYPE>::data() const
+{
+    return d_array_p;
+}
+
+template <class TYPE>
+inline
+std::size_t EytzingerArray<TYPE>::size() const
+{
+    return d_size;
+}
+
+template <class TYPE>
+inline
+bslma::Allocator *EytzingerArray<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+// FREE FUNCTIONS
+template <class TYPE>
+inline
+void swap(EytzingerArray<TYPE>& a, EytzingerArray<TYPE>& b)
+{
+    a.swap(b);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,792 @@
+// bslalg_eytzingerarray.t.cpp                                        -*-C++-*-
+
+#include <bslalg_eytzingerarray.h>
+
+#include <bslalg_searchutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // native_std::lower_bound, native_std::upper_bound
+#include <new>          // placement 'new'
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a value-semantic-like container whose
+// searches are implemented by 'bslalg::SearchUtil', which is tested
+// thoroughly by its own test driver.  We therefore concentrate on the
+// management of the elements and memory of the container: the construction
+// of each element at its position in the layout, the alignment of the
+// layout, the use of the supplied (or default) allocator, exception
+// neutrality, and the copy, assignment, and swap operations.  We then verify
+// that the searches and traversal of the container delegate correctly, by
+// comparing their results with those of 'native_std::lower_bound' and
+// 'native_std::upper_bound' for arrays of several lengths.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] EytzingerArray(bslma::Allocator *basicAllocator = 0);
+// [ 2] EytzingerArray(const TYPE *first, const TYPE *last, *ba = 0);
+// [ 3] EytzingerArray(const EytzingerArray& original, *ba = 0);
+// [ 2] ~EytzingerArray();
+//
+// MANIPULATORS
+// [ 3] EytzingerArray& operator=(const EytzingerArray& rhs);
+// [ 3] void assign(const TYPE *first, const TYPE *last);
+// [ 3] void swap(EytzingerArray& other);
+//
+// ACCESSORS
+// [ 2] const TYPE& operator[](size_t index) const;
+// [ 4] size_t beginIndex() const;
+// [ 4] size_t nextIndex(size_t index) const;
+// [ 4] size_t lowerBound(const VALUE& value) const;
+// [ 4] size_t lowerBound(const VALUE& value, COMPARATOR comparator);
+// [ 4] size_t upperBound(const VALUE& value) const;
+// [ 4] size_t upperBound(const VALUE& value, COMPARATOR comparator);
+// [ 2] const TYPE *data() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE FUNCTIONS
+// [ 3] void swap(EytzingerArray<TYPE>& a, EytzingerArray<TYPE>& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::EytzingerArray<int> Obj;
+typedef bslalg::SearchUtil          Util;
+typedef bsls::Types::UintPtr        UintPtr;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+class AllocatingInt {
+    // This class provides an integer value held in memory obtained from an
+    // allocator, so that copying an object allocates (and may throw), and
+    // destroying an object that was not constructed, or failing to destroy
+    // one that was, is detected by a test allocator.
+
+    // DATA
+    int              *d_value_p;      // held value (owned)
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AllocatingInt& operator=(const AllocatingInt&);
+
+  public:
+    // TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(AllocatingInt,
+                                 bslalg::TypeTraitUsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocatingInt(int value, bslma::Allocator *basicAllocator = 0)
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        d_value_p = static_cast<int *>(
+                                  d_allocator_p->allocate(sizeof *d_value_p));
+        *d_value_p = value;
+    }
+
+    AllocatingInt(const AllocatingInt&  original,
+                  bslma::Allocator     *basicAllocator = 0)
+    : d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        d_value_p = static_cast<int *>(
+                                  d_allocator_p->allocate(sizeof *d_value_p));
+        *d_value_p = *original.d_value_p;
+    }
+
+    ~AllocatingInt()
+    {
+        d_allocator_p->deallocate(d_value_p);
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return *d_value_p;
+    }
+
+    bslma::Allocator *allocator() const
+    {
+        return d_allocator_p;
+    }
+};
+
+bool operator<(const AllocatingInt& lhs, int rhs)
+{
+    return lhs.value() < rhs;
+}
+
+bool operator<(int lhs, const AllocatingInt& rhs)
+{
+    return lhs < rhs.value();
+}
+
+struct GreaterInt {
+    // This 'struct' provides a comparator ordering integers in decreasing
+    // order.
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+static bool isLaidOut(const Obj& object, const int *sorted, int length)
+    // Return 'true' if the specified 'object' holds the elements of the
+    // specified 'sorted' array of the specified 'length' in Eytzinger layout,
+    // and 'false' otherwise.
+{
+    if (static_cast<int>(object.size()) != length) {
+        return false;                                                 // RETURN
+    }
+
+    int i = 0;
+    for (std::size_t index = object.beginIndex();
+         index != object.size();
+         index = object.nextIndex(index), ++i) {
+        if (i >= length || sorted[i] != object[index]) {
+            return false;                                             // RETURN
+        }
+    }
+    return i == length;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Interval Containing a Value
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we classify trade sizes into tiers, each tier starting at a
+// given size, and that we look up the tier of each of a high volume of
+// trades.
+//
+// First, we define a comparator that orders sizes in decreasing order:
+//..
+struct Greater {
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs > rhs;
+    }
+};
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // Verify that no test case allocates from the default allocator, except
+    // where it is supposed to.
+
+    bslma::TestAllocator         defaultAllocator("default");
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we define the sizes at which each tier starts, in decreasing order,
+// and build an 'EytzingerArray' holding them:
+//..
+        const int tierStarts[] = { 50000, 10000, 5000, 1000, 500, 100, 0 };
+        const int NUM_TIERS    = sizeof tierStarts / sizeof *tierStarts;
+
+        bslma::TestAllocator allocator;
+
+        bslalg::EytzingerArray<int> tiers(tierStarts,
+                                          tierStarts + NUM_TIERS,
+                                          &allocator);
+        ASSERT(NUM_TIERS == tiers.size());
+//..
+// Next, we find the tier of a trade, which starts at the first size, in
+// decreasing order, that is not greater than the size of the trade:
+//..
+        ASSERT(  500 == tiers[tiers.lowerBound(  750, Greater())]);
+        ASSERT( 1000 == tiers[tiers.lowerBound( 1000, Greater())]);
+        ASSERT(50000 == tiers[tiers.lowerBound(60000, Greater())]);
+//..
+// Finally, we visit the starts of the tiers below 5000, in sorted (that is,
+// decreasing) order:
+//..
+        std::size_t index = tiers.lowerBound(4999, Greater());
+        int         count = 0;
+        while (index != tiers.size()) {
+            ASSERT(tierStarts[3 + count] == tiers[index]);
+            index = tiers.nextIndex(index);
+            ++count;
+        }
+        ASSERT(4 == count);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEARCHES AND TRAVERSAL
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the index in the layout of
+        //:   the element found by the corresponding standard search, or
+        //:   'size()' if it finds none, for every searched value.
+        //:
+        //: 2 A supplied comparator is used.
+        //:
+        //: 3 'beginIndex' and 'nextIndex' visit the elements in sorted order.
+        //:
+        //: 4 An empty array finds no element.
+        //
+        // Plan:
+        //: 1 For every length up to 40, build an array from a sorted array
+        //:   having runs of equal values, and compare the results of searches
+        //:   for every value from below the least element to above the
+        //:   greatest (mapped to sorted positions by a traversal of the
+        //:   array) with those of the standard searches.  (C-1, 3..4)
+        //:
+        //: 2 Repeat P-1 for a range in decreasing order, searched using a
+        //:   comparator.  (C-2)
+        //
+        // Testing:
+        //   size_t beginIndex() const;
+        //   size_t nextIndex(size_t index) const;
+        //   size_t lowerBound(const VALUE& value) const;
+        //   size_t lowerBound(const VALUE& value, COMPARATOR comparator);
+        //   size_t upperBound(const VALUE& value) const;
+        //   size_t upperBound(const VALUE& value, COMPARATOR comparator);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSEARCHES AND TRAVERSAL"
+                            "\n======================\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const int MAX_LENGTH = 40;
+
+        int sorted[MAX_LENGTH];
+        int reversed[MAX_LENGTH];
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                sorted[i]                = 3 * (i / 2);
+                reversed[length - 1 - i] = sorted[i];
+            }
+
+            Obj        mX(sorted, sorted + length, &ta);
+            const Obj& X = mX;
+            Obj        mR(reversed, reversed + length, &ta);
+            const Obj& R = mR;
+
+            LOOP_ASSERT(length, isLaidOut(X, sorted, length));
+            LOOP_ASSERT(length, isLaidOut(R, reversed, length));
+
+            std::size_t sortedIndex[MAX_LENGTH + 1];
+            int         count = 0;
+            for (std::size_t index = X.beginIndex();
+                 index != X.size();
+                 index = X.nextIndex(index)) {
+                sortedIndex[index] = count++;
+            }
+            sortedIndex[X.size()] = length;
+
+            for (int value = -2; value <= 3 * (length / 2) + 2; ++value) {
+                const int EXP_LOWER = static_cast<int>(
+                   native_std::lower_bound(sorted, sorted + length, value)
+                                                                    - sorted);
+                const int EXP_UPPER = static_cast<int>(
+                   native_std::upper_bound(sorted, sorted + length, value)
+                                                                    - sorted);
+                const int EXP_R_LOWER = static_cast<int>(
+                   native_std::lower_bound(reversed,
+                                           reversed + length,
+                                           value,
+                                           GreaterInt()) - reversed);
+                const int EXP_R_UPPER = static_cast<int>(
+                   native_std::upper_bound(reversed,
+                                           reversed + length,
+                                           value,
+                                           GreaterInt()) - reversed);
+
+                LOOP2_ASSERT(length, value,
+                          EXP_LOWER == (int)sortedIndex[X.lowerBound(value)]);
+                LOOP2_ASSERT(length, value,
+                          EXP_UPPER == (int)sortedIndex[X.upperBound(value)]);
+                LOOP2_ASSERT(length, value,
+                             EXP_R_LOWER == (int)sortedIndex[
+                                          R.lowerBound(value, GreaterInt())]);
+                LOOP2_ASSERT(length, value,
+                             EXP_R_UPPER == (int)sortedIndex[
+                                          R.upperBound(value, GreaterInt())]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an array having the same elements,
+        //:   in the same layout, as the original, using the supplied (or
+        //:   default) allocator, and leaves the original unchanged.
+        //:
+        //: 2 Copy assignment, including self-assignment and assignment of an
+        //:   empty array, and 'assign' replace the elements of the array,
+        //:   using its allocator, and release the previous elements.
+        //:
+        //: 3 'swap' (member and free) exchanges the elements of two arrays
+        //:   without allocating.
+        //:
+        //: 4 Copying is exception neutral, and leaks no memory.
+        //
+        // Plan:
+        //: 1 Copy, assign, and swap arrays of 'int' values of several lengths
+        //:   built with a test allocator, and verify the elements and the
+        //:   use of memory of each array.  (C-1..3)
+        //:
+        //: 2 Copy and assign an array of 'AllocatingInt' values within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify that no
+        //:   memory is leaked.  (C-4)
+        //
+        // Testing:
+        //   EytzingerArray(const EytzingerArray& original, *ba = 0);
+        //   EytzingerArray& operator=(const EytzingerArray& rhs);
+        //   void assign(const TYPE *first, const TYPE *last);
+        //   void swap(EytzingerArray& other);
+        //   void swap(EytzingerArray<TYPE>& a, EytzingerArray<TYPE>& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, AND SWAP"
+                            "\n==========================\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        bslma::TestAllocator tb(veryVeryVerbose);
+
+        const int MAX_LENGTH = 20;
+
+        int values[MAX_LENGTH];
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            values[i] = 10 * i;
+        }
+
+        if (verbose) printf("\tCopy construction and assignment.\n");
+
+        for (int i = 0; i <= MAX_LENGTH; i += 3) {
+            for (int j = 0; j <= MAX_LENGTH; j += 4) {
+                Obj        mX(values, values + i, &ta);
+                const Obj& X = mX;
+
+                {
+                    const Obj Y(X, &tb);
+
+                    LOOP2_ASSERT(i, j, isLaidOut(Y, values, i));
+                    LOOP2_ASSERT(i, j, &tb == Y.allocator());
+                    LOOP2_ASSERT(i, j, (0 == i) == (0 == tb.numBlocksInUse()));
+                    LOOP2_ASSERT(i, j, isLaidOut(X, values, i));
+
+                    const bsls::Types::Int64 NUM_DEFAULT =
+                                             defaultAllocator.numBlocksTotal();
+                    const Obj Z(X);
+                    LOOP2_ASSERT(i, j, isLaidOut(Z, values, i));
+                    LOOP2_ASSERT(i, j, &defaultAllocator == Z.allocator());
+                    LOOP2_ASSERT(i, j,
+                                 (0 == i) == (NUM_DEFAULT ==
+                                           defaultAllocator.numBlocksTotal()));
+                }
+                LOOP2_ASSERT(i, j, 0 == tb.numBlocksInUse());
+                LOOP2_ASSERT(i, j, 0 == defaultAllocator.numBlocksInUse());
+
+                Obj        mY(values + 1, values + 1 + j, &tb);
+                const Obj& Y = mY;
+
+                mY = X;
+                LOOP2_ASSERT(i, j, isLaidOut(Y, values, i));
+                LOOP2_ASSERT(i, j, &tb == Y.allocator());
+                LOOP2_ASSERT(i, j, (0 == i) == (0 == tb.numBlocksInUse()));
+
+                mY = Y;
+                LOOP2_ASSERT(i, j, isLaidOut(Y, values, i));
+
+                mY.assign(values + 1, values + 1 + j);
+                LOOP2_ASSERT(i, j, isLaidOut(Y, values + 1, j));
+                LOOP2_ASSERT(i, j, (0 == j) == (0 == tb.numBlocksInUse()));
+                LOOP2_ASSERT(i, j, isLaidOut(X, values, i));
+            }
+            LOOP_ASSERT(i, 0 == ta.numBlocksInUse());
+            LOOP_ASSERT(i, 0 == tb.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tSwap.\n");
+
+        for (int i = 0; i <= MAX_LENGTH; i += 3) {
+            for (int j = 0; j <= MAX_LENGTH; j += 4) {
+                Obj        mX(values, values + i, &ta);
+                const Obj& X = mX;
+                Obj        mY(values + 1, values + 1 + j, &ta);
+                const Obj& Y = mY;
+
+                const int        *XDATA = X.data();
+                const int        *YDATA = Y.data();
+                bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+                mX.swap(mY);
+                LOOP2_ASSERT(i, j, isLaidOut(X, values + 1, j));
+                LOOP2_ASSERT(i, j, isLaidOut(Y, values, i));
+                LOOP2_ASSERT(i, j, YDATA == X.data());
+                LOOP2_ASSERT(i, j, XDATA == Y.data());
+
+                swap(mX, mY);
+                LOOP2_ASSERT(i, j, isLaidOut(X, values, i));
+                LOOP2_ASSERT(i, j, isLaidOut(Y, values + 1, j));
+                LOOP2_ASSERT(i, j, NUM_BLOCKS == ta.numBlocksTotal());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            enum { k_LENGTH = 10 };
+
+            bslma::TestAllocator tc(veryVeryVerbose);
+
+            AllocatingInt *range = static_cast<AllocatingInt *>(
+                                     tc.allocate(k_LENGTH * sizeof *range));
+            for (int i = 0; i < k_LENGTH; ++i) {
+                new (range + i) AllocatingInt(i, &tc);
+            }
+
+            const bslalg::EytzingerArray<AllocatingInt> X(range,
+                                                          range + k_LENGTH,
+                                                          &tc);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                bslalg::EytzingerArray<AllocatingInt> mY(X, &ta);
+                ASSERT(k_LENGTH == mY.size());
+                ASSERT(&ta == mY[0].allocator());
+
+                mY.assign(range, range + k_LENGTH / 2);
+                ASSERT(k_LENGTH / 2 == mY.size());
+
+                mY = X;
+                ASSERT(k_LENGTH == mY.size());
+                ASSERT(3 == mY[mY.lowerBound(3)].value());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == ta.numBlocksInUse());
+
+            for (int i = 0; i < k_LENGTH; ++i) {
+                range[i].~AllocatingInt();
+            }
+            tc.deallocate(range);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty array that allocates no
+        //:   memory.
+        //:
+        //: 2 The range constructor places each element of the range at its
+        //:   position in the Eytzinger layout.
+        //:
+        //: 3 The memory of a non-empty array is obtained from the supplied
+        //:   allocator, or from the default allocator if none is supplied, in
+        //:   a single block, and released on destruction.
+        //:
+        //: 4 The position preceding the first element is aligned to a 64-byte
+        //:   cache line.
+        //:
+        //: 5 Each element is copied using the allocator of the array.
+        //:
+        //: 6 The range constructor is exception neutral: if copying an
+        //:   element throws, the elements already copied are destroyed, and
+        //:   the memory of the array is released.
+        //
+        // Plan:
+        //: 1 Create empty arrays, with and without an allocator, and verify
+        //:   their accessors and that no memory is allocated.  (C-1)
+        //:
+        //: 2 For every length up to 70, create an array from a sorted array,
+        //:   and verify its elements against those laid out by
+        //:   'SearchUtil::eytzingerLayout', its alignment, and its use of
+        //:   memory.  (C-2..4)
+        //:
+        //: 3 Create arrays of 'AllocatingInt' values within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify the
+        //:   allocator of each element and that no memory is leaked.  (C-5..6)
+        //
+        // Testing:
+        //   EytzingerArray(bslma::Allocator *basicAllocator = 0);
+        //   EytzingerArray(const TYPE *first, const TYPE *last, *ba = 0);
+        //   ~EytzingerArray();
+        //   const TYPE& operator[](size_t index) const;
+        //   const TYPE *data() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) printf("\tDefault constructor.\n");
+        {
+            const Obj X;
+            ASSERT(0                 == X.size());
+            ASSERT(0                 == X.data());
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0                 == X.beginIndex());
+
+            const Obj Y(&ta);
+            ASSERT(0   == Y.size());
+            ASSERT(&ta == Y.allocator());
+            ASSERT(0   == ta.numBlocksTotal());
+            ASSERT(0   == defaultAllocator.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tRange constructor.\n");
+
+        const int MAX_LENGTH = 70;
+
+        int sorted[MAX_LENGTH];
+        int expected[MAX_LENGTH];
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            sorted[i] = 5 * i - 100;
+        }
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            Util::eytzingerLayout(expected, sorted, sorted + length);
+
+            {
+                const Obj X(sorted, sorted + length, &ta);
+
+                LOOP_ASSERT(length, length == (int)X.size());
+                LOOP_ASSERT(length, &ta == X.allocator());
+                LOOP_ASSERT(length,
+                            (0 == length ? 0 : 1) == ta.numBlocksInUse());
+                for (int i = 0; i < length; ++i) {
+                    LOOP2_ASSERT(length, i, expected[i] == X[i]);
+                    LOOP2_ASSERT(length, i, &X[i] == X.data() + i);
+                }
+                if (length) {
+                    const UintPtr address =
+                                 reinterpret_cast<UintPtr>(X.data() - 1);
+                    LOOP_ASSERT(length, 0 == address % 64);
+                }
+            }
+            LOOP_ASSERT(length, 0 == ta.numBlocksInUse());
+
+            {
+                const Obj X(sorted, sorted + length);
+
+                LOOP_ASSERT(length, length == (int)X.size());
+                LOOP_ASSERT(length, &defaultAllocator == X.allocator());
+                LOOP_ASSERT(length,
+                            (0 == length ? 0 : 1) ==
+                                            defaultAllocator.numBlocksInUse());
+            }
+            LOOP_ASSERT(length, 0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tException neutrality.\n");
+        {
+            enum { k_LENGTH = 12 };
+
+            bslma::TestAllocator tc(veryVeryVerbose);
+
+            AllocatingInt *range = static_cast<AllocatingInt *>(
+                                     tc.allocate(k_LENGTH * sizeof *range));
+            for (int i = 0; i < k_LENGTH; ++i) {
+                new (range + i) AllocatingInt(i, &tc);
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                const bslalg::EytzingerArray<AllocatingInt> X(
+                                                             range,
+                                                             range + k_LENGTH,
+                                                             &ta);
+                ASSERT(k_LENGTH == X.size());
+                for (std::size_t i = 0; i < X.size(); ++i) {
+                    LOOP_ASSERT(i, &ta == X[i].allocator());
+                }
+                ASSERT(7 == X[X.lowerBound(7)].value());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == ta.numBlocksInUse());
+
+            for (int i = 0; i < k_LENGTH; ++i) {
+                range[i].~AllocatingInt();
+            }
+            tc.deallocate(range);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an array from a small sorted range, search it, copy it,
+        //:   and assign to it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const int DATA[]   = { 10, 20, 30, 40, 50, 60, 70 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj        mX(DATA, DATA + NUM_DATA, &ta);
+        const Obj& X = mX;
+
+        ASSERT(NUM_DATA == X.size());
+        ASSERT(40       == X[0]);
+        ASSERT(10       == X[X.beginIndex()]);
+        ASSERT(30       == X[X.lowerBound(25)]);
+        ASSERT(40       == X[X.upperBound(30)]);
+        ASSERT(NUM_DATA == X.lowerBound(71));
+
+        Obj        mY(X, &ta);
+        const Obj& Y = mY;
+        ASSERT(NUM_DATA == Y.size());
+        ASSERT(60       == Y[Y.lowerBound(55)]);
+
+        mX.assign(DATA, DATA + 3);
+        ASSERT(3  == X.size());
+        ASSERT(3  == X.lowerBound(35));
+        ASSERT(20 == X[0]);
+
+        mY = X;
+        ASSERT(3 == Y.size());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
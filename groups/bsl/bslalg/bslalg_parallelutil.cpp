@@ -0,0 +1,273 @@
+// bslalg_parallelutil.cpp                                            -*-C++-*-
+#include <bslalg_parallelutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslalg_threadimputil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+namespace {
+
+typedef ThreadImpUtil::Handle    ThreadHandle;
+typedef ThreadImpUtil::Mutex     Mutex;
+typedef ThreadImpUtil::Condition Condition;
+
+}  // close unnamed namespace
+
+                       // =============================
+                       // struct ParallelThreadPool_Imp
+                       // =============================
+
+struct ParallelThreadPool_Imp : ThreadImpUtil::Runnable {
+    // This 'struct' holds the state of a 'ParallelThreadPool', and is run by
+    // each of its worker threads.  A job is started by incrementing
+    // 'd_generation' and setting 'd_numActive' to the number of workers, each
+    // of which claims task indices from 'd_nextTask' until none remain, and
+    // then decrements 'd_numActive'.  The job description is not modified
+    // until every worker has done so.
+
+    // DATA
+    Mutex                   d_mutex;          // protects the fields below
+    Condition               d_workCondition;  // signals a new job, or stop
+    Condition               d_doneCondition;  // signals 'd_numActive == 0'
+    unsigned int            d_generation;     // number of jobs started
+    int                     d_numActive;      // workers running the job
+    bool                    d_stop;           // workers should exit
+
+    ParallelThreadPool::Job d_job;            // job being executed
+    void                   *d_context_p;      // context of 'd_job'
+    int                     d_numTasks;       // tasks of 'd_job'
+    bsls::AtomicInt         d_nextTask;       // next task to claim
+
+    bsls::AtomicInt         d_busy;           // 1 while executing a job
+
+    ThreadHandle           *d_threads_p;      // worker threads
+    int                     d_numWorkers;     // number of worker threads
+
+    // MANIPULATORS
+    void runTasks()
+        // Run the tasks of the current job until none remain unclaimed.
+    {
+        int task;
+        while ((task = d_nextTask.add(1) - 1) < d_numTasks) {
+            d_job(d_context_p, task);
+        }
+    }
+
+    void workerLoop()
+        // Run the tasks of each job until the pool is stopped.
+    {
+        unsigned int generation = 0;
+
+        d_mutex.lock();
+        for (;;) {
+            while (!d_stop && generation == d_generation) {
+                d_workCondition.wait(&d_mutex);
+            }
+            if (d_stop) {
+                break;
+            }
+            generation = d_generation;
+            d_mutex.unlock();
+
+            runTasks();
+
+            d_mutex.lock();
+            if (0 == --d_numActive) {
+                d_doneCondition.signal();
+            }
+        }
+        d_mutex.unlock();
+    }
+
+    void run()
+        // Run the worker loop on the calling thread.
+    {
+        workerLoop();
+    }
+};
+
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Pointer s_defaultPool = { 0 };
+    // the pool returned by 'ParallelUtil::defaultPool'
+
+}  // close unnamed namespace
+
+                         // ------------------------
+                         // class ParallelThreadPool
+                         // ------------------------
+
+// CLASS METHODS
+int ParallelThreadPool::numProcessors()
+{
+    return ThreadImpUtil::numProcessors();
+}
+
+// CREATORS
+ParallelThreadPool::ParallelThreadPool(int               numThreads,
+                                       bslma::Allocator *basicAllocator)
+: d_imp_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    ParallelThreadPool_Imp *imp = new (*d_allocator_p) ParallelThreadPool_Imp;
+
+    imp->d_generation = 0;
+    imp->d_numActive  = 0;
+    imp->d_stop       = false;
+    imp->d_job        = 0;
+    imp->d_context_p  = 0;
+    imp->d_numTasks   = 0;
+    imp->d_numWorkers = 0;
+    imp->d_threads_p  = 0;
+
+    const int numWorkers = numThreads - 1;
+    if (0 < numWorkers) {
+        const bsls::Types::size_type size = numWorkers * sizeof(ThreadHandle);
+
+        imp->d_threads_p = static_cast<ThreadHandle *>(
+                                               d_allocator_p->allocate(size));
+
+        for (int i = 0; i < numWorkers; ++i) {
+            if (0 != ThreadImpUtil::create(&imp->d_threads_p[i], imp)) {
+                break;
+            }
+            ++imp->d_numWorkers;
+        }
+    }
+
+    d_imp_p = imp;
+}
+
+ParallelThreadPool::~ParallelThreadPool()
+{
+    d_imp_p->d_mutex.lock();
+    d_imp_p->d_stop = true;
+    d_imp_p->d_workCondition.broadcast();
+    d_imp_p->d_mutex.unlock();
+
+    for (int i = 0; i < d_imp_p->d_numWorkers; ++i) {
+        ThreadImpUtil::join(d_imp_p->d_threads_p[i]);
+    }
+
+    if (d_imp_p->d_threads_p) {
+        d_allocator_p->deallocate(d_imp_p->d_threads_p);
+    }
+    d_allocator_p->deleteObject(d_imp_p);
+}
+
+// MANIPULATORS
+void ParallelThreadPool::execute(Job job, void *context, int numTasks)
+{
+    BSLS_ASSERT(job);
+
+    // Run the tasks on the calling thread if there is no worker to help, or
+    // if another job is being executed (possibly by the calling thread).
+
+    if (numTasks <= 1
+     || 0 == d_imp_p->d_numWorkers
+     || 0 != d_imp_p->d_busy.testAndSwap(0, 1)) {
+        for (int i = 0; i < numTasks; ++i) {
+            job(context, i);
+        }
+        return;                                                       // RETURN
+    }
+
+    d_imp_p->d_job       = job;
+    d_imp_p->d_context_p = context;
+    d_imp_p->d_numTasks  = numTasks;
+    d_imp_p->d_nextTask.storeRelaxed(0);
+
+    d_imp_p->d_mutex.lock();
+    ++d_imp_p->d_generation;
+    d_imp_p->d_numActive = d_imp_p->d_numWorkers;
+    d_imp_p->d_workCondition.broadcast();
+    d_imp_p->d_mutex.unlock();
+
+    d_imp_p->runTasks();
+
+    d_imp_p->d_mutex.lock();
+    while (0 != d_imp_p->d_numActive) {
+        d_imp_p->d_doneCondition.wait(&d_imp_p->d_mutex);
+    }
+    d_imp_p->d_mutex.unlock();
+
+    d_imp_p->d_busy.storeRelease(0);
+}
+
+// ACCESSORS
+int ParallelThreadPool::numThreads() const
+{
+    return d_imp_p->d_numWorkers + 1;
+}
+
+                           // -------------------
+                           // struct ParallelUtil
+                           // -------------------
+
+// CLASS METHODS
+ParallelThreadPool *ParallelUtil::defaultPool()
+{
+    ParallelThreadPool *pool = static_cast<ParallelThreadPool *>(
+            const_cast<void *>(
+                     bsls::AtomicOperations::getPtrAcquire(&s_defaultPool)));
+    if (pool) {
+        return pool;                                                  // RETURN
+    }
+
+    // Create a pool, and install it unless another thread installed one
+    // first, in which case destroy it.
+
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    ParallelThreadPool *newPool = new (*allocator) ParallelThreadPool(
+                                 ParallelThreadPool::numProcessors(),
+                                 allocator);
+
+    pool = static_cast<ParallelThreadPool *>(
+                  bsls::AtomicOperations::testAndSwapPtrAcqRel(&s_defaultPool,
+                                                               0,
+                                                               newPool));
+    if (pool) {
+        allocator->deleteObject(newPool);
+        return pool;                                                  // RETURN
+    }
+    return newPool;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1394 @@
+// bslalg_parallelutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLALG_PARALLELUTIL
+#define INCLUDED_BSLALG_PARALLELUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel algorithms over random-access ranges.
+//
+//@CLASSES:
+//  bslalg::ParallelThreadPool: fixed set of threads executing fork-join jobs
+//  bslalg::ParallelUtil: namespace for parallel 'forEach', 'reduce', 'sort'
+//
+//@SEE_ALSO: bslalg_sortutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslalg::ParallelUtil', whose algorithms process ranges specified by
+// random-access iterators (e.g., pointers, or the iterators of 'bsl::vector'
+// and 'bsl::deque') using several threads, and a minimal thread pool,
+// 'bslalg::ParallelThreadPool', that supplies those threads.
+//
+// Each algorithm splits its input range into contiguous *chunks* of at least
+// 'k_MIN_CHUNK_SIZE' elements, several per thread so that threads finishing
+// early can help with the remaining work, and processes the chunks
+// concurrently on the threads of a pool.  Ranges of fewer than
+// 'k_SEQUENTIAL_THRESHOLD' elements, and ranges processed using a pool having
+// a single thread, are processed sequentially by the calling thread, with no
+// synchronization overhead.  The following algorithms are provided:
+//
+//: o 'forEach' invokes a function on each element of a range.
+//:
+//: o 'transform' stores the result of invoking a function on each element of
+//:   a range into the corresponding position of an output range.
+//:
+//: o 'reduce' and 'transformReduce' combine the elements of a range (or the
+//:   results of invoking a function on each element) using an *associative*
+//:   binary operation.  Each chunk is reduced separately, and the results of
+//:   the chunks are combined in order, so the operation need not be
+//:   commutative; note, however, that floating-point addition is not exactly
+//:   associative, so the result of summing floating-point values may differ
+//:   (slightly) from that of a sequential sum, and may depend on the number
+//:   of threads.
+//:
+//: o 'inclusiveScan' stores, at each position of an output range, the result
+//:   of combining the elements of a range up to and including the
+//:   corresponding position, using an associative binary operation.  The
+//:   input is processed twice: once to reduce each chunk, and once to scan
+//:   each chunk starting from the combined result of the preceding chunks.
+//:
+//: o 'sort' sorts a range by *parallel merge sort*: the chunks are sorted
+//:   concurrently (using 'bslalg::SortUtil::sort'), and then merged pairwise
+//:   in rounds, each merge being split into pieces, found by binary search,
+//:   that are themselves merged concurrently.  The merges alternate between
+//:   the range and a scratch buffer of the same size obtained from the
+//:   default allocator.  If the range is specified by pointers to a type
+//:   having the 'bslmf::IsBitwiseMoveable' trait, elements are relocated
+//:   between the range and the buffer by copying their bytes, as
+//:   'bslalg::ArrayPrimitives' relocates such elements (so that, e.g.,
+//:   strings are not copied), and the buffer is never initialized;
+//:   otherwise, the buffer is initialized by
+//:   'bslalg::ArrayPrimitives::copyConstruct' and elements are copied by
+//:   assignment.  The sort is not stable.
+//
+///Thread Pools
+///------------
+// A 'bslalg::ParallelThreadPool' is created with a number of threads, *which
+// includes the thread calling 'execute'*: a pool having 'N' threads starts
+// 'N - 1' worker threads, which wait for work until the pool is destroyed.
+// 'execute' runs the tasks of a *job*, identified by consecutive indices, on
+// the worker threads and the calling thread, and returns when all of them are
+// complete.  A pool executes one job at a time: if 'execute' is called while
+// the pool is executing another job (e.g., by another thread, or by a task
+// of the job), the tasks of the new job are run sequentially by the calling
+// thread, so that nested parallel algorithms are safe (but not parallel).
+//
+// Each algorithm of 'ParallelUtil' takes an optional pool; if no pool is
+// supplied, the process-wide pool returned by 'ParallelUtil::defaultPool' is
+// used, which is created on first use with one thread per processor
+// available to the process.
+//
+///Requirements on Functions and Elements
+///--------------------------------------
+// The functions and comparators supplied to the algorithms are invoked
+// concurrently from several threads, through a single object, and so must be
+// safe to invoke concurrently (e.g., they must not modify shared state
+// without synchronization).  The functions, comparators, and element
+// operations invoked by the algorithms must not throw exceptions while the
+// range is processed in parallel; the behavior is undefined otherwise.  Note
+// that 'sort' may allocate memory, and initialize its scratch buffer, before
+// processing in parallel; exceptions thrown then are propagated to the
+// caller, leaving the range unchanged.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing Large Arrays of Prices
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a large array of prices, on which we wish to perform
+// several computations using all available processors.
+//
+// First, we create the array of prices:
+//..
+//  enum { k_NUM_PRICES = 1000000 };
+//
+//  static double prices[k_NUM_PRICES];
+//  for (int i = 0; i < k_NUM_PRICES; ++i) {
+//      prices[i] = 100.0 + i % 997 / 100.0;
+//  }
+//..
+// Then, we define a function object that applies a discount to a price:
+//..
+//  struct Discount {
+//      double d_rate;
+//
+//      void operator()(double& price) const
+//      {
+//          price *= 1 - d_rate;
+//      }
+//  };
+//..
+// Next, we apply a discount to every price, in parallel, using the default
+// pool:
+//..
+//  Discount discount = { 0.5 };
+//  bslalg::ParallelUtil::forEach(prices, prices + k_NUM_PRICES, discount);
+//
+//  assert(50.0 == prices[0]);
+//..
+// Then, we compute the sum of the discounted prices.  Because the sum is
+// computed in chunks, it may differ slightly from a sequential sum:
+//..
+//  double total = bslalg::ParallelUtil::reduce(prices,
+//                                              prices + k_NUM_PRICES,
+//                                              0.0);
+//
+//  assert(total > 50.0 * k_NUM_PRICES);
+//  assert(total < 55.0 * k_NUM_PRICES);
+//..
+// Finally, we sort the prices, explicitly supplying a pool having four
+// threads:
+//..
+//  bslalg::ParallelThreadPool pool(4);
+//
+//  bslalg::ParallelUtil::sort(prices, prices + k_NUM_PRICES, &pool);
+//
+//  assert(50.0  == prices[0]);
+//  assert(54.9  <  prices[k_NUM_PRICES - 1]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_AUTOARRAYDESTRUCTOR
+#include <bslalg_autoarraydestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SORTUTIL
+#include <bslalg_sortutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_METAINT
+#include <bslmf_metaint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#ifndef INCLUDED_ITERATOR
+#include <iterator>
+#define INCLUDED_ITERATOR
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+struct ParallelThreadPool_Imp;
+
+                         // ========================
+                         // class ParallelThreadPool
+                         // ========================
+
+class ParallelThreadPool {
+    // This class provides a fixed set of threads that execute the tasks of
+    // one job at a time, the thread calling 'execute' participating in the
+    // execution.
+
+  public:
+    // TYPES
+    typedef void (*Job)(void *context, int taskIndex);
+        // 'Job' is an alias for a function that runs the task having the
+        // specified 'taskIndex' of a job, using the specified 'context'.
+
+  private:
+    // DATA
+    ParallelThreadPool_Imp *d_imp_p;        // platform-specific state (owned)
+    bslma::Allocator       *d_allocator_p;  // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    ParallelThreadPool(const ParallelThreadPool&);
+    ParallelThreadPool& operator=(const ParallelThreadPool&);
+
+  public:
+    // CLASS METHODS
+    static int numProcessors();
+        // Return the number of processors available to this process, or 1 if
+        // that number cannot be determined.
+
+    // CREATORS
+    explicit ParallelThreadPool(int               numThreads,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a pool that executes jobs using the specified 'numThreads'
+        // threads, including the thread calling 'execute', by starting
+        // 'numThreads - 1' worker threads.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If a worker
+        // thread cannot be started, the pool uses the threads that were
+        // started.  The behavior is undefined unless '1 <= numThreads'.
+
+    ~ParallelThreadPool();
+        // Stop the worker threads of this pool, waiting for them to exit, and
+        // destroy this pool.  The behavior is undefined if this pool is
+        // executing a job.
+
+    // MANIPULATORS
+    void execute(Job job, void *context, int numTasks);
+        // Invoke the specified 'job' with the specified 'context' once for
+        // each task index in the range '[0 .. numTasks)', concurrently on the
+        // threads of this pool, and return when all invocations have
+        // returned.  If this pool is executing another job, invoke 'job' for
+        // each task index sequentially on the calling thread instead.  The
+        // behavior is undefined if 'job' exits by throwing an exception.
+
+    // ACCESSORS
+    int numThreads() const;
+        // Return the number of threads, including the thread calling
+        // 'execute', that execute the jobs of this pool.
+};
+
+                       // ============================
+                       // struct ParallelUtil_Chunking
+                       // ============================
+
+struct ParallelUtil_Chunking {
+    // This 'struct' describes the division of a range of 'd_length' elements
+    // into 'd_numChunks' contiguous chunks whose lengths differ by at most
+    // one.  This 'struct' is for use only by 'ParallelUtil'.
+
+    // DATA
+    native_std::size_t d_length;     // number of elements
+    int                d_numChunks;  // number of chunks
+
+    // ACCESSORS
+    native_std::size_t begin(int chunk) const
+        // Return the offset of the first element of the specified 'chunk'.
+        // The behavior is undefined unless '0 <= chunk <= d_numChunks'.
+    {
+        const native_std::size_t n     = d_numChunks;
+        const native_std::size_t index = chunk;
+        return index * (d_length / n) + (index < d_length % n
+                                         ? index
+                                         : d_length % n);
+    }
+};
+
+                         // ========================
+                         // struct ParallelUtil_Plus
+                         // ========================
+
+struct ParallelUtil_Plus {
+    // This 'struct' provides the default operation of 'ParallelUtil::reduce'.
+
+    template <class LHS_TYPE, class RHS_TYPE>
+    LHS_TYPE operator()(const LHS_TYPE& lhs, const RHS_TYPE& rhs) const
+        // Return 'lhs + rhs'.
+    {
+        return lhs + rhs;
+    }
+};
+
+                       // ============================
+                       // struct ParallelUtil_Identity
+                       // ============================
+
+template <class TYPE>
+struct ParallelUtil_Identity {
+    // This 'struct' template provides the transformation used by
+    // 'ParallelUtil::reduce'.
+
+    const TYPE& operator()(const TYPE& value) const
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+};
+
+                      // ===============================
+                      // struct ParallelUtil_AssignMover
+                      // ===============================
+
+struct ParallelUtil_AssignMover {
+    // This 'struct' provides the element relocation used by
+    // 'ParallelUtil::sort' for elements that are copied by assignment.
+
+    template <class DST_ITER, class SRC_ITER>
+    static void move(DST_ITER destination, SRC_ITER source)
+        // Assign the element at the specified 'source' to the element at the
+        // specified 'destination'.
+    {
+        *destination = *source;
+    }
+
+    template <class DST_ITER, class SRC_ITER>
+    static void moveBlock(DST_ITER           destination,
+                          SRC_ITER           source,
+                          native_std::size_t numElements)
+        // Assign the specified 'numElements' elements starting at the
+        // specified 'source' to those starting at the specified
+        // 'destination'.
+    {
+        for (native_std::size_t i = 0; i < numElements; ++i) {
+            *destination = *source;
+            ++destination;
+            ++source;
+        }
+    }
+};
+
+                      // ================================
+                      // struct ParallelUtil_BitwiseMover
+                      // ================================
+
+struct ParallelUtil_BitwiseMover {
+    // This 'struct' provides the element relocation used by
+    // 'ParallelUtil::sort' for elements of bitwise-moveable types.
+
+    template <class TYPE>
+    static void move(TYPE *destination, TYPE *source)
+        // Relocate the element at the specified 'source' to the specified
+        // 'destination' by copying its bytes.
+    {
+        native_std::memcpy(static_cast<void *>(destination),
+                           static_cast<const void *>(source),
+                           sizeof(TYPE));
+    }
+
+    template <class TYPE>
+    static void moveBlock(TYPE               *destination,
+                          TYPE               *source,
+                          native_std::size_t  numElements)
+        // Relocate the specified 'numElements' elements starting at the
+        // specified 'source' to the specified 'destination' by copying their
+        // bytes.
+    {
+        native_std::memcpy(static_cast<void *>(destination),
+                           static_cast<const void *>(source),
+                           numElements * sizeof(TYPE));
+    }
+};
+
+                       // ============================
+                       // struct ParallelUtil_ForEach
+                       // ============================
+
+template <class RANDOM_ITER, class FUNCTION>
+struct ParallelUtil_ForEach {
+    // This 'struct' template describes a job invoking a function on each
+    // element of a range.
+
+    // DATA
+    RANDOM_ITER            d_first;       // start of the range
+    ParallelUtil_Chunking  d_chunking;    // division into chunks
+    FUNCTION              *d_function_p;  // function to invoke (held)
+
+    // CLASS METHODS
+    static void run(void *context, int chunk);
+        // Invoke the function described by the specified 'context' on each
+        // element of the specified 'chunk' of its range.
+};
+
+                      // ==============================
+                      // struct ParallelUtil_Transform
+                      // ==============================
+
+template <class INPUT_ITER, class OUTPUT_ITER, class FUNCTION>
+struct ParallelUtil_Transform {
+    // This 'struct' template describes a job storing the result of invoking
+    // a function on each element of a range into an output range.
+
+    // DATA
+    INPUT_ITER             d_first;       // start of the input range
+    OUTPUT_ITER            d_result;      // start of the output range
+    ParallelUtil_Chunking  d_chunking;    // division into chunks
+    FUNCTION              *d_function_p;  // function to invoke (held)
+
+    // CLASS METHODS
+    static void run(void *context, int chunk);
+        // Store the result of invoking the function described by the
+        // specified 'context' on each element of the specified 'chunk' of its
+        // input range into its output range.
+};
+
+                        // ===========================
+                        // struct ParallelUtil_Reduce
+                        // ===========================
+
+template <class RANDOM_ITER, class TYPE, class REDUCE_OP, class TRANSFORM_OP>
+struct ParallelUtil_Reduce {
+    // This 'struct' template describes a job reducing each chunk of a range
+    // into an uninitialized element of an array of partial results.
+
+    // DATA
+    RANDOM_ITER            d_first;         // start of the range
+    ParallelUtil_Chunking  d_chunking;      // division into chunks
+    TYPE                  *d_partials_p;    // partial results (held)
+    REDUCE_OP             *d_reduce_p;      // reduction (held)
+    TRANSFORM_OP          *d_transform_p;   // transformation (held)
+
+    // CLASS METHODS
+    static void run(void *context, int chunk);
+        // Construct, in the element of the partial results described by the
+        // specified 'context' corresponding to the specified 'chunk', the
+        // reduction of the transformed elements of that chunk of its range.
+};
+
+                         // =========================
+                         // struct ParallelUtil_Scan
+                         // =========================
+
+template <class INPUT_ITER, class OUTPUT_ITER, class TYPE, class BINARY_OP>
+struct ParallelUtil_Scan {
+    // This 'struct' template describes a job scanning each chunk of a range,
+    // starting from the combined results of the preceding chunks.
+
+    // DATA
+    INPUT_ITER             d_first;         // start of the input range
+    OUTPUT_ITER            d_result;        // start of the output range
+    ParallelUtil_Chunking  d_chunking;      // division into chunks
+    const TYPE            *d_prefixes_p;    // 'd_prefixes_p[i - 1]' combines
+                                            // chunks '0 .. i - 1' (held)
+    BINARY_OP             *d_operation_p;   // operation (held)
+
+    // CLASS METHODS
+    static void run(void *context, int chunk);
+        // Store the inclusive scan of the specified 'chunk' of the input
+        // range described by the specified 'context', preceded by the
+        // combined result of the preceding chunks, into its output range.
+};
+
+                       // ============================
+                       // struct ParallelUtil_SortRuns
+                       // ============================
+
+template <class RANDOM_ITER, class TYPE, class COMPARATOR, class MOVER>
+struct ParallelUtil_SortRuns {
+    // This 'struct' template describes a job sorting each chunk of a range,
+    // and optionally relocating the sorted chunk to a scratch buffer.
+
+    // DATA
+    RANDOM_ITER            d_first;         // start of the range
+    TYPE                  *d_scratch_p;     // scratch buffer (held)
+    ParallelUtil_Chunking  d_chunking;      // division into chunks
+    bool                   d_toScratch;     // relocate sorted chunks
+    COMPARATOR            *d_comparator_p;  // comparator (held)
+
+    // CLASS METHODS
+    static void run(void *context, int chunk);
+        // Sort the specified 'chunk' of the range described by the specified
+        // 'context', and relocate it to the scratch buffer if so described.
+};
+
+                      // ==============================
+                      // struct ParallelUtil_MergeRuns
+                      // ==============================
+
+template <class SRC_ITER, class DST_ITER, class COMPARATOR, class MOVER>
+struct ParallelUtil_MergeRuns {
+    // This 'struct' template describes a job merging pairs of adjacent sorted
+    // runs of a source buffer into a destination buffer, each merge being
+    // split into 'd_tasksPerMerge' tasks.  A final unpaired run is relocated
+    // to the destination.
+
+    // DATA
+    SRC_ITER                  d_source;         // source buffer
+    DST_ITER                  d_destination;    // destination buffer
+    const native_std::size_t *d_bounds_p;       // 'd_numRuns + 1' run bounds
+    int                       d_numRuns;        // number of runs
+    int                       d_tasksPerMerge;  // tasks per pair of runs
+    COMPARATOR               *d_comparator_p;   // comparator (held)
+
+    // CLASS METHODS
+    static void run(void *context, int task);
+        // Merge the piece of the pair of runs identified by the specified
+        // 'task' of the job described by the specified 'context'.
+};
+
+                           // ===================
+                           // struct ParallelUtil
+                           // ===================
+
+struct ParallelUtil {
+    // This 'struct' provides a namespace for algorithms that process ranges
+    // specified by random-access iterators in parallel, using the threads of
+    // a 'ParallelThreadPool'.
+
+    // CONSTANTS
+    enum {
+        k_MIN_CHUNK_SIZE       = 4096,  // minimum elements in a chunk
+        k_CHUNKS_PER_THREAD    = 4,     // chunks created per thread
+        k_SEQUENTIAL_THRESHOLD = 2 * k_MIN_CHUNK_SIZE
+                                        // below this length, process
+                                        // sequentially
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    static ParallelThreadPool *choosePool(ParallelThreadPool *pool);
+        // Return the specified 'pool', or the default pool if 'pool' is 0.
+
+    static int numChunks(native_std::size_t  length,
+                         ParallelThreadPool *pool);
+        // Return the number of chunks into which to divide a range of the
+        // specified 'length' to be processed using the specified 'pool', or
+        // 1 if the range should be processed sequentially.
+
+    template <class SRC_ITER, class DST_ITER, class COMPARATOR, class MOVER>
+    static void mergeRound(SRC_ITER                  source,
+                           DST_ITER                  destination,
+                           const native_std::size_t *bounds,
+                           int                       numRuns,
+                           int                       numTasks,
+                           COMPARATOR               *comparator,
+                           ParallelThreadPool        *pool);
+        // Merge the pairs of adjacent runs, delimited by the specified
+        // 'numRuns + 1' 'bounds', of the specified 'source' buffer into the
+        // specified 'destination' buffer, using approximately the specified
+        // 'numTasks' tasks of the specified 'pool' and the specified
+        // 'comparator'.
+
+    template <class RANDOM_ITER, class TYPE, class COMPARATOR, class MOVER>
+    static void mergeSort(RANDOM_ITER                  first,
+                          TYPE                        *scratch,
+                          const ParallelUtil_Chunking& chunking,
+                          COMPARATOR                  *comparator,
+                          ParallelThreadPool          *pool);
+        // Sort the range starting at the specified 'first' and divided by the
+        // specified 'chunking' using the specified 'comparator', the
+        // specified 'scratch' buffer of the same length, and the specified
+        // 'pool'.
+
+    template <class TYPE, class COMPARATOR>
+    static void sortImp(TYPE               *first,
+                        TYPE               *last,
+                        COMPARATOR         *comparator,
+                        ParallelThreadPool *pool,
+                        bslmf::MetaInt<1>  *);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sortImp(RANDOM_ITER         first,
+                        RANDOM_ITER         last,
+                        COMPARATOR         *comparator,
+                        ParallelThreadPool *pool,
+                        bslmf::MetaInt<0>  *);
+        // Sort the specified range '[first, last)' using the specified
+        // 'comparator' and 'pool', relocating elements by copying their
+        // bytes, if the last argument is of type 'bslmf::MetaInt<1> *', and
+        // by assignment otherwise.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sortDispatch(RANDOM_ITER         first,
+                             RANDOM_ITER         last,
+                             COMPARATOR         *comparator,
+                             ParallelThreadPool *pool);
+    template <class TYPE, class COMPARATOR>
+    static void sortDispatch(TYPE               *first,
+                             TYPE               *last,
+                             COMPARATOR         *comparator,
+                             ParallelThreadPool *pool);
+        // Sort the specified range '[first, last)' using the specified
+        // 'comparator' and 'pool', relocating elements by copying their bytes
+        // if the range is specified by pointers to a bitwise-moveable type.
+
+  public:
+    // CLASS METHODS
+    static ParallelThreadPool *defaultPool();
+        // Return the address of the process-wide pool used by the algorithms
+        // of this 'struct' when no pool is supplied, creating it, with
+        // 'ParallelThreadPool::numProcessors()' threads and using the global
+        // allocator, on the first call.  The pool is never destroyed.
+
+    template <class RANDOM_ITER, class FUNCTION>
+    static void forEach(RANDOM_ITER         first,
+                        RANDOM_ITER         last,
+                        FUNCTION            function,
+                        ParallelThreadPool *pool = 0);
+        // Invoke the specified 'function' on each element of the specified
+        // range '[first, last)', in parallel using the optionally specified
+        // 'pool', or the default pool if 'pool' is 0.
+
+    template <class INPUT_ITER, class OUTPUT_ITER, class FUNCTION>
+    static OUTPUT_ITER transform(INPUT_ITER          first,
+                                 INPUT_ITER          last,
+                                 OUTPUT_ITER         result,
+                                 FUNCTION            function,
+                                 ParallelThreadPool *pool = 0);
+        // Assign the result of invoking the specified 'function' on each
+        // element of the specified range '[first, last)' to the element at
+        // the same offset of the range starting at the specified 'result',
+        // in parallel using the optionally specified 'pool', or the default
+        // pool if 'pool' is 0, and return 'result + (last - first)'.  The
+        // behavior is undefined unless 'OUTPUT_ITER' is a random-access
+        // iterator, and the output range either is the input range or does
+        // not overlap it.
+
+    template <class RANDOM_ITER, class TYPE>
+    static TYPE reduce(RANDOM_ITER first, RANDOM_ITER last, TYPE init);
+    template <class RANDOM_ITER, class TYPE, class BINARY_OP>
+    static TYPE reduce(RANDOM_ITER         first,
+                       RANDOM_ITER         last,
+                       TYPE                init,
+                       BINARY_OP           operation,
+                       ParallelThreadPool *pool = 0);
+        // Return the result of combining the specified 'init' and the
+        // elements of the specified range '[first, last)', in order, using
+        // the optionally specified 'operation' (or '+' if 'operation' is not
+        // specified), in parallel using the optionally specified 'pool', or
+        // the default pool if 'pool' is 0.  The behavior is undefined unless
+        // 'operation' is associative.  Note that the elements of each chunk
+        // are combined starting from the first element of the chunk, so the
+        // value type of the range must be convertible to 'TYPE'.
+
+    template <class RANDOM_ITER, class TYPE, class REDUCE_OP,
+              class TRANSFORM_OP>
+    static TYPE transformReduce(RANDOM_ITER         first,
+                                RANDOM_ITER         last,
+                                TYPE                init,
+                                REDUCE_OP           reduceOperation,
+                                TRANSFORM_OP        transformOperation,
+                                ParallelThreadPool *pool = 0);
+        // Return the result of combining the specified 'init' and the
+        // results of invoking the specified 'transformOperation' on each
+        // element of the specified range '[first, last)', in order, using
+        // the specified 'reduceOperation', in parallel using the optionally
+        // specified 'pool', or the default pool if 'pool' is 0.  The
+        // behavior is undefined unless 'reduceOperation' is associative.
+
+    template <class INPUT_ITER, class OUTPUT_ITER, class BINARY_OP>
+    static OUTPUT_ITER inclusiveScan(INPUT_ITER          first,
+                                     INPUT_ITER          last,
+                                     OUTPUT_ITER         result,
+                                     BINARY_OP           operation,
+                                     ParallelThreadPool *pool = 0);
+        // Assign, to the element at each offset 'i' of the range starting at
+        // the specified 'result', the result of combining the elements at
+        // offsets '0 .. i' of the specified range '[first, last)' using the
+        // specified 'operation', in parallel using the optionally specified
+        // 'pool', or the default pool if 'pool' is 0, and return
+        // 'result + (last - first)'.  The behavior is undefined unless
+        // 'operation' is associative, 'OUTPUT_ITER' is a random-access
+        // iterator, and the output range either is the input range or does
+        // not overlap it.
+
+    template <class RANDOM_ITER>
+    static void sort(RANDOM_ITER         first,
+                     RANDOM_ITER         last,
+                     ParallelThreadPool *pool = 0);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort(RANDOM_ITER         first,
+                     RANDOM_ITER         last,
+                     COMPARATOR          comparator,
+                     ParallelThreadPool *pool = 0);
+        // Sort the specified range '[first, last)' into non-decreasing order
+        // according to the optionally specified 'comparator' (or 'operator<'
+        // if 'comparator' is not specified), in parallel using the optionally
+        // specified 'pool', or the default pool if 'pool' is 0.  Scratch
+        // space for 'last - first' elements is obtained from the default
+        // allocator.  The sort is not stable.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct ParallelUtil_ForEach
+                       // ----------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class FUNCTION>
+void ParallelUtil_ForEach<RANDOM_ITER, FUNCTION>::run(void *context,
+                                                      int   chunk)
+{
+    const ParallelUtil_ForEach& job =
+                                 *static_cast<ParallelUtil_ForEach *>(context);
+
+    const native_std::size_t begin = job.d_chunking.begin(chunk);
+    const native_std::size_t end   = job.d_chunking.begin(chunk + 1);
+
+    RANDOM_ITER it = job.d_first;
+    it += begin;
+    for (native_std::size_t i = begin; i < end; ++i, ++it) {
+        (*job.d_function_p)(*it);
+    }
+}
+
+                      // ------------------------------
+                      // struct ParallelUtil_Transform
+                      // ------------------------------
+
+// CLASS METHODS
+template <class INPUT_ITER, class OUTPUT_ITER, class FUNCTION>
+void ParallelUtil_Transform<INPUT_ITER, OUTPUT_ITER, FUNCTION>::run(
+                                                                 void *context,
+                                                                 int   chunk)
+{
+    const ParallelUtil_Transform& job =
+                               *static_cast<ParallelUtil_Transform *>(context);
+
+    const native_std::size_t begin = job.d_chunking.begin(chunk);
+    const native_std::size_t end   = job.d_chunking.begin(chunk + 1);
+
+    INPUT_ITER  in  = job.d_first;
+    OUTPUT_ITER out = job.d_result;
+    in  += begin;
+    out += begin;
+    for (native_std::size_t i = begin; i < end; ++i, ++in, ++out) {
+        *out = (*job.d_function_p)(*in);
+    }
+}
+
+                        // ---------------------------
+                        // struct ParallelUtil_Reduce
+                        // ---------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class TYPE, class REDUCE_OP, class TRANSFORM_OP>
+void ParallelUtil_Reduce<RANDOM_ITER, TYPE, REDUCE_OP, TRANSFORM_OP>::run(
+                                                                 void *context,
+                                                                 int   chunk)
+{
+    const ParallelUtil_Reduce& job =
+                                  *static_cast<ParallelUtil_Reduce *>(context);
+
+    const native_std::size_t begin = job.d_chunking.begin(chunk);
+    const native_std::size_t end   = job.d_chunking.begin(chunk + 1);
+
+    RANDOM_ITER it = job.d_first;
+    it += begin;
+
+    TYPE result((*job.d_transform_p)(*it));
+    ++it;
+    for (native_std::size_t i = begin + 1; i < end; ++i, ++it) {
+        result = (*job.d_reduce_p)(result, (*job.d_transform_p)(*it));
+    }
+    new (job.d_partials_p + chunk) TYPE(result);
+}
+
+                         // -------------------------
+                         // struct ParallelUtil_Scan
+                         // -------------------------
+
+// CLASS METHODS
+template <class INPUT_ITER, class OUTPUT_ITER, class TYPE, class BINARY_OP>
+void ParallelUtil_Scan<INPUT_ITER, OUTPUT_ITER, TYPE, BINARY_OP>::run(
+                                                                 void *context,
+                                                                 int   chunk)
+{
+    const ParallelUtil_Scan& job = *static_cast<ParallelUtil_Scan *>(context);
+
+    const native_std::size_t begin = job.d_chunking.begin(chunk);
+    const native_std::size_t end   = job.d_chunking.begin(chunk + 1);
+
+    INPUT_ITER  in  = job.d_first;
+    OUTPUT_ITER out = job.d_result;
+    in  += begin;
+    out += begin;
+
+    TYPE accumulator(0 == chunk
+                     ? TYPE(*in)
+                     : TYPE((*job.d_operation_p)(job.d_prefixes_p[chunk - 1],
+                                                 *in)));
+    *out = accumulator;
+    ++in;
+    ++out;
+    for (native_std::size_t i = begin + 1; i < end; ++i, ++in, ++out) {
+        accumulator = (*job.d_operation_p)(accumulator, *in);
+        *out = accumulator;
+    }
+}
+
+                       // ----------------------------
+                       // struct ParallelUtil_SortRuns
+                       // ----------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class TYPE, class COMPARATOR, class MOVER>
+void ParallelUtil_SortRuns<RANDOM_ITER, TYPE, COMPARATOR, MOVER>::run(
+                                                                 void *context,
+                                                                 int   chunk)
+{
+    const ParallelUtil_SortRuns& job =
+                                *static_cast<ParallelUtil_SortRuns *>(context);
+
+    const native_std::size_t begin = job.d_chunking.begin(chunk);
+    const native_std::size_t end   = job.d_chunking.begin(chunk + 1);
+
+    RANDOM_ITER first = job.d_first;
+    first += begin;
+    RANDOM_ITER last = first;
+    last += end - begin;
+
+    SortUtil::sort(first, last, *job.d_comparator_p);
+
+    if (job.d_toScratch) {
+        MOVER::moveBlock(job.d_scratch_p + begin, first, end - begin);
+    }
+}
+
+                      // ------------------------------
+                      // struct ParallelUtil_MergeRuns
+                      // ------------------------------
+
+// CLASS METHODS
+template <class SRC_ITER, class DST_ITER, class COMPARATOR, class MOVER>
+void ParallelUtil_MergeRuns<SRC_ITER, DST_ITER, COMPARATOR, MOVER>::run(
+                                                                 void *context,
+                                                                 int   task)
+{
+    const ParallelUtil_MergeRuns& job =
+                               *static_cast<ParallelUtil_MergeRuns *>(context);
+
+    const int merge = task / job.d_tasksPerMerge;
+    const int piece = task % job.d_tasksPerMerge;
+
+    const native_std::size_t aBegin = job.d_bounds_p[2 * merge];
+    const native_std::size_t aEnd   = 2 * merge + 1 < job.d_numRuns
+                                      ? job.d_bounds_p[2 * merge + 1]
+                                      : job.d_bounds_p[job.d_numRuns];
+    const native_std::size_t bEnd   = 2 * merge + 1 < job.d_numRuns
+                                      ? job.d_bounds_p[2 * merge + 2]
+                                      : aEnd;
+
+    const native_std::size_t aLength = aEnd - aBegin;
+    const native_std::size_t bLength = bEnd - aEnd;
+
+    SRC_ITER a = job.d_source;
+    a += aBegin;
+    SRC_ITER b = job.d_source;
+    b += aEnd;
+    DST_ITER out = job.d_destination;
+    out += aBegin;
+
+    // Divide the output of the merge into 'd_tasksPerMerge' pieces, and find,
+    // by binary search, the number of elements of the first run that precede
+    // the start and the end of this task's piece ("merge path").  Elements of
+    // the first run precede equal elements of the second.
+
+    ParallelUtil_Chunking pieces;
+    pieces.d_length    = aLength + bLength;
+    pieces.d_numChunks = job.d_tasksPerMerge;
+
+    native_std::size_t aSplit[2];
+    for (int k = 0; k < 2; ++k) {
+        const native_std::size_t diagonal = pieces.begin(piece + k);
+
+        native_std::size_t low  = diagonal > bLength ? diagonal - bLength : 0;
+        native_std::size_t high = diagonal < aLength ? diagonal : aLength;
+        while (low < high) {
+            const native_std::size_t middle = low + (high - low) / 2;
+            if (!(*job.d_comparator_p)(b[diagonal - middle - 1], a[middle])) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+        aSplit[k] = low;
+    }
+
+    const native_std::size_t outBegin = pieces.begin(piece);
+    native_std::size_t       i        = aSplit[0];
+    native_std::size_t       j        = outBegin - aSplit[0];
+    const native_std::size_t iEnd     = aSplit[1];
+    const native_std::size_t jEnd     = pieces.begin(piece + 1) - aSplit[1];
+
+    out += outBegin;
+    while (i < iEnd && j < jEnd) {
+        if ((*job.d_comparator_p)(b[j], a[i])) {
+            MOVER::move(out, b + j);
+            ++j;
+        }
+        else {
+            MOVER::move(out, a + i);
+            ++i;
+        }
+        ++out;
+    }
+    if (i < iEnd) {
+        MOVER::moveBlock(out, a + i, iEnd - i);
+    }
+    else if (j < jEnd) {
+        MOVER::moveBlock(out, b + j, jEnd - j);
+    }
+}
+
+                           // -------------------
+                           // struct ParallelUtil
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+inline
+ParallelThreadPool *ParallelUtil::choosePool(ParallelThreadPool *pool)
+{
+    return pool ? pool : defaultPool();
+}
+
+inline
+int ParallelUtil::numChunks(native_std::size_t  length,
+                            ParallelThreadPool *pool)
+{
+    const int numThreads = pool->numThreads();
+    if (1 == numThreads
+     || length < static_cast<native_std::size_t>(k_SEQUENTIAL_THRESHOLD)) {
+        return 1;                                                     // RETURN
+    }
+
+    const native_std::size_t maxChunks = length / k_MIN_CHUNK_SIZE;
+    const native_std::size_t chunks    = k_CHUNKS_PER_THREAD * numThreads;
+    return static_cast<int>(chunks < maxChunks ? chunks : maxChunks);
+}
+
+template <class SRC_ITER, class DST_ITER, class COMPARATOR, class MOVER>
+void ParallelUtil::mergeRound(SRC_ITER                  source,
+                              DST_ITER                  destination,
+                              const native_std::size_t *bounds,
+                              int                       numRuns,
+                              int                       numTasks,
+                              COMPARATOR               *comparator,
+                              ParallelThreadPool        *pool)
+{
+    const int numMerges     = (numRuns + 1) / 2;
+    const int tasksPerMerge = numTasks > numMerges ? numTasks / numMerges : 1;
+
+    ParallelUtil_MergeRuns<SRC_ITER, DST_ITER, COMPARATOR, MOVER> job;
+    job.d_source        = source;
+    job.d_destination   = destination;
+    job.d_bounds_p      = bounds;
+    job.d_numRuns       = numRuns;
+    job.d_tasksPerMerge = tasksPerMerge;
+    job.d_comparator_p  = comparator;
+
+    pool->execute(&job.run, &job, numMerges * tasksPerMerge);
+}
+
+template <class RANDOM_ITER, class TYPE, class COMPARATOR, class MOVER>
+void ParallelUtil::mergeSort(RANDOM_ITER                  first,
+                             TYPE                        *scratch,
+                             const ParallelUtil_Chunking& chunking,
+                             COMPARATOR                  *comparator,
+                             ParallelThreadPool          *pool)
+{
+    enum { k_MAX_RUNS = 1024 };
+
+    const int numTasks  = chunking.d_numChunks;
+    int       numRuns   = numTasks < k_MAX_RUNS
+                          ? numTasks
+                          : static_cast<int>(k_MAX_RUNS);
+    int       numRounds = 0;
+    while ((1 << numRounds) < numRuns) {
+        ++numRounds;
+    }
+
+    ParallelUtil_Chunking runs = chunking;
+    runs.d_numChunks = numRuns;
+
+    native_std::size_t bounds[k_MAX_RUNS + 1];
+    for (int i = 0; i <= numRuns; ++i) {
+        bounds[i] = runs.begin(i);
+    }
+
+    // Sort the runs, placing them in the scratch buffer if the number of
+    // merge rounds is odd, so that the last round writes to the range.
+
+    bool inScratch = 1 == numRounds % 2;
+    {
+        ParallelUtil_SortRuns<RANDOM_ITER, TYPE, COMPARATOR, MOVER> job;
+        job.d_first        = first;
+        job.d_scratch_p    = scratch;
+        job.d_chunking     = runs;
+        job.d_toScratch    = inScratch;
+        job.d_comparator_p = comparator;
+
+        pool->execute(&job.run, &job, numRuns);
+    }
+
+    while (1 < numRuns) {
+        if (inScratch) {
+            mergeRound<TYPE *, RANDOM_ITER, COMPARATOR, MOVER>(scratch,
+                                                               first,
+                                                               bounds,
+                                                               numRuns,
+                                                               numTasks,
+                                                               comparator,
+                                                               pool);
+        }
+        else {
+            mergeRound<RANDOM_ITER, TYPE *, COMPARATOR, MOVER>(first,
+                                                               scratch,
+                                                               bounds,
+                                                               numRuns,
+                                                               numTasks,
+                                                               comparator,
+                                                               pool);
+        }
+        inScratch = !inScratch;
+
+        const int numMerged = (numRuns + 1) / 2;
+        for (int i = 1; i < numMerged; ++i) {
+            bounds[i] = bounds[2 * i];
+        }
+        bounds[numMerged] = bounds[numRuns];
+        numRuns = numMerged;
+    }
+}
+
+template <class TYPE, class COMPARATOR>
+void ParallelUtil::sortImp(TYPE               *first,
+                           TYPE               *last,
+                           COMPARATOR         *comparator,
+                           ParallelThreadPool *pool,
+                           bslmf::MetaInt<1>  *)
+{
+    ParallelUtil_Chunking chunking;
+    chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    chunking.d_numChunks = numChunks(chunking.d_length, pool);
+
+    if (1 == chunking.d_numChunks) {
+        SortUtil::sort(first, last, *comparator);
+        return;                                                       // RETURN
+    }
+
+    // The scratch buffer holds the bytes of elements relocated from the
+    // range, and is never initialized or destroyed.
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    TYPE *scratch = static_cast<TYPE *>(
+                        allocator->allocate(chunking.d_length * sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(scratch,
+                                                            allocator);
+
+    mergeSort<TYPE *, TYPE, COMPARATOR, ParallelUtil_BitwiseMover>(first,
+                                                                   scratch,
+                                                                   chunking,
+                                                                   comparator,
+                                                                   pool);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void ParallelUtil::sortImp(RANDOM_ITER         first,
+                           RANDOM_ITER         last,
+                           COMPARATOR         *comparator,
+                           ParallelThreadPool *pool,
+                           bslmf::MetaInt<0>  *)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    ParallelUtil_Chunking chunking;
+    chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    chunking.d_numChunks = numChunks(chunking.d_length, pool);
+
+    if (1 == chunking.d_numChunks) {
+        SortUtil::sort(first, last, *comparator);
+        return;                                                       // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    ValueType *scratch = static_cast<ValueType *>(
+                   allocator->allocate(chunking.d_length * sizeof(ValueType)));
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(scratch,
+                                                            allocator);
+
+    ArrayPrimitives::copyConstruct(scratch, first, last, allocator);
+    AutoArrayDestructor<ValueType> destructor(scratch,
+                                              scratch + chunking.d_length);
+
+    mergeSort<RANDOM_ITER, ValueType, COMPARATOR, ParallelUtil_AssignMover>(
+                                                                   first,
+                                                                   scratch,
+                                                                   chunking,
+                                                                   comparator,
+                                                                   pool);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void ParallelUtil::sortDispatch(RANDOM_ITER         first,
+                                RANDOM_ITER         last,
+                                COMPARATOR         *comparator,
+                                ParallelThreadPool *pool)
+{
+    sortImp(first, last, comparator, pool, (bslmf::MetaInt<0> *)0);
+}
+
+template <class TYPE, class COMPARATOR>
+inline
+void ParallelUtil::sortDispatch(TYPE               *first,
+                                TYPE               *last,
+                                COMPARATOR         *comparator,
+                                ParallelThreadPool *pool)
+{
+    enum { k_IS_BITWISE = bslmf::IsBitwiseMoveable<TYPE>::value };
+
+    sortImp(first, last, comparator, pool, (bslmf::MetaInt<k_IS_BITWISE> *)0);
+}
+
+// CLASS METHODS
+template <class RANDOM_ITER, class FUNCTION>
+void ParallelUtil::forEach(RANDOM_ITER         first,
+                           RANDOM_ITER         last,
+                           FUNCTION            function,
+                           ParallelThreadPool *pool)
+{
+    ParallelUtil_ForEach<RANDOM_ITER, FUNCTION> job;
+    job.d_first                = first;
+    job.d_chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    job.d_chunking.d_numChunks = numChunks(job.d_chunking.d_length,
+                                           choosePool(pool));
+    job.d_function_p           = &function;
+
+    if (1 == job.d_chunking.d_numChunks) {
+        for (; first != last; ++first) {
+            function(*first);
+        }
+        return;                                                       // RETURN
+    }
+
+    choosePool(pool)->execute(&job.run, &job, job.d_chunking.d_numChunks);
+}
+
+template <class INPUT_ITER, class OUTPUT_ITER, class FUNCTION>
+OUTPUT_ITER ParallelUtil::transform(INPUT_ITER          first,
+                                    INPUT_ITER          last,
+                                    OUTPUT_ITER         result,
+                                    FUNCTION            function,
+                                    ParallelThreadPool *pool)
+{
+    ParallelUtil_Transform<INPUT_ITER, OUTPUT_ITER, FUNCTION> job;
+    job.d_first                = first;
+    job.d_result               = result;
+    job.d_chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    job.d_chunking.d_numChunks = numChunks(job.d_chunking.d_length,
+                                           choosePool(pool));
+    job.d_function_p           = &function;
+
+    if (1 == job.d_chunking.d_numChunks) {
+        for (; first != last; ++first, ++result) {
+            *result = function(*first);
+        }
+        return result;                                                // RETURN
+    }
+
+    choosePool(pool)->execute(&job.run, &job, job.d_chunking.d_numChunks);
+
+    result += job.d_chunking.d_length;
+    return result;
+}
+
+template <class RANDOM_ITER, class TYPE>
+inline
+TYPE ParallelUtil::reduce(RANDOM_ITER first, RANDOM_ITER last, TYPE init)
+{
+    return reduce(first, last, init, ParallelUtil_Plus());
+}
+
+template <class RANDOM_ITER, class TYPE, class BINARY_OP>
+inline
+TYPE ParallelUtil::reduce(RANDOM_ITER         first,
+                          RANDOM_ITER         last,
+                          TYPE                init,
+                          BINARY_OP           operation,
+                          ParallelThreadPool *pool)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    return transformReduce(first,
+                           last,
+                           init,
+                           operation,
+                           ParallelUtil_Identity<ValueType>(),
+                           pool);
+}
+
+template <class RANDOM_ITER, class TYPE, class REDUCE_OP, class TRANSFORM_OP>
+TYPE ParallelUtil::transformReduce(RANDOM_ITER         first,
+                                   RANDOM_ITER         last,
+                                   TYPE                init,
+                                   REDUCE_OP           reduceOperation,
+                                   TRANSFORM_OP        transformOperation,
+                                   ParallelThreadPool *pool)
+{
+    ParallelUtil_Reduce<RANDOM_ITER, TYPE, REDUCE_OP, TRANSFORM_OP> job;
+    job.d_first                = first;
+    job.d_chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    job.d_chunking.d_numChunks = numChunks(job.d_chunking.d_length,
+                                           choosePool(pool));
+    job.d_reduce_p             = &reduceOperation;
+    job.d_transform_p          = &transformOperation;
+
+    if (1 == job.d_chunking.d_numChunks) {
+        for (; first != last; ++first) {
+            init = reduceOperation(init, transformOperation(*first));
+        }
+        return init;                                                  // RETURN
+    }
+
+    const int         numChunks = job.d_chunking.d_numChunks;
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    job.d_partials_p = static_cast<TYPE *>(
+                                allocator->allocate(numChunks * sizeof(TYPE)));
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(job.d_partials_p,
+                                                            allocator);
+
+    choosePool(pool)->execute(&job.run, &job, numChunks);
+
+    AutoArrayDestructor<TYPE> destructor(job.d_partials_p,
+                                         job.d_partials_p + numChunks);
+    for (int i = 0; i < numChunks; ++i) {
+        init = reduceOperation(init, job.d_partials_p[i]);
+    }
+    return init;
+}
+
+template <class INPUT_ITER, class OUTPUT_ITER, class BINARY_OP>
+OUTPUT_ITER ParallelUtil::inclusiveScan(INPUT_ITER          first,
+                                        INPUT_ITER          last,
+                                        OUTPUT_ITER         result,
+                                        BINARY_OP           operation,
+                                        ParallelThreadPool *pool)
+{
+    typedef typename native_std::iterator_traits<INPUT_ITER>::value_type
+                                                                    ValueType;
+
+    ParallelUtil_Scan<INPUT_ITER, OUTPUT_ITER, ValueType, BINARY_OP> job;
+    job.d_first                = first;
+    job.d_result               = result;
+    job.d_chunking.d_length    = static_cast<native_std::size_t>(last - first);
+    job.d_chunking.d_numChunks = numChunks(job.d_chunking.d_length,
+                                           choosePool(pool));
+    job.d_operation_p          = &operation;
+
+    if (1 == job.d_chunking.d_numChunks) {
+        if (first != last) {
+            ValueType accumulator(*first);
+            *result = accumulator;
+            for (++first, ++result; first != last; ++first, ++result) {
+                accumulator = operation(accumulator, *first);
+                *result = accumulator;
+            }
+        }
+        return result;                                                // RETURN
+    }
+
+    // Reduce every chunk but the last, and combine the results into the
+    // prefix preceding each chunk but the first.
+
+    const int numPrefixes = job.d_chunking.d_numChunks - 1;
+
+    ParallelUtil_Reduce<INPUT_ITER,
+                        ValueType,
+                        BINARY_OP,
+                        ParallelUtil_Identity<ValueType> > reduceJob;
+    ParallelUtil_Identity<ValueType>                       identity;
+
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    reduceJob.d_first                = first;
+    reduceJob.d_chunking             = job.d_chunking;
+    reduceJob.d_partials_p           = static_cast<ValueType *>(
+                        allocator->allocate(numPrefixes * sizeof(ValueType)));
+    reduceJob.d_reduce_p             = &operation;
+    reduceJob.d_transform_p          = &identity;
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(
+                                                        reduceJob.d_partials_p,
+                                                        allocator);
+
+    choosePool(pool)->execute(&reduceJob.run, &reduceJob, numPrefixes);
+
+    ValueType *prefixes = reduceJob.d_partials_p;
+    AutoArrayDestructor<ValueType> destructor(prefixes,
+                                              prefixes + numPrefixes);
+    for (int i = 1; i < numPrefixes; ++i) {
+        prefixes[i] = operation(prefixes[i - 1], prefixes[i]);
+    }
+
+    job.d_prefixes_p = prefixes;
+    choosePool(pool)->execute(&job.run, &job, job.d_chunking.d_numChunks);
+
+    result += job.d_chunking.d_length;
+    return result;
+}
+
+template <class RANDOM_ITER>
+inline
+void ParallelUtil::sort(RANDOM_ITER         first,
+                        RANDOM_ITER         last,
+                        ParallelThreadPool *pool)
+{
+    SortUtil_Less comparator;
+    sortDispatch(first, last, &comparator, choosePool(pool));
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void ParallelUtil::sort(RANDOM_ITER         first,
+                        RANDOM_ITER         last,
+                        COMPARATOR          comparator,
+                        ParallelThreadPool *pool)
+{
+    sortDispatch(first, last, &comparator, choosePool(pool));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1195 @@
+// bslalg_parallelutil.t.cpp                                          -*-C++-*-
+
+#include <bslalg_parallelutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // native_std::sort
+#include <deque>
+#include <functional>   // native_std::greater
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>    // SwitchToThread()
+#else
+#include <sched.h>      // sched_yield()
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a thread pool and algorithms that use it
+// to process ranges in parallel.  We first verify that the pool runs every
+// task of a job exactly once, using several threads concurrently, and that
+// jobs started while the pool is busy run sequentially without deadlock.  We
+// then verify each algorithm against a sequential computation, for ranges of
+// lengths around the sequential threshold and the chunk size, pools of
+// several sizes, and the default pool; operations that are associative but
+// not commutative verify that the results of chunks are combined in order.
+// For 'sort', we additionally verify that bitwise-moveable elements are
+// relocated by copying their bytes, that other elements are copied, and that
+// scratch memory is obtained from the default allocator and released.  A
+// performance test (negative case) measures the scaling of each algorithm
+// with the number of threads.
+//-----------------------------------------------------------------------------
+// ParallelThreadPool
+// [ 2] static int numProcessors();
+// [ 2] explicit ParallelThreadPool(int numThreads, Allocator *ba = 0);
+// [ 2] ~ParallelThreadPool();
+// [ 2] void execute(Job job, void *context, int numTasks);
+// [ 2] int numThreads() const;
+//
+// ParallelUtil
+// [ 2] static ParallelThreadPool *defaultPool();
+// [ 3] static void forEach(RANDOM_ITER, RANDOM_ITER, FUNCTION, *pool);
+// [ 3] static OUT_ITER transform(IN_ITER, IN_ITER, OUT_ITER, FUNC, *);
+// [ 4] static TYPE reduce(RANDOM_ITER, RANDOM_ITER, TYPE init);
+// [ 4] static TYPE reduce(ITER, ITER, TYPE, BINARY_OP, *pool);
+// [ 4] static TYPE transformReduce(ITER, ITER, TYPE, RED, TRANS, *pool);
+// [ 5] static OUT_ITER inclusiveScan(IN, IN, OUT_ITER, BINARY_OP, *pool);
+// [ 6] static void sort(RANDOM_ITER first, RANDOM_ITER last, *pool);
+// [ 6] static void sort(RANDOM_ITER, RANDOM_ITER, COMPARATOR, *pool);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::ParallelUtil       Obj;
+typedef bslalg::ParallelThreadPool Pool;
+typedef bsls::Types::Int64         Int64;
+typedef bsls::Types::Uint64        Uint64;
+
+static const int NUM_THREADS[] = { 1, 2, 3, 8 };
+const int        NUM_POOLS     = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+static const int LENGTHS[] = {
+    0,
+    1,
+    1000,
+    Obj::k_SEQUENTIAL_THRESHOLD - 1,
+    Obj::k_SEQUENTIAL_THRESHOLD,
+    Obj::k_SEQUENTIAL_THRESHOLD + 1,
+    3 * Obj::k_MIN_CHUNK_SIZE + 7,
+    100000
+};
+const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+static Uint64 nextRandom(Uint64 *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // a pseudo-random value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+static void yield()
+    // Yield the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+                              // ==============
+                              // struct CountJob
+                              // ==============
+
+struct CountJob {
+    // This 'struct' describes a job that counts the invocations of each task.
+
+    bsls::AtomicInt *d_counts_p;  // count for each task
+
+    static void run(void *context, int task)
+    {
+        static_cast<CountJob *>(context)->d_counts_p[task].add(1);
+    }
+};
+
+                           // ===================
+                           // struct RendezvousJob
+                           // ===================
+
+struct RendezvousJob {
+    // This 'struct' describes a job of two tasks, each of which waits (for at
+    // most 10 seconds) until the other has started, and so can complete
+    // promptly only if the tasks run concurrently.
+
+    bsls::AtomicInt d_started;   // number of tasks started
+    bsls::AtomicInt d_timedOut;  // set if a task waited too long
+
+    static void run(void *context, int)
+    {
+        RendezvousJob *job = static_cast<RendezvousJob *>(context);
+
+        job->d_started.add(1);
+
+        const Int64 deadline = bsls::TimeUtil::getTimer() + 10000000000LL;
+        while (2 != job->d_started.load()) {
+            if (bsls::TimeUtil::getTimer() > deadline) {
+                job->d_timedOut.storeRelaxed(1);
+                return;                                               // RETURN
+            }
+            yield();
+        }
+    }
+};
+
+                             // ===============
+                             // struct NestedJob
+                             // ===============
+
+struct NestedJob {
+    // This 'struct' describes a job each of whose tasks executes a
+    // 'CountJob' on the same pool.
+
+    Pool     *d_pool_p;  // pool executing this job
+    CountJob  d_inner;   // job executed by each task
+    int       d_numInnerTasks;
+
+    static void run(void *context, int)
+    {
+        NestedJob *job = static_cast<NestedJob *>(context);
+        job->d_pool_p->execute(&CountJob::run,
+                               &job->d_inner,
+                               job->d_numInnerTasks);
+    }
+};
+
+                                // ==========
+                                // struct Mat
+                                // ==========
+
+struct Mat {
+    // This 'struct' provides a 2x2 matrix of integers modulo '2^32', whose
+    // multiplication is associative but not commutative.
+
+    unsigned int d_a, d_b, d_c, d_d;
+
+    static Mat make(unsigned int seed)
+        // Return a matrix derived from the specified 'seed'.
+    {
+        Mat result = { seed, seed ^ 0x55u, seed * 3 + 1, 1u };
+        return result;
+    }
+};
+
+bool operator==(const Mat& lhs, const Mat& rhs)
+{
+    return lhs.d_a == rhs.d_a && lhs.d_b == rhs.d_b
+        && lhs.d_c == rhs.d_c && lhs.d_d == rhs.d_d;
+}
+
+struct Multiply {
+    // This 'struct' provides a function multiplying two matrices.
+
+    Mat operator()(const Mat& lhs, const Mat& rhs) const
+    {
+        Mat result = { lhs.d_a * rhs.d_a + lhs.d_b * rhs.d_c,
+                       lhs.d_a * rhs.d_b + lhs.d_b * rhs.d_d,
+                       lhs.d_c * rhs.d_a + lhs.d_d * rhs.d_c,
+                       lhs.d_c * rhs.d_b + lhs.d_d * rhs.d_d };
+        return result;
+    }
+};
+
+struct Increment {
+    // This 'struct' provides a function incrementing an integer.
+
+    void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+struct Square {
+    // This 'struct' provides a function returning the square of an integer.
+
+    Int64 operator()(int value) const
+    {
+        return static_cast<Int64>(value) * value;
+    }
+};
+
+struct Plus {
+    // This 'struct' provides a function adding two integers.
+
+    template <class LHS_TYPE, class RHS_TYPE>
+    LHS_TYPE operator()(const LHS_TYPE& lhs, const RHS_TYPE& rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+                                // ===========
+                                // struct Item
+                                // ===========
+
+template <bool IS_BITWISE>
+struct Item {
+    // This 'struct' template provides a sortable element that records the
+    // address at which it was last constructed or assigned, so that
+    // elements relocated by copying their bytes can be detected.
+
+    int         d_key;
+    const Item *d_self_p;
+
+    explicit Item(int key = 0) : d_key(key), d_self_p(this) {}
+
+    Item(const Item& original) : d_key(original.d_key), d_self_p(this) {}
+
+    Item& operator=(const Item& rhs)
+    {
+        d_key    = rhs.d_key;
+        d_self_p = this;
+        return *this;
+    }
+
+    bool operator<(const Item& rhs) const
+    {
+        return d_key < rhs.d_key;
+    }
+};
+
+namespace BloombergLP {
+namespace bslmf {
+
+template <>
+struct IsBitwiseMoveable<Item<true> > : bsl::true_type {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <bool IS_BITWISE>
+void testItems(Pool *pool, int *numRelocated)
+    // Sort a large array of 'Item<IS_BITWISE>' objects using the specified
+    // 'pool', verify the result, and load into the specified 'numRelocated'
+    // the number of elements that were relocated by copying their bytes.
+{
+    enum { k_LENGTH = 50000 };
+
+    native_std::vector<Item<IS_BITWISE> > items;
+    items.reserve(k_LENGTH);
+
+    Uint64 state = 17;
+    for (int i = 0; i < k_LENGTH; ++i) {
+        items.push_back(Item<IS_BITWISE>(
+                               static_cast<int>(nextRandom(&state) % 1000)));
+    }
+
+    Obj::sort(&items[0], &items[0] + k_LENGTH, pool);
+
+    *numRelocated = 0;
+    for (int i = 0; i < k_LENGTH; ++i) {
+        if (i) {
+            LOOP_ASSERT(i, !(items[i] < items[i - 1]));
+        }
+        if (items[i].d_self_p != &items[i]) {
+            ++*numRelocated;
+        }
+    }
+}
+
+template <class TYPE>
+bool equalRanges(const native_std::vector<TYPE>& lhs,
+                 const native_std::vector<TYPE>& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' hold equal elements, and
+    // 'false' otherwise.
+{
+    return lhs.size() == rhs.size()
+        && native_std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+static double elapsedNs(const bsls::Stopwatch& timer, int length)
+    // Return the time elapsed on the specified 'timer', in nanoseconds per
+    // element of a range of the specified 'length'.
+{
+    return timer.elapsedTime() * 1e9 / length;
+}
+
+                           // ==================
+                           // struct IncrementBy
+                           // ==================
+
+struct Affine {
+    // This 'struct' provides a function applying an affine transformation to
+    // an integer in place, as a benchmark workload.
+
+    void operator()(int& value) const
+    {
+        value = value * 3 + 1;
+    }
+};
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Processing Large Arrays of Prices
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a large array of prices, on which we wish to perform
+// several computations using all available processors.
+//
+// We define a function object that applies a discount to a price:
+//..
+struct Discount {
+    double d_rate;
+
+    void operator()(double& price) const
+    {
+        price *= 1 - d_rate;
+    }
+};
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// First, we create the array of prices:
+//..
+        enum { k_NUM_PRICES = 1000000 };
+
+        static double prices[k_NUM_PRICES];
+        for (int i = 0; i < k_NUM_PRICES; ++i) {
+            prices[i] = 100.0 + i % 997 / 100.0;
+        }
+//..
+// Next, we apply a discount to every price, in parallel, using the default
+// pool:
+//..
+        Discount discount = { 0.5 };
+        bslalg::ParallelUtil::forEach(prices, prices + k_NUM_PRICES, discount);
+
+        ASSERT(50.0 == prices[0]);
+//..
+// Then, we compute the sum of the discounted prices.  Because the sum is
+// computed in chunks, it may differ slightly from a sequential sum:
+//..
+        double total = bslalg::ParallelUtil::reduce(prices,
+                                                    prices + k_NUM_PRICES,
+                                                    0.0);
+
+        ASSERT(total > 50.0 * k_NUM_PRICES);
+        ASSERT(total < 55.0 * k_NUM_PRICES);
+//..
+// Finally, we sort the prices, explicitly supplying a pool having four
+// threads:
+//..
+        bslalg::ParallelThreadPool pool(4);
+
+        bslalg::ParallelUtil::sort(prices, prices + k_NUM_PRICES, &pool);
+
+        ASSERT(50.0  == prices[0]);
+        ASSERT(54.9  <  prices[k_NUM_PRICES - 1]);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'sort'
+        //
+        // Concerns:
+        //: 1 Ranges of every length are sorted, for pools of any size, and
+        //:   for the default pool.
+        //:
+        //: 2 A supplied comparator is used, and 'operator<' otherwise.
+        //:
+        //: 3 Ranges specified by iterators other than pointers are sorted.
+        //:
+        //: 4 Elements of bitwise-moveable types specified by pointers are
+        //:   relocated by copying their bytes; other elements are copied.
+        //:
+        //: 5 Scratch memory is obtained from the default allocator, only for
+        //:   ranges processed in parallel, and released.
+        //
+        // Plan:
+        //: 1 Sort vectors of pseudo-random, sorted, reversed, and equal
+        //:   integers having each length, using each pool, with and without
+        //:   a comparator, and compare with the result of 'native_std::sort'.
+        //:   (C-1..2)
+        //:
+        //: 2 Sort deques and vectors of strings.  (C-3)
+        //:
+        //: 3 Sort arrays of elements recording their own address, with and
+        //:   without the bitwise-moveable trait, and count the elements whose
+        //:   recorded address differs from their actual address.  (C-4)
+        //:
+        //: 4 Install a test allocator as the default allocator, and check its
+        //:   statistics.  (C-5)
+        //
+        // Testing:
+        //   static void sort(RANDOM_ITER first, RANDOM_ITER last, *pool);
+        //   static void sort(RANDOM_ITER, RANDOM_ITER, COMPARATOR, *pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'sort'"
+                            "\n==============\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::TestAllocator         pa("pool",    veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        Uint64 state = 19;
+
+        for (int pi = 0; pi <= NUM_POOLS; ++pi) {
+            Pool  pool(pi < NUM_POOLS ? NUM_THREADS[pi] : 1, &pa);
+            Pool *POOL = pi < NUM_POOLS ? &pool : 0;
+
+            if (veryVerbose) { T_ P(pool.numThreads()) }
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                for (int pattern = 0; pattern < 4; ++pattern) {
+                    native_std::vector<int> mX(LENGTH);
+                    for (int i = 0; i < LENGTH; ++i) {
+                        mX[i] = 0 == pattern
+                              ? static_cast<int>(nextRandom(&state))
+                              : 1 == pattern ? i
+                              : 2 == pattern ? LENGTH - i
+                              : 7;
+                    }
+                    native_std::vector<int> mY(mX);
+                    native_std::vector<int> expected(mX);
+
+                    native_std::sort(expected.begin(), expected.end());
+                    const Int64 BLOCKS = da.numBlocksTotal();
+                    Obj::sort(mX.begin(), mX.end(), POOL);
+                    LOOP3_ASSERT(pi, LENGTH, pattern, expected == mX);
+                    LOOP3_ASSERT(pi, LENGTH, pattern,
+                                 LENGTH >= Obj::k_SEQUENTIAL_THRESHOLD
+                              || BLOCKS == da.numBlocksTotal());
+                    LOOP3_ASSERT(pi, LENGTH, pattern,
+                                 0 == da.numBlocksInUse());
+
+                    native_std::sort(expected.begin(),
+                                     expected.end(),
+                                     native_std::greater<int>());
+                    Obj::sort(mY.begin(),
+                              mY.end(),
+                              native_std::greater<int>(),
+                              POOL);
+                    LOOP3_ASSERT(pi, LENGTH, pattern, expected == mY);
+                }
+            }
+
+            if (veryVerbose) printf("\tDeques and strings.\n");
+            {
+                const int LENGTH = 3 * Obj::k_MIN_CHUNK_SIZE + 5;
+
+                native_std::deque<int>          mX;
+                native_std::vector<native_std::string> mS;
+                for (int i = 0; i < LENGTH; ++i) {
+                    const int value = static_cast<int>(nextRandom(&state));
+                    mX.push_back(value);
+
+                    char buffer[32];
+                    sprintf(buffer, "%011d", value);
+                    mS.push_back(buffer);
+                }
+                native_std::deque<int>                 expected(mX);
+                native_std::vector<native_std::string> expectedS(mS);
+                native_std::sort(expected.begin(), expected.end());
+                native_std::sort(expectedS.begin(), expectedS.end());
+
+                Obj::sort(mX.begin(), mX.end(), POOL);
+                Obj::sort(mS.begin(), mS.end(), POOL);
+
+                LOOP_ASSERT(pi, expected == mX);
+                LOOP_ASSERT(pi, expectedS == mS);
+                LOOP_ASSERT(pi, 0 == da.numBlocksInUse());
+            }
+        }
+
+        if (veryVerbose) printf("Relocation of bitwise-moveable elements.\n");
+        {
+            ASSERT( bslmf::IsBitwiseMoveable<Item<true> >::value);
+            ASSERT(!bslmf::IsBitwiseMoveable<Item<false> >::value);
+
+            Pool pool(4, &pa);
+
+            int numRelocated;
+
+            testItems<true>(&pool, &numRelocated);
+            if (veryVerbose) { T_ P(numRelocated) }
+            ASSERT(0 < numRelocated);
+
+            testItems<false>(&pool, &numRelocated);
+            if (veryVerbose) { T_ P(numRelocated) }
+            ASSERT(0 == numRelocated);
+
+            ASSERT(0 == da.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'inclusiveScan'
+        //
+        // Concerns:
+        //: 1 Each output element combines the input elements up to and
+        //:   including its position, in order, for ranges of every length and
+        //:   pools of any size.
+        //:
+        //: 2 The scan may be performed in place.
+        //:
+        //: 3 The returned iterator refers to the end of the output range.
+        //:
+        //: 4 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Scan integers by addition, and matrices by multiplication, which
+        //:   is not commutative, and compare with a sequential scan.
+        //:   (C-1, 3)
+        //:
+        //: 2 Scan a range in place.  (C-2)
+        //:
+        //: 3 Install a test allocator as the default allocator.  (C-4)
+        //
+        // Testing:
+        //   static OUT_ITER inclusiveScan(IN, IN, OUT_ITER, BINARY_OP, *pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'inclusiveScan'"
+                            "\n=======================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::TestAllocator         pa("pool",    veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (int pi = 0; pi < NUM_POOLS; ++pi) {
+            Pool pool(NUM_THREADS[pi], &pa);
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                if (veryVerbose) { T_ P_(pool.numThreads()) P(LENGTH) }
+
+                native_std::vector<Int64> input(LENGTH);
+                native_std::vector<Mat>   matrices(LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    input[i]    = i % 17 - 5;
+                    matrices[i] = Mat::make(i);
+                }
+
+                native_std::vector<Int64> expected(LENGTH);
+                native_std::vector<Mat>   expectedM(LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    expected[i]  = i ? expected[i - 1] + input[i] : input[i];
+                    expectedM[i] = i
+                                   ? Multiply()(expectedM[i - 1], matrices[i])
+                                   : matrices[i];
+                }
+
+                native_std::vector<Int64> output(LENGTH);
+                native_std::vector<Int64>::iterator end =
+                                         Obj::inclusiveScan(input.begin(),
+                                                            input.end(),
+                                                            output.begin(),
+                                                            Plus(),
+                                                            &pool);
+                LOOP2_ASSERT(pi, LENGTH, output.end() == end);
+                LOOP2_ASSERT(pi, LENGTH, equalRanges(expected, output));
+
+                Obj::inclusiveScan(input.begin(),
+                                   input.end(),
+                                   input.begin(),
+                                   Plus(),
+                                   &pool);
+                LOOP2_ASSERT(pi, LENGTH, equalRanges(expected, input));
+
+                native_std::vector<Mat> outputM(LENGTH);
+                Obj::inclusiveScan(matrices.begin(),
+                                   matrices.end(),
+                                   outputM.begin(),
+                                   Multiply(),
+                                   &pool);
+                LOOP2_ASSERT(pi, LENGTH, equalRanges(expectedM, outputM));
+                LOOP2_ASSERT(pi, LENGTH, 0 == da.numBlocksInUse());
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'reduce' AND 'transformReduce'
+        //
+        // Concerns:
+        //: 1 The result combines the initial value and every (transformed)
+        //:   element, in order, for ranges of every length and pools of any
+        //:   size, and for the default pool.
+        //:
+        //: 2 'reduce' uses '+' if no operation is supplied.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Sum integers and the squares of integers, and multiply matrices,
+        //:   which is not commutative, and compare with sequential results.
+        //:   (C-1..2)
+        //:
+        //: 2 Install a test allocator as the default allocator.  (C-3)
+        //
+        // Testing:
+        //   static TYPE reduce(RANDOM_ITER, RANDOM_ITER, TYPE init);
+        //   static TYPE reduce(ITER, ITER, TYPE, BINARY_OP, *pool);
+        //   static TYPE transformReduce(ITER, ITER, TYPE, RED, TRANS, *pool);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'reduce' AND 'transformReduce'"
+                            "\n======================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::TestAllocator         pa("pool",    veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (int pi = 0; pi <= NUM_POOLS; ++pi) {
+            Pool  pool(pi < NUM_POOLS ? NUM_THREADS[pi] : 1, &pa);
+            Pool *POOL = pi < NUM_POOLS ? &pool : 0;
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                if (veryVerbose) { T_ P_(pool.numThreads()) P(LENGTH) }
+
+                native_std::vector<int> input(LENGTH);
+                native_std::vector<Mat> matrices(LENGTH);
+                Int64                   sum        = 100;
+                Int64                   sumSquares = 100;
+                Mat                     product    = Mat::make(3);
+                const Mat               INIT       = product;
+                for (int i = 0; i < LENGTH; ++i) {
+                    input[i]     = i * 7 - 1000;
+                    matrices[i]  = Mat::make(i);
+                    sum         += input[i];
+                    sumSquares  += Square()(input[i]);
+                    product      = Multiply()(product, matrices[i]);
+                }
+
+                LOOP2_ASSERT(pi, LENGTH,
+                             sum == Obj::reduce(input.begin(),
+                                                input.end(),
+                                                Int64(100),
+                                                Plus(),
+                                                POOL));
+                if (!POOL) {
+                    LOOP2_ASSERT(pi, LENGTH,
+                                 sum == Obj::reduce(input.begin(),
+                                                    input.end(),
+                                                    Int64(100)));
+                }
+                LOOP2_ASSERT(pi, LENGTH,
+                             sumSquares == Obj::transformReduce(input.begin(),
+                                                                input.end(),
+                                                                Int64(100),
+                                                                Plus(),
+                                                                Square(),
+                                                                POOL));
+                LOOP2_ASSERT(pi, LENGTH,
+                             product == Obj::reduce(matrices.begin(),
+                                                    matrices.end(),
+                                                    INIT,
+                                                    Multiply(),
+                                                    POOL));
+                LOOP2_ASSERT(pi, LENGTH, 0 == da.numBlocksInUse());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'forEach' AND 'transform'
+        //
+        // Concerns:
+        //: 1 The function is invoked exactly once on each element, for ranges
+        //:   of every length and pools of any size, and for the default pool.
+        //:
+        //: 2 'transform' stores each result at the corresponding position of
+        //:   the output range (which may be the input range), and returns the
+        //:   end of the output range.
+        //:
+        //: 3 Ranges specified by iterators other than pointers are processed.
+        //:
+        //: 4 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Increment each element of vectors and deques, and verify that
+        //:   every element was incremented once.  (C-1, 3)
+        //:
+        //: 2 Transform integers into their squares, into a separate range and
+        //:   in place.  (C-2)
+        //:
+        //: 3 Install a test allocator as the default allocator.  (C-4)
+        //
+        // Testing:
+        //   static void forEach(RANDOM_ITER, RANDOM_ITER, FUNCTION, *pool);
+        //   static OUT_ITER transform(IN_ITER, IN_ITER, OUT_ITER, FUNC, *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'forEach' AND 'transform'"
+                            "\n=================================\n");
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::TestAllocator         pa("pool",    veryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (int pi = 0; pi <= NUM_POOLS; ++pi) {
+            Pool  pool(pi < NUM_POOLS ? NUM_THREADS[pi] : 1, &pa);
+            Pool *POOL = pi < NUM_POOLS ? &pool : 0;
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                if (veryVerbose) { T_ P_(pool.numThreads()) P(LENGTH) }
+
+                native_std::vector<int> mX(LENGTH);
+                native_std::deque<int>  mD(LENGTH);
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX[i] = mD[i] = i;
+                }
+
+                Obj::forEach(mX.begin(), mX.end(), Increment(), POOL);
+                Obj::forEach(mD.begin(), mD.end(), Increment(), POOL);
+                Obj::forEach(mD.begin(), mD.end(), Increment(), POOL);
+                for (int i = 0; i < LENGTH; ++i) {
+                    LOOP3_ASSERT(pi, LENGTH, i, i + 1 == mX[i]);
+                    LOOP3_ASSERT(pi, LENGTH, i, i + 2 == mD[i]);
+                }
+
+                native_std::vector<Int64> squares(LENGTH);
+                native_std::vector<Int64>::iterator end =
+                                             Obj::transform(mX.begin(),
+                                                            mX.end(),
+                                                            squares.begin(),
+                                                            Square(),
+                                                            POOL);
+                LOOP2_ASSERT(pi, LENGTH, squares.end() == end);
+
+                Obj::transform(mD.begin(), mD.end(), mD.begin(), Square(),
+                               POOL);
+                for (int i = 0; i < LENGTH; ++i) {
+                    LOOP3_ASSERT(pi, LENGTH, i,
+                                 Int64(i + 1) * (i + 1) == squares[i]);
+                    LOOP3_ASSERT(pi, LENGTH, i,
+                                 (i + 2) * (i + 2) == mD[i]);
+                }
+            }
+
+            LOOP_ASSERT(pi, 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'ParallelThreadPool'
+        //
+        // Concerns:
+        //: 1 'numProcessors' returns a positive value.
+        //:
+        //: 2 A pool reports the number of threads with which it was created,
+        //:   and uses its allocator.
+        //:
+        //: 3 'execute' invokes the job exactly once for each task index, for
+        //:   any number of tasks (including 0), and returns only when all
+        //:   invocations have returned.
+        //:
+        //: 4 The tasks of a job run concurrently on pools having more than
+        //:   one thread.
+        //:
+        //: 5 A job executed by a task of another job on the same pool runs
+        //:   sequentially, without deadlock.
+        //:
+        //: 6 Consecutive jobs may be executed on the same pool.
+        //:
+        //: 7 The default pool is created once, with 'numProcessors()' threads.
+        //
+        // Plan:
+        //: 1 Execute jobs counting the invocations of each task.  (C-2..3, 6)
+        //:
+        //: 2 Execute a job of two tasks that each wait for the other to start.
+        //:   (C-4)
+        //:
+        //: 3 Execute a job whose tasks execute jobs on the same pool.  (C-5)
+        //:
+        //: 4 Call 'defaultPool' twice.  (C-1, 7)
+        //
+        // Testing:
+        //   static int numProcessors();
+        //   explicit ParallelThreadPool(int numThreads, Allocator *ba = 0);
+        //   ~ParallelThreadPool();
+        //   void execute(Job job, void *context, int numTasks);
+        //   int numThreads() const;
+        //   static ParallelThreadPool *defaultPool();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'ParallelThreadPool'"
+                            "\n============================\n");
+
+        if (veryVerbose) printf("Counting tasks.\n");
+        {
+            static const int NUM_TASKS[] = { 0, 1, 2, 3, 17, 1000 };
+            const int        NUM_JOBS    = sizeof NUM_TASKS
+                                         / sizeof *NUM_TASKS;
+
+            for (int pi = 0; pi < NUM_POOLS; ++pi) {
+                bslma::TestAllocator ta("pool", veryVeryVerbose);
+                {
+                    Pool mX(NUM_THREADS[pi], &ta);  const Pool& X = mX;
+
+                    LOOP_ASSERT(pi, NUM_THREADS[pi] == X.numThreads());
+                    LOOP_ASSERT(pi, 0 < ta.numBlocksInUse());
+
+                    for (int ji = 0; ji < NUM_JOBS; ++ji) {
+                        const int N = NUM_TASKS[ji];
+
+                        if (veryVerbose) { T_ P_(X.numThreads()) P(N) }
+
+                        bsls::AtomicInt counts[1001];
+
+                        CountJob job = { counts };
+                        mX.execute(&CountJob::run, &job, N);
+
+                        for (int i = 0; i < N; ++i) {
+                            LOOP3_ASSERT(pi, N, i, 1 == counts[i].load());
+                        }
+                        LOOP2_ASSERT(pi, N, 0 == counts[N].load());
+                    }
+                }
+                LOOP_ASSERT(pi, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (veryVerbose) printf("Concurrency.\n");
+        {
+            Pool mX(2);
+
+            for (int i = 0; i < 3; ++i) {
+                RendezvousJob job;
+                mX.execute(&RendezvousJob::run, &job, 2);
+
+                LOOP_ASSERT(i, 2 == job.d_started.load());
+                LOOP_ASSERT(i, 0 == job.d_timedOut.load());
+            }
+        }
+
+        if (veryVerbose) printf("Nested jobs.\n");
+        {
+            Pool mX(3);
+
+            bsls::AtomicInt counts[10];
+
+            NestedJob job;
+            job.d_pool_p           = &mX;
+            job.d_inner.d_counts_p = counts;
+            job.d_numInnerTasks    = 10;
+
+            mX.execute(&NestedJob::run, &job, 5);
+
+            for (int i = 0; i < 10; ++i) {
+                LOOP_ASSERT(i, 5 == counts[i].load());
+            }
+        }
+
+        if (veryVerbose) printf("Default pool.\n");
+        {
+            const int NUM_PROCESSORS = Pool::numProcessors();
+            if (veryVerbose) { T_ P(NUM_PROCESSORS) }
+            ASSERT(0 < NUM_PROCESSORS);
+
+            Pool *pool = Obj::defaultPool();
+            ASSERT(pool);
+            ASSERT(pool == Obj::defaultPool());
+            ASSERT(NUM_PROCESSORS == pool->numThreads());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Apply each algorithm to a range using a pool of four threads.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const int LENGTH = 100000;
+
+        Pool pool(4);
+        ASSERT(4 == pool.numThreads());
+
+        native_std::vector<int> mX(LENGTH);
+        for (int i = 0; i < LENGTH; ++i) {
+            mX[i] = LENGTH - 1 - i;
+        }
+
+        Obj::sort(mX.begin(), mX.end(), &pool);
+        for (int i = 0; i < LENGTH; ++i) {
+            LOOP_ASSERT(i, i == mX[i]);
+        }
+
+        Obj::forEach(mX.begin(), mX.end(), Increment(), &pool);
+        ASSERT(1      == mX[0]);
+        ASSERT(LENGTH == mX[LENGTH - 1]);
+
+        const Int64 SUM = Int64(LENGTH) * (LENGTH + 1) / 2;
+        ASSERT(SUM == Obj::reduce(mX.begin(), mX.end(), Int64(0), Plus(),
+                                  &pool));
+
+        native_std::vector<Int64> sums(mX.begin(), mX.end());
+        Obj::inclusiveScan(sums.begin(),
+                           sums.end(),
+                           sums.begin(),
+                           Plus(),
+                           &pool);
+        ASSERT(1   == sums[0]);
+        ASSERT(SUM == sums[LENGTH - 1]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        //
+        // Concerns:
+        //: 1 The time taken by each algorithm on large ranges decreases as
+        //:   the number of threads increases, up to the number of processors.
+        //
+        // Plan:
+        //: 1 Time each algorithm on a large range using pools of 1, 2, 4, ...
+        //:   threads, up to twice the number of processors (and at least 8),
+        //:   and report the time per element and the speedup relative to one
+        //:   thread.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SCALING WITH THE NUMBER OF THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: SCALING WITH THE NUMBER OF THREADS"
+                            "\n==============================================="
+                            "\n");
+
+        const int LENGTH         = 8 * 1024 * 1024;
+        const int NUM_PROCESSORS = Pool::numProcessors();
+        const int MAX_THREADS    = 2 * NUM_PROCESSORS < 8
+                                   ? 8
+                                   : 2 * NUM_PROCESSORS;
+
+        printf("%d processors, %d elements (ns per element, speedup)\n",
+               NUM_PROCESSORS, LENGTH);
+        printf("%8s %16s %16s %16s %16s\n",
+               "threads", "forEach", "transformReduce", "inclusiveScan",
+               "sort");
+
+        native_std::vector<int>   input(LENGTH);
+        native_std::vector<int>   data(LENGTH);
+        native_std::vector<Int64> sums(LENGTH);
+
+        Uint64 state = 23;
+        for (int i = 0; i < LENGTH; ++i) {
+            input[i] = static_cast<int>(nextRandom(&state));
+        }
+
+        double baseline[4] = { 0, 0, 0, 0 };
+        for (int numThreads = 1;
+             numThreads <= MAX_THREADS;
+             numThreads *= 2) {
+            Pool pool(numThreads);
+
+            double times[4];
+
+            data = input;
+            bsls::Stopwatch timer;
+            timer.start();
+            Obj::forEach(data.begin(), data.end(), Affine(), &pool);
+            timer.stop();
+            times[0] = elapsedNs(timer, LENGTH);
+
+            timer.reset();
+            timer.start();
+            const Int64 total = Obj::transformReduce(input.begin(),
+                                                     input.end(),
+                                                     Int64(0),
+                                                     Plus(),
+                                                     Square(),
+                                                     &pool);
+            timer.stop();
+            times[1] = elapsedNs(timer, LENGTH);
+            ASSERT(total);
+
+            timer.reset();
+            timer.start();
+            Obj::inclusiveScan(input.begin(),
+                               input.end(),
+                               sums.begin(),
+                               Plus(),
+                               &pool);
+            timer.stop();
+            times[2] = elapsedNs(timer, LENGTH);
+
+            data = input;
+            timer.reset();
+            timer.start();
+            Obj::sort(data.begin(), data.end(), &pool);
+            timer.stop();
+            times[3] = elapsedNs(timer, LENGTH);
+
+            for (int i = 1; i < LENGTH; ++i) {
+                LOOP_ASSERT(i, data[i - 1] <= data[i]);
+            }
+
+            if (1 == numThreads) {
+                for (int k = 0; k < 4; ++k) {
+                    baseline[k] = times[k];
+                }
+            }
+            printf("%8d", numThreads);
+            for (int k = 0; k < 4; ++k) {
+                printf(" %8.2f (%4.2fx)", times[k], baseline[k] / times[k]);
+            }
+            printf("\n");
+        }
+
+        data = input;
+        bsls::Stopwatch timer;
+        timer.start();
+        native_std::sort(data.begin(), data.end());
+        timer.stop();
+        printf("native_std::sort: %.2f ns per element\n",
+               elapsedNs(timer, LENGTH));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -8,8 +8,118 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bslalg_typetraitusesbslmaallocator.h>         // for testing only
 
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BSLALG_RANGECOMPARE_AVX2 1
+#elif defined(__SSE2__) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <emmintrin.h>
+#define BSLALG_RANGECOMPARE_SSE2 1
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)                                         \
+ && (defined(BSLALG_RANGECOMPARE_AVX2) || defined(BSLALG_RANGECOMPARE_SSE2))
+#include <intrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// 'mismatchOffset' compares 32 bytes per iteration, using one AVX2 or two SSE2
+// byte-wise equality comparisons whose results are reduced to a bit mask, in
+// which the lowest clear bit identifies the first differing byte.  Unaligned
+// loads are used, as the ranges need not be aligned, nor aligned alike.  The
+// remaining bytes (or all bytes, where neither instruction set is available)
+// are compared 8 at a time, and then one at a time, which does not depend on
+// byte order.
+
 namespace BloombergLP {
 
+namespace {
+
+#if defined(BSLALG_RANGECOMPARE_AVX2) || defined(BSLALG_RANGECOMPARE_SSE2)
+inline
+int findLowestSetBit(unsigned int mask)
+    // Return the index of the lowest set bit in the specified 'mask'.  The
+    // behavior is undefined unless '0 != mask'.
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bslalg {
+
+                       // -----------------------
+                       // struct RangeCompare_Imp
+                       // -----------------------
+
+// CLASS METHODS
+std::size_t RangeCompare_Imp::mismatchOffset(const void  *start1,
+                                             const void  *start2,
+                                             std::size_t  numBytes)
+{
+    const char *bytes1 = static_cast<const char *>(start1);
+    const char *bytes2 = static_cast<const char *>(start2);
+
+    std::size_t offset = 0;
+
+#if defined(BSLALG_RANGECOMPARE_AVX2)
+    for (; numBytes - offset >= 32; offset += 32) {
+        const __m256i *p1 = reinterpret_cast<const __m256i *>(bytes1 + offset);
+        const __m256i *p2 = reinterpret_cast<const __m256i *>(bytes2 + offset);
+
+        const unsigned int equalMask = _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(p1), _mm256_loadu_si256(p2)));
+        if (0xFFFFFFFFu != equalMask) {
+            return offset + findLowestSetBit(~equalMask);             // RETURN
+        }
+    }
+#elif defined(BSLALG_RANGECOMPARE_SSE2)
+    for (; numBytes - offset >= 32; offset += 32) {
+        const __m128i *p1 = reinterpret_cast<const __m128i *>(bytes1 + offset);
+        const __m128i *p2 = reinterpret_cast<const __m128i *>(bytes2 + offset);
+
+        const unsigned int lowMask = _mm_movemask_epi8(
+                   _mm_cmpeq_epi8(_mm_loadu_si128(p1), _mm_loadu_si128(p2)));
+        const unsigned int highMask = _mm_movemask_epi8(
+           _mm_cmpeq_epi8(_mm_loadu_si128(p1 + 1), _mm_loadu_si128(p2 + 1)));
+        const unsigned int equalMask = lowMask | (highMask << 16);
+        if (0xFFFFFFFFu != equalMask) {
+            return offset + findLowestSetBit(~equalMask);             // RETURN
+        }
+    }
+#endif
+
+    typedef bsls::Types::Uint64 Word;
+
+    for (; numBytes - offset >= sizeof(Word); offset += sizeof(Word)) {
+        Word word1;
+        Word word2;
+        std::memcpy(&word1, bytes1 + offset, sizeof(Word));
+        std::memcpy(&word2, bytes2 + offset, sizeof(Word));
+        if (word1 != word2) {
+            break;
+        }
+    }
+    while (offset < numBytes && bytes1[offset] == bytes2[offset]) {
+        ++offset;
+    }
+    return offset;
+}
+
+}  // close package namespace
+
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -36,6 +36,19 @@ BSLS_IDENT("$Id: $")
 //: o The input iterators are convertible to pointers to a wide or unsigned
 //    character type.
 //
+// Otherwise, 'bslalg::RangeCompare::lexicographical' may locate the first
+// position at which the two ranges differ using a bit-wise comparison of many
+// elements at a time (using SIMD instructions where available), and compare
+// only the elements at that position using 'operator<', when the following
+// criterion is met:
+//: o The input iterators are convertible to pointers to a fundamental,
+//:   enumerated, or pointer type.
+//
+// Note that elements of such types that have the same object representation
+// compare equal, but elements having different object representations need
+// not compare unequal (e.g., the 'double' values '0.0' and '-0.0'), in which
+// case the search resumes after them.
+//
 // Note that a class having the 'bslmf::IsBitwiseEqualityComparable'
 // trait can be described as bit-wise comparable and should meet the following
 // criteria:
@@ -334,6 +347,18 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isconvertible.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISENUM
+#include <bslmf_isenum.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISFUNDAMENTAL
+#include <bslmf_isfundamental.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISPOINTER
+#include <bslmf_ispointer.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_MATCHANYTYPE
 #include <bslmf_matchanytype.h>
 #endif
@@ -459,8 +484,10 @@ struct RangeCompare {
         // '[start1, end1)', and 'length2' is either unspecified or equals the
         // length of the range '[start2, end2)'.  Note that this implementation
         // uses 'std::memcmp' for unsigned character comparisons,
-        // 'std::wmemcmp' for wide character comparisons, and 'operator<' for
-        // all other types.
+        // 'std::wmemcmp' for wide character comparisons, a bit-wise search
+        // for the first differing elements followed by 'operator<' for other
+        // fundamental, enumerated, and pointer types, and 'operator<' for all
+        // other types.
 };
 
                        // =======================
@@ -646,6 +673,70 @@ struct RangeCompare_Imp {
         // than the second range, 0 if they are the same length and compare
         // lexicographically equal, and a positive value if the first range
         // compares lexicographically greater than the second range.
+
+    template <typename VALUE_TYPE>
+    static int lexicographicalBitwiseOrdered(const VALUE_TYPE  *start1,
+                                             const VALUE_TYPE  *end1,
+                                             const VALUE_TYPE  *start2,
+                                             const VALUE_TYPE&,
+                                             bsl::true_type);
+        // Compare the range beginning at the specified 'start1' position and
+        // ending immediately before the specified 'end1' position with the
+        // range beginning at the specified 'start2' position of the same
+        // length (namely, 'end1 - start1'), by searching bit-wise for the
+        // first pair of corresponding elements that differ and comparing
+        // that pair using 'operator<'.  The last two arguments are for
+        // removing overload ambiguities and are not used.  Return a negative
+        // value if the first range compares lexicographically less than the
+        // second range, 0 if they compare lexicographically equal, and a
+        // positive value if the first range compares lexicographically
+        // greater than the second range.  The behavior is undefined unless
+        // two objects of 'VALUE_TYPE' having the same object representation
+        // compare equal.
+
+    template <typename INPUT_ITER, typename VALUE_TYPE>
+    static int lexicographicalBitwiseOrdered(INPUT_ITER        start1,
+                                             INPUT_ITER        end1,
+                                             INPUT_ITER        start2,
+                                             const VALUE_TYPE&,
+                                             bsl::false_type);
+        // Compare each element in the range beginning at the specified
+        // 'start1' position and ending immediately before the specified
+        // 'end1' position with the corresponding element in the range of the
+        // same length beginning at the specified 'start2' position using
+        // 'operator<'.  The last two arguments are for removing overload
+        // ambiguities and are not used.  Return a negative value if the first
+        // range compares lexicographically less than the second range, 0 if
+        // they compare lexicographically equal, and a positive value if the
+        // first range compares lexicographically greater than the second
+        // range.
+
+    template <typename INPUT_ITER, typename VALUE_TYPE>
+    static int lexicographicalBitwiseOrdered(INPUT_ITER        start1,
+                                             INPUT_ITER        end1,
+                                             INPUT_ITER        start2,
+                                             const VALUE_TYPE& value);
+        // Compare the range beginning at the specified 'start1' position and
+        // ending immediately before the specified 'end1' position with the
+        // range beginning at the specified 'start2' position of the same
+        // length (namely, 'end1 - start1').  The type of the specified
+        // 'value' is considered in determining whether the first differing
+        // elements can be found using a bit-wise search, namely when
+        // 'INPUT_ITER' is convertible to a pointer to 'VALUE_TYPE', and
+        // 'VALUE_TYPE' is a fundamental, enumerated, or pointer type; 'value'
+        // is not used in any other way.  Return a negative value if the first
+        // range compares lexicographically less than the second range, 0 if
+        // they compare lexicographically equal, and a positive value if the
+        // first range compares lexicographically greater than the second
+        // range.
+
+    static std::size_t mismatchOffset(const void  *start1,
+                                      const void  *start2,
+                                      std::size_t  numBytes);
+        // Return the offset of the first byte at which the memory of the
+        // specified 'numBytes' size beginning at the specified 'start1'
+        // address differs from the memory of the same size beginning at the
+        // specified 'start2' address, and 'numBytes' if they do not differ.
 };
 
 // ===========================================================================
@@ -999,10 +1090,77 @@ int RangeCompare_Imp::lexicographical(INPUT_ITER start1,
                                       INPUT_ITER end1,
                                       INPUT_ITER start2)
 {
-    if (start1 != end1) {
-        return lexicographical(start1, end1, start2, *start1);        // RETURN
+    if (start1 == end1) {
+        return 0;                                                     // RETURN
     }
-    return 0;
+    return lexicographicalBitwiseOrdered(start1, end1, start2, *start1);
+}
+
+         // *** lexicographicalBitwiseOrdered overloads: ***
+
+template <typename VALUE_TYPE>
+int RangeCompare_Imp::lexicographicalBitwiseOrdered(
+                                                     const VALUE_TYPE  *start1,
+                                                     const VALUE_TYPE  *end1,
+                                                     const VALUE_TYPE  *start2,
+                                                     const VALUE_TYPE&,
+                                                     bsl::true_type)
+{
+    // Elements having different object representations may still compare
+    // equal (e.g., '0.0' and '-0.0'), in which case the search resumes after
+    // them.
+
+    const std::size_t length = end1 - start1;
+
+    std::size_t index = 0;
+    while (true) {
+        index += mismatchOffset(start1 + index,
+                                start2 + index,
+                                (length - index) * sizeof(VALUE_TYPE))
+                                                         / sizeof(VALUE_TYPE);
+        if (length == index) {
+            return 0;                                                 // RETURN
+        }
+        if (start1[index] < start2[index]) {
+            return -1;                                                // RETURN
+        }
+        if (start2[index] < start1[index]) {
+            return 1;                                                 // RETURN
+        }
+        ++index;
+    }
+}
+
+template <typename INPUT_ITER, typename VALUE_TYPE>
+inline
+int RangeCompare_Imp::lexicographicalBitwiseOrdered(INPUT_ITER        start1,
+                                                    INPUT_ITER        end1,
+                                                    INPUT_ITER        start2,
+                                                    const VALUE_TYPE& value,
+                                                    bsl::false_type)
+{
+    return lexicographical(start1, end1, start2, value);
+}
+
+template <typename INPUT_ITER, typename VALUE_TYPE>
+inline
+int RangeCompare_Imp::lexicographicalBitwiseOrdered(INPUT_ITER        start1,
+                                                    INPUT_ITER        end1,
+                                                    INPUT_ITER        start2,
+                                                    const VALUE_TYPE& value)
+{
+    typedef bsl::integral_constant<bool,
+                     bsl::is_convertible<INPUT_ITER, const VALUE_TYPE *>::value
+                  && (   bslmf::IsFundamental<VALUE_TYPE>::value
+                      || bslmf::IsEnum<VALUE_TYPE>::value
+                      || bsl::is_pointer<VALUE_TYPE>::value)>
+                                                   CanUseBitwiseMismatchSearch;
+
+    return lexicographicalBitwiseOrdered(start1,
+                                         end1,
+                                         start2,
+                                         value,
+                                         CanUseBitwiseMismatchSearch());
 }
 
 }  // close package namespace
@@ -48,11 +48,13 @@ using namespace std;
 //-----------------------------------------------------------------------------
 // [ 3] bool equal(start1, end1, length1, start2, end2, length2);
 // [ 4] bool lexicographical(start1, end1, length1, start2, end2, length2);
+// [ 5] size_t RangeCompare_Imp::mismatchOffset(start1, start2, numBytes);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TEST APPARATUS
+// [ 5] 'lexicographical' BIT-WISE MISMATCH SEARCH
 // [-1] PERFORMANCE TEST
-// [ 5] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 
 //==========================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -2076,6 +2078,143 @@ void timeLexicographicalAlgorithm(const char *typeName,
     }
 }
 
+//=============================================================================
+//                       TEST APPARATUS FOR CASE 5
+//-----------------------------------------------------------------------------
+
+enum TestEnum { e_TEST_ENUM_VALUE = 0x12345 };
+
+static char pointees[512];
+
+template <class TYPE>
+TYPE mismatchValue(int i);
+    // Return a value of the (template parameter) 'TYPE' determined by the
+    // specified 'i', such that values for increasing 'i' are increasing, and
+    // include negative values for signed types.
+
+template <>
+signed char mismatchValue<signed char>(int i)
+{
+    return static_cast<signed char>(i - 100);
+}
+
+template <>
+short mismatchValue<short>(int i)
+{
+    return static_cast<short>((i - 100) * 257);
+}
+
+template <>
+int mismatchValue<int>(int i)
+{
+    return (i - 100) * 16843009;
+}
+
+template <>
+unsigned int mismatchValue<unsigned int>(int i)
+{
+    return static_cast<unsigned int>(i) * 16843009u;
+}
+
+template <>
+bsls::Types::Int64 mismatchValue<bsls::Types::Int64>(int i)
+{
+    return (i - 100) * 72340172838076673LL;
+}
+
+template <>
+double mismatchValue<double>(int i)
+{
+    return (i - 100) * 0.5;
+}
+
+template <>
+TestEnum mismatchValue<TestEnum>(int i)
+{
+    return static_cast<TestEnum>(i * 0x101);
+}
+
+template <>
+char *mismatchValue<char *>(int i)
+{
+    return pointees + i;
+}
+
+template <class TYPE>
+int referenceLexicographical(const TYPE *start1,
+                             const TYPE *start2,
+                             int         length)
+    // Return -1, 0, or 1 according to whether the range of the specified
+    // 'length' beginning at the specified 'start1' compares lexicographically
+    // less than, equal to, or greater than the range of the same length
+    // beginning at the specified 'start2', using element-by-element
+    // comparisons.
+{
+    for (int i = 0; i < length; ++i) {
+        if (start1[i] < start2[i]) {
+            return -1;                                                // RETURN
+        }
+        if (start2[i] < start1[i]) {
+            return 1;                                                 // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+void testBitwiseMismatchSearch(const char *typeName, bool verboseFlag)
+    // Verify that 'Obj::lexicographical' compares ranges of the (template
+    // parameter) 'TYPE' correctly for every length up to 'MAX_LENGTH', every
+    // position of a single differing element, values of that element less
+    // and greater than the original, and several relative alignments of the
+    // ranges.  Print the specified 'typeName' if the specified 'verboseFlag'
+    // is 'true'.
+{
+    if (verboseFlag) printf("\t\t... with '%s'\n", typeName);
+
+    enum { MAX_LENGTH = 80, MAX_SHIFT = 3 };
+
+    TYPE buffer1[MAX_LENGTH + MAX_SHIFT];
+    TYPE buffer2[MAX_LENGTH + MAX_SHIFT];
+
+    for (int shift1 = 0; shift1 < MAX_SHIFT; ++shift1) {
+    for (int shift2 = 0; shift2 < MAX_SHIFT; ++shift2) {
+        TYPE *X = buffer1 + shift1;
+        TYPE *Y = buffer2 + shift2;
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                X[i] = Y[i] = mismatchValue<TYPE>(100 + (i * 37) % 64);
+            }
+
+            LOOP2_ASSERT(length, shift1,
+                         0 == Obj::lexicographical(X, X + length, length,
+                                                   Y, Y + length, length));
+
+            for (int pos = 0; pos < length; ++pos) {
+                const TYPE original = Y[pos];
+
+                for (int delta = -65; delta <= 65; delta += 26) {
+                    Y[pos] = mismatchValue<TYPE>(100 + (pos * 37) % 64
+                                                     + delta);
+
+                    const int EXP = referenceLexicographical(X, Y, length);
+                    const int RESULT =
+                                   Obj::lexicographical(X, X + length, length,
+                                                        Y, Y + length, length);
+                    LOOP3_ASSERT(length, pos, delta, EXP == RESULT);
+                    const int REVERSED =
+                                   Obj::lexicographical(Y, Y + length, length,
+                                                        X, X + length, length);
+                    LOOP3_ASSERT(length, pos, delta, -EXP == REVERSED);
+                }
+                Y[pos] = original;
+            }
+        }
+    }
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -2094,7 +2233,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2124,6 +2263,139 @@ int main(int argc, char *argv[])
         // Compare (bit-wise comparable) primitive types.
         usageTestInt();
      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'lexicographical' BIT-WISE MISMATCH SEARCH
+        //
+        // Concerns:
+        //: 1 'mismatchOffset' returns the offset of the first differing byte,
+        //:   or the number of bytes if none differ, for every length and
+        //:   position of a difference, whether or not the ranges are aligned.
+        //:
+        //: 2 'lexicographical' compares ranges of fundamental, enumerated, and
+        //:   pointer types as an element-by-element comparison would,
+        //:   including signed values whose representations order differently
+        //:   from their values.
+        //:
+        //: 3 Elements that differ bit-wise but compare equal (e.g., '0.0' and
+        //:   '-0.0') do not end the comparison.
+        //
+        // Plan:
+        //: 1 For every length up to 100 bytes, every alignment of each range
+        //:   within a 16-byte boundary, and every position of a single
+        //:   differing byte, verify the result of 'mismatchOffset'.  (C-1)
+        //:
+        //: 2 For each of several types, and for every length, position of a
+        //:   single differing element, value of that element, and relative
+        //:   alignment of the ranges, compare the result of 'lexicographical'
+        //:   with that of an element-by-element comparison.  (C-2)
+        //:
+        //: 3 Compare ranges of 'double' in which '0.0' and '-0.0', or two
+        //:   NaNs, precede the first element that compares unequal.  (C-3)
+        //
+        // Testing:
+        //   size_t RangeCompare_Imp::mismatchOffset(start1, start2, numBytes);
+        //   CONCERN: 'lexicographical' BIT-WISE MISMATCH SEARCH
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'lexicographical' BIT-WISE MISMATCH"
+                            " SEARCH"
+                            "\n==========================================="
+                            "=======\n");
+
+        if (verbose) printf("\tTesting 'mismatchOffset'.\n");
+        {
+            enum { MAX_BYTES = 100, MAX_ALIGN = 16 };
+
+            char buffer1[MAX_BYTES + MAX_ALIGN];
+            char buffer2[MAX_BYTES + MAX_ALIGN];
+
+            for (int align1 = 0; align1 < MAX_ALIGN; ++align1) {
+            for (int align2 = 0; align2 < MAX_ALIGN; align2 += 5) {
+                char *X = buffer1 + align1;
+                char *Y = buffer2 + align2;
+
+                for (int n = 0; n <= MAX_BYTES; ++n) {
+                    for (int i = 0; i < n; ++i) {
+                        X[i] = Y[i] = static_cast<char>(i * 7);
+                    }
+                    LOOP2_ASSERT(align1, n,
+                      static_cast<std::size_t>(n) ==
+                               bslalg::RangeCompare_Imp::mismatchOffset(X,
+                                                                        Y,
+                                                                        n));
+
+                    for (int pos = 0; pos < n; ++pos) {
+                        Y[pos] = static_cast<char>(Y[pos] ^ (1 << pos % 8));
+                        LOOP3_ASSERT(align1, n, pos,
+                          static_cast<std::size_t>(pos) ==
+                               bslalg::RangeCompare_Imp::mismatchOffset(X,
+                                                                        Y,
+                                                                        n));
+                        Y[pos] = X[pos];
+                    }
+                }
+            }
+            }
+        }
+
+        if (verbose) printf("\tTesting 'lexicographical'.\n");
+        {
+            testBitwiseMismatchSearch<signed char>("signed char", veryVerbose);
+            testBitwiseMismatchSearch<short>("short", veryVerbose);
+            testBitwiseMismatchSearch<int>("int", veryVerbose);
+            testBitwiseMismatchSearch<unsigned int>("unsigned int",
+                                                    veryVerbose);
+            testBitwiseMismatchSearch<bsls::Types::Int64>("Int64",
+                                                          veryVerbose);
+            testBitwiseMismatchSearch<double>("double", veryVerbose);
+            testBitwiseMismatchSearch<TestEnum>("TestEnum", veryVerbose);
+            testBitwiseMismatchSearch<char *>("char *", veryVerbose);
+        }
+
+        if (verbose) printf("\tTesting equal elements that differ bit-wise."
+                            "\n");
+        {
+            enum { LENGTH = 40 };
+
+            double X[LENGTH];
+            double Y[LENGTH];
+
+            for (int pos = 0; pos < LENGTH - 1; ++pos) {
+                for (int i = 0; i < LENGTH; ++i) {
+                    X[i] = Y[i] = i;
+                }
+                X[pos] =  0.0;
+                Y[pos] = -0.0;
+
+                LOOP_ASSERT(pos, 0 == Obj::lexicographical(X, X + LENGTH,
+                                                           LENGTH,
+                                                           Y, Y + LENGTH,
+                                                           LENGTH));
+
+                Y[LENGTH - 1] += 1;
+                LOOP_ASSERT(pos, 0 > Obj::lexicographical(X, X + LENGTH,
+                                                          LENGTH,
+                                                          Y, Y + LENGTH,
+                                                          LENGTH));
+                LOOP_ASSERT(pos, 0 < Obj::lexicographical(Y, Y + LENGTH,
+                                                          LENGTH,
+                                                          X, X + LENGTH,
+                                                          LENGTH));
+
+                // Two NaNs are neither less nor greater than each other.
+
+                const double zero = X[pos] * 0;
+                X[pos] = zero / zero;
+                Y[pos] = -X[pos];
+
+                LOOP_ASSERT(pos, 0 > Obj::lexicographical(X, X + LENGTH,
+                                                          LENGTH,
+                                                          Y, Y + LENGTH,
+                                                          LENGTH));
+            }
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING 'lexicographical'
@@ -0,0 +1,192 @@
+// bslalg_rbtreecountutil.cpp                                         -*-C++-*-
+#include <bslalg_rbtreecountutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bslalg {
+
+static inline
+RbTreeCountedNode *toCountedNode(RbTreeNode *node)
+    // Return the specified 'node' as a 'RbTreeCountedNode'.  The behavior is
+    // undefined unless 'node' refers to a 'RbTreeCountedNode'.
+{
+    return static_cast<RbTreeCountedNode *>(node);
+}
+
+static void updateCountsAfterRotation(RbTreeNode *node, RbTreeNode *pivot)
+    // Update the subtree sizes of the specified 'node' and 'pivot' after
+    // 'pivot' has been rotated into the position previously held by 'node'.
+    // Note that this function is a 'RbTreeUtil::RotationCallback'.
+{
+    // 'pivot' now roots the same set of nodes 'node' rooted before the
+    // rotation; 'node' lost 'pivot' and one of the pivot's subtrees.
+
+    toCountedNode(pivot)->setSubtreeSize(
+                                toCountedNode(node)->subtreeSize());
+    toCountedNode(node)->setSubtreeSize(
+                              RbTreeCountUtil::subtreeSize(node->leftChild())
+                            + RbTreeCountUtil::subtreeSize(node->rightChild())
+                            + 1);
+}
+
+                        // ---------------------
+                        // class RbTreeCountUtil
+                        // ---------------------
+
+// CLASS METHODS
+int RbTreeCountUtil::rank(const RbTreeAnchor& tree, const RbTreeNode *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (tree.sentinel() == node) {
+        return tree.numNodes();                                       // RETURN
+    }
+
+    // Count the nodes to the left of 'node' within its own subtree, and then
+    // climb to the root, adding each ancestor (and its left subtree) that
+    // 'node' lies to the right of.
+
+    int result = subtreeSize(node->leftChild());
+    const RbTreeNode *root = tree.rootNode();
+    while (root != node) {
+        const RbTreeNode *parent = node->parent();
+        if (parent->rightChild() == node) {
+            result += subtreeSize(parent->leftChild()) + 1;
+        }
+        node = parent;
+    }
+    return result;
+}
+
+const RbTreeNode *RbTreeCountUtil::select(const RbTreeAnchor& tree,
+                                          int                 index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index <= tree.numNodes());
+
+    if (tree.numNodes() == index) {
+        return tree.sentinel();                                       // RETURN
+    }
+
+    const RbTreeNode *node = tree.rootNode();
+    while (true) {
+        BSLS_ASSERT_SAFE(node);
+
+        const int leftSize = subtreeSize(node->leftChild());
+        if (index < leftSize) {
+            node = node->leftChild();
+        }
+        else if (index == leftSize) {
+            return node;                                              // RETURN
+        }
+        else {
+            index -= leftSize + 1;
+            node   = node->rightChild();
+        }
+    }
+}
+
+void RbTreeCountUtil::insertAt(RbTreeAnchor *tree,
+                               RbTreeNode   *parentNode,
+                               bool          leftChildFlag,
+                               RbTreeNode   *newNode)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(parentNode);
+    BSLS_ASSERT(newNode);
+
+    // Account for 'newNode' in every subtree that will contain it, before the
+    // tree is rebalanced (which reports each of its rotations to
+    // 'updateCountsAfterRotation').
+
+    for (RbTreeNode *node = parentNode;
+         tree->sentinel() != node;
+         node = node->parent()) {
+        RbTreeCountedNode *countedNode = toCountedNode(node);
+        countedNode->setSubtreeSize(countedNode->subtreeSize() + 1);
+    }
+    toCountedNode(newNode)->setSubtreeSize(1);
+
+    RbTreeUtil::insertAt(tree,
+                         parentNode,
+                         leftChildFlag,
+                         newNode,
+                         &updateCountsAfterRotation);
+}
+
+void RbTreeCountUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
+{
+    BSLS_ASSERT(tree);
+    BSLS_ASSERT(node);
+    BSLS_ASSERT(tree->rootNode());
+
+    // Identify the node whose position will be vacated: 'node' itself if it
+    // has at most one child, and its successor otherwise (see
+    // 'RbTreeUtil::remove').  Every subtree that contained that position
+    // loses one node.
+
+    RbTreeNode *vacated = node->leftChild() && node->rightChild()
+                        ? RbTreeUtil::leftmost(node->rightChild())
+                        : node;
+
+    for (RbTreeNode *ancestor = vacated->parent();
+         tree->sentinel() != ancestor;
+         ancestor = ancestor->parent()) {
+        RbTreeCountedNode *countedNode = toCountedNode(ancestor);
+        countedNode->setSubtreeSize(countedNode->subtreeSize() - 1);
+    }
+
+    if (vacated != node) {
+        // The successor will take over the position (and so the, already
+        // decremented, subtree size) of 'node'.
+
+        toCountedNode(vacated)->setSubtreeSize(
+                                          toCountedNode(node)->subtreeSize());
+    }
+
+    RbTreeUtil::remove(tree, node, &updateCountsAfterRotation);
+}
+
+bool RbTreeCountUtil::isWellCounted(const RbTreeAnchor& tree)
+{
+    if (subtreeSize(tree.rootNode()) != tree.numNodes()) {
+        return false;                                                 // RETURN
+    }
+    for (const RbTreeNode *node = tree.firstNode();
+         tree.sentinel() != node;
+         node = RbTreeUtil::next(node)) {
+        if (subtreeSize(node) != subtreeSize(node->leftChild())
+                               + subtreeSize(node->rightChild())
+                               + 1) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
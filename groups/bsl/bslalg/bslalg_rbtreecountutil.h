@@ -0,0 +1,453 @@
+// bslalg_rbtreecountutil.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLALG_RBTREECOUNTUTIL
+#define INCLUDED_BSLALG_RBTREECOUNTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide order-statistic algorithms on size-augmented RB trees.
+//
+//@CLASSES:
+//  bslalg::RbTreeCountedNode: red-black tree node holding its subtree size
+//  bslalg::RbTreeCountUtil: namespace for order-statistic tree functions
+//
+//@SEE_ALSO: bslalg_rbtreeutil, bslalg_rbtreenode
+//
+//@DESCRIPTION: This component provides a POD-like node type,
+// 'RbTreeCountedNode', that augments 'RbTreeNode' with the number of nodes in
+// the subtree rooted at that node, and a utility, 'RbTreeCountUtil', that
+// maintains those counts while nodes are inserted into and removed from a
+// red-black tree, and uses them to answer order-statistic queries in
+// logarithmic time:
+//..
+//  rank                Return the in-order position of the supplied node.
+//
+//  select              Return the node at the supplied in-order position.
+//
+//  lowerBoundRank      Return the number of nodes less than a value.
+//
+//  upperBoundRank      Return the number of nodes not greater than a value.
+//
+//  insert              Insert the supplied node into the tree.
+//
+//  insertAt            Insert the supplied node at the indicated position.
+//
+//  remove              Remove the supplied node from the tree.
+//
+//  isWellCounted       Indicate if every subtree size in a tree is correct.
+//..
+// Every node of a tree manipulated through 'RbTreeCountUtil' must be (or
+// derive from) 'RbTreeCountedNode'.  Such a tree is otherwise an ordinary
+// red-black tree: all the non-modifying algorithms of 'RbTreeUtil' (e.g.,
+// 'find', 'lowerBound', 'next') may be applied to it directly, and
+// 'RbTreeUtil::copyTree' produces a correctly counted copy provided that the
+// supplied node factory copies the subtree size along with the value of each
+// node.  However, nodes must be inserted and removed using 'RbTreeCountUtil'
+// so that the counts stay consistent with the shape of the tree.
+//
+///Maintaining Subtree Sizes
+///-------------------------
+// An insertion adds one to the size of every ancestor of the new node, and a
+// removal subtracts one from the size of every ancestor of the position that
+// is physically vacated (the removed node itself or, if it has two children,
+// its successor, which then takes over the removed node's size).  These
+// adjustments are made along the path to the root before the tree is
+// rebalanced.  The rebalancing itself is performed by 'RbTreeUtil', which
+// notifies this component of each rotation (see
+// 'RbTreeUtil::RotationCallback'); a rotation changes the set of nodes below
+// only the two nodes it exchanges, so each rotation is repaired in constant
+// time.  Insertion and removal therefore remain O(log(N)) operations.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Median of a Changing Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to report the median of a set of integers that changes
+// over time.  An order-statistic tree allows the median to be found in
+// logarithmic time, without sorting or copying the set.
+//
+// First, we define a node type holding an integer value, and a comparator
+// that orders such nodes (and integers) by value:
+//..
+//  struct IntNode : public bslalg::RbTreeCountedNode {
+//      int d_value;
+//  };
+//
+//  struct IntNodeComparator {
+//      bool operator()(const bslalg::RbTreeNode& lhs,
+//                      const bslalg::RbTreeNode& rhs) const
+//      {
+//          return static_cast<const IntNode&>(lhs).d_value <
+//                 static_cast<const IntNode&>(rhs).d_value;
+//      }
+//
+//      bool operator()(const bslalg::RbTreeNode& lhs, int rhs) const
+//      {
+//          return static_cast<const IntNode&>(lhs).d_value < rhs;
+//      }
+//
+//      bool operator()(int lhs, const bslalg::RbTreeNode& rhs) const
+//      {
+//          return lhs < static_cast<const IntNode&>(rhs).d_value;
+//      }
+//  };
+//..
+// Then, we insert a set of values into an (initially empty) tree:
+//..
+//  const int VALUES[]   = { 13, 2, 7, 31, 5, 17, 11 };
+//  const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+//
+//  IntNode              nodes[NUM_VALUES];
+//  bslalg::RbTreeAnchor tree;
+//  IntNodeComparator    comparator;
+//
+//  for (int i = 0; i < NUM_VALUES; ++i) {
+//      nodes[i].d_value = VALUES[i];
+//      bslalg::RbTreeCountUtil::insert(&tree, comparator, &nodes[i]);
+//  }
+//  assert(bslalg::RbTreeCountUtil::isWellCounted(tree));
+//..
+// Next, we find the median (the node having three smaller values), and we
+// verify that its rank is three:
+//..
+//  const bslalg::RbTreeNode *median =
+//                                  bslalg::RbTreeCountUtil::select(tree, 3);
+//  assert(11 == static_cast<const IntNode *>(median)->d_value);
+//  assert(3  == bslalg::RbTreeCountUtil::rank(tree, median));
+//..
+// Then, we count the values in the range '[5 .. 17)':
+//..
+//  int numInRange =
+//            bslalg::RbTreeCountUtil::lowerBoundRank(tree, comparator, 17)
+//          - bslalg::RbTreeCountUtil::lowerBoundRank(tree, comparator, 5);
+//  assert(4 == numInRange);
+//..
+// Finally, we remove the two smallest values, and find the new median:
+//..
+//  bslalg::RbTreeCountUtil::remove(&tree, tree.firstNode());
+//  bslalg::RbTreeCountUtil::remove(&tree, tree.firstNode());
+//
+//  median = bslalg::RbTreeCountUtil::select(tree, tree.numNodes() / 2);
+//  assert(13 == static_cast<const IntNode *>(median)->d_value);
+//  assert(bslalg::RbTreeCountUtil::isWellCounted(tree));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEANCHOR
+#include <bslalg_rbtreeanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEUTIL
+#include <bslalg_rbtreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bslalg {
+
+                        // =======================
+                        // class RbTreeCountedNode
+                        // =======================
+
+class RbTreeCountedNode : public RbTreeNode {
+    // This POD-like 'class' describes a node suitable for use in a red-black
+    // binary search tree whose nodes are counted (see 'RbTreeCountUtil').  In
+    // addition to the links and color provided by 'RbTreeNode', it holds the
+    // number of nodes in the subtree rooted at this node (including this node
+    // itself).  Like 'RbTreeNode', this type does not define a constructor or
+    // destructor, and does not contain any "payload" member data.
+
+    // DATA
+    int d_subtreeSize;  // number of nodes in the subtree rooted at this node
+
+  public:
+    //! RbTreeCountedNode() = default;
+        // Create a 'RbTreeCountedNode' object having uninitialized values.
+
+    //! RbTreeCountedNode(const RbTreeCountedNode& original) = default;
+        // Create a 'RbTreeCountedNode' object having the same value as the
+        // specified 'original' object.
+
+    //! ~RbTreeCountedNode() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! RbTreeCountedNode& operator=(const RbTreeCountedNode& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    void setSubtreeSize(int value);
+        // Set the number of nodes in the subtree rooted at this node to the
+        // specified 'value'.
+
+    // ACCESSORS
+    int subtreeSize() const;
+        // Return the number of nodes in the subtree rooted at this node.
+};
+
+                        // =====================
+                        // class RbTreeCountUtil
+                        // =====================
+
+struct RbTreeCountUtil {
+    // This 'struct' provides a namespace for a suite of utility functions
+    // that maintain, and make use of, the subtree sizes held by the
+    // 'RbTreeCountedNode' objects forming a red-black tree.  Every node
+    // supplied to (or reached by) these functions, other than a tree's
+    // sentinel node, must be a 'RbTreeCountedNode'.
+
+    // CLASS METHODS
+                                 // Observation
+
+    static int subtreeSize(const RbTreeNode *subtree);
+        // Return the number of nodes in the specified 'subtree', and 0 if
+        // 'subtree' is 0.  The behavior is undefined unless 'subtree' is 0 or
+        // refers to a 'RbTreeCountedNode'.
+
+    static int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+        // Return the number of nodes that precede the specified 'node' in an
+        // in-order traversal of the specified 'tree', and 'tree.numNodes()' if
+        // 'node' is 'tree.sentinel()'.  The behavior is undefined unless
+        // 'tree' is well-formed (see 'RbTreeUtil::isWellFormed'), 'tree' is
+        // well-counted (see 'isWellCounted'), and 'node' is a node in 'tree'
+        // or 'tree.sentinel()'.  Note that this operation is O(log(N)).
+
+    static const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+    static       RbTreeNode *select(RbTreeAnchor&       tree, int index);
+        // Return the address of the node at the specified (zero-based)
+        // 'index' in an in-order traversal of the specified 'tree', and
+        // 'tree.sentinel()' if 'index' is 'tree.numNodes()'.  The behavior is
+        // undefined unless 'tree' is well-formed and well-counted, and
+        // '0 <= index <= tree.numNodes()'.  Note that this operation is
+        // O(log(N)).
+
+    template <class NODE_VALUE_COMPARATOR, class VALUE>
+    static int lowerBoundRank(const RbTreeAnchor&    tree,
+                              NODE_VALUE_COMPARATOR& comparator,
+                              const VALUE&           value);
+        // Return the number of nodes in the specified 'tree' (organized
+        // according to the specified 'comparator') holding a value less than
+        // the specified 'value', i.e., the rank of the node that
+        // 'RbTreeUtil::lowerBound' would return.  'NODE_VALUE_COMPARATOR'
+        // shall be a functor providing a method that can be called as if it
+        // had the following signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const VALUE&) const;
+        //..
+        // The behavior is undefined unless 'comparator' provides a strict
+        // weak ordering on objects of type 'VALUE', and 'tree' is well-formed
+        // and well-counted.
+
+    template <class NODE_VALUE_COMPARATOR, class VALUE>
+    static int upperBoundRank(const RbTreeAnchor&    tree,
+                              NODE_VALUE_COMPARATOR& comparator,
+                              const VALUE&           value);
+        // Return the number of nodes in the specified 'tree' (organized
+        // according to the specified 'comparator') holding a value not
+        // greater than the specified 'value', i.e., the rank of the node that
+        // 'RbTreeUtil::upperBound' would return.  'NODE_VALUE_COMPARATOR'
+        // shall be a functor providing a method that can be called as if it
+        // had the following signature:
+        //..
+        //  bool operator()(const VALUE&, const RbTreeNode&) const;
+        //..
+        // The behavior is undefined unless 'comparator' provides a strict
+        // weak ordering on objects of type 'VALUE', and 'tree' is well-formed
+        // and well-counted.
+
+                                 // Modification
+
+    template <class NODE_COMPARATOR>
+    static void insert(RbTreeAnchor           *tree,
+                       const NODE_COMPARATOR&  comparator,
+                       RbTreeNode             *newNode);
+        // Insert the specified 'newNode' into the specified 'tree', organized
+        // according to the specified 'comparator', maintaining the subtree
+        // sizes of the nodes in 'tree'.  'NODE_COMPARATOR' shall be a functor
+        // providing a method that can be called as if it had the following
+        // signature:
+        //..
+        //  bool operator()(const RbTreeNode&, const RbTreeNode&) const;
+        //..
+        // The behavior is undefined unless 'comparator' provides a strict
+        // weak ordering on the values of the nodes, 'tree' is well-formed
+        // and well-counted, and 'newNode' refers to a 'RbTreeCountedNode'.
+
+    static void insertAt(RbTreeAnchor *tree,
+                         RbTreeNode   *parentNode,
+                         bool          leftChildFlag,
+                         RbTreeNode   *newNode);
+        // Insert the specified 'newNode' into the specified 'tree' as either
+        // the left or right child of the specified 'parentNode', as indicated
+        // by the specified 'leftChildFlag', and then rebalance the tree,
+        // maintaining the subtree sizes of the nodes in 'tree'.  The behavior
+        // is undefined unless 'tree' is well-counted, 'newNode' refers to a
+        // 'RbTreeCountedNode', and the preconditions of
+        // 'RbTreeUtil::insertAt' are met.  Note that this operation is
+        // intended to be used in conjunction with the
+        // 'RbTreeUtil::findInsertLocation' or
+        // 'RbTreeUtil::findUniqueInsertLocation' methods.
+
+    static void remove(RbTreeAnchor *tree, RbTreeNode *node);
+        // Remove the specified 'node' from the specified 'tree', and then
+        // rebalance 'tree', maintaining the subtree sizes of the nodes that
+        // remain in 'tree'.  The behavior is undefined unless 'tree' is
+        // well-formed and well-counted, and 'node' is a node in 'tree'.
+
+                                 // Testing
+
+    static bool isWellCounted(const RbTreeAnchor& tree);
+        // Return 'true' if the subtree size held by every node in the
+        // specified 'tree' is one more than the sum of the subtree sizes of
+        // its children, and the subtree size of the root node of 'tree' is
+        // 'tree.numNodes()'; return 'false' otherwise.  The behavior is
+        // undefined unless 'tree' is well-formed (see
+        // 'RbTreeUtil::isWellFormed'), and every node in 'tree' is a
+        // 'RbTreeCountedNode'.  Note that this operation is O(N).
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -----------------------
+                        // class RbTreeCountedNode
+                        // -----------------------
+
+// MANIPULATORS
+inline
+void RbTreeCountedNode::setSubtreeSize(int value)
+{
+    d_subtreeSize = value;
+}
+
+// ACCESSORS
+inline
+int RbTreeCountedNode::subtreeSize() const
+{
+    return d_subtreeSize;
+}
+
+                        // ---------------------
+                        // class RbTreeCountUtil
+                        // ---------------------
+
+// CLASS METHODS
+inline
+int RbTreeCountUtil::subtreeSize(const RbTreeNode *subtree)
+{
+    return subtree
+         ? static_cast<const RbTreeCountedNode *>(subtree)->subtreeSize()
+         : 0;
+}
+
+inline
+RbTreeNode *RbTreeCountUtil::select(RbTreeAnchor& tree, int index)
+{
+    return const_cast<RbTreeNode *>(
+                        select(const_cast<const RbTreeAnchor&>(tree), index));
+}
+
+template <class NODE_VALUE_COMPARATOR, class VALUE>
+int RbTreeCountUtil::lowerBoundRank(const RbTreeAnchor&    tree,
+                                    NODE_VALUE_COMPARATOR& comparator,
+                                    const VALUE&           value)
+{
+    // Note that the following logic is the same as 'RbTreeUtil::lowerBound',
+    // except that the sizes of the subtrees passed over on the left are
+    // accumulated.
+
+    int               result = 0;
+    const RbTreeNode *node   = tree.rootNode();
+    while (node) {
+        if (comparator(*node, value)) {
+            result += subtreeSize(node->leftChild()) + 1;
+            node    = node->rightChild();
+        }
+        else {
+            node = node->leftChild();
+        }
+    }
+    return result;
+}
+
+template <class NODE_VALUE_COMPARATOR, class VALUE>
+int RbTreeCountUtil::upperBoundRank(const RbTreeAnchor&    tree,
+                                    NODE_VALUE_COMPARATOR& comparator,
+                                    const VALUE&           value)
+{
+    int               result = 0;
+    const RbTreeNode *node   = tree.rootNode();
+    while (node) {
+        if (comparator(value, *node)) {
+            node = node->leftChild();
+        }
+        else {
+            result += subtreeSize(node->leftChild()) + 1;
+            node    = node->rightChild();
+        }
+    }
+    return result;
+}
+
+template <class NODE_COMPARATOR>
+void RbTreeCountUtil::insert(RbTreeAnchor           *tree,
+                             const NODE_COMPARATOR&  comparator,
+                             RbTreeNode             *newNode)
+{
+    BSLS_ASSERT_SAFE(tree);
+    BSLS_ASSERT_SAFE(newNode);
+
+    // Note that the following logic is the same as 'RbTreeUtil::insert'.
+
+    RbTreeNode *parent        = tree->sentinel();
+    RbTreeNode *node          = tree->rootNode();
+    bool        leftChildFlag = true;
+    while (node) {
+        parent        = node;
+        leftChildFlag = comparator(*newNode, *node);
+        node          = leftChildFlag ? node->leftChild() : node->rightChild();
+    }
+    insertAt(tree, parent, leftChildFlag, newNode);
+}
+
+}  // close namespace bslalg
+}  // close namespace BloombergLP
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,755 @@
+// bslalg_rbtreecountutil.t.cpp                                       -*-C++-*-
+
+#include <bslalg_rbtreecountutil.h>
+
+#include <bslalg_rbtreeanchor.h>
+#include <bslalg_rbtreenode.h>
+#include <bslalg_rbtreeutil.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi(), rand(), srand()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a node type holding a subtree size, and
+// a suite of functions that maintain those sizes as nodes are inserted into
+// and removed from a red-black tree, and that use them to answer
+// order-statistic queries.  The rebalancing of the tree is performed by
+// 'bslalg::RbTreeUtil' (which is tested by its own test driver), so we
+// concentrate on the consistency of the counts: after every modification
+// performed through 'RbTreeCountUtil' in long, pseudo-random sequences of
+// insertions and removals, we verify that the tree is a valid red-black tree
+// and that 'isWellCounted' returns 'true'.  'isWellCounted' itself is first
+// verified against trees with deliberately corrupted counts.  The queries
+// ('rank', 'select', 'lowerBoundRank', and 'upperBoundRank') are then
+// compared with the results of a brute-force in-order traversal.
+//-----------------------------------------------------------------------------
+// RbTreeCountedNode
+// [ 2] void setSubtreeSize(int value);
+// [ 2] int subtreeSize() const;
+//
+// RbTreeCountUtil
+// [ 2] int subtreeSize(const RbTreeNode *subtree);
+// [ 4] int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+// [ 4] const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+// [ 4] RbTreeNode *select(RbTreeAnchor& tree, int index);
+// [ 4] int lowerBoundRank(const RbTreeAnchor&, CMP&, const VALUE&);
+// [ 4] int upperBoundRank(const RbTreeAnchor&, CMP&, const VALUE&);
+// [ 3] void insert(RbTreeAnchor *, const NODE_COMPARATOR&, RbTreeNode *);
+// [ 3] void insertAt(RbTreeAnchor *, RbTreeNode *, bool, RbTreeNode *);
+// [ 3] void remove(RbTreeAnchor *tree, RbTreeNode *node);
+// [ 2] bool isWellCounted(const RbTreeAnchor& tree);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCERN: 'RbTreeUtil::copyTree' preserves counts
+// [ 6] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::RbTreeCountUtil   Obj;
+typedef bslalg::RbTreeCountedNode CountedNode;
+typedef bslalg::RbTreeNode        RbTreeNode;
+typedef bslalg::RbTreeAnchor      RbTreeAnchor;
+typedef bslalg::RbTreeUtil        Util;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct TestNode : public CountedNode {
+    // This 'struct' provides a counted red-black tree node holding an integer
+    // value.
+
+    int d_value;
+};
+
+int value(const RbTreeNode *node)
+    // Return the value held by the specified 'node'.
+{
+    return static_cast<const TestNode *>(node)->d_value;
+}
+
+struct TestNodeComparator {
+    // This 'struct' provides a functor ordering 'TestNode' objects (and
+    // integers) by value.
+
+    bool operator()(const RbTreeNode& lhs, const RbTreeNode& rhs) const
+    {
+        return value(&lhs) < value(&rhs);
+    }
+
+    bool operator()(const RbTreeNode& lhs, int rhs) const
+    {
+        return value(&lhs) < rhs;
+    }
+
+    bool operator()(int lhs, const RbTreeNode& rhs) const
+    {
+        return lhs < value(&rhs);
+    }
+};
+
+class TestNodeFactory {
+    // This class provides a node factory, suitable for use with
+    // 'RbTreeUtil::copyTree' and 'RbTreeUtil::deleteTree', that creates
+    // 'TestNode' objects copying both the value and the subtree size of the
+    // original node.
+
+    // DATA
+    int d_numNodes;  // number of nodes currently allocated
+
+  private:
+    // NOT IMPLEMENTED
+    TestNodeFactory(const TestNodeFactory&);
+    TestNodeFactory& operator=(const TestNodeFactory&);
+
+  public:
+    // CREATORS
+    TestNodeFactory() : d_numNodes(0) {}
+
+    // MANIPULATORS
+    RbTreeNode *createNode(const RbTreeNode& original)
+    {
+        TestNode *node = new TestNode(static_cast<const TestNode&>(original));
+        ++d_numNodes;
+        return node;
+    }
+
+    void deleteNode(RbTreeNode *node)
+    {
+        delete static_cast<TestNode *>(node);
+        --d_numNodes;
+    }
+
+    // ACCESSORS
+    int numNodes() const { return d_numNodes; }
+};
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+bool isValid(const RbTreeAnchor& tree)
+    // Return 'true' if the specified 'tree' is a well-formed red-black tree
+    // ordered by value whose subtree sizes are correct, and 'false'
+    // otherwise.
+{
+    return Util::isWellFormed(tree, TestNodeComparator())
+        && Obj::isWellCounted(tree);
+}
+
+int nextRandom(int modulus)
+    // Return a pseudo-random integer in the range '[0 .. modulus)'.
+{
+    return rand() % modulus;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Finding the Median of a Changing Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to report the median of a set of integers that changes
+// over time.  An order-statistic tree allows the median to be found in
+// logarithmic time, without sorting or copying the set.
+//
+// First, we define a node type holding an integer value, and a comparator
+// that orders such nodes (and integers) by value:
+//..
+namespace UsageExample {
+
+struct IntNode : public bslalg::RbTreeCountedNode {
+    int d_value;
+};
+
+struct IntNodeComparator {
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const bslalg::RbTreeNode& rhs) const
+    {
+        return static_cast<const IntNode&>(lhs).d_value <
+               static_cast<const IntNode&>(rhs).d_value;
+    }
+
+    bool operator()(const bslalg::RbTreeNode& lhs, int rhs) const
+    {
+        return static_cast<const IntNode&>(lhs).d_value < rhs;
+    }
+
+    bool operator()(int lhs, const bslalg::RbTreeNode& rhs) const
+    {
+        return lhs < static_cast<const IntNode&>(rhs).d_value;
+    }
+};
+
+}  // close namespace UsageExample
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Then, we insert a set of values into an (initially empty) tree:
+//..
+    const int VALUES[]   = { 13, 2, 7, 31, 5, 17, 11 };
+    const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+    IntNode              nodes[NUM_VALUES];
+    bslalg::RbTreeAnchor tree;
+    IntNodeComparator    comparator;
+
+    for (int i = 0; i < NUM_VALUES; ++i) {
+        nodes[i].d_value = VALUES[i];
+        bslalg::RbTreeCountUtil::insert(&tree, comparator, &nodes[i]);
+    }
+    ASSERT(bslalg::RbTreeCountUtil::isWellCounted(tree));
+//..
+// Next, we find the median (the node having three smaller values), and we
+// verify that its rank is three:
+//..
+    const bslalg::RbTreeNode *median =
+                                    bslalg::RbTreeCountUtil::select(tree, 3);
+    ASSERT(11 == static_cast<const IntNode *>(median)->d_value);
+    ASSERT(3  == bslalg::RbTreeCountUtil::rank(tree, median));
+//..
+// Then, we count the values in the range '[5 .. 17)':
+//..
+    int numInRange =
+              bslalg::RbTreeCountUtil::lowerBoundRank(tree, comparator, 17)
+            - bslalg::RbTreeCountUtil::lowerBoundRank(tree, comparator, 5);
+    ASSERT(4 == numInRange);
+//..
+// Finally, we remove the two smallest values, and find the new median:
+//..
+    bslalg::RbTreeCountUtil::remove(&tree, tree.firstNode());
+    bslalg::RbTreeCountUtil::remove(&tree, tree.firstNode());
+
+    median = bslalg::RbTreeCountUtil::select(tree, tree.numNodes() / 2);
+    ASSERT(13 == static_cast<const IntNode *>(median)->d_value);
+    ASSERT(bslalg::RbTreeCountUtil::isWellCounted(tree));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'RbTreeUtil::copyTree' PRESERVES COUNTS
+        //
+        // Concerns:
+        //: 1 A tree copied by 'RbTreeUtil::copyTree', using a factory that
+        //:   copies the subtree size of each node, is well-counted.
+        //:
+        //: 2 The copy can be modified through 'RbTreeCountUtil' without
+        //:   affecting the original.
+        //
+        // Plan:
+        //: 1 For trees of several sizes, built by pseudo-random insertions,
+        //:   copy the tree and verify that the copy is valid, and that
+        //:   'select' returns nodes holding the same values in both trees.
+        //:   (C-1)
+        //:
+        //: 2 Remove half the nodes of the copy, and verify that both trees
+        //:   remain valid.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'RbTreeUtil::copyTree' preserves counts
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: 'copyTree' PRESERVES COUNTS"
+                            "\n====================================\n");
+
+        srand(5);
+        for (int ti = 0; ti < 64; ti += 1 + ti / 4) {
+            const int NUM_NODES = ti;
+
+            TestNodeFactory factory;
+            RbTreeAnchor   x;
+            for (int i = 0; i < NUM_NODES; ++i) {
+                TestNode original;
+                original.d_value = nextRandom(NUM_NODES);
+                Obj::insert(&x, TestNodeComparator(),
+                            factory.createNode(original));
+            }
+            LOOP_ASSERT(ti, isValid(x));
+
+            RbTreeAnchor y;
+            Util::copyTree(&y, x, &factory);
+            LOOP_ASSERT(ti, isValid(y));
+            LOOP_ASSERT(ti, NUM_NODES == y.numNodes());
+            LOOP_ASSERT(ti, 2 * NUM_NODES == factory.numNodes());
+
+            for (int i = 0; i < NUM_NODES; ++i) {
+                LOOP2_ASSERT(ti, i, value(Obj::select(x, i)) ==
+                                                     value(Obj::select(y, i)));
+            }
+
+            for (int i = 0; i < NUM_NODES / 2; ++i) {
+                RbTreeNode *node = Obj::select(y, nextRandom(y.numNodes()));
+                Obj::remove(&y, node);
+                factory.deleteNode(node);
+            }
+            LOOP_ASSERT(ti, isValid(x));
+            LOOP_ASSERT(ti, isValid(y));
+            LOOP_ASSERT(ti, NUM_NODES == x.numNodes());
+
+            Util::deleteTree(&x, &factory);
+            Util::deleteTree(&y, &factory);
+            LOOP_ASSERT(ti, 0 == factory.numNodes());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ORDER-STATISTIC QUERIES
+        //
+        // Concerns:
+        //: 1 'rank' returns the in-order position of a node, and the number
+        //:   of nodes for the sentinel.
+        //:
+        //: 2 'select' returns the node at an in-order position, and the
+        //:   sentinel for the number of nodes; 'select' is the inverse of
+        //:   'rank'.
+        //:
+        //: 3 'lowerBoundRank' and 'upperBoundRank' return the ranks of the
+        //:   nodes returned by 'RbTreeUtil::lowerBound' and
+        //:   'RbTreeUtil::upperBound' respectively, including for values not
+        //:   in the tree, values below the first node and above the last
+        //:   node, and values held by several nodes.
+        //:
+        //: 4 The queries are correct for an empty tree.
+        //
+        // Plan:
+        //: 1 For trees of several sizes holding (possibly duplicate)
+        //:   pseudo-random even values, walk the tree in order, and verify
+        //:   that 'rank' returns the position of each node, and 'select'
+        //:   returns the node for each position.  (C-1..2)
+        //:
+        //: 2 For every value (odd and even) from below the smallest to above
+        //:   the largest value in the tree, compare the results of
+        //:   'lowerBoundRank' and 'upperBoundRank' with the ranks of the
+        //:   nodes returned by 'RbTreeUtil::lowerBound' and
+        //:   'RbTreeUtil::upperBound'.  (C-3..4)
+        //
+        // Testing:
+        //   int rank(const RbTreeAnchor& tree, const RbTreeNode *node);
+        //   const RbTreeNode *select(const RbTreeAnchor& tree, int index);
+        //   RbTreeNode *select(RbTreeAnchor& tree, int index);
+        //   int lowerBoundRank(const RbTreeAnchor&, CMP&, const VALUE&);
+        //   int upperBoundRank(const RbTreeAnchor&, CMP&, const VALUE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nORDER-STATISTIC QUERIES"
+                            "\n=======================\n");
+
+        enum { MAX_NODES = 100 };
+        TestNode nodes[MAX_NODES];
+
+        srand(4);
+        for (int ti = 0; ti <= MAX_NODES; ti += 1 + ti / 8) {
+            const int NUM_NODES = ti;
+            const int MAX_VALUE = 2 * NUM_NODES / 3 + 1;
+
+            RbTreeAnchor        mX;
+            const RbTreeAnchor& X = mX;
+            for (int i = 0; i < NUM_NODES; ++i) {
+                nodes[i].d_value = 2 * nextRandom(MAX_VALUE);
+                Obj::insert(&mX, TestNodeComparator(), &nodes[i]);
+            }
+            LOOP_ASSERT(ti, isValid(X));
+
+            int               index = 0;
+            const RbTreeNode *node  = X.firstNode();
+            for (; X.sentinel() != node; node = Util::next(node), ++index) {
+                LOOP2_ASSERT(ti, index, index == Obj::rank(X, node));
+                LOOP2_ASSERT(ti, index, node  == Obj::select(X, index));
+                LOOP2_ASSERT(ti, index, node  == Obj::select(mX, index));
+            }
+            LOOP_ASSERT(ti, NUM_NODES   == index);
+            LOOP_ASSERT(ti, NUM_NODES   == Obj::rank(X, X.sentinel()));
+            LOOP_ASSERT(ti, X.sentinel() == Obj::select(X, NUM_NODES));
+
+            TestNodeComparator comparator;
+            for (int v = -1; v <= 2 * MAX_VALUE + 1; ++v) {
+                const int EXP_LOWER = Obj::rank(
+                                       X, Util::lowerBound(X, comparator, v));
+                const int EXP_UPPER = Obj::rank(
+                                       X, Util::upperBound(X, comparator, v));
+
+                if (veryVeryVerbose) {
+                    T_ P_(ti) P_(v) P_(EXP_LOWER) P(EXP_UPPER)
+                }
+
+                LOOP2_ASSERT(ti, v, EXP_LOWER ==
+                                       Obj::lowerBoundRank(X, comparator, v));
+                LOOP2_ASSERT(ti, v, EXP_UPPER ==
+                                       Obj::upperBoundRank(X, comparator, v));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MODIFICATION
+        //
+        // Concerns:
+        //: 1 'insert' and 'insertAt' add a node to the tree, and leave a valid
+        //:   red-black tree in which every subtree size is correct, for every
+        //:   rebalancing case (including insertions at the first and last
+        //:   positions, and of duplicate values).
+        //:
+        //: 2 'remove' removes a node from the tree, and leaves a valid
+        //:   red-black tree in which every subtree size is correct, for
+        //:   every rebalancing case (including the removal of the root, of
+        //:   nodes having zero, one, or two children, and of a node whose
+        //:   successor is its right child).
+        //:
+        //: 3 Nodes can be removed until the tree is empty.
+        //
+        // Plan:
+        //: 1 Insert ascending, descending, and pseudo-random sequences of
+        //:   values (including duplicates) into trees of several sizes,
+        //:   alternating between 'insert' and 'insertAt' (with a location
+        //:   found by 'RbTreeUtil::findInsertLocation'), and verify that the
+        //:   tree is valid after each insertion.  (C-1)
+        //:
+        //: 2 Remove nodes from those trees (chosen from the front, the back,
+        //:   the root, and pseudo-random positions) until they are empty,
+        //:   verifying that the tree is valid after each removal.  (C-2..3)
+        //:
+        //: 3 Perform a long pseudo-random sequence of interleaved insertions
+        //:   and removals on a single tree, verifying that the tree is valid
+        //:   after each operation.  (C-1..2)
+        //
+        // Testing:
+        //   void insert(RbTreeAnchor *, const NODE_COMPARATOR&, RbTreeNode *);
+        //   void insertAt(RbTreeAnchor *, RbTreeNode *, bool, RbTreeNode *);
+        //   void remove(RbTreeAnchor *tree, RbTreeNode *node);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMODIFICATION"
+                            "\n============\n");
+
+        enum { MAX_NODES = 128 };
+        TestNode nodes[MAX_NODES];
+
+        enum { ASCENDING, DESCENDING, RANDOM, DUPLICATES, NUM_ORDERS };
+        enum { FRONT, BACK, ROOT, ANY, NUM_REMOVALS };
+
+        srand(3);
+        for (int ti = 1; ti <= MAX_NODES; ti += 1 + ti / 4) {
+            const int NUM_NODES = ti;
+            for (int order = 0; order < NUM_ORDERS; ++order) {
+            for (int removal = 0; removal < NUM_REMOVALS; ++removal) {
+                RbTreeAnchor        mX;
+                const RbTreeAnchor& X = mX;
+
+                for (int i = 0; i < NUM_NODES; ++i) {
+                    nodes[i].d_value = ASCENDING  == order ? i
+                                     : DESCENDING == order ? NUM_NODES - i
+                                     : RANDOM     == order ? nextRandom(1000)
+                                     : nextRandom(4);
+
+                    if (i % 2) {
+                        Obj::insert(&mX, TestNodeComparator(), &nodes[i]);
+                    }
+                    else {
+                        bool              leftChildFlag;
+                        TestNodeComparator comparator;
+                        RbTreeNode *parent = Util::findInsertLocation(
+                                                         &leftChildFlag,
+                                                         &mX,
+                                                         comparator,
+                                                         nodes[i].d_value);
+                        Obj::insertAt(&mX, parent, leftChildFlag, &nodes[i]);
+                    }
+                    LOOP3_ASSERT(ti, order, i, isValid(X));
+                    LOOP3_ASSERT(ti, order, i, i + 1 == X.numNodes());
+                }
+
+                while (0 < X.numNodes()) {
+                    RbTreeNode *node = FRONT == removal
+                                     ? mX.firstNode()
+                                     : BACK  == removal
+                                     ? Util::rightmost(mX.rootNode())
+                                     : ROOT  == removal
+                                     ? mX.rootNode()
+                                     : Obj::select(mX,
+                                                   nextRandom(X.numNodes()));
+                    const int NUM_BEFORE = X.numNodes();
+                    Obj::remove(&mX, node);
+                    LOOP3_ASSERT(ti, order, removal, isValid(X));
+                    LOOP3_ASSERT(ti, order, removal,
+                                 NUM_BEFORE - 1 == X.numNodes());
+                }
+                LOOP3_ASSERT(ti, order, removal, 0 == X.rootNode());
+            }
+            }
+        }
+
+        if (verbose) printf("\tInterleaved insertions and removals.\n");
+
+        RbTreeAnchor        mX;
+        const RbTreeAnchor& X = mX;
+
+        TestNode *freeList[MAX_NODES];
+        int      numFree = MAX_NODES;
+        for (int i = 0; i < MAX_NODES; ++i) {
+            freeList[i] = &nodes[i];
+        }
+
+        for (int i = 0; i < 20000; ++i) {
+            // Favor insertion until the tree is nearly full, and removal
+            // thereafter, so that the tree repeatedly grows and shrinks.
+
+            const bool insertFlag = 0 < numFree
+                                 && (X.numNodes() == 0
+                                  || nextRandom(MAX_NODES) < numFree
+                                  || nextRandom(4) == 0);
+            if (insertFlag) {
+                TestNode *node = freeList[--numFree];
+                node->d_value = nextRandom(200);
+                Obj::insert(&mX, TestNodeComparator(), node);
+            }
+            else {
+                RbTreeNode *node = Obj::select(mX, nextRandom(X.numNodes()));
+                Obj::remove(&mX, node);
+                freeList[numFree++] = static_cast<TestNode *>(node);
+            }
+            LOOP_ASSERT(i, isValid(X));
+            LOOP_ASSERT(i, MAX_NODES == X.numNodes() + numFree);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // SUBTREE SIZES AND 'isWellCounted'
+        //
+        // Concerns:
+        //: 1 'RbTreeCountedNode::setSubtreeSize' sets the value returned by
+        //:   'subtreeSize', and does not affect the links or color of the
+        //:   node.
+        //:
+        //: 2 'RbTreeCountUtil::subtreeSize' returns 0 for a null node, and
+        //:   the subtree size of the node otherwise.
+        //:
+        //: 3 'isWellCounted' returns 'true' for an empty tree.
+        //:
+        //: 4 'isWellCounted' returns 'true' for a tree whose counts are
+        //:   correct, and 'false' if the count of any node (including the
+        //:   root) is wrong.
+        //
+        // Plan:
+        //: 1 Set and verify the subtree size of a node having set links and
+        //:   color.  (C-1..2)
+        //:
+        //: 2 Build small trees by hand, with correct counts, and verify that
+        //:   'isWellCounted' returns 'true'.  Then, for each node in turn,
+        //:   corrupt its count and verify that 'isWellCounted' returns
+        //:   'false'.  (C-3..4)
+        //
+        // Testing:
+        //   void setSubtreeSize(int value);
+        //   int subtreeSize() const;
+        //   int subtreeSize(const RbTreeNode *subtree);
+        //   bool isWellCounted(const RbTreeAnchor& tree);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBTREE SIZES AND 'isWellCounted'"
+                            "\n=================================\n");
+
+        TestNode a, b, c;
+        a.reset(&b, &c, 0, RbTreeNode::BSLALG_RED);
+        a.setSubtreeSize(5);
+        ASSERT(5  == a.subtreeSize());
+        ASSERT(&b == a.parent());
+        ASSERT(&c == a.leftChild());
+        ASSERT(0  == a.rightChild());
+        ASSERT(a.isRed());
+        a.setSubtreeSize(1);
+        ASSERT(1  == a.subtreeSize());
+        ASSERT(1  == Obj::subtreeSize(&a));
+        ASSERT(0  == Obj::subtreeSize(0));
+
+        RbTreeAnchor empty;
+        ASSERT(Obj::isWellCounted(empty));
+
+        //           b
+        //         /   \.
+        //        a     c
+
+        RbTreeAnchor tree;
+        a.d_value = 1;
+        b.d_value = 2;
+        c.d_value = 3;
+        a.reset(&b, 0, 0, RbTreeNode::BSLALG_RED);
+        c.reset(&b, 0, 0, RbTreeNode::BSLALG_RED);
+        b.reset(tree.sentinel(), &a, &c, RbTreeNode::BSLALG_BLACK);
+        tree.reset(&b, &a, 3);
+        ASSERT(Util::isWellFormed(tree, TestNodeComparator()));
+
+        TestNode *NODES[] = { &a, &b, &c };
+        const int SIZES[] = { 1, 3, 1 };
+        for (int i = 0; i < 3; ++i) {
+            NODES[i]->setSubtreeSize(SIZES[i]);
+        }
+        ASSERT(Obj::isWellCounted(tree));
+
+        for (int i = 0; i < 3; ++i) {
+            NODES[i]->setSubtreeSize(SIZES[i] + 1);
+            LOOP_ASSERT(i, !Obj::isWellCounted(tree));
+            NODES[i]->setSubtreeSize(SIZES[i] - 1);
+            LOOP_ASSERT(i, !Obj::isWellCounted(tree));
+            NODES[i]->setSubtreeSize(SIZES[i]);
+            LOOP_ASSERT(i, Obj::isWellCounted(tree));
+        }
+
+        // A root count consistent with the children, but not with the
+        // number of nodes in the anchor, is detected.
+
+        tree.setNumNodes(4);
+        ASSERT(!Obj::isWellCounted(tree));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert a few nodes, query them, and remove them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        TestNode      nodes[10];
+        RbTreeAnchor tree;
+        for (int i = 0; i < 10; ++i) {
+            nodes[i].d_value = 9 - i;
+            Obj::insert(&tree, TestNodeComparator(), &nodes[i]);
+            ASSERT(isValid(tree));
+        }
+        ASSERT(10 == Obj::subtreeSize(tree.rootNode()));
+        for (int i = 0; i < 10; ++i) {
+            LOOP_ASSERT(i, i == value(Obj::select(tree, i)));
+            LOOP_ASSERT(i, 9 - i == Obj::rank(tree, &nodes[i]));
+        }
+        Obj::remove(&tree, &nodes[5]);
+        ASSERT(isValid(tree));
+        ASSERT(5 == value(Obj::select(tree, 4)));
+        ASSERT(6 == value(Obj::select(tree, 5)));
+        ASSERT(4 == Obj::rank(tree, &nodes[4]));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
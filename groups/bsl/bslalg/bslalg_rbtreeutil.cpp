@@ -46,14 +46,47 @@ static void indent(FILE *file, int level, int spacesPerLevel)
     }
 }
 
-static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
-                                    RbTreeNode   *node,
-                                    RbTreeNode   *parentOfNode)
+static inline
+void rotateLeftAndNotify(RbTreeNode                   *node,
+                         RbTreeUtil::RotationCallback  rotationCallback)
+    // Perform a counter-clockwise rotation on the specified 'node' (see
+    // 'RbTreeUtil::rotateLeft'), and then invoke the specified
+    // 'rotationCallback', unless it is 0, on 'node' and the pivot that
+    // replaced it.
+{
+    RbTreeNode *pivot = node->rightChild();
+    RbTreeUtil::rotateLeft(node);
+    if (rotationCallback) {
+        rotationCallback(node, pivot);
+    }
+}
+
+static inline
+void rotateRightAndNotify(RbTreeNode                   *node,
+                          RbTreeUtil::RotationCallback  rotationCallback)
+    // Perform a clockwise rotation on the specified 'node' (see
+    // 'RbTreeUtil::rotateRight'), and then invoke the specified
+    // 'rotationCallback', unless it is 0, on 'node' and the pivot that
+    // replaced it.
+{
+    RbTreeNode *pivot = node->leftChild();
+    RbTreeUtil::rotateRight(node);
+    if (rotationCallback) {
+        rotationCallback(node, pivot);
+    }
+}
+
+static void recolorTreeAfterRemoval(
+                                RbTreeAnchor                 *tree,
+                                RbTreeNode                   *node,
+                                RbTreeNode                   *parentOfNode,
+                                RbTreeUtil::RotationCallback  rotationCallback)
      // Rebalance the nodes in the specified 'tree', which has been
      // potentially unbalanced by the insertion of the the specified 'node' as
-     // the child of the specified 'parentOfNode'.  The behavior is undefined
-     // unless 'tree' refers to a valid binary search tree (but not
-     // necessarily a valid red-black tree), and 'tree' would be a valid
+     // the child of the specified 'parentOfNode', invoking the specified
+     // 'rotationCallback' (unless it is 0) after each rotation.  The behavior
+     // is undefined unless 'tree' refers to a valid binary search tree (but
+     // not necessarily a valid red-black tree), and 'tree' would be a valid
      // red-black tree if 'node' were removed (i.e., the potential violation
      // of red-black constraints is localized to 'node').
 {
@@ -63,7 +96,6 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
     // consequently to avoid setting a color (BLACK) on a (already BLACK) null
     // node.
 
-    typedef RbTreeUtil Op;
     while (node != tree->rootNode() && (0 == node || node->isBlack())) {
         if (node == parentOfNode->leftChild()) {
             RbTreeNode *sibling = parentOfNode->rightChild();
@@ -72,7 +104,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
 
                 sibling->makeBlack();
                 parentOfNode->makeRed();
-                Op::rotateLeft(parentOfNode);
+                rotateLeftAndNotify(parentOfNode, rotationCallback);
                 sibling = parentOfNode->rightChild();
             }
 
@@ -92,7 +124,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                         sibling->leftChild()->makeBlack();
                     }
                     sibling->makeRed();
-                    Op::rotateRight(sibling);
+                    rotateRightAndNotify(sibling, rotationCallback);
                     sibling = parentOfNode->rightChild();
                 }
                 // Case 4.
@@ -102,7 +134,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                 if (sibling->rightChild()) {
                     sibling->rightChild()->makeBlack();
                 }
-                Op::rotateLeft(parentOfNode);
+                rotateLeftAndNotify(parentOfNode, rotationCallback);
                 break;
             }
         }
@@ -113,7 +145,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
 
                 sibling->makeBlack();
                 parentOfNode->makeRed();
-                Op::rotateRight(parentOfNode);
+                rotateRightAndNotify(parentOfNode, rotationCallback);
                 sibling = parentOfNode->leftChild();
             }
 
@@ -133,7 +165,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                         sibling->rightChild()->makeBlack();
                     }
                     sibling->makeRed();
-                    Op::rotateLeft(sibling);
+                    rotateLeftAndNotify(sibling, rotationCallback);
                     sibling = parentOfNode->leftChild();
                 }
                 // Case 4.
@@ -143,7 +175,7 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
                 if (sibling->leftChild()) {
                     sibling->leftChild()->makeBlack();
                 }
-                Op::rotateRight(parentOfNode);
+                rotateRightAndNotify(parentOfNode, rotationCallback);
                 break;
             }
         }
@@ -214,6 +246,15 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
                           RbTreeNode   *parentNode,
                           bool          leftChildFlag,
                           RbTreeNode   *newNode)
+{
+    insertAt(tree, parentNode, leftChildFlag, newNode, 0);
+}
+
+void RbTreeUtil::insertAt(RbTreeAnchor     *tree,
+                          RbTreeNode       *parentNode,
+                          bool              leftChildFlag,
+                          RbTreeNode       *newNode,
+                          RotationCallback  rotationCallback)
 {
     BSLS_ASSERT(parentNode);
     BSLS_ASSERT(newNode);
@@ -275,7 +316,7 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
                     // case 3.
 
                     node = node->parent();
-                    rotateLeft(node);
+                    rotateLeftAndNotify(node, rotationCallback);
                 }
 
                 // Case 3:  grandParent[node] -> (X:B)
@@ -290,7 +331,8 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
 
                 node->parent()->makeBlack();
                 node->parent()->parent()->makeRed();
-                rotateRight(node->parent()->parent());
+                rotateRightAndNotify(node->parent()->parent(),
+                                     rotationCallback);
             }
         }
         else {
@@ -308,12 +350,13 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
             else {
                 if (isLeftChild(node)) {
                     node = node->parent();
-                    rotateRight(node);
+                    rotateRightAndNotify(node, rotationCallback);
 
                 }
                 node->parent()->makeBlack();
                 node->parent()->parent()->makeRed();
-                rotateLeft(node->parent()->parent());
+                rotateLeftAndNotify(node->parent()->parent(),
+                                    rotationCallback);
             }
         }
     }
@@ -323,6 +366,13 @@ void RbTreeUtil::insertAt(RbTreeAnchor *tree,
 }
 
 void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
+{
+    remove(tree, node, 0);
+}
+
+void RbTreeUtil::remove(RbTreeAnchor     *tree,
+                        RbTreeNode       *node,
+                        RotationCallback  rotationCallback)
 {
     BSLS_ASSERT(0 != node);
     BSLS_ASSERT(0 != tree);
@@ -433,7 +483,7 @@ void RbTreeUtil::remove(RbTreeAnchor *tree, RbTreeNode *node)
     }
 
     if (yIsBlackFlag) {
-        recolorTreeAfterRemoval(tree, x, parentOfX);
+        recolorTreeAfterRemoval(tree, x, parentOfX, rotationCallback);
     }
     BSLS_ASSERT(!tree->rootNode() ||
                 tree->sentinel() == tree->rootNode()->parent());
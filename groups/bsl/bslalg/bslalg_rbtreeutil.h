@@ -70,6 +70,11 @@ BSLS_IDENT("$Id$ $CSID$")
 //  swap                Swap the contents of two trees.
 //..
 //
+// The 'insertAt' and 'remove' methods may also be supplied a
+// 'RbTreeUtil::RotationCallback' that is notified of each rotation performed
+// while rebalancing the tree, so that augmented node types (see
+// 'bslalg_rbtreecountutil') can maintain data that describes their subtrees.
+//
 ///Utility
 ///- - - -
 // The following algorithms are typically used when implementing higher-level
@@ -691,6 +696,10 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_STDIO
 #include <stdio.h>
 #define INCLUDED_STDIO
@@ -713,6 +722,17 @@ struct RbTreeUtil {
     // otherwise (see 'bsldoc_glossary').  'copyTree' provides the *strong*
     // guarantee.
 
+    // TYPES
+    typedef void (*RotationCallback)(RbTreeNode *node, RbTreeNode *pivot);
+        // 'RotationCallback' is an alias for a function that is invoked by
+        // the rebalancing steps of 'insertAt' and 'remove' immediately after
+        // the specified 'pivot' has been rotated into the position previously
+        // held by the specified 'node' (so that 'node' is now a child of
+        // 'pivot').  Such a callback allows a tree whose nodes carry data
+        // summarizing their subtree (e.g., a count of nodes) to repair that
+        // data as the shape of the tree changes.  Note that only 'node' and
+        // 'pivot' are roots of subtrees whose set of nodes has changed.
+
     // CLASS METHODS
                                  // Navigation
 
@@ -850,7 +870,11 @@ struct RbTreeUtil {
         //..
         // The behavior is undefined unless 'result' is an empty tree,
         // 'original' is a well-formed (see 'isWellFormed'), and
-        // 'nodeFactory->deleteNode' does not throw.
+        // 'nodeFactory->deleteNode' does not throw.  Note that the nodes are
+        // created in pre-order (i.e., each node before its left sub-tree, and
+        // its left sub-tree before its right sub-tree), so a factory that
+        // supplies consecutive memory blocks (e.g., from a previously reserved
+        // chunk) places each node having a left child immediately before it.
 
     template <class FACTORY>
     static void deleteTree(RbTreeAnchor *tree, FACTORY *nodeFactory);
@@ -980,12 +1004,38 @@ struct RbTreeUtil {
         // conjunction with the 'findInsertLocation' or
         // 'findUniqueInsertLocation' methods.
 
+    static void insertAt(RbTreeAnchor     *tree,
+                         RbTreeNode       *parentNode,
+                         bool              leftChildFlag,
+                         RbTreeNode       *newNode,
+                         RotationCallback  rotationCallback);
+        // Insert the specified 'newNode' into the specified 'tree' as either
+        // the left or right child of the specified 'parentNode', as indicated
+        // by the specified 'leftChildFlag', and then rebalance the tree so
+        // that it is a valid red-black tree (see 'validateRbTree'), invoking
+        // the specified 'rotationCallback' (unless it is 0) after each
+        // rotation performed while rebalancing.  The behavior is undefined
+        // unless the preconditions of the 4-argument 'insertAt' method are
+        // met.
+
     static void remove(RbTreeAnchor *tree, RbTreeNode *node);
         // Remove the specified 'node' from the specified 'tree', and then
         // rebalance 'tree' so that it again forms a valid red-black tree (see
         // 'validateRbTree').  The behavior is undefined unless 'tree' is
         // well-formed (see 'isWellFormed').
 
+    static void remove(RbTreeAnchor     *tree,
+                       RbTreeNode       *node,
+                       RotationCallback  rotationCallback);
+        // Remove the specified 'node' from the specified 'tree', and then
+        // rebalance 'tree' so that it again forms a valid red-black tree (see
+        // 'validateRbTree'), invoking the specified 'rotationCallback' (unless
+        // it is 0) after each rotation performed while rebalancing.  If
+        // 'node' has two children, it is replaced by its successor, which
+        // takes over the position and color of 'node' before any rotation is
+        // performed.  The behavior is undefined unless 'tree' is well-formed
+        // (see 'isWellFormed').
+
     static void swap(RbTreeAnchor *a, RbTreeAnchor *b);
         // Efficiently exchange the nodes in the specified 'a' tree with the
         // nodes in the specified 'b' tree.  This method provides the no-throw
@@ -1375,7 +1425,10 @@ void RbTreeUtil::copyTree(RbTreeAnchor        *result,
     }
 
     // Perform an pre-order traversal of the nodes of the tree, invoking
-    // 'nodeFactory->createNode()' on each node.
+    // 'nodeFactory->createNode()' on each node.  The nodes of 'original' may
+    // be scattered in memory, so on arriving at each node we prefetch its
+    // children, overlapping the cache misses they incur with the creation of
+    // the node's copy.
 
     const RbTreeNode *originalNode = original.rootNode();
 
@@ -1390,9 +1443,16 @@ void RbTreeUtil::copyTree(RbTreeAnchor        *result,
     copiedNode->setParent(result->sentinel());
     copiedNode->setLeftChild(0);
     copiedNode->setRightChild(0);
+
+    bsls::PerformanceHint::prefetchForReading(originalNode->leftChild());
+    bsls::PerformanceHint::prefetchForReading(originalNode->rightChild());
     do {
         if (0 != originalNode->leftChild() && 0 == copiedNode->leftChild()) {
             originalNode = originalNode->leftChild();
+            bsls::PerformanceHint::prefetchForReading(
+                                                  originalNode->leftChild());
+            bsls::PerformanceHint::prefetchForReading(
+                                                 originalNode->rightChild());
             RbTreeNode *newNode = nodeFactory->createNode(*originalNode);
             copiedNode->setLeftChild(newNode);
             newNode->setColor(originalNode->color());
@@ -1405,6 +1465,10 @@ void RbTreeUtil::copyTree(RbTreeAnchor        *result,
         else if (0 != originalNode->rightChild() &&
                  0 == copiedNode->rightChild()) {
             originalNode = originalNode->rightChild();
+            bsls::PerformanceHint::prefetchForReading(
+                                                  originalNode->leftChild());
+            bsls::PerformanceHint::prefetchForReading(
+                                                 originalNode->rightChild());
             RbTreeNode *newNode = nodeFactory->createNode(*originalNode);
             copiedNode->setRightChild(newNode);
             newNode->setColor(originalNode->color());
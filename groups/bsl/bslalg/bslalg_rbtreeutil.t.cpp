@@ -73,7 +73,9 @@ using namespace bslalg;
 // [16] RbTreeNode *findUniqueInsertLocation(int *,Anchor*,COMP&,VALUE&,Node*);
 // [ 9] void insert(RbTreeAnchor *, const COMP& , RbTreeNode *);
 // [17] void insertAt(RbTreeAnchor *,RbTreeNode *, bool, RbTreeNode *);
+// [17] void insertAt(RbTreeAnchor *,RbTreeNode *,bool,RbTreeNode *,CB);
 // [18] void remove(RbTreeAnchor *, RbTreeNode *);
+// [18] void remove(RbTreeAnchor *, RbTreeNode *, RotationCallback);
 // [21] void swap(RbTreeAnchor *, RbTreeAnchor *);
 // [22] bool isLeftChild(const RbTreeNode *);
 // [22] bool isRightChild(const RbTreeNode *);
@@ -760,6 +762,21 @@ bool isInRange(const RbTreeNode *node,
     return false;
 }
 
+int  rotationCount     = 0;     // number of calls to 'recordRotation'
+bool rotationsAreValid = true;  // 'false' if 'recordRotation' was called
+                                // for a rotation that did not take place
+
+void recordRotation(RbTreeNode *node, RbTreeNode *pivot)
+    // Increment 'rotationCount', and set 'rotationsAreValid' to 'false'
+    // unless the specified 'pivot' is the parent of the specified 'node'.
+    // Note that this function is a 'RbTreeUtil::RotationCallback'.
+{
+    ++rotationCount;
+    if (node->parent() != pivot) {
+        rotationsAreValid = false;
+    }
+}
+
 RbTreeNode *nodeAtOffset(RbTreeAnchor *tree, int offset)
     // Return the node at the specified 'offset', according to an infix tree
     // traversal starting from the left-most node in 'tree'.
@@ -4919,7 +4936,11 @@ void TestDriver<VALUE>::testCase17()
     //:  3 That 'insertAt' will successfully insert a node regardless of its
     //:    state.
     //:
-    //:  4 QoI: Asserted precondition violations are detected when enabled.
+    //:  4 The overload taking a rotation callback produces the same tree as
+    //:    the overload without one, and invokes the callback once for each
+    //:    rotation (after the rotation), unless the callback is 0.
+    //:
+    //:  5 QoI: Asserted precondition violations are detected when enabled.
     //
     // Plan:
     //:  1 Create an empty tree and verify that 'insertAt' correctly inserts a
@@ -4956,12 +4977,19 @@ void TestDriver<VALUE>::testCase17()
     //:          resulting tree is well formed and includes the node. (C-2,
     //:          C-3)
     //:
-    //:  4 Call 'insertAt' with 0 for 'tree', 'parentNode', and 'newNode',
+    //:  4 Insert a sequence of values (containing runs of ascending values)
+    //:    using 'insertAt' with a recording callback, and with a 0 callback,
+    //:    and using 'insert'.  Verify that the resulting trees are equal
+    //:    after each insertion, and that the callback was invoked, after
+    //:    valid rotations, only when supplied.  (C-4)
+    //:
+    //:  5 Call 'insertAt' with 0 for 'tree', 'parentNode', and 'newNode',
     //:    respectively and ensure that assertions are thrown from appropriate
-    //:    build modes.
+    //:    build modes.  (C-5)
     //
     // Testing:
     //    void insertAt(RbTreeAnchor *, RbTreeNode *,bool, RbTreeNode *);
+    //    void insertAt(RbTreeAnchor *,RbTreeNode *,bool,RbTreeNode *,CB);
     // ------------------------------------------------------------------------
 
     bslma::TestAllocator   ta;
@@ -5178,6 +5206,49 @@ void TestDriver<VALUE>::testCase17()
         }
     }
 
+    if (veryVerbose)
+        printf("\tTest insertAt with a rotation callback\n");
+    for (int withCallback = 0; withCallback < 2; ++withCallback) {
+        enum {
+            NUM_VALUES  = 200,
+            VALUE_LIMIT = 50
+        };
+
+        NodeArray    nodes(&ta);
+        NodeArray    expNodes(&ta);
+        RbTreeAnchor x; const RbTreeAnchor& X = x;
+        RbTreeAnchor y; const RbTreeAnchor& Y = y;
+        nodes.reset(NUM_VALUES);
+        expNodes.reset(NUM_VALUES);
+
+        rotationCount     = 0;
+        rotationsAreValid = true;
+        for (int j = 0; j < NUM_VALUES; ++j) {
+            const int DATUM = j % 4 ? j : rand() % VALUE_LIMIT;
+            nodes[j].value()    = V.create(DATUM);
+            expNodes[j].value() = V.create(DATUM);
+
+            bool        leftChildFlag;
+            RbTreeNode *parent = Obj::findInsertLocation(&leftChildFlag,
+                                                         &x,
+                                                         C,
+                                                         V.create(DATUM));
+            Obj::insertAt(&x,
+                          parent,
+                          leftChildFlag,
+                          &nodes[j],
+                          withCallback ? &recordRotation : 0);
+            Obj::insert(&y, C, &expNodes[j]);
+
+            ASSERTV(withCallback, j, Obj::isWellFormed(X, C));
+            ASSERTV(withCallback, j,
+                    areTreesEqual(X.rootNode(), Y.rootNode(), C));
+        }
+        ASSERTV(withCallback, rotationCount,
+                (0 != withCallback) == (0 < rotationCount));
+        ASSERTV(withCallback, rotationsAreValid);
+    }
+
     if (veryVerbose) printf("\tNegative testing.\n");
     {
         bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
@@ -5203,7 +5274,11 @@ void TestDriver<VALUE>::testCase18()
     //:  1 That 'remove' removes the indicated node from the tree, and the
     //:    resulting tree is a balanced red-black tree.
     //:
-    //:  2 QoI: Asserted precondition violations are detected when enabled.
+    //:  2 The overload taking a rotation callback produces the same tree as
+    //:    the overload without one, and invokes the callback once for each
+    //:    rotation (after the rotation), unless the callback is 0.
+    //:
+    //:  3 QoI: Asserted precondition violations are detected when enabled.
     //
     // Plan:
     //:  1 For a series of pre-defined test trees (C-1):
@@ -5228,11 +5303,18 @@ void TestDriver<VALUE>::testCase18()
     //:
     //:      3 After all the nodes are removed, verify the tree is empty.
     //:
-    //:  3 Call 'remove' with 0 for 'tree' 'newNode', respectively and ensure
-    //:    that assertions are thrown from appropriate build modes.
+    //:  3 Remove the nodes of two equal random trees, in the same
+    //:    (scattered) order, using 'remove' with a recording callback (or
+    //:    with a 0 callback) and without one.  Verify that the trees are equal
+    //:    after each removal, and that the callback was invoked, after valid
+    //:    rotations, only when supplied.  (C-2)
+    //:
+    //:  4 Call 'remove' with 0 for 'tree' 'newNode', respectively and ensure
+    //:    that assertions are thrown from appropriate build modes.  (C-3)
     //
     // Testing:
     //    void remove(RbTreeAnchor *, RbTreeNode *);
+    //    void remove(RbTreeAnchor *, RbTreeNode *, RotationCallback);
     // ------------------------------------------------------------------------
 
     bslma::TestAllocator   ta;
@@ -5311,6 +5393,55 @@ void TestDriver<VALUE>::testCase18()
         }
     }
 
+    if (veryVerbose)
+        printf("\tTest remove with a rotation callback\n");
+    for (int withCallback = 0; withCallback < 3; ++withCallback) {
+        enum {
+            NUM_VALUES  = 200,
+            VALUE_LIMIT = 100,
+            STRIDE      = 7    // relatively prime to 'NUM_VALUES'
+        };
+
+        NodeArray    nodes(&ta);
+        NodeArray    expNodes(&ta);
+        RbTreeAnchor x; const RbTreeAnchor& X = x;
+        RbTreeAnchor y; const RbTreeAnchor& Y = y;
+        nodes.reset(NUM_VALUES);
+        expNodes.reset(NUM_VALUES);
+        for (int j = 0; j < NUM_VALUES; ++j) {
+            const int DATUM = rand() % VALUE_LIMIT;
+            nodes[j].value()    = V.create(DATUM);
+            expNodes[j].value() = V.create(DATUM);
+            Obj::insert(&x, C, &nodes[j]);
+            Obj::insert(&y, C, &expNodes[j]);
+        }
+
+        rotationCount     = 0;
+        rotationsAreValid = true;
+        for (int j = 0; j < NUM_VALUES; ++j) {
+            const int INDEX = (j * STRIDE) % NUM_VALUES;
+
+            if (2 == withCallback) {
+                Obj::remove(&x, &nodes[INDEX], 0);
+            }
+            else if (withCallback) {
+                Obj::remove(&x, &nodes[INDEX], &recordRotation);
+            }
+            else {
+                Obj::remove(&x, &nodes[INDEX]);
+            }
+            Obj::remove(&y, &expNodes[INDEX]);
+
+            ASSERTV(withCallback, j, Obj::isWellFormed(X, C));
+            ASSERTV(withCallback, j,
+                    areTreesEqual(X.rootNode(), Y.rootNode(), C));
+        }
+        ASSERTV(withCallback, 0 == X.numNodes());
+        ASSERTV(withCallback, rotationCount,
+                (1 == withCallback) == (0 < rotationCount));
+        ASSERTV(withCallback, rotationsAreValid);
+    }
+
     if (veryVerbose) printf("\tNegative testing.\n");
     {
         bsls::AssertFailureHandlerGuard hG(bsls::AssertTest::failTestDriver);
@@ -5346,7 +5477,10 @@ void TestDriver<VALUE>::testCase20()
     //:  4 If an exception is thrown by 'createNode', then 'deleteNode' is
     //:    called on every newly created node.
     //:
-    //:  5 QoI: Asserted precondition violations are detected when enabled.
+    //:  5 The nodes of the result tree are created in pre-order, i.e., the
+    //:    root first, and each node immediately before its left child.
+    //:
+    //:  6 QoI: Asserted precondition violations are detected when enabled.
     //
     //Plan:
     //:  1 Create an empty tree, call 'copyTree' on it, and verify the
@@ -5356,13 +5490,15 @@ void TestDriver<VALUE>::testCase20()
     //:  2 For a series of pre-defined test trees, call 'copyTree' and verify
     //:    the factory created the correct number of nodes, and that the
     //:    resulting tree is a well-formed tree having the same set of node
-    //:    values (but different node addresses). (C-2, C-3)
+    //:    values (but different node addresses), that the root is the first
+    //:    node created by the factory, and that the left child of each node is
+    //:    the node created immediately after it. (C-2, C-3, C-5)
     //:
     //:  3 For a series of random trees containing some duplicate values (C-1),
     //:    call 'copyTree' and verify the factory created the correct number
     //:    of nodes, and that the resulting tree is a well-formed tree having
-    //:    the same set of node values (but different node addresses). (C-2,
-    //:    C-3)
+    //:    the same set of node values (but different node addresses), created
+    //:    in pre-order. (C-2, C-3, C-5)
     //:
     //:  3 For a series of random trees containing some duplicate values (C-1),
     //:    create a test factory having a series of node-creation limits, then
@@ -5373,7 +5509,7 @@ void TestDriver<VALUE>::testCase20()
     //:
     //:  4 Call 'copyTree' with 0 for the factory, 0 for the result, and a
     //:    non-empty tree for the result, respectively, and ensure
-    //:    that assertions are thrown from appropriate build modes.
+    //:    that assertions are thrown from appropriate build modes. (C-6)
     //
     // Testing:
     //   void RbTreeUtil::copyTree(RbTreeAnchor *, RbTreeAnchor &, FACTORY *);
@@ -5428,8 +5564,11 @@ void TestDriver<VALUE>::testCase20()
             const RbTreeNode *xNode = X.firstNode();
             const RbTreeNode *yNode = Y.firstNode();
 
+            ASSERTV(LINE, 0 == NUM_NODES || f.nodes().data() == Y.rootNode());
             while (X.sentinel() != xNode) {
                 ASSERTV(LINE, xNode != yNode);
+                ASSERTV(LINE, !yNode->leftChild()
+                     || toNode(yNode) + 1 == yNode->leftChild());
                 ASSERTV(LINE, V.getValue(toNode(xNode)->value()) ==
                               V.getValue(toNode(yNode)->value()));
                 xNode = Obj::next(xNode);
@@ -5476,8 +5615,11 @@ void TestDriver<VALUE>::testCase20()
             const RbTreeNode *xNode = X.firstNode();
             const RbTreeNode *yNode = Y.firstNode();
 
+            ASSERT(f.nodes().data() == Y.rootNode());
             while (X.sentinel() != xNode) {
                 ASSERTV(xNode != yNode);
+                ASSERTV(!yNode->leftChild()
+                     || toNode(yNode) + 1 == yNode->leftChild());
                 ASSERTV(V.getValue(toNode(xNode)->value()) ==
                         V.getValue(toNode(yNode)->value()));
                 xNode = Obj::next(xNode);
@@ -0,0 +1,788 @@
+// bslalg_searchutil.t.cpp                                            -*-C++-*-
+
+#include <bslalg_searchutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_nativestd.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // native_std::lower_bound, native_std::upper_bound
+#include <functional>   // native_std::greater
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi(), malloc(), free()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides searches whose results can be checked
+// against those of 'native_std::lower_bound' and 'native_std::upper_bound'.
+// We first verify the traversal of the Eytzinger layout in sorted order
+// against a recursive reference layout, for every number of elements up to a
+// few hundred.  We then search sorted arrays of every length up to a few
+// dozen, having runs of equal elements, for every value between (and
+// beyond) their elements, using the default comparator, a comparator
+// ordering the elements in decreasing order, and a searched value of a
+// different type, both directly and in Eytzinger layout, and compare the
+// results with those of the standard library.  A performance test (negative
+// case) compares the searches with 'native_std::lower_bound' for arrays from
+// a few kilobytes to a gigabyte.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] TYPE *lowerBound(TYPE *first, TYPE *last, const VALUE& value);
+// [ 3] TYPE *lowerBound(TYPE *, TYPE *, const VALUE&, COMPARATOR);
+// [ 3] TYPE *upperBound(TYPE *first, TYPE *last, const VALUE& value);
+// [ 3] TYPE *upperBound(TYPE *, TYPE *, const VALUE&, COMPARATOR);
+// [ 2] size_t eytzingerBegin(size_t numElements);
+// [ 2] size_t eytzingerNext(size_t index, size_t numElements);
+// [ 4] void eytzingerLayout(TYPE *result, const TYPE *, const TYPE *);
+// [ 4] size_t eytzingerLowerBound(const TYPE *, size_t, const VALUE&);
+// [ 4] size_t eytzingerLowerBound(const TYPE *, size_t, const V&, COMP);
+// [ 4] size_t eytzingerUpperBound(const TYPE *, size_t, const VALUE&);
+// [ 4] size_t eytzingerUpperBound(const TYPE *, size_t, const V&, COMP);
+//
+// IMPLEMENTATION
+// [ 2] int SearchUtil_Imp::countTrailingOnes(size_t value);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'native_std::lower_bound'
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::SearchUtil  Obj;
+typedef bsls::Types::Uint64 Uint64;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+static Uint64 nextRandom(Uint64 *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // a pseudo-random value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+static std::size_t referenceLayout(int         *result,
+                                   const int   *sorted,
+                                   std::size_t  sortedIndex,
+                                   std::size_t  position,
+                                   std::size_t  numElements)
+    // Assign to the elements of the specified 'result' array, in Eytzinger
+    // layout, the elements of the specified 'sorted' array of the specified
+    // 'numElements' belonging to the subtree rooted at the specified
+    // one-based 'position', starting from the element at the specified
+    // 'sortedIndex', by recursive in-order traversal, and return the index
+    // of the first element of 'sorted' not assigned.
+{
+    if (position <= numElements) {
+        sortedIndex = referenceLayout(result,
+                                      sorted,
+                                      sortedIndex,
+                                      2 * position,
+                                      numElements);
+        result[position - 1] = sorted[sortedIndex++];
+        sortedIndex = referenceLayout(result,
+                                      sorted,
+                                      sortedIndex,
+                                      2 * position + 1,
+                                      numElements);
+    }
+    return sortedIndex;
+}
+
+struct Key {
+    // This 'struct' provides a searched value of a type other than that of
+    // the searched elements, to verify that searches do not convert it.
+
+    int d_value;
+};
+
+bool operator<(int lhs, const Key& rhs)
+{
+    return lhs < rhs.d_value;
+}
+
+bool operator<(const Key& lhs, int rhs)
+{
+    return lhs.d_value < rhs;
+}
+
+static void benchmark(std::size_t numBytes, int numQueries)
+    // Print the average time taken to search a sorted array of 'int' values
+    // occupying the specified 'numBytes', and the same values in Eytzinger
+    // layout, for the specified 'numQueries' random values, using
+    // 'native_std::lower_bound', 'SearchUtil::lowerBound', and
+    // 'SearchUtil::eytzingerLowerBound'.
+{
+    const std::size_t numElements = numBytes / sizeof(int);
+
+    native_std::vector<int> sorted(numElements);
+    for (std::size_t i = 0; i < numElements; ++i) {
+        sorted[i] = static_cast<int>(2 * i);
+    }
+
+    // Align the position preceding the layout to a cache line.
+
+    char *memory = static_cast<char *>(malloc(numBytes + 128));
+    int  *layout = reinterpret_cast<int *>(
+                (reinterpret_cast<std::size_t>(memory) + 63) / 64 * 64) + 1;
+    Obj::eytzingerLayout(layout, &sorted[0], &sorted[0] + numElements);
+
+    // Search for values not greater than the greatest element, so that every
+    // search finds an element.
+
+    native_std::vector<int> queries(numQueries);
+    Uint64                  state = 7;
+    for (int i = 0; i < numQueries; ++i) {
+        queries[i] = static_cast<int>(nextRandom(&state)
+                                                     % (2 * numElements - 1));
+    }
+
+    const int *first = &sorted[0];
+    const int *last  = first + numElements;
+
+    double times[3];
+    Uint64 sums[3] = { 0, 0, 0 };
+    for (int algorithm = 0; algorithm < 3; ++algorithm) {
+        bsls::Stopwatch timer;
+        timer.start();
+        switch (algorithm) {
+          case 0: {
+            for (int i = 0; i < numQueries; ++i) {
+                sums[0] += *native_std::lower_bound(first, last, queries[i]);
+            }
+          } break;
+          case 1: {
+            for (int i = 0; i < numQueries; ++i) {
+                sums[1] += *Obj::lowerBound(first, last, queries[i]);
+            }
+          } break;
+          case 2: {
+            for (int i = 0; i < numQueries; ++i) {
+                sums[2] += layout[Obj::eytzingerLowerBound(layout,
+                                                           numElements,
+                                                           queries[i])];
+            }
+          } break;
+        }
+        timer.stop();
+        times[algorithm] = timer.elapsedTime() * 1e9 / numQueries;
+    }
+    ASSERT(sums[0] == sums[1]);
+    ASSERT(sums[0] == sums[2]);
+
+    if (numBytes >= 1024 * 1024) {
+        printf("%8u MB", static_cast<unsigned>(numBytes >> 20));
+    }
+    else {
+        printf("%8u KB", static_cast<unsigned>(numBytes >> 10));
+    }
+    printf(" %12.1f %12.1f %12.1f\n", times[0], times[1], times[2]);
+
+    free(memory);
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up a Price Level
+///- - - - - - - - - - - - - - - - - -
+// Suppose that we maintain the price levels of an order book as a sorted
+// array of prices, in ticks, and wish to find the first level at or above a
+// given price.
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // Verify that no test case allocates from the default allocator.
+
+    bslma::TestAllocator         defaultAllocator("default");
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// First, we create the array of price levels:
+//..
+        const int levels[] = { 100, 102, 105, 105, 110, 120, 121, 150 };
+        const int NUM_LEVELS = sizeof levels / sizeof *levels;
+//..
+// Then, we find the first level that is not below 105, and the first level
+// above it:
+//..
+        const int *lower = bslalg::SearchUtil::lowerBound(levels,
+                                                          levels + NUM_LEVELS,
+                                                          105);
+        const int *upper = bslalg::SearchUtil::upperBound(levels,
+                                                          levels + NUM_LEVELS,
+                                                          105);
+        ASSERT(levels + 2 == lower);
+        ASSERT(levels + 4 == upper);
+//..
+// Next, we observe that searching for a price above every level yields the
+// end of the array:
+//..
+        ASSERT(levels + NUM_LEVELS == bslalg::SearchUtil::lowerBound(
+                                                          levels,
+                                                          levels + NUM_LEVELS,
+                                                          200));
+//..
+// Now, suppose that the array is large and searched far more often than it
+// changes.  We lay the levels out in Eytzinger order:
+//..
+        int layout[NUM_LEVELS];
+        bslalg::SearchUtil::eytzingerLayout(layout,
+                                            levels,
+                                            levels + NUM_LEVELS);
+//..
+// Finally, we search the layout, which yields the index of the found level
+// in the layout, or 'NUM_LEVELS' if there is none, and visit the subsequent
+// levels in sorted order:
+//..
+        std::size_t index = bslalg::SearchUtil::eytzingerLowerBound(
+                                                                   layout,
+                                                                   NUM_LEVELS,
+                                                                   106);
+        ASSERT(110 == layout[index]);
+
+        index = bslalg::SearchUtil::eytzingerNext(index, NUM_LEVELS);
+        ASSERT(120 == layout[index]);
+
+        index = bslalg::SearchUtil::eytzingerNext(index, NUM_LEVELS);
+        index = bslalg::SearchUtil::eytzingerNext(index, NUM_LEVELS);
+        ASSERT(150 == layout[index]);
+
+        index = bslalg::SearchUtil::eytzingerNext(index, NUM_LEVELS);
+        ASSERT(NUM_LEVELS == index);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEARCHING THE EYTZINGER LAYOUT
+        //
+        // Concerns:
+        //: 1 'eytzingerLayout' places the elements of a sorted range in
+        //:   Eytzinger layout.
+        //:
+        //: 2 'eytzingerLowerBound' and 'eytzingerUpperBound' return the index
+        //:   in the layout of the element found by 'native_std::lower_bound'
+        //:   and 'native_std::upper_bound', respectively, or the number of
+        //:   elements if those return the end of the range, for every length
+        //:   of the range and every searched value.
+        //:
+        //: 3 A supplied comparator is used, and the searched value may have a
+        //:   different type than the elements.
+        //
+        // Plan:
+        //: 1 For every length up to 70, lay out a sorted array having runs of
+        //:   equal values, and compare the layout with that built by a
+        //:   recursive reference implementation.  (C-1)
+        //:
+        //: 2 Search the layout for every value from below the least element
+        //:   to above the greatest, and compare the element found (by its
+        //:   sorted index, obtained by traversing the layout) with the result
+        //:   of the standard search.  (C-2)
+        //:
+        //: 3 Repeat P-1..2 for an array in decreasing order, using
+        //:   'native_std::greater', and for 'Key' values.  (C-3)
+        //
+        // Testing:
+        //   void eytzingerLayout(TYPE *result, const TYPE *, const TYPE *);
+        //   size_t eytzingerLowerBound(const TYPE *, size_t, const VALUE&);
+        //   size_t eytzingerLowerBound(const TYPE *, size_t, const V&, COMP);
+        //   size_t eytzingerUpperBound(const TYPE *, size_t, const VALUE&);
+        //   size_t eytzingerUpperBound(const TYPE *, size_t, const V&, COMP);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSEARCHING THE EYTZINGER LAYOUT"
+                            "\n==============================\n");
+
+        const int MAX_LENGTH = 70;
+
+        int sorted[MAX_LENGTH];
+        int reversed[MAX_LENGTH];
+        int layout[MAX_LENGTH];
+        int reversedLayout[MAX_LENGTH];
+        int expected[MAX_LENGTH];
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                sorted[i]                = 2 * (i / 3);
+                reversed[length - 1 - i] = sorted[i];
+            }
+            const std::size_t N = length;
+
+            Obj::eytzingerLayout(layout, sorted, sorted + length);
+            referenceLayout(expected, sorted, 0, 1, N);
+            for (int i = 0; i < length; ++i) {
+                LOOP2_ASSERT(length, i, expected[i] == layout[i]);
+            }
+
+            Obj::eytzingerLayout(reversedLayout, reversed, reversed + length);
+
+            // Map each index of the layout to its sorted index.
+
+            std::size_t sortedIndex[MAX_LENGTH + 1];
+            int         count = 0;
+            for (std::size_t index = Obj::eytzingerBegin(N);
+                 index != N;
+                 index = Obj::eytzingerNext(index, N)) {
+                sortedIndex[index] = count++;
+            }
+            sortedIndex[N] = N;
+            LOOP_ASSERT(length, length == count);
+
+            for (int value = -2; value <= 2 * (length / 3) + 2; ++value) {
+                const Key key = { value };
+
+                const int EXP_LOWER = static_cast<int>(
+                   native_std::lower_bound(sorted, sorted + length, value)
+                                                                    - sorted);
+                const int EXP_UPPER = static_cast<int>(
+                   native_std::upper_bound(sorted, sorted + length, value)
+                                                                    - sorted);
+
+                const std::size_t lower =
+                                    Obj::eytzingerLowerBound(layout, N, value);
+                const std::size_t upper =
+                                    Obj::eytzingerUpperBound(layout, N, value);
+                const std::size_t keyLower =
+                                      Obj::eytzingerLowerBound(layout, N, key);
+                const std::size_t keyUpper =
+                                      Obj::eytzingerUpperBound(layout, N, key);
+
+                LOOP2_ASSERT(length, value, lower <= N);
+                LOOP2_ASSERT(length, value, upper <= N);
+                LOOP2_ASSERT(length, value,
+                             EXP_LOWER == (int)sortedIndex[lower]);
+                LOOP2_ASSERT(length, value,
+                             EXP_UPPER == (int)sortedIndex[upper]);
+                LOOP2_ASSERT(length, value, lower == keyLower);
+                LOOP2_ASSERT(length, value, upper == keyUpper);
+
+                // In decreasing order, the lower bound of 'value' is the
+                // first element not greater than it.
+
+                const int EXP_R_LOWER = static_cast<int>(
+                   native_std::lower_bound(reversed,
+                                           reversed + length,
+                                           value,
+                                           native_std::greater<int>())
+                                                                  - reversed);
+                const int EXP_R_UPPER = static_cast<int>(
+                   native_std::upper_bound(reversed,
+                                           reversed + length,
+                                           value,
+                                           native_std::greater<int>())
+                                                                  - reversed);
+
+                const std::size_t rLower = Obj::eytzingerLowerBound(
+                                                   reversedLayout,
+                                                   N,
+                                                   value,
+                                                   native_std::greater<int>());
+                const std::size_t rUpper = Obj::eytzingerUpperBound(
+                                                   reversedLayout,
+                                                   N,
+                                                   value,
+                                                   native_std::greater<int>());
+
+                LOOP2_ASSERT(length, value,
+                             EXP_R_LOWER == (int)sortedIndex[rLower]);
+                LOOP2_ASSERT(length, value,
+                             EXP_R_UPPER == (int)sortedIndex[rUpper]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SEARCHING SORTED ARRAYS
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same address as
+        //:   'native_std::lower_bound' and 'native_std::upper_bound',
+        //:   respectively, for every length of the range (including 0), and
+        //:   every searched value, including values preceding and following
+        //:   every element, and values equal to several elements.
+        //:
+        //: 2 A supplied comparator is used, and the searched value may have a
+        //:   different type than the elements.
+        //:
+        //: 3 The searches accept ranges of both modifiable and non-modifiable
+        //:   elements, and return an address of the same type.
+        //
+        // Plan:
+        //: 1 For every length up to 70, search a sorted array having runs of
+        //:   equal values for every value from below the least element to
+        //:   above the greatest, and compare the results with those of the
+        //:   standard searches.  (C-1)
+        //:
+        //: 2 Repeat P-1 for an array in decreasing order, using
+        //:   'native_std::greater', and for 'Key' values.  (C-2)
+        //:
+        //: 3 Search a modifiable array, and modify the element found through
+        //:   the returned address.  (C-3)
+        //
+        // Testing:
+        //   TYPE *lowerBound(TYPE *first, TYPE *last, const VALUE& value);
+        //   TYPE *lowerBound(TYPE *, TYPE *, const VALUE&, COMPARATOR);
+        //   TYPE *upperBound(TYPE *first, TYPE *last, const VALUE& value);
+        //   TYPE *upperBound(TYPE *, TYPE *, const VALUE&, COMPARATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSEARCHING SORTED ARRAYS"
+                            "\n=======================\n");
+
+        const int MAX_LENGTH = 70;
+
+        int sorted[MAX_LENGTH];
+        int reversed[MAX_LENGTH];
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            for (int i = 0; i < length; ++i) {
+                sorted[i]                = 2 * (i / 3);
+                reversed[length - 1 - i] = sorted[i];
+            }
+
+            const int *const FIRST  = sorted;
+            const int *const LAST   = sorted + length;
+            const int *const RFIRST = reversed;
+            const int *const RLAST  = reversed + length;
+
+            for (int value = -2; value <= 2 * (length / 3) + 2; ++value) {
+                const Key key = { value };
+
+                const int *EXP_LOWER =
+                                 native_std::lower_bound(FIRST, LAST, value);
+                const int *EXP_UPPER =
+                                 native_std::upper_bound(FIRST, LAST, value);
+
+                LOOP2_ASSERT(length, value,
+                             EXP_LOWER == Obj::lowerBound(FIRST, LAST, value));
+                LOOP2_ASSERT(length, value,
+                             EXP_UPPER == Obj::upperBound(FIRST, LAST, value));
+                LOOP2_ASSERT(length, value,
+                             EXP_LOWER == Obj::lowerBound(FIRST, LAST, key));
+                LOOP2_ASSERT(length, value,
+                             EXP_UPPER == Obj::upperBound(FIRST, LAST, key));
+
+                const int *EXP_R_LOWER = native_std::lower_bound(
+                                                   RFIRST,
+                                                   RLAST,
+                                                   value,
+                                                   native_std::greater<int>());
+                const int *EXP_R_UPPER = native_std::upper_bound(
+                                                   RFIRST,
+                                                   RLAST,
+                                                   value,
+                                                   native_std::greater<int>());
+
+                LOOP2_ASSERT(length, value,
+                             EXP_R_LOWER == Obj::lowerBound(
+                                                  RFIRST,
+                                                  RLAST,
+                                                  value,
+                                                  native_std::greater<int>()));
+                LOOP2_ASSERT(length, value,
+                             EXP_R_UPPER == Obj::upperBound(
+                                                  RFIRST,
+                                                  RLAST,
+                                                  value,
+                                                  native_std::greater<int>()));
+            }
+        }
+
+        if (verbose) printf("\tModifiable elements.\n");
+        {
+            int values[] = { 1, 3, 5, 7 };
+
+            int *lower = Obj::lowerBound(values, values + 4, 4);
+            int *upper = Obj::upperBound(values, values + 4, 5);
+
+            ASSERT(values + 2 == lower);
+            ASSERT(values + 3 == upper);
+
+            *lower = 6;
+            ASSERT(6 == values[2]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TRAVERSING THE EYTZINGER LAYOUT
+        //
+        // Concerns:
+        //: 1 'countTrailingOnes' returns the number of consecutive set bits
+        //:   starting from the least-significant bit.
+        //:
+        //: 2 'eytzingerBegin' returns the index of the least element of the
+        //:   layout, or the number of elements if there are none.
+        //:
+        //: 3 'eytzingerNext' returns the index of the next element in sorted
+        //:   order, or the number of elements after the greatest, so that
+        //:   the traversal visits every index exactly once, in sorted order.
+        //
+        // Plan:
+        //: 1 Verify 'countTrailingOnes' for each value of the form '2^n - 1',
+        //:   and for values having further set bits above the trailing ones.
+        //:   (C-1)
+        //:
+        //: 2 For every number of elements up to 300, lay out the sequence of
+        //:   integers '0 .. N - 1' by the recursive reference implementation,
+        //:   traverse the layout, and verify that the values visited are
+        //:   '0 .. N - 1', in order.  (C-2..3)
+        //
+        // Testing:
+        //   size_t eytzingerBegin(size_t numElements);
+        //   size_t eytzingerNext(size_t index, size_t numElements);
+        //   int SearchUtil_Imp::countTrailingOnes(size_t value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTRAVERSING THE EYTZINGER LAYOUT"
+                            "\n===============================\n");
+
+        const int NUM_BITS = static_cast<int>(sizeof(std::size_t) * 8);
+
+        for (int n = 0; n < NUM_BITS; ++n) {
+            const std::size_t ONES = (static_cast<std::size_t>(1) << n) - 1;
+
+            LOOP_ASSERT(n,
+                        n == bslalg::SearchUtil_Imp::countTrailingOnes(ONES));
+            if (n + 1 < NUM_BITS) {
+                const std::size_t HIGH =
+                                       static_cast<std::size_t>(1) << (n + 1);
+                LOOP_ASSERT(n, n == bslalg::SearchUtil_Imp::countTrailingOnes(
+                                                                ONES | HIGH));
+            }
+        }
+
+        const int MAX_LENGTH = 300;
+
+        int values[MAX_LENGTH];
+        int layout[MAX_LENGTH];
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            values[i] = i;
+        }
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            const std::size_t N = length;
+
+            referenceLayout(layout, values, 0, 1, N);
+
+            int         count = 0;
+            std::size_t index = Obj::eytzingerBegin(N);
+            for (; index != N && count <= length;
+                 index = Obj::eytzingerNext(index, N)) {
+                LOOP2_ASSERT(length, index, index < N);
+                LOOP2_ASSERT(length, count, count == layout[index]);
+                ++count;
+            }
+            LOOP_ASSERT(length, length == count);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Search a small sorted array, and the same array in Eytzinger
+        //:   layout, for a few values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const int DATA[]   = { 10, 20, 30, 40, 50, 60, 70 };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        ASSERT(DATA     == Obj::lowerBound(DATA, DATA + NUM_DATA,  5));
+        ASSERT(DATA     == Obj::lowerBound(DATA, DATA + NUM_DATA, 10));
+        ASSERT(DATA + 1 == Obj::upperBound(DATA, DATA + NUM_DATA, 10));
+        ASSERT(DATA + 3 == Obj::lowerBound(DATA, DATA + NUM_DATA, 35));
+        ASSERT(DATA + 7 == Obj::lowerBound(DATA, DATA + NUM_DATA, 75));
+        ASSERT(DATA     == Obj::lowerBound(DATA, DATA, 75));
+
+        // The Eytzinger layout of seven elements is a complete tree.
+
+        int layout[NUM_DATA];
+        Obj::eytzingerLayout(layout, DATA, DATA + NUM_DATA);
+
+        ASSERT(40 == layout[0]);
+        ASSERT(20 == layout[1]);
+        ASSERT(60 == layout[2]);
+        ASSERT(10 == layout[3]);
+        ASSERT(30 == layout[4]);
+        ASSERT(50 == layout[5]);
+        ASSERT(70 == layout[6]);
+
+        ASSERT(3        == Obj::eytzingerLowerBound(layout, NUM_DATA,  5));
+        ASSERT(4        == Obj::eytzingerLowerBound(layout, NUM_DATA, 30));
+        ASSERT(0        == Obj::eytzingerUpperBound(layout, NUM_DATA, 30));
+        ASSERT(6        == Obj::eytzingerLowerBound(layout, NUM_DATA, 65));
+        ASSERT(NUM_DATA == Obj::eytzingerLowerBound(layout, NUM_DATA, 75));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'native_std::lower_bound'
+        //
+        // Concerns:
+        //: 1 'lowerBound' is faster than 'native_std::lower_bound' for arrays
+        //:   of every size, and 'eytzingerLowerBound' is faster still for
+        //:   arrays that do not fit in cache.
+        //
+        // Plan:
+        //: 1 Time a million searches for random values of arrays of 'int'
+        //:   values from 4 KB to 1 GB (or the number of megabytes optionally
+        //:   specified as the second argument) using each search.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'native_std::lower_bound'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                    "\nPERFORMANCE: COMPARISON WITH 'native_std::lower_bound'"
+                    "\n======================================================"
+                    "\n");
+
+        const std::size_t MAX_BYTES = argc > 2
+                               ? static_cast<std::size_t>(atoi(argv[2])) << 20
+                               : static_cast<std::size_t>(1) << 30;
+
+        const int NUM_QUERIES = 1000000;
+
+        printf("\n%11s %12s %12s %12s   (ns per search)\n",
+               "array size", "lower_bound", "lowerBound", "eytzinger");
+
+        for (std::size_t numBytes = 4096;
+             numBytes <= MAX_BYTES;
+             numBytes *= 4) {
+            benchmark(numBytes, NUM_QUERIES);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
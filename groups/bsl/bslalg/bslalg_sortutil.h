@@ -0,0 +1,1151 @@
+// bslalg_sortutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLALG_SORTUTIL
+#define INCLUDED_BSLALG_SORTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide radix and hybrid comparison sorts for iterator ranges.
+//
+//@CLASSES:
+//  bslalg::SortUtil: namespace for radix and comparison sorting algorithms
+//
+//@SEE_ALSO: bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslalg::SortUtil', that sorts ranges specified by random-access iterators
+// (e.g., pointers, or the iterators of 'bsl::vector' and 'bsl::deque') using
+// two families of algorithms:
+//
+//: o 'radixSort' and 'radixSortByKey' perform a *least-significant-digit radix
+//:   sort*, ordering elements by an arithmetic key: the element itself, or a
+//:   key computed from each element by a user-supplied key extractor.  Each
+//:   8-bit digit of the key is sorted by one sequential pass that copies
+//:   every element to its position for that digit, so that sorting 'N'
+//:   elements having 'K'-byte keys costs at most 'K + 2' passes over the
+//:   data, with no comparisons (and so no branch mispredictions),
+//:   independently of the order of the input.  The counts of all digits are
+//:   gathered by a single initial pass, and digits for which all keys are
+//:   equal (e.g., the high-order bytes of timestamps that fall within a short
+//:   period) are skipped.  The sort is *stable*.  Scratch space for 'N'
+//:   elements is obtained from a supplied allocator.
+//:
+//: o 'sort' performs a *hybrid comparison sort* ("pattern-defeating
+//:   quicksort"): a quicksort that uses insertion sort for small partitions,
+//:   selects pivots by median-of-3 (or, for large partitions, "ninther")
+//:   sampling, partitions elements equal to a previous pivot in a single
+//:   pass (so that inputs having many duplicates sort in linear time), detects
+//:   partitions that were already in order (so that sorted, and mostly
+//:   sorted, inputs sort in linear time), breaks up patterns that cause
+//:   unbalanced partitions, and, as introsort does, falls back to heapsort
+//:   when partitions remain unbalanced, bounding the worst-case time at
+//:   'O(N * log(N))'.  The sort is not stable and does not allocate memory.
+//
+// Radix sort is typically several times faster than a comparison sort for
+// large ranges of integral or floating-point keys, but costs a fixed overhead
+// per digit, so ranges of fewer than 'k_RADIX_SORT_THRESHOLD' elements are
+// instead sorted by (stable) insertion sort on the keys.
+//
+///Radix Sort Keys
+///---------------
+// The following key types are supported by 'radixSort' and 'radixSortByKey':
+// 'char', 'signed char', 'unsigned char', 'short', 'unsigned short', 'int',
+// 'unsigned int', 'long', 'unsigned long', 'long long', 'unsigned long long',
+// 'float', and 'double'.  Keys are ordered by their numeric value, except that
+// the floating-point value '-0.0' precedes '+0.0', and that NaN values having
+// their sign bit clear (set) follow positive (precede negative) infinity.
+//
+// A key extractor supplied to 'radixSortByKey' is a function object that
+// declares a nested type 'result_type', one of the key types above, and that
+// is invocable with a 'const' reference to an element, returning its key.
+// The key extractor is invoked several times for each element, so it should
+// be inexpensive (typically, returning a data member).
+//
+///Requirements on Element Types
+///-----------------------------
+// The elements sorted by 'radixSort' and 'radixSortByKey' must be
+// copy-constructible and copy-assignable; scratch copies of the elements are
+// constructed (using the allocator supplied for scratch space, if the
+// elements use a 'bslma::Allocator') and destroyed before the sort returns.
+// The elements sorted by 'sort' must be copy-constructible, copy-assignable,
+// and swappable.
+//
+// The sorts provide the basic exception-safety guarantee: if an operation on
+// an element throws an exception, the exception is propagated, any scratch
+// copies are destroyed and scratch memory is released, and the range holds
+// valid elements whose values are unspecified (e.g., an element may have been
+// overwritten by a copy of another, so that the range no longer holds the
+// same elements as before the call).  Scratch memory is obtained before the
+// range is modified, so a failure to allocate it leaves the range unchanged.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting Trade Records by Timestamp
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive batches of trade records, and wish to process each
+// batch in order of the trades' timestamps.
+//
+// First, we define the record type, and a key extractor returning the
+// timestamp of a record:
+//..
+//  struct Trade {
+//      bsls::Types::Int64 d_timestamp;  // nanoseconds since the epoch
+//      int                d_quantity;
+//      double             d_price;
+//  };
+//
+//  struct TradeTimestamp {
+//      typedef bsls::Types::Int64 result_type;
+//
+//      bsls::Types::Int64 operator()(const Trade& trade) const
+//      {
+//          return trade.d_timestamp;
+//      }
+//  };
+//..
+// Then, we create a batch of trades whose timestamps are out of order:
+//..
+//  Trade trades[] = {
+//      { 1400000000000000300LL, 100, 10.5 },
+//      { 1400000000000000100LL, 200, 10.4 },
+//      { 1400000000000000200LL, 300, 10.6 },
+//      { 1400000000000000100LL, 400, 10.3 },
+//  };
+//  const int NUM_TRADES = sizeof trades / sizeof *trades;
+//..
+// Next, we sort the trades by timestamp, using radix sort.  Because radix
+// sort is stable, the two trades having equal timestamps keep their original
+// relative order:
+//..
+//  bslalg::SortUtil::radixSortByKey(trades,
+//                                   trades + NUM_TRADES,
+//                                   TradeTimestamp());
+//
+//  assert(200 == trades[0].d_quantity);
+//  assert(400 == trades[1].d_quantity);
+//  assert(300 == trades[2].d_quantity);
+//  assert(100 == trades[3].d_quantity);
+//..
+// Then, we sort the prices themselves, which are arithmetic values, directly:
+//..
+//  double prices[] = { 10.5, -1.25, 10.4, 0.0, 10.6 };
+//
+//  bslalg::SortUtil::radixSort(prices, prices + 5);
+//
+//  assert(-1.25 == prices[0]);
+//  assert( 0.0  == prices[1]);
+//  assert(10.6  == prices[4]);
+//..
+// Finally, we sort the trades in decreasing order of price, using the
+// comparison sort and a comparator:
+//..
+//  struct HigherPrice {
+//      bool operator()(const Trade& lhs, const Trade& rhs) const
+//      {
+//          return lhs.d_price > rhs.d_price;
+//      }
+//  };
+//
+//  bslalg::SortUtil::sort(trades, trades + NUM_TRADES, HigherPrice());
+//
+//  assert(10.6 == trades[0].d_price);
+//  assert(10.3 == trades[3].d_price);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_AUTOARRAYDESTRUCTOR
+#include <bslalg_autoarraydestructor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CLIMITS
+#include <climits>
+#define INCLUDED_CLIMITS
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#ifndef INCLUDED_ITERATOR
+#include <iterator>
+#define INCLUDED_ITERATOR
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                        // ===========================
+                        // struct SortUtil_RadixTraits
+                        // ===========================
+
+template <class KEY>
+struct SortUtil_RadixTraits;
+    // This 'struct' template, specialized for each supported key type,
+    // provides a type, 'Bits', and a function, 'toBits', mapping a key to an
+    // unsigned integer such that the order of the integers is the order of
+    // the keys.  This template is for use only by 'SortUtil'.
+
+template <class KEY, class BITS>
+struct SortUtil_UnsignedRadixTraits {
+    // This 'struct' template maps a key of the unsigned integral type 'KEY' to
+    // the unsigned integral type 'BITS' of the same size.
+
+    typedef BITS Bits;
+
+    static Bits toBits(KEY key)
+    {
+        return static_cast<Bits>(key);
+    }
+};
+
+template <class KEY, class BITS>
+struct SortUtil_SignedRadixTraits {
+    // This 'struct' template maps a key of the signed integral type 'KEY' to
+    // the unsigned integral type 'BITS' of the same size by inverting the
+    // sign bit, so that negative keys precede non-negative ones.
+
+    typedef BITS Bits;
+
+    static Bits toBits(KEY key)
+    {
+        return static_cast<Bits>(static_cast<Bits>(key)
+                        ^ (static_cast<Bits>(1) << (sizeof(Bits) * 8 - 1)));
+    }
+};
+
+template <>
+struct SortUtil_RadixTraits<char> {
+    typedef unsigned char Bits;
+
+    static Bits toBits(char key)
+    {
+        return static_cast<Bits>(static_cast<Bits>(key)
+                                                 ^ (CHAR_MIN < 0 ? 0x80 : 0));
+    }
+};
+
+template <>
+struct SortUtil_RadixTraits<signed char>
+: SortUtil_SignedRadixTraits<signed char, unsigned char> {
+};
+
+template <>
+struct SortUtil_RadixTraits<unsigned char>
+: SortUtil_UnsignedRadixTraits<unsigned char, unsigned char> {
+};
+
+template <>
+struct SortUtil_RadixTraits<short>
+: SortUtil_SignedRadixTraits<short, unsigned short> {
+};
+
+template <>
+struct SortUtil_RadixTraits<unsigned short>
+: SortUtil_UnsignedRadixTraits<unsigned short, unsigned short> {
+};
+
+template <>
+struct SortUtil_RadixTraits<int>
+: SortUtil_SignedRadixTraits<int, unsigned int> {
+};
+
+template <>
+struct SortUtil_RadixTraits<unsigned int>
+: SortUtil_UnsignedRadixTraits<unsigned int, unsigned int> {
+};
+
+template <>
+struct SortUtil_RadixTraits<long>
+: SortUtil_SignedRadixTraits<long, unsigned long> {
+};
+
+template <>
+struct SortUtil_RadixTraits<unsigned long>
+: SortUtil_UnsignedRadixTraits<unsigned long, unsigned long> {
+};
+
+template <>
+struct SortUtil_RadixTraits<long long>
+: SortUtil_SignedRadixTraits<long long, unsigned long long> {
+};
+
+template <>
+struct SortUtil_RadixTraits<unsigned long long>
+: SortUtil_UnsignedRadixTraits<unsigned long long, unsigned long long> {
+};
+
+template <>
+struct SortUtil_RadixTraits<float> {
+    // Positive values are ordered by their representation; setting the sign
+    // bit moves them after negative values, whose order is reversed by
+    // inverting every bit.
+
+    typedef unsigned int Bits;
+
+    static Bits toBits(float key)
+    {
+        BSLMF_ASSERT(sizeof(float) == sizeof(Bits));
+
+        Bits bits;
+        native_std::memcpy(&bits, &key, sizeof bits);
+        return bits & 0x80000000U ? ~bits : bits | 0x80000000U;
+    }
+};
+
+template <>
+struct SortUtil_RadixTraits<double> {
+    // See 'SortUtil_RadixTraits<float>'.
+
+    typedef bsls::Types::Uint64 Bits;
+
+    static Bits toBits(double key)
+    {
+        BSLMF_ASSERT(sizeof(double) == sizeof(Bits));
+
+        const Bits signBit = 0x8000000000000000ULL;
+
+        Bits bits;
+        native_std::memcpy(&bits, &key, sizeof bits);
+        return bits & signBit ? ~bits : bits | signBit;
+    }
+};
+
+                          // ======================
+                          // struct SortUtil_Less
+                          // ======================
+
+struct SortUtil_Less {
+    // This 'struct' provides a comparator that compares objects using
+    // 'operator<'.
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+    {
+        return lhs < rhs;
+    }
+};
+
+                         // ========================
+                         // struct SortUtil_Identity
+                         // ========================
+
+template <class TYPE>
+struct SortUtil_Identity {
+    // This 'struct' template provides a key extractor returning (a copy of)
+    // an element of the arithmetic 'TYPE' as its own key.
+
+    typedef TYPE result_type;
+
+    TYPE operator()(const TYPE& value) const
+    {
+        return value;
+    }
+};
+
+                          // ======================
+                          // class SortUtil_KeyLess
+                          // ======================
+
+template <class KEY_EXTRACTOR>
+class SortUtil_KeyLess {
+    // This class provides a comparator that orders elements by the radix
+    // representation of the key returned for each by a 'KEY_EXTRACTOR', and
+    // so in the same order as radix sort.
+
+    // PRIVATE TYPES
+    typedef SortUtil_RadixTraits<typename KEY_EXTRACTOR::result_type> Traits;
+
+    // DATA
+    const KEY_EXTRACTOR *d_extractor_p;  // key extractor (held, not owned)
+
+  public:
+    // CREATORS
+    explicit SortUtil_KeyLess(const KEY_EXTRACTOR *extractor)
+    : d_extractor_p(extractor)
+    {
+    }
+
+    // ACCESSORS
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+    {
+        return Traits::toBits((*d_extractor_p)(lhs))
+             < Traits::toBits((*d_extractor_p)(rhs));
+    }
+};
+
+                              // ===============
+                              // struct SortUtil
+                              // ===============
+
+struct SortUtil {
+    // This 'struct' provides a namespace for radix and comparison sorting
+    // algorithms on ranges specified by random-access iterators.  See the
+    // component-level documentation for the supported keys and the
+    // requirements on the sorted elements.
+
+    // TYPES
+    enum {
+        k_RADIX_SORT_THRESHOLD     = 64,   // least number of elements sorted
+                                           // by radix, rather than insertion,
+                                           // sort
+
+        k_INSERTION_SORT_THRESHOLD = 24,   // partitions smaller than this are
+                                           // sorted by insertion sort
+
+        k_NINTHER_THRESHOLD        = 128,  // partitions larger than this
+                                           // choose a pivot from nine samples
+
+        k_PARTIAL_INSERTION_LIMIT  = 8     // greatest number of element moves
+                                           // spent attempting to finish an
+                                           // already-partitioned range by
+                                           // insertion sort
+    };
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class RANDOM_ITER>
+    static void iterSwap(RANDOM_ITER a, RANDOM_ITER b);
+        // Exchange the values of the elements at the specified 'a' and 'b'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort2(RANDOM_ITER a, RANDOM_ITER b, COMPARATOR& comparator);
+        // Exchange the elements at the specified 'a' and 'b' if the element
+        // at 'b' precedes that at 'a' according to the specified
+        // 'comparator'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort3(RANDOM_ITER  a,
+                      RANDOM_ITER  b,
+                      RANDOM_ITER  c,
+                      COMPARATOR&  comparator);
+        // Order the elements at the specified 'a', 'b', and 'c' according to
+        // the specified 'comparator'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void insertionSort(RANDOM_ITER  first,
+                              RANDOM_ITER  last,
+                              COMPARATOR&  comparator);
+        // Sort the elements in the specified range '[first, last)' according
+        // to the specified 'comparator', using (stable) insertion sort.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void unguardedInsertionSort(RANDOM_ITER  first,
+                                       RANDOM_ITER  last,
+                                       COMPARATOR&  comparator);
+        // Sort the elements in the specified range '[first, last)' according
+        // to the specified 'comparator', using insertion sort.  The behavior
+        // is undefined unless the element preceding 'first' does not follow
+        // any element in the range.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static bool partialInsertionSort(RANDOM_ITER  first,
+                                     RANDOM_ITER  last,
+                                     COMPARATOR&  comparator);
+        // Attempt to sort the elements in the specified range
+        // '[first, last)' according to the specified 'comparator' using
+        // insertion sort, abandoning the attempt once more than
+        // 'k_PARTIAL_INSERTION_LIMIT' elements have been moved.  Return
+        // 'true' if the range was sorted, and 'false' otherwise.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static RANDOM_ITER partitionRight(RANDOM_ITER  first,
+                                      RANDOM_ITER  last,
+                                      COMPARATOR&  comparator,
+                                      bool        *alreadyPartitioned);
+        // Partition the elements in the specified range '[first, last)'
+        // around the pivot at 'first', placing the elements that precede the
+        // pivot according to the specified 'comparator' before it, and the
+        // others after it, and return the final position of the pivot.  Load
+        // into the specified 'alreadyPartitioned' 'true' if no elements were
+        // exchanged, and 'false' otherwise.  The behavior is undefined unless
+        // some element of '[first + 1, last)' does not precede the pivot.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static RANDOM_ITER partitionLeft(RANDOM_ITER  first,
+                                     RANDOM_ITER  last,
+                                     COMPARATOR&  comparator);
+        // Partition the elements in the specified range '[first, last)'
+        // around the pivot at 'first', placing the elements that the pivot
+        // precedes according to the specified 'comparator' after it, and the
+        // others (i.e., the elements equivalent to the pivot) before it, and
+        // return the final position of the pivot.  The behavior is undefined
+        // unless the element preceding 'first' does not precede the pivot.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void heapSort(RANDOM_ITER  first,
+                         RANDOM_ITER  last,
+                         COMPARATOR&  comparator);
+        // Sort the elements in the specified range '[first, last)' according
+        // to the specified 'comparator', using heapsort.
+
+    template <class RANDOM_ITER, class DIFF_TYPE, class COMPARATOR>
+    static void siftDown(RANDOM_ITER  first,
+                         DIFF_TYPE    hole,
+                         DIFF_TYPE    length,
+                         COMPARATOR&  comparator);
+        // Restore the max-heap property, according to the specified
+        // 'comparator', of the heap of the specified 'length' beginning at
+        // the specified 'first', whose only violation may be at the specified
+        // 'hole'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sortLoop(RANDOM_ITER  first,
+                         RANDOM_ITER  last,
+                         COMPARATOR&  comparator,
+                         int          badAllowed,
+                         bool         leftmost);
+        // Sort the elements in the specified range '[first, last)' according
+        // to the specified 'comparator', falling back to heapsort once the
+        // specified 'badAllowed' unbalanced partitions have occurred.  The
+        // specified 'leftmost' is 'true' if no element precedes 'first' in the
+        // range being sorted, and 'false' if the element preceding 'first'
+        // does not follow any element in '[first, last)'.
+
+    template <class SOURCE_ITER, class RESULT_ITER, class KEY_EXTRACTOR>
+    static void radixScatter(SOURCE_ITER           first,
+                             SOURCE_ITER           last,
+                             RESULT_ITER           result,
+                             const KEY_EXTRACTOR&  extractor,
+                             int                   shift,
+                             native_std::size_t   *offsets);
+        // Copy-assign each element in the specified range '[first, last)' to
+        // the position, relative to the specified 'result', given by the
+        // element of the specified 'offsets' indexed by the 8-bit digit at
+        // the specified 'shift' of the key returned for the element by the
+        // specified 'extractor', and increment that offset.
+
+  public:
+    // CLASS METHODS
+    template <class RANDOM_ITER>
+    static void radixSort(RANDOM_ITER       first,
+                          RANDOM_ITER       last,
+                          bslma::Allocator *basicAllocator = 0);
+        // Sort the elements in the specified range '[first, last)' in
+        // increasing order of value, using a stable radix sort.  Optionally
+        // specify a 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless the value type of
+        // 'RANDOM_ITER' is one of the key types listed in the component-level
+        // documentation.  Note that 'radixSort(first, last)' orders a range
+        // of integers identically to 'sort(first, last)'.
+
+    template <class RANDOM_ITER, class KEY_EXTRACTOR>
+    static void radixSortByKey(RANDOM_ITER           first,
+                               RANDOM_ITER           last,
+                               const KEY_EXTRACTOR&  extractor,
+                               bslma::Allocator     *basicAllocator = 0);
+        // Sort the elements in the specified range '[first, last)' in
+        // increasing order of the key returned for each by the specified
+        // 'extractor', using a stable radix sort.  Optionally specify a
+        // 'basicAllocator' used to supply scratch memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  See the component-level documentation for the requirements
+        // on 'KEY_EXTRACTOR'.
+
+    template <class RANDOM_ITER>
+    static void sort(RANDOM_ITER first, RANDOM_ITER last);
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void sort(RANDOM_ITER first,
+                     RANDOM_ITER last,
+                     COMPARATOR  comparator);
+        // Sort the elements in the specified range '[first, last)' according
+        // to the optionally specified 'comparator', or in increasing order
+        // according to 'operator<' if 'comparator' is not specified, using an
+        // unstable hybrid comparison sort that allocates no memory.
+        // 'comparator' must induce a strict weak ordering on the elements.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // struct SortUtil
+                              // ---------------
+
+// PRIVATE CLASS METHODS
+template <class RANDOM_ITER>
+inline
+void SortUtil::iterSwap(RANDOM_ITER a, RANDOM_ITER b)
+{
+    SwapUtil::swap(&*a, &*b);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void SortUtil::sort2(RANDOM_ITER a, RANDOM_ITER b, COMPARATOR& comparator)
+{
+    if (comparator(*b, *a)) {
+        iterSwap(a, b);
+    }
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void SortUtil::sort3(RANDOM_ITER  a,
+                     RANDOM_ITER  b,
+                     RANDOM_ITER  c,
+                     COMPARATOR&  comparator)
+{
+    sort2(a, b, comparator);
+    sort2(b, c, comparator);
+    sort2(a, b, comparator);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void SortUtil::insertionSort(RANDOM_ITER  first,
+                             RANDOM_ITER  last,
+                             COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    for (RANDOM_ITER current = first + 1; current != last; ++current) {
+        RANDOM_ITER previous = current - 1;
+        if (comparator(*current, *previous)) {
+            ValueType   value(*current);
+            RANDOM_ITER hole = current;
+            do {
+                *hole = *previous;
+                --hole;
+            } while (hole != first && comparator(value, *--previous));
+            *hole = value;
+        }
+    }
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void SortUtil::unguardedInsertionSort(RANDOM_ITER  first,
+                                      RANDOM_ITER  last,
+                                      COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    for (RANDOM_ITER current = first + 1; current != last; ++current) {
+        RANDOM_ITER previous = current - 1;
+        if (comparator(*current, *previous)) {
+            ValueType   value(*current);
+            RANDOM_ITER hole = current;
+            do {
+                *hole = *previous;
+                --hole;
+            } while (comparator(value, *--previous));
+            *hole = value;
+        }
+    }
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+bool SortUtil::partialInsertionSort(RANDOM_ITER  first,
+                                    RANDOM_ITER  last,
+                                    COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    DiffType;
+
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    DiffType numMoves = 0;
+    for (RANDOM_ITER current = first + 1; current != last; ++current) {
+        RANDOM_ITER previous = current - 1;
+        if (comparator(*current, *previous)) {
+            ValueType   value(*current);
+            RANDOM_ITER hole = current;
+            do {
+                *hole = *previous;
+                --hole;
+            } while (hole != first && comparator(value, *--previous));
+            *hole = value;
+
+            numMoves += current - hole;
+            if (numMoves > k_PARTIAL_INSERTION_LIMIT) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return true;
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+RANDOM_ITER SortUtil::partitionRight(RANDOM_ITER  first,
+                                     RANDOM_ITER  last,
+                                     COMPARATOR&  comparator,
+                                     bool        *alreadyPartitioned)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const ValueType pivot(*first);
+
+    // Find the first element not preceding the pivot (one exists, by
+    // precondition), and the last element preceding it (if the first search
+    // stopped immediately, no element need precede it).
+
+    RANDOM_ITER left  = first;
+    RANDOM_ITER right = last;
+
+    while (comparator(*++left, pivot)) {
+    }
+
+    if (left - 1 == first) {
+        while (left < right && !comparator(*--right, pivot)) {
+        }
+    }
+    else {
+        while (!comparator(*--right, pivot)) {
+        }
+    }
+
+    *alreadyPartitioned = left >= right;
+
+    while (left < right) {
+        iterSwap(left, right);
+        while (comparator(*++left, pivot)) {
+        }
+        while (!comparator(*--right, pivot)) {
+        }
+    }
+
+    RANDOM_ITER pivotPosition = left - 1;
+    *first         = *pivotPosition;
+    *pivotPosition = pivot;
+    return pivotPosition;
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+RANDOM_ITER SortUtil::partitionLeft(RANDOM_ITER  first,
+                                    RANDOM_ITER  last,
+                                    COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const ValueType pivot(*first);
+
+    RANDOM_ITER left  = first;
+    RANDOM_ITER right = last;
+
+    while (comparator(pivot, *--right)) {
+    }
+
+    if (right + 1 == last) {
+        while (left < right && !comparator(pivot, *++left)) {
+        }
+    }
+    else {
+        while (!comparator(pivot, *++left)) {
+        }
+    }
+
+    while (left < right) {
+        iterSwap(left, right);
+        while (comparator(pivot, *--right)) {
+        }
+        while (!comparator(pivot, *++left)) {
+        }
+    }
+
+    *first = *right;
+    *right = pivot;
+    return right;
+}
+
+template <class RANDOM_ITER, class DIFF_TYPE, class COMPARATOR>
+void SortUtil::siftDown(RANDOM_ITER  first,
+                        DIFF_TYPE    hole,
+                        DIFF_TYPE    length,
+                        COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const ValueType value(first[hole]);
+
+    for (DIFF_TYPE child = 2 * hole + 1;
+         child < length;
+         child = 2 * hole + 1) {
+        if (child + 1 < length && comparator(first[child], first[child + 1])) {
+            ++child;
+        }
+        if (!comparator(value, first[child])) {
+            break;
+        }
+        first[hole] = first[child];
+        hole        = child;
+    }
+    first[hole] = value;
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void SortUtil::heapSort(RANDOM_ITER  first,
+                        RANDOM_ITER  last,
+                        COMPARATOR&  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    DiffType;
+
+    const DiffType length = last - first;
+
+    for (DiffType i = length / 2; 0 < i; ) {
+        --i;
+        siftDown(first, i, length, comparator);
+    }
+    for (DiffType end = length - 1; 0 < end; --end) {
+        iterSwap(first, first + end);
+        siftDown(first, static_cast<DiffType>(0), end, comparator);
+    }
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void SortUtil::sortLoop(RANDOM_ITER  first,
+                        RANDOM_ITER  last,
+                        COMPARATOR&  comparator,
+                        int          badAllowed,
+                        bool         leftmost)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    DiffType;
+
+    while (true) {
+        const DiffType size = last - first;
+
+        if (size < k_INSERTION_SORT_THRESHOLD) {
+            if (leftmost) {
+                insertionSort(first, last, comparator);
+            }
+            else {
+                unguardedInsertionSort(first, last, comparator);
+            }
+            return;                                                   // RETURN
+        }
+
+        // Move the median of a sample to 'first', to serve as the pivot.  The
+        // greatest sampled element is left at 'last - 1', guaranteeing that
+        // the scan for an element not preceding the pivot terminates.
+
+        const DiffType half = size / 2;
+        if (size > k_NINTHER_THRESHOLD) {
+            sort3(first, first + half, last - 1, comparator);
+            sort3(first + 1, first + (half - 1), last - 2, comparator);
+            sort3(first + 2, first + (half + 1), last - 3, comparator);
+            sort3(first + (half - 1),
+                  first + half,
+                  first + (half + 1),
+                  comparator);
+            iterSwap(first, first + half);
+        }
+        else {
+            sort3(first + half, first, last - 1, comparator);
+        }
+
+        // If the pivot is equivalent to the element preceding this range
+        // (the pivot of an enclosing partition), every element equivalent to
+        // it can be placed at its final position in one pass.
+
+        if (!leftmost && !comparator(*(first - 1), *first)) {
+            first = partitionLeft(first, last, comparator) + 1;
+            continue;
+        }
+
+        bool              alreadyPartitioned;
+        const RANDOM_ITER pivot = partitionRight(first,
+                                                 last,
+                                                 comparator,
+                                                 &alreadyPartitioned);
+
+        const DiffType leftSize  = pivot - first;
+        const DiffType rightSize = last - (pivot + 1);
+
+        if (leftSize < size / 8 || rightSize < size / 8) {
+            // The partition is highly unbalanced: fall back to heapsort if
+            // this has happened too often, and otherwise swap some elements
+            // to break up any pattern responsible.
+
+            if (0 == --badAllowed) {
+                heapSort(first, last, comparator);
+                return;                                               // RETURN
+            }
+
+            if (leftSize >= k_INSERTION_SORT_THRESHOLD) {
+                iterSwap(first, first + leftSize / 4);
+                iterSwap(pivot - 1, pivot - leftSize / 4);
+                if (leftSize > k_NINTHER_THRESHOLD) {
+                    iterSwap(first + 1, first + (leftSize / 4 + 1));
+                    iterSwap(first + 2, first + (leftSize / 4 + 2));
+                    iterSwap(pivot - 2, pivot - (leftSize / 4 + 1));
+                    iterSwap(pivot - 3, pivot - (leftSize / 4 + 2));
+                }
+            }
+            if (rightSize >= k_INSERTION_SORT_THRESHOLD) {
+                iterSwap(pivot + 1, pivot + (1 + rightSize / 4));
+                iterSwap(last - 1, last - rightSize / 4);
+                if (rightSize > k_NINTHER_THRESHOLD) {
+                    iterSwap(pivot + 2, pivot + (2 + rightSize / 4));
+                    iterSwap(pivot + 3, pivot + (3 + rightSize / 4));
+                    iterSwap(last - 2, last - (1 + rightSize / 4));
+                    iterSwap(last - 3, last - (2 + rightSize / 4));
+                }
+            }
+        }
+        else if (alreadyPartitioned
+              && partialInsertionSort(first, pivot, comparator)
+              && partialInsertionSort(pivot + 1, last, comparator)) {
+            // The range was (nearly) sorted already.
+
+            return;                                                   // RETURN
+        }
+
+        // Recurse into the left partition, and iterate on the right one.
+
+        sortLoop(first, pivot, comparator, badAllowed, leftmost);
+        first    = pivot + 1;
+        leftmost = false;
+    }
+}
+
+template <class SOURCE_ITER, class RESULT_ITER, class KEY_EXTRACTOR>
+void SortUtil::radixScatter(SOURCE_ITER           first,
+                            SOURCE_ITER           last,
+                            RESULT_ITER           result,
+                            const KEY_EXTRACTOR&  extractor,
+                            int                   shift,
+                            native_std::size_t   *offsets)
+{
+    typedef SortUtil_RadixTraits<typename KEY_EXTRACTOR::result_type> Traits;
+    typedef typename native_std::iterator_traits<RESULT_ITER>::difference_type
+                                                                    DiffType;
+
+    for (; first != last; ++first) {
+        const unsigned int digit = static_cast<unsigned int>(
+                               (Traits::toBits(extractor(*first)) >> shift)
+                                                                      & 0xff);
+        result[static_cast<DiffType>(offsets[digit]++)] = *first;
+    }
+}
+
+// CLASS METHODS
+template <class RANDOM_ITER>
+inline
+void SortUtil::radixSort(RANDOM_ITER       first,
+                         RANDOM_ITER       last,
+                         bslma::Allocator *basicAllocator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    radixSortByKey(first,
+                   last,
+                   SortUtil_Identity<ValueType>(),
+                   basicAllocator);
+}
+
+template <class RANDOM_ITER, class KEY_EXTRACTOR>
+void SortUtil::radixSortByKey(RANDOM_ITER           first,
+                              RANDOM_ITER           last,
+                              const KEY_EXTRACTOR&  extractor,
+                              bslma::Allocator     *basicAllocator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+    typedef SortUtil_RadixTraits<typename KEY_EXTRACTOR::result_type> Traits;
+    typedef typename Traits::Bits                                     Bits;
+
+    enum {
+        k_NUM_DIGITS = sizeof(Bits),  // number of 8-bit digits in a key
+        k_RADIX      = 256            // number of values of a digit
+    };
+
+    const native_std::size_t length =
+                                 static_cast<native_std::size_t>(last - first);
+
+    if (length < static_cast<native_std::size_t>(k_RADIX_SORT_THRESHOLD)) {
+        SortUtil_KeyLess<KEY_EXTRACTOR> comparator(&extractor);
+        insertionSort(first, last, comparator);
+        return;                                                       // RETURN
+    }
+
+    // Count the occurrences of each value of each digit in one pass, and
+    // select the digits on which the keys differ.
+
+    native_std::size_t counts[k_NUM_DIGITS][k_RADIX];
+    native_std::memset(counts, 0, sizeof counts);
+
+    for (RANDOM_ITER it = first; it != last; ++it) {
+        const Bits bits = Traits::toBits(extractor(*it));
+        for (int d = 0; d < k_NUM_DIGITS; ++d) {
+            ++counts[d][(bits >> (8 * d)) & 0xff];
+        }
+    }
+
+    const Bits firstBits = Traits::toBits(extractor(*first));
+    int        digits[k_NUM_DIGITS];
+    int        numPasses = 0;
+    for (int d = 0; d < k_NUM_DIGITS; ++d) {
+        if (counts[d][(firstBits >> (8 * d)) & 0xff] != length) {
+            digits[numPasses++] = d;
+        }
+    }
+
+    if (0 == numPasses) {
+        return;                                                       // RETURN
+    }
+
+    // Copy the elements into scratch space, and scatter them back and forth
+    // between the scratch space and the range, one pass per selected digit,
+    // choosing the first source so that the last pass writes to the range.
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    ValueType *scratch = static_cast<ValueType *>(
+                              allocator->allocate(length * sizeof(ValueType)));
+    bslma::DeallocatorProctor<bslma::Allocator> deallocator(scratch,
+                                                            allocator);
+
+    ArrayPrimitives::copyConstruct(scratch, first, last, allocator);
+    AutoArrayDestructor<ValueType> destructor(scratch, scratch + length);
+
+    bool fromScratch = numPasses % 2;
+    for (int pass = 0; pass < numPasses; ++pass) {
+        const int           d      = digits[pass];
+        native_std::size_t *counter = counts[d];
+
+        native_std::size_t offset = 0;
+        for (int i = 0; i < k_RADIX; ++i) {
+            const native_std::size_t count = counter[i];
+            counter[i]  = offset;
+            offset     += count;
+        }
+
+        if (fromScratch) {
+            radixScatter(scratch,
+                         scratch + length,
+                         first,
+                         extractor,
+                         8 * d,
+                         counter);
+        }
+        else {
+            radixScatter(first, last, scratch, extractor, 8 * d, counter);
+        }
+        fromScratch = !fromScratch;
+    }
+}
+
+template <class RANDOM_ITER>
+inline
+void SortUtil::sort(RANDOM_ITER first, RANDOM_ITER last)
+{
+    sort(first, last, SortUtil_Less());
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+void SortUtil::sort(RANDOM_ITER first,
+                    RANDOM_ITER last,
+                    COMPARATOR  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    DiffType;
+
+    const DiffType length = last - first;
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    // Allow 'log2(length)' unbalanced partitions before falling back to
+    // heapsort.
+
+    int badAllowed = 0;
+    for (DiffType n = length; 1 < n; n >>= 1) {
+        ++badAllowed;
+    }
+
+    sortLoop(first, last, comparator, badAllowed, true);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
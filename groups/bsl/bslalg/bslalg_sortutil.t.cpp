@@ -0,0 +1,1040 @@
+// bslalg_sortutil.t.cpp                                              -*-C++-*-
+
+#include <bslalg_sortutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // native_std::sort, native_std::stable_sort
+#include <deque>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+#include <limits.h>
+#include <string.h>     // memcmp(), memcpy()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides sorting algorithms, whose results can be
+// checked against those of the standard library.  We first verify the order
+// induced on each supported key type by its radix representation, using
+// tables of boundary values.  We then sort arrays and deques of many sizes
+// and input patterns (random, sorted, reversed, equal, few distinct values,
+// organ pipe, sawtooth, and nearly sorted) with each algorithm, and compare
+// the results with those of 'native_std::stable_sort'; for radix sort, we
+// also verify stability, the use of the supplied (or default) allocator for
+// scratch space, and exception neutrality.  A performance test (negative
+// case) compares the algorithms with 'native_std::sort'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] void radixSort(RANDOM_ITER first, RANDOM_ITER last, Allocator *);
+// [ 5] void radixSortByKey(RANDOM_ITER, RANDOM_ITER, const KEY_EX&, *ba);
+// [ 3] void sort(RANDOM_ITER first, RANDOM_ITER last);
+// [ 3] void sort(RANDOM_ITER first, RANDOM_ITER last, COMPARATOR comp);
+//
+// IMPLEMENTATION
+// [ 2] SortUtil_RadixTraits<KEY>::toBits(KEY key);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'native_std::sort'
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::SortUtil    Obj;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum Pattern {
+    // Input patterns used for testing and benchmarking.
+
+    e_RANDOM,          // uniformly distributed values
+    e_SORTED,          // increasing values
+    e_REVERSED,        // decreasing values
+    e_EQUAL,           // a single value
+    e_FEW_DISTINCT,    // eight distinct values, in random order
+    e_ORGAN_PIPE,      // increasing, then decreasing, values
+    e_SAWTOOTH,        // repeated increasing runs of 32 values
+    e_NEARLY_SORTED    // increasing values, with a few random exchanges
+};
+
+const int NUM_PATTERNS = e_NEARLY_SORTED + 1;
+
+static const char *const PATTERN_NAMES[NUM_PATTERNS] = {
+    "random", "sorted", "reversed", "equal", "few distinct", "organ pipe",
+    "sawtooth", "nearly sorted"
+};
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+static Uint64 nextRandom(Uint64 *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // a pseudo-random value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+template <class TYPE>
+TYPE makeValue(Int64 seed)
+    // Return a value of the arithmetic 'TYPE' derived from the specified
+    // 'seed', such that larger seeds yield larger values if 'seed' is
+    // representable in 'TYPE'.
+{
+    return static_cast<TYPE>(seed);
+}
+
+template <>
+double makeValue<double>(Int64 seed)
+{
+    return static_cast<double>(seed) / 1024;
+}
+
+template <>
+float makeValue<float>(Int64 seed)
+{
+    return static_cast<float>(seed) / 1024;
+}
+
+static Int64 patternSeed(Pattern pattern, int index, int length, Uint64 *state)
+    // Return the seed of the element at the specified 'index' of an input of
+    // the specified 'length' having the specified 'pattern', using the
+    // specified 'state' to generate pseudo-random values.
+{
+    switch (pattern) {
+      case e_RANDOM: {
+        return static_cast<Int64>(nextRandom(state));
+      }
+      case e_SORTED:
+      case e_NEARLY_SORTED: {
+        return index - length / 2;
+      }
+      case e_REVERSED: {
+        return length / 2 - index;
+      }
+      case e_EQUAL: {
+        return 42;
+      }
+      case e_FEW_DISTINCT: {
+        return static_cast<Int64>(nextRandom(state) % 8) - 3;
+      }
+      case e_ORGAN_PIPE: {
+        return index < length / 2 ? index : length - index;
+      }
+      case e_SAWTOOTH: {
+        return index % 32;
+      }
+    }
+    return 0;
+}
+
+template <class TYPE>
+void fillPattern(TYPE *array, int length, Pattern pattern, Uint64 *state)
+    // Load into the specified 'array' of the specified 'length' values of the
+    // arithmetic 'TYPE' having the specified 'pattern', using the specified
+    // 'state' to generate pseudo-random values.
+{
+    for (int i = 0; i < length; ++i) {
+        array[i] = makeValue<TYPE>(patternSeed(pattern, i, length, state));
+    }
+    if (e_NEARLY_SORTED == pattern && 1 < length) {
+        for (int i = 0; i < 4; ++i) {
+            const int a = static_cast<int>(nextRandom(state) % length);
+            const int b = static_cast<int>(nextRandom(state) % length);
+            const TYPE temp = array[a];
+            array[a] = array[b];
+            array[b] = temp;
+        }
+    }
+}
+
+template <class TYPE>
+bool isRadixOrdered(const TYPE& lhs, const TYPE& rhs)
+    // Return 'true' if the specified 'lhs' precedes the specified 'rhs' in
+    // radix sort order, and 'false' otherwise.
+{
+    typedef bslalg::SortUtil_RadixTraits<TYPE> Traits;
+    return Traits::toBits(lhs) < Traits::toBits(rhs);
+}
+
+template <class TYPE, int NUM_VALUES>
+void checkIncreasing(const TYPE (&values)[NUM_VALUES], int line)
+    // Verify that the specified 'values' are strictly increasing in radix sort
+    // order, reporting failures with the specified 'line'.
+{
+    for (int i = 1; i < NUM_VALUES; ++i) {
+        LOOP2_ASSERT(line, i,  isRadixOrdered(values[i - 1], values[i]));
+        LOOP2_ASSERT(line, i, !isRadixOrdered(values[i], values[i - 1]));
+    }
+}
+
+struct Record {
+    // This 'struct' provides an element sorted by key, having a sequence
+    // number to verify stability.
+
+    int d_key;
+    int d_sequence;
+};
+
+template <class KEY>
+struct RecordKey {
+    // This 'struct' template provides a key extractor returning the key of a
+    // 'Record', converted to 'KEY'.
+
+    typedef KEY result_type;
+
+    KEY operator()(const Record& record) const
+    {
+        return makeValue<KEY>(record.d_key);
+    }
+};
+
+template <class KEY>
+struct RecordKeyLess {
+    // This 'struct' template provides a comparator ordering 'Record' objects
+    // by their keys, converted to 'KEY'.
+
+    bool operator()(const Record& lhs, const Record& rhs) const
+    {
+        return makeValue<KEY>(lhs.d_key) < makeValue<KEY>(rhs.d_key);
+    }
+};
+
+struct Greater {
+    // This 'struct' provides a comparator ordering by decreasing value, and
+    // counting its invocations.
+
+    static Int64 s_count;
+
+    template <class TYPE>
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+    {
+        ++s_count;
+        return rhs < lhs;
+    }
+};
+
+Int64 Greater::s_count = 0;
+
+template <class TYPE>
+struct GreaterStd {
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+    {
+        return rhs < lhs;
+    }
+};
+
+template <class TYPE>
+void testRadixSort(const char *typeName, bool veryVerbose)
+    // Sort arrays of the arithmetic 'TYPE' having each pattern and many
+    // lengths using 'radixSort', and verify the results against
+    // 'native_std::stable_sort', using the specified 'typeName' in messages
+    // if the specified 'veryVerbose' is 'true'.
+{
+    static const int LENGTHS[] = { 0, 1, 2, 3, 63, 64, 65, 100, 1000, 5000 };
+    const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    if (veryVerbose) printf("\t%s\n", typeName);
+
+    bslma::TestAllocator ta("scratch");
+    Uint64               state = 7;
+
+    for (int li = 0; li < NUM_LENGTHS; ++li) {
+        const int LENGTH = LENGTHS[li];
+        for (int p = 0; p < NUM_PATTERNS; ++p) {
+            const Pattern PATTERN = static_cast<Pattern>(p);
+
+            native_std::vector<TYPE> mX(LENGTH + 1);
+            fillPattern(&mX[0], LENGTH, PATTERN, &state);
+            native_std::vector<TYPE> expected(mX);
+            native_std::stable_sort(expected.begin(),
+                                    expected.begin() + LENGTH,
+                                    &isRadixOrdered<TYPE>);
+
+            Obj::radixSort(mX.begin(), mX.begin() + LENGTH, &ta);
+
+            LOOP2_ASSERT(LENGTH, p,
+                         0 == LENGTH || 0 == memcmp(&expected[0],
+                                                    &mX[0],
+                                                    LENGTH * sizeof(TYPE)));
+            LOOP2_ASSERT(LENGTH, p, 0 == ta.numBlocksInUse());
+        }
+    }
+}
+
+template <class KEY>
+void testRadixSortByKey(const char *typeName, bool veryVerbose)
+    // Sort arrays of 'Record' objects having keys of each pattern, converted
+    // to 'KEY', and many lengths using 'radixSortByKey', and verify that the
+    // results equal those of 'native_std::stable_sort' (and so that the sort
+    // is stable), using the specified 'typeName' in messages if the specified
+    // 'veryVerbose' is 'true'.
+{
+    static const int LENGTHS[] = { 0, 1, 5, 63, 64, 65, 1000, 3000 };
+    const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    if (veryVerbose) printf("\t%s\n", typeName);
+
+    bslma::TestAllocator ta("scratch");
+    Uint64               state = 11;
+
+    for (int li = 0; li < NUM_LENGTHS; ++li) {
+        const int LENGTH = LENGTHS[li];
+        for (int p = 0; p < NUM_PATTERNS; ++p) {
+            const Pattern PATTERN = static_cast<Pattern>(p);
+
+            native_std::vector<Record> mX(LENGTH);
+            for (int i = 0; i < LENGTH; ++i) {
+                mX[i].d_key = static_cast<int>(
+                           patternSeed(PATTERN, i, LENGTH, &state) % 100000);
+                mX[i].d_sequence = i;
+            }
+            native_std::vector<Record> expected(mX);
+            native_std::stable_sort(expected.begin(),
+                                    expected.end(),
+                                    RecordKeyLess<KEY>());
+
+            Obj::radixSortByKey(mX.begin(), mX.end(), RecordKey<KEY>(), &ta);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                LOOP3_ASSERT(LENGTH, p, i,
+                             expected[i].d_key      == mX[i].d_key
+                          && expected[i].d_sequence == mX[i].d_sequence);
+            }
+            LOOP2_ASSERT(LENGTH, p, 0 == ta.numBlocksInUse());
+        }
+    }
+}
+
+template <class TYPE>
+void benchmark(const char *typeName, int length)
+    // Print the time taken to sort arrays of the specified 'length' having
+    // values of the arithmetic 'TYPE' and each pattern using
+    // 'native_std::sort', 'SortUtil::sort', and 'SortUtil::radixSort',
+    // labeled with the specified 'typeName'.
+{
+    native_std::vector<TYPE> input(length);
+    native_std::vector<TYPE> data(length);
+    Uint64                   state = 3;
+
+    printf("\n%s, %d elements (ns per element)\n", typeName, length);
+    printf("%-15s %12s %12s %12s\n",
+           "pattern", "std::sort", "sort", "radixSort");
+
+    for (int p = 0; p < NUM_PATTERNS; ++p) {
+        fillPattern(&input[0], length, static_cast<Pattern>(p), &state);
+
+        double times[3];
+        for (int algorithm = 0; algorithm < 3; ++algorithm) {
+            data = input;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            switch (algorithm) {
+              case 0: native_std::sort(data.begin(), data.end());  break;
+              case 1: Obj::sort(data.begin(), data.end());         break;
+              case 2: Obj::radixSort(data.begin(), data.end());    break;
+            }
+            timer.stop();
+            times[algorithm] = timer.elapsedTime() * 1e9 / length;
+
+            for (int i = 1; i < length; ++i) {
+                LOOP2_ASSERT(p, algorithm, !(data[i] < data[i - 1]));
+            }
+        }
+        printf("%-15s %12.2f %12.2f %12.2f\n",
+               PATTERN_NAMES[p], times[0], times[1], times[2]);
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting Trade Records by Timestamp
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive batches of trade records, and wish to process each
+// batch in order of the trades' timestamps.
+//
+// First, we define the record type, and a key extractor returning the
+// timestamp of a record:
+//..
+struct Trade {
+    bsls::Types::Int64 d_timestamp;  // nanoseconds since the epoch
+    int                d_quantity;
+    double             d_price;
+};
+
+struct TradeTimestamp {
+    typedef bsls::Types::Int64 result_type;
+
+    bsls::Types::Int64 operator()(const Trade& trade) const
+    {
+        return trade.d_timestamp;
+    }
+};
+//..
+
+struct HigherPrice {
+    bool operator()(const Trade& lhs, const Trade& rhs) const
+    {
+        return lhs.d_price > rhs.d_price;
+    }
+};
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    // Verify that no test case allocates from the default allocator, except
+    // where it is supposed to.
+
+    bslma::TestAllocator         defaultAllocator("default");
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a batch of trades whose timestamps are out of order:
+//..
+        Trade trades[] = {
+            { 1400000000000000300LL, 100, 10.5 },
+            { 1400000000000000100LL, 200, 10.4 },
+            { 1400000000000000200LL, 300, 10.6 },
+            { 1400000000000000100LL, 400, 10.3 },
+        };
+        const int NUM_TRADES = sizeof trades / sizeof *trades;
+//..
+// Next, we sort the trades by timestamp, using radix sort.  Because radix
+// sort is stable, the two trades having equal timestamps keep their original
+// relative order:
+//..
+        bslalg::SortUtil::radixSortByKey(trades,
+                                         trades + NUM_TRADES,
+                                         TradeTimestamp());
+
+        ASSERT(200 == trades[0].d_quantity);
+        ASSERT(400 == trades[1].d_quantity);
+        ASSERT(300 == trades[2].d_quantity);
+        ASSERT(100 == trades[3].d_quantity);
+//..
+// Then, we sort the prices themselves, which are arithmetic values, directly:
+//..
+        double prices[] = { 10.5, -1.25, 10.4, 0.0, 10.6 };
+
+        bslalg::SortUtil::radixSort(prices, prices + 5);
+
+        ASSERT(-1.25 == prices[0]);
+        ASSERT( 0.0  == prices[1]);
+        ASSERT(10.6  == prices[4]);
+//..
+// Finally, we sort the trades in decreasing order of price, using the
+// comparison sort and a comparator:
+//..
+        bslalg::SortUtil::sort(trades, trades + NUM_TRADES, HigherPrice());
+
+        ASSERT(10.6 == trades[0].d_price);
+        ASSERT(10.3 == trades[3].d_price);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'radixSortByKey'
+        //
+        // Concerns:
+        //: 1 Elements are ordered by the keys returned by the key extractor,
+        //:   for each supported type of key.
+        //:
+        //: 2 The sort is stable.
+        //:
+        //: 3 Ranges shorter than 'k_RADIX_SORT_THRESHOLD' are sorted too.
+        //:
+        //: 4 Scratch memory is allocated from the supplied allocator (or the
+        //:   default allocator, if none is supplied), only if some digit of
+        //:   the keys differs, and is released.
+        //:
+        //: 5 The sort is exception neutral: if allocating scratch memory
+        //:   fails, the range is unchanged and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Sort arrays of records of many lengths, whose keys have each
+        //:   input pattern and are converted to each key type, and compare
+        //:   with the result of 'native_std::stable_sort'.  (C-1..3)
+        //:
+        //: 2 Count the allocations from test allocators supplied, and
+        //:   installed as the default allocator.  (C-4)
+        //:
+        //: 3 Sort within the exception-testing macros.  (C-5)
+        //
+        // Testing:
+        //   void radixSortByKey(RANDOM_ITER, RANDOM_ITER, const KEY_EX&, *ba);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'radixSortByKey'"
+                            "\n========================\n");
+
+        if (veryVerbose) printf("Keys of each type.\n");
+
+        testRadixSortByKey<char>("char", veryVerbose);
+        testRadixSortByKey<signed char>("signed char", veryVerbose);
+        testRadixSortByKey<unsigned char>("unsigned char", veryVerbose);
+        testRadixSortByKey<short>("short", veryVerbose);
+        testRadixSortByKey<unsigned short>("unsigned short", veryVerbose);
+        testRadixSortByKey<int>("int", veryVerbose);
+        testRadixSortByKey<unsigned int>("unsigned int", veryVerbose);
+        testRadixSortByKey<long>("long", veryVerbose);
+        testRadixSortByKey<unsigned long>("unsigned long", veryVerbose);
+        testRadixSortByKey<long long>("long long", veryVerbose);
+        testRadixSortByKey<unsigned long long>("unsigned long long",
+                                               veryVerbose);
+        testRadixSortByKey<float>("float", veryVerbose);
+        testRadixSortByKey<double>("double", veryVerbose);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("Allocation.\n");
+        {
+            bslma::TestAllocator ta("supplied");
+
+            Record records[200];
+            for (int i = 0; i < 200; ++i) {
+                records[i].d_key      = 7;
+                records[i].d_sequence = i;
+            }
+
+            // All keys are equal: nothing to do.
+
+            Obj::radixSortByKey(records, records + 200, RecordKey<int>(), &ta);
+            ASSERT(0 == ta.numBlocksTotal());
+
+            // Short range: insertion sort.
+
+            records[0].d_key = 8;
+            Obj::radixSortByKey(records, records + 50, RecordKey<int>(), &ta);
+            ASSERT(0 == ta.numBlocksTotal());
+            ASSERT(8 == records[49].d_key);
+            ASSERT(0 == records[49].d_sequence);
+
+            // One allocation, from the supplied allocator.
+
+            Obj::radixSortByKey(records, records + 200, RecordKey<int>(), &ta);
+            ASSERT(1 == ta.numBlocksTotal());
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(8 == records[199].d_key);
+
+            // One allocation, from the default allocator.
+
+            records[0].d_key = 9;
+            Obj::radixSortByKey(records, records + 200, RecordKey<int>());
+            ASSERT(1 == ta.numBlocksTotal());
+            ASSERT(1 == defaultAllocator.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            ASSERT(9 == records[199].d_key);
+            ASSERT(8 == records[198].d_key);
+        }
+
+        if (veryVerbose) printf("Exception neutrality.\n");
+        {
+            bslma::TestAllocator ta("exception", veryVeryVerbose);
+
+            enum { k_LENGTH = 100 };
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                Record records[k_LENGTH];
+                for (int i = 0; i < k_LENGTH; ++i) {
+                    records[i].d_key      = k_LENGTH - i;
+                    records[i].d_sequence = i;
+                }
+                Record original[k_LENGTH];
+                memcpy(original, records, sizeof records);
+
+                try {
+                    Obj::radixSortByKey(records,
+                                        records + k_LENGTH,
+                                        RecordKey<int>(),
+                                        &ta);
+                }
+                catch (...) {
+                    ASSERT(0 == memcmp(original, records, sizeof records));
+                    ASSERT(0 == ta.numBlocksInUse());
+                    throw;
+                }
+                for (int i = 0; i < k_LENGTH; ++i) {
+                    LOOP_ASSERT(i, i + 1 == records[i].d_key);
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'radixSort'
+        //
+        // Concerns:
+        //: 1 Ranges of each supported arithmetic type are sorted into radix
+        //:   order, for every input pattern and many lengths, including
+        //:   lengths around 'k_RADIX_SORT_THRESHOLD'.
+        //:
+        //: 2 Ranges specified by iterators other than pointers (e.g., those of
+        //:   a deque) are sorted.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 Sort arrays of each type, having each pattern and many lengths,
+        //:   and compare with the result of 'native_std::stable_sort' using
+        //:   the radix order.  (C-1, 3)
+        //:
+        //: 2 Sort deques of pseudo-random values, and compare with the result
+        //:   of 'native_std::sort'.  (C-2)
+        //
+        // Testing:
+        //   void radixSort(RANDOM_ITER first, RANDOM_ITER last, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'radixSort'"
+                            "\n===================\n");
+
+        if (veryVerbose) printf("Each type.\n");
+
+        testRadixSort<char>("char", veryVerbose);
+        testRadixSort<signed char>("signed char", veryVerbose);
+        testRadixSort<unsigned char>("unsigned char", veryVerbose);
+        testRadixSort<short>("short", veryVerbose);
+        testRadixSort<unsigned short>("unsigned short", veryVerbose);
+        testRadixSort<int>("int", veryVerbose);
+        testRadixSort<unsigned int>("unsigned int", veryVerbose);
+        testRadixSort<long>("long", veryVerbose);
+        testRadixSort<unsigned long>("unsigned long", veryVerbose);
+        testRadixSort<long long>("long long", veryVerbose);
+        testRadixSort<unsigned long long>("unsigned long long", veryVerbose);
+        testRadixSort<float>("float", veryVerbose);
+        testRadixSort<double>("double", veryVerbose);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("Deques.\n");
+        {
+            bslma::TestAllocator ta("scratch");
+            Uint64               state = 5;
+
+            for (int length = 0; length < 3000; length = length * 2 + 1) {
+                native_std::deque<Int64> mX;
+                for (int i = 0; i < length; ++i) {
+                    mX.push_back(static_cast<Int64>(nextRandom(&state)));
+                }
+                native_std::deque<Int64> expected(mX);
+                native_std::sort(expected.begin(), expected.end());
+
+                Obj::radixSort(mX.begin(), mX.end(), &ta);
+
+                LOOP_ASSERT(length, expected == mX);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'sort'
+        //
+        // Concerns:
+        //: 1 Ranges are sorted for every input pattern and many lengths,
+        //:   including lengths around the insertion-sort and ninther
+        //:   thresholds.
+        //:
+        //: 2 A supplied comparator is used, and 'operator<' otherwise.
+        //:
+        //: 3 Ranges specified by iterators other than pointers are sorted.
+        //:
+        //: 4 The number of comparisons is 'O(N * log(N))' for every pattern,
+        //:   and 'O(N)' for sorted and equal inputs.
+        //:
+        //: 5 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Sort arrays of integers having each pattern and many lengths,
+        //:   with and without a comparator, and compare with the result of
+        //:   'native_std::stable_sort'.  (C-1..2)
+        //:
+        //: 2 Sort deques of pseudo-random values.  (C-3)
+        //:
+        //: 3 Count the comparisons made by a comparator.  (C-4)
+        //:
+        //: 4 Verify that the default allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   void sort(RANDOM_ITER first, RANDOM_ITER last);
+        //   void sort(RANDOM_ITER first, RANDOM_ITER last, COMPARATOR comp);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'sort'"
+                            "\n==============\n");
+
+        static const int LENGTHS[] = {
+            0, 1, 2, 3, 4, 23, 24, 25, 50, 127, 128, 129, 130, 500, 1000, 10000
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        Uint64 state = 13;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int LENGTH = LENGTHS[li];
+
+            int log2 = 1;
+            while ((1 << log2) < LENGTH) {
+                ++log2;
+            }
+
+            for (int p = 0; p < NUM_PATTERNS; ++p) {
+                const Pattern PATTERN = static_cast<Pattern>(p);
+
+                if (veryVerbose) { T_ P_(LENGTH) P(PATTERN_NAMES[p]) }
+
+                native_std::vector<int> input(LENGTH + 1);
+                fillPattern(&input[0], LENGTH, PATTERN, &state);
+
+                {
+                    native_std::vector<int> mX(input);
+                    native_std::vector<int> expected(input);
+                    native_std::stable_sort(expected.begin(),
+                                            expected.begin() + LENGTH);
+
+                    Obj::sort(mX.begin(), mX.begin() + LENGTH);
+                    LOOP2_ASSERT(LENGTH, p, expected == mX);
+                }
+                {
+                    native_std::vector<int> mX(input);
+                    native_std::vector<int> expected(input);
+                    native_std::stable_sort(expected.begin(),
+                                            expected.begin() + LENGTH,
+                                            GreaterStd<int>());
+
+                    Greater::s_count = 0;
+                    Obj::sort(mX.begin(), mX.begin() + LENGTH, Greater());
+                    LOOP2_ASSERT(LENGTH, p, expected == mX);
+
+                    const Int64 COUNT = Greater::s_count;
+                    if (veryVerbose) { T_ T_ P(COUNT) }
+
+                    LOOP3_ASSERT(LENGTH, p, COUNT,
+                                 COUNT <= 3 * LENGTH * log2 + 3 * LENGTH);
+                    // Decreasing input is already sorted for 'Greater'.
+
+                    if (e_REVERSED == PATTERN || e_EQUAL == PATTERN) {
+                        LOOP3_ASSERT(LENGTH, p, COUNT, COUNT <= 4 * LENGTH);
+                    }
+                }
+                {
+                    native_std::deque<int> mX(input.begin(),
+                                              input.begin() + LENGTH);
+                    native_std::deque<int> expected(mX);
+                    native_std::sort(expected.begin(), expected.end());
+
+                    Obj::sort(mX.begin(), mX.end());
+                    LOOP2_ASSERT(LENGTH, p, expected == mX);
+                }
+            }
+        }
+
+        if (veryVerbose) printf("Non-arithmetic elements.\n");
+        {
+            Record records[300];
+            for (int i = 0; i < 300; ++i) {
+                records[i].d_key      = static_cast<int>(nextRandom(&state));
+                records[i].d_sequence = i;
+            }
+            Obj::sort(records, records + 300, RecordKeyLess<int>());
+            for (int i = 1; i < 300; ++i) {
+                LOOP_ASSERT(i, records[i - 1].d_key <= records[i].d_key);
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING RADIX KEY ORDER
+        //
+        // Concerns:
+        //: 1 For each supported key type, the radix representation of keys
+        //:   is ordered as the keys, including at the extremes of the type
+        //:   and around zero.
+        //:
+        //: 2 For floating-point keys, '-0.0' precedes '+0.0', and infinities
+        //:   are ordered correctly.
+        //
+        // Plan:
+        //: 1 For each type, verify that 'toBits' is increasing over a table of
+        //:   increasing boundary values.  (C-1..2)
+        //
+        // Testing:
+        //   SortUtil_RadixTraits<KEY>::toBits(KEY key);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING RADIX KEY ORDER"
+                            "\n=======================\n");
+
+        {
+            const char VALUES[] = { CHAR_MIN, CHAR_MIN + 1, 0, 1, CHAR_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const signed char VALUES[] = { SCHAR_MIN, -1, 0, 1, SCHAR_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const unsigned char VALUES[] = { 0, 1, 127, 128, UCHAR_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const short VALUES[] = {
+                SHRT_MIN, -256, -1, 0, 1, 256, SHRT_MAX
+            };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const unsigned short VALUES[] = { 0, 1, 255, 256, USHRT_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const int VALUES[] = { INT_MIN, -65536, -1, 0, 1, 65536, INT_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const unsigned int VALUES[] = { 0, 1, 0x80000000U, UINT_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const long VALUES[] = { LONG_MIN, -1, 0, 1, LONG_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const unsigned long VALUES[] = { 0, 1, ULONG_MAX };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const long long VALUES[] = {
+                -0x7fffffffffffffffLL - 1,
+                -0x100000000LL,
+                -1,
+                0,
+                1,
+                0x100000000LL,
+                0x7fffffffffffffffLL
+            };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const unsigned long long VALUES[] = {
+                0,
+                1,
+                0x100000000ULL,
+                0x8000000000000000ULL,
+                0xffffffffffffffffULL
+            };
+            checkIncreasing(VALUES, L_);
+        }
+
+        const double DINF = 1e308 * 10;
+        const float  FINF = static_cast<float>(DINF);
+
+        {
+            const double VALUES[] = {
+                -DINF, -1e308, -1.5, -1.0, -1e-308, -0.0,
+                0.0, 1e-308, 1.0, 1.5, 1e308, DINF
+            };
+            checkIncreasing(VALUES, L_);
+        }
+        {
+            const float VALUES[] = {
+                -FINF, -1e38f, -1.5f, -1.0f, -1e-38f, -0.0f,
+                0.0f, 1e-38f, 1.0f, 1.5f, 1e38f, FINF
+            };
+            checkIncreasing(VALUES, L_);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Sort a small array of integers using each algorithm.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("scratch");
+
+        enum { k_LENGTH = 1000 };
+
+        int a[k_LENGTH];
+        int b[k_LENGTH];
+        for (int i = 0; i < k_LENGTH; ++i) {
+            a[i] = b[i] = (i * 7919) % k_LENGTH - k_LENGTH / 2;
+        }
+
+        Obj::sort(a, a + k_LENGTH);
+        Obj::radixSort(b, b + k_LENGTH, &ta);
+
+        for (int i = 0; i < k_LENGTH; ++i) {
+            LOOP_ASSERT(i, i - k_LENGTH / 2 == a[i]);
+            LOOP_ASSERT(i, i - k_LENGTH / 2 == b[i]);
+        }
+        ASSERT(1 == ta.numBlocksTotal());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'native_std::sort'
+        //
+        // Concerns:
+        //: 1 Radix sort is substantially faster than comparison sorts for
+        //:   large ranges of arithmetic keys.
+        //:
+        //: 2 'sort' is competitive with 'native_std::sort', and faster for
+        //:   sorted, reversed, and many-duplicate inputs.
+        //
+        // Plan:
+        //: 1 Time each algorithm sorting large arrays of several types having
+        //:   each input pattern.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'native_std::sort'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COMPARISON WITH 'native_std::sort'"
+                            "\n==============================================="
+                            "\n");
+
+        const int LENGTH = 1000000;
+
+        benchmark<int>         ("int",          LENGTH);
+        benchmark<unsigned int>("unsigned int", LENGTH);
+        benchmark<Int64>       ("Int64",        LENGTH);
+        benchmark<double>      ("double",       LENGTH);
+        benchmark<float>       ("float",        LENGTH);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,873 @@
+// bslalg_taskscheduler.cpp                                           -*-C++-*-
+#include <bslalg_taskscheduler.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslalg_threadimputil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    #define BSLALG_TASKSCHEDULER_THREAD_LOCAL __declspec(thread)
+#else
+    #define BSLALG_TASKSCHEDULER_THREAD_LOCAL __thread
+#endif
+
+// IMPLEMENTATION NOTES:
+// Each worker owns a 'WorkDeque', implementing the deque of Chase and Lev: the
+// owner pushes and pops tasks at the bottom, changing only 'd_bottom' unless
+// the deque holds a single task, while other threads steal tasks from the top
+// by compare-and-swap on 'd_top'.  The circular array of the deque is replaced
+// by one twice as large when it is full; stealing threads may still be
+// reading the old array, which is therefore retained until the deque is
+// destroyed (at most doubling the memory used by the deque).
+//
+// An idle worker blocks on 'd_condition' after incrementing 'd_numSleeping'
+// and checking, once more, that no task is available; a spawning thread makes
+// its task available and then, only if 'd_numSleeping' is not 0, increments
+// 'd_epoch' and signals 'd_condition'.  All of these operations are
+// sequentially consistent, so that either the idle worker finds the task or
+// the spawning thread finds the idle worker.  A worker waits only while
+// 'd_epoch' is unchanged from its value before the final check, so that a
+// signal sent between the check and the wait is not lost.
+//
+// A thread that is not a worker waits for a group by setting the low bit of
+// the group's 'd_state' (the other bits of which hold twice the number of
+// pending tasks) and, while tasks of the group are pending, blocking on
+// 'd_waitCondition'.  A worker completing the last pending task of a group
+// broadcasts 'd_waitCondition' only if it finds that bit set, so that groups
+// waited for by workers alone never cost a system call.  The waiting thread
+// checks the group while holding 'd_waitMutex', so that the broadcast is not
+// lost.  The bit is never cleared, as another thread may be waiting for the
+// same group; a later broadcast for that group is merely unnecessary.  The
+// worker touches only the scheduler after completing the last task, as the
+// group may then be destroyed.
+
+// To avoid a system call for every task spawned while some worker is
+// blocked, at most one wakeup is in progress at a time: a spawning thread
+// signals only if it sets 'd_wakePending', which every worker clears on
+// returning from 'sleep', before it searches for tasks.  A spawning thread
+// that finds 'd_wakePending' set can rely on that worker to find its task.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+namespace {
+
+typedef ThreadImpUtil::Handle    ThreadHandle;
+typedef ThreadImpUtil::Mutex     Mutex;
+typedef ThreadImpUtil::Condition Condition;
+typedef bsls::AtomicOperations   AtomicOps;
+typedef bsls::Types::Int64       Int64;
+typedef TaskScheduler_Task       Task;
+
+enum {
+    k_INITIAL_DEQUE_CAPACITY = 256,  // tasks held by a new deque
+
+    k_BLOCKS_PER_CHUNK       = 64,   // small blocks obtained from the
+                                     // allocator at a time, and moved to a
+                                     // worker's pool at a time
+
+    k_MAX_WORKER_BLOCKS      = 512,  // free small blocks a worker may hold
+                                     // before returning half of them
+
+    k_NUM_SPINS              = 64,   // failed searches for a task before
+                                     // yielding the processor
+
+    k_NUM_YIELDS             = 64    // failed searches for a task, after
+                                     // spinning, before a worker blocks
+};
+
+                             // ===============
+                             // class WorkDeque
+                             // ===============
+
+class WorkDeque {
+    // This class provides a double-ended queue of tasks, to which a single
+    // thread (the "owner") pushes, and from which it pops, tasks at the
+    // bottom, and from which any thread may steal tasks at the top.
+
+    // PRIVATE TYPES
+    struct Array {
+        // This 'struct' is the circular array holding the tasks of a deque,
+        // and is followed in memory by the remaining elements of 'd_slots'.
+
+        Int64                            d_mask;        // capacity - 1
+        Array                           *d_previous_p;  // replaced array
+        AtomicOps::AtomicTypes::Pointer  d_slots[1];    // tasks
+    };
+
+    // DATA
+    AtomicOps::AtomicTypes::Int64   d_top;        // index of first task
+    char                            d_pad[bsls::AlignmentUtil::
+                                                        BSLS_CACHE_LINE_SIZE];
+                                                  // separates 'd_top' from
+                                                  // the owner's fields
+    AtomicOps::AtomicTypes::Int64   d_bottom;     // index after last task
+    AtomicOps::AtomicTypes::Pointer d_array;      // current array (owned)
+    bslma::Allocator               *d_allocator_p;  // memory allocator (held)
+
+    // NOT IMPLEMENTED
+    WorkDeque(const WorkDeque&);
+    WorkDeque& operator=(const WorkDeque&);
+
+    // PRIVATE MANIPULATORS
+    Array *createArray(Int64 capacity, Array *previous)
+        // Return a new array having the specified 'capacity', which must be a
+        // power of two, and retaining the specified 'previous' array.
+    {
+        const bsls::Types::size_type size =
+                   sizeof(Array)
+                 + (capacity - 1) * sizeof(AtomicOps::AtomicTypes::Pointer);
+
+        Array *array = static_cast<Array *>(d_allocator_p->allocate(size));
+        array->d_mask       = capacity - 1;
+        array->d_previous_p = previous;
+        return array;
+    }
+
+    Array *grow(Array *array, Int64 top, Int64 bottom)
+        // Replace the specified full 'array', holding the tasks having
+        // indices in the range '[top .. bottom)', with an array twice as
+        // large holding the same tasks, and return the new array.
+    {
+        Array *result = createArray(2 * (array->d_mask + 1), array);
+        for (Int64 i = top; i < bottom; ++i) {
+            const void *task = AtomicOps::getPtrRelaxed(
+                                           &array->d_slots[i & array->d_mask]);
+            AtomicOps::setPtrRelaxed(&result->d_slots[i & result->d_mask],
+                                     const_cast<void *>(task));
+        }
+        AtomicOps::setPtrRelease(&d_array, result);
+        return result;
+    }
+
+  public:
+    // CREATORS
+    explicit WorkDeque(bslma::Allocator *allocator)
+        // Create an empty deque using the specified 'allocator' to supply
+        // memory.
+    : d_allocator_p(allocator)
+    {
+        AtomicOps::initInt64(&d_top, 0);
+        AtomicOps::initInt64(&d_bottom, 0);
+        AtomicOps::initPointer(&d_array,
+                               createArray(k_INITIAL_DEQUE_CAPACITY, 0));
+    }
+
+    ~WorkDeque()
+        // Destroy this deque, which must be empty.
+    {
+        Array *array = static_cast<Array *>(
+                   const_cast<void *>(AtomicOps::getPtrRelaxed(&d_array)));
+        while (array) {
+            Array *previous = array->d_previous_p;
+            d_allocator_p->deallocate(array);
+            array = previous;
+        }
+    }
+
+    // MANIPULATORS
+    void push(Task *task)
+        // Push the specified 'task' onto the bottom of this deque.  The
+        // behavior is undefined unless this method is called by the owner.
+    {
+        const Int64 bottom = AtomicOps::getInt64Relaxed(&d_bottom);
+        const Int64 top    = AtomicOps::getInt64Acquire(&d_top);
+
+        Array *array = static_cast<Array *>(
+                   const_cast<void *>(AtomicOps::getPtrRelaxed(&d_array)));
+        if (bottom - top > array->d_mask) {
+            array = grow(array, top, bottom);
+        }
+        AtomicOps::setPtrRelaxed(&array->d_slots[bottom & array->d_mask],
+                                 task);
+        AtomicOps::setInt64(&d_bottom, bottom + 1);
+    }
+
+    Task *pop()
+        // Remove the task at the bottom of this deque, and return its
+        // address, or return 0 if this deque is empty.  The behavior is
+        // undefined unless this method is called by the owner.
+    {
+        const Int64 bottom = AtomicOps::getInt64Relaxed(&d_bottom) - 1;
+        Array      *array  = static_cast<Array *>(
+                   const_cast<void *>(AtomicOps::getPtrRelaxed(&d_array)));
+
+        AtomicOps::setInt64(&d_bottom, bottom);
+        const Int64 top = AtomicOps::getInt64(&d_top);
+
+        if (bottom < top) {
+            AtomicOps::setInt64Relaxed(&d_bottom, bottom + 1);
+            return 0;                                                 // RETURN
+        }
+
+        Task *task = static_cast<Task *>(const_cast<void *>(
+                AtomicOps::getPtrRelaxed(&array->d_slots[bottom
+                                                         & array->d_mask])));
+        if (bottom == top) {
+            // This is the last task: race any thief for it.
+
+            if (top != AtomicOps::testAndSwapInt64(&d_top, top, top + 1)) {
+                task = 0;
+            }
+            AtomicOps::setInt64Relaxed(&d_bottom, bottom + 1);
+        }
+        return task;
+    }
+
+    Task *steal()
+        // Remove the task at the top of this deque, and return its address,
+        // or return 0 if this deque is empty or another thread removed that
+        // task first.
+    {
+        const Int64 top    = AtomicOps::getInt64(&d_top);
+        const Int64 bottom = AtomicOps::getInt64(&d_bottom);
+
+        if (bottom <= top) {
+            return 0;                                                 // RETURN
+        }
+
+        Array *array = static_cast<Array *>(
+                   const_cast<void *>(AtomicOps::getPtrAcquire(&d_array)));
+        Task  *task  = static_cast<Task *>(const_cast<void *>(
+                 AtomicOps::getPtrRelaxed(&array->d_slots[top
+                                                          & array->d_mask])));
+
+        if (top != AtomicOps::testAndSwapInt64(&d_top, top, top + 1)) {
+            return 0;                                                 // RETURN
+        }
+        return task;
+    }
+
+    // ACCESSORS
+    bool isEmpty() const
+        // Return 'true' if this deque holds no tasks, and 'false' otherwise.
+    {
+        const Int64 top = AtomicOps::getInt64(&d_top);
+        return AtomicOps::getInt64(&d_bottom) <= top;
+    }
+};
+
+                               // =============
+                               // struct Worker
+                               // =============
+
+struct Worker : ThreadImpUtil::Runnable {
+    // This 'struct' holds the state of a worker thread of a scheduler, and is
+    // run by that thread.
+
+    // DATA
+    WorkDeque          d_deque;          // tasks spawned by this worker
+    TaskScheduler_Imp *d_imp_p;          // scheduler of this worker (held)
+    Task              *d_freeBlocks_p;   // free small blocks
+    int                d_numFreeBlocks;  // length of 'd_freeBlocks_p'
+
+    // CREATORS
+    Worker(TaskScheduler_Imp *imp, bslma::Allocator *allocator)
+        // Create a worker of the scheduler having the specified 'imp', using
+        // the specified 'allocator' to supply memory.
+    : d_deque(allocator)
+    , d_imp_p(imp)
+    , d_freeBlocks_p(0)
+    , d_numFreeBlocks(0)
+    {
+    }
+
+    // MANIPULATORS
+    void run();
+        // Run the worker loop of the scheduler of this worker on the calling
+        // thread.
+};
+
+static BSLALG_TASKSCHEDULER_THREAD_LOCAL Worker *s_currentWorker_p;
+    // the worker running on the calling thread, or 0 if none
+
+static BSLALG_TASKSCHEDULER_THREAD_LOCAL unsigned int s_randomState;
+    // the state of the random number generator of the calling thread, or 0
+    // if not yet seeded
+
+unsigned int nextRandom()
+    // Return the next value of the random number generator of the calling
+    // thread.
+{
+    unsigned int x = s_randomState;
+    if (0 == x) {
+        x = static_cast<unsigned int>(
+                    reinterpret_cast<bsls::Types::UintPtr>(&s_randomState))
+          | 1;
+    }
+
+    // Use Marsaglia's "xorshift" generator, whose low bits are good enough to
+    // choose a victim.
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_randomState = x;
+    return x;
+}
+
+}  // close unnamed namespace
+
+                         // ========================
+                         // struct TaskScheduler_Imp
+                         // ========================
+
+struct TaskScheduler_Imp {
+    // This 'struct' holds the state of a 'TaskScheduler'.
+
+    // DATA
+    Worker           **d_workers_p;     // workers, one per requested thread
+                                        // (owned)
+    int                d_numWorkers;    // length of 'd_workers_p'
+    ThreadHandle      *d_threads_p;     // worker threads
+    int                d_numThreads;    // number of started worker threads
+    bslma::Allocator  *d_allocator_p;   // memory allocator (held)
+
+    bsls::SpinLock     d_queueLock;     // protects the shared queue
+    Task              *d_queueHead_p;   // first task spawned by a non-worker
+    Task              *d_queueTail_p;   // last task spawned by a non-worker
+    bsls::AtomicInt    d_queueLength;   // number of tasks in the queue
+
+    bsls::SpinLock     d_poolLock;      // protects the shared pool
+    Task              *d_freeBlocks_p;  // free small blocks
+    void              *d_chunks_p;      // blocks allocated for small tasks
+
+    Mutex              d_mutex;         // protects blocking on 'd_condition'
+    Condition          d_condition;     // signals 'd_epoch' or 'd_stop'
+    bsls::AtomicInt    d_epoch;         // number of wakeups
+    bsls::AtomicInt    d_numSleeping;   // workers blocking, or about to block
+    bsls::AtomicInt    d_wakePending;   // 1 if a worker is being woken
+    bsls::AtomicInt    d_stop;          // 1 if workers should exit
+
+    Mutex              d_waitMutex;     // protects blocking on
+                                        // 'd_waitCondition'
+    Condition          d_waitCondition; // signals a group's completion
+
+    // CREATORS
+    explicit TaskScheduler_Imp(bslma::Allocator *allocator)
+        // Create the state of a scheduler having no workers, using the
+        // specified 'allocator' to supply memory.
+    : d_workers_p(0)
+    , d_numWorkers(0)
+    , d_threads_p(0)
+    , d_numThreads(0)
+    , d_allocator_p(allocator)
+    , d_queueHead_p(0)
+    , d_queueTail_p(0)
+    , d_queueLength(0)
+    , d_freeBlocks_p(0)
+    , d_chunks_p(0)
+    , d_epoch(0)
+    , d_numSleeping(0)
+    , d_wakePending(0)
+    , d_stop(0)
+    {
+        d_queueLock.initialize();
+        d_poolLock.initialize();
+    }
+
+    ~TaskScheduler_Imp()
+        // Destroy the workers of this scheduler, and release its memory.
+    {
+        for (int i = 0; i < d_numWorkers; ++i) {
+            d_allocator_p->deleteObject(d_workers_p[i]);
+        }
+        if (d_workers_p) {
+            d_allocator_p->deallocate(d_workers_p);
+        }
+        if (d_threads_p) {
+            d_allocator_p->deallocate(d_threads_p);
+        }
+        while (d_chunks_p) {
+            void *next = *static_cast<void **>(d_chunks_p);
+            d_allocator_p->deallocate(d_chunks_p);
+            d_chunks_p = next;
+        }
+    }
+
+    // MANIPULATORS
+    void *allocateTask(native_std::size_t size);
+        // Return a block of at least the specified 'size' bytes for a task.
+
+    void allocateChunk();
+        // Add 'k_BLOCKS_PER_CHUNK' blocks, obtained from the allocator, to
+        // the shared pool.  The behavior is undefined unless 'd_poolLock' is
+        // held.
+
+    void deallocateTask(void *block, bool isSmall);
+        // Return the specified 'block', obtained from 'allocateTask', to this
+        // scheduler, to its pool if the specified 'isSmall' is 'true', and to
+        // the allocator otherwise.
+
+    Task *findTask(Worker *worker);
+        // Remove a task from the deque of the specified 'worker', if it is
+        // not 0, or else from the shared queue, or else from the deque of
+        // another worker, and return its address, or return 0 if no task was
+        // found.
+
+    void refill(Worker *worker);
+        // Move up to 'k_BLOCKS_PER_CHUNK' blocks from the shared pool, which
+        // is first replenished if empty, to the pool of the specified
+        // 'worker'.
+
+    void runTask(Task *task);
+        // Run, and then release, the specified 'task', and mark it complete.
+
+    void sleep();
+        // Block the calling worker until a task may be available, or the
+        // workers are to exit.  Note that this method may return spuriously.
+
+    void submit(Task *task);
+        // Make the specified 'task' available to the threads of this
+        // scheduler.
+
+    Task *takeShared();
+        // Remove the task at the head of the shared queue, and return its
+        // address, or return 0 if the queue is empty.
+
+    void waitFor(TaskGroup *group);
+        // Return when no task of the specified 'group' is pending, running
+        // tasks on the calling thread in the meantime if it is a worker, and
+        // blocking otherwise.
+
+    void workerLoop(Worker *worker);
+        // Run tasks on the calling thread, as the specified 'worker', until
+        // the workers are to exit.
+
+    // ACCESSORS
+    Worker *currentWorker() const;
+        // Return the worker of this scheduler running on the calling thread,
+        // or 0 if the calling thread is not a worker of this scheduler.
+
+    bool hasWork() const;
+        // Return 'true' if a task may be available, and 'false' otherwise.
+};
+
+// MANIPULATORS
+void *TaskScheduler_Imp::allocateTask(native_std::size_t size)
+{
+    if (size <= TaskScheduler::k_SMALL_TASK_SIZE) {
+        Task *task;
+        Worker *worker = currentWorker();
+        if (worker) {
+            if (!worker->d_freeBlocks_p) {
+                refill(worker);
+            }
+            task                   = worker->d_freeBlocks_p;
+            worker->d_freeBlocks_p = task->d_next_p;
+            --worker->d_numFreeBlocks;
+        }
+        else {
+            bsls::SpinLockGuard<bsls::SpinLock> guard(&d_poolLock);
+            if (!d_freeBlocks_p) {
+                allocateChunk();
+            }
+            task           = d_freeBlocks_p;
+            d_freeBlocks_p = task->d_next_p;
+        }
+        return task;                                                  // RETURN
+    }
+    return d_allocator_p->allocate(size);
+}
+
+void TaskScheduler_Imp::allocateChunk()
+{
+    // The first block of a chunk links the chunks together.
+
+    const bsls::Types::size_type size =
+                  (k_BLOCKS_PER_CHUNK + 1) * TaskScheduler::k_SMALL_TASK_SIZE;
+
+    char *chunk = static_cast<char *>(d_allocator_p->allocate(size));
+
+    *reinterpret_cast<void **>(chunk) = d_chunks_p;
+    d_chunks_p = chunk;
+
+    for (int i = k_BLOCKS_PER_CHUNK; 0 < i; --i) {
+        Task *block = reinterpret_cast<Task *>(
+                                 chunk + i * TaskScheduler::k_SMALL_TASK_SIZE);
+        block->d_next_p = d_freeBlocks_p;
+        d_freeBlocks_p  = block;
+    }
+}
+
+void TaskScheduler_Imp::deallocateTask(void *block, bool isSmall)
+{
+    if (!isSmall) {
+        d_allocator_p->deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    Task *task = static_cast<Task *>(block);
+
+    Worker *worker = currentWorker();
+    if (!worker) {
+        bsls::SpinLockGuard<bsls::SpinLock> guard(&d_poolLock);
+        task->d_next_p = d_freeBlocks_p;
+        d_freeBlocks_p = task;
+        return;                                                       // RETURN
+    }
+
+    task->d_next_p         = worker->d_freeBlocks_p;
+    worker->d_freeBlocks_p = task;
+    if (++worker->d_numFreeBlocks <= k_MAX_WORKER_BLOCKS) {
+        return;                                                       // RETURN
+    }
+
+    // Keep half of the blocks, and return the rest to the shared pool, so
+    // that a worker that only runs tasks spawned by others does not hoard
+    // their memory.
+
+    Task *last = worker->d_freeBlocks_p;
+    for (int i = 1; i < k_MAX_WORKER_BLOCKS / 2; ++i) {
+        last = last->d_next_p;
+    }
+    Task *surplus = last->d_next_p;
+    Task *tail    = surplus;
+    while (tail->d_next_p) {
+        tail = tail->d_next_p;
+    }
+    last->d_next_p            = 0;
+    worker->d_numFreeBlocks   = k_MAX_WORKER_BLOCKS / 2;
+
+    bsls::SpinLockGuard<bsls::SpinLock> guard(&d_poolLock);
+    tail->d_next_p = d_freeBlocks_p;
+    d_freeBlocks_p = surplus;
+}
+
+Task *TaskScheduler_Imp::findTask(Worker *worker)
+{
+    Task *task;
+    if (worker && 0 != (task = worker->d_deque.pop())) {
+        return task;                                                  // RETURN
+    }
+    if (0 != (task = takeShared())) {
+        return task;                                                  // RETURN
+    }
+
+    // Try each other worker once, starting from one chosen at random.
+
+    int victim = static_cast<int>(nextRandom() % d_numWorkers);
+    for (int i = 0; i < d_numWorkers; ++i) {
+        Worker *other = d_workers_p[victim];
+        if (other != worker && 0 != (task = other->d_deque.steal())) {
+            return task;                                              // RETURN
+        }
+        if (++victim == d_numWorkers) {
+            victim = 0;
+        }
+    }
+    return 0;
+}
+
+void TaskScheduler_Imp::refill(Worker *worker)
+{
+    bsls::SpinLockGuard<bsls::SpinLock> guard(&d_poolLock);
+    if (!d_freeBlocks_p) {
+        allocateChunk();
+    }
+
+    Task *last = d_freeBlocks_p;
+    int   n    = 1;
+    while (n < k_BLOCKS_PER_CHUNK && last->d_next_p) {
+        last = last->d_next_p;
+        ++n;
+    }
+    worker->d_freeBlocks_p   = d_freeBlocks_p;
+    worker->d_numFreeBlocks += n;
+    d_freeBlocks_p           = last->d_next_p;
+    last->d_next_p           = 0;
+}
+
+void TaskScheduler_Imp::runTask(Task *task)
+{
+    TaskGroup *group = task->d_group_p;
+
+    task->d_invoker(task);
+    deallocateTask(task, task->d_isSmall);
+
+    // The group may be destroyed as soon as its count reaches 0.  A state of
+    // 1 means that no task is pending and some thread may be blocked.
+
+    if (1 == group->d_state.add(-2)) {
+        d_waitMutex.lock();
+        d_waitCondition.broadcast();
+        d_waitMutex.unlock();
+    }
+}
+
+void TaskScheduler_Imp::sleep()
+{
+    const int epoch = d_epoch.loadAcquire();
+
+    d_numSleeping.add(1);
+    if (!hasWork() && !d_stop.load()) {
+        d_mutex.lock();
+        while (epoch == d_epoch.loadRelaxed() && !d_stop.loadRelaxed()) {
+            d_condition.wait(&d_mutex);
+        }
+        d_mutex.unlock();
+    }
+    d_numSleeping.add(-1);
+    d_wakePending.storeRelease(0);
+}
+
+void TaskScheduler_Imp::submit(Task *task)
+{
+    Worker *worker = currentWorker();
+    if (worker) {
+        worker->d_deque.push(task);
+    }
+    else {
+        bsls::SpinLockGuard<bsls::SpinLock> guard(&d_queueLock);
+        if (d_queueTail_p) {
+            d_queueTail_p->d_next_p = task;
+        }
+        else {
+            d_queueHead_p = task;
+        }
+        d_queueTail_p = task;
+        d_queueLength.add(1);
+    }
+
+    if (0 != d_numSleeping.load() && 0 == d_wakePending.testAndSwap(0, 1)) {
+        d_mutex.lock();
+        d_epoch.addRelaxed(1);
+        d_condition.signal();
+        d_mutex.unlock();
+    }
+}
+
+Task *TaskScheduler_Imp::takeShared()
+{
+    if (0 == d_queueLength.loadRelaxed()) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::SpinLockGuard<bsls::SpinLock> guard(&d_queueLock);
+    Task *task = d_queueHead_p;
+    if (task) {
+        d_queueHead_p = task->d_next_p;
+        if (!d_queueHead_p) {
+            d_queueTail_p = 0;
+        }
+        d_queueLength.add(-1);
+    }
+    return task;
+}
+
+void TaskScheduler_Imp::waitFor(TaskGroup *group)
+{
+    bsls::AtomicInt& state = group->d_state;
+
+    Worker *worker = currentWorker();
+    if (worker) {
+        int numFailures = 0;
+        while (1 < state.loadAcquire()) {
+            Task *task = findTask(worker);
+            if (task) {
+                runTask(task);
+                numFailures = 0;
+            }
+            else if (++numFailures > k_NUM_SPINS) {
+                ThreadImpUtil::yield();
+            }
+        }
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < k_NUM_SPINS; ++i) {
+        if (2 > state.loadAcquire()) {
+            return;                                                   // RETURN
+        }
+    }
+
+    if (2 > state.fetchOr(1)) {
+        return;                                                       // RETURN
+    }
+
+    d_waitMutex.lock();
+    while (1 < state.loadAcquire()) {
+        d_waitCondition.wait(&d_waitMutex);
+    }
+    d_waitMutex.unlock();
+}
+
+void TaskScheduler_Imp::workerLoop(Worker *worker)
+{
+    s_currentWorker_p = worker;
+
+    int numFailures = 0;
+    while (!d_stop.loadAcquire()) {
+        Task *task = findTask(worker);
+        if (task) {
+            runTask(task);
+            numFailures = 0;
+        }
+        else if (++numFailures <= k_NUM_SPINS) {
+            // Search again at once.
+        }
+        else if (numFailures <= k_NUM_SPINS + k_NUM_YIELDS) {
+            ThreadImpUtil::yield();
+        }
+        else {
+            sleep();
+            numFailures = 0;
+        }
+    }
+
+    s_currentWorker_p = 0;
+}
+
+// ACCESSORS
+Worker *TaskScheduler_Imp::currentWorker() const
+{
+    Worker *worker = s_currentWorker_p;
+    return worker && this == worker->d_imp_p ? worker : 0;
+}
+
+bool TaskScheduler_Imp::hasWork() const
+{
+    if (0 != d_queueLength.load()) {
+        return true;                                                  // RETURN
+    }
+    for (int i = 0; i < d_numWorkers; ++i) {
+        if (!d_workers_p[i]->d_deque.isEmpty()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+                               // -------------
+                               // struct Worker
+                               // -------------
+
+// MANIPULATORS
+void Worker::run()
+{
+    d_imp_p->workerLoop(this);
+}
+
+                           // -------------------
+                           // class TaskScheduler
+                           // -------------------
+
+// PRIVATE MANIPULATORS
+void *TaskScheduler::allocateTask(native_std::size_t size)
+{
+    return d_imp_p->allocateTask(size);
+}
+
+void TaskScheduler::deallocateTask(void *block, native_std::size_t size)
+{
+    d_imp_p->deallocateTask(block, size <= k_SMALL_TASK_SIZE);
+}
+
+void TaskScheduler::submit(TaskScheduler_Task *task)
+{
+    d_imp_p->submit(task);
+}
+
+void TaskScheduler::waitFor(TaskGroup *group)
+{
+    d_imp_p->waitFor(group);
+}
+
+// CLASS METHODS
+int TaskScheduler::numProcessors()
+{
+    return ThreadImpUtil::numProcessors();
+}
+
+// CREATORS
+TaskScheduler::TaskScheduler(int numThreads, bslma::Allocator *basicAllocator)
+: d_imp_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    TaskScheduler_Imp *imp = new (*d_allocator_p) TaskScheduler_Imp(
+                                                                d_allocator_p);
+
+    // Create every worker before starting any thread, as each thread may
+    // steal from any worker.  If a thread cannot be started, its worker
+    // remains, with an empty deque.
+
+    const bsls::Types::size_type size = numThreads * sizeof(Worker *);
+
+    imp->d_workers_p = static_cast<Worker **>(d_allocator_p->allocate(size));
+    for (int i = 0; i < numThreads; ++i) {
+        imp->d_workers_p[i] = new (*d_allocator_p) Worker(imp, d_allocator_p);
+        ++imp->d_numWorkers;
+    }
+
+    imp->d_threads_p = static_cast<ThreadHandle *>(
+                 d_allocator_p->allocate(numThreads * sizeof(ThreadHandle)));
+
+    for (int i = 0; i < numThreads; ++i) {
+        if (0 != ThreadImpUtil::create(&imp->d_threads_p[i],
+                                       imp->d_workers_p[i])) {
+            break;
+        }
+        ++imp->d_numThreads;
+    }
+
+    d_imp_p = imp;
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    d_imp_p->d_mutex.lock();
+    d_imp_p->d_stop.storeRelease(1);
+    d_imp_p->d_condition.broadcast();
+    d_imp_p->d_mutex.unlock();
+
+    for (int i = 0; i < d_imp_p->d_numThreads; ++i) {
+        ThreadImpUtil::join(d_imp_p->d_threads_p[i]);
+    }
+
+    d_allocator_p->deleteObject(d_imp_p);
+}
+
+// ACCESSORS
+int TaskScheduler::numThreads() const
+{
+    return d_imp_p->d_numThreads;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,473 @@
+// bslalg_taskscheduler.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLALG_TASKSCHEDULER
+#define INCLUDED_BSLALG_TASKSCHEDULER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a work-stealing scheduler for fork-join task parallelism.
+//
+//@CLASSES:
+//  bslalg::TaskScheduler: set of worker threads that steal tasks from another
+//  bslalg::TaskGroup: set of tasks that can be waited on together
+//
+//@SEE_ALSO: bslalg_parallelutil
+//
+//@DESCRIPTION: This component provides a task scheduler,
+// 'bslalg::TaskScheduler', that runs small units of work ("tasks") on a fixed
+// set of worker threads, and a mechanism, 'bslalg::TaskGroup', through which
+// tasks are spawned and then waited upon.  A task is a copy of an arbitrary
+// function object, invoked with no arguments.  Tasks may themselves spawn
+// tasks, and wait for them, so that divide-and-conquer algorithms (e.g.,
+// quicksort, or tree traversals) are expressed naturally, and the scheduler
+// is designed to sustain very high rates of spawning.
+//
+// Where 'bslalg::ParallelThreadPool' (see 'bslalg_parallelutil') executes a
+// single job of a known number of tasks at a time, 'bslalg::TaskScheduler'
+// accepts tasks from any thread at any time.
+//
+///Work Stealing
+///-------------
+// Each worker thread owns a double-ended queue of tasks, as described by
+// Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005).  A task
+// spawned by a worker is pushed onto the bottom of the worker's own deque,
+// and a worker runs the task at the bottom of its deque -- the one spawned
+// most recently -- next, so that each worker processes its tasks
+// depth-first, much as a sequential program would, and without
+// synchronizing with other threads.  A worker whose deque is empty instead
+// *steals* the task at the top of the deque -- the one spawned least
+// recently, and (in a divide-and-conquer algorithm) the largest -- of
+// another worker chosen at random.  Tasks spawned by threads that are not
+// workers of the scheduler are placed on a shared queue, from which workers
+// take them when their own deques are empty.
+//
+// A worker that finds no task to run spins briefly, then yields, and
+// eventually blocks until a task is spawned; spawning a task only makes a
+// system call when some worker is blocked.
+//
+///Task Groups
+///-----------
+// Every task is spawned through a 'bslalg::TaskGroup', which counts the tasks
+// spawned through it that have not yet completed.  'TaskGroup::wait' returns
+// once every such task has completed.  A worker that waits runs tasks (of any
+// group) in the meantime, rather than blocking, taking them from its own
+// deque first: a worker waiting for the children of its task therefore
+// continues to process work, and the number of threads needed by a fork-join
+// algorithm does not grow with its depth.  A thread that is not a worker
+// blocks while it waits (after checking briefly for completion): the tasks it
+// could find, on the shared queue or by stealing, are not those it is waiting
+// for, and running them could nest without bound.  The destructor of
+// 'TaskGroup' waits for the tasks of the group.
+//
+///Task Memory
+///-----------
+// The copy of the function object of a task is stored in a block of memory
+// that is obtained, if it is small enough ('k_SMALL_TASK_SIZE' bytes,
+// including the scheduler's bookkeeping), from a pool of blocks private to the
+// spawning worker, so that spawning a small task from a worker neither
+// allocates memory nor synchronizes with other threads.  The blocks are
+// obtained, many at a time, from the allocator supplied at construction, and
+// blocks released by one worker in excess of a limit are returned to a
+// shared pool for use by other threads; all of the blocks are released to the
+// allocator when the scheduler is destroyed.  The blocks of larger tasks are
+// allocated and deallocated individually.  The allocator supplied to a
+// scheduler is used concurrently by its workers, and must be thread-safe.
+//
+///Requirements on Tasks
+///---------------------
+// The function object of a task must be copy-constructible, and invocable as
+// a 'const' object with no arguments; the result of the invocation, if any,
+// is ignored.  If copying the function object throws an exception, the
+// exception is propagated to the caller of 'spawn', and no task is spawned.
+// A task must not exit by throwing an exception; the behavior is undefined
+// otherwise.  Every task group using a scheduler must be destroyed before the
+// scheduler.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing Fibonacci Numbers by Fork-Join
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we wish to compute a Fibonacci number by the (deliberately
+// inefficient) recursive definition, using several threads.  Although this is
+// not a sensible way to compute Fibonacci numbers, it is the classic
+// illustration of fork-join parallelism, in which the work is recursively
+// divided into very many small tasks.
+//
+// First, we define a sequential function for the small cases:
+//..
+//  long serialFibonacci(int n)
+//  {
+//      return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+//  }
+//..
+// Then, we define a function object that computes a Fibonacci number by
+// spawning a task to compute one of the preceding numbers, computing the
+// other itself, and waiting for the spawned task:
+//..
+//  struct Fibonacci {
+//      int                    d_n;
+//      long                  *d_result_p;
+//      bslalg::TaskScheduler *d_scheduler_p;
+//
+//      void operator()() const
+//      {
+//          if (d_n < 20) {
+//              *d_result_p = serialFibonacci(d_n);
+//              return;                                               // RETURN
+//          }
+//
+//          long              first;
+//          long              second;
+//          bslalg::TaskGroup group(d_scheduler_p);
+//
+//          Fibonacci firstTask = { d_n - 1, &first, d_scheduler_p };
+//          group.spawn(firstTask);
+//
+//          Fibonacci secondTask = { d_n - 2, &second, d_scheduler_p };
+//          secondTask();
+//
+//          group.wait();
+//          *d_result_p = first + second;
+//      }
+//  };
+//..
+// Next, we create a scheduler having four worker threads:
+//..
+//  bslalg::TaskScheduler scheduler(4);
+//..
+// Finally, we compute a Fibonacci number by spawning a single task, and
+// waiting for it:
+//..
+//  long result = 0;
+//  {
+//      bslalg::TaskGroup group(&scheduler);
+//
+//      Fibonacci task = { 30, &result, &scheduler };
+//      group.spawn(task);
+//      group.wait();
+//  }
+//  assert(832040 == result);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+class TaskGroup;
+struct TaskScheduler_Imp;
+
+                         // =========================
+                         // struct TaskScheduler_Task
+                         // =========================
+
+struct TaskScheduler_Task {
+    // This 'struct' is the header of the block of memory holding a task,
+    // which is followed in the block by the function object of the task.
+    // This 'struct' is for use only by this component.
+
+    // TYPES
+    typedef void (*Invoker)(TaskScheduler_Task *task);
+        // 'Invoker' is an alias for a function that invokes, and then
+        // destroys, the function object of the specified 'task'.
+
+    // DATA
+    Invoker             d_invoker;  // invokes and destroys the function
+    TaskGroup          *d_group_p;  // group of this task (held)
+    TaskScheduler_Task *d_next_p;   // next block in a queue or free list
+    bool                d_isSmall;  // 'true' if the block is pooled
+};
+
+                     // ================================
+                     // struct TaskScheduler_FunctorTask
+                     // ================================
+
+template <class FUNCTOR>
+struct TaskScheduler_FunctorTask : TaskScheduler_Task {
+    // This 'struct' template holds a task whose function object has the
+    // (template parameter) type 'FUNCTOR'.  This 'struct' is for use only by
+    // this component.
+
+    // DATA
+    FUNCTOR d_functor;  // function object of the task
+
+    // CREATORS
+    explicit TaskScheduler_FunctorTask(const FUNCTOR& functor)
+        // Create a task holding a copy of the specified 'functor'.
+    : d_functor(functor)
+    {
+    }
+
+    // CLASS METHODS
+    static void invoke(TaskScheduler_Task *task)
+        // Invoke, and then destroy, the function object of the specified
+        // 'task', which must be a 'TaskScheduler_FunctorTask<FUNCTOR>'.
+    {
+        TaskScheduler_FunctorTask *self =
+                                static_cast<TaskScheduler_FunctorTask *>(task);
+
+        static_cast<const FUNCTOR&>(self->d_functor)();
+        self->~TaskScheduler_FunctorTask();
+    }
+};
+
+                           // ===================
+                           // class TaskScheduler
+                           // ===================
+
+class TaskScheduler {
+    // This class provides a fixed set of worker threads that run the tasks
+    // spawned through task groups using this scheduler, balancing the load
+    // between them by work stealing.
+
+    // DATA
+    TaskScheduler_Imp *d_imp_p;        // platform-specific state (owned)
+    bslma::Allocator  *d_allocator_p;  // memory allocator (held)
+
+    // FRIENDS
+    friend class TaskGroup;
+
+  private:
+    // NOT IMPLEMENTED
+    TaskScheduler(const TaskScheduler&);
+    TaskScheduler& operator=(const TaskScheduler&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateTask(native_std::size_t size);
+        // Return the address of a maximally aligned block of at least the
+        // specified 'size' bytes, in which a task is to be created.  Note
+        // that the block is obtained from a pool if 'size' is at most
+        // 'k_SMALL_TASK_SIZE'.
+
+    void deallocateTask(void *block, native_std::size_t size);
+        // Return the specified 'block', obtained from 'allocateTask' for the
+        // specified 'size', to this scheduler.
+
+    void submit(TaskScheduler_Task *task);
+        // Make the specified 'task' available to be run by the threads of
+        // this scheduler.
+
+    void waitFor(TaskGroup *group);
+        // Return when every task spawned through the specified 'group' has
+        // completed, running available tasks on the calling thread in the
+        // meantime if it is a worker of this scheduler, and blocking
+        // otherwise.
+
+  public:
+    // TYPES
+    enum {
+        k_SMALL_TASK_SIZE = 128  // largest task, including its header, whose
+                                 // memory is pooled
+    };
+
+    // CLASS METHODS
+    static int numProcessors();
+        // Return the number of processors available to this process, or 1 if
+        // that number cannot be determined.
+
+    // CREATORS
+    explicit TaskScheduler(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+        // Create a scheduler that runs tasks using the specified 'numThreads'
+        // worker threads.  Optionally specify a 'basicAllocator' used to
+        // supply memory, which must be thread-safe.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  If a worker
+        // thread cannot be started, the scheduler uses the threads that were
+        // started; note that, if none were, spawned tasks are never run.  The
+        // behavior is undefined unless '1 <= numThreads'.
+
+    ~TaskScheduler();
+        // Stop the worker threads of this scheduler, waiting for them to
+        // exit, and destroy this scheduler.  The behavior is undefined unless
+        // every task group using this scheduler has been destroyed.
+
+    // ACCESSORS
+    int numThreads() const;
+        // Return the number of worker threads of this scheduler.
+};
+
+                              // ===============
+                              // class TaskGroup
+                              // ===============
+
+class TaskGroup {
+    // This class provides a mechanism to spawn tasks on a scheduler, and to
+    // wait for all of the tasks so spawned to complete.  A task group may be
+    // used concurrently by several threads, and by its own tasks.
+
+    // DATA
+    TaskScheduler   *d_scheduler_p;  // scheduler running the tasks (held)
+    bsls::AtomicInt  d_state;        // twice the number of tasks not yet
+                                     // complete, plus 1 if a thread that is
+                                     // not a worker may be blocked waiting
+
+    // FRIENDS
+    friend struct TaskScheduler_Imp;
+
+  private:
+    // NOT IMPLEMENTED
+    TaskGroup(const TaskGroup&);
+    TaskGroup& operator=(const TaskGroup&);
+
+  public:
+    // CREATORS
+    explicit TaskGroup(TaskScheduler *scheduler);
+        // Create a task group that spawns tasks on the specified 'scheduler'.
+
+    ~TaskGroup();
+        // Wait for the tasks spawned through this group to complete, and
+        // destroy this group.
+
+    // MANIPULATORS
+    template <class FUNCTOR>
+    void spawn(const FUNCTOR& functor);
+        // Spawn a task that invokes a copy of the specified 'functor' on a
+        // thread of the scheduler of this group.  If copying 'functor'
+        // throws an exception, the exception is propagated and no task is
+        // spawned.
+
+    void wait();
+        // Return when every task spawned through this group has completed,
+        // including tasks spawned while waiting.  If the calling thread is a
+        // worker of the scheduler of this group, run available tasks on it
+        // in the meantime; otherwise, block.
+
+    // ACCESSORS
+    int numPending() const;
+        // Return the number of tasks spawned through this group that have not
+        // yet completed.  Note that the returned value may be out of date by
+        // the time it is examined, unless no thread is spawning tasks.
+
+    TaskScheduler *scheduler() const;
+        // Return the address of the scheduler of this group.
+};
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                              // ---------------
+                              // class TaskGroup
+                              // ---------------
+
+// CREATORS
+inline
+TaskGroup::TaskGroup(TaskScheduler *scheduler)
+: d_scheduler_p(scheduler)
+, d_state(0)
+{
+}
+
+inline
+TaskGroup::~TaskGroup()
+{
+    wait();
+}
+
+// MANIPULATORS
+inline
+void TaskGroup::wait()
+{
+    d_scheduler_p->waitFor(this);
+}
+
+template <class FUNCTOR>
+void TaskGroup::spawn(const FUNCTOR& functor)
+{
+    typedef TaskScheduler_FunctorTask<FUNCTOR> Task;
+
+    void *block = d_scheduler_p->allocateTask(sizeof(Task));
+    Task *task;
+
+    BSLS_TRY {
+        task = ::new (block) Task(functor);
+    }
+    BSLS_CATCH(...) {
+        d_scheduler_p->deallocateTask(block, sizeof(Task));
+        BSLS_RETHROW;
+    }
+
+    task->d_invoker = &Task::invoke;
+    task->d_group_p = this;
+    task->d_next_p  = 0;
+    task->d_isSmall = sizeof(Task) <= TaskScheduler::k_SMALL_TASK_SIZE;
+
+    // Count the task before it is submitted, as it may complete at once.
+
+    d_state.addRelaxed(2);
+    d_scheduler_p->submit(task);
+}
+
+// ACCESSORS
+inline
+int TaskGroup::numPending() const
+{
+    return d_state.loadAcquire() >> 1;
+}
+
+inline
+TaskScheduler *TaskGroup::scheduler() const
+{
+    return d_scheduler_p;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
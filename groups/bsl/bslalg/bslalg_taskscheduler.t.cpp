@@ -0,0 +1,1459 @@
+// bslalg_taskscheduler.t.cpp                                         -*-C++-*-
+
+#include <bslalg_taskscheduler.h>
+
+#include <bslma_countingallocator.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <algorithm>    // native_std::sort, native_std::partition
+#include <deque>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>    // CreateThread(), SwitchToThread()
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>      // sched_yield()
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a work-stealing task scheduler and task
+// groups.  We verify that every task spawned through a group runs exactly
+// once and that 'wait' returns only when all of them (including tasks spawned
+// by tasks) have completed, for schedulers of several sizes and for tasks
+// spawned by workers and by other threads.  We verify that tasks spawned by
+// a worker are stolen by other threads, that blocked workers are woken by
+// newly spawned tasks, and that several threads may spawn and wait
+// concurrently.  We verify that small tasks spawned by workers are allocated
+// from pools, that all memory is released on destruction, and that an
+// exception thrown while copying a function object leaves no task behind.
+// Fork-join algorithms (recursive Fibonacci, and quicksort) are verified
+// against sequential computations.  Performance tests (negative cases)
+// measure the scaling of fork-join algorithms with the number of threads,
+// and the rate at which tasks are spawned and run, compared with a pool of
+// threads sharing a single locked queue.
+//-----------------------------------------------------------------------------
+// TaskScheduler
+// [ 2] static int numProcessors();
+// [ 2] explicit TaskScheduler(int numThreads, Allocator *ba = 0);
+// [ 2] ~TaskScheduler();
+// [ 2] int numThreads() const;
+//
+// TaskGroup
+// [ 2] explicit TaskGroup(TaskScheduler *scheduler);
+// [ 2] ~TaskGroup();
+// [ 2] void spawn(const FUNCTOR& functor);
+// [ 2] void wait();
+// [ 2] int numPending() const;
+// [ 2] TaskScheduler *scheduler() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCURRENCY: STEALING, WAKING, AND CONCURRENT SPAWNING
+// [ 4] FORK-JOIN ALGORITHMS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: FORK-JOIN SCALING
+// [-2] PERFORMANCE: TASK THROUGHPUT
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::TaskScheduler Obj;
+typedef bslalg::TaskGroup     Group;
+typedef bsls::Types::Int64    Int64;
+typedef bsls::Types::Uint64   Uint64;
+
+static const int NUM_THREADS[] = { 1, 2, 3, 8 };
+const int        NUM_SCHEDULERS = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static void yield()
+    // Yield the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+static bool waitWithoutHelping(const Group& group, int seconds)
+    // Wait, without running tasks, until the specified 'group' has no pending
+    // tasks, or the specified number of 'seconds' have passed, and return
+    // 'true' in the former case and 'false' in the latter.
+{
+    const Int64 deadline = bsls::TimeUtil::getTimer()
+                         + seconds * 1000000000LL;
+    while (0 != group.numPending()) {
+        if (bsls::TimeUtil::getTimer() > deadline) {
+            return false;                                             // RETURN
+        }
+        yield();
+    }
+    return true;
+}
+
+static void pauseFor(int milliseconds)
+    // Yield the processor repeatedly for the specified number of
+    // 'milliseconds'.
+{
+    const Int64 deadline = bsls::TimeUtil::getTimer()
+                         + milliseconds * 1000000LL;
+    while (bsls::TimeUtil::getTimer() < deadline) {
+        yield();
+    }
+}
+
+static Uint64 nextRandom(Uint64 *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // a pseudo-random value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state ^ (*state >> 29);
+}
+
+static Int64 serialFib(int n)
+    // Return the Fibonacci number of the specified 'n', computed recursively.
+{
+    return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2);
+}
+
+                              // ===============
+                              // struct NullTask
+                              // ===============
+
+struct NullTask {
+    // This 'struct' provides a task that does nothing.
+
+    void operator()() const
+    {
+    }
+};
+
+                             // ================
+                             // struct CountTask
+                             // ================
+
+struct CountTask {
+    // This 'struct' provides a task that increments a counter.
+
+    bsls::AtomicInt *d_count_p;  // counter to increment
+
+    void operator()() const
+    {
+        d_count_p->add(1);
+    }
+};
+
+                             // ================
+                             // struct IndexTask
+                             // ================
+
+struct IndexTask {
+    // This 'struct' provides a task that increments the counter having its
+    // index.
+
+    bsls::AtomicInt *d_counts_p;  // counters
+    int              d_index;     // counter to increment
+
+    void operator()() const
+    {
+        d_counts_p[d_index].add(1);
+    }
+};
+
+                             // ================
+                             // struct LargeTask
+                             // ================
+
+struct LargeTask {
+    // This 'struct' provides a task too large for the pool of small tasks,
+    // that checks that its payload was copied, and increments a counter.
+
+    bsls::AtomicInt *d_count_p;                          // counter
+    bsls::AtomicInt *d_errors_p;                         // payload errors
+    char             d_payload[Obj::k_SMALL_TASK_SIZE];  // copied payload
+
+    void operator()() const
+    {
+        for (int i = 0; i < Obj::k_SMALL_TASK_SIZE; ++i) {
+            if (static_cast<char>(i) != d_payload[i]) {
+                d_errors_p->add(1);
+            }
+        }
+        d_count_p->add(1);
+    }
+};
+
+                             // ================
+                             // struct SpawnTask
+                             // ================
+
+template <class TASK>
+struct SpawnTask {
+    // This 'struct' template provides a task that spawns a number of copies
+    // of a task through a group, and waits for them.
+
+    Obj  *d_scheduler_p;  // scheduler
+    TASK  d_task;         // task to copy
+    int   d_numTasks;     // number of copies
+
+    void operator()() const
+    {
+        Group group(d_scheduler_p);
+        for (int i = 0; i < d_numTasks; ++i) {
+            group.spawn(d_task);
+        }
+        group.wait();
+        ASSERT(0 == group.numPending());
+    }
+};
+
+                              // ===============
+                              // struct TreeTask
+                              // ===============
+
+struct TreeTask {
+    // This 'struct' provides a task that increments a counter and, unless it
+    // is a leaf, spawns two children through the same group, so that the
+    // tasks form a complete binary tree.
+
+    Group           *d_group_p;  // group of every task of the tree
+    int              d_depth;    // height of the subtree of this task
+    bsls::AtomicInt *d_count_p;  // number of tasks run
+
+    void operator()() const
+    {
+        d_count_p->add(1);
+        if (0 < d_depth) {
+            TreeTask child = { d_group_p, d_depth - 1, d_count_p };
+            d_group_p->spawn(child);
+            d_group_p->spawn(child);
+        }
+    }
+};
+
+                           // ====================
+                           // struct RendezvousTask
+                           // ====================
+
+struct RendezvousTask {
+    // This 'struct' provides a task that waits (for at most 10 seconds) until
+    // another copy has started, and so can complete promptly only if both
+    // copies run concurrently.
+
+    bsls::AtomicInt *d_started_p;   // number of copies started
+    bsls::AtomicInt *d_timedOut_p;  // set if a copy waited too long
+
+    void operator()() const
+    {
+        d_started_p->add(1);
+
+        const Int64 deadline = bsls::TimeUtil::getTimer() + 10000000000LL;
+        while (2 > d_started_p->load()) {
+            if (bsls::TimeUtil::getTimer() > deadline) {
+                d_timedOut_p->storeRelaxed(1);
+                return;                                               // RETURN
+            }
+            yield();
+        }
+    }
+};
+
+                             // ================
+                             // struct ThrowTask
+                             // ================
+
+template <int SIZE>
+struct ThrowTask {
+    // This 'struct' template provides a task, of at least 'SIZE' bytes, whose
+    // copy constructor throws if the original is so configured.
+
+    bool d_throw;          // copying throws if 'true'
+    char d_payload[SIZE];  // padding
+
+    explicit ThrowTask(bool throwOnCopy)
+    : d_throw(throwOnCopy)
+    {
+    }
+
+    ThrowTask(const ThrowTask& original)
+    : d_throw(original.d_throw)
+    {
+#ifdef BDE_BUILD_TARGET_EXC
+        if (d_throw) {
+            throw 1;
+        }
+#endif
+    }
+
+    void operator()() const
+    {
+    }
+};
+
+                              // ==============
+                              // struct FibTask
+                              // ==============
+
+struct FibTask {
+    // This 'struct' provides a task that computes a Fibonacci number by
+    // fork-join, computing numbers below a cutoff sequentially.
+
+    int    d_n;            // number to compute
+    int    d_cutoff;       // largest number computed sequentially
+    Int64 *d_result_p;     // result
+    Obj   *d_scheduler_p;  // scheduler
+
+    void operator()() const
+    {
+        if (d_n <= d_cutoff) {
+            *d_result_p = serialFib(d_n);
+            return;                                                   // RETURN
+        }
+
+        Int64 first;
+        Int64 second;
+        Group group(d_scheduler_p);
+
+        FibTask firstTask = { d_n - 1, d_cutoff, &first, d_scheduler_p };
+        group.spawn(firstTask);
+
+        FibTask secondTask = { d_n - 2, d_cutoff, &second, d_scheduler_p };
+        secondTask();
+
+        group.wait();
+        *d_result_p = first + second;
+    }
+};
+
+                           // ====================
+                           // struct QuickSortTask
+                           // ====================
+
+struct IsLess {
+    // This 'struct' provides a predicate that is 'true' for values less than
+    // 'd_pivot'.
+
+    int d_pivot;
+
+    bool operator()(int value) const
+    {
+        return value < d_pivot;
+    }
+};
+
+struct IsNotGreater {
+    // This 'struct' provides a predicate that is 'true' for values not
+    // greater than 'd_pivot'.
+
+    int d_pivot;
+
+    bool operator()(int value) const
+    {
+        return !(d_pivot < value);
+    }
+};
+
+struct QuickSortTask {
+    // This 'struct' provides a task that sorts a range of integers by
+    // quicksort, spawning a task to sort the lower part of each partition,
+    // and sorting ranges no longer than a cutoff sequentially.
+
+    int *d_begin_p;       // first element
+    int *d_end_p;         // one past the last element
+    int  d_cutoff;        // longest range sorted sequentially
+    Obj *d_scheduler_p;   // scheduler
+
+    void operator()() const
+    {
+        Group group(d_scheduler_p);
+
+        int *begin = d_begin_p;
+        int *end   = d_end_p;
+        while (end - begin > d_cutoff) {
+            // Partition around the median of three elements into elements
+            // less than, equal to, and greater than the pivot.
+
+            int a = *begin;
+            int b = begin[(end - begin) / 2];
+            int c = end[-1];
+            if (b < a) { native_std::swap(a, b); }
+            if (c < b) { native_std::swap(b, c); }
+            if (b < a) { native_std::swap(a, b); }
+
+            IsLess       isLess       = { b };
+            IsNotGreater isNotGreater = { b };
+
+            int *middle = native_std::partition(begin, end, isLess);
+            int *upper  = native_std::partition(middle, end, isNotGreater);
+
+            QuickSortTask lower = { begin, middle, d_cutoff, d_scheduler_p };
+            group.spawn(lower);
+
+            begin = upper;
+        }
+        native_std::sort(begin, end);
+    }
+};
+
+                           // ====================
+                           // struct ExternalArgs
+                           // ====================
+
+struct ExternalArgs {
+    // This 'struct' describes the work of a thread that is not a worker:
+    // spawn 'd_numTasks' tasks each incrementing '*d_count_p' through a group
+    // of its own, and wait for them.
+
+    Obj             *d_scheduler_p;  // scheduler
+    int              d_numTasks;     // number of tasks to spawn
+    bsls::AtomicInt *d_count_p;      // counter
+};
+
+extern "C" void *externalThread(void *arg)
+{
+    ExternalArgs *args = static_cast<ExternalArgs *>(arg);
+
+    Group     group(args->d_scheduler_p);
+    CountTask task = { args->d_count_p };
+    for (int i = 0; i < args->d_numTasks; ++i) {
+        group.spawn(task);
+    }
+    group.wait();
+    ASSERT(0 == group.numPending());
+    return 0;
+}
+
+                          // =====================
+                          // class LockedQueuePool
+                          // =====================
+
+class LockedQueuePool {
+    // This class provides a pool of threads that run jobs taken from a single
+    // queue protected by a lock, as a baseline for the throughput of
+    // 'TaskScheduler'.
+
+  public:
+    // TYPES
+    typedef void (*Job)(void *context);
+
+  private:
+    // PRIVATE TYPES
+    struct Entry {
+        Job   d_job;
+        void *d_context_p;
+    };
+
+    // DATA
+    bsls::SpinLock             d_lock;          // protects 'd_queue'
+    native_std::deque<Entry>   d_queue;         // pending jobs
+    bsls::AtomicInt            d_numPending;    // jobs not yet complete
+    bsls::AtomicInt            d_stop;          // set to stop the workers
+    native_std::vector<my_thread_t>
+                               d_threads;       // worker threads
+
+    // NOT IMPLEMENTED
+    LockedQueuePool(const LockedQueuePool&);
+    LockedQueuePool& operator=(const LockedQueuePool&);
+
+  public:
+    // CLASS METHODS
+    static void *workerLoop(void *arg)
+    {
+        LockedQueuePool *pool = static_cast<LockedQueuePool *>(arg);
+        while (!pool->d_stop.loadAcquire()) {
+            if (!pool->tryRun()) {
+                yield();
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    explicit LockedQueuePool(int numThreads);
+
+    ~LockedQueuePool()
+    {
+        d_stop.storeRelease(1);
+        for (native_std::size_t i = 0; i < d_threads.size(); ++i) {
+            myJoinThread(d_threads[i]);
+        }
+    }
+
+    // MANIPULATORS
+    void push(Job job, void *context)
+    {
+        Entry entry = { job, context };
+        d_numPending.add(1);
+        bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+        d_queue.push_back(entry);
+    }
+
+    bool tryRun()
+    {
+        Entry entry;
+        {
+            bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+            if (d_queue.empty()) {
+                return false;                                         // RETURN
+            }
+            entry = d_queue.front();
+            d_queue.pop_front();
+        }
+        entry.d_job(entry.d_context_p);
+        d_numPending.add(-1);
+        return true;
+    }
+
+    void wait()
+    {
+        while (0 != d_numPending.loadAcquire()) {
+            if (!tryRun()) {
+                yield();
+            }
+        }
+    }
+};
+
+extern "C" void *lockedQueueWorker(void *arg)
+{
+    return LockedQueuePool::workerLoop(arg);
+}
+
+LockedQueuePool::LockedQueuePool(int numThreads)
+: d_numPending(0)
+, d_stop(0)
+{
+    d_lock.initialize();
+    for (int i = 0; i < numThreads; ++i) {
+        my_thread_t handle;
+        if (0 == myCreateThread(&handle, &lockedQueueWorker, this)) {
+            d_threads.push_back(handle);
+        }
+    }
+}
+
+static void nullJob(void *)
+{
+}
+
+static double elapsedNs(const bsls::Stopwatch& timer, int count)
+    // Return the time elapsed on the specified 'timer', in nanoseconds per
+    // one of the specified 'count' items.
+{
+    return timer.elapsedTime() * 1e9 / count;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Computing Fibonacci Numbers by Fork-Join
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we wish to compute a Fibonacci number by the (deliberately
+// inefficient) recursive definition, using several threads.  Although this is
+// not a sensible way to compute Fibonacci numbers, it is the classic
+// illustration of fork-join parallelism, in which the work is recursively
+// divided into very many small tasks.
+//
+// First, we define a sequential function for the small cases:
+//..
+long serialFibonacci(int n)
+{
+    return n < 2 ? n : serialFibonacci(n - 1) + serialFibonacci(n - 2);
+}
+//..
+// Then, we define a function object that computes a Fibonacci number by
+// spawning a task to compute one of the preceding numbers, computing the
+// other itself, and waiting for the spawned task:
+//..
+struct Fibonacci {
+    int                    d_n;
+    long                  *d_result_p;
+    bslalg::TaskScheduler *d_scheduler_p;
+
+    void operator()() const
+    {
+        if (d_n < 20) {
+            *d_result_p = serialFibonacci(d_n);
+            return;                                                   // RETURN
+        }
+
+        long              first;
+        long              second;
+        bslalg::TaskGroup group(d_scheduler_p);
+
+        Fibonacci firstTask = { d_n - 1, &first, d_scheduler_p };
+        group.spawn(firstTask);
+
+        Fibonacci secondTask = { d_n - 2, &second, d_scheduler_p };
+        secondTask();
+
+        group.wait();
+        *d_result_p = first + second;
+    }
+};
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, we create a scheduler having four worker threads:
+//..
+        bslalg::TaskScheduler scheduler(4);
+//..
+// Finally, we compute a Fibonacci number by spawning a single task, and
+// waiting for it:
+//..
+        long result = 0;
+        {
+            bslalg::TaskGroup group(&scheduler);
+
+            Fibonacci task = { 30, &result, &scheduler };
+            group.spawn(task);
+            group.wait();
+        }
+        ASSERT(832040 == result);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORK-JOIN ALGORITHMS
+        //
+        // Concerns:
+        //: 1 Recursively nested groups, waited on by workers, compute the
+        //:   same results as sequential algorithms, for any number of
+        //:   threads.
+        //:
+        //: 2 Tasks spawned through a group by the tasks of that group are
+        //:   waited for by 'wait'.
+        //
+        // Plan:
+        //: 1 Compute Fibonacci numbers, with several cutoffs, using schedulers
+        //:   of several sizes, and compare with a sequential computation.
+        //:   (C-1)
+        //:
+        //: 2 Sort random arrays, having many duplicates or none, by parallel
+        //:   quicksort, and compare with 'native_std::sort'.  (C-1)
+        //:
+        //: 3 Spawn a complete binary tree of tasks, each spawning its children
+        //:   through the group of the root, and verify, after 'wait', that
+        //:   every task has run.  (C-2)
+        //
+        // Testing:
+        //   FORK-JOIN ALGORITHMS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFORK-JOIN ALGORITHMS"
+                            "\n====================\n");
+
+        bslma::CountingAllocator ca("scheduler");
+
+        for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+            Obj mX(NUM_THREADS[si], &ca);
+
+            if (veryVerbose) { T_ P(NUM_THREADS[si]) }
+
+            static const int CUTOFFS[] = { 1, 5, 15 };
+            for (int ci = 0; ci < 3; ++ci) {
+                for (int n = 0; n <= 25; n += 5) {
+                    Int64 result = -1;
+                    {
+                        Group   group(&mX);
+                        FibTask task = { n, CUTOFFS[ci], &result, &mX };
+                        group.spawn(task);
+                    }
+                    LOOP3_ASSERT(si, ci, n, serialFib(n) == result);
+                }
+            }
+
+            static const int LENGTHS[] = { 0, 1, 100, 5000, 100000 };
+            static const int RANGES[]  = { 10, 1000000000 };
+            for (int li = 0; li < 5; ++li) {
+                for (int ri = 0; ri < 2; ++ri) {
+                    const int LENGTH = LENGTHS[li];
+
+                    native_std::vector<int> data(LENGTH + 1);
+                    Uint64 state = li * 2 + ri;
+                    for (int i = 0; i < LENGTH; ++i) {
+                        data[i] = static_cast<int>(nextRandom(&state)
+                                                   % RANGES[ri]);
+                    }
+                    native_std::vector<int> expected(data.begin(),
+                                                     data.begin() + LENGTH);
+                    native_std::sort(expected.begin(), expected.end());
+
+                    {
+                        Group         group(&mX);
+                        QuickSortTask task = { &data[0],
+                                               &data[0] + LENGTH,
+                                               64,
+                                               &mX };
+                        group.spawn(task);
+                    }
+                    for (int i = 0; i < LENGTH; ++i) {
+                        LOOP3_ASSERT(si, li, i, expected[i] == data[i]);
+                    }
+                }
+            }
+
+            for (int depth = 0; depth <= 14; depth += 7) {
+                bsls::AtomicInt count(0);
+                Group           group(&mX);
+                TreeTask        task = { &group, depth, &count };
+                group.spawn(task);
+                group.wait();
+
+                LOOP2_ASSERT(si, depth,
+                             (2 << depth) - 1 == count.load());
+                LOOP2_ASSERT(si, depth, 0 == group.numPending());
+            }
+        }
+        ASSERT(0 == ca.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: STEALING, WAKING, AND CONCURRENT SPAWNING
+        //
+        // Concerns:
+        //: 1 A task spawned by a worker is stolen by another worker while the
+        //:   first is busy.
+        //:
+        //: 2 A task spawned while every worker is blocked is run without any
+        //:   thread waiting for it.
+        //:
+        //: 3 Several threads that are not workers may spawn tasks, and wait
+        //:   for them, concurrently.
+        //:
+        //: 4 A group may be used concurrently by several workers.
+        //
+        // Plan:
+        //: 1 From a worker of a scheduler having two threads, spawn two tasks
+        //:   that each wait for the other to start, and, without calling
+        //:   'wait', check that both complete.  (C-1)
+        //:
+        //: 2 After the workers have been idle long enough to block, spawn a
+        //:   task and check, without calling 'wait', that it completes.  Do
+        //:   so repeatedly.  (C-2)
+        //:
+        //: 3 Start several threads, each spawning many tasks through its own
+        //:   group and waiting for them, and check that every task ran.
+        //:   (C-3)
+        //:
+        //: 4 Spawn, from several threads, trees of tasks that spawn tasks
+        //:   through a group shared by the threads.  (C-4)
+        //
+        // Testing:
+        //   CONCURRENCY: STEALING, WAKING, AND CONCURRENT SPAWNING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: STEALING, WAKING, AND CONCURRENT"
+                            " SPAWNING"
+                            "\n============================================="
+                            "=========\n");
+
+        bslma::CountingAllocator ca("scheduler");
+
+        if (veryVerbose) printf("Stealing.\n");
+        {
+            Obj mX(2, &ca);
+
+            for (int i = 0; i < 5; ++i) {
+                bsls::AtomicInt started(0);
+                bsls::AtomicInt timedOut(0);
+
+                RendezvousTask rendezvous = { &started, &timedOut };
+
+                SpawnTask<RendezvousTask> task = { &mX, rendezvous, 2 };
+
+                Group group(&mX);
+                group.spawn(task);
+
+                ASSERT(waitWithoutHelping(group, 20));
+                LOOP_ASSERT(i, 2 == started.load());
+                LOOP_ASSERT(i, 0 == timedOut.load());
+            }
+        }
+
+        if (veryVerbose) printf("Waking.\n");
+        for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+            Obj mX(NUM_THREADS[si], &ca);
+
+            for (int i = 0; i < 5; ++i) {
+                pauseFor(20);
+
+                bsls::AtomicInt count(0);
+                CountTask       task = { &count };
+
+                Group group(&mX);
+                group.spawn(task);
+
+                LOOP2_ASSERT(si, i, waitWithoutHelping(group, 20));
+                LOOP2_ASSERT(si, i, 1 == count.load());
+            }
+        }
+
+        if (veryVerbose) printf("Concurrent spawning.\n");
+        for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+            enum { k_NUM_EXTERNAL = 4, k_NUM_TASKS = 20000 };
+
+            Obj mX(NUM_THREADS[si], &ca);
+
+            bsls::AtomicInt count(0);
+            ExternalArgs    args = { &mX, k_NUM_TASKS, &count };
+
+            my_thread_t threads[k_NUM_EXTERNAL];
+            for (int i = 0; i < k_NUM_EXTERNAL; ++i) {
+                ASSERT(0 == myCreateThread(&threads[i],
+                                           &externalThread,
+                                           &args));
+            }
+            for (int i = 0; i < k_NUM_EXTERNAL; ++i) {
+                myJoinThread(threads[i]);
+            }
+            LOOP_ASSERT(si, k_NUM_EXTERNAL * k_NUM_TASKS == count.load());
+        }
+
+        if (veryVerbose) printf("Shared group.\n");
+        for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+            enum { k_NUM_TREES = 8, k_DEPTH = 10 };
+
+            Obj mX(NUM_THREADS[si], &ca);
+
+            bsls::AtomicInt count(0);
+            {
+                Group    group(&mX);
+                TreeTask tree = { &group, k_DEPTH, &count };
+
+                SpawnTask<TreeTask> task = { &mX, tree, k_NUM_TREES };
+                for (int i = 0; i < k_NUM_TREES; ++i) {
+                    group.spawn(task);
+                }
+            }
+            LOOP_ASSERT(si, k_NUM_TREES * k_NUM_TREES * ((2 << k_DEPTH) - 1)
+                                                             == count.load());
+        }
+        ASSERT(0 == ca.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'TaskScheduler' AND 'TaskGroup'
+        //
+        // Concerns:
+        //: 1 'numProcessors' returns a positive value.
+        //:
+        //: 2 A scheduler reports the number of threads with which it was
+        //:   created, and uses its allocator, releasing all memory on
+        //:   destruction.
+        //:
+        //: 3 Every task spawned through a group runs exactly once, whether
+        //:   spawned by a worker or by another thread, and 'wait' (and the
+        //:   destructor of the group) returns only when all have completed.
+        //:
+        //: 4 'numPending' reports the number of tasks not yet complete, and
+        //:   'scheduler' the scheduler of the group.
+        //:
+        //: 5 Small tasks spawned repeatedly reuse pooled memory, while tasks
+        //:   larger than 'k_SMALL_TASK_SIZE' are copied intact into memory
+        //:   obtained from the allocator.
+        //:
+        //: 6 If copying the function object throws, the exception is
+        //:   propagated, no task is pending, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Spawn varying numbers of tasks, each counting its invocations,
+        //:   from the main thread and from a worker, on schedulers of several
+        //:   sizes, and check the counts after 'wait' or the destruction of
+        //:   the group.  (C-1..4)
+        //:
+        //: 2 Spawn many small and large tasks from a worker, and compare the
+        //:   number of allocations with the number of tasks.  (C-5)
+        //:
+        //: 3 Spawn small and large tasks whose copy constructors throw.  (C-6)
+        //
+        // Testing:
+        //   static int numProcessors();
+        //   explicit TaskScheduler(int numThreads, Allocator *ba = 0);
+        //   ~TaskScheduler();
+        //   int numThreads() const;
+        //   explicit TaskGroup(TaskScheduler *scheduler);
+        //   ~TaskGroup();
+        //   void spawn(const FUNCTOR& functor);
+        //   void wait();
+        //   int numPending() const;
+        //   TaskScheduler *scheduler() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'TaskScheduler' AND 'TaskGroup'"
+                            "\n=======================================\n");
+
+        ASSERT(0 < Obj::numProcessors());
+
+        if (veryVerbose) printf("Counting tasks.\n");
+        {
+            static const int NUM_TASKS[] = { 0, 1, 2, 3, 17, 1000 };
+            const int        NUM_CASES   = sizeof NUM_TASKS
+                                         / sizeof *NUM_TASKS;
+
+            for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+                bslma::CountingAllocator ca("scheduler");
+                {
+                    Obj mX(NUM_THREADS[si], &ca);  const Obj& X = mX;
+
+                    LOOP_ASSERT(si, NUM_THREADS[si] == X.numThreads());
+                    LOOP_ASSERT(si, 0 < ca.numBlocksInUse());
+
+                    for (int ni = 0; ni < NUM_CASES; ++ni) {
+                        const int N = NUM_TASKS[ni];
+
+                        if (veryVerbose) { T_ P_(X.numThreads()) P(N) }
+
+                        bsls::AtomicInt counts[1001];
+
+                        Group mG(&mX);  const Group& G = mG;
+                        LOOP2_ASSERT(si, N, &mX == G.scheduler());
+                        LOOP2_ASSERT(si, N, 0 == G.numPending());
+
+                        for (int i = 0; i < N; ++i) {
+                            IndexTask task = { counts, i };
+                            mG.spawn(task);
+                            LOOP2_ASSERT(si, N, i + 1 >= G.numPending());
+                        }
+                        mG.wait();
+                        LOOP2_ASSERT(si, N, 0 == G.numPending());
+
+                        for (int i = 0; i < N; ++i) {
+                            LOOP3_ASSERT(si, N, i, 1 == counts[i].load());
+                        }
+                        LOOP2_ASSERT(si, N, 0 == counts[N].load());
+
+                        // Spawn from a worker, and let the destructor of the
+                        // group wait.
+
+                        bsls::AtomicInt count(0);
+                        {
+                            Group               group(&mX);
+                            CountTask           counter = { &count };
+                            SpawnTask<CountTask> task   = { &mX, counter, N };
+                            group.spawn(task);
+                        }
+                        LOOP2_ASSERT(si, N, N == count.load());
+                    }
+                }
+                LOOP_ASSERT(si, 0 == ca.numBlocksInUse());
+            }
+        }
+
+        if (veryVerbose) printf("Task memory.\n");
+        for (int si = 0; si < NUM_SCHEDULERS; ++si) {
+            enum { k_NUM_TASKS = 10000 };
+
+            bslma::CountingAllocator ca("scheduler");
+            {
+                Obj mX(NUM_THREADS[si], &ca);
+
+                bsls::AtomicInt count(0);
+                bsls::AtomicInt errors(0);
+
+                // Small tasks, spawned by a worker, are pooled.
+
+                CountTask            counter = { &count };
+                SpawnTask<CountTask> small   = { &mX, counter, k_NUM_TASKS };
+
+                Int64 numAllocations = ca.numAllocations();
+                {
+                    Group group(&mX);
+                    group.spawn(small);
+                }
+                LOOP_ASSERT(si, k_NUM_TASKS == count.load());
+                LOOP2_ASSERT(si, ca.numAllocations() - numAllocations,
+                             ca.numAllocations() - numAllocations
+                                                          < k_NUM_TASKS / 10);
+
+                // Small tasks, spawned by another thread, are pooled.
+
+                count.storeRelaxed(0);
+                numAllocations = ca.numAllocations();
+                {
+                    Group group(&mX);
+                    for (int i = 0; i < k_NUM_TASKS; ++i) {
+                        group.spawn(counter);
+                    }
+                }
+                LOOP_ASSERT(si, k_NUM_TASKS == count.load());
+                LOOP2_ASSERT(si, ca.numAllocations() - numAllocations,
+                             ca.numAllocations() - numAllocations
+                                                          < k_NUM_TASKS / 10);
+
+                // Large tasks are allocated individually, and copied intact.
+
+                LargeTask large = { &count, &errors, { 0 } };
+                for (int i = 0; i < Obj::k_SMALL_TASK_SIZE; ++i) {
+                    large.d_payload[i] = static_cast<char>(i);
+                }
+                SpawnTask<LargeTask> spawnLarge = { &mX, large, k_NUM_TASKS };
+
+                count.storeRelaxed(0);
+                numAllocations = ca.numAllocations();
+                {
+                    Group group(&mX);
+                    group.spawn(spawnLarge);
+                }
+                LOOP_ASSERT(si, k_NUM_TASKS == count.load());
+                LOOP_ASSERT(si, 0 == errors.load());
+                LOOP_ASSERT(si, ca.numAllocations() - numAllocations
+                                                             >= k_NUM_TASKS);
+            }
+            LOOP_ASSERT(si, 0 == ca.numBlocksInUse());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (veryVerbose) printf("Exception safety.\n");
+        {
+            bslma::CountingAllocator ca("scheduler");
+            {
+                Obj   mX(2, &ca);
+                Group group(&mX);
+
+                const Int64 numBlocks = ca.numBlocksInUse();
+
+                ThrowTask<8> smallTask(true);
+                try {
+                    group.spawn(smallTask);
+                    ASSERT(!"exception not thrown");
+                }
+                catch (int) {
+                }
+                ASSERT(0 == group.numPending());
+
+                ThrowTask<Obj::k_SMALL_TASK_SIZE> largeTask(true);
+                try {
+                    group.spawn(largeTask);
+                    ASSERT(!"exception not thrown");
+                }
+                catch (int) {
+                }
+                ASSERT(0 == group.numPending());
+                ASSERT(numBlocks <= ca.numBlocksInUse());
+                ASSERT(numBlocks + 1 >= ca.numBlocksInUse());
+
+                group.spawn(ThrowTask<8>(false));
+                group.spawn(ThrowTask<Obj::k_SMALL_TASK_SIZE>(false));
+                group.wait();
+            }
+            ASSERT(0 == ca.numBlocksInUse());
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Spawn tasks through a group, from the main thread and from a
+        //:   task, and wait for them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("scheduler", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);
+
+            ASSERT(1 == mX.numThreads());
+
+            bsls::AtomicInt count(0);
+            CountTask       task = { &count };
+
+            Group group(&mX);
+            for (int i = 0; i < 100; ++i) {
+                group.spawn(task);
+            }
+            group.wait();
+            ASSERT(100 == count.load());
+            ASSERT(0   == group.numPending());
+
+            Int64 result = 0;
+            FibTask fib = { 20, 10, &result, &mX };
+            group.spawn(fib);
+            group.wait();
+            ASSERT(6765 == result);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FORK-JOIN SCALING
+        //
+        // Concerns:
+        //: 1 The time taken by fork-join algorithms decreases as the number of
+        //:   threads increases, up to the number of processors, even when
+        //:   the tasks are very small.
+        //
+        // Plan:
+        //: 1 Time the computation of a Fibonacci number by fork-join with a
+        //:   small and a large cutoff, and the sorting of a large array by
+        //:   parallel quicksort, using schedulers of 1, 2, 4, ... threads, up
+        //:   to twice the number of processors (and at least 8), and report
+        //:   the time, the speedup relative to one thread, and the time of
+        //:   the sequential algorithm.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FORK-JOIN SCALING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: FORK-JOIN SCALING"
+                            "\n==============================\n");
+
+        const int FIB            = argc > 2 ? atoi(argv[2]) : 32;
+        const int LENGTH         = 4 * 1024 * 1024;
+        const int NUM_PROCESSORS = Obj::numProcessors();
+        const int MAX_THREADS    = 2 * NUM_PROCESSORS < 8
+                                   ? 8
+                                   : 2 * NUM_PROCESSORS;
+
+        native_std::vector<int> input(LENGTH);
+        native_std::vector<int> data(LENGTH);
+
+        Uint64 state = 23;
+        for (int i = 0; i < LENGTH; ++i) {
+            input[i] = static_cast<int>(nextRandom(&state));
+        }
+
+        bsls::Stopwatch timer;
+        timer.start();
+        const Int64 expected = serialFib(FIB);
+        timer.stop();
+        const double serialFibTime = timer.elapsedTime() * 1e3;
+
+        data = input;
+        timer.reset();
+        timer.start();
+        native_std::sort(data.begin(), data.end());
+        timer.stop();
+        const double serialSortTime = timer.elapsedTime() * 1e3;
+
+        printf("%d processors, fib(%d), sort of %d elements (ms, speedup)\n",
+               NUM_PROCESSORS, FIB, LENGTH);
+        printf("%8s %18s %18s %18s\n",
+               "threads", "fib cutoff 2", "fib cutoff 20", "quicksort");
+        printf("%8s %8.2f %9s %8.2f %9s %8.2f\n",
+               "serial", serialFibTime, "", serialFibTime, "", serialSortTime);
+
+        double baseline[3] = { 0, 0, 0 };
+        for (int numThreads = 1;
+             numThreads <= MAX_THREADS;
+             numThreads *= 2) {
+            Obj scheduler(numThreads);
+
+            static const int CUTOFFS[] = { 2, 20 };
+
+            double times[3];
+            for (int k = 0; k < 2; ++k) {
+                Int64 result = 0;
+                timer.reset();
+                timer.start();
+                {
+                    Group   group(&scheduler);
+                    FibTask task = { FIB, CUTOFFS[k], &result, &scheduler };
+                    group.spawn(task);
+                }
+                timer.stop();
+                times[k] = timer.elapsedTime() * 1e3;
+                ASSERT(expected == result);
+            }
+
+            data = input;
+            timer.reset();
+            timer.start();
+            {
+                Group         group(&scheduler);
+                QuickSortTask task = { &data[0],
+                                       &data[0] + LENGTH,
+                                       4096,
+                                       &scheduler };
+                group.spawn(task);
+            }
+            timer.stop();
+            times[2] = timer.elapsedTime() * 1e3;
+
+            for (int i = 1; i < LENGTH; ++i) {
+                LOOP_ASSERT(i, data[i - 1] <= data[i]);
+            }
+
+            if (1 == numThreads) {
+                for (int k = 0; k < 3; ++k) {
+                    baseline[k] = times[k];
+                }
+            }
+            printf("%8d", numThreads);
+            for (int k = 0; k < 3; ++k) {
+                printf(" %8.2f (%5.2fx)", times[k], baseline[k] / times[k]);
+            }
+            printf("\n");
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TASK THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Spawning and running a small task takes a small, roughly
+        //:   constant, time, whether the task is spawned by a worker or by
+        //:   another thread, and does not grow with the number of threads
+        //:   as it does for a pool of threads sharing a single locked queue.
+        //
+        // Plan:
+        //: 1 Using schedulers of 1, 2, 4, ... threads, up to twice the number
+        //:   of processors (and at least 8), time the spawning and running of
+        //:   many empty tasks from the main thread, from a single worker, and
+        //:   from every worker, and time the same number of empty jobs pushed
+        //:   from the main thread onto a pool of the same number of threads
+        //:   sharing a single queue protected by a spin lock.  Report the
+        //:   time per task.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: TASK THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: TASK THROUGHPUT"
+                            "\n============================\n");
+
+        const int NUM_TASKS      = argc > 2 ? atoi(argv[2]) : 1000000;
+        const int NUM_PROCESSORS = Obj::numProcessors();
+        const int MAX_THREADS    = 2 * NUM_PROCESSORS < 8
+                                   ? 8
+                                   : 2 * NUM_PROCESSORS;
+
+        printf("%d processors, %d tasks (ns per task)\n",
+               NUM_PROCESSORS, NUM_TASKS);
+        printf("%8s %12s %12s %12s %12s\n",
+               "threads", "external", "one worker", "all workers",
+               "locked queue");
+
+        for (int numThreads = 1;
+             numThreads <= MAX_THREADS;
+             numThreads *= 2) {
+            double times[4];
+
+            {
+                Obj scheduler(numThreads);
+
+                bsls::Stopwatch timer;
+                timer.start();
+                {
+                    Group    group(&scheduler);
+                    NullTask task;
+                    for (int i = 0; i < NUM_TASKS; ++i) {
+                        group.spawn(task);
+                    }
+                }
+                timer.stop();
+                times[0] = elapsedNs(timer, NUM_TASKS);
+
+                SpawnTask<NullTask> spawner = { &scheduler,
+                                                NullTask(),
+                                                NUM_TASKS };
+                timer.reset();
+                timer.start();
+                {
+                    Group group(&scheduler);
+                    group.spawn(spawner);
+                }
+                timer.stop();
+                times[1] = elapsedNs(timer, NUM_TASKS);
+
+                spawner.d_numTasks = NUM_TASKS / numThreads;
+                timer.reset();
+                timer.start();
+                {
+                    Group group(&scheduler);
+                    for (int i = 0; i < numThreads; ++i) {
+                        group.spawn(spawner);
+                    }
+                }
+                timer.stop();
+                times[2] = elapsedNs(timer,
+                                     spawner.d_numTasks * numThreads);
+            }
+
+            {
+                LockedQueuePool pool(numThreads);
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < NUM_TASKS; ++i) {
+                    pool.push(&nullJob, 0);
+                }
+                pool.wait();
+                timer.stop();
+                times[3] = elapsedNs(timer, NUM_TASKS);
+            }
+
+            printf("%8d %12.1f %12.1f %12.1f %12.1f\n",
+                   numThreads, times[0], times[1], times[2], times[3]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,115 @@
+// bslalg_threadimputil.cpp                                           -*-C++-*-
+#include <bslalg_threadimputil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #include <sched.h>        // sched_yield()
+    #include <unistd.h>       // sysconf(), _SC_NPROCESSORS_ONLN
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+extern "C" void *threadImpUtilEntryPoint(void *arg)
+{
+    static_cast<ThreadImpUtil::Runnable *>(arg)->run();
+    return 0;
+}
+#else
+extern "C" DWORD WINAPI threadImpUtilEntryPoint(LPVOID arg)
+{
+    static_cast<ThreadImpUtil::Runnable *>(arg)->run();
+    return 0;
+}
+#endif
+
+}  // close unnamed namespace
+
+                      // -----------------------------
+                      // class ThreadImpUtil::Runnable
+                      // -----------------------------
+
+// CREATORS
+ThreadImpUtil::Runnable::~Runnable()
+{
+}
+
+                           // --------------------
+                           // struct ThreadImpUtil
+                           // --------------------
+
+// CLASS METHODS
+int ThreadImpUtil::create(Handle *handle, Runnable *runnable)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    return pthread_create(handle, 0, &threadImpUtilEntryPoint, runnable);
+#else
+    *handle = CreateThread(0, 0, &threadImpUtilEntryPoint, runnable, 0, 0);
+    return *handle ? 0 : 1;
+#endif
+}
+
+void ThreadImpUtil::join(Handle handle)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_join(handle, 0);
+#else
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#endif
+}
+
+int ThreadImpUtil::numProcessors()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    const long result = sysconf(_SC_NPROCESSORS_ONLN);
+    return 0 < result ? static_cast<int>(result) : 1;
+#else
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return 0 < info.dwNumberOfProcessors
+           ? static_cast<int>(info.dwNumberOfProcessors)
+           : 1;
+#endif
+}
+
+void ThreadImpUtil::yield()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sched_yield();
+#else
+    SwitchToThread();
+#endif
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
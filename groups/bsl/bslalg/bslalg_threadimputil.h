@@ -0,0 +1,388 @@
+// bslalg_threadimputil.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLALG_THREADIMPUTIL
+#define INCLUDED_BSLALG_THREADIMPUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide minimal portable threads, mutexes, and conditions.
+//
+//@CLASSES:
+//  bslalg::ThreadImpUtil: namespace for thread primitives used by 'bslalg'
+//
+//@SEE_ALSO: bslalg_parallelutil, bslalg_taskscheduler
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bslalg::ThreadImpUtil', holding the small set of threading primitives
+// needed to implement the thread pools of 'bslalg_parallelutil' and
+// 'bslalg_taskscheduler': a non-recursive mutex ('ThreadImpUtil::Mutex'), a
+// condition variable ('ThreadImpUtil::Condition'), and functions to start and
+// join a thread, to yield the processor, and to return the number of
+// processors.  The primitives are implemented directly on POSIX threads or on
+// the Windows API, and report no errors other than a failure to start a
+// thread.
+//
+// This component is for use only in the implementation of other components
+// of the 'bslalg' package.  As its header includes '<pthread.h>' or
+// '<windows.h>', it must be included only by implementation ('.cpp') files,
+// never by another header.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Starting and Joining a Thread
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to run a computation on another thread and wait for its
+// result.  First, we define a 'ThreadImpUtil::Runnable' whose 'run' method
+// performs the computation and signals its completion:
+//..
+//  class Summer : public bslalg::ThreadImpUtil::Runnable {
+//      // This class sums the integers in '[1 .. n]' on a thread.
+//
+//      // DATA
+//      int                               d_n;          // upper bound
+//      int                               d_sum;        // result
+//      bool                              d_done;       // 'true' when summed
+//      bslalg::ThreadImpUtil::Mutex      d_mutex;      // protects 'd_done'
+//      bslalg::ThreadImpUtil::Condition  d_condition;  // signals 'd_done'
+//
+//    public:
+//      // CREATORS
+//      explicit Summer(int n) : d_n(n), d_sum(0), d_done(false) {}
+//
+//      // MANIPULATORS
+//      void run()
+//      {
+//          int sum = 0;
+//          for (int i = 1; i <= d_n; ++i) {
+//              sum += i;
+//          }
+//          d_mutex.lock();
+//          d_sum  = sum;
+//          d_done = true;
+//          d_condition.signal();
+//          d_mutex.unlock();
+//      }
+//
+//      int waitForSum()
+//      {
+//          d_mutex.lock();
+//          while (!d_done) {
+//              d_condition.wait(&d_mutex);
+//          }
+//          d_mutex.unlock();
+//          return d_sum;
+//      }
+//  };
+//..
+// Then, we start a thread running the computation, and wait for its result:
+//..
+//  Summer summer(100);
+//
+//  bslalg::ThreadImpUtil::Handle handle;
+//  int rc = bslalg::ThreadImpUtil::create(&handle, &summer);
+//  assert(0 == rc);
+//
+//  assert(5050 == summer.waitForSum());
+//..
+// Finally, we join the thread, which releases its resources:
+//..
+//  bslalg::ThreadImpUtil::join(handle);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+
+#ifndef INCLUDED_PTHREAD
+#include <pthread.h>
+#define INCLUDED_PTHREAD
+#endif
+
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+
+#ifndef INCLUDED_WINDOWS
+#include <windows.h>
+#define INCLUDED_WINDOWS
+#endif
+
+#else
+#error "Don't know how to create threads on this platform"
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                           // ====================
+                           // struct ThreadImpUtil
+                           // ====================
+
+struct ThreadImpUtil {
+    // This 'struct' provides a namespace for minimal threading primitives.
+
+    // TYPES
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    typedef pthread_t          Handle;         // identifies a thread
+    typedef pthread_mutex_t    NativeMutex;    // platform-specific mutex
+    typedef pthread_cond_t     NativeCondition;
+                                               // platform-specific condition
+#else
+    typedef HANDLE             Handle;         // identifies a thread
+    typedef CRITICAL_SECTION   NativeMutex;    // platform-specific mutex
+    typedef CONDITION_VARIABLE NativeCondition;
+                                               // platform-specific condition
+#endif
+
+    class Runnable {
+        // This protocol class provides the code run by a thread started by
+        // 'ThreadImpUtil::create'.
+
+      public:
+        // CREATORS
+        virtual ~Runnable();
+            // Destroy this object.
+
+        // MANIPULATORS
+        virtual void run() = 0;
+            // Perform the work of the thread on which this function is
+            // called.  The thread ends when this function returns.
+    };
+
+    class Mutex {
+        // This class provides a non-recursive mutex.
+
+        // DATA
+        NativeMutex d_mutex;  // platform-specific mutex
+
+        // NOT IMPLEMENTED
+        Mutex(const Mutex&);
+        Mutex& operator=(const Mutex&);
+
+      public:
+        // CREATORS
+        Mutex();
+            // Create an unlocked mutex.
+
+        ~Mutex();
+            // Destroy this mutex.  The behavior is undefined unless this mutex
+            // is unlocked.
+
+        // MANIPULATORS
+        void lock();
+            // Lock this mutex, blocking until it is available.  The behavior
+            // is undefined if this mutex is locked by the calling thread.
+
+        void unlock();
+            // Unlock this mutex.  The behavior is undefined unless this mutex
+            // is locked by the calling thread.
+
+        NativeMutex *native();
+            // Return the address of the platform-specific mutex underlying
+            // this object.
+    };
+
+    class Condition {
+        // This class provides a condition variable.
+
+        // DATA
+        NativeCondition d_condition;  // platform-specific condition
+
+        // NOT IMPLEMENTED
+        Condition(const Condition&);
+        Condition& operator=(const Condition&);
+
+      public:
+        // CREATORS
+        Condition();
+            // Create a condition variable.
+
+        ~Condition();
+            // Destroy this condition variable.  The behavior is undefined if
+            // a thread is waiting on it.
+
+        // MANIPULATORS
+        void broadcast();
+            // Wake every thread waiting on this condition variable.
+
+        void signal();
+            // Wake at least one thread waiting on this condition variable, if
+            // any.
+
+        void wait(Mutex *mutex);
+            // Atomically unlock the specified 'mutex' and wait until signaled,
+            // then lock 'mutex' again.  The behavior is undefined unless
+            // 'mutex' is locked by the calling thread.  Note that a spurious
+            // wakeup may occur.
+    };
+
+    // CLASS METHODS
+    static int create(Handle *handle, Runnable *runnable);
+        // Start a thread calling 'run' on the specified 'runnable', and load
+        // into the specified 'handle' an identifier of the thread.  Return 0
+        // on success, and a non-zero value (leaving 'handle' in an
+        // unspecified state) if the thread cannot be started.  The behavior
+        // is undefined unless 'runnable' remains valid until the thread is
+        // joined.  Note that the thread must be joined (see 'join') to release
+        // its resources.
+
+    static void join(Handle handle);
+        // Wait until the thread identified by the specified 'handle' ends,
+        // and release its resources.  The behavior is undefined unless
+        // 'handle' identifies a thread started by 'create' that is not the
+        // calling thread and has not been joined.
+
+    static int numProcessors();
+        // Return the number of processors available to the process, or 1 if
+        // it cannot be determined.
+
+    static void yield();
+        // Relinquish the remainder of the calling thread's time slice.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class ThreadImpUtil::Mutex
+                        // --------------------------
+
+// CREATORS
+inline
+ThreadImpUtil::Mutex::Mutex()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_mutex_init(&d_mutex, 0);
+#else
+    InitializeCriticalSection(&d_mutex);
+#endif
+}
+
+inline
+ThreadImpUtil::Mutex::~Mutex()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_mutex_destroy(&d_mutex);
+#else
+    DeleteCriticalSection(&d_mutex);
+#endif
+}
+
+// MANIPULATORS
+inline
+void ThreadImpUtil::Mutex::lock()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_mutex_lock(&d_mutex);
+#else
+    EnterCriticalSection(&d_mutex);
+#endif
+}
+
+inline
+void ThreadImpUtil::Mutex::unlock()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_mutex_unlock(&d_mutex);
+#else
+    LeaveCriticalSection(&d_mutex);
+#endif
+}
+
+inline
+ThreadImpUtil::NativeMutex *ThreadImpUtil::Mutex::native()
+{
+    return &d_mutex;
+}
+
+                      // ------------------------------
+                      // class ThreadImpUtil::Condition
+                      // ------------------------------
+
+// CREATORS
+inline
+ThreadImpUtil::Condition::Condition()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_cond_init(&d_condition, 0);
+#else
+    InitializeConditionVariable(&d_condition);
+#endif
+}
+
+inline
+ThreadImpUtil::Condition::~Condition()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_cond_destroy(&d_condition);
+#endif
+}
+
+// MANIPULATORS
+inline
+void ThreadImpUtil::Condition::broadcast()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_cond_broadcast(&d_condition);
+#else
+    WakeAllConditionVariable(&d_condition);
+#endif
+}
+
+inline
+void ThreadImpUtil::Condition::signal()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_cond_signal(&d_condition);
+#else
+    WakeConditionVariable(&d_condition);
+#endif
+}
+
+inline
+void ThreadImpUtil::Condition::wait(Mutex *mutex)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_cond_wait(&d_condition, mutex->native());
+#else
+    SleepConditionVariableCS(&d_condition, mutex->native(), INFINITE);
+#endif
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,484 @@
+// bslalg_threadimputil.t.cpp                                         -*-C++-*-
+
+#include <bslalg_threadimputil.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides thin wrappers over the threading
+// primitives of the platform.  We verify that threads are started, run the
+// supplied 'Runnable', and can be joined; that a mutex provides mutual
+// exclusion among several threads; and that 'signal' and 'broadcast' wake
+// threads waiting on a condition variable.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int create(Handle *handle, Runnable *runnable);
+// [ 2] static void join(Handle handle);
+// [ 1] static int numProcessors();
+// [ 1] static void yield();
+//
+// ThreadImpUtil::Mutex
+// [ 1] Mutex();
+// [ 1] ~Mutex();
+// [ 2] void lock();
+// [ 2] void unlock();
+//
+// ThreadImpUtil::Condition
+// [ 1] Condition();
+// [ 1] ~Condition();
+// [ 3] void broadcast();
+// [ 3] void signal();
+// [ 3] void wait(Mutex *mutex);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::ThreadImpUtil Obj;
+typedef Obj::Mutex            Mutex;
+typedef Obj::Condition        Condition;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+class Incrementer : public Obj::Runnable {
+    // This class increments a shared counter, protected by a shared mutex, a
+    // specified number of times.
+
+    // DATA
+    Mutex *d_mutex_p;        // protects '*d_counter_p' (held)
+    int   *d_counter_p;      // counter to increment (held)
+    int    d_numIncrements;  // number of times to increment
+
+  public:
+    // CREATORS
+    Incrementer(Mutex *mutex, int *counter, int numIncrements)
+    : d_mutex_p(mutex)
+    , d_counter_p(counter)
+    , d_numIncrements(numIncrements)
+    {
+    }
+
+    // MANIPULATORS
+    void run()
+    {
+        for (int i = 0; i < d_numIncrements; ++i) {
+            d_mutex_p->lock();
+            const int value = *d_counter_p;
+            if (0 == i % 64) {
+                Obj::yield();  // widen the window for a lost update
+            }
+            *d_counter_p = value + 1;
+            d_mutex_p->unlock();
+        }
+    }
+};
+
+class Waiter : public Obj::Runnable {
+    // This class waits until a shared generation counter, protected by a
+    // shared mutex, reaches a specified value, and then increments a shared
+    // count of the threads woken.
+
+    // DATA
+    Mutex     *d_mutex_p;       // protects the fields below (held)
+    Condition *d_condition_p;   // signals a change of generation (held)
+    int       *d_generation_p;  // current generation (held)
+    int       *d_numWoken_p;    // threads that saw their generation (held)
+    int        d_target;        // generation to wait for
+
+  public:
+    // CREATORS
+    Waiter(Mutex     *mutex,
+           Condition *condition,
+           int       *generation,
+           int       *numWoken,
+           int        target)
+    : d_mutex_p(mutex)
+    , d_condition_p(condition)
+    , d_generation_p(generation)
+    , d_numWoken_p(numWoken)
+    , d_target(target)
+    {
+    }
+
+    // MANIPULATORS
+    void run()
+    {
+        d_mutex_p->lock();
+        while (*d_generation_p < d_target) {
+            d_condition_p->wait(d_mutex_p);
+        }
+        ++*d_numWoken_p;
+        d_mutex_p->unlock();
+    }
+};
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Starting and Joining a Thread
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to run a computation on another thread and wait for its
+// result.  First, we define a 'ThreadImpUtil::Runnable' whose 'run' method
+// performs the computation and signals its completion:
+//..
+    class Summer : public bslalg::ThreadImpUtil::Runnable {
+        // This class sums the integers in '[1 .. n]' on a thread.
+
+        // DATA
+        int                               d_n;          // upper bound
+        int                               d_sum;        // result
+        bool                              d_done;       // 'true' when summed
+        bslalg::ThreadImpUtil::Mutex      d_mutex;      // protects 'd_done'
+        bslalg::ThreadImpUtil::Condition  d_condition;  // signals 'd_done'
+
+      public:
+        // CREATORS
+        explicit Summer(int n) : d_n(n), d_sum(0), d_done(false) {}
+
+        // MANIPULATORS
+        void run()
+        {
+            int sum = 0;
+            for (int i = 1; i <= d_n; ++i) {
+                sum += i;
+            }
+            d_mutex.lock();
+            d_sum  = sum;
+            d_done = true;
+            d_condition.signal();
+            d_mutex.unlock();
+        }
+
+        int waitForSum()
+        {
+            d_mutex.lock();
+            while (!d_done) {
+                d_condition.wait(&d_mutex);
+            }
+            d_mutex.unlock();
+            return d_sum;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we start a thread running the computation, and wait for its result:
+//..
+    Summer summer(100);
+
+    bslalg::ThreadImpUtil::Handle handle;
+    int rc = bslalg::ThreadImpUtil::create(&handle, &summer);
+    ASSERT(0 == rc);
+
+    ASSERT(5050 == summer.waitForSum());
+//..
+// Finally, we join the thread, which releases its resources:
+//..
+    bslalg::ThreadImpUtil::join(handle);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONDITION VARIABLES
+        //
+        // Concerns:
+        //: 1 'signal' wakes a thread waiting on the condition variable.
+        //:
+        //: 2 'broadcast' wakes every thread waiting on the condition
+        //:   variable.
+        //:
+        //: 3 'wait' releases the mutex while waiting, and holds it again on
+        //:   return.
+        //
+        // Plan:
+        //: 1 Repeatedly start a thread waiting (in a loop checking a shared
+        //:   generation counter under the mutex) for the counter to change,
+        //:   yield a varying number of times, then change the counter and
+        //:   call 'signal' under the mutex.  Join the thread, and verify
+        //:   that it has woken.  (C-1, 3)
+        //:
+        //: 2 Start several threads waiting for the same value, advance the
+        //:   counter to that value, call 'broadcast', join the threads, and
+        //:   verify that every thread has woken.  (C-2, 3)
+        //
+        // Testing:
+        //   void broadcast();
+        //   void signal();
+        //   void wait(Mutex *mutex);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONDITION VARIABLES"
+                            "\n===================\n");
+
+        enum { NUM_THREADS = 8 };
+
+        if (verbose) printf("\tSignal.\n");
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            Mutex     mutex;
+            Condition condition;
+            int       generation = 0;
+            int       numWoken   = 0;
+
+            Waiter      waiter(&mutex, &condition, &generation, &numWoken, 1);
+            Obj::Handle handle;
+            LOOP_ASSERT(i, 0 == Obj::create(&handle, &waiter));
+
+            for (int j = 0; j < i; ++j) {
+                Obj::yield();  // vary whether the thread is waiting yet
+            }
+
+            mutex.lock();
+            generation = 1;
+            condition.signal();
+            mutex.unlock();
+
+            Obj::join(handle);
+            LOOP_ASSERT(i, 1 == numWoken);
+        }
+
+        if (verbose) printf("\tBroadcast.\n");
+        {
+            Mutex     mutex;
+            Condition condition;
+            int       generation = 0;
+            int       numWoken   = 0;
+
+            Waiter       *waiters[NUM_THREADS];
+            Obj::Handle   handles[NUM_THREADS];
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                waiters[i] = new Waiter(&mutex,
+                                        &condition,
+                                        &generation,
+                                        &numWoken,
+                                        1);
+                LOOP_ASSERT(i, 0 == Obj::create(&handles[i], waiters[i]));
+            }
+
+            mutex.lock();
+            generation = 1;
+            condition.broadcast();
+            mutex.unlock();
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                Obj::join(handles[i]);
+            }
+            ASSERT(NUM_THREADS == numWoken);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                delete waiters[i];
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // THREADS AND MUTUAL EXCLUSION
+        //
+        // Concerns:
+        //: 1 'create' starts a thread calling 'run' on the supplied object,
+        //:   and returns 0.
+        //:
+        //: 2 'join' returns only after the thread has finished.
+        //:
+        //: 3 A mutex admits a single thread at a time.
+        //
+        // Plan:
+        //: 1 Start several threads, each incrementing a shared counter
+        //:   protected by a mutex many times, reading and writing the counter
+        //:   in separate steps (yielding in between).  Join the threads, and
+        //:   verify that the counter holds the total number of increments.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   static int create(Handle *handle, Runnable *runnable);
+        //   static void join(Handle handle);
+        //   void lock();
+        //   void unlock();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTHREADS AND MUTUAL EXCLUSION"
+                            "\n============================\n");
+
+        enum { NUM_THREADS = 8, NUM_INCREMENTS = 10000 };
+
+        Mutex mutex;
+        int   counter = 0;
+
+        Incrementer *incrementers[NUM_THREADS];
+        Obj::Handle  handles[NUM_THREADS];
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            incrementers[i] = new Incrementer(&mutex,
+                                              &counter,
+                                              NUM_INCREMENTS);
+            LOOP_ASSERT(i, 0 == Obj::create(&handles[i], incrementers[i]));
+        }
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            Obj::join(handles[i]);
+        }
+
+        if (veryVerbose) { P(counter); }
+        ASSERT(NUM_THREADS * NUM_INCREMENTS == counter);
+
+        for (int i = 0; i < NUM_THREADS; ++i) {
+            delete incrementers[i];
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create and destroy a mutex and a condition variable, lock and
+        //:   unlock the mutex, signal and broadcast the condition variable
+        //:   with no waiting thread, yield, and verify that there is at least
+        //:   one processor.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   Mutex();
+        //   ~Mutex();
+        //   Condition();
+        //   ~Condition();
+        //   static int numProcessors();
+        //   static void yield();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        {
+            Mutex     mutex;
+            Condition condition;
+
+            mutex.lock();
+            condition.signal();
+            condition.broadcast();
+            mutex.unlock();
+
+            ASSERT(0 != mutex.native());
+        }
+
+        Obj::yield();
+
+        const int numProcessors = Obj::numProcessors();
+        if (veryVerbose) { P(numProcessors); }
+        ASSERT(1 <= numProcessors);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
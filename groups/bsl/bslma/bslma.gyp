@@ -5,6 +5,7 @@
       'bslma_autodeallocator.cpp',
       'bslma_autodestructor.cpp',
       'bslma_autorawdeleter.cpp',
+      'bslma_countingallocator.cpp',
       'bslma_deallocatorguard.cpp',
       'bslma_deallocatorproctor.cpp',
       'bslma_default.cpp',
@@ -12,8 +13,10 @@
       'bslma_deleterhelper.cpp',
       'bslma_destructorguard.cpp',
       'bslma_destructorproctor.cpp',
+      'bslma_epochreclaimer.cpp',
       'bslma_mallocfreeallocator.cpp',
       'bslma_newdeleteallocator.cpp',
+      'bslma_profilingallocator.cpp',
       'bslma_rawdeleterguard.cpp',
       'bslma_rawdeleterproctor.cpp',
       'bslma_testallocator.cpp',
@@ -26,6 +29,7 @@
       'bslma_autodeallocator.t',
       'bslma_autodestructor.t',
       'bslma_autorawdeleter.t',
+      'bslma_countingallocator.t',
       'bslma_deallocatorguard.t',
       'bslma_deallocatorproctor.t',
       'bslma_default.t',
@@ -33,8 +37,10 @@
       'bslma_deleterhelper.t',
       'bslma_destructorguard.t',
       'bslma_destructorproctor.t',
+      'bslma_epochreclaimer.t',
       'bslma_mallocfreeallocator.t',
       'bslma_newdeleteallocator.t',
+      'bslma_profilingallocator.t',
       'bslma_rawdeleterguard.t',
       'bslma_rawdeleterproctor.t',
       'bslma_testallocator.t',
@@ -47,6 +53,7 @@
       '<(PRODUCT_DIR)/bslma_autodeallocator.t',
       '<(PRODUCT_DIR)/bslma_autodestructor.t',
       '<(PRODUCT_DIR)/bslma_autorawdeleter.t',
+      '<(PRODUCT_DIR)/bslma_countingallocator.t',
       '<(PRODUCT_DIR)/bslma_deallocatorguard.t',
       '<(PRODUCT_DIR)/bslma_deallocatorproctor.t',
       '<(PRODUCT_DIR)/bslma_default.t',
@@ -54,8 +61,10 @@
       '<(PRODUCT_DIR)/bslma_deleterhelper.t',
       '<(PRODUCT_DIR)/bslma_destructorguard.t',
       '<(PRODUCT_DIR)/bslma_destructorproctor.t',
+      '<(PRODUCT_DIR)/bslma_epochreclaimer.t',
       '<(PRODUCT_DIR)/bslma_mallocfreeallocator.t',
       '<(PRODUCT_DIR)/bslma_newdeleteallocator.t',
+      '<(PRODUCT_DIR)/bslma_profilingallocator.t',
       '<(PRODUCT_DIR)/bslma_rawdeleterguard.t',
       '<(PRODUCT_DIR)/bslma_rawdeleterproctor.t',
       '<(PRODUCT_DIR)/bslma_testallocator.t',
@@ -149,6 +158,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_autorawdeleter.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_countingallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_countingallocator.t.cpp' ],
+    },
     {
       'target_name': 'bslma_deallocatorguard.t',
       'type': 'executable',
@@ -205,6 +222,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslma_destructorproctor.t.cpp' ],
     },
+    {
+      'target_name': 'bslma_epochreclaimer.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_epochreclaimer.t.cpp' ],
+    },
     {
       'target_name': 'bslma_mallocfreeallocator.t',
       'type': 'executable',
@@ -229,6 +254,14 @@
           { 'ldflags': [ '-bexpfull' ] } ],
       ],
     },
+    {
+      'target_name': 'bslma_profilingallocator.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslma_pkgdeps)', 'bslma' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslma_profilingallocator.t.cpp' ],
+    },
     {
       'target_name': 'bslma_rawdeleterguard.t',
       'type': 'executable',
@@ -4,8 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_exceptionutil.h>
+#include <bsls_types.h>
 
+#include <limits>  // 'std::numeric_limits'
 #include <new>   // 'std::bad_alloc'
 
 namespace BloombergLP {
@@ -27,6 +31,69 @@ Allocator::~Allocator()
 {
 }
 
+// MANIPULATORS
+void Allocator::deallocateSized(void *address, size_type)
+{
+    deallocate(address);
+}
+
+void *Allocator::allocateAligned(size_type size, size_type alignment)
+{
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+
+    if (alignment <= bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        return allocate(size);                                        // RETURN
+    }
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    if (size > std::numeric_limits<size_type>::max() - alignment) {
+        throwBadAlloc();
+    }
+
+    // Over-allocate by 'alignment' bytes.  Since 'allocate' returns a
+    // maximally-aligned address, and 'alignment' is a multiple of the maximal
+    // alignment, the first 'alignment'-aligned address strictly past the
+    // start of the underlying block leaves at least 'BSLS_MAX_ALIGNMENT'
+    // bytes, enough to hold the address of the underlying block, in front of
+    // the address returned.
+
+    char *block = static_cast<char *>(allocate(size + alignment));
+
+    const bsls::Types::UintPtr mask = alignment - 1;
+    char *aligned = reinterpret_cast<char *>(
+                   (reinterpret_cast<bsls::Types::UintPtr>(block) + alignment)
+                                                                      & ~mask);
+
+    reinterpret_cast<void **>(aligned)[-1] = block;
+    return aligned;
+}
+
+void Allocator::deallocateAligned(void      *address,
+                                  size_type  size,
+                                  size_type  alignment)
+{
+    BSLS_ASSERT_SAFE(0 < alignment);
+    BSLS_ASSERT_SAFE(0 == (alignment & (alignment - 1)));
+
+    if (alignment <= bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        deallocateSized(address, size);
+        return;                                                       // RETURN
+    }
+
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(size <= std::numeric_limits<size_type>::max()
+                                                                - alignment);
+
+    deallocateSized(reinterpret_cast<void **>(address)[-1], size + alignment);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
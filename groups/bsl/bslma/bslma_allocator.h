@@ -119,6 +119,43 @@ BSLS_IDENT("$Id: $")
 // is known that the 'address' does *not* refer to a secondary base class of
 // the object being deleted.
 //
+///Sized Deallocation
+///------------------
+// In addition to the pure virtual 'deallocate' method, the protocol provides
+// a (non-pure) virtual 'deallocateSized' method that takes, along with the
+// address of the memory block, the 'size' that was originally requested from
+// 'allocate'.  Clients that know the size of the blocks they deallocate --
+// e.g., containers, which always know the capacity or node size of the memory
+// they obtained -- should prefer 'deallocateSized'.  The default
+// implementation simply forwards to 'deallocate', so existing allocators need
+// not change; however, an allocator (such as a size-class pool) that would
+// otherwise have to store a header in each block, or search for the size of a
+// block being returned, can override 'deallocateSized' to avoid that cost.
+// Note that an allocator overriding 'deallocateSized' must still implement
+// 'deallocate', since not all clients supply the size.
+//
+///Over-Aligned Allocation
+///-----------------------
+// 'allocate' guarantees only the natural alignment of the platform (see
+// 'bsls_alignmentutil'), which is insufficient for "over-aligned" types --
+// e.g., types padded to a cache line to avoid false sharing, or types holding
+// SIMD vectors -- whose alignment requirement exceeds
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'.  For such types the protocol
+// provides the (non-pure) virtual 'allocateAligned' and 'deallocateAligned'
+// methods, which take the required 'alignment' in addition to the 'size'.  A
+// block obtained from 'allocateAligned' must be returned by
+// 'deallocateAligned' with the same 'size' and 'alignment'.
+//
+// If the requested alignment does not exceed the natural alignment, the
+// default implementations simply forward to 'allocate' and
+// 'deallocateSized', respectively.  Otherwise, 'allocateAligned' requests
+// 'size + alignment' bytes from 'allocate', returns a suitably aligned
+// address within that block, and records the address of the underlying block
+// in the bytes immediately preceding the address returned;
+// 'deallocateAligned' retrieves that address and returns the underlying
+// block.  Allocators that can satisfy over-aligned requests directly (e.g.,
+// by calling 'posix_memalign') can override both methods.
+//
 ///Usage
 ///-----
 // The 'bslma::Allocator' protocol provided in this component defines a
@@ -441,6 +478,40 @@ class Allocator {
         // behavior is undefined unless 'address' was allocated using this
         // allocator object and has not already been deallocated.
 
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', allocated with
+        // the specified 'size' (in bytes), back to this allocator.  If
+        // 'address' is 0, this function has no effect.  The behavior is
+        // undefined unless 'address' was allocated using this allocator
+        // object by a call to 'allocate' with an argument of 'size', and has
+        // not already been deallocated.  Note that the default implementation
+        // ignores 'size' and calls 'deallocate(address)'; derived classes that
+        // can use the size to avoid per-block bookkeeping should override this
+        // method (see "Sized Deallocation" in the component-level
+        // documentation).
+
+    virtual void *allocateAligned(size_type size, size_type alignment);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) whose address is a multiple of the
+        // specified 'alignment'.  If 'size' is 0, a null pointer is returned
+        // with no other effect.  If this allocator cannot return the requested
+        // number of bytes, then it will throw a 'std::bad_alloc' exception in
+        // an exception-enabled build, or else will abort the program in a
+        // non-exception build.  The behavior is undefined unless '0 <= size'
+        // and 'alignment' is a positive, integral power of 2.  Note that the
+        // block must be returned using 'deallocateAligned' (see "Over-Aligned
+        // Allocation" in the component-level documentation).
+
+    virtual void deallocateAligned(void      *address,
+                                   size_type  size,
+                                   size_type  alignment);
+        // Return the memory block at the specified 'address', allocated with
+        // the specified 'size' (in bytes) and the specified 'alignment', back
+        // to this allocator.  If 'address' is 0, this function has no effect.
+        // The behavior is undefined unless 'address' was allocated using this
+        // allocator object by a call to 'allocateAligned' with arguments of
+        // 'size' and 'alignment', and has not already been deallocated.
+
     template <class TYPE>
     void deleteObject(const TYPE *object);
         // Destroy the specified 'object' based on its dynamic type and then
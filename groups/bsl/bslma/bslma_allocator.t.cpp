@@ -9,6 +9,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <limits>
 #include <new>
 
 using namespace BloombergLP;
@@ -33,11 +34,14 @@ using namespace BloombergLP;
 // [ 3] template<typename TYPE> deleteObjectRaw(const TYPE *);
 // [ 4] void *operator new(int size, bslma::Allocator& basicAllocator);
 // [ 5] void operator delete(void *address, bslma::Allocator& basicAllocator);
+// [ 6] virtual void deallocateSized(void *address, size_type size);
+// [ 7] virtual void *allocateAligned(size_type size, size_type alignment);
+// [ 7] virtual void deallocateAligned(void *, size_type, size_type);
 //-----------------------------------------------------------------------------
 // [ 1] PROTOCOL TEST - Make sure derived class compiles and links.
 // [ 4] OPERATOR TEST - Make sure overloaded operators call correct functions.
 // [ 5] EXCEPTION SAFETY - Ensure operator delete is invoked on an exception.
-// [ 6] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
+// [ 8] USAGE EXAMPLE - Make sure usage examples compiles and works properly.
 //=============================================================================
 
 //=============================================================================
@@ -132,6 +136,92 @@ class my_Allocator : public bslma::Allocator {
         // Return number of times deallocate called.
 };
 
+class my_SizedAllocator : public my_Allocator {
+    // Test class used to verify that an override of 'deallocateSized' is
+    // called with the size supplied by the client.
+
+    int d_size;                   // last size passed to 'deallocateSized'
+    int d_deallocateSizedCount;   // number of times 'deallocateSized' called
+
+  public:
+    my_SizedAllocator() : d_size(-1), d_deallocateSizedCount(0) { }
+    ~my_SizedAllocator() { }
+
+    void deallocateSized(void *address, size_type size) {
+        d_size = static_cast<int>(size);
+        ++d_deallocateSizedCount;
+        deallocate(address);
+    }
+
+    int size() const { return d_size; }
+        // Return last size argument value for 'deallocateSized'.
+
+    int deallocateSizedCount() const { return d_deallocateSizedCount; }
+        // Return number of times 'deallocateSized' called.
+};
+
+class my_MallocAllocator : public bslma::Allocator {
+    // Test class used to verify the default implementations of
+    // 'allocateAligned' and 'deallocateAligned'.  Memory is supplied by
+    // 'malloc', and the arguments of the most recent calls to 'allocate' and
+    // 'deallocateSized' are recorded.
+
+    int   d_allocateSize;     // last size passed to 'allocate'
+    void *d_allocateResult;   // last address returned by 'allocate'
+    int   d_deallocateSize;   // last size passed to 'deallocateSized'
+    void *d_deallocateArg;    // last address passed to 'deallocateSized'
+    int   d_numBlocksInUse;   // number of blocks currently allocated
+
+  public:
+    my_MallocAllocator()
+    : d_allocateSize(-1)
+    , d_allocateResult(0)
+    , d_deallocateSize(-1)
+    , d_deallocateArg(0)
+    , d_numBlocksInUse(0)
+    {
+    }
+
+    ~my_MallocAllocator() { }
+
+    void *allocate(size_type size) {
+        d_allocateSize   = static_cast<int>(size);
+        d_allocateResult = size ? malloc(size) : 0;
+        if (d_allocateResult) {
+            ++d_numBlocksInUse;
+        }
+        return d_allocateResult;
+    }
+
+    void deallocate(void *address) {
+        if (address) {
+            --d_numBlocksInUse;
+            free(address);
+        }
+    }
+
+    void deallocateSized(void *address, size_type size) {
+        d_deallocateSize = static_cast<int>(size);
+        d_deallocateArg  = address;
+        deallocate(address);
+    }
+
+    int allocateSize() const { return d_allocateSize; }
+        // Return last size argument value for 'allocate'.
+
+    void *allocateResult() const { return d_allocateResult; }
+        // Return last address returned by 'allocate'.
+
+    int deallocateSize() const { return d_deallocateSize; }
+        // Return last size argument value for 'deallocateSized'.
+
+    void *deallocateArg() const { return d_deallocateArg; }
+        // Return last address argument value for 'deallocateSized'.
+
+    int numBlocksInUse() const { return d_numBlocksInUse; }
+        // Return number of blocks currently allocated.
+};
+
 class my_NewDeleteAllocator : public bslma::Allocator {
     // Test class used to verify examples.
 
@@ -425,7 +515,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 6: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -479,6 +569,182 @@ int main(int argc, char *argv[])
             deleteMyType(&a, t);
         }
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // ALIGNED ALLOCATION TEST:
+        //   We want to make sure that the default implementations of
+        //   'allocateAligned' and 'deallocateAligned' forward to 'allocate'
+        //   and 'deallocateSized' for alignments not exceeding the maximal
+        //   alignment, and otherwise return addresses having the requested
+        //   alignment, returning the underlying blocks with their sizes.
+        //
+        // Plan:
+        //   For a set of sizes and alignments, allocate a block using
+        //   'allocateAligned' and verify the alignment of the address
+        //   returned, that the entire block can be written, and the size
+        //   requested from 'allocate'.  Then return the block using
+        //   'deallocateAligned' and verify the address and size passed to
+        //   'deallocateSized'.  Verify that a request for 0 bytes returns 0,
+        //   and that deallocating 0 has no effect.  Finally, in an
+        //   exception-enabled build, verify that a request whose size would
+        //   overflow when increased by the alignment throws
+        //   'std::bad_alloc' without calling 'allocate'.
+        //
+        // Testing:
+        //   virtual void *allocateAligned(size_type size, size_type align);
+        //   virtual void deallocateAligned(void *, size_type, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALIGNED ALLOCATION TEST"
+                            "\n=======================\n");
+
+        const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+        const int SIZES[] = { 1, 2, 7, 8, 15, 16, 63, 64, 100, 1000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const int ALIGNS[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 4096 };
+        const int NUM_ALIGNS = sizeof ALIGNS / sizeof *ALIGNS;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            for (int j = 0; j < NUM_ALIGNS; ++j) {
+                const int ALIGN = ALIGNS[j];
+
+                my_MallocAllocator myA;
+                bslma::Allocator& a = myA;
+
+                char *p = static_cast<char *>(a.allocateAligned(SIZE, ALIGN));
+
+                LOOP2_ASSERT(i, j, p);
+                LOOP2_ASSERT(i, j,
+                       0 == reinterpret_cast<bsls::Types::UintPtr>(p) % ALIGN);
+                LOOP2_ASSERT(i, j, 1 == myA.numBlocksInUse());
+
+                memset(p, 0xa5, SIZE);
+
+                const char *BLOCK = static_cast<char *>(myA.allocateResult());
+                if (ALIGN <= MAX_ALIGN) {
+                    LOOP2_ASSERT(i, j, SIZE  == myA.allocateSize());
+                    LOOP2_ASSERT(i, j, BLOCK == p);
+                }
+                else {
+                    LOOP2_ASSERT(i, j, SIZE + ALIGN == myA.allocateSize());
+                    LOOP2_ASSERT(i, j, BLOCK + MAX_ALIGN <= p);
+                    LOOP2_ASSERT(i, j, p + SIZE <= BLOCK + SIZE + ALIGN);
+                }
+
+                a.deallocateAligned(p, SIZE, ALIGN);
+
+                LOOP2_ASSERT(i, j, 0 == myA.numBlocksInUse());
+                LOOP2_ASSERT(i, j, BLOCK == myA.deallocateArg());
+                LOOP2_ASSERT(i, j, myA.allocateSize() ==
+                                                        myA.deallocateSize());
+            }
+        }
+
+        if (verbose) printf("\nTesting zero size and null address.\n");
+        {
+            for (int j = 0; j < NUM_ALIGNS; ++j) {
+                const int ALIGN = ALIGNS[j];
+
+                my_MallocAllocator myA;
+                bslma::Allocator& a = myA;
+
+                LOOP_ASSERT(j, 0 == a.allocateAligned(0, ALIGN));
+                a.deallocateAligned(0, 0, ALIGN);
+                LOOP_ASSERT(j, 0 == myA.numBlocksInUse());
+            }
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\nTesting size overflow.\n");
+        {
+            const bslma::Allocator::size_type MAX_SIZE =
+                   std::numeric_limits<bslma::Allocator::size_type>::max();
+
+            for (int j = 0; j < NUM_ALIGNS; ++j) {
+                const int ALIGN = ALIGNS[j];
+
+                if (ALIGN <= MAX_ALIGN) {
+                    continue;
+                }
+
+                my_MallocAllocator myA;
+                bslma::Allocator& a = myA;
+
+                bool caught = false;
+                try {
+                    a.allocateAligned(MAX_SIZE - ALIGN + 1, ALIGN);
+                }
+                catch (const std::bad_alloc&) {
+                    caught = true;
+                }
+                LOOP_ASSERT(j, caught);
+                LOOP_ASSERT(j, -1 == myA.allocateSize());
+                LOOP_ASSERT(j,  0 == myA.numBlocksInUse());
+            }
+        }
+#endif
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SIZED DEALLOCATION TEST:
+        //   We want to make sure that the default implementation of
+        //   'deallocateSized' forwards to 'deallocate', and that an override
+        //   of 'deallocateSized' in a derived class is invoked (through the
+        //   base class) with the size supplied by the caller.
+        //
+        // Plan:
+        //   Using a base class reference to an allocator that does not
+        //   override 'deallocateSized', invoke 'deallocateSized' and verify
+        //   that 'deallocate' was called.  Repeat with an allocator that
+        //   overrides 'deallocateSized', and verify the size it observes.
+        //
+        // Testing:
+        //   virtual void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSIZED DEALLOCATION TEST"
+                            "\n=======================\n");
+
+        if (verbose) printf("\nTesting default implementation.\n");
+        {
+            my_Allocator myA;
+            bslma::Allocator& a = myA;
+
+            ASSERT(&myA == a.allocate(24));     ASSERT(1 == myA.fun());
+            a.deallocateSized(&myA, 24);        ASSERT(2 == myA.fun());
+            ASSERT(1 == myA.deallocateCount());
+        }
+
+        if (verbose) printf("\nTesting overridden implementation.\n");
+        {
+            my_SizedAllocator myA;
+            bslma::Allocator& a = myA;
+
+            const int SIZES[] = { 1, 2, 7, 8, 15, 16, 100 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                void *p = a.allocate(SIZE);
+                a.deallocateSized(p, SIZE);
+
+                LOOP_ASSERT(i, SIZE  == myA.size());
+                LOOP_ASSERT(i, i + 1 == myA.deallocateSizedCount());
+                LOOP_ASSERT(i, i + 1 == myA.deallocateCount());
+            }
+
+            a.deallocate(&myA);
+            ASSERT(NUM_SIZES     == myA.deallocateSizedCount());
+            ASSERT(NUM_SIZES + 1 == myA.deallocateCount());
+        }
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -0,0 +1,206 @@
+// bslma_countingallocator.cpp                                        -*-C++-*-
+#include <bslma_countingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_cachelinepadded.h>  // 'bsls::PerCoreArray_Util'
+
+namespace BloombergLP {
+
+namespace {
+
+                           // ============
+                           // union Header
+                           // ============
+
+union Header {
+    // This 'union' defines the (maximally-aligned) header preceding each block
+    // dispensed by a counting allocator.
+
+    bslma::Allocator::size_type         d_size;       // size of the block
+                                                      // (excluding header)
+
+    bsls::AlignmentUtil::MaxAlignedType d_alignment;  // force alignment
+};
+
+}  // close unnamed namespace
+
+namespace bslma {
+
+                         // -----------------------
+                         // class CountingAllocator
+                         // -----------------------
+
+// PRIVATE MANIPULATORS
+CountingAllocator_Shard& CountingAllocator::localShard()
+{
+    return d_shards[bsls::PerCoreArray_Util::currentCpu() % k_NUM_SHARDS];
+}
+
+void *CountingAllocator::releaseBlock(void *address)
+{
+    Header *header = static_cast<Header *>(address) - 1;
+
+    d_exact.d_numBytesInUse.addRelaxed(-static_cast<bsls::Types::Int64>(
+                                                             header->d_size));
+    localShard().d_numDeallocations.addRelaxed(1);
+
+    return header;
+}
+
+// CREATORS
+CountingAllocator::CountingAllocator(Allocator *basicAllocator)
+: d_name_p(0)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+CountingAllocator::CountingAllocator(const char *name,
+                                     Allocator  *basicAllocator)
+: d_name_p(name)
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+CountingAllocator::~CountingAllocator()
+{
+}
+
+// MANIPULATORS
+void *CountingAllocator::allocate(size_type size)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                               d_allocator_p->allocate(size + sizeof(Header)));
+    header->d_size = size;
+
+    const bsls::Types::Int64 bytes = static_cast<bsls::Types::Int64>(size);
+
+    CountingAllocator_Shard& shard = localShard();
+    shard.d_numAllocations.addRelaxed(1);
+    shard.d_numBytesTotal.addRelaxed(bytes);
+
+    const bsls::Types::Int64 bytesInUse =
+                                   d_exact.d_numBytesInUse.addRelaxed(bytes);
+
+    // Raise the high-water mark only if this allocation exceeds it, so that
+    // in the common (steady-state) case the mark is merely read, and its cache
+    // line is not taken from the other processors reading it.
+
+    bsls::Types::Int64 bytesMax = d_exact.d_numBytesMax.loadRelaxed();
+    while (bytesInUse > bytesMax) {
+        const bsls::Types::Int64 previous =
+                      d_exact.d_numBytesMax.testAndSwap(bytesMax, bytesInUse);
+        if (previous == bytesMax) {
+            break;
+        }
+        bytesMax = previous;
+    }
+
+    return header + 1;
+}
+
+void CountingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    d_allocator_p->deallocate(releaseBlock(address));
+}
+
+void CountingAllocator::deallocateSized(void *address, size_type size)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(size == (static_cast<Header *>(address) - 1)->d_size);
+
+    d_allocator_p->deallocateSized(releaseBlock(address),
+                                   size + sizeof(Header));
+}
+
+void CountingAllocator::resetNumBytesMax()
+{
+    d_exact.d_numBytesMax.storeRelaxed(
+                                   d_exact.d_numBytesInUse.loadRelaxed());
+}
+
+// ACCESSORS
+void CountingAllocator::loadStatistics(
+                                     CountingAllocatorStatistics *result) const
+{
+    BSLS_ASSERT(result);
+
+    result->d_numDeallocations = numDeallocations();
+    result->d_numAllocations   = numAllocations();
+    result->d_numBlocksInUse   = result->d_numAllocations
+                               - result->d_numDeallocations;
+    result->d_numBytesInUse    = numBytesInUse();
+    result->d_numBytesMax      = numBytesMax();
+    result->d_numBytesTotal    = numBytesTotal();
+}
+
+bsls::Types::Int64 CountingAllocator::numAllocations() const
+{
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        total += d_shards[i].d_numAllocations.loadRelaxed();
+    }
+    return total;
+}
+
+bsls::Types::Int64 CountingAllocator::numBytesTotal() const
+{
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        total += d_shards[i].d_numBytesTotal.loadRelaxed();
+    }
+    return total;
+}
+
+bsls::Types::Int64 CountingAllocator::numDeallocations() const
+{
+    bsls::Types::Int64 total = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        total += d_shards[i].d_numDeallocations.loadRelaxed();
+    }
+    return total;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,432 @@
+// bslma_countingallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLMA_COUNTINGALLOCATOR
+#define INCLUDED_BSLMA_COUNTINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a low-overhead allocator adaptor that collects statistics.
+//
+//@CLASSES:
+//  bslma::CountingAllocator: thread-safe adaptor maintaining usage counters
+//  bslma::CountingAllocatorStatistics: snapshot of the counters
+//
+//@SEE_ALSO: bslma_testallocator, bslma_profilingallocator
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'bslma::CountingAllocator', that implements the 'bslma::Allocator' protocol
+// by forwarding to another ("underlying") allocator, maintaining statistics
+// on the memory it dispenses: the number of blocks and bytes in use, the
+// maximum number of bytes in use (the "high-water mark"), and the cumulative
+// number of allocations, deallocations, and bytes allocated.  A snapshot of
+// the statistics can be loaded into a 'bslma::CountingAllocatorStatistics'
+// object at any time, e.g., for export to a metrics system.
+//..
+//   ,------------------------.
+//  ( bslma::CountingAllocator )
+//   `------------------------'
+//                |         ctor/dtor
+//                |         resetNumBytesMax
+//                |         loadStatistics
+//                |         name
+//                |         numBlocksInUse/numBytesInUse
+//                |         numBytesMax/numBytesTotal
+//                |         numAllocations/numDeallocations
+//                V
+//        ,----------------.
+//       ( bslma::Allocator )
+//        `----------------'
+//                        allocate
+//                        deallocate
+//                        deallocateSized
+//..
+// 'bslma::TestAllocator' provides similar statistics, but is designed to
+// detect misuse in test drivers: it surrounds each block with guard bytes,
+// scribbles over allocated and deallocated memory, keeps a list of
+// outstanding blocks, serializes its operations, and aborts on error.
+// 'bslma::CountingAllocator', in contrast, is designed to be left in place in
+// production, so that the memory used by each subsystem can be attributed to
+// the allocator supplied to it.  No checking is performed.
+//
+///Cost of Counting
+///----------------
+// The number of allocations, the number of deallocations, and the cumulative
+// number of bytes allocated are each spread over 'k_NUM_SHARDS' per-processor
+// shards, each separated from the others by a cache line, and an operation
+// applies a relaxed atomic addition to the shard of the processor on which the
+// calling thread is running.  Threads on different processors therefore do
+// not contend for these counters.  The number of bytes in use, however, must
+// be exact for the high-water mark to be maintained, so it is a single atomic
+// counter (on a cache line of its own, shared only with the high-water mark)
+// updated by every allocation and deallocation; the high-water mark is written
+// only when an allocation raises it.  The padding separating the counters
+// makes a 'bslma::CountingAllocator' object about one and a half kilobytes
+// long (with 64-byte cache lines).
+//
+// The size of a block must be known when it is deallocated, and
+// 'deallocate' (unlike 'deallocateSized') is not supplied it, so each block
+// is preceded by a header, 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes
+// long (16 bytes on typical 64-bit platforms), recording its size.  The header
+// doubles the memory used by the smallest blocks (e.g., of node-based
+// containers), so a counting allocator is best supplied where blocks are
+// large, or to the allocator from which a pool obtains its chunks, rather than
+// to the pool itself.
+//
+///Thread Safety
+///-------------
+// A 'bslma::CountingAllocator' is fully thread-safe (provided that the
+// underlying allocator is).  The counters are updated independently using
+// relaxed atomic operations, and the sharded counters are summed shard by
+// shard when read, so a value read while other threads are allocating need
+// not be the value of the counter at any single instant, and a snapshot need
+// not be consistent across counters (e.g., 'numBytesInUse' may momentarily
+// reflect an allocation that 'numAllocations' does not yet reflect).  Once
+// the allocating threads have been synchronized with the reader, every
+// counter is exact.  The high-water mark is maintained exactly: it is the
+// greatest value 'numBytesInUse' has taken since construction (or since the
+// last call to 'resetNumBytesMax').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Exporting the Memory Use of Subsystems
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an application comprises two subsystems, each supplied its own
+// allocator, and that we want to periodically publish the memory use of each
+// subsystem.  First, we create a counting allocator for each subsystem, each
+// forwarding to the default allocator:
+//..
+//  bslma::CountingAllocator cacheAllocator("cache");
+//  bslma::CountingAllocator sessionAllocator("sessions");
+//..
+// Next, we simulate the activity of the subsystems:
+//..
+//  void *entry1  = cacheAllocator.allocate(1000);
+//  void *entry2  = cacheAllocator.allocate(3000);
+//  void *session = sessionAllocator.allocate(200);
+//
+//  cacheAllocator.deallocate(entry1);
+//..
+// Then, when it is time to publish the metrics, we take a snapshot of the
+// statistics of each allocator:
+//..
+//  bslma::CountingAllocatorStatistics cacheStats;
+//  cacheAllocator.loadStatistics(&cacheStats);
+//
+//  assert(1    == cacheStats.d_numBlocksInUse);
+//  assert(3000 == cacheStats.d_numBytesInUse);
+//  assert(4000 == cacheStats.d_numBytesMax);
+//  assert(4000 == cacheStats.d_numBytesTotal);
+//  assert(2    == cacheStats.d_numAllocations);
+//  assert(1    == cacheStats.d_numDeallocations);
+//
+//  bslma::CountingAllocatorStatistics sessionStats;
+//  sessionAllocator.loadStatistics(&sessionStats);
+//
+//  assert(200 == sessionStats.d_numBytesInUse);
+//..
+// Now, having published the high-water mark for this period, we reset it so
+// that the next snapshot reports the peak of the next period:
+//..
+//  cacheAllocator.resetNumBytesMax();
+//  assert(3000 == cacheAllocator.numBytesMax());
+//..
+// Finally, we release the remaining memory:
+//..
+//  cacheAllocator.deallocate(entry2);
+//  sessionAllocator.deallocate(session);
+//
+//  assert(0 == cacheAllocator.numBytesInUse());
+//  assert(0 == sessionAllocator.numBytesInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                     // ==================================
+                     // struct CountingAllocatorStatistics
+                     // ==================================
+
+struct CountingAllocatorStatistics {
+    // This 'struct' provides a snapshot of the statistics maintained by a
+    // 'CountingAllocator'.
+
+    // PUBLIC DATA
+    bsls::Types::Int64 d_numAllocations;    // number of (non-empty) blocks
+                                            // allocated
+
+    bsls::Types::Int64 d_numDeallocations;  // number of (non-null) blocks
+                                            // deallocated
+
+    bsls::Types::Int64 d_numBlocksInUse;    // number of blocks in use
+
+    bsls::Types::Int64 d_numBytesInUse;     // number of bytes in use
+
+    bsls::Types::Int64 d_numBytesMax;       // maximum number of bytes in use
+
+    bsls::Types::Int64 d_numBytesTotal;     // cumulative number of bytes
+                                            // allocated
+};
+
+                    // ===================================
+                    // struct CountingAllocator_ExactCounts
+                    // ===================================
+
+struct CountingAllocator_ExactCounts {
+    // This 'struct' holds the counters of a 'CountingAllocator' that must be
+    // exact at every instant, surrounded by cache lines of padding so that
+    // they share no cache line with any other object, and is for use only by
+    // 'CountingAllocator'.  Note that the counters are padded, rather than
+    // aligned on a cache line, so that a 'CountingAllocator' requires no
+    // extended alignment (which 'operator new' does not provide before
+    // C++17).
+
+    // PUBLIC DATA
+    char              d_leadingPad[bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE];
+                                          // separates the counters from the
+                                          // preceding object
+
+    bsls::AtomicInt64 d_numBytesInUse;    // number of bytes in use
+
+    bsls::AtomicInt64 d_numBytesMax;      // maximum number of bytes in use
+
+    char              d_trailingPad[bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE];
+                                          // separates the counters from the
+                                          // following object
+};
+
+                       // =============================
+                       // struct CountingAllocator_Shard
+                       // =============================
+
+struct CountingAllocator_Shard {
+    // This 'struct' holds one shard of the counters of a 'CountingAllocator'
+    // that need not be exact while updates are in progress, followed by a
+    // cache line of padding so that consecutive shards in an array, and the
+    // last shard and the following object, share no cache line, and is for
+    // use only by 'CountingAllocator'.
+
+    // PUBLIC DATA
+    bsls::AtomicInt64 d_numAllocations;    // number of blocks allocated
+
+    bsls::AtomicInt64 d_numDeallocations;  // number of blocks deallocated
+
+    bsls::AtomicInt64 d_numBytesTotal;     // cumulative number of bytes
+                                           // allocated
+
+    char              d_pad[bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE];
+                                           // separates the counters from the
+                                           // following object
+};
+
+                         // =======================
+                         // class CountingAllocator
+                         // =======================
+
+class CountingAllocator : public Allocator {
+    // This class defines a concrete, thread-safe allocator mechanism that
+    // implements the 'Allocator' protocol by forwarding to an underlying
+    // allocator, and that maintains counts of the blocks and bytes allocated
+    // and in use.
+
+  public:
+    // TYPES
+    enum {
+        k_NUM_SHARDS = 16  // number of shards of the sharded counters; the
+                           // shard updated by a thread is chosen by its
+                           // processor, modulo this value
+    };
+
+  private:
+    // DATA
+    const char                    *d_name_p;       // name of this allocator
+                                                   // (or 0)
+
+    Allocator                     *d_allocator_p;  // underlying allocator
+                                                   // (held, not owned)
+
+    CountingAllocator_ExactCounts  d_exact;        // bytes in use and
+                                                   // high-water mark
+
+    CountingAllocator_Shard        d_shards[k_NUM_SHARDS];
+                                                   // sharded counters
+
+    // NOT IMPLEMENTED
+    CountingAllocator(const CountingAllocator&);
+    CountingAllocator& operator=(const CountingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    CountingAllocator_Shard& localShard();
+        // Return a reference providing modifiable access to the shard
+        // associated with the processor on which the calling thread is
+        // running.
+
+    void *releaseBlock(void *address);
+        // Update the statistics of this allocator to reflect the deallocation
+        // of the block at the specified 'address', and return the address of
+        // the underlying block (i.e., of its header).  The behavior is
+        // undefined unless 'address' was allocated using this allocator
+        // object and has not already been deallocated.
+
+  public:
+    // CREATORS
+    explicit
+    CountingAllocator(Allocator *basicAllocator = 0);
+    explicit
+    CountingAllocator(const char *name, Allocator *basicAllocator = 0);
+        // Create a counting allocator having no blocks in use.  Optionally
+        // specify a 'name' (having static storage duration) identifying this
+        // allocator, e.g., when exporting its statistics.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    virtual ~CountingAllocator();
+        // Destroy this allocator.  Note that the behavior of destroying an
+        // allocator while memory is allocated from it is not specified.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) obtained from the underlying allocator,
+        // and update the statistics of this allocator.  If 'size' is 0, a null
+        // pointer is returned with no other effect.  The behavior is undefined
+        // unless '0 <= size'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator, and update the statistics of this allocator.
+        // If 'address' is 0, this function has no effect.  The behavior is
+        // undefined unless 'address' was allocated using this allocator object
+        // and has not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to the underlying allocator
+        // (supplying it the size of the block including its header), and
+        // update the statistics of this allocator.  If 'address' is 0, this
+        // function has no effect.  The behavior is undefined unless 'address'
+        // was allocated using this allocator object with a request for 'size'
+        // bytes, and has not already been deallocated.
+
+    void resetNumBytesMax();
+        // Set the maximum number of bytes in use reported by this allocator
+        // to the number of bytes currently in use.  Note that this method is
+        // typically called after exporting the statistics of this allocator,
+        // so that the next export reports the peak use of the next period.
+
+    // ACCESSORS
+    void loadStatistics(CountingAllocatorStatistics *result) const;
+        // Load into the specified 'result' a snapshot of the statistics of
+        // this allocator.
+
+    const char *name() const;
+        // Return the name of this allocator, or 0 if no name was specified at
+        // construction.
+
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of (non-empty) blocks allocated from this
+        // allocator.
+
+    bsls::Types::Int64 numBlocksInUse() const;
+        // Return the number of blocks currently allocated from this allocator.
+
+    bsls::Types::Int64 numBytesInUse() const;
+        // Return the number of bytes currently allocated from this allocator.
+
+    bsls::Types::Int64 numBytesMax() const;
+        // Return the maximum number of bytes in use by this allocator since
+        // its construction or the last call to 'resetNumBytesMax'.
+
+    bsls::Types::Int64 numBytesTotal() const;
+        // Return the cumulative number of bytes allocated from this
+        // allocator.
+
+    bsls::Types::Int64 numDeallocations() const;
+        // Return the number of (non-null) blocks deallocated to this
+        // allocator.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -----------------------
+                         // class CountingAllocator
+                         // -----------------------
+
+// ACCESSORS
+inline
+const char *CountingAllocator::name() const
+{
+    return d_name_p;
+}
+
+inline
+bsls::Types::Int64 CountingAllocator::numBlocksInUse() const
+{
+    return numAllocations() - numDeallocations();
+}
+
+inline
+bsls::Types::Int64 CountingAllocator::numBytesInUse() const
+{
+    return d_exact.d_numBytesInUse.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 CountingAllocator::numBytesMax() const
+{
+    return d_exact.d_numBytesMax.loadRelaxed();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
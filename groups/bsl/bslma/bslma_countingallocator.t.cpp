@@ -0,0 +1,682 @@
+// bslma_countingallocator.t.cpp                                      -*-C++-*-
+
+#include <bslma_countingallocator.h>
+
+#include <bslma_allocator.h>                    // for testing only
+#include <bslma_default.h>                      // for testing only
+#include <bslma_defaultallocatorguard.h>        // for testing only
+#include <bslma_testallocator.h>                // for testing only
+
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe allocator adaptor that forwards to
+// an underlying allocator and maintains counters.  We use a
+// 'bslma::TestAllocator' as the underlying allocator to verify that every
+// block is returned to it (with the correct size, when deallocated with
+// 'deallocateSized'), and verify the counters after each operation against
+// values computed by the test driver.  Finally, we verify that the counters
+// remain exact when several threads allocate concurrently.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] CountingAllocator(Allocator *basicAllocator = 0);
+// [ 2] CountingAllocator(const char *name, Allocator *basicAllocator = 0);
+// [ 2] ~CountingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void deallocateSized(void *address, size_type size);
+// [ 4] void resetNumBytesMax();
+//
+// ACCESSORS
+// [ 5] void loadStatistics(CountingAllocatorStatistics *result) const;
+// [ 2] const char *name() const;
+// [ 3] Int64 numAllocations() const;
+// [ 3] Int64 numBlocksInUse() const;
+// [ 3] Int64 numBytesInUse() const;
+// [ 4] Int64 numBytesMax() const;
+// [ 3] Int64 numBytesTotal() const;
+// [ 3] Int64 numDeallocations() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENT ALLOCATION
+// [ 7] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::CountingAllocator           Obj;
+typedef bslma::CountingAllocatorStatistics Stats;
+typedef bsls::Types::Int64                 Int64;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+enum {
+    k_NUM_ITERATIONS = 20000,  // allocations made by each thread
+    k_NUM_HELD       = 8       // blocks held by each thread at a time
+};
+
+extern "C" void *allocatingThread(void *arg)
+    // Repeatedly allocate blocks of sizes 1 to 'k_NUM_HELD' from the counting
+    // allocator at the specified 'arg', holding at most 'k_NUM_HELD' of them
+    // at a time, deallocating every other block with 'deallocateSized', and
+    // finally deallocate every block still held.
+{
+    Obj *allocator = static_cast<Obj *>(arg);
+
+    void *blocks[k_NUM_HELD] = { 0 };
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const int slot = i % k_NUM_HELD;
+        if (blocks[slot]) {
+            if (i % 2) {
+                allocator->deallocateSized(blocks[slot], slot + 1);
+            }
+            else {
+                allocator->deallocate(blocks[slot]);
+            }
+        }
+        blocks[slot] = allocator->allocate(slot + 1);
+    }
+    for (int slot = 0; slot < k_NUM_HELD; ++slot) {
+        allocator->deallocate(blocks[slot]);
+    }
+    return arg;
+}
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Exporting the Memory Use of Subsystems
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that an application comprises two subsystems, each supplied its own
+// allocator, and that we want to periodically publish the memory use of each
+// subsystem.  First, we create a counting allocator for each subsystem, each
+// forwarding to the default allocator:
+//..
+    bslma::CountingAllocator cacheAllocator("cache");
+    bslma::CountingAllocator sessionAllocator("sessions");
+//..
+// Next, we simulate the activity of the subsystems:
+//..
+    void *entry1  = cacheAllocator.allocate(1000);
+    void *entry2  = cacheAllocator.allocate(3000);
+    void *session = sessionAllocator.allocate(200);
+
+    cacheAllocator.deallocate(entry1);
+//..
+// Then, when it is time to publish the metrics, we take a snapshot of the
+// statistics of each allocator:
+//..
+    bslma::CountingAllocatorStatistics cacheStats;
+    cacheAllocator.loadStatistics(&cacheStats);
+
+    ASSERT(1    == cacheStats.d_numBlocksInUse);
+    ASSERT(3000 == cacheStats.d_numBytesInUse);
+    ASSERT(4000 == cacheStats.d_numBytesMax);
+    ASSERT(4000 == cacheStats.d_numBytesTotal);
+    ASSERT(2    == cacheStats.d_numAllocations);
+    ASSERT(1    == cacheStats.d_numDeallocations);
+
+    bslma::CountingAllocatorStatistics sessionStats;
+    sessionAllocator.loadStatistics(&sessionStats);
+
+    ASSERT(200 == sessionStats.d_numBytesInUse);
+//..
+// Now, having published the high-water mark for this period, we reset it so
+// that the next snapshot reports the peak of the next period:
+//..
+    cacheAllocator.resetNumBytesMax();
+    ASSERT(3000 == cacheAllocator.numBytesMax());
+//..
+// Finally, we release the remaining memory:
+//..
+    cacheAllocator.deallocate(entry2);
+    sessionAllocator.deallocate(session);
+
+    ASSERT(0 == cacheAllocator.numBytesInUse());
+    ASSERT(0 == sessionAllocator.numBytesInUse());
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ALLOCATION
+        //
+        // Concerns:
+        //: 1 Once the allocating threads have been joined, every counter is
+        //:   exact, although the counters are updated concurrently (and some
+        //:   are sharded).
+        //:
+        //: 2 The high-water mark is no less than the greatest number of bytes
+        //:   held by one thread, and no more than the sum over the threads.
+        //:
+        //: 3 A 'CountingAllocator' requires no extended alignment, so that it
+        //:   can be created by 'new' and by any allocator.
+        //
+        // Plan:
+        //: 1 Have several threads repeatedly allocate and deallocate blocks,
+        //:   holding a bounded number of bytes each, join them, and verify
+        //:   the counters.  (C-1..2)
+        //:
+        //: 2 Verify that the alignment of 'CountingAllocator' is no greater
+        //:   than the maximal fundamental alignment.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT ALLOCATION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENT ALLOCATION"
+                            "\n=====================\n");
+
+        const int ALIGNMENT     = bsls::AlignmentFromType<Obj>::VALUE;
+        const int MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+        ASSERTV(ALIGNMENT, ALIGNMENT <= MAX_ALIGNMENT);
+
+        enum { k_NUM_THREADS = 4 };
+
+        const Int64 HELD = k_NUM_HELD * (k_NUM_HELD + 1) / 2;
+                                          // bytes held by one thread at most
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(&ta);  const Obj& X = mX;
+
+        my_thread_t handles[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == myCreateThread(&handles[i], &allocatingThread, &mX));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            myJoinThread(handles[i]);
+        }
+
+        const Int64 NUM_BLOCKS = k_NUM_THREADS * k_NUM_ITERATIONS;
+        const Int64 NUM_BYTES  = k_NUM_THREADS * (k_NUM_ITERATIONS
+                                                  / k_NUM_HELD * HELD);
+
+        ASSERTV(X.numAllocations(),   NUM_BLOCKS == X.numAllocations());
+        ASSERTV(X.numDeallocations(), NUM_BLOCKS == X.numDeallocations());
+        ASSERTV(X.numBlocksInUse(),   0          == X.numBlocksInUse());
+        ASSERTV(X.numBytesInUse(),    0          == X.numBytesInUse());
+        ASSERTV(X.numBytesTotal(),    NUM_BYTES  == X.numBytesTotal());
+        ASSERTV(X.numBytesMax(),      HELD       <= X.numBytesMax());
+        ASSERTV(X.numBytesMax(),
+                k_NUM_THREADS * HELD >= X.numBytesMax());
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'loadStatistics'
+        //
+        // Concerns:
+        //: 1 'loadStatistics' loads the values reported by the individual
+        //:   accessors.
+        //
+        // Plan:
+        //: 1 Perform a sequence of allocations and deallocations, and after
+        //:   each compare the loaded statistics with the accessors.  (C-1)
+        //
+        // Testing:
+        //   void loadStatistics(CountingAllocatorStatistics *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'loadStatistics'"
+                            "\n================\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(&ta);  const Obj& X = mX;
+
+        void *blocks[10];
+        for (int i = 0; i < 20; ++i) {
+            if (i < 10) {
+                blocks[i] = mX.allocate(i * 7 + 1);
+            }
+            else {
+                mX.deallocate(blocks[19 - i]);
+            }
+
+            Stats stats;
+            memset(&stats, 0xff, sizeof stats);
+            X.loadStatistics(&stats);
+
+            ASSERTV(i, X.numAllocations()   == stats.d_numAllocations);
+            ASSERTV(i, X.numDeallocations() == stats.d_numDeallocations);
+            ASSERTV(i, X.numBlocksInUse()   == stats.d_numBlocksInUse);
+            ASSERTV(i, X.numBytesInUse()    == stats.d_numBytesInUse);
+            ASSERTV(i, X.numBytesMax()      == stats.d_numBytesMax);
+            ASSERTV(i, X.numBytesTotal()    == stats.d_numBytesTotal);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // HIGH-WATER MARK
+        //
+        // Concerns:
+        //: 1 'numBytesMax' is the greatest number of bytes in use since
+        //:   construction or the last call to 'resetNumBytesMax'.
+        //:
+        //: 2 'resetNumBytesMax' sets the maximum to the number of bytes
+        //:   currently in use.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks, tracking the expected maximum,
+        //:   and reset the maximum at various points.  (C-1..2)
+        //
+        // Testing:
+        //   void resetNumBytesMax();
+        //   Int64 numBytesMax() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHIGH-WATER MARK"
+                            "\n===============\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT(0 == X.numBytesMax());
+
+        void *a = mX.allocate(100);
+        ASSERT(100 == X.numBytesMax());
+
+        void *b = mX.allocate(50);
+        ASSERT(150 == X.numBytesMax());
+
+        mX.deallocate(a);
+        ASSERT(50  == X.numBytesInUse());
+        ASSERT(150 == X.numBytesMax());
+
+        void *c = mX.allocate(80);
+        ASSERT(130 == X.numBytesInUse());
+        ASSERT(150 == X.numBytesMax());
+
+        mX.resetNumBytesMax();
+        ASSERT(130 == X.numBytesMax());
+
+        mX.deallocate(c);
+        ASSERT(130 == X.numBytesMax());
+
+        mX.resetNumBytesMax();
+        ASSERT(50 == X.numBytesMax());
+
+        void *d = mX.allocate(10);
+        ASSERT(60 == X.numBytesMax());
+
+        mX.deallocate(b);
+        mX.deallocate(d);
+        ASSERT(0  == X.numBytesInUse());
+        ASSERT(60 == X.numBytesMax());
+
+        mX.resetNumBytesMax();
+        ASSERT(0 == X.numBytesMax());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally-aligned, writable memory obtained
+        //:   from the underlying allocator, and updates the counters.
+        //:
+        //: 2 'deallocate' and 'deallocateSized' return the block to the
+        //:   underlying allocator (the latter with the correct size) and
+        //:   update the counters.
+        //:
+        //: 3 Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, verifying their alignment and
+        //:   the counters after each allocation.  Deallocate the blocks,
+        //:   alternating between 'deallocate' and 'deallocateSized', and
+        //:   verify the counters after each deallocation.  (C-1..3)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   void deallocateSized(void *address, size_type size);
+        //   Int64 numAllocations() const;
+        //   Int64 numBlocksInUse() const;
+        //   Int64 numBytesInUse() const;
+        //   Int64 numBytesTotal() const;
+        //   Int64 numDeallocations() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nALLOCATE AND DEALLOCATE"
+                            "\n=======================\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(&ta);  const Obj& X = mX;
+
+        if (verbose) printf("\nAllocating and deallocating 0 bytes.\n");
+        {
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            mX.deallocateSized(0, 0);
+
+            ASSERT(0 == X.numAllocations());
+            ASSERT(0 == X.numDeallocations());
+            ASSERT(0 == X.numBytesTotal());
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+
+        static const int SIZES[] = { 1, 2, 3, 7, 8, 9, 15, 16, 17, 100, 4096 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        void  *blocks[NUM_SIZES];
+        Int64  total = 0;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            blocks[i] = mX.allocate(SIZE);
+            total += SIZE;
+
+            ASSERTV(i, 0 == (reinterpret_cast<bsls::Types::UintPtr>(blocks[i])
+                             % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+            memset(blocks[i], 0xA5, SIZE);
+
+            ASSERTV(i, i + 1 == X.numAllocations());
+            ASSERTV(i, 0     == X.numDeallocations());
+            ASSERTV(i, i + 1 == X.numBlocksInUse());
+            ASSERTV(i, total == X.numBytesInUse());
+            ASSERTV(i, total == X.numBytesTotal());
+            ASSERTV(i, total == X.numBytesMax());
+            ASSERTV(i, i + 1 == ta.numBlocksInUse());
+        }
+
+        Int64 inUse = total;
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            if (i % 2) {
+                mX.deallocateSized(blocks[i], SIZE);
+            }
+            else {
+                mX.deallocate(blocks[i]);
+            }
+            inUse -= SIZE;
+
+            ASSERTV(i, NUM_SIZES         == X.numAllocations());
+            ASSERTV(i, i + 1             == X.numDeallocations());
+            ASSERTV(i, NUM_SIZES - i - 1 == X.numBlocksInUse());
+            ASSERTV(i, inUse             == X.numBytesInUse());
+            ASSERTV(i, total             == X.numBytesTotal());
+            ASSERTV(i, total             == X.numBytesMax());
+            ASSERTV(i, NUM_SIZES - i - 1 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numMismatches());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 Each constructor sets the name as specified, or to 0.
+        //:
+        //: 2 If an allocator is not supplied, the default allocator is used.
+        //:
+        //: 3 A newly created object has all counters 0.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, while a test allocator is installed as the default,
+        //:   and verify the accessors and the source of allocated memory.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   CountingAllocator(Allocator *basicAllocator = 0);
+        //   CountingAllocator(const char *name, Allocator *basicAllocator = 0);
+        //   ~CountingAllocator();
+        //   const char *name() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS"
+                            "\n============\n");
+
+        bslma::TestAllocator da(veryVerbose);
+        bslma::TestAllocator oa(veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            Obj                  *objPtr = 0;
+            bslma::TestAllocator *expAllocator = &da;
+            const char           *expName = 0;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new Obj();
+              } break;
+              case 'b': {
+                objPtr = new Obj(&oa);
+                expAllocator = &oa;
+              } break;
+              case 'c': {
+                objPtr = new Obj("name");
+                expName = "name";
+              } break;
+              case 'd': {
+                objPtr = new Obj("other", &oa);
+                expAllocator = &oa;
+                expName = "other";
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            ASSERTV(CONFIG, (0 == expName && 0 == X.name())
+                         || (expName && 0 == strcmp(expName, X.name())));
+            ASSERTV(CONFIG, 0 == X.numAllocations());
+            ASSERTV(CONFIG, 0 == X.numDeallocations());
+            ASSERTV(CONFIG, 0 == X.numBlocksInUse());
+            ASSERTV(CONFIG, 0 == X.numBytesInUse());
+            ASSERTV(CONFIG, 0 == X.numBytesMax());
+            ASSERTV(CONFIG, 0 == X.numBytesTotal());
+
+            const Int64 numBlocks = expAllocator->numBlocksTotal();
+
+            void *p = mX.allocate(8);
+            ASSERTV(CONFIG, numBlocks + 1 == expAllocator->numBlocksTotal());
+            mX.deallocate(p);
+            ASSERTV(CONFIG, 0 == expAllocator->numBlocksInUse());
+
+            delete objPtr;
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            void *p = mX.allocate(100);
+            void *q = mX.allocate(20);
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(2   == X.numBlocksInUse());
+            ASSERT(120 == X.numBytesInUse());
+            ASSERT(2   == ta.numBlocksInUse());
+
+            mX.deallocate(p);
+            ASSERT(1   == X.numBlocksInUse());
+            ASSERT(20  == X.numBytesInUse());
+            ASSERT(120 == X.numBytesMax());
+            ASSERT(120 == X.numBytesTotal());
+
+            mX.deallocate(q);
+            ASSERT(0 == X.numBlocksInUse());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
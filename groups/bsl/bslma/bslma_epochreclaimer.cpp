@@ -0,0 +1,450 @@
+// bslma_epochreclaimer.cpp                                           -*-C++-*-
+#include <bslma_epochreclaimer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentfromtype.h>
+
+#include <new>
+
+namespace BloombergLP {
+
+namespace bslma {
+
+namespace {
+
+typedef bsls::AtomicOperations                 AtomicOps;
+typedef bsls::CacheLinePadded<EpochReclaimer_Record>
+                                               PaddedRecord;
+
+enum {
+    k_RECORD_ALIGNMENT = bsls::AlignmentFromType<PaddedRecord>::VALUE
+};
+
+}  // close unnamed namespace
+
+                        // =============================
+                        // struct EpochReclaimer_Retired
+                        // =============================
+
+struct EpochReclaimer_Retired {
+    // This 'struct' describes a retired block, and how to reclaim it.
+
+    void                         *d_address_p;    // retired block
+    Allocator                    *d_allocator_p;  // allocator of the block
+    EpochReclaimer_Util::Deleter  d_deleter;      // destroys the object at
+                                                  // 'd_address_p', or 0 if
+                                                  // the block is raw memory
+};
+
+                         // ===========================
+                         // struct EpochReclaimer_Batch
+                         // ===========================
+
+struct EpochReclaimer_Batch {
+    // This 'struct' holds a batch of blocks retired by one participant.  The
+    // batch may be reclaimed once the global epoch has advanced by two from
+    // 'd_epoch', the global epoch observed when the batch was sealed (i.e.,
+    // after every block in the batch was retired).
+
+    EpochReclaimer_Batch   *d_next_p;      // next batch in a list
+    bsls::Types::Int64      d_epoch;       // epoch when sealed
+    int                     d_numRetired;  // number of entries used
+    EpochReclaimer_Retired  d_retired[EpochReclaimer::k_BATCH_SIZE];
+                                           // retired blocks
+};
+
+namespace {
+
+                            // ====================
+                            // Local Free Functions
+                            // ====================
+
+inline
+EpochReclaimer_Batch *toBatch(const void *address)
+    // Return the specified 'address' of a batch as a pointer providing
+    // modifiable access to the batch.
+{
+    return static_cast<EpochReclaimer_Batch *>(const_cast<void *>(address));
+}
+
+inline
+EpochReclaimer_Record *toRecord(const void *address)
+    // Return the specified 'address' of a record as a pointer providing
+    // modifiable access to the record.
+{
+    return static_cast<EpochReclaimer_Record *>(const_cast<void *>(address));
+}
+
+bool isReclaimable(const EpochReclaimer_Batch *batch,
+                   bsls::Types::Int64          epoch)
+    // Return 'true' if the specified 'batch' can be reclaimed given the
+    // specified global 'epoch', and 'false' otherwise.  Every participant
+    // that could reach a block of 'batch' when it was sealed had announced an
+    // epoch no later than 'batch->d_epoch'; the global epoch advances past
+    // 'e + 1' only once no participant remains at 'e'.
+{
+    return batch->d_epoch + 2 <= epoch;
+}
+
+int reclaimBlocks(EpochReclaimer_Batch *batch)
+    // Reclaim the blocks of the specified 'batch', leave 'batch' empty, and
+    // return the number of blocks reclaimed.
+{
+    const int numRetired = batch->d_numRetired;
+    for (int i = 0; i < numRetired; ++i) {
+        const EpochReclaimer_Retired& retired = batch->d_retired[i];
+        if (retired.d_deleter) {
+            retired.d_deleter(retired.d_address_p, retired.d_allocator_p);
+        }
+        else {
+            retired.d_allocator_p->deallocate(retired.d_address_p);
+        }
+    }
+    batch->d_numRetired = 0;
+    return numRetired;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // class EpochReclaimer
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+EpochReclaimer_Record *EpochReclaimer::acquireRecord()
+{
+    EpochReclaimer_Record *head = toRecord(
+                                        AtomicOps::getPtrAcquire(&d_records));
+
+    for (EpochReclaimer_Record *record = head; record;
+                                               record = record->d_next_p) {
+        if (0 == AtomicOps::getIntRelaxed(&record->d_inUse)
+         && 0 == AtomicOps::testAndSwapIntAcqRel(&record->d_inUse, 0, 1)) {
+            return record;                                            // RETURN
+        }
+    }
+
+    void *storage = d_allocator_p->allocateAligned(sizeof(PaddedRecord),
+                                                   k_RECORD_ALIGNMENT);
+    EpochReclaimer_Record *record = &(new (storage) PaddedRecord())->object();
+    AtomicOps::initInt64(&record->d_state, 0);
+    AtomicOps::initInt(&record->d_inUse, 1);
+
+    // Records are never removed from the list, so only 'head' can change
+    // concurrently.
+
+    do {
+        record->d_next_p = head;
+        EpochReclaimer_Record *previous = head;
+        head = static_cast<EpochReclaimer_Record *>(
+                     AtomicOps::testAndSwapPtrAcqRel(&d_records,
+                                                     previous,
+                                                     record));
+        if (head == previous) {
+            break;
+        }
+    } while (true);
+
+    return record;
+}
+
+void EpochReclaimer::addOrphans(EpochReclaimer_Batch *batches)
+{
+    BSLS_ASSERT(batches);
+
+    EpochReclaimer_Batch *tail = batches;
+    while (tail->d_next_p) {
+        tail = tail->d_next_p;
+    }
+
+    d_orphansLock.lock();
+    tail->d_next_p = toBatch(AtomicOps::getPtrRelaxed(&d_orphans));
+    AtomicOps::setPtrRelaxed(&d_orphans, batches);
+    d_orphansLock.unlock();
+}
+
+EpochReclaimer_Batch *EpochReclaimer::takeOrphans()
+{
+    // Avoid touching the lock in the common case that there are no orphans;
+    // a stale answer merely defers their reclamation.
+
+    if (0 == AtomicOps::getPtrRelaxed(&d_orphans)
+     || 0 != d_orphansLock.tryLock()) {
+        return 0;                                                     // RETURN
+    }
+
+    EpochReclaimer_Batch *batches =
+                                 toBatch(AtomicOps::getPtrRelaxed(&d_orphans));
+    AtomicOps::setPtrRelaxed(&d_orphans, 0);
+    d_orphansLock.unlock();
+
+    return batches;
+}
+
+// CREATORS
+EpochReclaimer::EpochReclaimer(Allocator *basicAllocator)
+: d_allocator_p(Default::allocator(basicAllocator))
+{
+    AtomicOps::initInt64(&d_epoch.object(), 0);
+    AtomicOps::initPointer(&d_records, 0);
+    AtomicOps::initPointer(&d_orphans, 0);
+    d_orphansLock.initialize();
+}
+
+EpochReclaimer::~EpochReclaimer()
+{
+    BSLS_ASSERT(0 == numParticipants());
+
+    // No participant remains, so every retired block is unreachable.
+
+    EpochReclaimer_Batch *batch = toBatch(AtomicOps::getPtr(&d_orphans));
+    while (batch) {
+        EpochReclaimer_Batch *next = batch->d_next_p;
+        reclaimBlocks(batch);
+        d_allocator_p->deallocate(batch);
+        batch = next;
+    }
+
+    EpochReclaimer_Record *record = toRecord(AtomicOps::getPtr(&d_records));
+    while (record) {
+        EpochReclaimer_Record *next = record->d_next_p;
+
+        // A record is held at the start of its 'PaddedRecord'.
+
+        PaddedRecord *padded = reinterpret_cast<PaddedRecord *>(record);
+        padded->~PaddedRecord();
+        d_allocator_p->deallocateAligned(padded,
+                                         sizeof(PaddedRecord),
+                                         k_RECORD_ALIGNMENT);
+        record = next;
+    }
+}
+
+// MANIPULATORS
+bsls::Types::Int64 EpochReclaimer::advanceEpoch()
+{
+    const bsls::Types::Int64 epoch = AtomicOps::getInt64(&d_epoch.object());
+
+    for (const EpochReclaimer_Record *record =
+                                toRecord(AtomicOps::getPtrAcquire(&d_records));
+         record;
+         record = record->d_next_p) {
+        const bsls::Types::Int64 state = AtomicOps::getInt64(&record->d_state);
+        if ((state & 1) && (state >> 1) != epoch) {
+            return epoch;                                             // RETURN
+        }
+    }
+
+    const bsls::Types::Int64 previous = AtomicOps::testAndSwapInt64(
+                                                            &d_epoch.object(),
+                                                            epoch,
+                                                            epoch + 1);
+
+    return previous == epoch ? epoch + 1 : previous;
+}
+
+// ACCESSORS
+int EpochReclaimer::numParticipants() const
+{
+    int result = 0;
+    for (const EpochReclaimer_Record *record =
+                                toRecord(AtomicOps::getPtrAcquire(&d_records));
+         record;
+         record = record->d_next_p) {
+        result += AtomicOps::getIntAcquire(&record->d_inUse);
+    }
+    return result;
+}
+
+                           // ----------------------
+                           // class EpochParticipant
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+EpochReclaimer_Batch *EpochParticipant::acquireBatch()
+{
+    EpochReclaimer_Batch *batch = d_spare_p;
+    if (batch) {
+        d_spare_p = 0;
+    }
+    else {
+        batch = static_cast<EpochReclaimer_Batch *>(
+                 d_reclaimer_p->d_allocator_p->allocate(
+                                               sizeof(EpochReclaimer_Batch)));
+    }
+    batch->d_next_p     = 0;
+    batch->d_epoch      = 0;
+    batch->d_numRetired = 0;
+    return batch;
+}
+
+void EpochParticipant::recycleBatch(EpochReclaimer_Batch *batch)
+{
+    reclaimBlocks(batch);
+    if (d_spare_p) {
+        d_reclaimer_p->d_allocator_p->deallocate(batch);
+    }
+    else {
+        d_spare_p = batch;
+    }
+}
+
+void EpochParticipant::retireImp(void                         *address,
+                                 Allocator                    *allocator,
+                                 EpochReclaimer_Util::Deleter  deleter)
+{
+    BSLS_ASSERT(address);
+
+    if (d_current_p
+     && EpochReclaimer::k_BATCH_SIZE == d_current_p->d_numRetired) {
+        reclaim();
+    }
+    if (!d_current_p) {
+        d_current_p = acquireBatch();
+    }
+
+    EpochReclaimer_Batch&   batch   = *d_current_p;
+    EpochReclaimer_Retired& retired = batch.d_retired[batch.d_numRetired];
+    retired.d_address_p   = address;
+    retired.d_allocator_p = allocator;
+    retired.d_deleter     = deleter;
+    ++batch.d_numRetired;
+    ++d_numPending;
+}
+
+void EpochParticipant::sealCurrent()
+{
+    if (!d_current_p || 0 == d_current_p->d_numRetired) {
+        return;                                                       // RETURN
+    }
+
+    // Every block of the batch was unlinked before this (sequentially
+    // consistent) load, so a participant that can still reach one entered
+    // its critical section no later than the epoch read here.  Reading the
+    // epoch once per batch, rather than once per block, amortizes the cost of
+    // the barrier.
+
+    d_current_p->d_epoch = AtomicOps::getInt64(
+                                           &d_reclaimer_p->d_epoch.object());
+
+    if (d_sealedTail_p) {
+        d_sealedTail_p->d_next_p = d_current_p;
+    }
+    else {
+        d_sealedHead_p = d_current_p;
+    }
+    d_sealedTail_p = d_current_p;
+    d_current_p    = 0;
+}
+
+// CREATORS
+EpochParticipant::EpochParticipant(EpochReclaimer *reclaimer)
+: d_reclaimer_p(reclaimer)
+, d_record_p(0)
+, d_nesting(0)
+, d_current_p(0)
+, d_sealedHead_p(0)
+, d_sealedTail_p(0)
+, d_spare_p(0)
+, d_numPending(0)
+{
+    BSLS_ASSERT(reclaimer);
+
+    d_record_p = d_reclaimer_p->acquireRecord();
+}
+
+EpochParticipant::~EpochParticipant()
+{
+    BSLS_ASSERT(0 == d_nesting);
+
+    reclaim();
+
+    Allocator *allocator = d_reclaimer_p->d_allocator_p;
+
+    if (d_sealedHead_p) {
+        d_reclaimer_p->addOrphans(d_sealedHead_p);
+    }
+    if (d_current_p) {
+        allocator->deallocate(d_current_p);
+    }
+    if (d_spare_p) {
+        allocator->deallocate(d_spare_p);
+    }
+
+    AtomicOps::setIntRelease(&d_record_p->d_inUse, 0);
+}
+
+// MANIPULATORS
+bsls::Types::Int64 EpochParticipant::reclaim()
+{
+    sealCurrent();
+
+    const bsls::Types::Int64 epoch = d_reclaimer_p->advanceEpoch();
+
+    // Batches are sealed in order of retirement, so their epochs are
+    // non-decreasing.
+
+    bsls::Types::Int64 numReclaimed = 0;
+    while (d_sealedHead_p && isReclaimable(d_sealedHead_p, epoch)) {
+        EpochReclaimer_Batch *batch = d_sealedHead_p;
+        d_sealedHead_p = batch->d_next_p;
+        numReclaimed += batch->d_numRetired;
+        recycleBatch(batch);
+    }
+    if (!d_sealedHead_p) {
+        d_sealedTail_p = 0;
+    }
+    d_numPending -= numReclaimed;
+
+    // Help reclaim the batches of departed participants, returning those
+    // that are not yet reclaimable.
+
+    EpochReclaimer_Batch *orphans = d_reclaimer_p->takeOrphans();
+    EpochReclaimer_Batch *remaining = 0;
+    while (orphans) {
+        EpochReclaimer_Batch *batch = orphans;
+        orphans = batch->d_next_p;
+        if (isReclaimable(batch, epoch)) {
+            recycleBatch(batch);
+        }
+        else {
+            batch->d_next_p = remaining;
+            remaining       = batch;
+        }
+    }
+    if (remaining) {
+        d_reclaimer_p->addOrphans(remaining);
+    }
+
+    return numReclaimed;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,725 @@
+// bslma_epochreclaimer.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLMA_EPOCHRECLAIMER
+#define INCLUDED_BSLMA_EPOCHRECLAIMER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based reclamation of memory shared by lock-free code.
+//
+//@CLASSES:
+//  bslma::EpochReclaimer: domain within which retired memory is reclaimed
+//  bslma::EpochParticipant: per-thread registration with a reclaimer
+//  bslma::EpochGuard: scoped guard for a participant's critical section
+//
+//@SEE_ALSO: bslma_allocator, bslma_deleterhelper, bsls_atomicoperations
+//
+//@DESCRIPTION: This component provides a mechanism for the safe, deferred
+// deallocation of memory in concurrent data structures that readers traverse
+// without locks (e.g., lock-free stacks, queues, and maps built on
+// 'bsls::AtomicOperations').  When a thread unlinks a node from such a
+// structure, other threads may still be reading the node, so it cannot be
+// deallocated immediately; instead, it is "retired", and deallocated (or
+// "reclaimed") once no thread can still hold a reference to it.
+//
+// The scheme implemented is epoch-based reclamation.  An
+// 'bslma::EpochReclaimer' maintains a global epoch number, and each thread
+// that accesses the shared structures registers with the reclaimer by
+// creating a 'bslma::EpochParticipant'.  A thread accesses shared nodes only
+// within a *critical* *section* of its participant, delimited by 'enter' and
+// 'leave' (or by a 'bslma::EpochGuard'); on entry, the participant announces
+// the epoch it observed.  The global epoch advances only when every
+// participant within a critical section has announced the current epoch, and
+// a node retired while the global epoch was 'e' is reclaimed once the global
+// epoch reaches 'e + 2', by which time every critical section that could have
+// observed the node has ended.
+//..
+//   thread A                          thread B
+//   --------                          --------
+//   enter (epoch e)
+//   reads node 'n'                    enter (epoch e)
+//     .                               unlinks 'n'; retire(n) at epoch e
+//     .                               leave
+//   leave                              ...    (epoch advances to e + 1,
+//                                              and then to e + 2)
+//                                     'n' is reclaimed
+//..
+// Entering a critical section costs a load of the global epoch and an atomic
+// exchange on a cache line owned by the participant, and leaving costs a
+// single store to that line; no read-modify-write operation on shared data
+// is needed.  Critical sections may be nested, in which case only the outermost
+// 'enter' and 'leave' have effect.
+//
+///Batching
+///--------
+// Each participant accumulates the blocks it retires in batches of
+// 'EpochReclaimer::k_BATCH_SIZE' entries, allocated from (and recycled
+// through) the reclaimer's allocator.  When a batch is full, the participant
+// attempts to advance the global epoch (scanning the participants, but
+// without taking any lock) and reclaims those of its batches that have become
+// safe, so the cost of reclamation is amortized over the batch.  'reclaim'
+// may also be called explicitly, e.g., when a thread becomes idle.  When a
+// participant is destroyed, its remaining batches are handed to the
+// reclaimer, and reclaimed by other participants (or by the reclaimer's
+// destructor).
+//
+// A retired block is returned to the allocator specified when it is retired
+// (by default, the reclaimer's allocator), by 'deallocate'.  An object retired
+// by 'retireObject' is destroyed, and its footprint deallocated, using
+// 'bslma::DeleterHelper::deleteObject', when it is reclaimed.
+//
+///Progress
+///--------
+// A thread that remains within a critical section prevents the global epoch
+// from advancing, and therefore prevents the reclamation of every block
+// retired since it entered (though it does not prevent other threads from
+// making progress otherwise).  Critical sections should therefore be short,
+// and a thread must not block (e.g., waiting for another thread, or for I/O)
+// within one.
+//
+///Thread Safety
+///-------------
+// 'bslma::EpochReclaimer' is fully thread-safe.  A 'bslma::EpochParticipant'
+// must be used only by the thread that created it (or, more precisely, by
+// one thread at a time, with appropriate synchronization on transfer).  The
+// reclaimer must outlive its participants.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Lock-Free Stack
+/// - - - - - - - - - - - - - -
+// Suppose that we want a stack of 'int' values that several threads can push
+// onto and pop from without a lock.  In the classic Treiber stack, 'pop' reads
+// the top node, and then replaces the top with that node's successor by a
+// compare-and-swap.  Without safe reclamation, the node popped by one thread
+// might be deallocated (or worse, deallocated, reallocated, and pushed again)
+// while another thread is still reading it.
+//
+// First, we define the stack, which supplies its nodes from the allocator of
+// a reclaimer:
+//..
+//  class my_Stack {
+//      // This class implements a lock-free stack of 'int' values.
+//
+//      // PRIVATE TYPES
+//      struct Node {
+//          int   d_value;   // value
+//          Node *d_next_p;  // next node (immutable once the node is pushed)
+//      };
+//
+//      // DATA
+//      bsls::AtomicOperations::AtomicTypes::Pointer  d_top;  // top node
+//      bslma::EpochReclaimer                        *d_reclaimer_p;
+//                                                     // supplies nodes
+//
+//    public:
+//      // CREATORS
+//      explicit my_Stack(bslma::EpochReclaimer *reclaimer)
+//      : d_reclaimer_p(reclaimer)
+//      {
+//          bsls::AtomicOperations::initPointer(&d_top, 0);
+//      }
+//
+//      ~my_Stack()
+//      {
+//          Node *node = static_cast<Node *>(const_cast<void *>(
+//                                 bsls::AtomicOperations::getPtr(&d_top)));
+//          while (node) {
+//              Node *next = node->d_next_p;
+//              d_reclaimer_p->allocator()->deallocate(node);
+//              node = next;
+//          }
+//      }
+//
+//      // MANIPULATORS
+//      void push(int value)
+//      {
+//          Node *node = static_cast<Node *>(
+//                         d_reclaimer_p->allocator()->allocate(sizeof(Node)));
+//          node->d_value = value;
+//
+//          void *top = const_cast<void *>(
+//                                   bsls::AtomicOperations::getPtr(&d_top));
+//          do {
+//              node->d_next_p = static_cast<Node *>(top);
+//              void *previous = top;
+//              top = bsls::AtomicOperations::testAndSwapPtr(&d_top,
+//                                                           previous,
+//                                                           node);
+//              if (top == previous) {
+//                  break;
+//              }
+//          } while (true);
+//      }
+//
+//      int pop(int *value, bslma::EpochParticipant *participant)
+//          // Load into the specified 'value' the top value of this stack,
+//          // and remove it, using the specified 'participant' of this
+//          // stack's reclaimer.  Return 0 on success, and a non-zero value
+//          // if this stack is empty.
+//      {
+//          Node *node;
+//          {
+//              bslma::EpochGuard guard(participant);
+//
+//              node = static_cast<Node *>(const_cast<void *>(
+//                                   bsls::AtomicOperations::getPtr(&d_top)));
+//              while (node) {
+//                  // 'node' cannot be reclaimed while we are within the
+//                  // critical section, so reading 'd_next_p' is safe.
+//
+//                  void *previous = bsls::AtomicOperations::testAndSwapPtr(
+//                                                        &d_top,
+//                                                        node,
+//                                                        node->d_next_p);
+//                  if (previous == node) {
+//                      break;
+//                  }
+//                  node = static_cast<Node *>(previous);
+//              }
+//              if (!node) {
+//                  return 1;                                       // RETURN
+//              }
+//              *value = node->d_value;
+//          }
+//
+//          // 'node' is unlinked, but other threads may still be reading it.
+//
+//          participant->retire(node);
+//          return 0;
+//      }
+//  };
+//..
+// Then, we create a reclaimer, supplying memory from a test allocator, and a
+// stack:
+//..
+//  bslma::TestAllocator  ta;
+//  bslma::EpochReclaimer reclaimer(&ta);
+//  my_Stack              stack(&reclaimer);
+//..
+// Next, each thread that uses the stack registers with the reclaimer (here,
+// there is only the current thread):
+//..
+//  bslma::EpochParticipant participant(&reclaimer);
+//..
+// Now, we push and pop some values:
+//..
+//  stack.push(1);
+//  stack.push(2);
+//
+//  int value;
+//  assert(0 == stack.pop(&value, &participant));
+//  assert(2 == value);
+//  assert(0 == stack.pop(&value, &participant));
+//  assert(1 == value);
+//  assert(0 != stack.pop(&value, &participant));
+//..
+// Finally, we observe that the popped nodes are pending reclamation, and that
+// they are returned to the allocator once the epoch has advanced past them:
+//..
+//  assert(2 == participant.numPending());
+//
+//  participant.reclaim();
+//  participant.reclaim();
+//  assert(0 == participant.numPending());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DELETERHELPER
+#include <bslma_deleterhelper.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINEPADDED
+#include <bsls_cachelinepadded.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SPINLOCK
+#include <bsls_spinlock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+struct EpochReclaimer_Batch;
+
+                       // ============================
+                       // struct EpochReclaimer_Record
+                       // ============================
+
+struct EpochReclaimer_Record {
+    // [!PRIVATE!] This 'struct' holds the state of a participant that is
+    // examined by other threads.  Records are allocated on cache lines of
+    // their own, are linked into a list owned by the reclaimer, and are
+    // reused by later participants once released.
+
+    bsls::AtomicOperations::AtomicTypes::Int64  d_state;   // '2 * epoch + 1'
+                                                           // within a critical
+                                                           // section, else 0
+
+    bsls::AtomicOperations::AtomicTypes::Int    d_inUse;   // 1 if owned by a
+                                                           // participant
+
+    EpochReclaimer_Record                      *d_next_p;  // next record
+                                                           // (immutable once
+                                                           // published)
+};
+
+                         // ==========================
+                         // struct EpochReclaimer_Util
+                         // ==========================
+
+struct EpochReclaimer_Util {
+    // [!PRIVATE!] This 'struct' provides a namespace for the types and
+    // functions used to reclaim retired objects.
+
+    // TYPES
+    typedef void (*Deleter)(void *address, Allocator *allocator);
+        // Alias for a function that destroys the object at 'address' and
+        // deallocates its footprint using 'allocator'.
+
+    // CLASS METHODS
+    template <class TYPE>
+    static void deleteObject(void *address, Allocator *allocator);
+        // Destroy the object of (static) type 'TYPE' at the specified
+        // 'address', and deallocate its footprint using the specified
+        // 'allocator', by calling 'DeleterHelper::deleteObject'.
+};
+
+                            // ====================
+                            // class EpochReclaimer
+                            // ====================
+
+class EpochReclaimer {
+    // This class implements a domain for epoch-based reclamation: it holds
+    // the global epoch, the records of its participants, and the batches of
+    // retired blocks left by departed participants.  It is fully
+    // thread-safe.
+
+    // DATA
+    bsls::CacheLinePadded<bsls::AtomicOperations::AtomicTypes::Int64>
+                                          d_epoch;        // global epoch
+
+    bsls::AtomicOperations::AtomicTypes::Pointer
+                                          d_records;      // list of
+                                                          // participant
+                                                          // records
+
+    bsls::AtomicOperations::AtomicTypes::Pointer
+                                          d_orphans;      // batches left by
+                                                          // departed
+                                                          // participants
+
+    bsls::SpinLock                        d_orphansLock;  // serializes
+                                                          // updates of
+                                                          // 'd_orphans'
+
+    Allocator                            *d_allocator_p;  // memory allocator
+                                                          // (held, not owned)
+
+    // FRIENDS
+    friend class EpochParticipant;
+
+  private:
+    // NOT IMPLEMENTED
+    EpochReclaimer(const EpochReclaimer&);
+    EpochReclaimer& operator=(const EpochReclaimer&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    EpochReclaimer_Record *acquireRecord();
+        // Return the address of a record owned by the calling participant,
+        // reusing a released record if one exists, and otherwise allocating
+        // and publishing a new one.
+
+    void addOrphans(EpochReclaimer_Batch *batches);
+        // Add the specified null-terminated list of 'batches' to the batches
+        // left by departed participants.
+
+    EpochReclaimer_Batch *takeOrphans();
+        // Remove, and return the address of, the list of batches left by
+        // departed participants, or return 0 if there are none or if another
+        // thread is examining them.
+
+  public:
+    // TYPES
+    enum {
+        k_BATCH_SIZE = 64  // number of retired blocks a participant
+                           // accumulates before attempting reclamation
+    };
+
+    // CREATORS
+    explicit EpochReclaimer(Allocator *basicAllocator = 0);
+        // Create a reclaimer having no participants and an epoch of 0.
+        // Optionally specify a 'basicAllocator' used to supply memory, and to
+        // which retired blocks are returned by default.  If 'basicAllocator'
+        // is 0, the currently installed default allocator is used.
+
+    ~EpochReclaimer();
+        // Reclaim all blocks left by departed participants, and destroy this
+        // reclaimer.  The behavior is undefined unless every participant of
+        // this reclaimer has been destroyed.
+
+    // MANIPULATORS
+    bsls::Types::Int64 advanceEpoch();
+        // Advance the global epoch by one if every participant within a
+        // critical section has announced the current epoch, and return the
+        // (possibly advanced) global epoch.  Note that participants call
+        // this method as needed; calling it directly is rarely necessary.
+
+    // ACCESSORS
+    Allocator *allocator() const;
+        // Return the address of the allocator used by this reclaimer to
+        // supply memory.
+
+    bsls::Types::Int64 epoch() const;
+        // Return the current global epoch.
+
+    int numParticipants() const;
+        // Return the number of participants currently registered with this
+        // reclaimer.  Note that the value returned may be out of date by the
+        // time it is used.
+};
+
+                           // ======================
+                           // class EpochParticipant
+                           // ======================
+
+class EpochParticipant {
+    // This class implements the registration of one thread with an
+    // 'EpochReclaimer': it announces when the thread is within a critical
+    // section, and accumulates the blocks the thread retires until they can
+    // be reclaimed.  An object of this class must be used by only one thread
+    // at a time.
+
+    // DATA
+    EpochReclaimer        *d_reclaimer_p;   // reclaimer (held, not owned)
+
+    EpochReclaimer_Record *d_record_p;      // state shared with other
+                                            // threads (owned by reclaimer)
+
+    int                    d_nesting;       // depth of critical sections
+
+    EpochReclaimer_Batch  *d_current_p;     // batch being filled, or 0
+
+    EpochReclaimer_Batch  *d_sealedHead_p;  // oldest full batch, or 0
+
+    EpochReclaimer_Batch  *d_sealedTail_p;  // newest full batch, or 0
+
+    EpochReclaimer_Batch  *d_spare_p;       // empty batch kept for reuse,
+                                            // or 0
+
+    bsls::Types::Int64     d_numPending;    // number of blocks retired and
+                                            // not yet reclaimed
+
+  private:
+    // NOT IMPLEMENTED
+    EpochParticipant(const EpochParticipant&);
+    EpochParticipant& operator=(const EpochParticipant&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    EpochReclaimer_Batch *acquireBatch();
+        // Return the address of an empty batch, reusing the spare batch if
+        // there is one.
+
+    void recycleBatch(EpochReclaimer_Batch *batch);
+        // Reclaim the blocks of the specified 'batch', and keep it as the
+        // spare batch, or return it to the allocator if there already is
+        // one.
+
+    void retireImp(void                        *address,
+                   Allocator                   *allocator,
+                   EpochReclaimer_Util::Deleter deleter);
+        // Retire the specified 'address', to be reclaimed by calling the
+        // specified 'deleter' with 'address' and the specified 'allocator',
+        // or (if 'deleter' is 0) by 'allocator->deallocate(address)'.
+
+    void sealCurrent();
+        // Append the batch being filled, if it is not empty, to the list of
+        // full batches.
+
+  public:
+    // CREATORS
+    explicit EpochParticipant(EpochReclaimer *reclaimer);
+        // Create a participant of the specified 'reclaimer', outside of any
+        // critical section and having no pending blocks.
+
+    ~EpochParticipant();
+        // Reclaim the pending blocks of this participant that can be
+        // reclaimed, hand the others to the reclaimer, and destroy this
+        // participant.  The behavior is undefined if this participant is
+        // within a critical section.
+
+    // MANIPULATORS
+    void enter();
+        // Enter a critical section, within which nodes of the data structures
+        // using the reclaimer of this participant may be accessed.  Critical
+        // sections may be nested.
+
+    void leave();
+        // Leave the innermost critical section.  The behavior is undefined
+        // unless this participant is within a critical section.
+
+    void retire(void *address);
+        // Retire the block at the specified 'address', allocated from the
+        // reclaimer's allocator, which will be deallocated once no critical
+        // section that might have observed it remains.  The behavior is
+        // undefined unless 'address' is not reachable by any thread that
+        // enters a critical section after this call.  Note that this method
+        // may allocate memory (for a batch), and may reclaim blocks.
+
+    void retire(void *address, Allocator *allocator);
+        // Retire the block at the specified 'address', allocated from the
+        // specified 'allocator', which will be deallocated once no critical
+        // section that might have observed it remains.  The behavior is
+        // undefined unless 'address' is not reachable by any thread that
+        // enters a critical section after this call.
+
+    template <class TYPE>
+    void retireObject(const TYPE *object);
+    template <class TYPE>
+    void retireObject(const TYPE *object, Allocator *allocator);
+        // Retire the specified 'object', allocated from the optionally
+        // specified 'allocator' (or, by default, from the reclaimer's
+        // allocator), which will be destroyed, and its footprint deallocated,
+        // once no critical section that might have observed it remains.  The
+        // behavior is undefined unless 'object' is not reachable by any
+        // thread that enters a critical section after this call.
+
+    bsls::Types::Int64 reclaim();
+        // Attempt to advance the global epoch, reclaim the pending blocks of
+        // this participant (and any left by departed participants) that can
+        // be reclaimed, and return the number of blocks of this participant
+        // that were reclaimed.  Note that, because a block becomes
+        // reclaimable two epochs after its retirement, two calls may be
+        // needed to reclaim a block just retired, even when no other
+        // participant is within a critical section.
+
+    // ACCESSORS
+    bool isInCriticalSection() const;
+        // Return 'true' if this participant is within a critical section,
+        // and 'false' otherwise.
+
+    bsls::Types::Int64 numPending() const;
+        // Return the number of blocks retired by this participant that have
+        // not yet been reclaimed.
+
+    EpochReclaimer *reclaimer() const;
+        // Return the address of the reclaimer of this participant.
+};
+
+                              // ================
+                              // class EpochGuard
+                              // ================
+
+class EpochGuard {
+    // This class implements a guard that keeps a participant within a
+    // critical section for the lifetime of the guard.
+
+    // DATA
+    EpochParticipant *d_participant_p;  // guarded participant (held)
+
+  private:
+    // NOT IMPLEMENTED
+    EpochGuard(const EpochGuard&);
+    EpochGuard& operator=(const EpochGuard&);
+
+  public:
+    // CREATORS
+    explicit EpochGuard(EpochParticipant *participant);
+        // Create a guard that enters a critical section of the specified
+        // 'participant', and leaves it upon destruction.
+
+    ~EpochGuard();
+        // Leave the critical section entered by this guard, and destroy this
+        // guard.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // struct EpochReclaimer_Util
+                         // --------------------------
+
+// CLASS METHODS
+template <class TYPE>
+void EpochReclaimer_Util::deleteObject(void *address, Allocator *allocator)
+{
+    DeleterHelper::deleteObject(static_cast<TYPE *>(address), allocator);
+}
+
+                            // --------------------
+                            // class EpochReclaimer
+                            // --------------------
+
+// ACCESSORS
+inline
+Allocator *EpochReclaimer::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Int64 EpochReclaimer::epoch() const
+{
+    return bsls::AtomicOperations::getInt64Acquire(&d_epoch.object());
+}
+
+                           // ----------------------
+                           // class EpochParticipant
+                           // ----------------------
+
+// MANIPULATORS
+inline
+void EpochParticipant::enter()
+{
+    if (0 == d_nesting++) {
+        // Announce the observed epoch with a sequentially consistent
+        // exchange, so that no subsequent load of a shared node can be
+        // reordered before the announcement.  (An exchange is a full barrier
+        // and, on common platforms, is cheaper than a store followed by a
+        // fence.)  A stale epoch is harmless: it only delays the advance of
+        // the global epoch until this participant leaves.
+
+        const bsls::Types::Int64 epoch =
+                                bsls::AtomicOperations::getInt64Acquire(
+                                           &d_reclaimer_p->d_epoch.object());
+        bsls::AtomicOperations::swapInt64(&d_record_p->d_state,
+                                          2 * epoch + 1);
+    }
+}
+
+inline
+void EpochParticipant::leave()
+{
+    BSLS_ASSERT_SAFE(0 < d_nesting);
+
+    if (0 == --d_nesting) {
+        bsls::AtomicOperations::setInt64Release(&d_record_p->d_state, 0);
+    }
+}
+
+inline
+void EpochParticipant::retire(void *address)
+{
+    retireImp(address, d_reclaimer_p->d_allocator_p, 0);
+}
+
+inline
+void EpochParticipant::retire(void *address, Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(allocator);
+
+    retireImp(address, allocator, 0);
+}
+
+template <class TYPE>
+inline
+void EpochParticipant::retireObject(const TYPE *object)
+{
+    retireObject(object, d_reclaimer_p->d_allocator_p);
+}
+
+template <class TYPE>
+inline
+void EpochParticipant::retireObject(const TYPE *object, Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(allocator);
+
+    retireImp(static_cast<void *>(const_cast<TYPE *>(object)),
+              allocator,
+              &EpochReclaimer_Util::deleteObject<TYPE>);
+}
+
+// ACCESSORS
+inline
+bool EpochParticipant::isInCriticalSection() const
+{
+    return 0 < d_nesting;
+}
+
+inline
+bsls::Types::Int64 EpochParticipant::numPending() const
+{
+    return d_numPending;
+}
+
+inline
+EpochReclaimer *EpochParticipant::reclaimer() const
+{
+    return d_reclaimer_p;
+}
+
+                              // ----------------
+                              // class EpochGuard
+                              // ----------------
+
+// CREATORS
+inline
+EpochGuard::EpochGuard(EpochParticipant *participant)
+: d_participant_p(participant)
+{
+    BSLS_ASSERT_SAFE(participant);
+
+    d_participant_p->enter();
+}
+
+inline
+EpochGuard::~EpochGuard()
+{
+    d_participant_p->leave();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
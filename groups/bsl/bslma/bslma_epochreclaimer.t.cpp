@@ -0,0 +1,1495 @@
+// bslma_epochreclaimer.t.cpp                                         -*-C++-*-
+#include <bslma_epochreclaimer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a mechanism whose observable behavior is
+// the timing of deallocations.  Using a test allocator, we verify, on a
+// single thread, the registration (and reuse of the records) of
+// participants, the nesting of critical sections, the conditions under which
+// the global epoch advances, and that retired blocks are reclaimed neither
+// before a participant that might observe them has left its critical section
+// nor much after.  We also verify that retired objects are destroyed, that
+// blocks left by departed participants are reclaimed, and that all memory is
+// returned.  A stress test then runs a lock-free stack on several threads,
+// whose readers verify that no node they can reach has been deallocated.  A
+// negative case measures the overhead of critical sections and retirement.
+//-----------------------------------------------------------------------------
+// EpochReclaimer
+// [ 2] explicit EpochReclaimer(Allocator *basicAllocator = 0);
+// [ 2] ~EpochReclaimer();
+// [ 3] bsls::Types::Int64 advanceEpoch();
+// [ 2] Allocator *allocator() const;
+// [ 3] bsls::Types::Int64 epoch() const;
+// [ 2] int numParticipants() const;
+//
+// EpochParticipant
+// [ 2] explicit EpochParticipant(EpochReclaimer *reclaimer);
+// [ 2] ~EpochParticipant();
+// [ 3] void enter();
+// [ 3] void leave();
+// [ 4] void retire(void *address);
+// [ 4] void retire(void *address, Allocator *allocator);
+// [ 4] void retireObject(const TYPE *object);
+// [ 4] void retireObject(const TYPE *object, Allocator *allocator);
+// [ 4] bsls::Types::Int64 reclaim();
+// [ 3] bool isInCriticalSection() const;
+// [ 4] bsls::Types::Int64 numPending() const;
+// [ 2] EpochReclaimer *reclaimer() const;
+//
+// EpochGuard
+// [ 3] explicit EpochGuard(EpochParticipant *participant);
+// [ 3] ~EpochGuard();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY: LOCK-FREE STACK STRESS TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: OVERHEAD
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::EpochReclaimer   Obj;
+typedef bslma::EpochParticipant Participant;
+typedef bslma::EpochGuard       Guard;
+typedef bsls::Types::Int64      Int64;
+typedef bsls::AtomicOperations  AtomicOps;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+const int BATCH_SIZE = Obj::k_BATCH_SIZE;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static void myYield()
+    // Yield the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+                            // =================
+                            // struct ThreadTask
+                            // =================
+
+struct ThreadTask {
+    // This 'struct' describes the work of a thread: call 'd_function' with
+    // 'd_arg'.
+
+    void (*d_function)(void *);  // function to call
+    void  *d_arg;                // argument to pass
+};
+
+extern "C" void *threadEntry(void *arg)
+{
+    ThreadTask *task = static_cast<ThreadTask *>(arg);
+    task->d_function(task->d_arg);
+    return 0;
+}
+
+static void runThreads(ThreadTask *tasks, int numTasks)
+    // Run each of the specified 'numTasks' 'tasks' on a thread of its own,
+    // and wait for all of them to complete.
+{
+    my_thread_t handles[64];
+
+    ASSERT(numTasks <= 64);
+
+    for (int i = 0; i < numTasks; ++i) {
+        ASSERT(0 == myCreateThread(&handles[i], &threadEntry, &tasks[i]));
+    }
+    for (int i = 0; i < numTasks; ++i) {
+        myJoinThread(handles[i]);
+    }
+}
+
+                           // =====================
+                           // class LockedAllocator
+                           // =====================
+
+class LockedAllocator : public bslma::Allocator {
+    // This class implements an allocator that serializes the use of another
+    // (e.g., a test) allocator that is not thread-safe.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // serialized allocator (held)
+    bsls::SpinLock    d_lock;         // serializes 'd_allocator_p'
+
+  private:
+    // NOT IMPLEMENTED
+    LockedAllocator(const LockedAllocator&);
+    LockedAllocator& operator=(const LockedAllocator&);
+
+  public:
+    // CREATORS
+    explicit LockedAllocator(bslma::Allocator *allocator)
+    : d_allocator_p(allocator)
+    {
+        d_lock.initialize();
+    }
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size)
+    {
+        d_lock.lock();
+        void *result = d_allocator_p->allocate(size);
+        d_lock.unlock();
+        return result;
+    }
+
+    virtual void deallocate(void *address)
+    {
+        d_lock.lock();
+        d_allocator_p->deallocate(address);
+        d_lock.unlock();
+    }
+};
+
+                            // =================
+                            // class CountedType
+                            // =================
+
+class CountedType {
+    // This class counts the number of its objects destroyed.
+
+  public:
+    // CLASS DATA
+    static int s_numDestroyed;  // number of objects destroyed
+
+    // CREATORS
+    ~CountedType()
+    {
+        ++s_numDestroyed;
+    }
+};
+
+int CountedType::s_numDestroyed = 0;
+
+                             // =================
+                             // struct FillerBase
+                             // =================
+
+struct FillerBase {
+    // This 'struct' occupies the start of 'PolymorphicDerived', so that its
+    // 'PolymorphicBase' subobject is not at the address of the object.
+
+    int d_filler[4];  // padding
+
+    // CREATORS
+    virtual ~FillerBase()
+    {
+    }
+};
+
+struct PolymorphicBase {
+    // This 'struct' is a polymorphic base class.
+
+    // CREATORS
+    virtual ~PolymorphicBase()
+    {
+    }
+};
+
+struct PolymorphicDerived : FillerBase, PolymorphicBase {
+    // This 'struct' counts the number of its objects destroyed.
+
+    // CLASS DATA
+    static int s_numDestroyed;  // number of objects destroyed
+
+    // CREATORS
+    ~PolymorphicDerived()
+    {
+        ++s_numDestroyed;
+    }
+};
+
+int PolymorphicDerived::s_numDestroyed = 0;
+
+                              // ================
+                              // class TestStack
+                              // ================
+
+class TestStack {
+    // This class implements a lock-free (Treiber) stack of 'int' values whose
+    // nodes are reclaimed by an 'EpochReclaimer', and which verifies that
+    // every node reached by a reader has not been deallocated.
+
+    // PRIVATE TYPES
+    enum { k_MAGIC = 0x5eed1e55 };
+
+    struct Node {
+        unsigned  d_magic;   // 'k_MAGIC' while the node is allocated
+        int       d_value;   // value
+        Node     *d_next_p;  // next node (immutable once pushed)
+    };
+
+    // DATA
+    AtomicOps::AtomicTypes::Pointer  d_top;           // top node
+    bslma::Allocator                *d_allocator_p;   // supplies nodes
+    mutable bsls::AtomicInt          d_numCorrupt;    // number of
+                                                      // deallocated nodes
+                                                      // reached
+
+    // PRIVATE ACCESSORS
+    void check(const Node *node) const;
+        // Record an error if the specified 'node' has been deallocated.
+
+  private:
+    // NOT IMPLEMENTED
+    TestStack(const TestStack&);
+    TestStack& operator=(const TestStack&);
+
+  public:
+    // CREATORS
+    explicit TestStack(bslma::Allocator *allocator);
+        // Create an empty stack supplying nodes from the specified
+        // 'allocator'.
+
+    ~TestStack();
+        // Deallocate the nodes of this stack, and destroy it.
+
+    // MANIPULATORS
+    void push(int value);
+        // Push the specified 'value' onto this stack.
+
+    int pop(int *value, Participant *participant);
+        // Load into the specified 'value' the top value of this stack, remove
+        // it, retire its node using the specified 'participant', and return
+        // 0, or return a non-zero value if this stack is empty.
+
+    // ACCESSORS
+    int walk(Participant *participant) const;
+        // Within a critical section of the specified 'participant', visit
+        // every node of this stack, and return the number visited.
+
+    int numCorrupt() const;
+        // Return the number of deallocated nodes reached by readers.
+};
+
+// PRIVATE ACCESSORS
+void TestStack::check(const Node *node) const
+{
+    if (k_MAGIC != node->d_magic) {
+        d_numCorrupt.add(1);
+    }
+}
+
+// CREATORS
+TestStack::TestStack(bslma::Allocator *allocator)
+: d_allocator_p(allocator)
+, d_numCorrupt(0)
+{
+    AtomicOps::initPointer(&d_top, 0);
+}
+
+TestStack::~TestStack()
+{
+    Node *node = static_cast<Node *>(
+                               const_cast<void *>(AtomicOps::getPtr(&d_top)));
+    while (node) {
+        Node *next = node->d_next_p;
+        d_allocator_p->deallocate(node);
+        node = next;
+    }
+}
+
+// MANIPULATORS
+void TestStack::push(int value)
+{
+    Node *node = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    node->d_magic = k_MAGIC;
+    node->d_value = value;
+
+    void *top = const_cast<void *>(AtomicOps::getPtrAcquire(&d_top));
+    do {
+        node->d_next_p = static_cast<Node *>(top);
+        void *previous = top;
+        top = AtomicOps::testAndSwapPtr(&d_top, previous, node);
+        if (top == previous) {
+            break;
+        }
+    } while (true);
+}
+
+int TestStack::pop(int *value, Participant *participant)
+{
+    Node *node;
+    {
+        Guard guard(participant);
+
+        node = static_cast<Node *>(
+                        const_cast<void *>(AtomicOps::getPtrAcquire(&d_top)));
+        while (node) {
+            check(node);
+            void *previous = AtomicOps::testAndSwapPtr(&d_top,
+                                                       node,
+                                                       node->d_next_p);
+            if (previous == node) {
+                break;
+            }
+            node = static_cast<Node *>(previous);
+        }
+        if (!node) {
+            return 1;                                                 // RETURN
+        }
+        *value = node->d_value;
+    }
+
+    participant->retire(node, d_allocator_p);
+    return 0;
+}
+
+// ACCESSORS
+int TestStack::walk(Participant *participant) const
+{
+    Guard guard(participant);
+
+    int count = 0;
+    for (const Node *node = static_cast<const Node *>(
+                                             AtomicOps::getPtrAcquire(&d_top));
+         node;
+         node = node->d_next_p) {
+        check(node);
+        ++count;
+    }
+    return count;
+}
+
+int TestStack::numCorrupt() const
+{
+    return d_numCorrupt;
+}
+
+                            // ==================
+                            // struct StressArgs
+                            // ==================
+
+struct StressArgs {
+    // This 'struct' holds the arguments of a stress-test thread.
+
+    Obj             *d_reclaimer_p;    // reclaimer
+    TestStack       *d_stack_p;        // shared stack
+    int              d_id;             // thread index
+    int              d_numIterations;  // number of push/pop pairs
+    bsls::AtomicInt *d_numPopped_p;    // total number of values popped
+    bsls::AtomicInt *d_numDone_p;      // number of updating threads done
+    int              d_numUpdaters;    // number of updating threads
+};
+
+static void stressUpdater(void *arg)
+    // Repeatedly push values onto, and pop values from, the stack described
+    // by the specified 'arg', occasionally walking the stack.
+{
+    StressArgs& args = *static_cast<StressArgs *>(arg);
+
+    Participant participant(args.d_reclaimer_p);
+
+    int numPopped = 0;
+    for (int i = 0; i < args.d_numIterations; ++i) {
+        args.d_stack_p->push(args.d_id * args.d_numIterations + i);
+        int value;
+        if (0 == args.d_stack_p->pop(&value, &participant)) {
+            ++numPopped;
+        }
+        if (0 == i % 64) {
+            args.d_stack_p->walk(&participant);
+        }
+        if (0 == i % 256) {
+            myYield();
+        }
+    }
+    args.d_numPopped_p->add(numPopped);
+
+    ASSERT(participant.numPending() < 3 * BATCH_SIZE);
+
+    args.d_numDone_p->add(1);
+}
+
+static void stressReader(void *arg)
+    // Repeatedly walk the stack described by the specified 'arg' until every
+    // updating thread is done.
+{
+    StressArgs& args = *static_cast<StressArgs *>(arg);
+
+    Participant participant(args.d_reclaimer_p);
+
+    while (args.d_numDone_p->load() < args.d_numUpdaters) {
+        args.d_stack_p->walk(&participant);
+        myYield();
+    }
+}
+
+                           // =====================
+                           // class LockedStack
+                           // =====================
+
+class LockedStack {
+    // This class implements a stack of 'int' values protected by a spin lock,
+    // for comparison with 'TestStack'.
+
+    // PRIVATE TYPES
+    struct Node {
+        int   d_value;   // value
+        Node *d_next_p;  // next node
+    };
+
+    // DATA
+    Node             *d_top_p;        // top node
+    bsls::SpinLock    d_lock;         // serializes access
+    bslma::Allocator *d_allocator_p;  // supplies nodes
+
+  private:
+    // NOT IMPLEMENTED
+    LockedStack(const LockedStack&);
+    LockedStack& operator=(const LockedStack&);
+
+  public:
+    // CREATORS
+    explicit LockedStack(bslma::Allocator *allocator)
+    : d_top_p(0)
+    , d_allocator_p(allocator)
+    {
+        d_lock.initialize();
+    }
+
+    ~LockedStack()
+    {
+        while (d_top_p) {
+            Node *next = d_top_p->d_next_p;
+            d_allocator_p->deallocate(d_top_p);
+            d_top_p = next;
+        }
+    }
+
+    // MANIPULATORS
+    void push(int value)
+    {
+        Node *node = static_cast<Node *>(
+                                       d_allocator_p->allocate(sizeof(Node)));
+        node->d_value = value;
+        d_lock.lock();
+        node->d_next_p = d_top_p;
+        d_top_p        = node;
+        d_lock.unlock();
+    }
+
+    int pop(int *value)
+    {
+        d_lock.lock();
+        Node *node = d_top_p;
+        if (node) {
+            d_top_p = node->d_next_p;
+        }
+        d_lock.unlock();
+        if (!node) {
+            return 1;                                                 // RETURN
+        }
+        *value = node->d_value;
+        d_allocator_p->deallocate(node);
+        return 0;
+    }
+};
+
+                          // =======================
+                          // struct BenchmarkArgs
+                          // =======================
+
+struct BenchmarkArgs {
+    // This 'struct' holds the arguments of a throughput-benchmark thread.
+
+    Obj         *d_reclaimer_p;    // reclaimer (for 'TestStack')
+    TestStack   *d_stack_p;        // lock-free stack, or 0
+    LockedStack *d_lockedStack_p;  // locked stack, or 0
+    int          d_numIterations;  // number of push/pop pairs
+};
+
+static void benchmarkThread(void *arg)
+    // Push and pop values on the stack described by the specified 'arg'.
+{
+    BenchmarkArgs& args = *static_cast<BenchmarkArgs *>(arg);
+
+    int value;
+    if (args.d_stack_p) {
+        Participant participant(args.d_reclaimer_p);
+        for (int i = 0; i < args.d_numIterations; ++i) {
+            args.d_stack_p->push(i);
+            args.d_stack_p->pop(&value, &participant);
+        }
+    }
+    else {
+        for (int i = 0; i < args.d_numIterations; ++i) {
+            args.d_lockedStack_p->push(i);
+            args.d_lockedStack_p->pop(&value);
+        }
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Lock-Free Stack
+/// - - - - - - - - - - - - - -
+// Suppose that we want a stack of 'int' values that several threads can push
+// onto and pop from without a lock.  In the classic Treiber stack, 'pop' reads
+// the top node, and then replaces the top with that node's successor by a
+// compare-and-swap.  Without safe reclamation, the node popped by one thread
+// might be deallocated (or worse, deallocated, reallocated, and pushed again)
+// while another thread is still reading it.
+//
+// First, we define the stack, which supplies its nodes from the allocator of
+// a reclaimer:
+//..
+class my_Stack {
+    // This class implements a lock-free stack of 'int' values.
+
+    // PRIVATE TYPES
+    struct Node {
+        int   d_value;   // value
+        Node *d_next_p;  // next node (immutable once the node is pushed)
+    };
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Pointer  d_top;  // top node
+    bslma::EpochReclaimer                        *d_reclaimer_p;
+                                                   // supplies nodes
+
+  public:
+    // CREATORS
+    explicit my_Stack(bslma::EpochReclaimer *reclaimer)
+    : d_reclaimer_p(reclaimer)
+    {
+        bsls::AtomicOperations::initPointer(&d_top, 0);
+    }
+
+    ~my_Stack()
+    {
+        Node *node = static_cast<Node *>(const_cast<void *>(
+                               bsls::AtomicOperations::getPtr(&d_top)));
+        while (node) {
+            Node *next = node->d_next_p;
+            d_reclaimer_p->allocator()->deallocate(node);
+            node = next;
+        }
+    }
+
+    // MANIPULATORS
+    void push(int value)
+    {
+        Node *node = static_cast<Node *>(
+                       d_reclaimer_p->allocator()->allocate(sizeof(Node)));
+        node->d_value = value;
+
+        void *top = const_cast<void *>(
+                                 bsls::AtomicOperations::getPtr(&d_top));
+        do {
+            node->d_next_p = static_cast<Node *>(top);
+            void *previous = top;
+            top = bsls::AtomicOperations::testAndSwapPtr(&d_top,
+                                                         previous,
+                                                         node);
+            if (top == previous) {
+                break;
+            }
+        } while (true);
+    }
+
+    int pop(int *value, bslma::EpochParticipant *participant)
+        // Load into the specified 'value' the top value of this stack,
+        // and remove it, using the specified 'participant' of this
+        // stack's reclaimer.  Return 0 on success, and a non-zero value
+        // if this stack is empty.
+    {
+        Node *node;
+        {
+            bslma::EpochGuard guard(participant);
+
+            node = static_cast<Node *>(const_cast<void *>(
+                                 bsls::AtomicOperations::getPtr(&d_top)));
+            while (node) {
+                // 'node' cannot be reclaimed while we are within the
+                // critical section, so reading 'd_next_p' is safe.
+
+                void *previous = bsls::AtomicOperations::testAndSwapPtr(
+                                                      &d_top,
+                                                      node,
+                                                      node->d_next_p);
+                if (previous == node) {
+                    break;
+                }
+                node = static_cast<Node *>(previous);
+            }
+            if (!node) {
+                return 1;                                       // RETURN
+            }
+            *value = node->d_value;
+        }
+
+        // 'node' is unlinked, but other threads may still be reading it.
+
+        participant->retire(node);
+        return 0;
+    }
+};
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a reclaimer, supplying memory from a test allocator, and a
+// stack:
+//..
+        bslma::TestAllocator  ta;
+        bslma::EpochReclaimer reclaimer(&ta);
+        my_Stack              stack(&reclaimer);
+//..
+// Next, each thread that uses the stack registers with the reclaimer (here,
+// there is only the current thread):
+//..
+        bslma::EpochParticipant participant(&reclaimer);
+//..
+// Now, we push and pop some values:
+//..
+        stack.push(1);
+        stack.push(2);
+
+        int value;
+        ASSERT(0 == stack.pop(&value, &participant));
+        ASSERT(2 == value);
+        ASSERT(0 == stack.pop(&value, &participant));
+        ASSERT(1 == value);
+        ASSERT(0 != stack.pop(&value, &participant));
+//..
+// Finally, we observe that the popped nodes are pending reclamation, and that
+// they are returned to the allocator once the epoch has advanced past them:
+//..
+        ASSERT(2 == participant.numPending());
+
+        participant.reclaim();
+        participant.reclaim();
+        ASSERT(0 == participant.numPending());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: LOCK-FREE STACK STRESS TEST
+        //
+        // Concerns:
+        //: 1 No node is deallocated while a thread within a critical section
+        //:   can reach it.
+        //:
+        //: 2 Retired nodes are reclaimed while the threads run, so that the
+        //:   number of pending nodes of each participant remains bounded.
+        //:
+        //: 3 Every node is eventually returned to the allocator, exactly once.
+        //
+        // Plan:
+        //: 1 Run a lock-free stack, whose nodes are checked for a magic value
+        //:   (a test allocator scribbles over deallocated memory), on several
+        //:   updating threads, which push, pop (retiring the popped node), and
+        //:   periodically walk the stack, and on reading threads, which
+        //:   continually walk the stack.  Verify that no reader reaches a
+        //:   deallocated node.  (C-1)
+        //:
+        //: 2 Verify that, at the end of each updating thread, its participant
+        //:   has fewer than three batches of pending nodes.  (C-2)
+        //:
+        //: 3 Verify that the test allocator has no blocks in use once the
+        //:   stack and reclaimer are destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY: LOCK-FREE STACK STRESS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: LOCK-FREE STACK STRESS TEST"
+                            "\n========================================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20000;
+
+        static const struct {
+            int d_line;         // source line number
+            int d_numUpdaters;  // number of updating threads
+            int d_numReaders;   // number of reading threads
+        } DATA[] = {
+            //LINE  UPDATERS  READERS
+            //----  --------  -------
+            { L_,          1,       1 },
+            { L_,          2,       0 },
+            { L_,          4,       2 },
+            { L_,          8,       4 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int NU   = DATA[ti].d_numUpdaters;
+            const int NR   = DATA[ti].d_numReaders;
+
+            if (veryVerbose) { T_ P_(LINE) P_(NU) P(NR) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                LockedAllocator la(&ta);
+                Obj             reclaimer(&la);
+                TestStack       stack(&la);
+                bsls::AtomicInt numPopped(0);
+                bsls::AtomicInt numDone(0);
+
+                StressArgs args[16];
+                ThreadTask tasks[16];
+                for (int i = 0; i < NU + NR; ++i) {
+                    args[i].d_reclaimer_p   = &reclaimer;
+                    args[i].d_stack_p       = &stack;
+                    args[i].d_id            = i;
+                    args[i].d_numIterations = NUM_ITERATIONS;
+                    args[i].d_numPopped_p   = &numPopped;
+                    args[i].d_numDone_p     = &numDone;
+                    args[i].d_numUpdaters   = NU;
+
+                    tasks[i].d_function = i < NU ? &stressUpdater
+                                                 : &stressReader;
+                    tasks[i].d_arg      = &args[i];
+                }
+                runThreads(tasks, NU + NR);
+
+                ASSERTV(LINE, stack.numCorrupt(), 0 == stack.numCorrupt());
+                ASSERTV(LINE, 0 == reclaimer.numParticipants());
+
+                // Every push was followed by a pop of the same thread, which
+                // fails only if other threads emptied the stack.
+
+                Participant participant(&reclaimer);
+                int         value;
+                int         numRemaining = 0;
+                while (0 == stack.pop(&value, &participant)) {
+                    ++numRemaining;
+                }
+                ASSERTV(LINE, numPopped, numRemaining,
+                        NU * NUM_ITERATIONS == numPopped + numRemaining);
+            }
+            ASSERTV(LINE, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RETIRE AND RECLAIM
+        //
+        // Concerns:
+        //: 1 A retired block is not reclaimed while a participant that was
+        //:   within a critical section when it was retired remains within
+        //:   that critical section, and is reclaimed once the epoch has
+        //:   advanced twice.
+        //:
+        //: 2 'reclaim' returns the number of blocks reclaimed, and
+        //:   'numPending' the number retired but not yet reclaimed.
+        //:
+        //: 3 A block is returned to the allocator specified when it was
+        //:   retired, or by default to the reclaimer's allocator.
+        //:
+        //: 4 A retired object is destroyed when it is reclaimed, using its
+        //:   dynamic type, and its footprint is deallocated (even when the
+        //:   pointer retired is to a base class subobject not at the address
+        //:   of the object).
+        //:
+        //: 5 Filling a batch triggers reclamation, so that the number of
+        //:   pending blocks and the memory used for batches remain bounded.
+        //:
+        //: 6 The blocks pending when a participant is destroyed are reclaimed
+        //:   by another participant, or by the reclaimer's destructor.
+        //
+        // Plan:
+        //: 1 Retire blocks allocated from test allocators, with another
+        //:   participant within a critical section, and verify, after each
+        //:   call to 'reclaim', the number of blocks in use, the value
+        //:   returned, and 'numPending'.  (C-1..3)
+        //:
+        //: 2 Retire objects of a type that counts its destructions, and
+        //:   polymorphic objects through a pointer to a base class; verify
+        //:   destruction and deallocation once reclaimed.  (C-4)
+        //:
+        //: 3 Retire many blocks without calling 'reclaim', and verify the
+        //:   bounds on pending blocks and memory in use.  (C-5)
+        //:
+        //: 4 Destroy a participant having pending blocks; verify that they are
+        //:   reclaimed by another participant's 'reclaim', and, separately,
+        //:   by the destructor of the reclaimer.  (C-6)
+        //
+        // Testing:
+        //   void retire(void *address);
+        //   void retire(void *address, Allocator *allocator);
+        //   void retireObject(const TYPE *object);
+        //   void retireObject(const TYPE *object, Allocator *allocator);
+        //   bsls::Types::Int64 reclaim();
+        //   bsls::Types::Int64 numPending() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRETIRE AND RECLAIM"
+                            "\n==================\n");
+
+        if (veryVerbose) printf("\tReclamation is deferred.\n");
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            bslma::TestAllocator oa(veryVeryVerbose);
+            Obj                  mX(&ta);
+            Participant          p1(&mX);
+            Participant          p2(&mX);
+
+            const Int64 NUM_RECORDS = ta.numBlocksInUse();
+
+            p2.enter();
+
+            p1.retire(ta.allocate(8));
+            p1.retire(oa.allocate(8), &oa);
+            ASSERTV(p1.numPending(), 2 == p1.numPending());
+
+            // Each call to 'reclaim' advances the epoch at most once while
+            // 'p2' remains at the epoch it entered.
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, 0 == p1.reclaim());
+                ASSERTV(i, 2 == p1.numPending());
+                ASSERTV(i, 1 == oa.numBlocksInUse());
+            }
+            ASSERT(1 == mX.epoch());
+
+            p2.leave();
+
+            ASSERT(2 == p1.reclaim());
+            ASSERT(0 == p1.numPending());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            // The batch is kept for reuse.
+
+            ASSERTV(ta.numBlocksInUse(), NUM_RECORDS + 1 ==
+                                                       ta.numBlocksInUse());
+
+            p1.retire(ta.allocate(8));
+            ASSERT(NUM_RECORDS + 2 == ta.numBlocksInUse());
+            ASSERT(0 == p1.reclaim());
+            ASSERT(1 == p1.reclaim());
+            ASSERT(NUM_RECORDS + 1 == ta.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("\tRetired objects are destroyed.\n");
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            bslma::TestAllocator oa(veryVeryVerbose);
+            Obj                  mX(&ta);
+            Participant          p(&mX);
+
+            CountedType::s_numDestroyed        = 0;
+            PolymorphicDerived::s_numDestroyed = 0;
+
+            p.retireObject(new (ta) CountedType());
+            p.retireObject(new (oa) CountedType(), &oa);
+
+            PolymorphicDerived *derived = new (oa) PolymorphicDerived();
+            const PolymorphicBase *base = derived;
+            ASSERT(static_cast<const void *>(base) !=
+                                           static_cast<const void *>(derived));
+            p.retireObject(base, &oa);
+
+            ASSERT(0 == CountedType::s_numDestroyed);
+            ASSERT(0 == PolymorphicDerived::s_numDestroyed);
+            ASSERT(2 == oa.numBlocksInUse());
+
+            p.reclaim();
+            ASSERT(3 == p.reclaim());
+
+            ASSERT(2 == CountedType::s_numDestroyed);
+            ASSERT(1 == PolymorphicDerived::s_numDestroyed);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("\tFull batches trigger reclamation.\n");
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(&ta);
+            Participant          p(&mX);
+
+            const Int64 NUM_RECORDS = ta.numBlocksInUse();
+
+            for (int i = 0; i < 100 * BATCH_SIZE; ++i) {
+                p.retire(ta.allocate(8));
+
+                const Int64 NUM_PENDING = p.numPending();
+                ASSERTV(i, NUM_PENDING, NUM_PENDING <= 3 * BATCH_SIZE);
+
+                // At most three batches, plus a spare, are in use.
+
+                const Int64 NUM_BATCHES = ta.numBlocksInUse()
+                                        - NUM_RECORDS
+                                        - NUM_PENDING;
+                ASSERTV(i, NUM_BATCHES, NUM_BATCHES <= 4);
+            }
+            // Reclamation was attempted as each batch after the first was
+            // begun.
+
+            ASSERTV(mX.epoch(), 100 - 1 == mX.epoch());
+        }
+
+        if (veryVerbose) printf("\tOrphaned blocks are reclaimed.\n");
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(&ta);
+            Participant          p1(&mX);
+            {
+                Participant p2(&mX);
+
+                for (int i = 0; i < 2 * BATCH_SIZE + 3; ++i) {
+                    p2.retire(ta.allocate(8));
+                }
+            }
+            ASSERT(1 == mX.numParticipants());
+
+            const Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            ASSERT(0 == p1.reclaim());
+            ASSERT(0 == p1.reclaim());
+            ASSERT(0 == p1.numPending());
+
+            // Only the two records, and the batch 'p1' keeps for reuse,
+            // remain.
+
+            ASSERTV(NUM_BLOCKS, 3 < NUM_BLOCKS);
+            ASSERTV(ta.numBlocksInUse(), 3 == ta.numBlocksInUse());
+        }
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                Obj mX(&ta);
+                {
+                    Participant p1(&mX);
+
+                    p1.enter();
+                    ASSERT(1 == mX.advanceEpoch());
+                    {
+                        Participant p2(&mX);
+
+                        CountedType::s_numDestroyed = 0;
+                        p2.retire(ta.allocate(8));
+                        p2.retireObject(new (ta) CountedType());
+                    }
+                    p1.leave();
+
+                    // 'p1' was within a critical section when the blocks
+                    // were retired at epoch 1, and its destructor advances
+                    // the epoch only to 2.
+                }
+                ASSERT(0 == CountedType::s_numDestroyed);
+                ASSERT(0 == mX.numParticipants());
+            }
+            ASSERT(1 == CountedType::s_numDestroyed);
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CRITICAL SECTIONS AND EPOCH
+        //
+        // Concerns:
+        //: 1 'enter' and 'leave' nest, and 'isInCriticalSection' reflects the
+        //:   nesting.
+        //:
+        //: 2 'EpochGuard' enters a critical section for its lifetime.
+        //:
+        //: 3 The epoch advances by one on each call to 'advanceEpoch' while no
+        //:   participant is within a critical section.
+        //:
+        //: 4 A participant within a critical section permits the epoch to
+        //:   advance once past the epoch it entered, and no further.
+        //
+        // Plan:
+        //: 1 Enter and leave nested critical sections, directly and with
+        //:   guards, verifying 'isInCriticalSection'.  (C-1..2)
+        //:
+        //: 2 Call 'advanceEpoch' with participants inside and outside of
+        //:   critical sections, and verify the returned value and
+        //:   'epoch'.  (C-3..4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 advanceEpoch();
+        //   bsls::Types::Int64 epoch() const;
+        //   void enter();
+        //   void leave();
+        //   bool isInCriticalSection() const;
+        //   explicit EpochGuard(EpochParticipant *participant);
+        //   ~EpochGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCRITICAL SECTIONS AND EPOCH"
+                            "\n===========================\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        Obj                  mX(&ta);  const Obj& X = mX;
+        Participant          p1(&mX);
+        Participant          p2(&mX);
+
+        if (veryVerbose) printf("\tNesting.\n");
+
+        ASSERT(false == p1.isInCriticalSection());
+        p1.enter();
+        ASSERT(true  == p1.isInCriticalSection());
+        p1.enter();
+        ASSERT(true  == p1.isInCriticalSection());
+        p1.leave();
+        ASSERT(true  == p1.isInCriticalSection());
+        p1.leave();
+        ASSERT(false == p1.isInCriticalSection());
+        {
+            Guard g1(&p1);
+            ASSERT(true  == p1.isInCriticalSection());
+            {
+                Guard g2(&p1);
+                ASSERT(true  == p1.isInCriticalSection());
+            }
+            ASSERT(true  == p1.isInCriticalSection());
+            ASSERT(false == p2.isInCriticalSection());
+        }
+        ASSERT(false == p1.isInCriticalSection());
+
+        if (veryVerbose) printf("\tAdvancing the epoch.\n");
+
+        ASSERT(0 == X.epoch());
+        for (Int64 i = 1; i <= 5; ++i) {
+            ASSERTV(i, i == mX.advanceEpoch());
+            ASSERTV(i, i == X.epoch());
+        }
+
+        p1.enter();
+        ASSERT(6 == mX.advanceEpoch());
+        ASSERT(6 == mX.advanceEpoch());
+        ASSERT(6 == X.epoch());
+
+        // A nested section does not announce a new epoch.
+
+        p1.enter();
+        ASSERT(6 == mX.advanceEpoch());
+        p1.leave();
+        ASSERT(6 == mX.advanceEpoch());
+
+        // A participant entering later announces the later epoch.
+
+        p2.enter();
+        ASSERT(6 == mX.advanceEpoch());
+        p1.leave();
+        ASSERT(7 == mX.advanceEpoch());
+        ASSERT(7 == mX.advanceEpoch());
+        {
+            Guard guard(&p1);
+            ASSERT(7 == mX.advanceEpoch());
+            p2.leave();
+            ASSERT(8 == mX.advanceEpoch());
+            ASSERT(8 == mX.advanceEpoch());
+        }
+        ASSERT(9 == mX.advanceEpoch());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // REGISTRATION
+        //
+        // Concerns:
+        //: 1 A reclaimer uses the allocator supplied at construction, or the
+        //:   default allocator, and allocates no memory until a participant
+        //:   registers.
+        //:
+        //: 2 Each participant registers, allocating a record, and
+        //:   deregisters on destruction.
+        //:
+        //: 3 The record of a departed participant is reused, without
+        //:   allocation, by a later participant.
+        //:
+        //: 4 A reclaimer returns all memory on destruction.
+        //
+        // Plan:
+        //: 1 Create reclaimers with and without an allocator, with a test
+        //:   allocator installed as the default, and verify 'allocator' and
+        //:   the number of blocks in use.  (C-1)
+        //:
+        //: 2 Create and destroy participants, and verify 'numParticipants',
+        //:   'reclaimer', and the number of allocations.  (C-2..4)
+        //
+        // Testing:
+        //   explicit EpochReclaimer(Allocator *basicAllocator = 0);
+        //   ~EpochReclaimer();
+        //   Allocator *allocator() const;
+        //   int numParticipants() const;
+        //   explicit EpochParticipant(EpochReclaimer *reclaimer);
+        //   ~EpochParticipant();
+        //   EpochReclaimer *reclaimer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREGISTRATION"
+                            "\n============\n");
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (veryVerbose) printf("\tAllocators.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(0   == X.numParticipants());
+            ASSERT(0   == X.epoch());
+            ASSERT(0   == da.numBlocksTotal());
+            {
+                Participant p(&mX);
+                ASSERT(&mX == p.reclaimer());
+                ASSERT(1   == da.numBlocksInUse());
+            }
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == ta.numBlocksTotal());
+
+            if (veryVerbose) printf("\tRegistration.\n");
+
+            Participant *participants[8];
+            for (int i = 0; i < 8; ++i) {
+                participants[i] = new (ta) Participant(&mX);
+                ASSERTV(i, i + 1 == X.numParticipants());
+            }
+            const Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            for (int i = 0; i < 8; i += 2) {
+                ta.deleteObject(participants[i]);
+            }
+            ASSERT(4 == X.numParticipants());
+
+            if (veryVerbose) printf("\tRecord reuse.\n");
+
+            for (int i = 0; i < 8; i += 2) {
+                participants[i] = new (ta) Participant(&mX);
+            }
+            ASSERT(8 == X.numParticipants());
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS + 4 == ta.numAllocations());
+
+            for (int i = 0; i < 8; ++i) {
+                ta.deleteObject(participants[i]);
+            }
+            ASSERT(0 == X.numParticipants());
+        }
+        ASSERT(0                  == ta.numBlocksInUse());
+        ASSERT(NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Register a participant, retire blocks within and outside of
+        //:   critical sections, and reclaim them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj         mX(&ta);
+            Participant p(&mX);
+
+            void *block = ta.allocate(16);
+            {
+                Guard guard(&p);
+                ASSERT(p.isInCriticalSection());
+                p.retire(block);
+            }
+            ASSERT(1 == p.numPending());
+
+            p.reclaim();
+            p.reclaim();
+            ASSERT(0 == p.numPending());
+
+            for (int i = 0; i < 10 * BATCH_SIZE; ++i) {
+                p.enter();
+                p.retire(ta.allocate(16));
+                p.leave();
+            }
+            ASSERTV(p.numPending(), p.numPending() < 10 * BATCH_SIZE);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: OVERHEAD
+        //
+        // Concerns:
+        //: 1 Entering and leaving a critical section, and retiring a block,
+        //:   are cheap.
+        //:
+        //: 2 A lock-free stack whose nodes are reclaimed by this component
+        //:   scales with the number of threads at least as well as a stack
+        //:   protected by a lock.
+        //
+        // Plan:
+        //: 1 Time critical sections, and the retirement (and eventual
+        //:   reclamation) of blocks compared with their immediate
+        //:   deallocation.  (C-1)
+        //:
+        //: 2 Time push/pop pairs on 'TestStack' and 'LockedStack' on 1, 2, 4,
+        //:   and 8 threads.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: OVERHEAD
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: OVERHEAD"
+                            "\n=====================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        Obj         reclaimer(allocator);
+        Participant participant(&reclaimer);
+
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                participant.enter();
+                participant.leave();
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("enter/leave:        %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                allocator->deallocate(allocator->allocate(32));
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("allocate/free:      %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_ITERATIONS);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                participant.retire(allocator->allocate(32));
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("allocate/retire:    %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_ITERATIONS);
+        }
+
+        printf("\n%8s %12s %12s\n", "threads", "epoch (ns)", "lock (ns)");
+
+        const int STACK_ITERATIONS = NUM_ITERATIONS / 4;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            BenchmarkArgs args[8];
+            ThreadTask    tasks[8];
+            double        nsPerPair[2];
+
+            for (int kind = 0; kind < 2; ++kind) {
+                TestStack   stack(allocator);
+                LockedStack lockedStack(allocator);
+
+                for (int i = 0; i < numThreads; ++i) {
+                    args[i].d_reclaimer_p    = &reclaimer;
+                    args[i].d_stack_p        = 0 == kind ? &stack : 0;
+                    args[i].d_lockedStack_p  = 0 == kind ? 0 : &lockedStack;
+                    args[i].d_numIterations  = STACK_ITERATIONS;
+                    tasks[i].d_function      = &benchmarkThread;
+                    tasks[i].d_arg           = &args[i];
+                }
+
+                const Int64 start = bsls::TimeUtil::getTimer();
+                runThreads(tasks, numThreads);
+                const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+                nsPerPair[kind] = static_cast<double>(elapsed)
+                                / (static_cast<double>(STACK_ITERATIONS)
+                                                                 * numThreads);
+            }
+            printf("%8d %12.1f %12.1f\n",
+                   numThreads, nsPerPair[0], nsPerPair[1]);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,412 @@
+// bslma_profilingallocator.cpp                                       -*-C++-*-
+#include <bslma_profilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#include <cstdio>   // print report
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bslma::Allocator::size_type size_type;
+
+                        // =================
+                        // struct HeaderData
+                        // =================
+
+struct HeaderData {
+    // This 'struct' defines the data recorded in the header preceding each
+    // block dispensed by a profiling allocator.
+
+    bsls::Types::Int64 d_weight;     // estimated number of bytes represented
+                                     // by the block, or 0 if the block was not
+                                     // sampled
+
+    int                d_siteIndex;  // index of the site to which the block
+                                     // was attributed (if sampled)
+};
+
+                           // ============
+                           // union Header
+                           // ============
+
+union Header {
+    // This 'union' defines the (maximally-aligned) header preceding each block
+    // dispensed by a profiling allocator.
+
+    HeaderData                          d_data;       // recorded data
+    bsls::AlignmentUtil::MaxAlignedType d_alignment;  // force alignment
+};
+
+const char BUSY_KEY = 0;  // the address of this object marks a site that is
+                          // being claimed by a thread, but is not yet
+                          // published
+
+const int BAR_WIDTH = 40;  // width of the longest histogram bar in 'print'
+
+inline
+int hashKey(const char *key)
+    // Return the preferred index in the table of sites of the specified 'key'.
+{
+    bsls::Types::Uint64 value = reinterpret_cast<bsls::Types::UintPtr>(key);
+
+    value *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<int>((value >> 32)
+                                   % bslma::ProfilingAllocator::MAX_NUM_SITES);
+}
+
+inline
+bool isBefore(const bslma::ProfilingAllocatorSiteStats& lhs,
+              const bslma::ProfilingAllocatorSiteStats& rhs)
+    // Return 'true' if the specified 'lhs' site should be reported before the
+    // specified 'rhs' site, i.e., if 'lhs' has more bytes in use than 'rhs',
+    // or the same number of bytes in use and more bytes allocated.
+{
+    return lhs.d_numBytesInUse > rhs.d_numBytesInUse
+        || (lhs.d_numBytesInUse == rhs.d_numBytesInUse
+            && lhs.d_numBytesAllocated > rhs.d_numBytesAllocated);
+}
+
+}  // close unnamed namespace
+
+namespace bslma {
+
+                         // ------------------------
+                         // class ProfilingAllocator
+                         // ------------------------
+
+// PRIVATE MANIPULATORS
+void *ProfilingAllocator::allocateImp(size_type   size,
+                                      const void *key,
+                                      bool        isTag)
+{
+    BSLS_ASSERT_SAFE(0 <= size);
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                               d_allocator_p->allocate(size + sizeof(Header)));
+
+    const bsls::Types::Int64 bytes = static_cast<bsls::Types::Int64>(size);
+    bsls::Types::Int64       weight = 0;
+
+    if (d_samplingInterval <= 1) {
+        weight = bytes;
+    }
+    else {
+        const bsls::Types::Int64 remaining =
+                                        d_bytesUntilSample.addRelaxed(-bytes);
+
+        if (remaining <= 0 && remaining + bytes > 0) {
+            // This allocation crossed the sampling boundary: sample it, and
+            // move the boundary past the end of this allocation.  Note that
+            // allocations from other threads observing a non-positive count
+            // before the boundary is moved are not sampled.
+
+            d_bytesUntilSample.addRelaxed(d_samplingInterval
+                                   * (1 + (-remaining) / d_samplingInterval));
+            weight = bytes > d_samplingInterval ? bytes : d_samplingInterval;
+        }
+    }
+
+    header->d_data.d_weight = weight;
+
+    if (weight) {
+        const int                index = findSite(key, isTag);
+        ProfilingAllocator_Site& site  = d_sites[index].d_site;
+
+        site.d_numAllocations.addRelaxed(1);
+        site.d_numBlocksInUse.addRelaxed(1);
+        site.d_numBytesAllocated.addRelaxed(weight);
+        site.d_numBytesInUse.addRelaxed(weight);
+        d_numSampledAllocations.addRelaxed(1);
+
+        header->d_data.d_siteIndex = index;
+    }
+
+    return header + 1;
+}
+
+int ProfilingAllocator::findSite(const void *key, bool isTag)
+{
+    if (0 == key) {
+        return MAX_NUM_SITES;                                         // RETURN
+    }
+
+    const char *siteKey = static_cast<const char *>(key);
+    int         index   = hashKey(siteKey);
+
+    for (int i = 0; i < MAX_NUM_SITES; ++i) {
+        ProfilingAllocator_Site& site    = d_sites[index].d_site;
+        const char              *current = site.d_key.loadAcquire();
+
+        if (0 == current) {
+            current = site.d_key.testAndSwapAcqRel(0, &BUSY_KEY);
+            if (0 == current) {
+                site.d_isTag.storeRelaxed(isTag);
+                site.d_key.storeRelease(siteKey);
+                return index;                                         // RETURN
+            }
+        }
+
+        while (&BUSY_KEY == current) {
+            // Another thread is claiming this slot; it will be published
+            // momentarily.
+
+            current = site.d_key.loadAcquire();
+        }
+
+        if (siteKey == current) {
+            return index;                                             // RETURN
+        }
+
+        index = (index + 1) % MAX_NUM_SITES;
+    }
+
+    return MAX_NUM_SITES;
+}
+
+void *ProfilingAllocator::releaseBlock(void *address)
+{
+    Header *header = static_cast<Header *>(address) - 1;
+
+    const bsls::Types::Int64 weight = header->d_data.d_weight;
+    if (weight) {
+        ProfilingAllocator_Site& site =
+                              d_sites[header->d_data.d_siteIndex].d_site;
+
+        site.d_numBlocksInUse.addRelaxed(-1);
+        site.d_numBytesInUse.addRelaxed(-weight);
+    }
+
+    return header;
+}
+
+// CREATORS
+ProfilingAllocator::ProfilingAllocator(Allocator *basicAllocator)
+: d_name_p(0)
+, d_samplingInterval(DEFAULT_SAMPLING_INTERVAL)
+, d_bytesUntilSample(DEFAULT_SAMPLING_INTERVAL)
+, d_numSampledAllocations(0)
+, d_creationTime(bsls::TimeUtil::getTimer())
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+ProfilingAllocator::ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                                       Allocator          *basicAllocator)
+: d_name_p(0)
+, d_samplingInterval(samplingInterval)
+, d_bytesUntilSample(samplingInterval)
+, d_numSampledAllocations(0)
+, d_creationTime(bsls::TimeUtil::getTimer())
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+ProfilingAllocator::ProfilingAllocator(const char         *name,
+                                       bsls::Types::Int64  samplingInterval,
+                                       Allocator          *basicAllocator)
+: d_name_p(name)
+, d_samplingInterval(samplingInterval)
+, d_bytesUntilSample(samplingInterval)
+, d_numSampledAllocations(0)
+, d_creationTime(bsls::TimeUtil::getTimer())
+, d_allocator_p(Default::allocator(basicAllocator))
+{
+}
+
+ProfilingAllocator::~ProfilingAllocator()
+{
+}
+
+// MANIPULATORS
+void *ProfilingAllocator::allocate(size_type size)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+    return allocateImp(size, __builtin_return_address(0), false);
+#else
+    return allocateImp(size, 0, false);
+#endif
+}
+
+void ProfilingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    d_allocator_p->deallocate(releaseBlock(address));
+}
+
+void ProfilingAllocator::deallocateSized(void *address, size_type size)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    d_allocator_p->deallocateSized(releaseBlock(address),
+                                   size + sizeof(Header));
+}
+
+// ACCESSORS
+int ProfilingAllocator::loadSiteStats(ProfilingAllocatorSiteStats *result,
+                                      int                          maxNumSites)
+                                                                          const
+{
+    BSLS_ASSERT(result || 0 == maxNumSites);
+    BSLS_ASSERT(0 <= maxNumSites);
+
+    ProfilingAllocatorSiteStats stats[MAX_NUM_SITES + 1];
+    int                         numSites = 0;
+
+    for (int i = 0; i <= MAX_NUM_SITES; ++i) {
+        const ProfilingAllocator_Site& site = d_sites[i].d_site;
+
+        const char *key = site.d_key.loadAcquire();
+        if (&BUSY_KEY == key) {
+            continue;
+        }
+
+        const bsls::Types::Int64 numAllocations =
+                                           site.d_numAllocations.loadRelaxed();
+        if (0 == numAllocations) {
+            continue;
+        }
+
+        ProfilingAllocatorSiteStats item;
+        const bool                  isTag = site.d_isTag.loadRelaxed();
+
+        item.d_tag_p             = isTag ? key : 0;
+        item.d_address_p         = isTag ? 0 : key;
+        item.d_numAllocations    = numAllocations;
+        item.d_numBlocksInUse    = site.d_numBlocksInUse.loadRelaxed();
+        item.d_numBytesAllocated = site.d_numBytesAllocated.loadRelaxed();
+        item.d_numBytesInUse     = site.d_numBytesInUse.loadRelaxed();
+
+        // Insert 'item' in order (there are few sites, so an insertion sort
+        // suffices).
+
+        int j = numSites;
+        while (0 < j && isBefore(item, stats[j - 1])) {
+            stats[j] = stats[j - 1];
+            --j;
+        }
+        stats[j] = item;
+        ++numSites;
+    }
+
+    if (numSites > maxNumSites) {
+        numSites = maxNumSites;
+    }
+    for (int i = 0; i < numSites; ++i) {
+        result[i] = stats[i];
+    }
+    return numSites;
+}
+
+void ProfilingAllocator::print() const
+{
+    ProfilingAllocatorSiteStats stats[MAX_NUM_SITES + 1];
+    const int numSites = loadSiteStats(stats, MAX_NUM_SITES + 1);
+
+    const double seconds = static_cast<double>(bsls::TimeUtil::getTimer()
+                                                   - d_creationTime) * 1.0E-9;
+
+    std::printf("\n"
+                "==================================================\n"
+                "          PROFILING ALLOCATOR %s STATE\n"
+                "--------------------------------------------------\n"
+                "   SAMPLING INTERVAL\t%lld\n"
+                " SAMPLED ALLOCATIONS\t%lld\n"
+                "               SITES\t%d\n"
+                "--------------------------------------------------\n"
+                "      Bytes In Use\t   Bytes/s\tSite\n"
+                "      ------------\t   -------\t----\n",
+                d_name_p ? d_name_p : "",
+                d_samplingInterval,
+                numSampledAllocations(),
+                numSites);
+
+    const bsls::Types::Int64 maxBytesInUse = numSites > 0
+                                           ? stats[0].d_numBytesInUse
+                                           : 0;
+
+    for (int i = 0; i < numSites; ++i) {
+        const ProfilingAllocatorSiteStats& site = stats[i];
+
+        const double rate = seconds > 0
+                          ? static_cast<double>(site.d_numBytesAllocated)
+                                                                     / seconds
+                          : 0;
+
+        std::printf("%18lld\t%10.0f\t", site.d_numBytesInUse, rate);
+        if (site.d_tag_p) {
+            std::printf("%s\n", site.d_tag_p);
+        }
+        else if (site.d_address_p) {
+            std::printf("%p\n", site.d_address_p);
+        }
+        else {
+            std::printf("<other>\n");
+        }
+
+        const int width = maxBytesInUse > 0
+                        ? static_cast<int>(site.d_numBytesInUse * BAR_WIDTH
+                                                              / maxBytesInUse)
+                        : 0;
+
+        std::printf("                  ");
+        for (int j = 0; j < width; ++j) {
+            std::printf("#");
+        }
+        std::printf("\n");
+    }
+    std::fflush(stdout);
+}
+
+                       // -----------------------------
+                       // class ProfilingAllocatorProxy
+                       // -----------------------------
+
+// CREATORS
+ProfilingAllocatorProxy::~ProfilingAllocatorProxy()
+{
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,612 @@
+// bslma_profilingallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLMA_PROFILINGALLOCATOR
+#define INCLUDED_BSLMA_PROFILINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sampling allocator that attributes memory use to sites.
+//
+//@CLASSES:
+//  bslma::ProfilingAllocator: sampling allocator attributing use to sites
+//  bslma::ProfilingAllocatorProxy: adaptor attributing allocations to a tag
+//  bslma::ProfilingAllocatorSiteStats: snapshot of the statistics of a site
+//
+//@SEE_ALSO: bslma_testallocator, bslma_allocator
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'bslma::ProfilingAllocator', that implements the 'bslma::Allocator'
+// protocol by forwarding to another ("underlying") allocator, and that, for a
+// sample of the allocations it performs, records the *site* responsible for
+// the allocation.  Whereas 'bslma::TestAllocator' reports only aggregate
+// statistics (e.g., the number of bytes in use), a profiling allocator reports
+// how many bytes are in use, and how many have been allocated, by each site,
+// so that growth in memory use can be traced to the code responsible for it.
+// Unlike 'bslma::TestAllocator', a profiling allocator is intended to be used
+// in production: it is thread-safe, never aborts, and, at the default
+// sampling interval, adds little overhead to each allocation.
+//..
+//   ,-------------------------.
+//  ( bslma::ProfilingAllocator )
+//   `-------------------------'
+//                |         ctor/dtor
+//                |         allocateTagged
+//                |         loadSiteStats
+//                |         numSampledAllocations
+//                |         print
+//                |         samplingInterval
+//                V
+//        ,----------------.
+//       ( bslma::Allocator )
+//        `----------------'
+//                        allocate
+//                        deallocate
+//..
+///Sites
+///-----
+// An allocation is attributed to one of two kinds of site:
+//
+//: o A *tag*: a null-terminated string, having static storage duration, that
+//:   is supplied by the caller, either by calling 'allocateTagged' directly,
+//:   or by allocating through a 'bslma::ProfilingAllocatorProxy' (which can
+//:   be supplied to any object or container taking a 'bslma::Allocator').
+//:
+//: o A *return address*: the address of the instruction following the call to
+//:   'allocate'.  Note that for objects that allocate through a
+//:   'bsl::allocator', this address usually lies within the (inlined) member
+//:   function of the object that requested the memory.
+//
+// At most 'MAX_NUM_SITES' distinct sites are tracked; sampled allocations
+// from any additional sites are attributed to a single *overflow* site (having
+// neither a tag nor an address).  On platforms where the compiler does not
+// provide the return address of a function, untagged allocations are also
+// attributed to the overflow site.
+//
+///Sampling
+///--------
+// To keep the cost of profiling low, statistics are recorded only for a
+// sample of the allocations: an allocation is sampled each time the
+// cumulative number of bytes allocated crosses a multiple of the *sampling
+// interval* (supplied at construction).  An allocation at least as large as
+// the sampling interval is therefore always sampled, while a smaller
+// allocation is sampled with a probability roughly proportional to its size.
+// Each sampled allocation of 'size' bytes is counted as representing
+// 'max(size, samplingInterval)' bytes, so that the byte counts reported for a
+// site are unbiased estimates of the actual byte counts.  A sampling interval
+// of 1 (or less) samples every allocation, and the reported byte counts are
+// then exact.  The default sampling interval, 'DEFAULT_SAMPLING_INTERVAL', is
+// suitable for leaving profiling enabled in production.
+//
+// The time cost of an allocation that is not sampled is that of the
+// underlying allocation, plus a single atomic subtraction.
+//
+///Memory Overhead
+///---------------
+// Whether a block was sampled, and if so the site to which it was attributed,
+// must be known when the block is deallocated, and neither is supplied to
+// 'deallocate'.  Each block dispensed by a profiling allocator, sampled or
+// not, is therefore preceded by a header recording them, occupying
+// 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes (16 bytes on typical 64-bit
+// platforms) so that the block remains maximally aligned.  The underlying
+// allocator is asked for 'size + BSLS_MAX_ALIGNMENT' bytes for every request
+// of 'size' bytes, which roughly doubles the memory used by the smallest
+// blocks, e.g., the nodes of a tree or hash table of small elements.  (Unlike
+// the time cost, this overhead does not depend on the sampling interval.)
+//
+// A profiling allocator left enabled in production is therefore best
+// supplied to objects whose blocks are not tiny (e.g., containers of large
+// elements, or the allocators from which pools obtain their chunks), or used
+// only for the duration of an investigation.  Note that the overhead is
+// included in the memory used by the underlying allocator, but not in the
+// statistics reported by the profiling allocator, which count only the bytes
+// requested.
+//
+///Thread Safety
+///-------------
+// A 'bslma::ProfilingAllocator' is fully thread-safe (provided that the
+// underlying allocator is): its manipulators and accessors may be invoked
+// concurrently from multiple threads.  Statistics are maintained using atomic
+// operations, so a report produced while other threads are allocating is a
+// consistent snapshot of each individual counter, but not necessarily of all
+// counters together.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Source of Memory Growth
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches the results of two kinds of request, and that
+// we want to know which of the caches accounts for the memory held by the
+// service.  First, we create a profiling allocator that samples every
+// allocation (in production we would use the default sampling interval):
+//..
+//  bslma::ProfilingAllocator profiler("service", 1);
+//..
+// Then, we create one proxy for each cache, each attributing allocations to a
+// descriptive tag:
+//..
+//  bslma::ProfilingAllocatorProxy quoteCacheAllocator(&profiler,
+//                                                     "quote cache");
+//  bslma::ProfilingAllocatorProxy tradeCacheAllocator(&profiler,
+//                                                     "trade cache");
+//..
+// Next, we simulate the use of the caches by allocating memory through the
+// proxies:
+//..
+//  void *quotes[10];
+//  for (int i = 0; i < 10; ++i) {
+//      quotes[i] = quoteCacheAllocator.allocate(100);
+//  }
+//  void *trades = tradeCacheAllocator.allocate(5000);
+//..
+// Now, we load the statistics of the sites, which are ordered by decreasing
+// number of bytes in use:
+//..
+//  bslma::ProfilingAllocatorSiteStats stats[4];
+//  int numSites = profiler.loadSiteStats(stats, 4);
+//
+//  assert(2 == numSites);
+//  assert(0 == std::strcmp("trade cache", stats[0].d_tag_p));
+//  assert(5000 == stats[0].d_numBytesInUse);
+//  assert(0 == std::strcmp("quote cache", stats[1].d_tag_p));
+//  assert(1000 == stats[1].d_numBytesInUse);
+//  assert(10 == stats[1].d_numBlocksInUse);
+//..
+// Finally, we free the memory and observe that no memory is reported in use,
+// although the cumulative statistics are retained (a report can also be
+// printed to 'stdout' using the 'print' method):
+//..
+//  for (int i = 0; i < 10; ++i) {
+//      quoteCacheAllocator.deallocate(quotes[i]);
+//  }
+//  tradeCacheAllocator.deallocate(trades);
+//
+//  numSites = profiler.loadSiteStats(stats, 4);
+//
+//  assert(2 == numSites);
+//  assert(0 == stats[0].d_numBytesInUse);
+//  assert(0 == stats[1].d_numBytesInUse);
+//  assert(5000 + 1000 == stats[0].d_numBytesAllocated
+//                       + stats[1].d_numBytesAllocated);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslma {
+
+                     // ==================================
+                     // struct ProfilingAllocatorSiteStats
+                     // ==================================
+
+struct ProfilingAllocatorSiteStats {
+    // This 'struct' provides a snapshot of the statistics recorded by a
+    // 'ProfilingAllocator' for a single site.  Byte counts are estimates
+    // derived from the sampled allocations (see "Sampling" in the
+    // component-level documentation).
+
+    // PUBLIC DATA
+    const char         *d_tag_p;              // tag of the site, or 0 if the
+                                              // site is identified by address
+
+    const void         *d_address_p;          // return address identifying the
+                                              // site, or 0 for a tagged site
+
+    bsls::Types::Int64  d_numAllocations;     // number of sampled allocations
+
+    bsls::Types::Int64  d_numBlocksInUse;     // number of sampled blocks not
+                                              // yet deallocated
+
+    bsls::Types::Int64  d_numBytesAllocated;  // estimated cumulative number of
+                                              // bytes allocated
+
+    bsls::Types::Int64  d_numBytesInUse;      // estimated number of bytes in
+                                              // use
+};
+
+                       // =============================
+                       // struct ProfilingAllocator_Site
+                       // =============================
+
+struct ProfilingAllocator_Site {
+    // This 'struct' holds the statistics of a single site, and is for use only
+    // by 'ProfilingAllocator'.
+
+    // PUBLIC DATA
+    bsls::AtomicPointer<const char>
+                       d_key;                 // identity of the site: a tag or
+                                              // a return address (0 if unused)
+
+    bsls::AtomicInt    d_isTag;               // whether 'd_key' is a tag
+
+    bsls::AtomicInt64  d_numAllocations;      // number of sampled allocations
+
+    bsls::AtomicInt64  d_numBlocksInUse;      // number of sampled blocks in
+                                              // use
+
+    bsls::AtomicInt64  d_numBytesAllocated;   // estimated cumulative bytes
+
+    bsls::AtomicInt64  d_numBytesInUse;       // estimated bytes in use
+};
+
+                    // ===================================
+                    // struct ProfilingAllocator_PaddedSite
+                    // ===================================
+
+struct ProfilingAllocator_PaddedSite {
+    // This 'struct' holds the statistics of a single site preceded by a cache
+    // line of padding, so that the sites in an array, and the members
+    // preceding the array, never share a cache line, and is for use only by
+    // 'ProfilingAllocator'.  Note that the site is padded, rather than
+    // aligned on a cache line, so that a 'ProfilingAllocator' requires no
+    // extended alignment (which 'operator new' does not provide before
+    // C++17).
+
+    // PUBLIC DATA
+    char                    d_pad[bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE];
+                                                  // separates 'd_site' from
+                                                  // the preceding object
+
+    ProfilingAllocator_Site d_site;               // statistics of the site
+};
+
+                         // ========================
+                         // class ProfilingAllocator
+                         // ========================
+
+class ProfilingAllocator : public Allocator {
+    // This class defines a concrete, thread-safe allocator mechanism that
+    // implements the 'Allocator' protocol by forwarding to an underlying
+    // allocator, and that records, for a sample of its allocations, the number
+    // of blocks and bytes allocated by, and in use by, each allocation site.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        DEFAULT_SAMPLING_INTERVAL = 512 * 1024,
+            // default average number of bytes allocated between samples
+
+        MAX_NUM_SITES             = 256
+            // maximum number of distinct sites tracked (excluding the
+            // overflow site)
+    };
+
+  private:
+    // DATA
+    const char              *d_name_p;          // name of this allocator (or
+                                                // 0)
+
+    const bsls::Types::Int64 d_samplingInterval;
+                                                // number of bytes between
+                                                // samples
+
+    bsls::AtomicInt64        d_bytesUntilSample;
+                                                // bytes to allocate before
+                                                // the next sample is taken
+
+    bsls::AtomicInt64        d_numSampledAllocations;
+                                                // number of allocations
+                                                // sampled (over all sites)
+
+    bsls::Types::Int64       d_creationTime;    // 'bsls::TimeUtil::getTimer'
+                                                // at construction
+
+    Allocator               *d_allocator_p;     // underlying allocator (held,
+                                                // not owned)
+
+    ProfilingAllocator_PaddedSite
+                             d_sites[MAX_NUM_SITES + 1];
+                                                // hash table of sites (the
+                                                // last being the overflow
+                                                // site), each separated from
+                                                // its neighbors by a cache
+                                                // line
+
+    // NOT IMPLEMENTED
+    ProfilingAllocator(const ProfilingAllocator&);
+    ProfilingAllocator& operator=(const ProfilingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void *allocateImp(size_type size, const void *key, bool isTag);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), attributing the allocation, if it is
+        // sampled, to the site identified by the specified 'key', which is a
+        // tag if the specified 'isTag' is 'true', and a return address
+        // otherwise.
+
+    int findSite(const void *key, bool isTag);
+        // Return the index in 'd_sites' of the site identified by the
+        // specified 'key', which is a tag if the specified 'isTag' is 'true',
+        // adding the site to the table if it is not already present, or the
+        // index of the overflow site if the table is full.
+
+    void *releaseBlock(void *address);
+        // Update the statistics of the site to which the block at the
+        // specified 'address' was attributed, if it was sampled, and return
+        // the address of the underlying block (i.e., of its header).  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+  public:
+    // CREATORS
+    explicit
+    ProfilingAllocator(Allocator *basicAllocator = 0);
+    explicit
+    ProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                       Allocator          *basicAllocator = 0);
+    ProfilingAllocator(const char         *name,
+                       bsls::Types::Int64  samplingInterval,
+                       Allocator          *basicAllocator = 0);
+        // Create a profiling allocator.  Optionally specify a 'name' (having
+        // static storage duration) to be included in reports, thereby
+        // distinguishing this allocator from others in the same program.
+        // Optionally specify a 'samplingInterval', the average number of bytes
+        // allocated between sampled allocations; if 'samplingInterval' is not
+        // specified, 'DEFAULT_SAMPLING_INTERVAL' is used, and if it is 1 or
+        // less, every allocation is sampled.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    virtual ~ProfilingAllocator();
+        // Destroy this allocator.  Note that the behavior of destroying an
+        // allocator while memory is allocated from it is not specified.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) obtained from the underlying allocator,
+        // attributing the allocation, if it is sampled, to the site identified
+        // by the return address of this call.  If 'size' is 0, a null pointer
+        // is returned with no other effect.  The behavior is undefined unless
+        // '0 <= size'.
+
+    void *allocateTagged(size_type size, const char *tag);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) obtained from the underlying allocator,
+        // attributing the allocation, if it is sampled, to the site identified
+        // by the specified 'tag'.  If 'size' is 0, a null pointer is returned
+        // with no other effect.  The behavior is undefined unless '0 <= size',
+        // and 'tag' is a null-terminated string having static storage duration
+        // (sites are identified by the address, not the value, of 'tag').
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator, updating the statistics of the site to which
+        // the block was attributed, if it was sampled.  If 'address' is 0,
+        // this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated using this allocator object (or a proxy
+        // for it) and has not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to the underlying allocator
+        // (supplying it the size of the block including its header), updating
+        // the statistics of the site to which the block was attributed, if it
+        // was sampled.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object (or a proxy for it) with a request for 'size'
+        // bytes, and has not already been deallocated.
+
+    // ACCESSORS
+    int loadSiteStats(ProfilingAllocatorSiteStats *result,
+                      int                          maxNumSites) const;
+        // Load into the specified 'result' array the statistics of at most
+        // the specified 'maxNumSites' sites having the most bytes in use, in
+        // order of decreasing number of bytes in use, and return the number of
+        // sites loaded.  Only sites for which at least one allocation was
+        // sampled are loaded.  The behavior is undefined unless
+        // '0 <= maxNumSites' and 'result' refers to an array of at least
+        // 'maxNumSites' elements.
+
+    const char *name() const;
+        // Return the name of this profiling allocator, or 0 if no name was
+        // specified at construction.
+
+    bsls::Types::Int64 numSampledAllocations() const;
+        // Return the number of allocations that have been sampled by this
+        // allocator.
+
+    void print() const;
+        // Write to 'stdout' a report of the statistics of every site for
+        // which an allocation was sampled, in order of decreasing number of
+        // bytes in use.  For each site the report shows the estimated number
+        // of bytes in use, together with a histogram bar proportional to that
+        // number, and the estimated average allocation rate (in bytes per
+        // second) since this allocator was created.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the sampling interval of this allocator.
+};
+
+                       // =============================
+                       // class ProfilingAllocatorProxy
+                       // =============================
+
+class ProfilingAllocatorProxy : public Allocator {
+    // This class defines an allocator mechanism that implements the
+    // 'Allocator' protocol by forwarding to a 'ProfilingAllocator',
+    // attributing every (sampled) allocation to a fixed tag.  A proxy is
+    // typically supplied to an object or container so as to attribute all of
+    // its memory use to a descriptive tag.
+
+    // DATA
+    ProfilingAllocator *d_profiler_p;  // profiling allocator (held, not owned)
+    const char         *d_tag_p;       // tag of allocations
+
+    // NOT IMPLEMENTED
+    ProfilingAllocatorProxy(const ProfilingAllocatorProxy&);
+    ProfilingAllocatorProxy& operator=(const ProfilingAllocatorProxy&);
+
+  public:
+    // CREATORS
+    ProfilingAllocatorProxy(ProfilingAllocator *profiler, const char *tag);
+        // Create an allocator that forwards to the specified 'profiler',
+        // attributing every allocation to the specified 'tag'.  The behavior
+        // is undefined unless 'profiler' is not 0, and 'tag' is a
+        // null-terminated string having static storage duration.
+
+    virtual ~ProfilingAllocatorProxy();
+        // Destroy this allocator.  Note that memory allocated from this
+        // allocator may be deallocated using the profiling allocator
+        // supplied at construction.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes) obtained from the profiling allocator
+        // supplied at construction, attributed to the tag supplied at
+        // construction.  If 'size' is 0, a null pointer is returned with no
+        // other effect.  The behavior is undefined unless '0 <= size'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // profiling allocator supplied at construction.  If 'address' is 0,
+        // this function has no effect.  The behavior is undefined unless
+        // 'address' was allocated from that profiling allocator (or a proxy
+        // for it) and has not already been deallocated.
+
+    virtual void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', having the
+        // specified 'size' (in bytes), back to the profiling allocator
+        // supplied at construction.  If 'address' is 0, this function has no
+        // effect.  The behavior is undefined unless 'address' was allocated
+        // from that profiling allocator (or a proxy for it) with a request for
+        // 'size' bytes, and has not already been deallocated.
+
+    // ACCESSORS
+    ProfilingAllocator *profiler() const;
+        // Return the address of the profiling allocator to which this
+        // allocator forwards.
+
+    const char *tag() const;
+        // Return the tag to which this allocator attributes allocations.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class ProfilingAllocator
+                         // ------------------------
+
+// MANIPULATORS
+inline
+void *ProfilingAllocator::allocateTagged(size_type size, const char *tag)
+{
+    return allocateImp(size, tag, true);
+}
+
+// ACCESSORS
+inline
+const char *ProfilingAllocator::name() const
+{
+    return d_name_p;
+}
+
+inline
+bsls::Types::Int64 ProfilingAllocator::numSampledAllocations() const
+{
+    return d_numSampledAllocations.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 ProfilingAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+                       // -----------------------------
+                       // class ProfilingAllocatorProxy
+                       // -----------------------------
+
+// CREATORS
+inline
+ProfilingAllocatorProxy::ProfilingAllocatorProxy(ProfilingAllocator *profiler,
+                                                 const char         *tag)
+: d_profiler_p(profiler)
+, d_tag_p(tag)
+{
+}
+
+// MANIPULATORS
+inline
+void *ProfilingAllocatorProxy::allocate(size_type size)
+{
+    return d_profiler_p->allocateTagged(size, d_tag_p);
+}
+
+inline
+void ProfilingAllocatorProxy::deallocate(void *address)
+{
+    d_profiler_p->deallocate(address);
+}
+
+inline
+void ProfilingAllocatorProxy::deallocateSized(void *address, size_type size)
+{
+    d_profiler_p->deallocateSized(address, size);
+}
+
+// ACCESSORS
+inline
+ProfilingAllocator *ProfilingAllocatorProxy::profiler() const
+{
+    return d_profiler_p;
+}
+
+inline
+const char *ProfilingAllocatorProxy::tag() const
+{
+    return d_tag_p;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,917 @@
+// bslma_profilingallocator.t.cpp                                     -*-C++-*-
+
+#include <bslma_profilingallocator.h>
+
+#include <bslma_allocator.h>                    // for testing only
+#include <bslma_default.h>                      // for testing only
+#include <bslma_defaultallocatorguard.h>        // for testing only
+#include <bslma_testallocator.h>                // for testing only
+
+#include <bsls_alignmentfromtype.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cstring>   // 'std::strcmp' in usage example
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe allocator that forwards to an
+// underlying allocator and records per-site statistics for a sample of its
+// allocations.  We use a 'bslma::TestAllocator' as the underlying allocator to
+// verify that all memory is returned to it (with the correct size, when
+// deallocated with 'deallocateSized').  Sampling every allocation (an interval
+// of 1) makes the recorded statistics exact, and so directly testable; the
+// sampling itself is deterministic in a single thread, which allows us to
+// verify the estimates produced at larger sampling intervals.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ProfilingAllocator(Allocator *ba = 0);
+// [ 2] ProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+// [ 2] ProfilingAllocator(const char *name, Int64 interval, Allocator *ba);
+// [ 2] ~ProfilingAllocator();
+// [ 3] ProfilingAllocatorProxy(ProfilingAllocator *profiler, const char *);
+// [ 3] ~ProfilingAllocatorProxy();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void *allocateTagged(size_type size, const char *tag);
+// [ 3] void deallocate(void *address);
+// [ 3] void deallocateSized(void *address, size_type size);
+// [ 3] void *ProfilingAllocatorProxy::allocate(size_type size);
+// [ 3] void ProfilingAllocatorProxy::deallocate(void *address);
+// [ 3] void ProfilingAllocatorProxy::deallocateSized(void *, size_type);
+//
+// ACCESSORS
+// [ 2] const char *name() const;
+// [ 2] Int64 samplingInterval() const;
+// [ 3] Int64 numSampledAllocations() const;
+// [ 3] int loadSiteStats(ProfilingAllocatorSiteStats *, int) const;
+// [ 7] void print() const;
+// [ 3] ProfilingAllocator *ProfilingAllocatorProxy::profiler() const;
+// [ 3] const char *ProfilingAllocatorProxy::tag() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ATTRIBUTION TO RETURN ADDRESSES
+// [ 5] SAMPLING
+// [ 6] SITE TABLE OVERFLOW
+// [ 8] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::ProfilingAllocator          Obj;
+typedef bslma::ProfilingAllocatorProxy     Proxy;
+typedef bslma::ProfilingAllocatorSiteStats Stats;
+typedef bsls::Types::Int64                 Int64;
+
+enum { MAX_SITES = Obj::MAX_NUM_SITES + 1 };
+
+static const char TAG_A[] = "A";
+static const char TAG_B[] = "B";
+
+//=============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static const Stats *findTag(const Stats *stats, int numSites, const char *tag)
+    // Return the address of the element of the specified 'stats' array,
+    // having the specified 'numSites' elements, for the specified 'tag', or 0
+    // if there is no such element.
+{
+    for (int i = 0; i < numSites; ++i) {
+        if (tag == stats[i].d_tag_p) {
+            return stats + i;                                         // RETURN
+        }
+    }
+    return 0;
+}
+
+static void *allocateFromSiteOne(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is not inlined, so as to provide a
+    // distinct call site.
+{
+    return allocator->allocate(size);
+}
+
+static void *allocateFromSiteTwo(bslma::Allocator *allocator, int size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  Note that this function is not inlined, so as to provide a
+    // distinct call site.
+{
+    return allocator->allocate(size + 0);
+}
+
+typedef void *(*AllocateFunction)(bslma::Allocator *, int);
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Source of Memory Growth
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches the results of two kinds of request, and that
+// we want to know which of the caches accounts for the memory held by the
+// service.  First, we create a profiling allocator that samples every
+// allocation (in production we would use the default sampling interval):
+//..
+    bslma::ProfilingAllocator profiler("service", 1);
+//..
+// Then, we create one proxy for each cache, each attributing allocations to a
+// descriptive tag:
+//..
+    bslma::ProfilingAllocatorProxy quoteCacheAllocator(&profiler,
+                                                       "quote cache");
+    bslma::ProfilingAllocatorProxy tradeCacheAllocator(&profiler,
+                                                       "trade cache");
+//..
+// Next, we simulate the use of the caches by allocating memory through the
+// proxies:
+//..
+    void *quotes[10];
+    for (int i = 0; i < 10; ++i) {
+        quotes[i] = quoteCacheAllocator.allocate(100);
+    }
+    void *trades = tradeCacheAllocator.allocate(5000);
+//..
+// Now, we load the statistics of the sites, which are ordered by decreasing
+// number of bytes in use:
+//..
+    bslma::ProfilingAllocatorSiteStats stats[4];
+    int numSites = profiler.loadSiteStats(stats, 4);
+
+    ASSERT(2 == numSites);
+    ASSERT(0 == std::strcmp("trade cache", stats[0].d_tag_p));
+    ASSERT(5000 == stats[0].d_numBytesInUse);
+    ASSERT(0 == std::strcmp("quote cache", stats[1].d_tag_p));
+    ASSERT(1000 == stats[1].d_numBytesInUse);
+    ASSERT(10 == stats[1].d_numBlocksInUse);
+//..
+// Finally, we free the memory and observe that no memory is reported in use,
+// although the cumulative statistics are retained (a report can also be
+// printed to 'stdout' using the 'print' method):
+//..
+    for (int i = 0; i < 10; ++i) {
+        quoteCacheAllocator.deallocate(quotes[i]);
+    }
+    tradeCacheAllocator.deallocate(trades);
+
+    numSites = profiler.loadSiteStats(stats, 4);
+
+    ASSERT(2 == numSites);
+    ASSERT(0 == stats[0].d_numBytesInUse);
+    ASSERT(0 == stats[1].d_numBytesInUse);
+    ASSERT(5000 + 1000 == stats[0].d_numBytesAllocated
+                         + stats[1].d_numBytesAllocated);
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PRINT
+        //
+        // Concerns:
+        //: 1 'print' reports every site, including the overflow site, and does
+        //:   not alter the state of the allocator.
+        //
+        // Plan:
+        //: 1 Allocate from tagged and untagged sites, invoke 'print' (whose
+        //:   output is inspected visually in verbose mode), and verify that
+        //:   the statistics are unchanged.  (C-1)
+        //
+        // Testing:
+        //   void print() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRINT"
+                            "\n=====\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX("print", 1, &ta);  const Obj& X = mX;
+
+        void *a = mX.allocateTagged(1000, TAG_A);
+        void *b = mX.allocateTagged(250,  TAG_B);
+        void *c = mX.allocate(500);
+
+        Stats before[MAX_SITES];
+        const int numBefore = X.loadSiteStats(before, MAX_SITES);
+
+        if (verbose) {
+            X.print();
+        }
+
+        Stats after[MAX_SITES];
+        const int numAfter = X.loadSiteStats(after, MAX_SITES);
+
+        ASSERTV(numBefore, numAfter, numBefore == numAfter);
+        ASSERT(3 == X.numSampledAllocations());
+        for (int i = 0; i < numBefore && i < numAfter; ++i) {
+            ASSERTV(i, before[i].d_numBytesInUse == after[i].d_numBytesInUse);
+        }
+
+        mX.deallocate(a);
+        mX.deallocate(b);
+        mX.deallocate(c);
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // SITE TABLE OVERFLOW
+        //
+        // Concerns:
+        //: 1 At most 'MAX_NUM_SITES' distinct sites are tracked.
+        //:
+        //: 2 Allocations from sites in excess of 'MAX_NUM_SITES' are
+        //:   attributed to a single overflow site having neither a tag nor an
+        //:   address.
+        //:
+        //: 3 'loadSiteStats' loads at most the requested number of sites, in
+        //:   order of decreasing bytes in use.
+        //
+        // Plan:
+        //: 1 Allocate, with an interval of 1, from 'MAX_NUM_SITES + 44'
+        //:   distinct tags (the elements of an array), with the size of each
+        //:   allocation increasing with the index of the tag.  Verify the
+        //:   number of sites, the statistics of the overflow site, and the
+        //:   ordering of the loaded sites.  (C-1..3)
+        //
+        // Testing:
+        //   SITE TABLE OVERFLOW
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSITE TABLE OVERFLOW"
+                            "\n===================\n");
+
+        enum { NUM_TAGS = Obj::MAX_NUM_SITES + 44 };
+
+        static char tags[NUM_TAGS][2];
+        void       *blocks[NUM_TAGS];
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(1, &ta);  const Obj& X = mX;
+
+        Int64 totalBytes = 0;
+        for (int i = 0; i < NUM_TAGS; ++i) {
+            blocks[i] = mX.allocateTagged(i + 1, tags[i]);
+            totalBytes += i + 1;
+        }
+        ASSERT(NUM_TAGS == X.numSampledAllocations());
+
+        Stats stats[MAX_SITES];
+        const int numSites = X.loadSiteStats(stats, MAX_SITES);
+        ASSERTV(numSites, MAX_SITES == numSites);
+
+        int   numOverflow = 0;
+        Int64 sumBytes    = 0;
+        for (int i = 0; i < numSites; ++i) {
+            sumBytes += stats[i].d_numBytesInUse;
+            if (0 == stats[i].d_tag_p && 0 == stats[i].d_address_p) {
+                ++numOverflow;
+                ASSERTV(stats[i].d_numBlocksInUse, 44 ==
+                                                    stats[i].d_numBlocksInUse);
+            }
+            else {
+                ASSERTV(i, 1 == stats[i].d_numBlocksInUse);
+            }
+            if (i > 0) {
+                ASSERTV(i, stats[i - 1].d_numBytesInUse >=
+                                                     stats[i].d_numBytesInUse);
+            }
+        }
+        ASSERT(1 == numOverflow);
+        ASSERTV(totalBytes, sumBytes, totalBytes == sumBytes);
+
+        if (verbose) printf("\nLoading fewer sites.\n");
+        {
+            Stats few[3];
+            ASSERT(3 == X.loadSiteStats(few, 3));
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, stats[i].d_numBytesInUse == few[i].d_numBytesInUse);
+            }
+            ASSERT(0 == X.loadSiteStats(few, 0));
+        }
+
+        for (int i = 0; i < NUM_TAGS; ++i) {
+            mX.deallocate(blocks[i]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        X.loadSiteStats(stats, MAX_SITES);
+        for (int i = 0; i < numSites; ++i) {
+            ASSERTV(i, 0 == stats[i].d_numBlocksInUse);
+            ASSERTV(i, 0 == stats[i].d_numBytesInUse);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // SAMPLING
+        //
+        // Concerns:
+        //: 1 Allocations smaller than the sampling interval are sampled about
+        //:   once per interval bytes, and each is counted as representing
+        //:   'samplingInterval' bytes.
+        //:
+        //: 2 Allocations at least as large as the sampling interval are
+        //:   always sampled, and counted as representing their size.
+        //:
+        //: 3 The estimated byte counts are within one sampling interval of the
+        //:   actual byte counts (in a single thread).
+        //:
+        //: 4 Blocks that were not sampled do not affect the statistics when
+        //:   deallocated, and all memory is returned to the underlying
+        //:   allocator.
+        //
+        // Plan:
+        //: 1 For a number of small allocation sizes, allocate a large number
+        //:   of blocks with a sampling interval of 1024, and verify the
+        //:   number of sampled allocations and estimated byte counts.
+        //:   (C-1, 3)
+        //:
+        //: 2 Allocate blocks larger than the interval and verify that every
+        //:   one is sampled with its exact size.  (C-2)
+        //:
+        //: 3 Deallocate all blocks and verify that no bytes are reported in
+        //:   use, and that the test allocator has no blocks in use.  (C-4)
+        //
+        // Testing:
+        //   SAMPLING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSAMPLING"
+                            "\n========\n");
+
+        enum { INTERVAL = 1024, NUM_BLOCKS = 2000 };
+
+        static const int SIZES[] = { 1, 8, 24, 100, 1000, 1023 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            bslma::TestAllocator ta(veryVerbose);
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+            ASSERT(INTERVAL == X.samplingInterval());
+
+            static void *blocks[NUM_BLOCKS];
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocateTagged(SIZE, TAG_A);
+            }
+
+            const Int64 ACTUAL  = static_cast<Int64>(SIZE) * NUM_BLOCKS;
+            const Int64 SAMPLES = X.numSampledAllocations();
+
+            ASSERTV(SIZE, SAMPLES, ACTUAL / INTERVAL == SAMPLES);
+
+            Stats stats[MAX_SITES];
+            ASSERT(1 == X.loadSiteStats(stats, MAX_SITES));
+
+            const Int64 ESTIMATE = stats[0].d_numBytesInUse;
+            ASSERTV(SIZE, ESTIMATE, SAMPLES * INTERVAL == ESTIMATE);
+            ASSERTV(SIZE, ESTIMATE, ACTUAL - ESTIMATE < INTERVAL);
+            ASSERTV(SIZE, ESTIMATE == stats[0].d_numBytesAllocated);
+            ASSERTV(SIZE, SAMPLES == stats[0].d_numBlocksInUse);
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocateSized(blocks[i], SIZE);
+            }
+
+            ASSERT(1 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERTV(SIZE, 0 == stats[0].d_numBytesInUse);
+            ASSERTV(SIZE, 0 == stats[0].d_numBlocksInUse);
+            ASSERTV(SIZE, ESTIMATE == stats[0].d_numBytesAllocated);
+            ASSERTV(SIZE, 0 == ta.numBlocksInUse());
+            ASSERTV(SIZE, 0 == ta.numMismatches());
+        }
+
+        if (verbose) printf("\nLarge allocations are always sampled.\n");
+        {
+            bslma::TestAllocator ta(veryVerbose);
+            Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+            static const int LARGE_SIZES[] = { 1024, 1025, 4000, 1024, 2048 };
+            const int NUM_LARGE = sizeof LARGE_SIZES / sizeof *LARGE_SIZES;
+
+            void  *blocks[NUM_LARGE];
+            Int64  total = 0;
+
+            void *small = mX.allocateTagged(3, TAG_B);
+
+            for (int i = 0; i < NUM_LARGE; ++i) {
+                blocks[i] = mX.allocateTagged(LARGE_SIZES[i], TAG_A);
+                total += LARGE_SIZES[i];
+
+                ASSERTV(i, i + 1 == X.numSampledAllocations());
+            }
+
+            Stats stats[MAX_SITES];
+            ASSERT(1 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERT(TAG_A == stats[0].d_tag_p);
+            ASSERTV(total, stats[0].d_numBytesInUse,
+                    total == stats[0].d_numBytesInUse);
+
+            for (int i = 0; i < NUM_LARGE; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(small);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ATTRIBUTION TO RETURN ADDRESSES
+        //
+        // Concerns:
+        //: 1 On platforms providing return addresses, untagged allocations
+        //:   from the same call site are attributed to the same site, and
+        //:   allocations from different call sites to different sites.
+        //:
+        //: 2 On other platforms, untagged allocations are attributed to the
+        //:   overflow site.
+        //
+        // Plan:
+        //: 1 Allocate repeatedly through two distinct (non-inlined) functions
+        //:   and verify the number and contents of the sites.  (C-1..2)
+        //
+        // Testing:
+        //   ATTRIBUTION TO RETURN ADDRESSES
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nATTRIBUTION TO RETURN ADDRESSES"
+                            "\n===============================\n");
+
+        // Call through volatile function pointers to discourage inlining.
+
+        AllocateFunction volatile siteOne = &allocateFromSiteOne;
+        AllocateFunction volatile siteTwo = &allocateFromSiteTwo;
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(1, &ta);  const Obj& X = mX;
+
+        void *blocks[8];
+        for (int i = 0; i < 5; ++i) {
+            blocks[i] = siteOne(&mX, 10);
+        }
+        for (int i = 5; i < 8; ++i) {
+            blocks[i] = siteTwo(&mX, 100);
+        }
+
+        Stats stats[MAX_SITES];
+        const int numSites = X.loadSiteStats(stats, MAX_SITES);
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        ASSERTV(numSites, 2 == numSites);
+
+        ASSERT(0   == stats[0].d_tag_p);
+        ASSERT(0   != stats[0].d_address_p);
+        ASSERT(300 == stats[0].d_numBytesInUse);
+        ASSERT(3   == stats[0].d_numBlocksInUse);
+
+        ASSERT(0   == stats[1].d_tag_p);
+        ASSERT(0   != stats[1].d_address_p);
+        ASSERT(50  == stats[1].d_numBytesInUse);
+        ASSERT(5   == stats[1].d_numBlocksInUse);
+
+        ASSERT(stats[0].d_address_p != stats[1].d_address_p);
+#else
+        ASSERTV(numSites, 1 == numSites);
+
+        ASSERT(0   == stats[0].d_tag_p);
+        ASSERT(0   == stats[0].d_address_p);
+        ASSERT(350 == stats[0].d_numBytesInUse);
+#endif
+
+        for (int i = 0; i < 8; ++i) {
+            mX.deallocate(blocks[i]);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // EXACT PROFILING
+        //
+        // Concerns:
+        //: 1 With a sampling interval of 1, every allocation is sampled and
+        //:   the statistics of each site are exact.
+        //:
+        //: 2 Allocations through 'allocateTagged', or through a proxy, are
+        //:   attributed to the supplied tag, identified by its address.
+        //:
+        //: 3 'deallocate' and 'deallocateSized' update the statistics of the
+        //:   site to which the block was attributed, and return the block
+        //:   (with its correct size) to the underlying allocator.
+        //:
+        //: 4 Allocating 0 bytes returns 0, and deallocating 0 has no effect.
+        //:
+        //: 5 The returned memory is maximally aligned and writable.
+        //:
+        //: 6 The accessors of the proxy return the values supplied at
+        //:   construction.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, directly and through proxies,
+        //:   write to them, verify their alignment, and verify the statistics
+        //:   loaded by 'loadSiteStats' after each allocation and deallocation.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   ProfilingAllocatorProxy(ProfilingAllocator *, const char *);
+        //   ~ProfilingAllocatorProxy();
+        //   void *allocate(size_type size);
+        //   void *allocateTagged(size_type size, const char *tag);
+        //   void deallocate(void *address);
+        //   void deallocateSized(void *address, size_type size);
+        //   void *ProfilingAllocatorProxy::allocate(size_type size);
+        //   void ProfilingAllocatorProxy::deallocate(void *address);
+        //   void ProfilingAllocatorProxy::deallocateSized(void *, size_type);
+        //   Int64 numSampledAllocations() const;
+        //   int loadSiteStats(ProfilingAllocatorSiteStats *, int) const;
+        //   ProfilingAllocator *ProfilingAllocatorProxy::profiler() const;
+        //   const char *ProfilingAllocatorProxy::tag() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXACT PROFILING"
+                            "\n===============\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        Obj mX(1, &ta);  const Obj& X = mX;
+
+        Proxy mP(&mX, TAG_B);  const Proxy& P = mP;
+        ASSERT(&mX   == P.profiler());
+        ASSERT(TAG_B == P.tag());
+
+        Stats stats[MAX_SITES];
+
+        if (verbose) printf("\nAllocating 0 bytes.\n");
+        {
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == mX.allocateTagged(0, TAG_A));
+            ASSERT(0 == mP.allocate(0));
+            mX.deallocate(0);
+            mX.deallocateSized(0, 0);
+            mP.deallocate(0);
+
+            ASSERT(0 == X.numSampledAllocations());
+            ASSERT(0 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERT(0 == ta.numBlocksTotal());
+        }
+
+        if (verbose) printf("\nAllocating from tags.\n");
+
+        static const int SIZES[] = { 1, 2, 7, 8, 15, 16, 100, 1000, 4096 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        void *blocksA[NUM_SIZES];
+        void *blocksB[NUM_SIZES];
+        Int64 totalBytes = 0;
+
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            blocksA[i] = mX.allocateTagged(SIZE, TAG_A);
+            blocksB[i] = mP.allocate(SIZE);
+            totalBytes += SIZE;
+
+            ASSERTV(i, 0 == (reinterpret_cast<bsls::Types::UintPtr>(blocksA[i])
+                             % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+            ASSERTV(i, 0 == (reinterpret_cast<bsls::Types::UintPtr>(blocksB[i])
+                             % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT));
+            memset(blocksA[i], 0xA5, SIZE);
+            memset(blocksB[i], 0x5A, SIZE);
+
+            ASSERTV(i, 2 * (i + 1) == X.numSampledAllocations());
+            ASSERTV(i, 2 * (i + 1) == ta.numBlocksInUse());
+
+            // Each block is preceded by a maximally-aligned header, which is
+            // not counted in the statistics of its site.
+
+            const Int64 HEADERS = 2 * (i + 1)
+                                * bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+            ASSERTV(i, 2 * totalBytes + HEADERS == ta.numBytesInUse());
+
+            ASSERT(2 == X.loadSiteStats(stats, MAX_SITES));
+
+            const Stats *a = findTag(stats, 2, TAG_A);
+            const Stats *b = findTag(stats, 2, TAG_B);
+            ASSERT(a);
+            ASSERT(b);
+            if (a && b) {
+                ASSERTV(i, 0          == a->d_address_p);
+                ASSERTV(i, i + 1      == a->d_numAllocations);
+                ASSERTV(i, i + 1      == a->d_numBlocksInUse);
+                ASSERTV(i, totalBytes == a->d_numBytesAllocated);
+                ASSERTV(i, totalBytes == a->d_numBytesInUse);
+                ASSERTV(i, i + 1      == b->d_numAllocations);
+                ASSERTV(i, totalBytes == b->d_numBytesInUse);
+            }
+        }
+
+        if (verbose) printf("\nDeallocating.\n");
+
+        Int64 bytesInUse = totalBytes;
+        for (int i = 0; i < NUM_SIZES; ++i) {
+            const int SIZE = SIZES[i];
+
+            if (i % 2) {
+                mX.deallocate(blocksA[i]);
+                mP.deallocateSized(blocksB[i], SIZE);
+            }
+            else {
+                mX.deallocateSized(blocksA[i], SIZE);
+                mP.deallocate(blocksB[i]);
+            }
+            bytesInUse -= SIZE;
+
+            ASSERT(2 == X.loadSiteStats(stats, MAX_SITES));
+
+            const Stats *a = findTag(stats, 2, TAG_A);
+            const Stats *b = findTag(stats, 2, TAG_B);
+            ASSERT(a);
+            ASSERT(b);
+            if (a && b) {
+                ASSERTV(i, NUM_SIZES         == a->d_numAllocations);
+                ASSERTV(i, NUM_SIZES - i - 1 == a->d_numBlocksInUse);
+                ASSERTV(i, totalBytes        == a->d_numBytesAllocated);
+                ASSERTV(i, bytesInUse        == a->d_numBytesInUse);
+                ASSERTV(i, bytesInUse        == b->d_numBytesInUse);
+            }
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == ta.numMismatches());
+        ASSERT(2 * NUM_SIZES == X.numSampledAllocations());
+
+        if (verbose) printf("\nAllocating without a tag.\n");
+        {
+            void *p = mX.allocate(24);
+            ASSERT(p);
+            ASSERT(2 * NUM_SIZES + 1 == X.numSampledAllocations());
+            ASSERT(3 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERT(0  == stats[0].d_tag_p);
+            ASSERT(24 == stats[0].d_numBytesInUse);
+            mX.deallocate(p);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor sets the name and sampling interval as
+        //:   specified, or to their default values.
+        //:
+        //: 2 If an allocator is not supplied, the default allocator is used.
+        //:
+        //: 3 A newly created object has no sampled allocations and no sites.
+        //:
+        //: 4 The object requires no extended alignment, so that it can be
+        //:   created by 'new' (which need not provide extended alignment).
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, while a test allocator is installed as the default,
+        //:   and verify the accessors and the source of allocated memory.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that the alignment of the object does not exceed the
+        //:   maximal alignment of a fundamental type.  (C-4)
+        //
+        // Testing:
+        //   ProfilingAllocator(Allocator *ba = 0);
+        //   ProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+        //   ProfilingAllocator(const char *, Int64 interval, Allocator *ba);
+        //   ~ProfilingAllocator();
+        //   const char *name() const;
+        //   Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTORS AND BASIC ACCESSORS"
+                            "\n================================\n");
+
+        const int ALIGNMENT = bsls::AlignmentFromType<Obj>::VALUE;
+        ASSERT(ALIGNMENT <= bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+        bslma::TestAllocator da(veryVerbose);
+        bslma::TestAllocator oa(veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        Stats stats[MAX_SITES];
+
+        for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+            const char CONFIG = cfg;
+
+            Obj                  *objPtr = 0;
+            bslma::TestAllocator *expAllocator = &da;
+            const char           *expName = 0;
+            Int64                 expInterval = Obj::DEFAULT_SAMPLING_INTERVAL;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new Obj();
+              } break;
+              case 'b': {
+                objPtr = new Obj(&oa);
+                expAllocator = &oa;
+              } break;
+              case 'c': {
+                objPtr = new Obj(4096);
+                expInterval = 4096;
+              } break;
+              case 'd': {
+                objPtr = new Obj(1, &oa);
+                expAllocator = &oa;
+                expInterval = 1;
+              } break;
+              case 'e': {
+                objPtr = new Obj("name", 77);
+                expName = "name";
+                expInterval = 77;
+              } break;
+              case 'f': {
+                objPtr = new Obj("other", 0, &oa);
+                expAllocator = &oa;
+                expName = "other";
+                expInterval = 0;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            ASSERTV(CONFIG, expInterval == X.samplingInterval());
+            ASSERTV(CONFIG, (0 == expName && 0 == X.name())
+                         || (expName && 0 == strcmp(expName, X.name())));
+            ASSERTV(CONFIG, 0 == X.numSampledAllocations());
+            ASSERTV(CONFIG, 0 == X.loadSiteStats(stats, MAX_SITES));
+
+            const Int64 numBlocks = expAllocator->numBlocksTotal();
+
+            void *p = mX.allocateTagged(8, TAG_A);
+            ASSERTV(CONFIG, numBlocks + 1 == expAllocator->numBlocksTotal());
+            mX.deallocate(p);
+            ASSERTV(CONFIG, 0 == expAllocator->numBlocksInUse());
+
+            delete objPtr;
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta(veryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(Obj::DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+
+            void *p = mX.allocate(Obj::DEFAULT_SAMPLING_INTERVAL);
+            ASSERT(p);
+            ASSERT(1 == X.numSampledAllocations());
+            ASSERT(1 == ta.numBlocksInUse());
+
+            void *q = mX.allocateTagged(10, TAG_A);
+            ASSERT(q);
+            ASSERT(1 == X.numSampledAllocations());
+            ASSERT(2 == ta.numBlocksInUse());
+
+            Stats stats[MAX_SITES];
+            ASSERT(1 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERT(Obj::DEFAULT_SAMPLING_INTERVAL == stats[0].d_numBytesInUse);
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == ta.numBlocksInUse());
+
+            ASSERT(1 == X.loadSiteStats(stats, MAX_SITES));
+            ASSERT(0 == stats[0].d_numBytesInUse);
+            ASSERT(Obj::DEFAULT_SAMPLING_INTERVAL ==
+                                                 stats[0].d_numBytesAllocated);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
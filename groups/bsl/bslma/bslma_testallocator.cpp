@@ -759,6 +759,39 @@ void TestAllocator::deallocate(void *address)
     d_allocator_p->deallocate(align);
 }
 
+void TestAllocator::deallocateSized(void *address, size_type size)
+{
+    if (address) {
+        Align *align = ((Align *) address) - 1;
+
+        // Only check the size of blocks that appear to be currently allocated
+        // from this allocator; any other problem with 'address' is diagnosed
+        // by 'deallocate'.
+
+        if (ALLOCATED_MEMORY == align->d_object.d_magicNumber
+         && this             == align->d_object.d_id_p
+         && size             != align->d_object.d_bytes) {
+            ++d_numMismatches;
+
+            if (!d_quietFlag) {
+                std::printf("*** Size mismatch: %lld-byte block at %p "
+                            "deallocated with size %lld ***\n",
+                            static_cast<bsls::Types::Int64>(
+                                                     align->d_object.d_bytes),
+                            address,
+                            static_cast<bsls::Types::Int64>(size));
+                std::fflush(stdout);
+
+                if (!d_noAbortFlag) {
+                    std::abort();                                     // ABORT
+                }
+            }
+        }
+    }
+
+    deallocate(address);
+}
+
 // ACCESSORS
 int TestAllocator::status() const
 {
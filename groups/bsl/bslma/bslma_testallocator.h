@@ -45,6 +45,7 @@ BSLS_IDENT("$Id: $")
 //     `----------------'
 //                     allocate
 //                     deallocate
+//                     deallocateSized
 //..
 // If exceptions are enabled, this allocator can be configured to throw an
 // exception after the number of allocation requests exceeds some specified
@@ -467,6 +468,17 @@ class TestAllocator : public Allocator {
         // details of the mismatch to 'stdout' (e.g., as an 'std::hex' memory
         // dump) and abort.
 
+    void deallocateSized(void *address, size_type size);
+        // Return the memory block at the specified 'address', allocated with
+        // the specified 'size' (in bytes), back to this allocator.  If
+        // 'address' is 0, this function has no effect (e.g., on
+        // allocation/deallocation statistics).  If the memory at 'address' is
+        // consistent with being allocated from this test allocator, but with
+        // a size other than 'size', increment the number of mismatches, and
+        // -- unless in quiet mode -- report the mismatch to 'stdout' and
+        // abort.  Otherwise (or if not aborted), deallocate the block as if by
+        // a call to 'deallocate(address)'.
+
     void setAllocationLimit(bsls::Types::Int64 limit);
         // Set the number of valid allocation requests before an exception is
         // to be thrown for this allocator to the specified 'limit'.  If
@@ -51,6 +51,7 @@ using namespace std;
 // [ 2] ~bslma::TestAllocator();
 // [ 3] void *allocate(int size);
 // [ 3] void deallocate(void *address);
+// [12] void deallocateSized(void *address, size_type size);
 // [ 2] void setNoAbort(int noAbortFlag);
 // [ 2] void setQuiet(int quietFlag);
 // [ 2] void setVerbose(int verboseFlag);
@@ -77,7 +78,7 @@ using namespace std;
 //
 // [ 4] ostream& operator<<(ostream& lhs, const bslma::TestAllocator& rhs);
 //-----------------------------------------------------------------------------
-// [ 9] USAGE TEST - Make sure usage example for exception neutrality works.
+// [13] USAGE TEST - Make sure usage example for exception neutrality works.
 // [ 5] Ensure that exception is thrown after allocation limit is exceeded.
 // [ 1] Make sure that all counts are initialized to zero (placement new).
 // [ 1] Make sure that global operators new and delete are *not* called.
@@ -92,6 +93,7 @@ using namespace std;
 // [ 8] Ensure that cross allocation/deallocation is detected immediately.
 // [10] Test 'numBlocksInUse', 'numBlocksTotal'
 // [11] Ensure that over and underruns are properly caught.
+// [12] Ensure that sized deallocations of the wrong size are detected.
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
 //-----------------------------------------------------------------------------
@@ -439,7 +441,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator testAllocator(veryVeryVerbose);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TEST USAGE
         //   Verify that the usage example for testing exception neutrality is
@@ -555,6 +557,94 @@ int main(int argc, char *argv[])
 // Note that the 'BDE_BUILD_TARGET_EXC' macro is defined at compile-time to
 // indicate whether or not exceptions are enabled.
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'deallocateSized'
+        //
+        // Concerns:
+        //: 1 A block deallocated by 'deallocateSized' with the size that was
+        //:   used to allocate it is deallocated exactly as by 'deallocate'.
+        //:
+        //: 2 A block deallocated with a size other than the size that was
+        //:   used to allocate it is reported as a mismatch, and the block is
+        //:   still returned to the allocator.
+        //:
+        //: 3 Deallocating a null pointer has no effect other than to be
+        //:   counted as a deallocation.
+        //:
+        //: 4 The method is invoked when called through the base class.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, deallocate them through a
+        //:   'bslma::Allocator' reference using 'deallocateSized' with the
+        //:   correct size, and verify the statistics.  (C-1, 4)
+        //:
+        //: 2 In quiet mode, deallocate a block with an incorrect size and
+        //:   verify that 'numMismatches' is incremented, and that the block
+        //:   is no longer in use.  (C-2)
+        //:
+        //: 3 Call 'deallocateSized' with a null address.  (C-3)
+        //
+        // Testing:
+        //   void deallocateSized(void *address, size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'deallocateSized'" << endl
+                                  << "=========================" << endl;
+
+        bslma::TestAllocator  mX(veryVeryVerbose);
+        const bslma::TestAllocator& X = mX;
+        bslma::Allocator&     base = mX;
+
+        if (verbose) cout << "\nCorrect sizes." << endl;
+        {
+            const int SIZES[] = { 1, 2, 3, 7, 8, 9, 16, 100, 1000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const int SIZE = SIZES[i];
+
+                void *p = base.allocate(SIZE);
+                LOOP_ASSERT(i, 1    == X.numBlocksInUse());
+                LOOP_ASSERT(i, SIZE == X.numBytesInUse());
+
+                base.deallocateSized(p, SIZE);
+                LOOP_ASSERT(i, 0    == X.numBlocksInUse());
+                LOOP_ASSERT(i, 0    == X.numBytesInUse());
+                LOOP_ASSERT(i, SIZE == X.lastDeallocatedNumBytes());
+                LOOP_ASSERT(i, p    == X.lastDeallocatedAddress());
+                LOOP_ASSERT(i, 0    == X.numMismatches());
+            }
+        }
+
+        if (verbose) cout << "\nIncorrect size." << endl;
+        {
+            mX.setQuiet(true);
+
+            void *p = base.allocate(10);
+            base.deallocateSized(p, 11);
+
+            ASSERT(1  == X.numMismatches());
+            ASSERT(0  == X.numBlocksInUse());
+            ASSERT(0  == X.numBytesInUse());
+            ASSERT(10 == X.lastDeallocatedNumBytes());
+
+            mX.setQuiet(false);
+        }
+
+        if (verbose) cout << "\nNull address." << endl;
+        {
+            const bsls::Types::Int64 NUM_DEALLOCATIONS =
+                                                        X.numDeallocations();
+
+            base.deallocateSized(0, 0);
+
+            ASSERT(NUM_DEALLOCATIONS + 1 == X.numDeallocations());
+            ASSERT(0                     == X.lastDeallocatedAddress());
+            ASSERT(1                     == X.numMismatches());
+        }
+
       } break;
       case 11: {
         // --------------------------------------------------------------------
@@ -30,9 +30,13 @@
       'bsls_bsltestutil.cpp',
       'bsls_buildtarget.cpp',
       'bsls_byteorder.cpp',
+      'bsls_cachelinepadded.cpp',
+      'bsls_coarseclock.cpp',
       'bsls_compilerfeatures.cpp',
+      'bsls_eventtrace.cpp',
       'bsls_exceptionutil.cpp',
       'bsls_ident.cpp',
+      'bsls_latencyhistogram.cpp',
       'bsls_macroincrement.cpp',
       'bsls_nativestd.cpp',
       'bsls_nullptr.cpp',
@@ -40,6 +44,8 @@
       'bsls_performancehint.cpp',
       'bsls_platform.cpp',
       'bsls_protocoltest.cpp',
+      'bsls_shardedcounter.cpp',
+      'bsls_spinlock.cpp',
       'bsls_stopwatch.cpp',
       'bsls_timeutil.cpp',
       'bsls_types.cpp',
@@ -76,9 +82,13 @@
       'bsls_bsltestutil.t',
       'bsls_buildtarget.t',
       'bsls_byteorder.t',
+      'bsls_cachelinepadded.t',
+      'bsls_coarseclock.t',
       'bsls_compilerfeatures.t',
+      'bsls_eventtrace.t',
       'bsls_exceptionutil.t',
       'bsls_ident.t',
+      'bsls_latencyhistogram.t',
       'bsls_macroincrement.t',
       'bsls_nativestd.t',
       'bsls_nullptr.t',
@@ -86,6 +96,8 @@
       'bsls_performancehint.t',
       'bsls_platform.t',
       'bsls_protocoltest.t',
+      'bsls_shardedcounter.t',
+      'bsls_spinlock.t',
       'bsls_stopwatch.t',
       'bsls_timeutil.t',
       'bsls_types.t',
@@ -122,9 +134,13 @@
       '<(PRODUCT_DIR)/bsls_bsltestutil.t',
       '<(PRODUCT_DIR)/bsls_buildtarget.t',
       '<(PRODUCT_DIR)/bsls_byteorder.t',
+      '<(PRODUCT_DIR)/bsls_cachelinepadded.t',
+      '<(PRODUCT_DIR)/bsls_coarseclock.t',
       '<(PRODUCT_DIR)/bsls_compilerfeatures.t',
+      '<(PRODUCT_DIR)/bsls_eventtrace.t',
       '<(PRODUCT_DIR)/bsls_exceptionutil.t',
       '<(PRODUCT_DIR)/bsls_ident.t',
+      '<(PRODUCT_DIR)/bsls_latencyhistogram.t',
       '<(PRODUCT_DIR)/bsls_macroincrement.t',
       '<(PRODUCT_DIR)/bsls_nativestd.t',
       '<(PRODUCT_DIR)/bsls_nullptr.t',
@@ -132,6 +148,8 @@
       '<(PRODUCT_DIR)/bsls_performancehint.t',
       '<(PRODUCT_DIR)/bsls_platform.t',
       '<(PRODUCT_DIR)/bsls_protocoltest.t',
+      '<(PRODUCT_DIR)/bsls_shardedcounter.t',
+      '<(PRODUCT_DIR)/bsls_spinlock.t',
       '<(PRODUCT_DIR)/bsls_stopwatch.t',
       '<(PRODUCT_DIR)/bsls_timeutil.t',
       '<(PRODUCT_DIR)/bsls_types.t',
@@ -432,6 +450,22 @@
         [ 'OS == "win"',  {'link_settings': {'libraries': [ 'ws2_32.lib'] } } ],
       ],
     },
+    {
+      'target_name': 'bsls_cachelinepadded.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_cachelinepadded.t.cpp' ],
+    },
+    {
+      'target_name': 'bsls_coarseclock.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_coarseclock.t.cpp' ],
+    },
     {
       'target_name': 'bsls_compilerfeatures.t',
       'type': 'executable',
@@ -440,6 +474,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_compilerfeatures.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_eventtrace.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_eventtrace.t.cpp' ],
+    },
     {
       'target_name': 'bsls_exceptionutil.t',
       'type': 'executable',
@@ -456,6 +498,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_ident.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_latencyhistogram.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_latencyhistogram.t.cpp' ],
+    },
     {
       'target_name': 'bsls_macroincrement.t',
       'type': 'executable',
@@ -512,6 +562,22 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bsls_protocoltest.t.cpp' ],
     },
+    {
+      'target_name': 'bsls_shardedcounter.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_shardedcounter.t.cpp' ],
+    },
+    {
+      'target_name': 'bsls_spinlock.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bsls_pkgdeps)', 'bsls' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bsls_spinlock.t.cpp' ],
+    },
     {
       'target_name': 'bsls_stopwatch.t',
       'type': 'executable',
@@ -19,7 +19,11 @@ BSLS_IDENT("$Id: $")
 // constant 'VALUE' initialized (at compile-time) to the required alignment for
 // 'TYPE'.  'bsls::AlignmentFromType' also provides a 'typedef', 'Type', that
 // is an alias for a primitive type that has the same alignment requirements as
-// 'TYPE'.
+// 'TYPE'.  Note that, if 'TYPE' has an extended alignment (i.e., one greater
+// than that of any primitive type, such as a type declared with an explicit
+// cache-line alignment attribute), 'VALUE' is still the alignment of 'TYPE',
+// but 'Type' is the most-aligned primitive type, whose alignment is less than
+// 'VALUE'.
 //
 ///Terminology
 ///-----------
@@ -340,7 +344,8 @@ struct AlignmentFromType {
 
     typedef typename AlignmentToType<VALUE>::Type Type;
         // Alias for a primitive type that has the same alignment requirement
-        // as 'TYPE'.
+        // as 'TYPE', or the most-aligned primitive type if 'TYPE' has an
+        // extended alignment.
 };
 
 }  // close package namespace
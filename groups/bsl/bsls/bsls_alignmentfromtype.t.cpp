@@ -451,6 +451,10 @@ struct S4 { short d_shorts[5]; char d_c;  S4(int); private: S4(const S4&); };
  && defined(BSLS_PLATFORM_CPU_X86)
 struct S5 { long long d_longLong __attribute__((__aligned__(8))); };
 #endif
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+struct S6 { char d_c __attribute__((__aligned__(64))); };
+    // Over-aligned type: its alignment exceeds that of every primitive type.
+#endif
 union  U1 { char d_c; int *d_pointer; };
 
 //=============================================================================
@@ -823,6 +827,28 @@ int main(int argc, char *argv[])
                             int()));
 #endif // end defined(BSLS_PLATFORM_CPU_64_BIT)
         }
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        if (verbose) cout << "\nTesting over-aligned type." << endl;
+        {
+            // 'VALUE' reports the true alignment of an over-aligned type,
+            // whereas 'Type' is the most-aligned primitive type.
+
+            typedef bsls::AlignmentFromType<S6>::Type          Type;
+            typedef bsls::AlignmentFromType<long double>::Type LDType;
+            typedef bsls::AlignmentFromType<double>::Type      DType;
+            typedef bsls::AlignmentFromType<void *>::Type      PType;
+
+            const int S6_ALIGNMENT = bsls::AlignmentFromType<S6>::VALUE;
+            const int TYPE_ALIGNMENT = bsls::AlignmentFromType<Type>::VALUE;
+
+            LOOP_ASSERT(S6_ALIGNMENT, 64 == S6_ALIGNMENT);
+            LOOP_ASSERT(TYPE_ALIGNMENT, TYPE_ALIGNMENT < S6_ALIGNMENT);
+            ASSERT(bsls::AlignmentFromType<LDType>::VALUE <= TYPE_ALIGNMENT);
+            ASSERT(bsls::AlignmentFromType<DType>::VALUE  <= TYPE_ALIGNMENT);
+            ASSERT(bsls::AlignmentFromType<PType>::VALUE  <= TYPE_ALIGNMENT);
+        }
+#endif
       } break;
 
       default: {
@@ -288,6 +288,30 @@ struct AlignmentImp8ByteAlignedType {
 };
 #endif
 
+                // ========================================
+                // struct AlignmentImpCacheLineAlignedType
+                // ========================================
+
+struct AlignmentImpCacheLineAlignedType {
+    // This 'struct' is aligned on, and has the size of, a cache line of the
+    // target processor ('BSLS_PLATFORM_CACHE_LINE_SIZE' bytes), and is used
+    // to place objects on cache lines of their own.  On compilers lacking a
+    // means of specifying alignment, this type has the size of a cache line
+    // but only the alignment of 'd_dummy'.
+
+#if defined(BSLS_PLATFORM_CMP_GNU)                                            \
+ || defined(BSLS_PLATFORM_CMP_CLANG)                                          \
+ || defined(BSLS_PLATFORM_CMP_IBM)
+    char d_dummy[BSLS_PLATFORM_CACHE_LINE_SIZE]
+        __attribute__((__aligned__(BSLS_PLATFORM_CACHE_LINE_SIZE)));
+#elif defined(BSLS_PLATFORM_CMP_MSVC)
+    __declspec(align(BSLS_PLATFORM_CACHE_LINE_SIZE))
+    char d_dummy[BSLS_PLATFORM_CACHE_LINE_SIZE];
+#else
+    char d_dummy[BSLS_PLATFORM_CACHE_LINE_SIZE];
+#endif
+};
+
                 // =================================
                 // struct AlignmentImpPriorityToType
                 // =================================
@@ -433,9 +457,72 @@ struct AlignmentImpMatch {
     static BSLS_ALIGNMENTIMP_MATCH_FUNC(AlignmentImp8ByteAlignedType,      13);
 #endif
 
+    enum {
+        // Priority returned when no primitive type matches the requested
+        // alignment.
+
+        BSLS_NO_MATCH_PRIORITY = 14
+    };
+
+    static AlignmentImpTag<BSLS_NO_MATCH_PRIORITY> match(...);
+        // This function will match an alignment for which there is no
+        // primitive type (e.g., the extended alignment of a type declared with
+        // an explicit alignment attribute), and return an object whose size
+        // is 'BSLS_NO_MATCH_PRIORITY'.
+
     typedef AlignmentImp_Priority<13> MaxPriority;
 };
 
+                // =====================================
+                // struct AlignmentImpPriorityToType<14>
+                // =====================================
+
+template <>
+struct AlignmentImpPriorityToType<AlignmentImpMatch::BSLS_NO_MATCH_PRIORITY> {
+    // This specialization of 'AlignmentImpPriorityToType' provides the
+    // most-aligned primitive type (as a 'Type' 'typedef'), used when no
+    // primitive type has the requested alignment.
+
+  private:
+    // PRIVATE TYPES
+    typedef void (*FuncPtr)();
+
+    union MaxAlignedUnion {
+        // This 'union' has the alignment of the most-aligned primitive type.
+
+        char         d_char;
+        short        d_short;
+        int          d_int;
+        long         d_long;
+        long long    d_longLong;
+        bool         d_bool;
+        wchar_t      d_wchar_t;
+        void        *d_pointer;
+        FuncPtr      d_funcPointer;
+        float        d_float;
+        double       d_double;
+        long double  d_longDouble;
+#if defined(BSLS_PLATFORM_CPU_X86) && defined(BSLS_PLATFORM_CMP_GNU)
+        AlignmentImp8ByteAlignedType
+                     d_8BAlignedType;
+#endif
+    };
+
+    enum {
+        MAX_ALIGNMENT = AlignmentImpCalc<MaxAlignedUnion>::VALUE,
+
+        PRIORITY = sizeof(AlignmentImpMatch::match(
+                                        AlignmentImpTag<MAX_ALIGNMENT>(),
+                                        AlignmentImpTag<MAX_ALIGNMENT>(),
+                                        AlignmentImpMatch::MaxPriority()))
+    };
+
+  public:
+    // TYPES
+    typedef AlignmentImpPriorityToType<PRIORITY>::Type Type;
+        // Alias for the most-aligned primitive type.
+};
+
 }  // close package namespace
 
 #undef BSLS_ALIGNMENTIMP_MATCH_FUNC
@@ -17,7 +17,11 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a meta-function,
 // 'bsls::AlignmentToType', parameterized on an integral 'ALIGNMENT', that
 // declares a 'typedef' ('Type'), which is an alias for a primitive type having
-// the indicated 'ALIGNMENT' requirement.
+// the indicated 'ALIGNMENT' requirement.  If no primitive type has the
+// indicated 'ALIGNMENT' (e.g., 'ALIGNMENT' is greater than the alignment of
+// every primitive type, as can be the case for types declared with an
+// explicit, extended alignment), 'Type' is an alias for the most-aligned
+// primitive type on the platform.
 //
 ///Usage
 ///-----
@@ -279,7 +283,8 @@ namespace bsls {
 template <int ALIGNMENT>
 struct AlignmentToType {
     // This 'struct' provides a 'typedef', 'Type', that aliases a primitive
-    // type having the specified 'ALIGNMENT' requirement.
+    // type having the specified 'ALIGNMENT' requirement, or the most-aligned
+    // primitive type if no primitive type has the 'ALIGNMENT' requirement.
 
   private:
     // PRIVATE TYPES
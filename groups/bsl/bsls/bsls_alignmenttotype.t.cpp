@@ -714,6 +714,22 @@ int main(int argc, char *argv[])
                              int()));
 #endif // end defined(BSLS_PLATFORM_CPU_64_BIT)
 
+        if (verbose) cout << "\nTesting alignments having no primitive."
+                          << endl;
+        {
+            // An alignment exceeding that of every primitive type maps to the
+            // most-aligned primitive type.
+
+            typedef bsls::AlignmentToType<1024>::Type MaxType;
+            const int MAX_ALIGNMENT = bsls::AlignmentImpCalc<MaxType>::VALUE;
+
+            LOOP_ASSERT(MAX_ALIGNMENT, LONG_DOUBLE_ALIGNMENT <= MAX_ALIGNMENT);
+            LOOP_ASSERT(MAX_ALIGNMENT, DOUBLE_ALIGNMENT      <= MAX_ALIGNMENT);
+            LOOP_ASSERT(MAX_ALIGNMENT, INT64_ALIGNMENT       <= MAX_ALIGNMENT);
+            LOOP_ASSERT(MAX_ALIGNMENT, PTR_ALIGNMENT         <= MAX_ALIGNMENT);
+            LOOP_ASSERT(MAX_ALIGNMENT, FUNC_PTR_ALIGNMENT    <= MAX_ALIGNMENT);
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `"<< test << "' NOT FOUND." <<endl;
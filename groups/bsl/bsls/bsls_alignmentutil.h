@@ -33,6 +33,23 @@ BSLS_IDENT("$Id: $")
 // aligned.  Finally, 'roundUpToMaximalAlignment' returns the smallest whole
 // multiple of 'BSLS_MAX_ALIGNMENT' greater than or equal to its argument.
 //
+///Cache-Line Alignment
+///--------------------
+// Objects written frequently by different threads should reside on distinct
+// cache lines, lest every write by one thread invalidate the copy of the line
+// held by the others ("false sharing").  The 'BSLS_CACHE_LINE_SIZE' enumerator
+// provides the size of a cache line on the target processor (see
+// 'BSLS_PLATFORM_CACHE_LINE_SIZE' in 'bsls_platform'), and the
+// 'CacheLineAlignedType' 'typedef' specifies a type that is aligned on (and
+// has the size of) a cache line, where the compiler supports such alignment.
+// Note that 'CacheLineAlignedType' is *not* a primitive type, and that its
+// alignment may exceed 'BSLS_MAX_ALIGNMENT', so that it is not suitable for
+// use with 'bsls::AlignmentToType'.  The 'isCacheLineAligned' function
+// returns 'true' if a specified 'address' is aligned on a cache-line
+// boundary, and 'roundUpToCacheLineSize' returns the smallest whole multiple
+// of 'BSLS_CACHE_LINE_SIZE' greater than or equal to its argument.  See
+// 'bsls_cachelinepadded' for types that apply this alignment to objects.
+//
 ///Assumptions
 ///-----------
 // The functionality in this component makes several assumptions:
@@ -252,7 +269,11 @@ struct AlignmentUtil {
         // Define the minimal value that satisfies the alignment requirements
         // for all types.
 
-        BSLS_MAX_ALIGNMENT = AlignmentFromType<MaxAlignedUnion>::VALUE
+        BSLS_MAX_ALIGNMENT = AlignmentFromType<MaxAlignedUnion>::VALUE,
+
+        // Define the size of a cache line of the target processor.
+
+        BSLS_CACHE_LINE_SIZE = BSLS_PLATFORM_CACHE_LINE_SIZE
     };
 
     // TYPES
@@ -260,6 +281,10 @@ struct AlignmentUtil {
         // Alias for a primitive type that has the most stringent alignment
         // requirement.
 
+    typedef AlignmentImpCacheLineAlignedType CacheLineAlignedType;
+        // Alias for a type that is aligned on, and has the size of, a cache
+        // line, where supported by the compiler.
+
     // CLASS METHODS
     static int calculateAlignmentFromSize(std::size_t size);
         // Return the *natural* alignment for a memory block of the specified
@@ -299,6 +324,20 @@ struct AlignmentUtil {
         // boundary (i.e., the numerical value of 'address' is evenly divisible
         // by 8), and 'false' otherwise.
 
+    static bool isCacheLineAligned(const void *address);
+        // Return 'true' if the specified 'address' is aligned on a cache-line
+        // boundary (i.e., the numerical value of 'address' is evenly divisible
+        // by 'BSLS_CACHE_LINE_SIZE'), and 'false' otherwise.
+
+    static std::size_t roundUpToCacheLineSize(std::size_t size);
+        // Return the specified 'size' (in bytes) rounded up to the smallest
+        // integral multiple of 'BSLS_CACHE_LINE_SIZE'.  The behavior is
+        // undefined unless 'size' satisfies:
+        //..
+        //  size <= std::numeric_limits<std::size_t>::max()
+        //          - BSLS_CACHE_LINE_SIZE + 1
+        //..
+
     static std::size_t roundUpToMaximalAlignment(std::size_t size);
         // Return the specified 'size' (in bytes) rounded up to the smallest
         // integral multiple of the maximum alignment.  The behavior is
@@ -426,6 +465,24 @@ bool AlignmentUtil::is8ByteAligned(const void *address)
     return 0 == (reinterpret_cast<std::size_t>(address) & 0x7);
 }
 
+inline
+bool AlignmentUtil::isCacheLineAligned(const void *address)
+{
+    return 0 == (reinterpret_cast<std::size_t>(address)
+                                                & (BSLS_CACHE_LINE_SIZE - 1));
+}
+
+inline
+std::size_t AlignmentUtil::roundUpToCacheLineSize(std::size_t size)
+{
+    BSLS_ASSERT_SAFE(size <= std::numeric_limits<std::size_t>::max()
+                           - BSLS_CACHE_LINE_SIZE + 1);
+
+    return (size + BSLS_CACHE_LINE_SIZE - 1)
+                              & ~static_cast<std::size_t>(BSLS_CACHE_LINE_SIZE
+                                                                         - 1);
+}
+
 inline
 std::size_t AlignmentUtil::roundUpToMaximalAlignment(std::size_t size)
 {
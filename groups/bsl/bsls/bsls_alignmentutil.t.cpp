@@ -51,8 +51,12 @@ using namespace std;
 // [ 5] static bool is4ByteAligned(const void *);
 // [ 5] static bool is8ByteAligned(const void *);
 // [ 6] static int roundUpToMaximalAlignment(std::size_t);
+// [ 7] static BSLS_CACHE_LINE_SIZE
+// [ 7] static CacheLineAlignedType
+// [ 7] static bool isCacheLineAligned(const void *);
+// [ 7] static std::size_t roundUpToCacheLineSize(std::size_t);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE -- Ensure the usage example compiles and works.
+// [ 8] USAGE EXAMPLE -- Ensure the usage example compiles and works.
 //=============================================================================
 
 //-----------------------------------------------------------------------------
@@ -246,7 +250,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE TEST
         //   Make sure main usage examples compile and work as advertized.
@@ -350,6 +354,97 @@ int main(int argc, char *argv[])
 // unlikely that 'MyType' would have an actual (and therefore natural)
 // alignment of 4 on a 64-bit platform when using default compiler settings.
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING CACHE-LINE ALIGNMENT:
+        //   Objects written by different threads are placed on distinct
+        //   cache lines using the cache-line constant and aligned type.
+        //
+        // Concerns:
+        //: 1 'BSLS_CACHE_LINE_SIZE' is 'BSLS_PLATFORM_CACHE_LINE_SIZE', and is
+        //:   a power of 2 that is at least 'BSLS_MAX_ALIGNMENT'.
+        //:
+        //: 2 'CacheLineAlignedType' has the size of a cache line and, on
+        //:   compilers supporting extended alignment, is aligned on a cache
+        //:   line, including as a member of an array or a 'union'.
+        //:
+        //: 3 'isCacheLineAligned' returns 'true' exactly for addresses that
+        //:   are multiples of 'BSLS_CACHE_LINE_SIZE'.
+        //:
+        //: 4 'roundUpToCacheLineSize' rounds its argument up to the nearest
+        //:   multiple of 'BSLS_CACHE_LINE_SIZE'.
+        //
+        // Plan:
+        //: 1 Compare the constants directly.  (C-1)
+        //:
+        //: 2 Measure the size and alignment of 'CacheLineAlignedType', and
+        //:   verify the addresses of the elements of an array of a 'union'
+        //:   having a 'CacheLineAlignedType' member.  (C-2)
+        //:
+        //: 3 Apply 'isCacheLineAligned' to a range of addresses around
+        //:   several multiples of the cache-line size.  (C-3)
+        //:
+        //: 4 Apply 'roundUpToCacheLineSize' to sizes from 0 to three cache
+        //:   lines.  (C-4)
+        //
+        // Testing:
+        //   static BSLS_CACHE_LINE_SIZE
+        //   static CacheLineAlignedType
+        //   static bool isCacheLineAligned(const void *);
+        //   static std::size_t roundUpToCacheLineSize(std::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CACHE-LINE ALIGNMENT" << endl
+                          << "============================" << endl;
+
+        const int LINE = Class::BSLS_CACHE_LINE_SIZE;
+
+        if (veryVerbose) { TAB; P(LINE); }
+
+        ASSERT(BSLS_PLATFORM_CACHE_LINE_SIZE == LINE);
+        ASSERT(0 == (LINE & (LINE - 1)));
+        ASSERT(Class::BSLS_MAX_ALIGNMENT <= LINE);
+
+        ASSERT(LINE == sizeof(Class::CacheLineAlignedType));
+
+#if defined(BSLS_PLATFORM_CMP_GNU)                                            \
+ || defined(BSLS_PLATFORM_CMP_CLANG)                                          \
+ || defined(BSLS_PLATFORM_CMP_IBM)                                            \
+ || defined(BSLS_PLATFORM_CMP_MSVC)
+        {
+            struct LineAlign { char c; Class::CacheLineAlignedType d_line; };
+            ASSERT(LINE == (int) offsetof(LineAlign, d_line));
+
+            union Slot {
+                int                         d_value;
+                Class::CacheLineAlignedType d_align;
+            };
+            Slot slots[3];
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, Class::isCacheLineAligned(&slots[i]));
+            }
+            ASSERT(LINE == sizeof(Slot));
+        }
+#endif
+
+        for (int line = 1; line <= 4; ++line) {
+            for (int delta = -3; delta <= 3; ++delta) {
+                const bsls::Types::UintPtr address = line * LINE + delta;
+                const void *p = reinterpret_cast<const void *>(address);
+
+                LOOP2_ASSERT(line, delta,
+                             (0 == delta) == Class::isCacheLineAligned(p));
+            }
+        }
+
+        ASSERT(0 == Class::roundUpToCacheLineSize(0));
+        for (int i = 1; i <= 3 * LINE; ++i) {
+            const int EXP = ((i + LINE - 1) / LINE) * LINE;
+            LOOP_ASSERT(i, EXP == (int) Class::roundUpToCacheLineSize(i));
+        }
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -13,6 +13,7 @@ BSLS_IDENT("$Id: $")
 //  bsls::AtomicInt: atomic 32-bit integer type
 //  bsls::AtomicInt64: atomic 64-bit integer types
 //  bsls::AtomicPointer: parameterized atomic pointer type
+//  bsls::AtomicDoubleWord: atomic pair of pointer-sized words
 //
 //@SEE_ALSO: bsls_atomicoperations
 //
@@ -23,7 +24,15 @@ BSLS_IDENT("$Id: $")
 // corresponding atomic integer types, and provide overloaded operators and
 // functions for common arithmetic operations.  The 'bsls::AtomicPointer' class
 // represents the atomic pointer type, and provides atomic operations to
-// manipulate and dereference a pointer.
+// manipulate and dereference a pointer.  The 'bsls::AtomicDoubleWord' class
+// represents a pair of pointer-sized words (e.g., a pointer and an "ABA"
+// version tag) that are loaded, stored and compared-and-swapped as a unit.
+//
+// In addition to the operations qualified by a memory ordering suffix, the
+// 'load', 'store' and 'testAndSwapWeak' methods of the atomic integer and
+// pointer types accept a 'bsls::AtomicMemoryOrder::Enum' argument, and the
+// atomic integer types provide bitwise "fetch" operations (e.g., 'fetchOr')
+// that return the value prior to the operation (see 'bsls_atomicoperations').
 //
 ///Memory Order and Consistency Guarantees of Atomic Operations
 ///------------------------------------------------------------
@@ -783,6 +792,50 @@ class AtomicInt {
         // atomically and it provides the acquire/release memory ordering
         // guarantee.
 
+    bool testAndSwapWeak(int                     *compareValue,
+                         int                      swapValue,
+                         AtomicMemoryOrder::Enum  order =
+                                             AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Compare the value of this object to the value at the specified
+        // 'compareValue'.  If they are equal, set the value of this object to
+        // the specified 'swapValue' and return 'true'; otherwise, load the
+        // value of this object into 'compareValue' and return 'false'.
+        // Optionally specify the memory 'order' guarantee to provide; if
+        // 'order' is not specified, provide sequential consistency.  Note
+        // that this operation may fail spuriously (i.e., even if the values
+        // are equal) on some platforms, and so should be used in a loop.
+
+    void store(int value, AtomicMemoryOrder::Enum order);
+        // Atomically assign the specified 'value' to this object, providing at
+        // least the specified memory 'order' guarantee.
+
+    int fetchAnd(int mask);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'mask', and return its previous value.
+
+    int fetchAndAcqRel(int mask);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    int fetchOr(int mask);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'mask', and return its previous value.
+
+    int fetchOrAcqRel(int mask);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    int fetchXor(int mask);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'mask', and return its previous value.
+
+    int fetchXorAcqRel(int mask);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
     // ACCESSORS
     operator int() const;
         // Return the current value of this object.
@@ -797,6 +850,10 @@ class AtomicInt {
     int loadAcquire() const;
         // Return the current value of this object, providing the acquire
         // memory ordering guarantee.
+
+    int load(AtomicMemoryOrder::Enum order) const;
+        // Return the current value of this object, providing at least the
+        // specified memory 'order' guarantee.
 };
 
                               // =================
@@ -910,6 +967,50 @@ class AtomicInt64 {
         // atomically and it provides the acquire/release memory ordering
         // guarantee.
 
+    bool testAndSwapWeak(Types::Int64            *compareValue,
+                         Types::Int64             swapValue,
+                         AtomicMemoryOrder::Enum  order =
+                                             AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Compare the value of this object to the value at the specified
+        // 'compareValue'.  If they are equal, set the value of this object to
+        // the specified 'swapValue' and return 'true'; otherwise, load the
+        // value of this object into 'compareValue' and return 'false'.
+        // Optionally specify the memory 'order' guarantee to provide; if
+        // 'order' is not specified, provide sequential consistency.  Note
+        // that this operation may fail spuriously (i.e., even if the values
+        // are equal) on some platforms, and so should be used in a loop.
+
+    void store(Types::Int64 value, AtomicMemoryOrder::Enum order);
+        // Atomically assign the specified 'value' to this object, providing at
+        // least the specified memory 'order' guarantee.
+
+    Types::Int64 fetchAnd(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'mask', and return its previous value.
+
+    Types::Int64 fetchAndAcqRel(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise AND of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Int64 fetchOr(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'mask', and return its previous value.
+
+    Types::Int64 fetchOrAcqRel(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise OR of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
+    Types::Int64 fetchXor(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'mask', and return its previous value.
+
+    Types::Int64 fetchXorAcqRel(Types::Int64 mask);
+        // Atomically set the value of this object to the bitwise XOR of its
+        // value and the specified 'mask', and return its previous value,
+        // providing the acquire/release memory ordering guarantee.
+
     // ACCESSORS
     operator Types::Int64() const;
         // Return the current value of this object.
@@ -924,6 +1025,10 @@ class AtomicInt64 {
     Types::Int64 loadAcquire() const;
         // Return the current value of this object, providing the acquire
         // memory ordering guarantee.
+
+    Types::Int64 load(AtomicMemoryOrder::Enum order) const;
+        // Return the current value of this object, providing at least the
+        // specified memory 'order' guarantee.
 };
 
                              // ===================
@@ -1009,6 +1114,23 @@ class AtomicPointer {
         // atomically and it provides the acquire/release memory ordering
         // guarantee.
 
+    bool testAndSwapWeak(TYPE                    **compareValue,
+                         TYPE                     *swapValue,
+                         AtomicMemoryOrder::Enum   order =
+                                             AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Compare the value of this object to the value at the specified
+        // 'compareValue'.  If they are equal, set the value of this object to
+        // the specified 'swapValue' and return 'true'; otherwise, load the
+        // value of this object into 'compareValue' and return 'false'.
+        // Optionally specify the memory 'order' guarantee to provide; if
+        // 'order' is not specified, provide sequential consistency.  Note
+        // that this operation may fail spuriously (i.e., even if the values
+        // are equal) on some platforms, and so should be used in a loop.
+
+    void store(TYPE *value, AtomicMemoryOrder::Enum order);
+        // Atomically assign the specified 'value' to this object, providing at
+        // least the specified memory 'order' guarantee.
+
     // ACCESSORS
     TYPE& operator*() const;
         // Return a reference to the value currently pointed to by this object.
@@ -1030,6 +1152,71 @@ class AtomicPointer {
     TYPE *loadAcquire() const;
         // Return the current value of this object, providing the acquire
         // memory ordering guarantee.
+
+    TYPE *load(AtomicMemoryOrder::Enum order) const;
+        // Return the current value of this object, providing at least the
+        // specified memory 'order' guarantee.
+};
+
+                           // ======================
+                           // class AtomicDoubleWord
+                           // ======================
+
+class AtomicDoubleWord {
+    // This class implements an atomic pair of pointer-sized words, which are
+    // loaded, stored and compared-and-swapped as a unit (e.g., a pointer and
+    // an "ABA" tag).  All operations on objects of this class provide the
+    // sequential consistency memory ordering guarantee.  Note that the
+    // operations are lock-free only if 'isLockFree' returns 'true' (see
+    // 'bsls_atomicoperations').
+
+    // DATA
+    AtomicOperations::AtomicTypes::DoubleWord d_value;
+
+  private:
+    // NOT IMPLEMENTED
+    AtomicDoubleWord(const AtomicDoubleWord&);             // = delete
+    AtomicDoubleWord& operator=(const AtomicDoubleWord&);  // = delete
+        // Note that the copy constructor and the copy-assignment operator
+        // are not implemented because they cannot be done atomically.
+
+  public:
+    // CLASS METHODS
+    static bool isLockFree();
+        // Return 'true' if the operations of this class are implemented
+        // without a lock on this platform, and 'false' otherwise.
+
+    // CREATORS
+    AtomicDoubleWord();
+        // Create an atomic double word object having the value '(0, 0)'.
+
+    AtomicDoubleWord(Types::UintPtr first, Types::UintPtr second);
+        // Create an atomic double word object having the specified 'first'
+        // and 'second' words.
+
+    //! ~AtomicDoubleWord() = default;
+        // Destroy this atomic double word object.
+
+    // MANIPULATORS
+    void store(Types::UintPtr first, Types::UintPtr second);
+        // Atomically set the words of this object to the specified 'first'
+        // and 'second' values.
+
+    bool testAndSwap(Types::UintPtr *compareFirst,
+                     Types::UintPtr *compareSecond,
+                     Types::UintPtr  swapFirst,
+                     Types::UintPtr  swapSecond);
+        // Compare the words of this object to the values at the specified
+        // 'compareFirst' and 'compareSecond'.  If both are equal, set the
+        // words of this object to the specified 'swapFirst' and 'swapSecond'
+        // and return 'true'; otherwise, load the words of this object into
+        // 'compareFirst' and 'compareSecond' and return 'false'.  Note that
+        // the entire test-and-swap operation is performed atomically.
+
+    // ACCESSORS
+    void load(Types::UintPtr *first, Types::UintPtr *second) const;
+        // Atomically load the words of this object into the specified 'first'
+        // and 'second'.
 };
 
 }  // close package namespace
@@ -1159,6 +1346,59 @@ int AtomicInt::testAndSwapAcqRel(int compareValue, int swapValue)
                                                       swapValue);
 }
 
+inline
+bool AtomicInt::testAndSwapWeak(int                     *compareValue,
+                                int                      swapValue,
+                                AtomicMemoryOrder::Enum  order)
+{
+    return AtomicOperations::testAndSwapIntWeak(&d_value,
+                                                compareValue,
+                                                swapValue,
+                                                order);
+}
+
+inline
+void AtomicInt::store(int value, AtomicMemoryOrder::Enum order)
+{
+    AtomicOperations::setInt(&d_value, value, order);
+}
+
+inline
+int AtomicInt::fetchAnd(int mask)
+{
+    return AtomicOperations_Imp::fetchAndInt(&d_value, mask);
+}
+
+inline
+int AtomicInt::fetchAndAcqRel(int mask)
+{
+    return AtomicOperations_Imp::fetchAndIntAcqRel(&d_value, mask);
+}
+
+inline
+int AtomicInt::fetchOr(int mask)
+{
+    return AtomicOperations_Imp::fetchOrInt(&d_value, mask);
+}
+
+inline
+int AtomicInt::fetchOrAcqRel(int mask)
+{
+    return AtomicOperations_Imp::fetchOrIntAcqRel(&d_value, mask);
+}
+
+inline
+int AtomicInt::fetchXor(int mask)
+{
+    return AtomicOperations_Imp::fetchXorInt(&d_value, mask);
+}
+
+inline
+int AtomicInt::fetchXorAcqRel(int mask)
+{
+    return AtomicOperations_Imp::fetchXorIntAcqRel(&d_value, mask);
+}
+
 // ACCESSORS
 
 inline
@@ -1185,6 +1425,12 @@ int AtomicInt::loadAcquire() const
     return AtomicOperations_Imp::getIntAcquire(&d_value);
 }
 
+inline
+int AtomicInt::load(AtomicMemoryOrder::Enum order) const
+{
+    return AtomicOperations::getInt(&d_value, order);
+}
+
                               // -----------------
                               // class AtomicInt64
                               // -----------------
@@ -1308,6 +1554,59 @@ AtomicInt64::testAndSwapAcqRel(Types::Int64 compareValue,
                                                         swapValue);
 }
 
+inline
+bool AtomicInt64::testAndSwapWeak(Types::Int64            *compareValue,
+                                  Types::Int64             swapValue,
+                                  AtomicMemoryOrder::Enum  order)
+{
+    return AtomicOperations::testAndSwapInt64Weak(&d_value,
+                                                  compareValue,
+                                                  swapValue,
+                                                  order);
+}
+
+inline
+void AtomicInt64::store(Types::Int64 value, AtomicMemoryOrder::Enum order)
+{
+    AtomicOperations::setInt64(&d_value, value, order);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAnd(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchAndInt64(&d_value, mask);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchAndAcqRel(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchAndInt64AcqRel(&d_value, mask);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOr(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchOrInt64(&d_value, mask);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchOrAcqRel(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchOrInt64AcqRel(&d_value, mask);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXor(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchXorInt64(&d_value, mask);
+}
+
+inline
+Types::Int64 AtomicInt64::fetchXorAcqRel(Types::Int64 mask)
+{
+    return AtomicOperations_Imp::fetchXorInt64AcqRel(&d_value, mask);
+}
+
 // ACCESSORS
 inline
 AtomicInt64::operator Types::Int64() const
@@ -1333,6 +1632,12 @@ Types::Int64 AtomicInt64::loadAcquire() const
     return AtomicOperations_Imp::getInt64Acquire(&d_value);
 }
 
+inline
+Types::Int64 AtomicInt64::load(AtomicMemoryOrder::Enum order) const
+{
+    return AtomicOperations::getInt64(&d_value, order);
+}
+
                              // -------------------
                              // class AtomicPointer
                              // -------------------
@@ -1424,6 +1729,32 @@ TYPE *AtomicPointer<TYPE>::testAndSwapAcqRel(const TYPE *compareValue,
             reinterpret_cast<const void *>(swapValue)));
 }
 
+template <class TYPE>
+inline
+bool AtomicPointer<TYPE>::testAndSwapWeak(
+                                        TYPE                    **compareValue,
+                                        TYPE                     *swapValue,
+                                        AtomicMemoryOrder::Enum   order)
+{
+    const void *expected = reinterpret_cast<const void *>(*compareValue);
+    const bool  result   = AtomicOperations::testAndSwapPtrWeak(
+                                     &d_value,
+                                     &expected,
+                                     reinterpret_cast<const void *>(swapValue),
+                                     order);
+    *compareValue = reinterpret_cast<TYPE *>(const_cast<void *>(expected));
+    return result;
+}
+
+template <class TYPE>
+inline
+void AtomicPointer<TYPE>::store(TYPE *value, AtomicMemoryOrder::Enum order)
+{
+    AtomicOperations::setPtr(&d_value,
+                             reinterpret_cast<const void *>(value),
+                             order);
+}
+
 // ACCESSORS
 template <class TYPE>
 inline
@@ -1467,6 +1798,65 @@ TYPE *AtomicPointer<TYPE>::loadAcquire() const
     return (TYPE *) AtomicOperations_Imp::getPtrAcquire(&d_value);
 }
 
+template <class TYPE>
+inline
+TYPE *AtomicPointer<TYPE>::load(AtomicMemoryOrder::Enum order) const
+{
+    return (TYPE *) AtomicOperations::getPtr(&d_value, order);
+}
+
+                           // ----------------------
+                           // class AtomicDoubleWord
+                           // ----------------------
+
+// CLASS METHODS
+inline
+bool AtomicDoubleWord::isLockFree()
+{
+    return AtomicOperations_Imp::isDoubleWordLockFree();
+}
+
+// CREATORS
+inline
+AtomicDoubleWord::AtomicDoubleWord()
+{
+    AtomicOperations_Imp::initDoubleWord(&d_value, 0, 0);
+}
+
+inline
+AtomicDoubleWord::AtomicDoubleWord(Types::UintPtr first, Types::UintPtr second)
+{
+    AtomicOperations_Imp::initDoubleWord(&d_value, first, second);
+}
+
+// MANIPULATORS
+inline
+void AtomicDoubleWord::store(Types::UintPtr first, Types::UintPtr second)
+{
+    AtomicOperations_Imp::setDoubleWord(&d_value, first, second);
+}
+
+inline
+bool AtomicDoubleWord::testAndSwap(Types::UintPtr *compareFirst,
+                                   Types::UintPtr *compareSecond,
+                                   Types::UintPtr  swapFirst,
+                                   Types::UintPtr  swapSecond)
+{
+    return AtomicOperations_Imp::testAndSwapDoubleWord(&d_value,
+                                                       compareFirst,
+                                                       compareSecond,
+                                                       swapFirst,
+                                                       swapSecond);
+}
+
+// ACCESSORS
+inline
+void AtomicDoubleWord::load(Types::UintPtr *first,
+                            Types::UintPtr *second) const
+{
+    AtomicOperations_Imp::getDoubleWord(&d_value, first, second);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -49,6 +49,12 @@ using namespace std;
 // [ 4] void operator +=(int value);
 // [ 4] void operator -=(int value);
 // [ 2] operator int() const;
+// [ 9] int fetchAnd(int mask);
+// [ 9] int fetchOr(int mask);
+// [ 9] int fetchXor(int mask);
+// [ 9] bool testAndSwapWeak(int *, int, AtomicMemoryOrder::Enum);
+// [ 9] void store(int value, AtomicMemoryOrder::Enum order);
+// [ 9] int load(AtomicMemoryOrder::Enum order) const;
 //
 // bsls::AtomicInt64
 // -----------------
@@ -68,6 +74,12 @@ using namespace std;
 // [ 4] void operator +=(bsls::Types::Int64 value);
 // [ 4] void operator -=(bsls::Types::Int64 value);
 // [ 2] operator bsls::Types::Int64() const;
+// [ 9] bsls::Types::Int64 fetchAnd(bsls::Types::Int64 mask);
+// [ 9] bsls::Types::Int64 fetchOr(bsls::Types::Int64 mask);
+// [ 9] bsls::Types::Int64 fetchXor(bsls::Types::Int64 mask);
+// [ 9] bool testAndSwapWeak(Int64 *, Int64, AtomicMemoryOrder::Enum);
+// [ 9] void store(bsls::Types::Int64, AtomicMemoryOrder::Enum);
+// [ 9] bsls::Types::Int64 load(AtomicMemoryOrder::Enum order) const;
 //
 // bsls::AtomicPointer
 // -------------------
@@ -82,10 +94,22 @@ using namespace std;
 // [ 2] T& operator*() const;
 // [ 3] T* operator->() const;
 // [ 2] operator T*() const;
+// [ 9] bool testAndSwapWeak(T **, T *, AtomicMemoryOrder::Enum);
+// [ 9] void store(T *value, AtomicMemoryOrder::Enum order);
+// [ 9] T* load(AtomicMemoryOrder::Enum order) const;
+//
+// bsls::AtomicDoubleWord
+// ----------------------
+// [10] static bool isLockFree();
+// [10] bsls::AtomicDoubleWord();
+// [10] bsls::AtomicDoubleWord(UintPtr first, UintPtr second);
+// [10] void store(UintPtr first, UintPtr second);
+// [10] bool testAndSwap(UintPtr *, UintPtr *, UintPtr, UintPtr);
+// [10] void load(UintPtr *first, UintPtr *second) const;
 //
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -993,7 +1017,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 9: {
+      case 11: {
         // TESTING USAGE Examples
         //
         // Plan:
@@ -1006,6 +1030,197 @@ int main(int argc, char *argv[])
             my_CountedHandle<double> handle(NULL);
         }
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'AtomicDoubleWord'
+        //
+        // Concerns:
+        //: 1 The default constructor creates '(0, 0)', and the value
+        //:   constructor and 'store' set both words, which 'load' returns.
+        //:
+        //: 2 'testAndSwap' sets both words if and only if both compare equal,
+        //:   and otherwise loads the current words into the comparands.
+        //:
+        //: 3 'isLockFree' is "hooked up" to 'isDoubleWordLockFree'.
+        //
+        // Plan:
+        //: 1 Exercise each method, comparing one or both words unequal.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   static bool isLockFree();
+        //   bsls::AtomicDoubleWord();
+        //   bsls::AtomicDoubleWord(UintPtr first, UintPtr second);
+        //   void store(UintPtr first, UintPtr second);
+        //   bool testAndSwap(UintPtr *, UintPtr *, UintPtr, UintPtr);
+        //   void load(UintPtr *first, UintPtr *second) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'AtomicDoubleWord'"
+                          << "\n==========================" << endl;
+
+        typedef bsls::Types::UintPtr UintPtr;
+
+        ASSERT(bsls::AtomicOperations::isDoubleWordLockFree()
+                                    == bsls::AtomicDoubleWord::isLockFree());
+
+        UintPtr first = 1, second = 1;
+
+        bsls::AtomicDoubleWord mX;  const bsls::AtomicDoubleWord& X = mX;
+        X.load(&first, &second);
+        ASSERT(0 == first);
+        ASSERT(0 == second);
+
+        bsls::AtomicDoubleWord mY(3, ~UintPtr(0));
+        mY.load(&first, &second);
+        ASSERT(3           == first);
+        ASSERT(~UintPtr(0) == second);
+
+        mX.store(5, 6);
+        X.load(&first, &second);
+        ASSERT(5 == first);
+        ASSERT(6 == second);
+
+        first = 5; second = 7;
+        ASSERT(!mX.testAndSwap(&first, &second, 8, 9));
+        ASSERT(5 == first);
+        ASSERT(6 == second);
+
+        first = 4;
+        ASSERT(!mX.testAndSwap(&first, &second, 8, 9));
+        ASSERT(5 == first);
+        ASSERT(6 == second);
+
+        ASSERT(mX.testAndSwap(&first, &second, 8, 9));
+        ASSERT(5 == first);
+        ASSERT(6 == second);
+
+        X.load(&first, &second);
+        ASSERT(8 == first);
+        ASSERT(9 == second);
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE, MEMORY-ORDER AND WEAK COMPARE-AND-SWAP METHODS
+        //
+        // Concerns:
+        //: 1 The bitwise "fetch" methods of 'AtomicInt' and 'AtomicInt64' are
+        //:   "hooked up" to the corresponding atomic operations.
+        //:
+        //: 2 The 'load' and 'store' overloads taking a memory order are
+        //:   "hooked up" for every order.
+        //:
+        //: 3 'testAndSwapWeak' reports success, and on failure loads the
+        //:   current value into the comparand.
+        //
+        // Plan:
+        //: 1 For each type, exercise each method and verify the returned and
+        //:   resulting values.  (C-1..3)
+        //
+        // Testing:
+        //   int fetchAnd(int mask);
+        //   int fetchOr(int mask);
+        //   int fetchXor(int mask);
+        //   bool testAndSwapWeak(int *, int, AtomicMemoryOrder::Enum);
+        //   void store(int value, AtomicMemoryOrder::Enum order);
+        //   int load(AtomicMemoryOrder::Enum order) const;
+        //   bsls::Types::Int64 fetchAnd(bsls::Types::Int64 mask);
+        //   bsls::Types::Int64 fetchOr(bsls::Types::Int64 mask);
+        //   bsls::Types::Int64 fetchXor(bsls::Types::Int64 mask);
+        //   bool testAndSwapWeak(Int64 *, Int64, AtomicMemoryOrder::Enum);
+        //   void store(bsls::Types::Int64, AtomicMemoryOrder::Enum);
+        //   bsls::Types::Int64 load(AtomicMemoryOrder::Enum order) const;
+        //   bool testAndSwapWeak(T **, T *, AtomicMemoryOrder::Enum);
+        //   void store(T *value, AtomicMemoryOrder::Enum order);
+        //   T* load(AtomicMemoryOrder::Enum order) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BITWISE, MEMORY-ORDER AND WEAK CAS"
+                          << "\n=========================================="
+                          << endl;
+
+        typedef bsls::AtomicMemoryOrder MO;
+
+        static const MO::Enum ORDERS[] = {
+            MO::BSLS_RELAXED,
+            MO::BSLS_ACQUIRE,
+            MO::BSLS_RELEASE,
+            MO::BSLS_ACQ_REL,
+            MO::BSLS_SEQ_CST
+        };
+        const int NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+
+        if (verbose) cout << "\tbsls::AtomicInt" << endl;
+        {
+            bsls::AtomicInt mX(0x0F0F);
+
+            ASSERT(0x0F0F == mX.fetchAnd(0x00FF));
+            ASSERT(0x000F == mX.fetchOr(0xF000));
+            ASSERT(0xF00F == mX.fetchXor(0xFFFF));
+            ASSERT(0x0FF0 == mX.fetchAndAcqRel(0x0F00));
+            ASSERT(0x0F00 == mX.fetchOrAcqRel(-1));
+            ASSERT(-1     == mX.fetchXorAcqRel(1));
+            ASSERT(-2     == mX);
+
+            for (int i = 0; i < NUM_ORDERS; ++i) {
+                mX.store(i, ORDERS[i]);
+                LOOP_ASSERT(i, i == mX.load(ORDERS[i]));
+            }
+
+            int expected = 0;
+            ASSERT(!mX.testAndSwapWeak(&expected, 7));
+            ASSERT(NUM_ORDERS - 1 == expected);
+            while (!mX.testAndSwapWeak(&expected, 7, MO::BSLS_ACQ_REL)) {
+            }
+            ASSERT(7 == mX);
+        }
+
+        if (verbose) cout << "\tbsls::AtomicInt64" << endl;
+        {
+            const bsls::Types::Int64 HIGH = 0x0F0F000000000000LL;
+
+            bsls::AtomicInt64 mX(HIGH | 1);
+
+            ASSERT((HIGH | 1) == mX.fetchAnd(HIGH));
+            ASSERT(HIGH       == mX.fetchOr(2));
+            ASSERT((HIGH | 2) == mX.fetchXor(HIGH));
+            ASSERT(2          == mX.fetchAndAcqRel(3));
+            ASSERT(2          == mX.fetchOrAcqRel(HIGH));
+            ASSERT((HIGH | 2) == mX.fetchXorAcqRel(2));
+            ASSERT(HIGH       == mX);
+
+            for (int i = 0; i < NUM_ORDERS; ++i) {
+                mX.store(HIGH + i, ORDERS[i]);
+                LOOP_ASSERT(i, HIGH + i == mX.load(ORDERS[i]));
+            }
+
+            bsls::Types::Int64 expected = 0;
+            ASSERT(!mX.testAndSwapWeak(&expected, 7));
+            ASSERT(HIGH + NUM_ORDERS - 1 == expected);
+            while (!mX.testAndSwapWeak(&expected, 7)) {
+            }
+            ASSERT(7 == mX);
+        }
+
+        if (verbose) cout << "\tbsls::AtomicPointer" << endl;
+        {
+            int values[NUM_ORDERS];
+
+            bsls::AtomicPointer<int> mX;
+
+            for (int i = 0; i < NUM_ORDERS; ++i) {
+                mX.store(&values[i], ORDERS[i]);
+                LOOP_ASSERT(i, &values[i] == mX.load(ORDERS[i]));
+            }
+
+            int *expected = 0;
+            ASSERT(!mX.testAndSwapWeak(&expected, values));
+            ASSERT(&values[NUM_ORDERS - 1] == expected);
+            while (!mX.testAndSwapWeak(&expected, values, MO::BSLS_RELEASE)) {
+            }
+            ASSERT(values == mX);
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING MEMORY ORDERING OF ATOMIC OPERATIONS USED IN SHARED POINTER
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bsls::AtomicOperations: namespace for atomic operations
+//  bsls::AtomicMemoryOrder: namespace for memory ordering enumeration
 //
 //@DESCRIPTION: This utility provides a set of platform-independent atomic
 // operations for fundamental data types, such as 32-bit and 64-bit integer and
@@ -179,9 +180,10 @@ BSLS_IDENT("$Id: $")
 // The atomic integer operations provide thread-safe access for 32 or 64-bit
 // signed integer numbers without the use of higher level synchronization
 // mechanisms.  Atomic integers are most commonly used to manipulate shared
-// counters and indices.  Five types of operations are provided; get/set,
-// increment/decrement, add, swap, and test and swap.  Two sub-types of
-// manipulators are provided for increment/decrement and addition operations.
+// counters and indices.  Six types of operations are provided; get/set,
+// increment/decrement, add, bitwise AND/OR/XOR, swap, and test and swap.  Two
+// sub-types of manipulators are provided for increment/decrement and addition
+// operations.
 //
 // 'bsls::AtomicOperations' functions whose names end in "Nv" (stands for "new
 // value"; e.g., 'addIntNv', 'incrementInt64Nv') return the resulting value of
@@ -191,12 +193,82 @@ BSLS_IDENT("$Id: $")
 // to determine the resulting value of an operation than to simply perform the
 // operation.
 //
+// Similarly, the bitwise functions whose names begin with "fetch" (e.g.,
+// 'fetchOrInt', 'fetchAndInt64') return the value of the integer *prior* to
+// the operation, which allows the caller to learn whether it was the caller
+// that changed a given bit (e.g., when claiming a slot in a bitmap); those
+// without the prefix (e.g., 'orInt') do not return a value, and on some
+// platforms map to a single instruction.
+//
 ///Atomic Pointer Operations
 ///-------------------------
 // The atomic pointer operations provide thread-safe access to pointer values
 // without the use of higher level synchronization mechanisms.  They are
 // commonly used to create fast thread safe singly-linked lists.
 //
+///Memory Order Parameters
+///-----------------------
+// In addition to the functions whose names carry their memory ordering
+// guarantee (e.g., 'getIntAcquire', 'swapInt64AcqRel'), the get, set, swap,
+// test-and-swap, "add Nv" and "fetch" bitwise operations are overloaded to
+// take the memory ordering guarantee as a 'bsls::AtomicMemoryOrder::Enum'
+// argument, which is useful for generic code in which the ordering is a
+// parameter.  When the 'order' argument is a compile-time constant, the
+// overloads compile to the corresponding named function.  Each overload
+// provides *at* *least* the requested guarantee: a request for a guarantee
+// that is not meaningful for, or not separately implemented by, an operation
+// is served by the next stronger guarantee.  In particular, a get requested
+// with 'BSLS_RELEASE' or 'BSLS_ACQ_REL' (and a set requested with
+// 'BSLS_ACQUIRE' or 'BSLS_ACQ_REL') provides sequential consistency, and a
+// read-modify-write operation not requested with 'BSLS_SEQ_CST' (or, for
+// 'addIntNv' and 'addInt64Nv', 'BSLS_RELAXED') provides the acquire/release
+// guarantee.
+//
+///Weak Compare-and-Swap
+///---------------------
+// The 'testAndSwapIntWeak', 'testAndSwapInt64Weak' and 'testAndSwapPtrWeak'
+// functions are an alternative interface to test-and-swap, suited to the
+// "read, compute, try to publish" loops common in lock-free code.  They
+// return whether the swap took place, and, if it did not, update the caller's
+// expected value with the current value, so that a retry need not reload it.
+// Such a function is permitted to fail spuriously, which allows it to be
+// implemented by a single load-linked/store-conditional pair on platforms that
+// provide them, and must therefore always be called in a loop.  (Currently,
+// the weak functions are implemented in terms of the strong test-and-swap on
+// all platforms, and do not fail spuriously.)
+//
+///Atomic Double-Word Operations
+///-----------------------------
+// The double-word operations atomically load, store and test-and-swap a pair
+// of pointer-sized words, 'AtomicTypes::DoubleWord', as a unit -- for
+// example, a pointer and a "tag" (or version count) that is incremented
+// whenever the pointer is modified, which prevents the "ABA" problem in
+// lock-free stacks and free lists.  On x86-64 processors supporting the
+// 'cmpxchg16b' instruction (which some early x86-64 processors lack, and
+// which is therefore checked with 'cpuid' on first use), these operations are
+// implemented with that instruction, and are lock-free; otherwise they are
+// implemented by serializing the operations on a given double word with an
+// internal spin lock (chosen by address from a small table), and
+// 'isDoubleWordLockFree' returns 'false'.  An
+// 'AtomicTypes::DoubleWord' object must be suitably aligned, which is
+// guaranteed for objects with static or automatic storage duration, and for
+// dynamically-allocated objects when the allocator provides 16-byte alignment.
+//
+///Memory Fences
+///-------------
+// 'fenceAcquire' and 'fenceRelease' order non-atomic memory accesses with
+// respect to atomic operations that do not themselves provide the required
+// guarantee.  A release fence prevents memory accesses preceding it from being
+// reordered with *stores* following it, and an acquire fence prevents memory
+// accesses following it from being reordered with *loads* preceding it.  The
+// typical use is a sequence lock, in which a writer updates a counter, issues
+// a release fence, and then writes the protected data, while a reader copies
+// the data, issues an acquire fence, and then re-reads the counter to detect
+// a concurrent update.  On x86 and x86-64, which reorder only a store followed
+// by a load, the fences only constrain the compiler; elsewhere, they are
+// implemented by a sequentially consistent read-modify-write operation, which
+// is a full memory barrier on every supported platform.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -742,6 +814,25 @@ namespace BloombergLP {
 
 namespace bsls {
 
+                          // ========================
+                          // struct AtomicMemoryOrder
+                          // ========================
+
+struct AtomicMemoryOrder {
+    // This 'struct' provides a namespace for enumerating the memory ordering
+    // guarantees that may be requested of the memory-order-parameterized
+    // operations of 'AtomicOperations' (see {Memory Order Parameters}).
+
+    // TYPES
+    enum Enum {
+        BSLS_RELAXED,  // no memory ordering guarantee
+        BSLS_ACQUIRE,  // acquire memory ordering guarantee
+        BSLS_RELEASE,  // release memory ordering guarantee
+        BSLS_ACQ_REL,  // acquire/release memory ordering guarantee
+        BSLS_SEQ_CST   // sequential consistency guarantee
+    };
+};
+
                            // =======================
                            // struct AtomicOperations
                            // =======================
@@ -750,7 +841,8 @@ struct AtomicOperations {
     // 'AtomicOperations' provides a namespace for a suite of atomic
     // operations on the following types as defined by the 'AtomicTypes'
     // typedef: integer - 'AtomicTypes::Int', 64bit integer -
-    // 'AtomicTypes::Int64', pointer - 'AtomicTypes::Pointer'.
+    // 'AtomicTypes::Int64', pointer - 'AtomicTypes::Pointer', pair of
+    // pointer-sized words - 'AtomicTypes::DoubleWord'.
 
     // TYPES
     typedef AtomicOperations_Imp   Imp;
@@ -880,6 +972,131 @@ struct AtomicOperations {
         // Atomically decrement the value of the specified 'atomicInt' by 1,
         // providing the acquire/release memory ordering guarantee.
 
+    static int fetchAndInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static int fetchOrInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static int fetchXorInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static int fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static void andInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void orInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void xorInt(AtomicTypes::Int *atomicInt, int mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static int getInt(AtomicTypes::Int const  *atomicInt,
+                      AtomicMemoryOrder::Enum  order);
+        // Atomically retrieve the value of the specified 'atomicInt',
+        // providing at least the specified 'order' memory ordering guarantee
+        // (see {Memory Order Parameters}).
+
+    static void setInt(AtomicTypes::Int        *atomicInt,
+                       int                      value,
+                       AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the
+        // specified 'value', providing at least the specified 'order' memory
+        // ordering guarantee (see {Memory Order Parameters}).
+
+    static int swapInt(AtomicTypes::Int        *atomicInt,
+                       int                      swapValue,
+                       AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the
+        // specified 'swapValue', and return its previous value, providing at
+        // least the specified 'order' memory ordering guarantee (see {Memory
+        // Order Parameters}).
+
+    static int testAndSwapInt(AtomicTypes::Int        *atomicInt,
+                              int                      compareValue,
+                              int                      swapValue,
+                              AtomicMemoryOrder::Enum  order);
+        // Conditionally set the value of the specified 'atomicInt' to the
+        // specified 'swapValue' if and only if the value of 'atomicInt' equals
+        // the value of the specified 'compareValue', and return the initial
+        // value of 'atomicInt', providing at least the specified 'order'
+        // memory ordering guarantee (see {Memory Order Parameters}).
+
+    static int addIntNv(AtomicTypes::Int        *atomicInt,
+                        int                      value,
+                        AtomicMemoryOrder::Enum  order);
+        // Atomically add to the specified 'atomicInt' the specified 'value'
+        // and return the resulting value, providing at least the specified
+        // 'order' memory ordering guarantee (see {Memory Order Parameters}).
+
+    static int fetchAndInt(AtomicTypes::Int        *atomicInt,
+                           int                      mask,
+                           AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static int fetchOrInt(AtomicTypes::Int        *atomicInt,
+                          int                      mask,
+                          AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static int fetchXorInt(AtomicTypes::Int        *atomicInt,
+                           int                      mask,
+                           AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static bool testAndSwapIntWeak(
+             AtomicTypes::Int        *atomicInt,
+             int                     *compareValue,
+             int                      swapValue,
+             AtomicMemoryOrder::Enum  order = AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Conditionally set the value of the specified 'atomicInt' to the
+        // specified 'swapValue' if the value of 'atomicInt' equals the value
+        // at the specified 'compareValue', providing at least the optionally
+        // specified 'order' memory ordering guarantee (sequential consistency
+        // by default).  Return 'true' if the value of 'atomicInt' was set, and
+        // 'false' otherwise, in which case load the current value of
+        // 'atomicInt' into 'compareValue'.  Note that this operation may fail
+        // spuriously (i.e., even if the values are equal) on some platforms,
+        // and so should be used in a loop; see {Weak Compare-and-Swap}.
+
         // *** atomic functions for Int64 ***
 
     static void initInt64(AtomicTypes::Int64 *atomicInt,
@@ -1017,6 +1234,137 @@ struct AtomicOperations {
         // resulting value, providing the acquire/release memory ordering
         // guarantee.
 
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchAndInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchOrInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                           Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static Types::Int64 fetchXorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing the acquire/release memory ordering guarantee.
+
+    static void andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static void xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', providing the sequential
+        // consistency memory ordering guarantee.
+
+    static Types::Int64 getInt64(AtomicTypes::Int64 const *atomicInt,
+                                 AtomicMemoryOrder::Enum   order);
+        // Atomically retrieve the value of the specified 'atomicInt',
+        // providing at least the specified 'order' memory ordering guarantee
+        // (see {Memory Order Parameters}).
+
+    static void setInt64(AtomicTypes::Int64      *atomicInt,
+                         Types::Int64             value,
+                         AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the
+        // specified 'value', providing at least the specified 'order' memory
+        // ordering guarantee (see {Memory Order Parameters}).
+
+    static Types::Int64 swapInt64(AtomicTypes::Int64      *atomicInt,
+                                  Types::Int64             swapValue,
+                                  AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the
+        // specified 'swapValue', and return its previous value, providing at
+        // least the specified 'order' memory ordering guarantee (see {Memory
+        // Order Parameters}).
+
+    static Types::Int64 testAndSwapInt64(AtomicTypes::Int64      *atomicInt,
+                                         Types::Int64             compareValue,
+                                         Types::Int64             swapValue,
+                                         AtomicMemoryOrder::Enum  order);
+        // Conditionally set the value of the specified 'atomicInt' to the
+        // specified 'swapValue' if and only if the value of 'atomicInt' equals
+        // the value of the specified 'compareValue', and return the initial
+        // value of 'atomicInt', providing at least the specified 'order'
+        // memory ordering guarantee (see {Memory Order Parameters}).
+
+    static Types::Int64 addInt64Nv(AtomicTypes::Int64      *atomicInt,
+                                   Types::Int64             value,
+                                   AtomicMemoryOrder::Enum  order);
+        // Atomically add to the specified 'atomicInt' the specified 'value'
+        // and return the resulting value, providing at least the specified
+        // 'order' memory ordering guarantee (see {Memory Order Parameters}).
+
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64      *atomicInt,
+                                      Types::Int64             mask,
+                                      AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // AND of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64      *atomicInt,
+                                     Types::Int64             mask,
+                                     AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // OR of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64      *atomicInt,
+                                      Types::Int64             mask,
+                                      AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicInt' to the bitwise
+        // XOR of its value and the specified 'mask', and return its previous
+        // value, providing at least the specified 'order' memory ordering
+        // guarantee (see {Memory Order Parameters}).
+
+    static bool testAndSwapInt64Weak(
+             AtomicTypes::Int64      *atomicInt,
+             Types::Int64            *compareValue,
+             Types::Int64             swapValue,
+             AtomicMemoryOrder::Enum  order = AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Conditionally set the value of the specified 'atomicInt' to the
+        // specified 'swapValue' if the value of 'atomicInt' equals the value
+        // at the specified 'compareValue', providing at least the optionally
+        // specified 'order' memory ordering guarantee (sequential consistency
+        // by default).  Return 'true' if the value of 'atomicInt' was set, and
+        // 'false' otherwise, in which case load the current value of
+        // 'atomicInt' into 'compareValue'.  Note that this operation may fail
+        // spuriously (i.e., even if the values are equal) on some platforms,
+        // and so should be used in a loop; see {Weak Compare-and-Swap}.
+
         // *** atomic functions for pointer ***
 
     static void initPointer(AtomicTypes::Pointer *atomicPtr,
@@ -1081,6 +1429,107 @@ struct AtomicOperations {
         // the value of the specified 'compareValue', and return the initial
         // value of 'atomicPtr', providing the acquire/release memory ordering
         // guarantee.  The whole operation is performed atomically.
+
+    static const void *getPtr(AtomicTypes::Pointer const *atomicPtr,
+                              AtomicMemoryOrder::Enum     order);
+        // Atomically retrieve the value of the specified 'atomicPtr',
+        // providing at least the specified 'order' memory ordering guarantee
+        // (see {Memory Order Parameters}).
+
+    static void setPtr(AtomicTypes::Pointer    *atomicPtr,
+                       const void              *value,
+                       AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicPtr' to the
+        // specified 'value', providing at least the specified 'order' memory
+        // ordering guarantee (see {Memory Order Parameters}).
+
+    static void *swapPtr(AtomicTypes::Pointer    *atomicPtr,
+                         const void              *swapValue,
+                         AtomicMemoryOrder::Enum  order);
+        // Atomically set the value of the specified 'atomicPtr' to the
+        // specified 'swapValue', and return its previous value, providing at
+        // least the specified 'order' memory ordering guarantee (see {Memory
+        // Order Parameters}).
+
+    static void *testAndSwapPtr(AtomicTypes::Pointer    *atomicPtr,
+                                const void              *compareValue,
+                                const void              *swapValue,
+                                AtomicMemoryOrder::Enum  order);
+        // Conditionally set the value of the specified 'atomicPtr' to the
+        // specified 'swapValue' if and only if the value of 'atomicPtr' equals
+        // the value of the specified 'compareValue', and return the initial
+        // value of 'atomicPtr', providing at least the specified 'order'
+        // memory ordering guarantee (see {Memory Order Parameters}).
+
+    static bool testAndSwapPtrWeak(
+            AtomicTypes::Pointer     *atomicPtr,
+            const void              **compareValue,
+            const void               *swapValue,
+            AtomicMemoryOrder::Enum   order = AtomicMemoryOrder::BSLS_SEQ_CST);
+        // Conditionally set the value of the specified 'atomicPtr' to the
+        // specified 'swapValue' if the value of 'atomicPtr' equals the value
+        // at the specified 'compareValue', providing at least the optionally
+        // specified 'order' memory ordering guarantee (sequential consistency
+        // by default).  Return 'true' if the value of 'atomicPtr' was set, and
+        // 'false' otherwise, in which case load the current value of
+        // 'atomicPtr' into 'compareValue'.  Note that this operation may fail
+        // spuriously (i.e., even if the values are equal) on some platforms,
+        // and so should be used in a loop; see {Weak Compare-and-Swap}.
+
+        // *** atomic functions for double word ***
+
+    static void initDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                               Types::UintPtr           first = 0,
+                               Types::UintPtr           second = 0);
+        // Initialize the specified 'atomicWord' and set its first and second
+        // words to the optionally specified 'first' and 'second' values,
+        // respectively (0 by default).
+
+    static void getDoubleWord(AtomicTypes::DoubleWord const *atomicWord,
+                              Types::UintPtr                *first,
+                              Types::UintPtr                *second);
+        // Atomically load the first and second words of the specified
+        // 'atomicWord' into the specified 'first' and 'second', respectively,
+        // providing the sequential consistency memory ordering guarantee.
+
+    static void setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr           first,
+                              Types::UintPtr           second);
+        // Atomically set the first and second words of the specified
+        // 'atomicWord' to the specified 'first' and 'second' values,
+        // respectively, providing the sequential consistency memory ordering
+        // guarantee.
+
+    static bool testAndSwapDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                                      Types::UintPtr          *compareFirst,
+                                      Types::UintPtr          *compareSecond,
+                                      Types::UintPtr           swapFirst,
+                                      Types::UintPtr           swapSecond);
+        // Conditionally set the first and second words of the specified
+        // 'atomicWord' to the specified 'swapFirst' and 'swapSecond' values,
+        // respectively, if and only if they are equal to the values at the
+        // specified 'compareFirst' and 'compareSecond', respectively,
+        // providing the sequential consistency memory ordering guarantee.
+        // Return 'true' if 'atomicWord' was set, and 'false' otherwise, in
+        // which case load the current words of 'atomicWord' into
+        // 'compareFirst' and 'compareSecond'.  The whole operation is
+        // performed atomically.
+
+    static bool isDoubleWordLockFree();
+        // Return 'true' if the double-word operations are implemented using a
+        // native (lock-free) instruction on this platform, and 'false' if they
+        // are serialized by an internal lock (see {Atomic Double-Word
+        // Operations}).
+
+        // *** memory fences ***
+
+    static void fenceAcquire();
+        // Prevent memory accesses following this call from being reordered
+        // before loads preceding it (see {Memory Fences}).
+
+    static void fenceRelease();
+        // Prevent memory accesses preceding this call from being reordered
+        // after stores following it (see {Memory Fences}).
 };
 
 // ===========================================================================
@@ -1245,6 +1694,165 @@ void AtomicOperations::decrementIntAcqRel(AtomicTypes::Int *atomicInt)
     Imp::decrementIntAcqRel(atomicInt);
 }
 
+inline
+int AtomicOperations::fetchAndInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchAndInt(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchAndIntAcqRel(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchAndIntAcqRel(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchOrInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchOrInt(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchOrIntAcqRel(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchOrIntAcqRel(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchXorInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchXorInt(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchXorIntAcqRel(AtomicTypes::Int *atomicInt, int mask)
+{
+    return Imp::fetchXorIntAcqRel(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::andInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    Imp::andInt(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::orInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    Imp::orInt(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::xorInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    Imp::xorInt(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::getInt(AtomicTypes::Int const  *atomicInt,
+                             AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        return Imp::getIntRelaxed(atomicInt);                         // RETURN
+    }
+    if (AtomicMemoryOrder::BSLS_ACQUIRE == order) {
+        return Imp::getIntAcquire(atomicInt);                         // RETURN
+    }
+    return Imp::getInt(atomicInt);
+}
+
+inline
+void AtomicOperations::setInt(AtomicTypes::Int        *atomicInt,
+                              int                      value,
+                              AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        Imp::setIntRelaxed(atomicInt, value);
+    }
+    else if (AtomicMemoryOrder::BSLS_RELEASE == order) {
+        Imp::setIntRelease(atomicInt, value);
+    }
+    else {
+        Imp::setInt(atomicInt, value);
+    }
+}
+
+inline
+int AtomicOperations::swapInt(AtomicTypes::Int        *atomicInt,
+                              int                      swapValue,
+                              AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::swapInt(atomicInt, swapValue)
+           : Imp::swapIntAcqRel(atomicInt, swapValue);
+}
+
+inline
+int AtomicOperations::testAndSwapInt(AtomicTypes::Int        *atomicInt,
+                                     int                      compareValue,
+                                     int                      swapValue,
+                                     AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::testAndSwapInt(atomicInt, compareValue, swapValue)
+           : Imp::testAndSwapIntAcqRel(atomicInt, compareValue, swapValue);
+}
+
+inline
+int AtomicOperations::addIntNv(AtomicTypes::Int        *atomicInt,
+                               int                      value,
+                               AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        return Imp::addIntNvRelaxed(atomicInt, value);                // RETURN
+    }
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::addIntNv(atomicInt, value)
+           : Imp::addIntNvAcqRel(atomicInt, value);
+}
+
+inline
+int AtomicOperations::fetchAndInt(AtomicTypes::Int        *atomicInt,
+                                  int                      mask,
+                                  AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchAndInt(atomicInt, mask)
+           : Imp::fetchAndIntAcqRel(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchOrInt(AtomicTypes::Int        *atomicInt,
+                                 int                      mask,
+                                 AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchOrInt(atomicInt, mask)
+           : Imp::fetchOrIntAcqRel(atomicInt, mask);
+}
+
+inline
+int AtomicOperations::fetchXorInt(AtomicTypes::Int        *atomicInt,
+                                  int                      mask,
+                                  AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchXorInt(atomicInt, mask)
+           : Imp::fetchXorIntAcqRel(atomicInt, mask);
+}
+
+inline
+bool
+    AtomicOperations::testAndSwapIntWeak(AtomicTypes::Int        *atomicInt,
+                                         int                     *compareValue,
+                                         int                      swapValue,
+                                         AtomicMemoryOrder::Enum  order)
+{
+    const int expected = *compareValue;
+    *compareValue = testAndSwapInt(atomicInt, expected, swapValue, order);
+    return expected == *compareValue;
+}
+
 inline
 void AtomicOperations::initInt64(AtomicTypes::Int64 *atomicInt,
                                  Types::Int64        initialValue)
@@ -1420,6 +2028,181 @@ Types::Int64
     return Imp::decrementInt64NvAcqRel(atomicInt);
 }
 
+inline
+Types::Int64 AtomicOperations::fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        mask)
+{
+    return Imp::fetchAndInt64(atomicInt, mask);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchAndInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64        mask)
+{
+    return Imp::fetchAndInt64AcqRel(atomicInt, mask);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                            Types::Int64        mask)
+{
+    return Imp::fetchOrInt64(atomicInt, mask);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchOrInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                         Types::Int64        mask)
+{
+    return Imp::fetchOrInt64AcqRel(atomicInt, mask);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                             Types::Int64        mask)
+{
+    return Imp::fetchXorInt64(atomicInt, mask);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchXorInt64AcqRel(AtomicTypes::Int64 *atomicInt,
+                                          Types::Int64        mask)
+{
+    return Imp::fetchXorInt64AcqRel(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::andInt64(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        mask)
+{
+    Imp::andInt64(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::orInt64(AtomicTypes::Int64 *atomicInt,
+                               Types::Int64        mask)
+{
+    Imp::orInt64(atomicInt, mask);
+}
+
+inline
+void AtomicOperations::xorInt64(AtomicTypes::Int64 *atomicInt,
+                                Types::Int64        mask)
+{
+    Imp::xorInt64(atomicInt, mask);
+}
+
+inline
+Types::Int64 AtomicOperations::getInt64(AtomicTypes::Int64 const *atomicInt,
+                                        AtomicMemoryOrder::Enum   order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        return Imp::getInt64Relaxed(atomicInt);                       // RETURN
+    }
+    if (AtomicMemoryOrder::BSLS_ACQUIRE == order) {
+        return Imp::getInt64Acquire(atomicInt);                       // RETURN
+    }
+    return Imp::getInt64(atomicInt);
+}
+
+inline
+void AtomicOperations::setInt64(AtomicTypes::Int64      *atomicInt,
+                                Types::Int64             value,
+                                AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        Imp::setInt64Relaxed(atomicInt, value);
+    }
+    else if (AtomicMemoryOrder::BSLS_RELEASE == order) {
+        Imp::setInt64Release(atomicInt, value);
+    }
+    else {
+        Imp::setInt64(atomicInt, value);
+    }
+}
+
+inline
+Types::Int64 AtomicOperations::swapInt64(AtomicTypes::Int64      *atomicInt,
+                                         Types::Int64             swapValue,
+                                         AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::swapInt64(atomicInt, swapValue)
+           : Imp::swapInt64AcqRel(atomicInt, swapValue);
+}
+
+inline
+Types::Int64
+    AtomicOperations::testAndSwapInt64(AtomicTypes::Int64      *atomicInt,
+                                       Types::Int64             compareValue,
+                                       Types::Int64             swapValue,
+                                       AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::testAndSwapInt64(atomicInt, compareValue, swapValue)
+           : Imp::testAndSwapInt64AcqRel(atomicInt, compareValue, swapValue);
+}
+
+inline
+Types::Int64 AtomicOperations::addInt64Nv(AtomicTypes::Int64      *atomicInt,
+                                          Types::Int64             value,
+                                          AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        return Imp::addInt64NvRelaxed(atomicInt, value);              // RETURN
+    }
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::addInt64Nv(atomicInt, value)
+           : Imp::addInt64NvAcqRel(atomicInt, value);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchAndInt64(AtomicTypes::Int64      *atomicInt,
+                                    Types::Int64             mask,
+                                    AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchAndInt64(atomicInt, mask)
+           : Imp::fetchAndInt64AcqRel(atomicInt, mask);
+}
+
+inline
+Types::Int64 AtomicOperations::fetchOrInt64(AtomicTypes::Int64      *atomicInt,
+                                            Types::Int64             mask,
+                                            AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchOrInt64(atomicInt, mask)
+           : Imp::fetchOrInt64AcqRel(atomicInt, mask);
+}
+
+inline
+Types::Int64
+    AtomicOperations::fetchXorInt64(AtomicTypes::Int64      *atomicInt,
+                                    Types::Int64             mask,
+                                    AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::fetchXorInt64(atomicInt, mask)
+           : Imp::fetchXorInt64AcqRel(atomicInt, mask);
+}
+
+inline
+bool
+    AtomicOperations::testAndSwapInt64Weak(
+                                         AtomicTypes::Int64      *atomicInt,
+                                         Types::Int64            *compareValue,
+                                         Types::Int64             swapValue,
+                                         AtomicMemoryOrder::Enum  order)
+{
+    const Types::Int64 expected = *compareValue;
+    *compareValue = testAndSwapInt64(atomicInt, expected, swapValue, order);
+    return expected == *compareValue;
+}
+
 inline
 void AtomicOperations::initPointer(AtomicTypes::Pointer *atomicPtr,
                                    const void           *initialValue)
@@ -1499,6 +2282,127 @@ void *AtomicOperations::testAndSwapPtrAcqRel(
     return Imp::testAndSwapPtrAcqRel(atomicPtr, compareValue, swapValue);
 }
 
+inline
+const void *AtomicOperations::getPtr(AtomicTypes::Pointer const *atomicPtr,
+                                     AtomicMemoryOrder::Enum     order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        return Imp::getPtrRelaxed(atomicPtr);                         // RETURN
+    }
+    if (AtomicMemoryOrder::BSLS_ACQUIRE == order) {
+        return Imp::getPtrAcquire(atomicPtr);                         // RETURN
+    }
+    return Imp::getPtr(atomicPtr);
+}
+
+inline
+void AtomicOperations::setPtr(AtomicTypes::Pointer    *atomicPtr,
+                              const void              *value,
+                              AtomicMemoryOrder::Enum  order)
+{
+    if (AtomicMemoryOrder::BSLS_RELAXED == order) {
+        Imp::setPtrRelaxed(atomicPtr, value);
+    }
+    else if (AtomicMemoryOrder::BSLS_RELEASE == order) {
+        Imp::setPtrRelease(atomicPtr, value);
+    }
+    else {
+        Imp::setPtr(atomicPtr, value);
+    }
+}
+
+inline
+void *AtomicOperations::swapPtr(AtomicTypes::Pointer    *atomicPtr,
+                                const void              *swapValue,
+                                AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::swapPtr(atomicPtr, swapValue)
+           : Imp::swapPtrAcqRel(atomicPtr, swapValue);
+}
+
+inline
+void *AtomicOperations::testAndSwapPtr(AtomicTypes::Pointer    *atomicPtr,
+                                       const void              *compareValue,
+                                       const void              *swapValue,
+                                       AtomicMemoryOrder::Enum  order)
+{
+    return AtomicMemoryOrder::BSLS_SEQ_CST == order
+           ? Imp::testAndSwapPtr(atomicPtr, compareValue, swapValue)
+           : Imp::testAndSwapPtrAcqRel(atomicPtr, compareValue, swapValue);
+}
+
+inline
+bool
+    AtomicOperations::testAndSwapPtrWeak(
+                                        AtomicTypes::Pointer     *atomicPtr,
+                                        const void              **compareValue,
+                                        const void               *swapValue,
+                                        AtomicMemoryOrder::Enum   order)
+{
+    const void *expected = *compareValue;
+    *compareValue = testAndSwapPtr(atomicPtr, expected, swapValue, order);
+    return expected == *compareValue;
+}
+
+inline
+void AtomicOperations::initDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                                      Types::UintPtr           first,
+                                      Types::UintPtr           second)
+{
+    Imp::initDoubleWord(atomicWord, first, second);
+}
+
+inline
+void AtomicOperations::getDoubleWord(AtomicTypes::DoubleWord const *atomicWord,
+                                     Types::UintPtr                *first,
+                                     Types::UintPtr                *second)
+{
+    Imp::getDoubleWord(atomicWord, first, second);
+}
+
+inline
+void AtomicOperations::setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                                     Types::UintPtr           first,
+                                     Types::UintPtr           second)
+{
+    Imp::setDoubleWord(atomicWord, first, second);
+}
+
+inline
+bool
+    AtomicOperations::testAndSwapDoubleWord(
+                                        AtomicTypes::DoubleWord *atomicWord,
+                                        Types::UintPtr          *compareFirst,
+                                        Types::UintPtr          *compareSecond,
+                                        Types::UintPtr           swapFirst,
+                                        Types::UintPtr           swapSecond)
+{
+    return Imp::testAndSwapDoubleWord(atomicWord,
+                                      compareFirst,
+                                      compareSecond,
+                                      swapFirst,
+                                      swapSecond);
+}
+
+inline
+bool AtomicOperations::isDoubleWordLockFree()
+{
+    return Imp::isDoubleWordLockFree();
+}
+
+inline
+void AtomicOperations::fenceAcquire()
+{
+    Imp::fenceAcquire();
+}
+
+inline
+void AtomicOperations::fenceRelease()
+{
+    Imp::fenceRelease();
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -58,6 +58,39 @@ using namespace std;
 // [2 ] setPtr(Pointer *aPointer, void *value);
 // [4 ] swapPtr(Pointer *aPointer, void *value);
 // [4 ] testAndSwapPtr(Pointer *, void *, void *);
+// [13] fetchAndInt(Int *, int);
+// [13] fetchOrInt(Int *, int);
+// [13] fetchXorInt(Int *, int);
+// [13] andInt(Int *, int);
+// [13] orInt(Int *, int);
+// [13] xorInt(Int *, int);
+// [13] fetchAndInt64(Int64 *, bsls::Types::Int64);
+// [13] fetchOrInt64(Int64 *, bsls::Types::Int64);
+// [13] fetchXorInt64(Int64 *, bsls::Types::Int64);
+// [13] andInt64(Int64 *, bsls::Types::Int64);
+// [13] orInt64(Int64 *, bsls::Types::Int64);
+// [13] xorInt64(Int64 *, bsls::Types::Int64);
+// [14] getInt(const Int *, AtomicMemoryOrder::Enum);
+// [14] setInt(Int *, int, AtomicMemoryOrder::Enum);
+// [14] swapInt(Int *, int, AtomicMemoryOrder::Enum);
+// [14] testAndSwapInt(Int *, int, int, AtomicMemoryOrder::Enum);
+// [14] addIntNv(Int *, int, AtomicMemoryOrder::Enum);
+// [14] fetchOrInt(Int *, int, AtomicMemoryOrder::Enum);
+// [14] testAndSwapIntWeak(Int *, int *, int, AtomicMemoryOrder::Enum);
+// [14] getInt64(const Int64 *, AtomicMemoryOrder::Enum);
+// [14] setInt64(Int64 *, Int64, AtomicMemoryOrder::Enum);
+// [14] testAndSwapInt64Weak(Int64 *, Int64 *, Int64, ...::Enum);
+// [14] getPtr(const Pointer *, AtomicMemoryOrder::Enum);
+// [14] setPtr(Pointer *, const void *, AtomicMemoryOrder::Enum);
+// [14] swapPtr(Pointer *, const void *, AtomicMemoryOrder::Enum);
+// [14] testAndSwapPtrWeak(Pointer *, const void **, const void *, ...);
+// [15] initDoubleWord(DoubleWord *, UintPtr, UintPtr);
+// [15] getDoubleWord(const DoubleWord *, UintPtr *, UintPtr *);
+// [15] setDoubleWord(DoubleWord *, UintPtr, UintPtr);
+// [15] testAndSwapDoubleWord(DoubleWord *, UintPtr *, UintPtr *, ...);
+// [15] isDoubleWordLockFree();
+// [16] fenceAcquire();
+// [16] fenceRelease();
 //-----------------------------------------------------------------------------
 // [1 ] Breathing test
 // [7 ] Usage examples
@@ -404,6 +437,198 @@ static void  myJoinThread(my_thread_t aHandle)
 #endif
 }
 
+struct BitClaimArgs
+{
+    Types::Int   *d_bits_p;      // 32 slots, one per bit
+    Types::Int64 *d_bits64_p;    // 64 slots, one per bit
+    Types::Int   *d_claims_p;    // number of claims of each of the 96 slots
+};
+
+static void *bitClaimThread(void *ptr)
+    // Attempt to claim (i.e., set) every bit of the 'int' and 'Int64' bitmaps
+    // in the 'BitClaimArgs' object at the specified 'ptr', counting a claim of
+    // a slot whenever the returned previous value shows that the bit was not
+    // already set.
+{
+    BitClaimArgs *args = (BitClaimArgs *) ptr;
+
+    for (int i = 0; i < 32; ++i) {
+        const int mask = 1 << i;
+        if (!(Obj::fetchOrInt(args->d_bits_p, mask) & mask)) {
+            Obj::incrementInt(&args->d_claims_p[i]);
+        }
+    }
+    for (int i = 0; i < 64; ++i) {
+        const bsls::Types::Int64 mask = 1LL << i;
+        if (!(Obj::fetchOrInt64AcqRel(args->d_bits64_p, mask) & mask)) {
+            Obj::incrementInt(&args->d_claims_p[32 + i]);
+        }
+    }
+    return ptr;
+}
+
+struct WeakIncrementArgs
+{
+    Types::Int   *d_value_p;
+    Types::Int64 *d_value64_p;
+    int           d_m;
+};
+
+static void *weakIncrementThread(void *ptr)
+    // Increment the 'int' and 'Int64' values in the 'WeakIncrementArgs'
+    // object at the specified 'ptr' the specified number of times, using
+    // weak compare-and-swap loops.
+{
+    WeakIncrementArgs *args = (WeakIncrementArgs *) ptr;
+
+    for (int i = 0; i < args->d_m; ++i) {
+        int value = Obj::getInt(args->d_value_p,
+                                bsls::AtomicMemoryOrder::BSLS_RELAXED);
+        while (!Obj::testAndSwapIntWeak(args->d_value_p,
+                                        &value,
+                                        value + 1,
+                                        bsls::AtomicMemoryOrder::BSLS_ACQ_REL))
+        {
+        }
+
+        bsls::Types::Int64 value64 = Obj::getInt64Relaxed(args->d_value64_p);
+        while (!Obj::testAndSwapInt64Weak(args->d_value64_p,
+                                          &value64,
+                                          value64 + 1)) {
+        }
+    }
+    return ptr;
+}
+
+template <class IMP>
+struct DoubleWordArgs
+{
+    Types::DoubleWord *d_word_p;  // (count, 2 * count)
+    int                d_m;
+};
+
+template <class IMP>
+void *doubleWordThread(void *ptr)
+    // Increment the double word '(count, 2 * count)' in the 'DoubleWordArgs'
+    // object at the specified 'ptr' the specified number of times to
+    // '(count + 1, 2 * (count + 1))' using the double-word operations of the
+    // specified 'IMP', verifying that no torn value is ever observed.
+{
+    DoubleWordArgs<IMP> *args = (DoubleWordArgs<IMP> *) ptr;
+
+    for (int i = 0; i < args->d_m; ++i) {
+        bsls::Types::UintPtr first, second;
+        IMP::getDoubleWord(args->d_word_p, &first, &second);
+        LOOP2_ASSERT(first, second, 2 * first == second);
+
+        while (!IMP::testAndSwapDoubleWord(args->d_word_p,
+                                           &first,
+                                           &second,
+                                           first + 1,
+                                           second + 2)) {
+            LOOP2_ASSERT(first, second, 2 * first == second);
+        }
+    }
+    return ptr;
+}
+
+template <class FENCE>
+struct SeqLockArgs
+{
+    Types::Int   *d_sequence_p;  // odd while the data is being written
+    volatile int *d_data_p;      // two words, '(n, 2 * n)'
+    Types::Int   *d_done_p;      // non-zero once the writer has finished
+    int           d_m;           // number of updates
+};
+
+template <class FENCE>
+void *seqLockWriterThread(void *ptr)
+    // Update the data protected by the sequence lock in the 'SeqLockArgs'
+    // object at the specified 'ptr' the specified number of times from
+    // '(n, 2 * n)' to '(n + 1, 2 * (n + 1))', using the fences of the
+    // specified 'FENCE'.
+{
+    SeqLockArgs<FENCE> *args = (SeqLockArgs<FENCE> *) ptr;
+
+    for (int i = 1; i <= args->d_m; ++i) {
+        const int sequence = Obj::getIntRelaxed(args->d_sequence_p);
+
+        Obj::setIntRelaxed(args->d_sequence_p, sequence + 1);
+        FENCE::fenceRelease();
+
+        args->d_data_p[0] = i;
+        args->d_data_p[1] = 2 * i;
+
+        Obj::setIntRelease(args->d_sequence_p, sequence + 2);
+    }
+    Obj::setIntRelease(args->d_done_p, 1);
+    return ptr;
+}
+
+template <class FENCE>
+void *seqLockReaderThread(void *ptr)
+    // Read the data protected by the sequence lock in the 'SeqLockArgs'
+    // object at the specified 'ptr' until the writer has finished, using the
+    // fences of the specified 'FENCE', and verify that no torn value is ever
+    // accepted.
+{
+    SeqLockArgs<FENCE> *args = (SeqLockArgs<FENCE> *) ptr;
+
+    while (!Obj::getIntAcquire(args->d_done_p)) {
+        const int sequence = Obj::getIntAcquire(args->d_sequence_p);
+
+        const int first  = args->d_data_p[0];
+        const int second = args->d_data_p[1];
+
+        FENCE::fenceAcquire();
+
+        if (0 == sequence % 2
+         && sequence == Obj::getIntRelaxed(args->d_sequence_p)) {
+            LOOP2_ASSERT(first, second, 2 * first == second);
+        }
+    }
+    return ptr;
+}
+
+template <class FENCE>
+void testSeqLock()
+    // Have one thread update the data protected by a sequence lock while
+    // several threads read it, using the fences of the specified 'FENCE',
+    // and verify the final value of the data.
+{
+    enum {
+        N = 3,
+        M = 200000
+    };
+
+    Types::Int   sequence;
+    Types::Int   done;
+    volatile int data[2] = { 0, 0 };
+
+    Obj::initInt(&sequence, 0);
+    Obj::initInt(&done, 0);
+
+    SeqLockArgs<FENCE> args;
+    args.d_sequence_p = &sequence;
+    args.d_data_p     = data;
+    args.d_done_p     = &done;
+    args.d_m          = M;
+
+    my_thread_t threadHandles[N + 1];
+
+    for (int i = 0; i < N; ++i) {
+        myCreateThread(&threadHandles[i], seqLockReaderThread<FENCE>, &args);
+    }
+    myCreateThread(&threadHandles[N], seqLockWriterThread<FENCE>, &args);
+
+    for (int i = 0; i <= N; ++i) {
+        myJoinThread(threadHandles[i]);
+    }
+
+    LOOP_ASSERT(data[0], M     == data[0]);
+    LOOP_ASSERT(data[1], 2 * M == data[1]);
+    LOOP_ASSERT(Obj::getInt(&sequence), 2 * M == Obj::getInt(&sequence));
+}
 
 struct Case9
 {
@@ -1620,6 +1845,608 @@ int main(int argc, char *argv[]) {
 #endif
 
     switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING MEMORY FENCES
+        //
+        // Concerns:
+        //: 1 A release fence orders the stores preceding it before the stores
+        //:   following it.
+        //:
+        //: 2 An acquire fence orders the loads preceding it before the loads
+        //:   following it.
+        //:
+        //: 3 The default implementation meets the same concerns as the
+        //:   platform implementation.
+        //
+        // Plan:
+        //: 1 For each of 'Obj' and the default fence class, have one thread
+        //:   repeatedly update two words '(n, 2 * n)' to
+        //:   '(n + 1, 2 * (n + 1))' under a sequence lock, while several
+        //:   threads read the words, and verify that every read accepted by
+        //:   the sequence lock is consistent.  (C-1..3)
+        //
+        // Testing:
+        //   fenceAcquire();
+        //   fenceRelease();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING MEMORY FENCES"
+                          << "\n=====================" << endl;
+
+        if (verbose) cout << "\nPlatform fences." << endl;
+
+        testSeqLock<Obj>();
+
+        if (verbose) cout << "\nDefault fences." << endl;
+
+        testSeqLock<bsls::AtomicOperations_DefaultFence<Obj::Imp> >();
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING DOUBLE-WORD OPERATIONS
+        //
+        // Concerns:
+        //: 1 'initDoubleWord' sets both words, which 'getDoubleWord' returns.
+        //:
+        //: 2 'testAndSwapDoubleWord' sets both words if and only if both
+        //:   compare equal, and otherwise loads the current words into the
+        //:   comparands.
+        //:
+        //: 3 Concurrent updates are neither lost nor observed torn.
+        //:
+        //: 4 The lock-based default implementation meets the same concerns
+        //:   as the platform implementation.
+        //:
+        //: 5 On x86-64, the operations are lock-free if and only if the
+        //:   processor supports 'cmpxchg16b'.
+        //
+        // Plan:
+        //: 1 For each of 'Obj' and the lock-based default class, exercise each
+        //:   function on a table of values, comparing one or both words
+        //:   unequal.  (C-1..2, 4)
+        //:
+        //: 2 For each of 'Obj' and the lock-based default class, have several
+        //:   threads repeatedly advance a double word '(n, 2 * n)' to
+        //:   '(n + 1, 2 * (n + 1))' with a compare-and-swap loop, checking
+        //:   every observed value, and verify the final value.  (C-3..4)
+        //:
+        //: 3 On x86-64, verify that 'isDoubleWordLockFree' agrees with
+        //:   'hasCmpxchg16b' on repeated calls.  (C-5)
+        //
+        // Testing:
+        //   initDoubleWord(DoubleWord *, UintPtr, UintPtr);
+        //   getDoubleWord(const DoubleWord *, UintPtr *, UintPtr *);
+        //   setDoubleWord(DoubleWord *, UintPtr, UintPtr);
+        //   testAndSwapDoubleWord(DoubleWord *, UintPtr *, UintPtr *, ...);
+        //   isDoubleWordLockFree();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING DOUBLE-WORD OPERATIONS"
+                          << "\n==============================" << endl;
+
+        typedef bsls::AtomicOperations_DefaultDoubleWord<Obj::Imp> LockObj;
+        typedef bsls::Types::UintPtr                               UintPtr;
+
+        if (verbose) P(Obj::isDoubleWordLockFree());
+        ASSERT(!LockObj::isDoubleWordLockFree());
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_MSVC))
+        if (verbose) P(Obj::Imp::hasCmpxchg16b());
+        for (int i = 0; i < 2; ++i) {
+            LOOP_ASSERT(i, Obj::Imp::hasCmpxchg16b()
+                                             == Obj::isDoubleWordLockFree());
+        }
+#endif
+
+        if (verbose) cout << "\nSingle-threaded semantics." << endl;
+        {
+            static const struct {
+                int     d_line;
+                UintPtr d_first;
+                UintPtr d_second;
+            } DATA[] = {
+                //LINE  FIRST              SECOND
+                //----  -----------------  -----------------
+                { L_,   0,                 0                 },
+                { L_,   1,                 0                 },
+                { L_,   0,                 1                 },
+                { L_,   0x33ff33ff,        0xff33ff33        },
+                { L_,   ~UintPtr(0),       ~UintPtr(0)       },
+                { L_,   ~UintPtr(0) >> 1,  UintPtr(1) << 31  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int     LINE   = DATA[i].d_line;
+                const UintPtr FIRST  = DATA[i].d_first;
+                const UintPtr SECOND = DATA[i].d_second;
+
+                for (int j = 0; j < 2; ++j) {
+                    Types::DoubleWord x;
+                    UintPtr           first, second;
+
+                    if (j) LockObj::initDoubleWord(&x, FIRST, SECOND);
+                    else   Obj::initDoubleWord(&x, FIRST, SECOND);
+
+                    if (j) LockObj::getDoubleWord(&x, &first, &second);
+                    else   Obj::getDoubleWord(&x, &first, &second);
+                    LOOP_ASSERT(LINE, FIRST  == first);
+                    LOOP_ASSERT(LINE, SECOND == second);
+
+                    // Mismatch in the first word.
+
+                    first  = FIRST + 1;
+                    second = SECOND;
+                    bool result = j
+                       ? LockObj::testAndSwapDoubleWord(&x, &first, &second,
+                                                        7, 8)
+                       : Obj::testAndSwapDoubleWord(&x, &first, &second, 7, 8);
+                    LOOP_ASSERT(LINE, !result);
+                    LOOP_ASSERT(LINE, FIRST  == first);
+                    LOOP_ASSERT(LINE, SECOND == second);
+
+                    // Mismatch in the second word.
+
+                    second = SECOND - 1;
+                    result = j
+                       ? LockObj::testAndSwapDoubleWord(&x, &first, &second,
+                                                        7, 8)
+                       : Obj::testAndSwapDoubleWord(&x, &first, &second, 7, 8);
+                    LOOP_ASSERT(LINE, !result);
+                    LOOP_ASSERT(LINE, FIRST  == first);
+                    LOOP_ASSERT(LINE, SECOND == second);
+
+                    // Match.
+
+                    result = j
+                       ? LockObj::testAndSwapDoubleWord(&x, &first, &second,
+                                                        SECOND, FIRST)
+                       : Obj::testAndSwapDoubleWord(&x, &first, &second,
+                                                    SECOND, FIRST);
+                    LOOP_ASSERT(LINE, result);
+                    LOOP_ASSERT(LINE, FIRST  == first);
+                    LOOP_ASSERT(LINE, SECOND == second);
+
+                    if (j) LockObj::getDoubleWord(&x, &first, &second);
+                    else   Obj::getDoubleWord(&x, &first, &second);
+                    LOOP_ASSERT(LINE, SECOND == first);
+                    LOOP_ASSERT(LINE, FIRST  == second);
+
+                    if (j) LockObj::setDoubleWord(&x, FIRST, SECOND);
+                    else   Obj::setDoubleWord(&x, FIRST, SECOND);
+
+                    if (j) LockObj::getDoubleWord(&x, &first, &second);
+                    else   Obj::getDoubleWord(&x, &first, &second);
+                    LOOP_ASSERT(LINE, FIRST  == first);
+                    LOOP_ASSERT(LINE, SECOND == second);
+                }
+            }
+
+            Types::DoubleWord x;
+            UintPtr           first = 1, second = 1;
+            Obj::initDoubleWord(&x);
+            Obj::getDoubleWord(&x, &first, &second);
+            ASSERT(0 == first);
+            ASSERT(0 == second);
+        }
+
+        if (verbose) cout << "\nConcurrent updates." << endl;
+        {
+            enum {
+                N = 4,
+                M = 20000
+            };
+
+            my_thread_t threadHandles[N];
+
+            Types::DoubleWord word;
+            Obj::initDoubleWord(&word);
+
+            DoubleWordArgs<Obj> args;
+            args.d_word_p = &word;
+            args.d_m      = M;
+
+            for (int i = 0; i < N; ++i) {
+                myCreateThread(&threadHandles[i],
+                               doubleWordThread<Obj>,
+                               &args);
+            }
+            for (int i = 0; i < N; ++i) {
+                myJoinThread(threadHandles[i]);
+            }
+
+            UintPtr first, second;
+            Obj::getDoubleWord(&word, &first, &second);
+            LOOP_ASSERT(first,  N * M     == first);
+            LOOP_ASSERT(second, 2 * N * M == second);
+
+            LockObj::initDoubleWord(&word);
+
+            DoubleWordArgs<LockObj> lockArgs;
+            lockArgs.d_word_p = &word;
+            lockArgs.d_m      = M;
+
+            for (int i = 0; i < N; ++i) {
+                myCreateThread(&threadHandles[i],
+                               doubleWordThread<LockObj>,
+                               &lockArgs);
+            }
+            for (int i = 0; i < N; ++i) {
+                myJoinThread(threadHandles[i]);
+            }
+
+            LockObj::getDoubleWord(&word, &first, &second);
+            LOOP_ASSERT(first,  N * M     == first);
+            LOOP_ASSERT(second, 2 * N * M == second);
+        }
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING MEMORY-ORDER PARAMETERS AND WEAK COMPARE-AND-SWAP
+        //
+        // Concerns:
+        //: 1 Each memory-order-parameterized overload performs the operation
+        //:   of the corresponding named function, for every 'order'.
+        //:
+        //: 2 The weak compare-and-swap functions report success, and on
+        //:   failure load the current value into the comparand.
+        //:
+        //: 3 Weak compare-and-swap loops do not lose concurrent updates.
+        //
+        // Plan:
+        //: 1 For each 'order', exercise each overload and verify the returned
+        //:   and resulting values.  (C-1)
+        //:
+        //: 2 Call the weak functions with equal and unequal comparands.  (C-2)
+        //:
+        //: 3 Have several threads increment 'Int' and 'Int64' values using
+        //:   weak compare-and-swap loops, and verify the final values.  (C-3)
+        //
+        // Testing:
+        //   getInt(const Int *, AtomicMemoryOrder::Enum);
+        //   setInt(Int *, int, AtomicMemoryOrder::Enum);
+        //   swapInt(Int *, int, AtomicMemoryOrder::Enum);
+        //   testAndSwapInt(Int *, int, int, AtomicMemoryOrder::Enum);
+        //   addIntNv(Int *, int, AtomicMemoryOrder::Enum);
+        //   fetchOrInt(Int *, int, AtomicMemoryOrder::Enum);
+        //   testAndSwapIntWeak(Int *, int *, int, AtomicMemoryOrder::Enum);
+        //   getInt64(const Int64 *, AtomicMemoryOrder::Enum);
+        //   setInt64(Int64 *, Int64, AtomicMemoryOrder::Enum);
+        //   testAndSwapInt64Weak(Int64 *, Int64 *, Int64, ...::Enum);
+        //   getPtr(const Pointer *, AtomicMemoryOrder::Enum);
+        //   setPtr(Pointer *, const void *, AtomicMemoryOrder::Enum);
+        //   swapPtr(Pointer *, const void *, AtomicMemoryOrder::Enum);
+        //   testAndSwapPtrWeak(Pointer *, const void **, const void *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING MEMORY-ORDER PARAMETERS AND WEAK CAS"
+                          << "\n============================================"
+                          << endl;
+
+        typedef bsls::AtomicMemoryOrder MO;
+
+        static const MO::Enum ORDERS[] = {
+            MO::BSLS_RELAXED,
+            MO::BSLS_ACQUIRE,
+            MO::BSLS_RELEASE,
+            MO::BSLS_ACQ_REL,
+            MO::BSLS_SEQ_CST
+        };
+        const int NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+
+        if (verbose) cout << "\nOrder-parameterized overloads." << endl;
+
+        for (int i = 0; i < NUM_ORDERS; ++i) {
+            const MO::Enum ORDER = ORDERS[i];
+
+            Types::Int x;
+            Obj::initInt(&x, 0);
+            Obj::setInt(&x, 5, ORDER);
+            LOOP_ASSERT(i, 5 == Obj::getInt(&x, ORDER));
+            LOOP_ASSERT(i, 5 == Obj::swapInt(&x, 6, ORDER));
+            LOOP_ASSERT(i, 6 == Obj::testAndSwapInt(&x, 5, 7, ORDER));
+            LOOP_ASSERT(i, 6 == Obj::testAndSwapInt(&x, 6, 7, ORDER));
+            LOOP_ASSERT(i, 9 == Obj::addIntNv(&x, 2, ORDER));
+            LOOP_ASSERT(i, 9 == Obj::fetchOrInt(&x, 6, ORDER));
+            LOOP_ASSERT(i, 15 == Obj::fetchAndInt(&x, 12, ORDER));
+            LOOP_ASSERT(i, 12 == Obj::fetchXorInt(&x, 5, ORDER));
+            LOOP_ASSERT(i, 9 == Obj::getInt(&x));
+
+            Types::Int64 y;
+            Obj::initInt64(&y, 0);
+            Obj::setInt64(&y, OFFSET_64, ORDER);
+            LOOP_ASSERT(i, OFFSET_64 == Obj::getInt64(&y, ORDER));
+            LOOP_ASSERT(i, OFFSET_64 == Obj::swapInt64(&y, 1, ORDER));
+            LOOP_ASSERT(i, 1 == Obj::testAndSwapInt64(&y, 1, 3, ORDER));
+            LOOP_ASSERT(i, OFFSET_64 + 3 ==
+                                       Obj::addInt64Nv(&y, OFFSET_64, ORDER));
+            LOOP_ASSERT(i, OFFSET_64 + 3 == Obj::fetchAndInt64(&y, 3, ORDER));
+            LOOP_ASSERT(i, 3 == Obj::fetchOrInt64(&y, OFFSET_64, ORDER));
+            LOOP_ASSERT(i, OFFSET_64 + 3 ==
+                                     Obj::fetchXorInt64(&y, OFFSET_64, ORDER));
+            LOOP_ASSERT(i, 3 == Obj::getInt64(&y));
+
+            Types::Pointer z;
+            Obj::initPointer(&z, 0);
+            Obj::setPtr(&z, POINTER_SWAPTEST_VALUE1, ORDER);
+            LOOP_ASSERT(i, POINTER_SWAPTEST_VALUE1 == Obj::getPtr(&z, ORDER));
+            LOOP_ASSERT(i, POINTER_SWAPTEST_VALUE1 ==
+                            Obj::swapPtr(&z, POINTER_SWAPTEST_VALUE2, ORDER));
+            LOOP_ASSERT(i, POINTER_SWAPTEST_VALUE2 ==
+                            Obj::testAndSwapPtr(&z,
+                                                POINTER_SWAPTEST_VALUE2,
+                                                0,
+                                                ORDER));
+            LOOP_ASSERT(i, 0 == Obj::getPtr(&z));
+        }
+
+        if (verbose) cout << "\nWeak compare-and-swap." << endl;
+        {
+            Types::Int x;
+            Obj::initInt(&x, INT_SWAPTEST_VALUE1);
+
+            int expected = INT_SWAPTEST_VALUE2;
+            ASSERT(!Obj::testAndSwapIntWeak(&x, &expected, 0));
+            ASSERT(INT_SWAPTEST_VALUE1 == expected);
+            ASSERT(INT_SWAPTEST_VALUE1 == Obj::getInt(&x));
+
+            // A weak compare-and-swap may fail spuriously; retry until it
+            // succeeds.
+
+            while (!Obj::testAndSwapIntWeak(&x,
+                                            &expected,
+                                            INT_SWAPTEST_VALUE2,
+                                            MO::BSLS_RELEASE)) {
+                ASSERT(INT_SWAPTEST_VALUE1 == expected);
+            }
+            ASSERT(INT_SWAPTEST_VALUE1 == expected);
+            ASSERT(INT_SWAPTEST_VALUE2 == Obj::getInt(&x));
+
+            Types::Int64 y;
+            Obj::initInt64(&y, INT64_SWAPTEST_VALUE1);
+
+            bsls::Types::Int64 expected64 = 0;
+            ASSERT(!Obj::testAndSwapInt64Weak(&y, &expected64, 1));
+            ASSERT(INT64_SWAPTEST_VALUE1 == expected64);
+            while (!Obj::testAndSwapInt64Weak(&y,
+                                              &expected64,
+                                              INT64_SWAPTEST_VALUE2)) {
+            }
+            ASSERT(INT64_SWAPTEST_VALUE2 == Obj::getInt64(&y));
+
+            Types::Pointer z;
+            Obj::initPointer(&z, POINTER_SWAPTEST_VALUE1);
+
+            const void *expectedPtr = 0;
+            ASSERT(!Obj::testAndSwapPtrWeak(&z, &expectedPtr, 0));
+            ASSERT(POINTER_SWAPTEST_VALUE1 == expectedPtr);
+            while (!Obj::testAndSwapPtrWeak(&z,
+                                            &expectedPtr,
+                                            POINTER_SWAPTEST_VALUE2,
+                                            MO::BSLS_ACQ_REL)) {
+            }
+            ASSERT(POINTER_SWAPTEST_VALUE2 == Obj::getPtr(&z));
+        }
+
+        if (verbose) cout << "\nConcurrent weak compare-and-swap." << endl;
+        {
+            enum {
+                N = 4,
+                M = 20000
+            };
+
+            my_thread_t threadHandles[N];
+
+            Types::Int   value;
+            Types::Int64 value64;
+            Obj::initInt(&value, 0);
+            Obj::initInt64(&value64, OFFSET_64);
+
+            WeakIncrementArgs args;
+            args.d_value_p   = &value;
+            args.d_value64_p = &value64;
+            args.d_m         = M;
+
+            for (int i = 0; i < N; ++i) {
+                myCreateThread(&threadHandles[i], weakIncrementThread, &args);
+            }
+            for (int i = 0; i < N; ++i) {
+                myJoinThread(threadHandles[i]);
+            }
+
+            ASSERT(N * M == Obj::getInt(&value));
+            ASSERT(OFFSET_64 + N * M == Obj::getInt64(&value64));
+        }
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BITWISE OPERATIONS
+        //
+        // Concerns:
+        //: 1 Each "fetch" function sets the value to the bitwise AND, OR or
+        //:   XOR of the value and the mask, and returns the previous value.
+        //:
+        //: 2 Each function without the "fetch" prefix sets the same value.
+        //:
+        //: 3 The operations apply to every bit, including the sign bit.
+        //:
+        //: 4 When several threads set the same bits, the returned values
+        //:   identify exactly one thread as having set each bit.
+        //
+        // Plan:
+        //: 1 For a table of value and mask pairs, apply every operation
+        //:   (with each of the sequentially consistent and acquire/release
+        //:   variants) to a copy of the value, and compare the results with
+        //:   those of the non-atomic operators.  (C-1..3)
+        //:
+        //: 2 Have several threads 'fetchOrInt' (and 'fetchOrInt64AcqRel')
+        //:   every bit of a bitmap, counting the bits whose previous value was
+        //:   0, and verify that each bit was counted exactly once.  (C-4)
+        //
+        // Testing:
+        //   fetchAndInt(Int *, int);
+        //   fetchOrInt(Int *, int);
+        //   fetchXorInt(Int *, int);
+        //   andInt(Int *, int);
+        //   orInt(Int *, int);
+        //   xorInt(Int *, int);
+        //   fetchAndInt64(Int64 *, bsls::Types::Int64);
+        //   fetchOrInt64(Int64 *, bsls::Types::Int64);
+        //   fetchXorInt64(Int64 *, bsls::Types::Int64);
+        //   andInt64(Int64 *, bsls::Types::Int64);
+        //   orInt64(Int64 *, bsls::Types::Int64);
+        //   xorInt64(Int64 *, bsls::Types::Int64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING BITWISE OPERATIONS"
+                          << "\n==========================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded semantics." << endl;
+        {
+            static const struct {
+                int                d_line;
+                bsls::Types::Int64 d_value;
+                bsls::Types::Int64 d_mask;
+            } DATA[] = {
+                //LINE  VALUE                   MASK
+                //----  ----------------------  ----------------------
+                { L_,   0,                      0                      },
+                { L_,   0,                      -1                     },
+                { L_,   -1,                     0                      },
+                { L_,   -1,                     -1                     },
+                { L_,   0x0F0F,                 0x00FF                 },
+                { L_,   INT_SWAPTEST_VALUE1,    INT_SWAPTEST_VALUE2    },
+                { L_,   INT64_SWAPTEST_VALUE1,  INT64_SWAPTEST_VALUE2  },
+                { L_,   1LL << 63,              1                      },
+                { L_,   OFFSET_64,              1LL << 63              },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int                LINE   = DATA[i].d_line;
+                const bsls::Types::Int64 VALUE  = DATA[i].d_value;
+                const bsls::Types::Int64 MASK   = DATA[i].d_mask;
+                const int                VALUE32 = static_cast<int>(VALUE);
+                const int                MASK32  = static_cast<int>(MASK);
+
+                if (veryVerbose) { T_(); P_(LINE); P_(VALUE); P(MASK); }
+
+                Types::Int x;
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE, VALUE32 == Obj::fetchAndInt(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 & MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE,
+                            VALUE32 == Obj::fetchAndIntAcqRel(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 & MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                Obj::andInt(&x, MASK32);
+                LOOP_ASSERT(LINE, (VALUE32 & MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE, VALUE32 == Obj::fetchOrInt(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 | MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE,
+                            VALUE32 == Obj::fetchOrIntAcqRel(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 | MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                Obj::orInt(&x, MASK32);
+                LOOP_ASSERT(LINE, (VALUE32 | MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE, VALUE32 == Obj::fetchXorInt(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 ^ MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                LOOP_ASSERT(LINE,
+                            VALUE32 == Obj::fetchXorIntAcqRel(&x, MASK32));
+                LOOP_ASSERT(LINE, (VALUE32 ^ MASK32) == Obj::getInt(&x));
+
+                Obj::initInt(&x, VALUE32);
+                Obj::xorInt(&x, MASK32);
+                LOOP_ASSERT(LINE, (VALUE32 ^ MASK32) == Obj::getInt(&x));
+
+                Types::Int64 y;
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchAndInt64(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE & MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchAndInt64AcqRel(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE & MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                Obj::andInt64(&y, MASK);
+                LOOP_ASSERT(LINE, (VALUE & MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchOrInt64(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE | MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchOrInt64AcqRel(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE | MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                Obj::orInt64(&y, MASK);
+                LOOP_ASSERT(LINE, (VALUE | MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchXorInt64(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE ^ MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                LOOP_ASSERT(LINE, VALUE == Obj::fetchXorInt64AcqRel(&y, MASK));
+                LOOP_ASSERT(LINE, (VALUE ^ MASK) == Obj::getInt64(&y));
+
+                Obj::initInt64(&y, VALUE);
+                Obj::xorInt64(&y, MASK);
+                LOOP_ASSERT(LINE, (VALUE ^ MASK) == Obj::getInt64(&y));
+            }
+        }
+
+        if (verbose) cout << "\nConcurrent claims of bits." << endl;
+        {
+            enum { N = 4 };
+
+            my_thread_t threadHandles[N];
+
+            Types::Int   bits;
+            Types::Int64 bits64;
+            Types::Int   claims[96];
+            Obj::initInt(&bits, 0);
+            Obj::initInt64(&bits64, 0);
+            for (int i = 0; i < 96; ++i) {
+                Obj::initInt(&claims[i], 0);
+            }
+
+            BitClaimArgs args;
+            args.d_bits_p   = &bits;
+            args.d_bits64_p = &bits64;
+            args.d_claims_p = claims;
+
+            for (int i = 0; i < N; ++i) {
+                myCreateThread(&threadHandles[i], bitClaimThread, &args);
+            }
+            for (int i = 0; i < N; ++i) {
+                myJoinThread(threadHandles[i]);
+            }
+
+            ASSERT(-1 == Obj::getInt(&bits));
+            ASSERT(-1 == Obj::getInt64(&bits64));
+            for (int i = 0; i < 96; ++i) {
+                LOOP_ASSERT(i, 1 == Obj::getInt(&claims[i]));
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING GET/SET ACQUIRE/RELEASE MANIPULATORS:
@@ -14,6 +14,7 @@ BSLS_IDENT("$Id: $")
 //  bsls::AtomicOperations_DefaultInt64: defaults for Int64
 //  bsls::AtomicOperations_DefaultPointer32: defaults for 32-bit pointer
 //  bsls::AtomicOperations_DefaultPointer64: defaults for 64-bit pointer
+//  bsls::AtomicOperations_DefaultDoubleWord: lock-based double-word defaults
 //  bsls::AtomicOperations_Default32: all atomics for a generic 32-bit platform
 //  bsls::AtomicOperations_Default64: all atomics for a generic 64-bit platform
 //
@@ -140,6 +141,8 @@ BSLS_IDENT("$Id: $")
 //: o bsls::AtomicOperations_DefaultInt64 - for Int64
 //: o bsls::AtomicOperations_DefaultPointer32 - for 32-bit pointer
 //: o bsls::AtomicOperations_DefaultPointer64 - for 64-bit pointer
+//: o bsls::AtomicOperations_DefaultDoubleWord - for a pair of pointer-sized
+//:   words (see {Double-Word Operations})
 //
 // The platform-specific core atomic operations are left unimplemented in these
 // default implementation classes.  The implementations for those operations
@@ -158,10 +161,12 @@ BSLS_IDENT("$Id: $")
 // This is how the generic platform base classes are composed:
 //: o bsls::AtomicOperations_Default32 : AtomicOperations_DefaultInt,
 //:                                      AtomicOperations_DefaultInt64,
-//:                                      AtomicOperations_DefaultPointer32
+//:                                      AtomicOperations_DefaultPointer32,
+//:                                      AtomicOperations_DefaultDoubleWord
 //: o bsls::AtomicOperations_Default64 : AtomicOperations_DefaultInt,
 //:                                      AtomicOperations_DefaultInt64,
-//:                                      AtomicOperations_DefaultPointer64
+//:                                      AtomicOperations_DefaultPointer64,
+//:                                      AtomicOperations_DefaultDoubleWord
 //
 // A typical derived class implementing platform-specific atomic operations
 // needs to derive from either 'bsls::AtomicOperations_Default32' (if the
@@ -274,14 +279,50 @@ BSLS_IDENT("$Id: $")
 //          void const * volatile d_value
 //                                __attribute__((__aligned__(sizeof(void *))));
 //      };
+//
+//      struct DoubleWord
+//      {
+//          volatile bsls::Types::UintPtr d_words[2]
+//                                            __attribute__((__aligned__(16)));
+//      };
 //  };
 //..
+// A platform lacking a native double-word compare-and-swap instead declares
+// 'typedef bsls::Atomic_DoubleWord DoubleWord;' in its specialization.
+//
+///Double-Word Operations
+///----------------------
+// 'bsls::AtomicOperations_DefaultDoubleWord' provides the double-word
+// operations (operating on a pair of pointer-sized words) in terms of a small
+// table of spin locks, selected by hashing the address of the double word.
+// These operations are therefore not lock-free, but they are correct on every
+// platform, and are used where the hardware does not provide a double-word
+// compare-and-swap.  A platform having such an instruction (e.g., 'cmpxchg16b'
+// on x86-64) overrides all of the double-word operations, including
+// 'isDoubleWordLockFree', in its derived class, and may still delegate to
+// these operations if the processor it runs on lacks the instruction.  Note
+// that the lock-based and native implementations must not be mixed on the
+// same object, which is guaranteed as long as all accesses go through the
+// same 'IMP' class.
+//
+///Memory Fences
+///-------------
+// 'bsls::AtomicOperations_DefaultFence' provides 'fenceAcquire' and
+// 'fenceRelease' in terms of a sequentially consistent 'swapInt' on an
+// 'AtomicTypes::Int' local to the call, relying on every platform
+// implementing that operation with a full memory barrier.  A platform having
+// cheaper fences (e.g., x86 and x86-64, where both fences need only constrain
+// the compiler) overrides them in its derived class.
 //
 ///Usage
 ///-----
 // This component is a private implementation type of 'bsls_atomicoperations';
 // see 'bsls_atomicoperations' for a usage example.
 
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
 #ifndef INCLUDED_BSLS_TYPES
 #include <bsls_types.h>
 #endif
@@ -375,6 +416,27 @@ struct AtomicOperations_DefaultInt
     static void decrementInt(typename AtomicTypes::Int *atomicInt);
 
     static void decrementIntAcqRel(typename AtomicTypes::Int *atomicInt);
+
+    static int fetchAndInt(typename AtomicTypes::Int *atomicInt, int mask);
+
+    static int fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int mask);
+
+    static int fetchOrInt(typename AtomicTypes::Int *atomicInt, int mask);
+
+    static int fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                int mask);
+
+    static int fetchXorInt(typename AtomicTypes::Int *atomicInt, int mask);
+
+    static int fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt,
+                                 int mask);
+
+    static void andInt(typename AtomicTypes::Int *atomicInt, int mask);
+
+    static void orInt(typename AtomicTypes::Int *atomicInt, int mask);
+
+    static void xorInt(typename AtomicTypes::Int *atomicInt, int mask);
 };
 
                     // ====================================
@@ -478,6 +540,36 @@ struct AtomicOperations_DefaultInt64
 
     static Types::Int64 decrementInt64NvAcqRel(
                                        typename AtomicTypes::Int64 *atomicInt);
+
+    static Types::Int64 fetchAndInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 mask);
+
+    static Types::Int64 fetchAndInt64AcqRel(
+                                        typename AtomicTypes::Int64 *atomicInt,
+                                        Types::Int64 mask);
+
+    static Types::Int64 fetchOrInt64(typename AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64 mask);
+
+    static Types::Int64 fetchOrInt64AcqRel(
+                                        typename AtomicTypes::Int64 *atomicInt,
+                                        Types::Int64 mask);
+
+    static Types::Int64 fetchXorInt64(typename AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 mask);
+
+    static Types::Int64 fetchXorInt64AcqRel(
+                                        typename AtomicTypes::Int64 *atomicInt,
+                                        Types::Int64 mask);
+
+    static void andInt64(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 mask);
+
+    static void orInt64(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 mask);
+
+    static void xorInt64(typename AtomicTypes::Int64 *atomicInt,
+                         Types::Int64 mask);
 };
 
                   // ========================================
@@ -641,6 +733,112 @@ struct AtomicOperations_DefaultPointer64
                                       const void *swapValue);
 };
 
+                          // ========================
+                          // struct Atomic_DoubleWord
+                          // ========================
+
+struct Atomic_DoubleWord {
+    // This 'struct' provides the default representation of an atomic double
+    // word (a pair of pointer-sized words) for platforms that do not provide a
+    // native double-word compare-and-swap operation.
+
+    // DATA
+    volatile Types::UintPtr d_words[2];  // first and second word
+};
+
+                  // =========================================
+                  // struct AtomicOperations_DefaultDoubleWord
+                  // =========================================
+
+template <class IMP>
+struct AtomicOperations_DefaultDoubleWord
+    // This class provides default implementations of the atomic operations on
+    // a double word (a pair of pointer-sized words), independent on any
+    // specific platform.  The operations are serialized by a spin lock chosen
+    // from a fixed-size table according to the address of the double word, and
+    // the lock is implemented in terms of the 32-bit integer atomic operations
+    // of the 'IMP' class.  Platforms providing a native double-word
+    // compare-and-swap operation override these operations.
+{
+  public:
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_LOCKS = 64  // number of spin locks in the lock table
+    };
+
+    struct PaddedLock {
+        // This 'struct' holds a spin lock, padded so that the locks in the
+        // lock table do not share cache lines.
+
+        typename AtomicTypes::Int d_lock;
+        char                      d_padding[BSLS_PLATFORM_CACHE_LINE_SIZE
+                                          - sizeof(typename AtomicTypes::Int)];
+    };
+
+    // CLASS DATA
+    static PaddedLock s_locks[k_NUM_LOCKS];  // table of spin locks (zero
+                                             // initialized, i.e., unlocked)
+
+    // PRIVATE CLASS METHODS
+    static typename AtomicTypes::Int *lockFor(const volatile void *address);
+        // Return the address of the spin lock guarding the double word at the
+        // specified 'address'.
+
+    static void lock(typename AtomicTypes::Int *spinLock);
+        // Acquire the specified 'spinLock', spinning until it is available.
+
+    static void unlock(typename AtomicTypes::Int *spinLock);
+        // Release the specified 'spinLock'.
+
+  public:
+    // CLASS METHODS
+    static void initDoubleWord(typename AtomicTypes::DoubleWord *atomicWord,
+                               Types::UintPtr                    first  = 0,
+                               Types::UintPtr                    second = 0);
+
+    static void getDoubleWord(
+                            typename AtomicTypes::DoubleWord const *atomicWord,
+                            Types::UintPtr                         *first,
+                            Types::UintPtr                         *second);
+
+    static void setDoubleWord(typename AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr                    first,
+                              Types::UintPtr                    second);
+
+    static bool testAndSwapDoubleWord(
+                               typename AtomicTypes::DoubleWord *atomicWord,
+                               Types::UintPtr                   *compareFirst,
+                               Types::UintPtr                   *compareSecond,
+                               Types::UintPtr                    swapFirst,
+                               Types::UintPtr                    swapSecond);
+
+    static bool isDoubleWordLockFree();
+};
+
+                    // ====================================
+                    // struct AtomicOperations_DefaultFence
+                    // ====================================
+
+template <class IMP>
+struct AtomicOperations_DefaultFence
+    // This class provides default implementations of the memory fences,
+    // independent on any specific platform, in terms of the sequentially
+    // consistent 32-bit integer atomic operations of the 'IMP' class.
+{
+  public:
+    // PUBLIC TYPES
+    typedef Atomic_TypeTraits<IMP> AtomicTypes;
+
+    // CLASS METHODS
+    static void fenceAcquire();
+
+    static void fenceRelease();
+};
+
                       // =================================
                       // struct AtomicOperations_Default32
                       // =================================
@@ -650,9 +848,12 @@ struct AtomicOperations_Default32
 : AtomicOperations_DefaultInt<IMP>
 , AtomicOperations_DefaultInt64<IMP>
 , AtomicOperations_DefaultPointer32<IMP>
+, AtomicOperations_DefaultDoubleWord<IMP>
+, AtomicOperations_DefaultFence<IMP>
     // This class provides default implementations of non-essential atomic
-    // operations for the 32-bit integer, 64-bit integer and 32-bit pointer
-    // type for a generic 32-bit platform.
+    // operations for the 32-bit integer, 64-bit integer, 32-bit pointer and
+    // double-word types, and of the memory fences, for a generic 32-bit
+    // platform.
 {
 };
 
@@ -665,9 +866,12 @@ struct AtomicOperations_Default64
 : AtomicOperations_DefaultInt<IMP>
 , AtomicOperations_DefaultInt64<IMP>
 , AtomicOperations_DefaultPointer64<IMP>
+, AtomicOperations_DefaultDoubleWord<IMP>
+, AtomicOperations_DefaultFence<IMP>
     // This class provides default implementations of non-essential atomic
-    // operations for the 32-bit integer, 64-bit integer and 64-bit pointer
-    // type for a generic 64-bit platform.
+    // operations for the 32-bit integer, 64-bit integer, 64-bit pointer and
+    // double-word types, and of the memory fences, for a generic 64-bit
+    // platform.
 {
 };
 
@@ -842,6 +1046,138 @@ void AtomicOperations_DefaultInt<IMP>::
     IMP::addIntAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected & mask;
+        const int actual = IMP::testAndSwapInt(atomicInt,
+                                               expected,
+                                               result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchAndIntAcqRel(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected & mask;
+        const int actual = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                     expected,
+                                                     result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected | mask;
+        const int actual = IMP::testAndSwapInt(atomicInt,
+                                               expected,
+                                               result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchOrIntAcqRel(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected | mask;
+        const int actual = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                     expected,
+                                                     result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected ^ mask;
+        const int actual = IMP::testAndSwapInt(atomicInt,
+                                               expected,
+                                               result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+int AtomicOperations_DefaultInt<IMP>::
+    fetchXorIntAcqRel(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    int expected = IMP::getIntRelaxed(atomicInt);
+    for (;;) {
+        const int result = expected ^ mask;
+        const int actual = IMP::testAndSwapIntAcqRel(atomicInt,
+                                                     expected,
+                                                     result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    andInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    IMP::fetchAndInt(atomicInt, mask);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    orInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    IMP::fetchOrInt(atomicInt, mask);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt<IMP>::
+    xorInt(typename AtomicTypes::Int *atomicInt, int mask)
+{
+    IMP::fetchXorInt(atomicInt, mask);
+}
+
                     // ------------------------------------
                     // struct AtomicOperations_DefaultInt64
                     // ------------------------------------
@@ -1018,6 +1354,141 @@ Types::Int64 AtomicOperations_DefaultInt64<IMP>::
     return IMP::addInt64NvAcqRel(atomicInt, -1);
 }
 
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected & mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64(atomicInt,
+                                                          expected,
+                                                          result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchAndInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected & mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64AcqRel(atomicInt,
+                                                                expected,
+                                                                result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected | mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64(atomicInt,
+                                                          expected,
+                                                          result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchOrInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                       Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected | mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64AcqRel(atomicInt,
+                                                                expected,
+                                                                result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected ^ mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64(atomicInt,
+                                                          expected,
+                                                          result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+Types::Int64 AtomicOperations_DefaultInt64<IMP>::
+    fetchXorInt64AcqRel(typename AtomicTypes::Int64 *atomicInt,
+                        Types::Int64 mask)
+{
+    Types::Int64 expected = IMP::getInt64Relaxed(atomicInt);
+    for (;;) {
+        const Types::Int64 result = expected ^ mask;
+        const Types::Int64 actual = IMP::testAndSwapInt64AcqRel(atomicInt,
+                                                                expected,
+                                                                result);
+        if (actual == expected) {
+            return expected;                                          // RETURN
+        }
+        expected = actual;
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    andInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    IMP::fetchAndInt64(atomicInt, mask);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    orInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    IMP::fetchOrInt64(atomicInt, mask);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultInt64<IMP>::
+    xorInt64(typename AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    IMP::fetchXorInt64(atomicInt, mask);
+}
+
                   // ----------------------------------------
                   // struct AtomicOperations_DefaultPointer32
                   // ----------------------------------------
@@ -1282,6 +1753,146 @@ void *AtomicOperations_DefaultPointer64<IMP>::
                 reinterpret_cast<Types::IntPtr>(swapValue)));
 }
 
+                  // -----------------------------------------
+                  // struct AtomicOperations_DefaultDoubleWord
+                  // -----------------------------------------
+
+// CLASS DATA
+template <class IMP>
+typename AtomicOperations_DefaultDoubleWord<IMP>::PaddedLock
+    AtomicOperations_DefaultDoubleWord<IMP>::s_locks[k_NUM_LOCKS];
+
+// PRIVATE CLASS METHODS
+template <class IMP>
+inline
+typename AtomicOperations_DefaultDoubleWord<IMP>::AtomicTypes::Int *
+    AtomicOperations_DefaultDoubleWord<IMP>::lockFor(
+                                                  const volatile void *address)
+{
+    // Discard the low-order bits, which are the same for every double word,
+    // before selecting a lock.
+
+    const Types::UintPtr key = reinterpret_cast<Types::UintPtr>(address);
+    return &s_locks[(key >> 4) % k_NUM_LOCKS].d_lock;
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultDoubleWord<IMP>::
+    lock(typename AtomicTypes::Int *spinLock)
+{
+    while (IMP::swapIntAcqRel(spinLock, 1)) {
+        while (IMP::getIntRelaxed(spinLock)) {
+        }
+    }
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultDoubleWord<IMP>::
+    unlock(typename AtomicTypes::Int *spinLock)
+{
+    IMP::setIntRelease(spinLock, 0);
+}
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultDoubleWord<IMP>::
+    initDoubleWord(typename AtomicTypes::DoubleWord *atomicWord,
+                   Types::UintPtr                    first,
+                   Types::UintPtr                    second)
+{
+    atomicWord->d_words[0] = first;
+    atomicWord->d_words[1] = second;
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultDoubleWord<IMP>::
+    getDoubleWord(typename AtomicTypes::DoubleWord const *atomicWord,
+                  Types::UintPtr                         *first,
+                  Types::UintPtr                         *second)
+{
+    typename AtomicTypes::Int *spinLock = lockFor(atomicWord);
+    lock(spinLock);
+    *first  = atomicWord->d_words[0];
+    *second = atomicWord->d_words[1];
+    unlock(spinLock);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultDoubleWord<IMP>::
+    setDoubleWord(typename AtomicTypes::DoubleWord *atomicWord,
+                  Types::UintPtr                    first,
+                  Types::UintPtr                    second)
+{
+    typename AtomicTypes::Int *spinLock = lockFor(atomicWord);
+    lock(spinLock);
+    atomicWord->d_words[0] = first;
+    atomicWord->d_words[1] = second;
+    unlock(spinLock);
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultDoubleWord<IMP>::
+    testAndSwapDoubleWord(typename AtomicTypes::DoubleWord *atomicWord,
+                          Types::UintPtr                   *compareFirst,
+                          Types::UintPtr                   *compareSecond,
+                          Types::UintPtr                    swapFirst,
+                          Types::UintPtr                    swapSecond)
+{
+    typename AtomicTypes::Int *spinLock = lockFor(atomicWord);
+    lock(spinLock);
+    const Types::UintPtr first  = atomicWord->d_words[0];
+    const Types::UintPtr second = atomicWord->d_words[1];
+    const bool           equal  = first  == *compareFirst
+                               && second == *compareSecond;
+    if (equal) {
+        atomicWord->d_words[0] = swapFirst;
+        atomicWord->d_words[1] = swapSecond;
+    }
+    unlock(spinLock);
+
+    if (!equal) {
+        *compareFirst  = first;
+        *compareSecond = second;
+    }
+    return equal;
+}
+
+template <class IMP>
+inline
+bool AtomicOperations_DefaultDoubleWord<IMP>::isDoubleWordLockFree()
+{
+    return false;
+}
+
+                    // ------------------------------------
+                    // struct AtomicOperations_DefaultFence
+                    // ------------------------------------
+
+// CLASS METHODS
+template <class IMP>
+inline
+void AtomicOperations_DefaultFence<IMP>::fenceAcquire()
+{
+    typename AtomicTypes::Int fence;
+    IMP::initInt(&fence, 0);
+    IMP::swapInt(&fence, 0);
+}
+
+template <class IMP>
+inline
+void AtomicOperations_DefaultFence<IMP>::fenceRelease()
+{
+    typename AtomicTypes::Int fence;
+    IMP::initInt(&fence, 0);
+    IMP::swapInt(&fence, 0);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
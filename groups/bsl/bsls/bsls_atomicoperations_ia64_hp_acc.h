@@ -75,6 +75,8 @@ struct Atomic_TypeTraits<AtomicOperations_IA64_HP_ACC>
         void const * volatile d_value
                                   __attribute__((__aligned__(sizeof(void *))));
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
 #if defined(BSLS_PLATFORM_CPU_64_BIT)
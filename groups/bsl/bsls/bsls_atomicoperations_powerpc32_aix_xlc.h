@@ -129,6 +129,8 @@ struct Atomic_TypeTraits<AtomicOperations_POWERPC32_AIX_XLC>
         void const * volatile d_value
               __attribute__((__aligned__(sizeof(void *))));
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                   // =========================================
@@ -105,6 +105,8 @@ struct Atomic_TypeTraits<AtomicOperations_POWERPC64_AIX_XLC>
         void const * volatile d_value
               __attribute__((__aligned__(sizeof(void *))));
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                   // =========================================
@@ -65,6 +65,8 @@ struct Atomic_TypeTraits<AtomicOperations_POWERPC_AIX_GCC>
         void const * volatile d_value
                                   __attribute__((__aligned__(sizeof(void *))));
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                    // =======================================
@@ -122,6 +122,8 @@ struct Atomic_TypeTraits<AtomicOperations_SPARC32_SUN_CC>
         void const * volatile d_value;
 #endif
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                    // ======================================
@@ -119,6 +119,8 @@ struct Atomic_TypeTraits<AtomicOperations_SPARC64_SUN_CC>
         void const * volatile d_value;
 #endif
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                    // ======================================
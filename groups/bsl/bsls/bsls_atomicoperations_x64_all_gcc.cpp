@@ -8,7 +8,35 @@ BSLS_IDENT("$Id$ $CSID$")
 #if defined(BSLS_PLATFORM_CPU_X86_64) && defined(BSLS_PLATFORM_CMP_GNU)
 
 namespace BloombergLP {
-}  // close namespace BloombergLP
+
+namespace bsls {
+
+                     // -----------------------------------
+                     // struct AtomicOperations_X64_ALL_GCC
+                     // -----------------------------------
+
+// CLASS DATA
+AtomicOperations_X64_ALL_GCC::AtomicTypes::Int
+                        AtomicOperations_X64_ALL_GCC::s_cmpxchg16bState;
+
+// PRIVATE CLASS METHODS
+bool AtomicOperations_X64_ALL_GCC::detectCmpxchg16b()
+{
+    // Leaf 1 of 'cpuid' reports support for 'cmpxchg16b' in bit 13 of 'ecx'.
+
+    unsigned int eax = 1, ebx, ecx, edx;
+
+    asm volatile (
+        "       cpuid                   \n\t"
+
+                : "+a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx));
+
+    return 0 != (ecx & (1u << 13));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
 
 #endif
 
@@ -69,6 +69,11 @@ struct Atomic_TypeTraits<AtomicOperations_X64_ALL_GCC>
         void const * volatile d_value
                                   __attribute__((__aligned__(sizeof(void *))));
     };
+
+    struct DoubleWord
+    {
+        volatile Types::UintPtr d_words[2] __attribute__((__aligned__(16)));
+    };
 };
 
                      // ===================================
@@ -80,6 +85,25 @@ struct AtomicOperations_X64_ALL_GCC
 {
     typedef Atomic_TypeTraits<AtomicOperations_X64_ALL_GCC> AtomicTypes;
 
+  private:
+    // PRIVATE TYPES
+    typedef AtomicOperations_DefaultDoubleWord<AtomicOperations_X64_ALL_GCC>
+                                                            LockedDoubleWord;
+        // lock-based double-word operations, used if the processor does not
+        // support 'cmpxchg16b'
+
+    // CLASS DATA
+    static AtomicTypes::Int s_cmpxchg16bState;  // 0 until determined, then 1
+                                                // if 'cmpxchg16b' is missing
+                                                // and 2 if it is supported
+
+    // PRIVATE CLASS METHODS
+    static bool detectCmpxchg16b();
+        // Return 'true' if the processor supports the 'cmpxchg16b'
+        // instruction (as reported by 'cpuid'), and 'false' otherwise.
+
+  public:
+
         // *** atomic functions for int ***
 
     static int getInt(const AtomicTypes::Int *atomicInt);
@@ -98,6 +122,12 @@ struct AtomicOperations_X64_ALL_GCC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+    static void andInt(AtomicTypes::Int *atomicInt, int mask);
+
+    static void orInt(AtomicTypes::Int *atomicInt, int mask);
+
+    static void xorInt(AtomicTypes::Int *atomicInt, int mask);
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -118,6 +148,43 @@ struct AtomicOperations_X64_ALL_GCC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+    static void andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+
+    static void orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+
+    static void xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask);
+
+        // *** atomic functions for double words ***
+
+    static void getDoubleWord(const AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr                *first,
+                              Types::UintPtr                *second);
+
+    static void setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr           first,
+                              Types::UintPtr           second);
+
+    static bool testAndSwapDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                                      Types::UintPtr          *compareFirst,
+                                      Types::UintPtr          *compareSecond,
+                                      Types::UintPtr           swapFirst,
+                                      Types::UintPtr           swapSecond);
+
+    static bool isDoubleWordLockFree();
+
+    static bool hasCmpxchg16b();
+        // Return 'true' if the processor supports the 'cmpxchg16b'
+        // instruction, and 'false' otherwise.  The processor is queried on
+        // the first call only.  Note that the double-word operations fall
+        // back to those of 'AtomicOperations_DefaultDoubleWord' if this
+        // function returns 'false'.
+
+        // *** memory fences ***
+
+    static void fenceAcquire();
+
+    static void fenceRelease();
 };
 
 // ===========================================================================
@@ -239,6 +306,42 @@ int AtomicOperations_X64_ALL_GCC::
 #endif
 }
 
+inline
+void AtomicOperations_X64_ALL_GCC::
+    andInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    asm volatile (
+        "       lock andl %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    orInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    asm volatile (
+        "       lock orl %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    xorInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    asm volatile (
+        "       lock xorl %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
 inline
 Types::Int64 AtomicOperations_X64_ALL_GCC::
     getInt64(const AtomicTypes::Int64 *atomicInt)
@@ -353,6 +456,153 @@ Types::Int64 AtomicOperations_X64_ALL_GCC::
 #endif
 }
 
+inline
+void AtomicOperations_X64_ALL_GCC::
+    andInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    asm volatile (
+        "       lock andq %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    orInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    asm volatile (
+        "       lock orq %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    xorInt64(AtomicTypes::Int64 *atomicInt, Types::Int64 mask)
+{
+    asm volatile (
+        "       lock xorq %[val], %[obj]   \n\t"
+
+                : [obj] "+m" (*atomicInt)
+                : [val] "r"  (mask)
+                : "memory", "cc");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    getDoubleWord(const AtomicTypes::DoubleWord *atomicWord,
+                  Types::UintPtr                *first,
+                  Types::UintPtr                *second)
+{
+    // 'cmpxchg16b' is the only instruction that reads 16 bytes atomically.  A
+    // comparison against (0, 0) either fails, loading the current value, or
+    // stores back the (0, 0) value already present; in either case the value
+    // is unchanged.
+
+    *first  = 0;
+    *second = 0;
+    testAndSwapDoubleWord(const_cast<AtomicTypes::DoubleWord *>(atomicWord),
+                          first,
+                          second,
+                          0,
+                          0);
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::
+    setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                  Types::UintPtr           first,
+                  Types::UintPtr           second)
+{
+    Types::UintPtr compareFirst  = atomicWord->d_words[0];
+    Types::UintPtr compareSecond = atomicWord->d_words[1];
+
+    while (!testAndSwapDoubleWord(atomicWord,
+                                  &compareFirst,
+                                  &compareSecond,
+                                  first,
+                                  second)) {
+    }
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::
+    testAndSwapDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                          Types::UintPtr          *compareFirst,
+                          Types::UintPtr          *compareSecond,
+                          Types::UintPtr           swapFirst,
+                          Types::UintPtr           swapSecond)
+{
+    // 'getDoubleWord' and 'setDoubleWord' are implemented in terms of this
+    // function, so only it needs to select the lock-based implementation.
+
+    if (!hasCmpxchg16b()) {
+        return LockedDoubleWord::testAndSwapDoubleWord(atomicWord,
+                                                       compareFirst,
+                                                       compareSecond,
+                                                       swapFirst,
+                                                       swapSecond);
+    }
+
+    bool result;
+
+    asm volatile (
+        "       lock cmpxchg16b %[obj]      \n\t"
+        "       sete %[res]                 \n\t"
+
+                : [res] "=q" (result),
+                  [obj] "+m" (*atomicWord),
+                  [lo]  "+a" (*compareFirst),
+                  [hi]  "+d" (*compareSecond)
+                : [slo] "b"  (swapFirst),
+                  [shi] "c"  (swapSecond)
+                : "memory", "cc");
+
+    return result;
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::isDoubleWordLockFree()
+{
+    return hasCmpxchg16b();
+}
+
+inline
+bool AtomicOperations_X64_ALL_GCC::hasCmpxchg16b()
+{
+    // Concurrent first calls may each query the processor, but they store the
+    // same result.
+
+    int state = getIntRelaxed(&s_cmpxchg16bState);
+    if (0 == state) {
+        state = detectCmpxchg16b() ? 2 : 1;
+        setIntRelaxed(&s_cmpxchg16bState, state);
+    }
+    return 2 == state;
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::fenceAcquire()
+{
+    // A load is not reordered with any later memory access, so only the
+    // compiler must be constrained.
+
+    asm volatile ("" ::: "memory");
+}
+
+inline
+void AtomicOperations_X64_ALL_GCC::fenceRelease()
+{
+    // A store is not reordered with any earlier memory access, so only the
+    // compiler must be constrained.
+
+    asm volatile ("" ::: "memory");
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
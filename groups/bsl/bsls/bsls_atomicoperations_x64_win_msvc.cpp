@@ -8,7 +8,31 @@ BSLS_IDENT("$Id$ $CSID$")
 #if defined(BSLS_PLATFORM_CPU_X86_64) && defined(BSLS_PLATFORM_CMP_MSVC)
 
 namespace BloombergLP {
-}  // close namespace BloombergLP
+
+namespace bsls {
+
+                     // ------------------------------------
+                     // struct AtomicOperations_X64_WIN_MSVC
+                     // ------------------------------------
+
+// CLASS DATA
+AtomicOperations_X64_WIN_MSVC::AtomicTypes::Int
+                        AtomicOperations_X64_WIN_MSVC::s_cmpxchg16bState;
+
+// PRIVATE CLASS METHODS
+bool AtomicOperations_X64_WIN_MSVC::detectCmpxchg16b()
+{
+    // Leaf 1 of 'cpuid' reports support for 'cmpxchg16b' in bit 13 of 'ecx'.
+
+    int info[4];
+    __cpuid(info, 1);
+
+    return 0 != (info[2] & (1 << 13));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
 
 #endif
 
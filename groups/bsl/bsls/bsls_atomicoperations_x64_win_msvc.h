@@ -80,6 +80,12 @@ struct Atomic_TypeTraits<AtomicOperations_X64_WIN_MSVC>
         __declspec(align(8))
         void const * volatile d_value;
     };
+
+    struct DoubleWord
+    {
+        __declspec(align(16))
+        volatile Types::UintPtr d_words[2];
+    };
 };
 
                     // ====================================
@@ -91,6 +97,25 @@ struct AtomicOperations_X64_WIN_MSVC
 {
     typedef Atomic_TypeTraits<AtomicOperations_X64_WIN_MSVC> AtomicTypes;
 
+  private:
+    // PRIVATE TYPES
+    typedef AtomicOperations_DefaultDoubleWord<AtomicOperations_X64_WIN_MSVC>
+                                                            LockedDoubleWord;
+        // lock-based double-word operations, used if the processor does not
+        // support 'cmpxchg16b'
+
+    // CLASS DATA
+    static AtomicTypes::Int s_cmpxchg16bState;  // 0 until determined, then 1
+                                                // if 'cmpxchg16b' is missing
+                                                // and 2 if it is supported
+
+    // PRIVATE CLASS METHODS
+    static bool detectCmpxchg16b();
+        // Return 'true' if the processor supports the 'cmpxchg16b'
+        // instruction (as reported by 'cpuid'), and 'false' otherwise.
+
+  public:
+
         // *** atomic functions for int ***
 
     static int getInt(const AtomicTypes::Int *atomicInt);
@@ -109,6 +134,12 @@ struct AtomicOperations_X64_WIN_MSVC
 
     static int addIntNv(AtomicTypes::Int *atomicInt, int value);
 
+    static int fetchAndInt(AtomicTypes::Int *atomicInt, int mask);
+
+    static int fetchOrInt(AtomicTypes::Int *atomicInt, int mask);
+
+    static int fetchXorInt(AtomicTypes::Int *atomicInt, int mask);
+
         // *** atomic functions for Int64 ***
 
     static Types::Int64 getInt64(const AtomicTypes::Int64 *atomicInt);
@@ -129,6 +160,46 @@ struct AtomicOperations_X64_WIN_MSVC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+    static Types::Int64 fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 mask);
+
+    static Types::Int64 fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                                     Types::Int64 mask);
+
+    static Types::Int64 fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                                      Types::Int64 mask);
+
+        // *** atomic functions for double words ***
+
+    static void getDoubleWord(const AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr                *first,
+                              Types::UintPtr                *second);
+
+    static void setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                              Types::UintPtr           first,
+                              Types::UintPtr           second);
+
+    static bool testAndSwapDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                                      Types::UintPtr          *compareFirst,
+                                      Types::UintPtr          *compareSecond,
+                                      Types::UintPtr           swapFirst,
+                                      Types::UintPtr           swapSecond);
+
+    static bool isDoubleWordLockFree();
+
+    static bool hasCmpxchg16b();
+        // Return 'true' if the processor supports the 'cmpxchg16b'
+        // instruction, and 'false' otherwise.  The processor is queried on
+        // the first call only.  Note that the double-word operations fall
+        // back to those of 'AtomicOperations_DefaultDoubleWord' if this
+        // function returns 'false'.
+
+        // *** memory fences ***
+
+    static void fenceAcquire();
+
+    static void fenceRelease();
 };
 
 // ===========================================================================
@@ -204,6 +275,33 @@ int AtomicOperations_X64_WIN_MSVC::
         + value;
 }
 
+inline
+int AtomicOperations_X64_WIN_MSVC::
+    fetchAndInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return _InterlockedAnd(
+            reinterpret_cast<long volatile *>(&atomicInt->d_value),
+            mask);
+}
+
+inline
+int AtomicOperations_X64_WIN_MSVC::
+    fetchOrInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return _InterlockedOr(
+            reinterpret_cast<long volatile *>(&atomicInt->d_value),
+            mask);
+}
+
+inline
+int AtomicOperations_X64_WIN_MSVC::
+    fetchXorInt(AtomicTypes::Int *atomicInt, int mask)
+{
+    return _InterlockedXor(
+            reinterpret_cast<long volatile *>(&atomicInt->d_value),
+            mask);
+}
+
 inline
 Types::Int64 AtomicOperations_X64_WIN_MSVC::
     getInt64(const AtomicTypes::Int64 *atomicInt)
@@ -266,6 +364,143 @@ Types::Int64 AtomicOperations_X64_WIN_MSVC::
         + value;
 }
 
+inline
+Types::Int64 AtomicOperations_X64_WIN_MSVC::
+    fetchAndInt64(AtomicTypes::Int64 *atomicInt,
+                  Types::Int64 mask)
+{
+    return _InterlockedAnd64(&atomicInt->d_value, mask);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_WIN_MSVC::
+    fetchOrInt64(AtomicTypes::Int64 *atomicInt,
+                 Types::Int64 mask)
+{
+    return _InterlockedOr64(&atomicInt->d_value, mask);
+}
+
+inline
+Types::Int64 AtomicOperations_X64_WIN_MSVC::
+    fetchXorInt64(AtomicTypes::Int64 *atomicInt,
+                  Types::Int64 mask)
+{
+    return _InterlockedXor64(&atomicInt->d_value, mask);
+}
+
+inline
+void AtomicOperations_X64_WIN_MSVC::
+    getDoubleWord(const AtomicTypes::DoubleWord *atomicWord,
+                  Types::UintPtr                *first,
+                  Types::UintPtr                *second)
+{
+    // '_InterlockedCompareExchange128' is the only operation that reads 16
+    // bytes atomically.  A comparison against (0, 0) either fails, loading the
+    // current value, or stores back the (0, 0) value already present; in
+    // either case the value is unchanged.
+
+    *first  = 0;
+    *second = 0;
+    testAndSwapDoubleWord(const_cast<AtomicTypes::DoubleWord *>(atomicWord),
+                          first,
+                          second,
+                          0,
+                          0);
+}
+
+inline
+void AtomicOperations_X64_WIN_MSVC::
+    setDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                  Types::UintPtr           first,
+                  Types::UintPtr           second)
+{
+    Types::UintPtr compareFirst  = atomicWord->d_words[0];
+    Types::UintPtr compareSecond = atomicWord->d_words[1];
+
+    while (!testAndSwapDoubleWord(atomicWord,
+                                  &compareFirst,
+                                  &compareSecond,
+                                  first,
+                                  second)) {
+    }
+}
+
+inline
+bool AtomicOperations_X64_WIN_MSVC::
+    testAndSwapDoubleWord(AtomicTypes::DoubleWord *atomicWord,
+                          Types::UintPtr          *compareFirst,
+                          Types::UintPtr          *compareSecond,
+                          Types::UintPtr           swapFirst,
+                          Types::UintPtr           swapSecond)
+{
+    // 'getDoubleWord' and 'setDoubleWord' are implemented in terms of this
+    // function, so only it needs to select the lock-based implementation.
+
+    if (!hasCmpxchg16b()) {
+        return LockedDoubleWord::testAndSwapDoubleWord(atomicWord,
+                                                       compareFirst,
+                                                       compareSecond,
+                                                       swapFirst,
+                                                       swapSecond);
+    }
+
+    // The intrinsic takes the comparand as an array of two words (low word
+    // first), which it overwrites with the original value of the destination.
+
+    __declspec(align(16)) Types::Int64 comparand[2];
+    comparand[0] = static_cast<Types::Int64>(*compareFirst);
+    comparand[1] = static_cast<Types::Int64>(*compareSecond);
+
+    const bool result = 0 != _InterlockedCompareExchange128(
+                     reinterpret_cast<Types::Int64 volatile *>(
+                                                       atomicWord->d_words),
+                     static_cast<Types::Int64>(swapSecond),
+                     static_cast<Types::Int64>(swapFirst),
+                     comparand);
+
+    *compareFirst  = static_cast<Types::UintPtr>(comparand[0]);
+    *compareSecond = static_cast<Types::UintPtr>(comparand[1]);
+    return result;
+}
+
+inline
+bool AtomicOperations_X64_WIN_MSVC::isDoubleWordLockFree()
+{
+    return hasCmpxchg16b();
+}
+
+inline
+bool AtomicOperations_X64_WIN_MSVC::hasCmpxchg16b()
+{
+    // Concurrent first calls may each query the processor, but they store the
+    // same result.
+
+    int state = getIntRelaxed(&s_cmpxchg16bState);
+    if (0 == state) {
+        state = detectCmpxchg16b() ? 2 : 1;
+        setIntRelaxed(&s_cmpxchg16bState, state);
+    }
+    return 2 == state;
+}
+
+inline
+void AtomicOperations_X64_WIN_MSVC::fenceAcquire()
+{
+    // A load is not reordered with any later memory access, so only the
+    // compiler must be constrained.
+
+    _ReadWriteBarrier();
+}
+
+inline
+void AtomicOperations_X64_WIN_MSVC::fenceRelease()
+{
+    // A store is not reordered with any earlier memory access, so only the
+    // compiler must be constrained.
+
+    _ReadWriteBarrier();
+}
+
 #undef BSLS_ATOMIC_FENCE
 
 }  // close package namespace
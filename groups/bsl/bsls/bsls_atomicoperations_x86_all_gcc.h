@@ -61,6 +61,8 @@ struct Atomic_TypeTraits<AtomicOperations_X86_ALL_GCC>
         void const * volatile d_value
                                   __attribute__((__aligned__(sizeof(void *))));
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                      // ===================================
@@ -105,6 +107,12 @@ struct AtomicOperations_X86_ALL_GCC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+        // *** memory fences ***
+
+    static void fenceAcquire();
+
+    static void fenceRelease();
 };
 
 // ===========================================================================
@@ -399,6 +407,24 @@ Types::Int64 AtomicOperations_X86_ALL_GCC::
 #endif
 }
 
+inline
+void AtomicOperations_X86_ALL_GCC::fenceAcquire()
+{
+    // A load is not reordered with any later memory access, so only the
+    // compiler must be constrained.
+
+    asm volatile ("" ::: "memory");
+}
+
+inline
+void AtomicOperations_X86_ALL_GCC::fenceRelease()
+{
+    // A store is not reordered with any earlier memory access, so only the
+    // compiler must be constrained.
+
+    asm volatile ("" ::: "memory");
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -79,6 +79,8 @@ struct Atomic_TypeTraits<AtomicOperations_X86_WIN_MSVC>
         __declspec(align(4))
         void const * volatile d_value;
     };
+
+    typedef Atomic_DoubleWord DoubleWord;
 };
 
                     // ====================================
@@ -123,6 +125,12 @@ struct AtomicOperations_X86_WIN_MSVC
 
     static Types::Int64 addInt64Nv(AtomicTypes::Int64 *atomicInt,
                                    Types::Int64 value);
+
+        // *** memory fences ***
+
+    static void fenceAcquire();
+
+    static void fenceRelease();
 };
 
 // ===========================================================================
@@ -263,6 +271,24 @@ Types::Int64 AtomicOperations_X86_WIN_MSVC::
     return expected + value;
 }
 
+inline
+void AtomicOperations_X86_WIN_MSVC::fenceAcquire()
+{
+    // A load is not reordered with any later memory access, so only the
+    // compiler must be constrained.
+
+    _ReadWriteBarrier();
+}
+
+inline
+void AtomicOperations_X86_WIN_MSVC::fenceRelease()
+{
+    // A store is not reordered with any earlier memory access, so only the
+    // compiler must be constrained.
+
+    _ReadWriteBarrier();
+}
+
 #undef BSLS_ATOMIC_FENCE
 
 }  // close package namespace
@@ -0,0 +1,70 @@
+// bsls_cachelinepadded.cpp                                           -*-C++-*-
+#include <bsls_cachelinepadded.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #include <sched.h>      // sched_getcpu()
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    #include <windows.h>    // GetCurrentProcessorNumber()
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                          // -------------------------
+                          // struct PerCoreArray_Util
+                          // -------------------------
+
+// CLASS METHODS
+unsigned int PerCoreArray_Util::currentCpu()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    const int cpu = sched_getcpu();
+    if (0 <= cpu) {
+        return cpu;                                                   // RETURN
+    }
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    return ::GetCurrentProcessorNumber();
+#endif
+
+    // Identify the thread by the address of its stack.  The stacks of
+    // distinct threads are separated by at least 64 kilobytes on every
+    // supported platform, so the low-order bits are discarded, and the rest
+    // are mixed so that consecutive stacks select well-separated values.
+
+    char                local;
+    const Types::Uint64 stack = reinterpret_cast<Types::UintPtr>(&local) >> 16;
+    return static_cast<unsigned int>((stack * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
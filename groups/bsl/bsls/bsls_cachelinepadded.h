@@ -0,0 +1,420 @@
+// bsls_cachelinepadded.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLS_CACHELINEPADDED
+#define INCLUDED_BSLS_CACHELINEPADDED
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide wrappers that give objects cache lines of their own.
+//
+//@CLASSES:
+//  bsls::CacheLinePadded: object aligned on, and padded to, cache lines
+//  bsls::PerCoreArray: array of cache-line padded objects indexed by processor
+//
+//@SEE_ALSO: bsls_alignmentutil, bsls_alignedbuffer, bsls_platform
+//
+//@DESCRIPTION: This component provides two class templates for storing
+// objects that are written frequently by different threads, so that no two
+// such objects share a cache line.  When objects written by different threads
+// share a cache line, each write invalidates the copies of that line cached by
+// the other processors, and the line "ping-pongs" between them ("false
+// sharing"), which can make independent updates many times slower than they
+// would otherwise be.
+//
+// 'bsls::CacheLinePadded<TYPE>' holds a single 'TYPE' object, aligned on a
+// cache-line boundary and padded to a whole number of cache lines (as given by
+// 'bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE').  The object is constructed and
+// destroyed along with its wrapper, and is accessed using 'object' or
+// 'operator->'.  Elements of an array of 'bsls::CacheLinePadded' objects
+// therefore never share a cache line.  Note that on compilers that provide no
+// means of specifying extended alignment (see
+// 'bsls::AlignmentUtil::CacheLineAlignedType'), the object is padded, but
+// aligned only as required by 'TYPE'; neighboring objects may then share a
+// line with the padding, but not with each other.
+//
+// 'bsls::PerCoreArray<TYPE, SIZE>' is a fixed-size array of 'SIZE' such
+// padded objects, whose 'local' method returns the element associated with
+// the processor on which the calling thread is running (modulo 'SIZE').  This
+// is useful for data that is updated on every processor but read rarely,
+// such as statistics counters: updates from different processors are then
+// usually applied to different cache lines, and a reader combines the
+// elements.  The processor is identified using 'sched_getcpu' on Linux and
+// 'GetCurrentProcessorNumber' on Windows; elsewhere, a hash of the address of
+// the calling thread's stack is used, which distinguishes threads (rather
+// than processors).  Note that a thread may migrate between processors at
+// any time, so that 'local' is a *hint* only: elements must still be updated
+// atomically (or under a lock) if they may be accessed by more than one
+// thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Events on Many Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we count the requests processed by a service, on every thread
+// that processes requests, and report the total only occasionally.  A single
+// atomic counter would be written by every thread, so we keep one counter per
+// processor, each on its own cache line.
+//
+// First, we define the statistics class:
+//..
+//  class RequestStatistics {
+//      // This class provides a thread-safe count of processed requests.
+//
+//      // DATA
+//      bsls::PerCoreArray<bsls::AtomicInt64, 16> d_counts;
+//
+//    public:
+//      // MANIPULATORS
+//      void recordRequest()
+//          // Record the processing of one request.
+//      {
+//          d_counts.local().addRelaxed(1);
+//      }
+//
+//      // ACCESSORS
+//      bsls::Types::Int64 numRequests() const
+//          // Return the number of requests recorded.
+//      {
+//          bsls::Types::Int64 total = 0;
+//          for (int i = 0; i < d_counts.size(); ++i) {
+//              total += d_counts[i].loadRelaxed();
+//          }
+//          return total;
+//      }
+//  };
+//..
+// Then, we verify that the counters are on distinct cache lines:
+//..
+//  RequestStatistics statistics;
+//
+//  bsls::PerCoreArray<bsls::AtomicInt64, 16> counts;
+//  assert(bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE <=
+//                          reinterpret_cast<char *>(&counts[1])
+//                                    - reinterpret_cast<char *>(&counts[0]));
+//..
+// Finally, we record some requests, and read the total:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      statistics.recordRequest();
+//  }
+//  assert(100 == statistics.numRequests());
+//..
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>                  // placement 'new'
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // =====================
+                           // class CacheLinePadded
+                           // =====================
+
+template <class TYPE>
+class CacheLinePadded {
+    // This class template holds an object of the parameterized 'TYPE',
+    // aligned on a cache-line boundary and padded to a whole number of cache
+    // lines, so that it shares no cache line with any other object.  The held
+    // object is created and destroyed along with this wrapper.
+
+    // PRIVATE TYPES
+    enum {
+        k_LINE        = AlignmentUtil::BSLS_CACHE_LINE_SIZE,
+
+        k_PADDED_SIZE = (sizeof(TYPE) + k_LINE - 1) / k_LINE * k_LINE
+                                          // size of the object, rounded up to
+                                          // a whole number of cache lines
+    };
+
+    union Storage {
+        // This 'union' provides cache-line aligned and padded storage for a
+        // 'TYPE' object.
+
+        AlignedBuffer<k_PADDED_SIZE, AlignmentFromType<TYPE>::VALUE>
+                                            d_buffer;
+        AlignmentUtil::CacheLineAlignedType d_align;
+    };
+
+    // DATA
+    Storage d_storage;  // footprint of the held object
+
+  public:
+    // CREATORS
+    CacheLinePadded();
+        // Create a wrapper holding a value-initialized 'TYPE' object.
+
+    template <class ARG>
+    explicit CacheLinePadded(const ARG& argument);
+        // Create a wrapper holding a 'TYPE' object constructed from the
+        // specified 'argument'.
+
+    CacheLinePadded(const CacheLinePadded& original);
+        // Create a wrapper holding a copy of the object held by the specified
+        // 'original' wrapper.
+
+    ~CacheLinePadded();
+        // Destroy this wrapper and the object it holds.
+
+    // MANIPULATORS
+    CacheLinePadded& operator=(const CacheLinePadded& rhs);
+        // Assign to the object held by this wrapper the value of the object
+        // held by the specified 'rhs' wrapper, and return a reference
+        // providing modifiable access to this wrapper.
+
+    TYPE& object();
+        // Return a reference providing modifiable access to the held object.
+
+    TYPE *operator->();
+        // Return the address providing modifiable access to the held object.
+
+    // ACCESSORS
+    const TYPE& object() const;
+        // Return a reference providing non-modifiable access to the held
+        // object.
+
+    const TYPE *operator->() const;
+        // Return the address providing non-modifiable access to the held
+        // object.
+};
+
+                          // =========================
+                          // struct PerCoreArray_Util
+                          // =========================
+
+struct PerCoreArray_Util {
+    // This 'struct' provides a namespace for the processor identification
+    // used by 'PerCoreArray', and is for use only by this component.
+
+    // CLASS METHODS
+    static unsigned int currentCpu();
+        // Return a number identifying the processor on which the calling
+        // thread is (or was very recently) running, or, on platforms where
+        // that is not available, a number identifying the calling thread.
+};
+
+                             // ==================
+                             // class PerCoreArray
+                             // ==================
+
+template <class TYPE, int SIZE>
+class PerCoreArray {
+    // This class template provides a fixed-size array of 'SIZE' objects of
+    // the parameterized 'TYPE', each on cache lines of its own, and a means
+    // of selecting the element associated with the calling thread's current
+    // processor.
+
+    // DATA
+    CacheLinePadded<TYPE> d_elements[SIZE];  // padded elements
+
+  private:
+    // NOT IMPLEMENTED
+    PerCoreArray(const PerCoreArray&);
+    PerCoreArray& operator=(const PerCoreArray&);
+
+  public:
+    // CREATORS
+    PerCoreArray();
+        // Create an array of 'SIZE' value-initialized 'TYPE' objects.
+
+    // ~PerCoreArray() = default;
+        // Destroy this array and its elements.
+
+    // MANIPULATORS
+    TYPE& operator[](int index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < SIZE'.
+
+    TYPE& local();
+        // Return a reference providing modifiable access to the element
+        // associated with the processor on which the calling thread is
+        // running.  Note that the calling thread may migrate to another
+        // processor at any time, so that the returned element may also be
+        // accessed concurrently by other threads.
+
+    // ACCESSORS
+    const TYPE& operator[](int index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < SIZE'.
+
+    int size() const;
+        // Return the number of elements in this array, 'SIZE'.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class CacheLinePadded
+                           // ---------------------
+
+// CREATORS
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded()
+{
+    new (d_storage.d_buffer.buffer()) TYPE();
+}
+
+template <class TYPE>
+template <class ARG>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded(const ARG& argument)
+{
+    new (d_storage.d_buffer.buffer()) TYPE(argument);
+}
+
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>::CacheLinePadded(const CacheLinePadded& original)
+{
+    new (d_storage.d_buffer.buffer()) TYPE(original.object());
+}
+
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>::~CacheLinePadded()
+{
+    object().~TYPE();
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+CacheLinePadded<TYPE>&
+CacheLinePadded<TYPE>::operator=(const CacheLinePadded& rhs)
+{
+    object() = rhs.object();
+    return *this;
+}
+
+template <class TYPE>
+inline
+TYPE& CacheLinePadded<TYPE>::object()
+{
+    return *reinterpret_cast<TYPE *>(d_storage.d_buffer.buffer());
+}
+
+template <class TYPE>
+inline
+TYPE *CacheLinePadded<TYPE>::operator->()
+{
+    return &object();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& CacheLinePadded<TYPE>::object() const
+{
+    return *reinterpret_cast<const TYPE *>(d_storage.d_buffer.buffer());
+}
+
+template <class TYPE>
+inline
+const TYPE *CacheLinePadded<TYPE>::operator->() const
+{
+    return &object();
+}
+
+                             // ------------------
+                             // class PerCoreArray
+                             // ------------------
+
+// CREATORS
+template <class TYPE, int SIZE>
+inline
+PerCoreArray<TYPE, SIZE>::PerCoreArray()
+{
+}
+
+// MANIPULATORS
+template <class TYPE, int SIZE>
+inline
+TYPE& PerCoreArray<TYPE, SIZE>::operator[](int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < SIZE);
+
+    return d_elements[index].object();
+}
+
+template <class TYPE, int SIZE>
+inline
+TYPE& PerCoreArray<TYPE, SIZE>::local()
+{
+    return d_elements[PerCoreArray_Util::currentCpu()
+                                         % static_cast<unsigned int>(SIZE)]
+                                                                    .object();
+}
+
+// ACCESSORS
+template <class TYPE, int SIZE>
+inline
+const TYPE& PerCoreArray<TYPE, SIZE>::operator[](int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < SIZE);
+
+    return d_elements[index].object();
+}
+
+template <class TYPE, int SIZE>
+inline
+int PerCoreArray<TYPE, SIZE>::size() const
+{
+    return SIZE;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
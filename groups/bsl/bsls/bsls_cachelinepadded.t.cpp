@@ -0,0 +1,651 @@
+// bsls_cachelinepadded.t.cpp                                         -*-C++-*-
+
+#include <bsls_cachelinepadded.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+#include <string.h>     // memset()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides two class templates whose essential
+// properties are the layout of the objects they hold: every held object must
+// begin on a cache-line boundary, and no two may share a cache line.  These
+// properties are verified for held types of various sizes and alignments.
+// The lifetime of the held objects is verified using a type that counts its
+// constructions and destructions.  A performance test (negative case) measures
+// the cost of false sharing by comparing concurrent increments of adjacent and
+// padded counters.
+//-----------------------------------------------------------------------------
+// bsls::CacheLinePadded
+// [ 1] CacheLinePadded();
+// [ 1] explicit CacheLinePadded(const ARG& argument);
+// [ 1] CacheLinePadded(const CacheLinePadded& original);
+// [ 1] ~CacheLinePadded();
+// [ 1] CacheLinePadded& operator=(const CacheLinePadded& rhs);
+// [ 1] TYPE& object();
+// [ 1] TYPE *operator->();
+// [ 1] const TYPE& object() const;
+// [ 1] const TYPE *operator->() const;
+//
+// bsls::PerCoreArray
+// [ 2] PerCoreArray();
+// [ 2] ~PerCoreArray();
+// [ 2] TYPE& operator[](int index);
+// [ 2] TYPE& local();
+// [ 2] const TYPE& operator[](int index) const;
+// [ 2] int size() const;
+//-----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE: FALSE SHARING
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::UintPtr UintPtr;
+
+const int LINE = bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE;
+
+#if defined(BSLS_PLATFORM_CMP_GNU)                                            \
+ || defined(BSLS_PLATFORM_CMP_CLANG)                                          \
+ || defined(BSLS_PLATFORM_CMP_IBM)                                            \
+ || defined(BSLS_PLATFORM_CMP_MSVC)
+const bool ALIGNED = true;   // compiler supports cache-line alignment
+#else
+const bool ALIGNED = false;
+#endif
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static UintPtr lineOf(const void *address)
+    // Return the index of the cache line containing the specified 'address'.
+{
+    return reinterpret_cast<UintPtr>(address) / LINE;
+}
+
+                            // ================
+                            // struct Counted
+                            // ================
+
+struct Counted {
+    // This 'struct' counts its live instances, and holds a value.
+
+    // CLASS DATA
+    static int s_numLive;
+
+    // DATA
+    int d_value;
+
+    // CREATORS
+    Counted() : d_value(-1) { ++s_numLive; }
+    explicit Counted(int value) : d_value(value) { ++s_numLive; }
+    Counted(const Counted& original) : d_value(original.d_value)
+    {
+        ++s_numLive;
+    }
+    ~Counted() { --s_numLive; }
+};
+
+int Counted::s_numLive = 0;
+
+struct Large {
+    // This 'struct' occupies more than two cache lines.
+
+    char d_bytes[2 * BSLS_PLATFORM_CACHE_LINE_SIZE + 3];
+};
+
+struct Exact {
+    // This 'struct' occupies exactly one cache line.
+
+    char d_bytes[BSLS_PLATFORM_CACHE_LINE_SIZE];
+};
+
+template <class TYPE>
+void testLayout(int line)
+    // Verify, reporting failures against the specified 'line', the layout of
+    // an array of 'bsls::CacheLinePadded<TYPE>' objects.
+{
+    typedef bsls::CacheLinePadded<TYPE> Obj;
+
+    const int EXP_SIZE = (sizeof(TYPE) + LINE - 1) / LINE * LINE;
+
+    LOOP2_ASSERT(line, sizeof(Obj), EXP_SIZE == (int) sizeof(Obj));
+
+    Obj mX[3];
+    for (int i = 0; i < 3; ++i) {
+        LOOP2_ASSERT(line, i, (void *) &mX[i].object() == (void *) &mX[i]);
+        if (ALIGNED) {
+            LOOP2_ASSERT(line, i,
+                         bsls::AlignmentUtil::isCacheLineAligned(&mX[i]));
+        }
+    }
+    for (int i = 1; i < 3; ++i) {
+        const char *lastByte = reinterpret_cast<const char *>(&mX[i - 1])
+                             + sizeof(TYPE) - 1;
+        LOOP2_ASSERT(line, i, lineOf(lastByte) < lineOf(&mX[i]));
+    }
+}
+
+                            // =================
+                            // struct WorkerArgs
+                            // =================
+
+struct WorkerArgs {
+    // This 'struct' describes the work of a worker thread: increment the
+    // counter at 'd_counter_p' 'd_numIterations' times.
+
+    bsls::AtomicInt *d_counter_p;      // counter to increment
+    int              d_numIterations;  // number of increments
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    WorkerArgs *args = static_cast<WorkerArgs *>(arg);
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        args->d_counter_p->addRelaxed(1);
+    }
+    return 0;
+}
+
+static Int64 runWorkers(bsls::AtomicInt **counters,
+                        int               numThreads,
+                        int               numIterations)
+    // Run the specified 'numThreads' worker threads, the thread 'i'
+    // incrementing the specified 'counters[i]' the specified 'numIterations'
+    // times, and return the elapsed time in nanoseconds.
+{
+    my_thread_t handles[64];
+    WorkerArgs  args[64];
+
+    ASSERT(numThreads <= 64);
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_counter_p     = counters[i];
+        args[i].d_numIterations = numIterations;
+        ASSERT(0 == myCreateThread(&handles[i], &workerThread, &args[i]));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        myJoinThread(handles[i]);
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Events on Many Threads
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we count the requests processed by a service, on every thread
+// that processes requests, and report the total only occasionally.  A single
+// atomic counter would be written by every thread, so we keep one counter per
+// processor, each on its own cache line.
+//
+// First, we define the statistics class:
+//..
+    class RequestStatistics {
+        // This class provides a thread-safe count of processed requests.
+
+        // DATA
+        bsls::PerCoreArray<bsls::AtomicInt64, 16> d_counts;
+
+      public:
+        // MANIPULATORS
+        void recordRequest()
+            // Record the processing of one request.
+        {
+            d_counts.local().addRelaxed(1);
+        }
+
+        // ACCESSORS
+        bsls::Types::Int64 numRequests() const
+            // Return the number of requests recorded.
+        {
+            bsls::Types::Int64 total = 0;
+            for (int i = 0; i < d_counts.size(); ++i) {
+                total += d_counts[i].loadRelaxed();
+            }
+            return total;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we verify that the counters are on distinct cache lines:
+//..
+    RequestStatistics statistics;
+
+    bsls::PerCoreArray<bsls::AtomicInt64, 16> counts;
+    ASSERT(bsls::AlignmentUtil::BSLS_CACHE_LINE_SIZE <=
+                            reinterpret_cast<char *>(&counts[1])
+                                      - reinterpret_cast<char *>(&counts[0]));
+//..
+// Finally, we record some requests, and read the total:
+//..
+    for (int i = 0; i < 100; ++i) {
+        statistics.recordRequest();
+    }
+    ASSERT(100 == statistics.numRequests());
+//..
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'PerCoreArray'
+        //
+        // Concerns:
+        //: 1 The array holds 'SIZE' value-initialized elements, each on cache
+        //:   lines of its own, which are destroyed with the array.
+        //:
+        //: 2 'operator[]' (modifiable and non-modifiable) returns the element
+        //:   at the given index, and 'size' returns 'SIZE'.
+        //:
+        //: 3 'local' returns one of the elements of the array, and, for a
+        //:   thread that does not migrate, always the same one.
+        //:
+        //: 4 'local' may be called concurrently from several threads.
+        //
+        // Plan:
+        //: 1 Create arrays of 'Counted' and 'int' elements, and verify the
+        //:   number of live elements, their values, and their addresses.
+        //:   (C-1..2)
+        //:
+        //: 2 Call 'local' repeatedly, verifying that the returned element
+        //:   belongs to the array, and report the number of distinct elements
+        //:   returned.  (C-3)
+        //:
+        //: 3 Have several threads increment atomic counters obtained from
+        //:   'local', and verify the total.  (C-4)
+        //
+        // Testing:
+        //   PerCoreArray();
+        //   ~PerCoreArray();
+        //   TYPE& operator[](int index);
+        //   TYPE& local();
+        //   const TYPE& operator[](int index) const;
+        //   int size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'PerCoreArray'"
+                            "\n==============\n");
+
+        {
+            ASSERT(0 == Counted::s_numLive);
+            {
+                bsls::PerCoreArray<Counted, 5> mX;
+                const bsls::PerCoreArray<Counted, 5>& X = mX;
+
+                ASSERT(5 == Counted::s_numLive);
+                ASSERT(5 == X.size());
+
+                for (int i = 0; i < X.size(); ++i) {
+                    LOOP_ASSERT(i, -1 == X[i].d_value);
+                    mX[i].d_value = i;
+                }
+                for (int i = 0; i < X.size(); ++i) {
+                    LOOP_ASSERT(i, i == X[i].d_value);
+                    if (ALIGNED) {
+                        LOOP_ASSERT(i,
+                             bsls::AlignmentUtil::isCacheLineAligned(&X[i]));
+                    }
+                    if (i) {
+                        LOOP_ASSERT(i, lineOf(&X[i - 1]) < lineOf(&X[i]));
+                    }
+                }
+            }
+            ASSERT(0 == Counted::s_numLive);
+
+            bsls::PerCoreArray<int, 3> mY;
+            for (int i = 0; i < 3; ++i) {
+                LOOP_ASSERT(i, 0 == mY[i]);
+            }
+        }
+
+        {
+            bsls::PerCoreArray<int, 8> mX;
+
+            for (int i = 0; i < 1000; ++i) {
+                int *p = &mX.local();
+                bool found = false;
+                for (int j = 0; j < mX.size(); ++j) {
+                    found = found || p == &mX[j];
+                }
+                LOOP_ASSERT(i, found);
+                ++*p;
+            }
+
+            int numUsed = 0;
+            int total   = 0;
+            for (int j = 0; j < mX.size(); ++j) {
+                numUsed += 0 != mX[j];
+                total   += mX[j];
+            }
+            if (veryVerbose) {
+                T_ P_(numUsed) P(bsls::PerCoreArray_Util::currentCpu())
+            }
+            ASSERT(1000 == total);
+            ASSERT(1 <= numUsed);
+        }
+
+        {
+            const int NUM_THREADS    = 4;
+            const int NUM_ITERATIONS = 10000;
+
+            bsls::PerCoreArray<bsls::AtomicInt, 4> mX;
+
+            bsls::AtomicInt *counters[NUM_THREADS];
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                counters[i] = &mX.local();
+            }
+            runWorkers(counters, NUM_THREADS, NUM_ITERATIONS);
+
+            int total = 0;
+            for (int j = 0; j < mX.size(); ++j) {
+                total += mX[j];
+            }
+            ASSERT(NUM_THREADS * NUM_ITERATIONS == total);
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'CacheLinePadded'
+        //
+        // Concerns:
+        //: 1 The size of a 'CacheLinePadded<TYPE>' is that of 'TYPE' rounded
+        //:   up to a whole number of cache lines, and the held object is at
+        //:   the start of the wrapper.
+        //:
+        //: 2 Elements of an array of wrappers are cache-line aligned (where
+        //:   the compiler supports it), and do not share cache lines.
+        //:
+        //: 3 The default constructor value-initializes the held object, the
+        //:   value constructor forwards its argument, the copy constructor
+        //:   and assignment operator copy the held object, and the destructor
+        //:   destroys it.
+        //:
+        //: 4 'object' and 'operator->' provide access to the held object,
+        //:   modifiable or not according to the wrapper.
+        //
+        // Plan:
+        //: 1 For held types smaller than, equal to, and larger than a cache
+        //:   line, verify the size of the wrapper and the layout of an
+        //:   array of wrappers.  (C-1..2)
+        //:
+        //: 2 Using a type that counts its live instances, verify the number
+        //:   of live instances and their values after each operation.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   CacheLinePadded();
+        //   explicit CacheLinePadded(const ARG& argument);
+        //   CacheLinePadded(const CacheLinePadded& original);
+        //   ~CacheLinePadded();
+        //   CacheLinePadded& operator=(const CacheLinePadded& rhs);
+        //   TYPE& object();
+        //   TYPE *operator->();
+        //   const TYPE& object() const;
+        //   const TYPE *operator->() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'CacheLinePadded'"
+                            "\n=================\n");
+
+        if (veryVerbose) printf("\tLayout.\n");
+
+        testLayout<char>(L_);
+        testLayout<int>(L_);
+        testLayout<double>(L_);
+        testLayout<bsls::AtomicInt64>(L_);
+        testLayout<Exact>(L_);
+        testLayout<Large>(L_);
+
+        if (veryVerbose) printf("\tLifetime and access.\n");
+
+        ASSERT(0 == Counted::s_numLive);
+        {
+            typedef bsls::CacheLinePadded<Counted> Obj;
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(1  == Counted::s_numLive);
+            ASSERT(-1 == X.object().d_value);
+            ASSERT(-1 == X->d_value);
+
+            Obj mY(7);  const Obj& Y = mY;
+            ASSERT(2 == Counted::s_numLive);
+            ASSERT(7 == Y.object().d_value);
+
+            mX.object().d_value = 3;
+            ASSERT(3 == X->d_value);
+            mX->d_value = 4;
+            ASSERT(4 == X.object().d_value);
+
+            {
+                Obj mZ(Y);  const Obj& Z = mZ;
+                ASSERT(3 == Counted::s_numLive);
+                ASSERT(7 == Z->d_value);
+
+                mZ = X;
+                ASSERT(3 == Counted::s_numLive);
+                ASSERT(4 == Z->d_value);
+            }
+            ASSERT(2 == Counted::s_numLive);
+
+            bsls::CacheLinePadded<int> mI;
+            ASSERT(0 == mI.object());
+
+            bsls::CacheLinePadded<bsls::AtomicInt> mA(5);
+            ASSERT(5 == mA->load());
+        }
+        ASSERT(0 == Counted::s_numLive);
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FALSE SHARING
+        //
+        // Concerns:
+        //: 1 Padding counters to cache lines avoids the cost of false sharing
+        //:   when they are incremented by different threads.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, have each thread increment its own
+        //:   atomic counter, where the counters are (a) adjacent elements of
+        //:   an array, and (b) elements of a 'PerCoreArray'.  Report the
+        //:   average time per increment.  The number of increments per thread
+        //:   may be given as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: FALSE SHARING
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: FALSE SHARING"
+               "\n==========================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10000000;
+        const int MAX_THREADS    = 8;
+
+        bsls::AtomicInt                                  adjacent[MAX_THREADS];
+        bsls::PerCoreArray<bsls::AtomicInt, MAX_THREADS> padded;
+
+        bsls::AtomicInt *adjacentCounters[MAX_THREADS];
+        bsls::AtomicInt *paddedCounters[MAX_THREADS];
+        for (int i = 0; i < MAX_THREADS; ++i) {
+            adjacentCounters[i] = &adjacent[i];
+            paddedCounters[i]   = &padded[i];
+        }
+
+        printf("%8s %14s %14s\n", "threads", "adjacent ns", "padded ns");
+
+        for (int n = 1; n <= MAX_THREADS; n *= 2) {
+            const Int64 adjacentTime = runWorkers(adjacentCounters,
+                                                  n,
+                                                  NUM_ITERATIONS);
+            const Int64 paddedTime   = runWorkers(paddedCounters,
+                                                  n,
+                                                  NUM_ITERATIONS);
+
+            const double OPS = static_cast<double>(n) * NUM_ITERATIONS;
+            printf("%8d %14.2f %14.2f\n",
+                   n,
+                   static_cast<double>(adjacentTime) / OPS,
+                   static_cast<double>(paddedTime)   / OPS);
+        }
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
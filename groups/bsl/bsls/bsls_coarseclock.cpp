@@ -0,0 +1,133 @@
+// bsls_coarseclock.cpp                                               -*-C++-*-
+#include <bsls_coarseclock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#if defined BSLS_PLATFORM_OS_UNIX
+    #include <time.h>      // clock_gettime(), CLOCK_*_COARSE
+    #include <sys/time.h>  // gettimeofday()
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+    #include <windows.h>   // GetSystemTimeAsFileTime()
+#else
+    #error "Don't know how to get the system time for this platform"
+#endif
+
+namespace BloombergLP {
+
+namespace {
+
+const bsls::Types::Int64 k_NANOSECONDS_PER_SECOND = 1000 * 1000 * 1000;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(CLOCK_MONOTONIC_COARSE)        \
+                                    && defined(CLOCK_REALTIME_COARSE)
+#define BSLS_COARSECLOCK_LINUX_COARSE 1
+
+inline
+bsls::Types::Int64 readClock(clockid_t clockId)
+    // Return the value of the clock having the specified 'clockId', in
+    // nanoseconds.
+{
+    timespec ts;
+    clock_gettime(clockId, &ts);
+    const bsls::Types::Int64 seconds = ts.tv_sec;
+    return seconds * k_NANOSECONDS_PER_SECOND + ts.tv_nsec;
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bsls {
+
+                            // ------------------
+                            // struct CoarseClock
+                            // ------------------
+
+// CLASS DATA
+
+// 's_cache' is deliberately left without an initializer: it is zero
+// initialized as static data (before any dynamic initialization), and a zero
+// value denotes that no value has been published.
+
+CoarseClock_Cache CoarseClock::s_cache;
+
+// CLASS METHODS
+Types::Int64 CoarseClock::getMonotonicTimer()
+{
+#if defined(BSLS_COARSECLOCK_LINUX_COARSE)
+    return readClock(CLOCK_MONOTONIC_COARSE);
+#else
+    return TimeUtil::getTimer();
+#endif
+}
+
+Types::Int64 CoarseClock::getRealtimeTimer()
+{
+#if defined(BSLS_COARSECLOCK_LINUX_COARSE)
+
+    return readClock(CLOCK_REALTIME_COARSE);
+
+#elif defined BSLS_PLATFORM_OS_UNIX
+
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return static_cast<Types::Int64>(tv.tv_sec) * k_NANOSECONDS_PER_SECOND
+         + static_cast<Types::Int64>(tv.tv_usec) * 1000;
+
+#elif defined BSLS_PLATFORM_OS_WINDOWS
+
+    // 'GetSystemTimeAsFileTime' reports the number of 100-nanosecond
+    // intervals since January 1, 1601 (UTC), and is updated once per system
+    // timer interrupt.
+
+    const Types::Int64 k_EPOCH_OFFSET = 116444736000000000LL;
+                                         // 100-nanosecond intervals between
+                                         // 1601-01-01 and 1970-01-01
+
+    FILETIME fileTime;
+    ::GetSystemTimeAsFileTime(&fileTime);
+
+    const Types::Int64 intervals =
+                 (static_cast<Types::Int64>(fileTime.dwHighDateTime) << 32)
+               | fileTime.dwLowDateTime;
+    return (intervals - k_EPOCH_OFFSET) * 100;
+
+#endif
+}
+
+void CoarseClock::updateCachedTimers()
+{
+    AtomicOperations::setInt64Relaxed(&s_cache.d_monotonicTime,
+                                      getMonotonicTimer());
+    AtomicOperations::setInt64Relaxed(&s_cache.d_realtimeTime,
+                                      getRealtimeTimer());
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,259 @@
+// bsls_coarseclock.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLS_COARSECLOCK
+#define INCLUDED_BSLS_COARSECLOCK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide low-cost, coarse-resolution access to system clocks.
+//
+//@CLASSES:
+//  bsls::CoarseClock: namespace for coarse (and cached) clock functions
+//
+//@SEE_ALSO: bsls_timeutil
+//
+//@DESCRIPTION: This component provides a set of platform-neutral pure
+// procedures, 'bsls::CoarseClock', for obtaining the current time when a
+// resolution of a few milliseconds suffices -- for example, to stamp messages
+// for staleness checks, or to expire cache entries.  The functions trade
+// resolution for speed, and are appreciably cheaper than
+// 'bsls::TimeUtil::getTimer', which strives for the highest resolution the
+// platform offers.  As with 'bsls::TimeUtil', all values are returned in
+// nanoseconds (1 nsec = 1E-9 sec) as 64-bit integers.
+//
+///Coarse Clocks
+///-------------
+// 'getMonotonicTimer' returns the value of a monotonic clock and
+// 'getRealtimeTimer' returns the time elapsed since the Unix epoch (00:00:00
+// UTC, January 1, 1970).  On Linux these read 'CLOCK_MONOTONIC_COARSE' and
+// 'CLOCK_REALTIME_COARSE', respectively, which are served from the kernel's
+// most recent timer tick (typically 1 to 4 milliseconds old) without reading
+// the clock hardware.  On Linux, 'getMonotonicTimer' shares its origin with
+// 'bsls::TimeUtil::getTimer', so values from the two may be compared, bearing
+// in mind that the coarse value may lag by up to one tick.  On other
+// platforms, 'getMonotonicTimer' returns 'bsls::TimeUtil::getTimer()', and
+// 'getRealtimeTimer' reads the platform's (inherently coarse) system time.
+//
+///Cached Clocks
+///-------------
+// For code that reads the time at very high frequency, 'cachedMonotonicTimer'
+// and 'cachedRealtimeTimer' return the values most recently published by
+// 'updateCachedTimers'.  Each read is a single relaxed atomic load from a
+// cache line that holds nothing else, so readers on many threads share that
+// line without contention, and it is invalidated only when new values are
+// published.
+//
+// 'bsls' does not create threads: an application wishing to use the cached
+// clocks must arrange for 'updateCachedTimers' to be called periodically (for
+// example, every millisecond) from a single background "ticker" thread, or
+// from an existing event loop.  The resolution of the cached clocks is then
+// the period of that thread.  Until 'updateCachedTimers' has been called for
+// the first time, the cached functions return the values of
+// 'getMonotonicTimer' and 'getRealtimeTimer', respectively; once it has been
+// called, the cached values are not updated by any other means, so the
+// application is responsible for keeping the ticker running as long as the
+// cached clocks are in use.
+//
+///Thread Safety
+///-------------
+// All functions in this component are thread-safe.  Values returned by the
+// cached clocks on different threads are individually monotonic (for
+// 'cachedMonotonicTimer'), but need not be read in a globally consistent order
+// with respect to other memory operations.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Stale Messages
+///- - - - - - - - - - - - - - - - - -
+// Suppose that every message received by a service is stamped with its
+// arrival time, and that messages waiting longer than 50 milliseconds should
+// be discarded rather than processed.  Millisecond precision is plenty, so we
+// use the cached monotonic clock.
+//
+// First, we define a message type carrying its arrival time:
+//..
+//  struct Message {
+//      bsls::Types::Int64 d_arrivalTime;  // from 'cachedMonotonicTimer'
+//      int                d_payload;
+//  };
+//..
+// Then, we define a function to determine if a message has become stale:
+//..
+//  bool isStale(const Message& message)
+//  {
+//      const bsls::Types::Int64 maxAge = 50 * 1000 * 1000;  // 50 msec
+//
+//      return bsls::CoarseClock::cachedMonotonicTimer()
+//                                           - message.d_arrivalTime > maxAge;
+//  }
+//..
+// Next, in a real application a background thread calls 'updateCachedTimers'
+// every millisecond.  Here, we call it directly, to publish a first value:
+//..
+//  bsls::CoarseClock::updateCachedTimers();
+//..
+// Now, we stamp a message as it arrives:
+//..
+//  Message message;
+//  message.d_arrivalTime = bsls::CoarseClock::cachedMonotonicTimer();
+//  message.d_payload     = 42;
+//..
+// Finally, we verify that a freshly stamped message is not stale:
+//..
+//  assert(!isStale(message));
+//..
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                         // ========================
+                         // struct CoarseClock_Cache
+                         // ========================
+
+struct CoarseClock_Cache {
+    // This 'struct' holds the timer values published by
+    // 'CoarseClock::updateCachedTimers', padded on both sides by a full cache
+    // line so that no unrelated data shares a cache line with them, and is
+    // for use only by 'CoarseClock'.  Objects of this type are zero
+    // initialized (as static data), and a zero value indicates that no value
+    // has yet been published.
+
+    // TYPES
+    enum {
+        CACHE_LINE_SIZE = BSLS_PLATFORM_CACHE_LINE_SIZE
+                                                 // size of a cache line, in
+                                                 // bytes
+    };
+
+    // DATA
+    char                                 d_leadingPad[CACHE_LINE_SIZE];
+
+    AtomicOperations::AtomicTypes::Int64 d_monotonicTime;
+                                                  // last published monotonic
+                                                  // time (nanoseconds)
+
+    AtomicOperations::AtomicTypes::Int64 d_realtimeTime;
+                                                  // last published real time
+                                                  // (nanoseconds)
+
+    char                                 d_trailingPad[CACHE_LINE_SIZE];
+};
+
+                            // ==================
+                            // struct CoarseClock
+                            // ==================
+
+struct CoarseClock {
+    // This 'struct' provides a namespace for a set of platform-neutral pure
+    // procedures that return the current time, in nanoseconds, at a coarse
+    // resolution (a few milliseconds) and a correspondingly low cost.  See
+    // the component-level documentation for details.
+
+  private:
+    // CLASS DATA
+    static CoarseClock_Cache s_cache;  // values published by
+                                       // 'updateCachedTimers'
+
+  public:
+    // CLASS METHODS
+    static Types::Int64 cachedMonotonicTimer();
+        // Return the value of the monotonic clock, in nanoseconds, most
+        // recently published by 'updateCachedTimers', or the value of
+        // 'getMonotonicTimer()' if 'updateCachedTimers' has never been
+        // called.  Note that, once a value has been published, this method
+        // executes a single relaxed atomic load.
+
+    static Types::Int64 cachedRealtimeTimer();
+        // Return the time elapsed since the Unix epoch, in nanoseconds, most
+        // recently published by 'updateCachedTimers', or the value of
+        // 'getRealtimeTimer()' if 'updateCachedTimers' has never been called.
+        // Note that, once a value has been published, this method executes a
+        // single relaxed atomic load.
+
+    static Types::Int64 getMonotonicTimer();
+        // Return the current value of a coarse-resolution monotonic clock, in
+        // nanoseconds, referenced to an arbitrary but fixed origin (which, on
+        // Linux, is the origin of 'TimeUtil::getTimer').
+
+    static Types::Int64 getRealtimeTimer();
+        // Return the current time elapsed since the Unix epoch (00:00:00 UTC,
+        // January 1, 1970), in nanoseconds, as read from a coarse-resolution
+        // system clock.
+
+    static void updateCachedTimers();
+        // Publish the current values of 'getMonotonicTimer' and
+        // 'getRealtimeTimer' for subsequent retrieval by
+        // 'cachedMonotonicTimer' and 'cachedRealtimeTimer', respectively.
+        // The behavior is undefined unless calls to this method are
+        // serialized (e.g., made from a single "ticker" thread).
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // struct CoarseClock
+                            // ------------------
+
+// CLASS METHODS
+inline
+Types::Int64 CoarseClock::cachedMonotonicTimer()
+{
+    const Types::Int64 value =
+                   AtomicOperations::getInt64Relaxed(&s_cache.d_monotonicTime);
+    return value ? value : getMonotonicTimer();
+}
+
+inline
+Types::Int64 CoarseClock::cachedRealtimeTimer()
+{
+    const Types::Int64 value =
+                    AtomicOperations::getInt64Relaxed(&s_cache.d_realtimeTime);
+    return value ? value : getRealtimeTimer();
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
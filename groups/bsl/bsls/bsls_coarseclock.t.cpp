@@ -0,0 +1,719 @@
+// bsls_coarseclock.t.cpp                                             -*-C++-*-
+
+#include <bsls_coarseclock.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stddef.h>     // offsetof
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+#include <time.h>       // time()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility providing access to system clocks.
+// The direct clocks are validated against 'bsls::TimeUtil::getTimer' and the
+// C library 'time' function, allowing for their coarse resolution.  The
+// cached clocks are validated by publishing values explicitly, and then under
+// concurrent publication by a ticker thread.  A performance test (negative
+// case) compares the cost of the clocks under multi-threaded load.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] bsls::Types::Int64 getMonotonicTimer();
+// [ 2] bsls::Types::Int64 getRealtimeTimer();
+// [ 3] bsls::Types::Int64 cachedMonotonicTimer();
+// [ 3] bsls::Types::Int64 cachedRealtimeTimer();
+// [ 3] void updateCachedTimers();
+//-----------------------------------------------------------------------------
+// [ 4] CONCURRENCY: READERS AND TICKER
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH 'getTimer' UNDER LOAD
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::CoarseClock  Obj;
+typedef bsls::TimeUtil     TU;
+typedef bsls::Types::Int64 Int64;
+
+typedef Int64 (*TimerFunction)();
+
+const Int64 NANOSECONDS_PER_SECOND      = 1000 * 1000 * 1000;
+const Int64 NANOSECONDS_PER_MILLISECOND = 1000 * 1000;
+
+const Int64 TICK_TOLERANCE = 50 * NANOSECONDS_PER_MILLISECOND;
+    // Upper bound on the age of a coarse clock value, allowing generously for
+    // the kernel tick and for scheduling delays on a loaded test machine.
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static void mySleepMilliseconds(int milliseconds)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    ::Sleep(milliseconds);
+#else
+    timespec ts;
+    ts.tv_sec  = milliseconds / 1000;
+    ts.tv_nsec = (milliseconds % 1000) * 1000 * 1000;
+    nanosleep(&ts, 0);
+#endif
+}
+
+static Int64 callCachedMonotonicTimer()
+{
+    return Obj::cachedMonotonicTimer();
+}
+
+static Int64 callGetMonotonicTimer()
+{
+    return Obj::getMonotonicTimer();
+}
+
+static Int64 callGetTimer()
+{
+    return TU::getTimer();
+}
+
+                            // =================
+                            // struct TickerArgs
+                            // =================
+
+struct TickerArgs {
+    // This 'struct' controls a ticker thread, which publishes the coarse
+    // clock every millisecond until it is told to stop.
+
+    bsls::AtomicOperations::AtomicTypes::Int d_stop;       // non-zero to stop
+    int                                      d_numTicks;   // ticks published
+};
+
+extern "C" void *tickerThread(void *arg)
+{
+    TickerArgs *args = static_cast<TickerArgs *>(arg);
+
+    while (!bsls::AtomicOperations::getIntAcquire(&args->d_stop)) {
+        Obj::updateCachedTimers();
+        ++args->d_numTicks;
+        mySleepMilliseconds(1);
+    }
+    return 0;
+}
+
+                            // =================
+                            // struct ReaderArgs
+                            // =================
+
+struct ReaderArgs {
+    // This 'struct' describes the work of a reader thread: call 'd_timer'
+    // 'd_numCalls' times, recording the elapsed time and whether the values
+    // returned were ever observed to decrease.
+
+    TimerFunction  d_timer;         // function to call
+    int            d_numCalls;      // number of calls to make
+    Int64          d_elapsed;       // elapsed time (nanoseconds), output
+    int            d_numDecreases;  // number of decreases observed, output
+    Int64          d_sum;           // sum of values (defeats the optimizer)
+};
+
+extern "C" void *readerThread(void *arg)
+{
+    ReaderArgs *args = static_cast<ReaderArgs *>(arg);
+
+    const TimerFunction timer    = args->d_timer;
+    const int           numCalls = args->d_numCalls;
+
+    int   numDecreases = 0;
+    Int64 sum          = 0;
+    Int64 previous     = timer();
+
+    const Int64 start = TU::getTimer();
+    for (int i = 0; i < numCalls; ++i) {
+        const Int64 current = timer();
+        numDecreases += current < previous;
+        sum          += current;
+        previous      = current;
+    }
+    args->d_elapsed = TU::getTimer() - start;
+
+    args->d_numDecreases = numDecreases;
+    args->d_sum          = sum;
+    return 0;
+}
+
+static void runReaders(ReaderArgs    *results,
+                       int            numThreads,
+                       TimerFunction  timer,
+                       int            numCalls)
+    // Run the specified 'numThreads' reader threads, each calling the
+    // specified 'timer' the specified 'numCalls' times, and load the
+    // outcome of each into the corresponding element of the specified
+    // 'results' array.
+{
+    my_thread_t handles[64];
+    ASSERT(numThreads <= 64);
+
+    for (int i = 0; i < numThreads; ++i) {
+        results[i].d_timer        = timer;
+        results[i].d_numCalls     = numCalls;
+        results[i].d_elapsed      = 0;
+        results[i].d_numDecreases = 0;
+        results[i].d_sum          = 0;
+        ASSERT(0 == myCreateThread(&handles[i], &readerThread, &results[i]));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        myJoinThread(handles[i]);
+    }
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Detecting Stale Messages
+///- - - - - - - - - - - - - - - - - -
+// Suppose that every message received by a service is stamped with its
+// arrival time, and that messages waiting longer than 50 milliseconds should
+// be discarded rather than processed.  Millisecond precision is plenty, so we
+// use the cached monotonic clock.
+//
+// First, we define a message type carrying its arrival time:
+//..
+    struct Message {
+        bsls::Types::Int64 d_arrivalTime;  // from 'cachedMonotonicTimer'
+        int                d_payload;
+    };
+//..
+// Then, we define a function to determine if a message has become stale:
+//..
+    bool isStale(const Message& message)
+    {
+        const bsls::Types::Int64 maxAge = 50 * 1000 * 1000;  // 50 msec
+
+        return bsls::CoarseClock::cachedMonotonicTimer()
+                                             - message.d_arrivalTime > maxAge;
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, in a real application a background thread calls 'updateCachedTimers'
+// every millisecond.  Here, we call it directly, to publish a first value:
+//..
+    bsls::CoarseClock::updateCachedTimers();
+//..
+// Now, we stamp a message as it arrives:
+//..
+    Message message;
+    message.d_arrivalTime = bsls::CoarseClock::cachedMonotonicTimer();
+    message.d_payload     = 42;
+//..
+// Finally, we verify that a freshly stamped message is not stale:
+//..
+    ASSERT(!isStale(message));
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: READERS AND TICKER
+        //
+        // Concerns:
+        //: 1 Values read by 'cachedMonotonicTimer' on each thread never
+        //:   decrease while a ticker thread publishes new values.
+        //:
+        //: 2 The cached value advances while the ticker is running, and
+        //:   remains close to 'getMonotonicTimer'.
+        //
+        // Plan:
+        //: 1 Start a ticker thread that calls 'updateCachedTimers' every
+        //:   millisecond, and several reader threads calling
+        //:   'cachedMonotonicTimer' in a tight loop; verify that no reader
+        //:   observes a decrease.  (C-1)
+        //:
+        //: 2 While the ticker is running, verify that the cached value
+        //:   advances across a 20 millisecond sleep, and lags
+        //:   'getMonotonicTimer' by no more than a generous tolerance.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY: READERS AND TICKER
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: READERS AND TICKER"
+                            "\n===============================\n");
+
+        TickerArgs ticker;
+        bsls::AtomicOperations::initInt(&ticker.d_stop, 0);
+        ticker.d_numTicks = 0;
+
+        my_thread_t tickerHandle;
+        ASSERT(0 == myCreateThread(&tickerHandle, &tickerThread, &ticker));
+
+        {
+            const int NUM_THREADS = 4;
+            ReaderArgs results[NUM_THREADS];
+
+            runReaders(results,
+                       NUM_THREADS,
+                       &callCachedMonotonicTimer,
+                       1000000);
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                LOOP2_ASSERT(i, results[i].d_numDecreases,
+                             0 == results[i].d_numDecreases);
+            }
+        }
+
+        {
+            const Int64 before = Obj::cachedMonotonicTimer();
+            mySleepMilliseconds(20);
+            const Int64 after  = Obj::cachedMonotonicTimer();
+            const Int64 now    = Obj::getMonotonicTimer();
+
+            if (veryVerbose) { T_; P_(before); P_(after); P(now); }
+
+            LOOP2_ASSERT(before, after, before < after);
+            LOOP2_ASSERT(after, now, after <= now);
+            LOOP2_ASSERT(after, now, now - after <= TICK_TOLERANCE);
+        }
+
+        bsls::AtomicOperations::setIntRelease(&ticker.d_stop, 1);
+        myJoinThread(tickerHandle);
+
+        if (verbose) { T_; P(ticker.d_numTicks); }
+        ASSERT(0 < ticker.d_numTicks);
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CACHED TIMERS
+        //
+        // Concerns:
+        //: 1 Before any value is published, the cached timers return values
+        //:   of the corresponding direct timers.
+        //:
+        //: 2 After 'updateCachedTimers', the cached timers return exactly the
+        //:   published values, which do not change until the next call to
+        //:   'updateCachedTimers'.
+        //:
+        //: 3 Each call to 'updateCachedTimers' publishes current values.
+        //:
+        //: 4 The published values do not share a cache line with any other
+        //:   data.
+        //
+        // Plan:
+        //: 1 Bracket calls to the cached timers (before any value has been
+        //:   published) with calls to the direct timers, and verify the
+        //:   ordering.  (C-1)
+        //:
+        //: 2 Call 'updateCachedTimers', bracketed by calls to the direct
+        //:   timers, and verify that the cached values lie between the
+        //:   bracketing values.  Sleep, and verify that the cached values are
+        //:   unchanged.  (C-2..3)
+        //:
+        //: 3 Call 'updateCachedTimers' again, and verify that the cached
+        //:   values advanced by at least the duration of the sleep.  (C-3)
+        //:
+        //: 4 Verify the layout of 'bsls::CoarseClock_Cache'.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 cachedMonotonicTimer();
+        //   bsls::Types::Int64 cachedRealtimeTimer();
+        //   void updateCachedTimers();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCACHED TIMERS"
+                            "\n=============\n");
+
+        if (verbose) printf("\nBefore publication.\n");
+        {
+            const Int64 monoBefore = Obj::getMonotonicTimer();
+            const Int64 realBefore = Obj::getRealtimeTimer();
+            const Int64 mono       = Obj::cachedMonotonicTimer();
+            const Int64 real       = Obj::cachedRealtimeTimer();
+            const Int64 monoAfter  = Obj::getMonotonicTimer();
+            const Int64 realAfter  = Obj::getRealtimeTimer();
+
+            LOOP2_ASSERT(monoBefore, mono, monoBefore <= mono);
+            LOOP2_ASSERT(mono,  monoAfter, mono <= monoAfter);
+            LOOP2_ASSERT(realBefore, real, realBefore <= real);
+            LOOP2_ASSERT(real,  realAfter, real <= realAfter);
+        }
+
+        if (verbose) printf("\nPublished values are stable.\n");
+
+        const int SLEEP_MS = 20;
+
+        Int64 mono, real;
+        {
+            const Int64 monoBefore = Obj::getMonotonicTimer();
+            const Int64 realBefore = Obj::getRealtimeTimer();
+            Obj::updateCachedTimers();
+            const Int64 monoAfter  = Obj::getMonotonicTimer();
+            const Int64 realAfter  = Obj::getRealtimeTimer();
+
+            mono = Obj::cachedMonotonicTimer();
+            real = Obj::cachedRealtimeTimer();
+
+            LOOP2_ASSERT(monoBefore, mono, monoBefore <= mono);
+            LOOP2_ASSERT(mono,  monoAfter, mono <= monoAfter);
+            LOOP2_ASSERT(realBefore, real, realBefore <= real);
+            LOOP2_ASSERT(real,  realAfter, real <= realAfter);
+
+            mySleepMilliseconds(SLEEP_MS);
+
+            LOOP_ASSERT(mono, mono == Obj::cachedMonotonicTimer());
+            LOOP_ASSERT(real, real == Obj::cachedRealtimeTimer());
+        }
+
+        if (verbose) printf("\nRepublication advances the values.\n");
+        {
+            Obj::updateCachedTimers();
+
+            const Int64 monoDelta = Obj::cachedMonotonicTimer() - mono;
+            const Int64 realDelta = Obj::cachedRealtimeTimer()  - real;
+            const Int64 minDelta  = (SLEEP_MS - 5)
+                                                 * NANOSECONDS_PER_MILLISECOND;
+
+            if (veryVerbose) { T_; P_(monoDelta); P(realDelta); }
+
+            LOOP_ASSERT(monoDelta, minDelta <= monoDelta);
+            LOOP_ASSERT(realDelta, minDelta <= realDelta);
+        }
+
+        if (verbose) printf("\nCache layout.\n");
+        {
+            typedef bsls::CoarseClock_Cache Cache;
+
+            const size_t LINE     = Cache::CACHE_LINE_SIZE;
+            const size_t MONO     = offsetof(Cache, d_monotonicTime);
+            const size_t REAL     = offsetof(Cache, d_realtimeTime);
+            const size_t TRAILING = offsetof(Cache, d_trailingPad);
+
+            if (veryVerbose) { T_; P_(MONO); P_(REAL); P(TRAILING); }
+
+            ASSERT(LINE <= MONO);
+            ASSERT(REAL <  TRAILING);
+            ASSERT(LINE <= sizeof(Cache) - TRAILING);
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'getRealtimeTimer'
+        //
+        // Concerns:
+        //: 1 'getRealtimeTimer' returns the time since the Unix epoch, in
+        //:   nanoseconds, consistent with the C library 'time' function.
+        //:
+        //: 2 The value advances with the passage of time.
+        //
+        // Plan:
+        //: 1 Bracket a call to 'getRealtimeTimer' with calls to 'time', and
+        //:   verify that the result (converted to seconds) lies between them,
+        //:   allowing for the coarse resolution.  (C-1)
+        //:
+        //: 2 Verify that the value advances across a 20 millisecond sleep.
+        //:   (C-2)
+        //
+        // Testing:
+        //   bsls::Types::Int64 getRealtimeTimer();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'getRealtimeTimer'"
+                            "\n==================\n");
+
+        {
+            const Int64 before = static_cast<Int64>(time(0));
+            const Int64 now    = Obj::getRealtimeTimer();
+            const Int64 after  = static_cast<Int64>(time(0));
+
+            if (veryVerbose) { T_; P_(before); P_(now); P(after); }
+
+            LOOP2_ASSERT(before, now,
+               before * NANOSECONDS_PER_SECOND - TICK_TOLERANCE <= now);
+            LOOP2_ASSERT(now, after,
+               now < (after + 1) * NANOSECONDS_PER_SECOND + TICK_TOLERANCE);
+        }
+
+        {
+            const Int64 before = Obj::getRealtimeTimer();
+            mySleepMilliseconds(20);
+            const Int64 after  = Obj::getRealtimeTimer();
+
+            LOOP2_ASSERT(before, after, before < after);
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'getMonotonicTimer'
+        //
+        // Concerns:
+        //: 1 Successive values returned by 'getMonotonicTimer' are
+        //:   non-decreasing.
+        //:
+        //: 2 On Linux, 'getMonotonicTimer' shares its origin with
+        //:   'TimeUtil::getTimer', lagging it by no more than a tick.
+        //:
+        //: 3 The value advances with the passage of time.
+        //
+        // Plan:
+        //: 1 Call 'getMonotonicTimer' repeatedly and verify that the sequence
+        //:   of values is non-decreasing.  (C-1)
+        //:
+        //: 2 Bracket calls to 'getMonotonicTimer' with calls to
+        //:   'TimeUtil::getTimer' and verify the ordering, allowing for the
+        //:   coarse resolution.  (C-2)
+        //:
+        //: 3 Verify that the value advances across a 20 millisecond sleep.
+        //:   (C-3)
+        //
+        // Testing:
+        //   bsls::Types::Int64 getMonotonicTimer();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'getMonotonicTimer'"
+                            "\n===================\n");
+
+        {
+            Int64 previous = Obj::getMonotonicTimer();
+            for (int i = 0; i < 100000; ++i) {
+                const Int64 current = Obj::getMonotonicTimer();
+                LOOP3_ASSERT(i, previous, current, previous <= current);
+                previous = current;
+            }
+        }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+        for (int i = 0; i < 1000; ++i) {
+            const Int64 before = TU::getTimer();
+            const Int64 coarse = Obj::getMonotonicTimer();
+            const Int64 after  = TU::getTimer();
+
+            LOOP3_ASSERT(i, before, coarse,
+                         before - TICK_TOLERANCE <= coarse);
+            LOOP3_ASSERT(i, coarse, after, coarse <= after);
+        }
+#endif
+
+        {
+            const Int64 before = Obj::getMonotonicTimer();
+            mySleepMilliseconds(20);
+            const Int64 after  = Obj::getMonotonicTimer();
+
+            LOOP2_ASSERT(before, after, before < after);
+        }
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'getTimer' UNDER LOAD
+        //
+        // Concerns:
+        //: 1 The coarse and cached clocks are cheaper than
+        //:   'TimeUtil::getTimer', and the cached clock scales with the
+        //:   number of reading threads.
+        //
+        // Plan:
+        //: 1 With a ticker thread publishing every millisecond, run 1, 2, 4,
+        //:   and 8 threads, each calling one of 'TimeUtil::getTimer',
+        //:   'getMonotonicTimer', and 'cachedMonotonicTimer' in a tight
+        //:   loop, and report the average cost per call.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH 'getTimer' UNDER LOAD
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: COMPARISON WITH 'getTimer' UNDER LOAD"
+               "\n==================================================\n");
+
+        const int NUM_CALLS   = 2000000;
+        const int MAX_THREADS = 8;
+
+        TickerArgs ticker;
+        bsls::AtomicOperations::initInt(&ticker.d_stop, 0);
+        ticker.d_numTicks = 0;
+
+        my_thread_t tickerHandle;
+        ASSERT(0 == myCreateThread(&tickerHandle, &tickerThread, &ticker));
+
+        const struct {
+            TimerFunction  d_timer;
+            const char    *d_name;
+        } TIMERS[] = {
+            { &callGetTimer,             "TimeUtil::getTimer"   },
+            { &callGetMonotonicTimer,    "getMonotonicTimer"    },
+            { &callCachedMonotonicTimer, "cachedMonotonicTimer" },
+        };
+        const int NUM_TIMERS = sizeof TIMERS / sizeof *TIMERS;
+
+        printf("%-24s %8s %12s\n", "timer", "threads", "ns/call");
+
+        for (int t = 0; t < NUM_TIMERS; ++t) {
+            for (int n = 1; n <= MAX_THREADS; n *= 2) {
+                ReaderArgs results[MAX_THREADS];
+                runReaders(results, n, TIMERS[t].d_timer, NUM_CALLS);
+
+                Int64 elapsed = 0;
+                for (int i = 0; i < n; ++i) {
+                    elapsed += results[i].d_elapsed;
+                }
+                printf("%-24s %8d %12.2f\n",
+                       TIMERS[t].d_name,
+                       n,
+                       static_cast<double>(elapsed) / n / NUM_CALLS);
+            }
+        }
+
+        bsls::AtomicOperations::setIntRelease(&ticker.d_stop, 1);
+        myJoinThread(tickerHandle);
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
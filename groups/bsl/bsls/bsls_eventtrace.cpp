@@ -0,0 +1,270 @@
+// bsls_eventtrace.cpp                                                -*-C++-*-
+#include <bsls_eventtrace.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_spinlock.h>
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    #include <process.h>      // _getpid()
+#else
+    #include <unistd.h>       // getpid()
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+namespace {
+
+                         // =========================
+                         // Registry of Trace Buffers
+                         // =========================
+
+SpinLock          g_registryLock = BSLS_SPINLOCK_UNLOCKED;
+                                          // serializes the globals below
+
+EventTraceBuffer *g_buffers_p    = 0;     // registered buffers
+
+int               g_nextThreadId = 1;     // thread id of the next buffer
+
+                            // ====================
+                            // Local Free Functions
+                            // ====================
+
+int processId()
+    // Return the identifier of the current process.
+{
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+    return _getpid();
+#else
+    return static_cast<int>(getpid());
+#endif
+}
+
+void writeJsonString(FILE *stream, const char *string)
+    // Write the specified null-terminated 'string' to the specified 'stream'
+    // as a quoted JSON string.
+{
+    fputc('"', stream);
+    for (const char *p = string; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if ('"' == c || '\\' == c) {
+            fputc('\\', stream);
+            fputc(c, stream);
+        }
+        else if (c < 0x20) {
+            fprintf(stream, "\\u%04x", static_cast<unsigned>(c));
+        }
+        else {
+            fputc(c, stream);
+        }
+    }
+    fputc('"', stream);
+}
+
+void writeEvent(FILE                  *stream,
+                const EventTraceEvent&  event,
+                int                     pid,
+                int                     tid)
+    // Write the specified 'event', recorded by the thread having the
+    // specified 'tid' in the process having the specified 'pid', to the
+    // specified 'stream' as a JSON object in the Trace Event Format.
+{
+    const Types::Int64 nanoseconds =
+                              TimeUtil::convertFastTimerRaw(event.d_timestamp);
+
+    fputs("{\"name\":", stream);
+    writeJsonString(stream, event.d_name_p);
+    fprintf(stream,
+            ",\"ph\":\"%c\",\"ts\":%lld.%03d,\"pid\":%d,\"tid\":%d",
+            event.d_phase,
+            static_cast<long long>(nanoseconds / 1000),
+            static_cast<int>(nanoseconds % 1000),
+            pid,
+            tid);
+
+    if ('i' == event.d_phase) {
+        fputs(",\"s\":\"t\"", stream);  // scoped to the thread
+    }
+
+    if (0 < event.d_numArgs) {
+        fputs(",\"args\":{", stream);
+        if ('C' == event.d_phase) {
+            fprintf(stream, "\"value\":%d", event.d_args[0]);
+        }
+        else {
+            for (int i = 0; i < event.d_numArgs; ++i) {
+                fprintf(stream,
+                        "%s\"arg%d\":%d",
+                        0 == i ? "" : ",",
+                        i,
+                        event.d_args[i]);
+            }
+        }
+        fputc('}', stream);
+    }
+    fputc('}', stream);
+}
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class EventTraceBuffer
+                           // ----------------------
+
+// CREATORS
+EventTraceBuffer::EventTraceBuffer(EventTraceEvent *events,
+                                   int              capacity,
+                                   const char      *threadName)
+: d_events_p(events)
+, d_mask(capacity - 1)
+, d_threadId(0)
+, d_threadName_p(threadName)
+, d_next_p(0)
+{
+    BSLS_ASSERT(events);
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    AtomicOperations::initInt64(&d_numRecorded, 0);
+
+    // Calibrate the fast timer now, rather than on the first recorded event.
+
+    TimeUtil::initializeFastTimer();
+
+    g_registryLock.lock();
+    d_threadId  = g_nextThreadId++;
+    d_next_p    = g_buffers_p;
+    g_buffers_p = this;
+    g_registryLock.unlock();
+}
+
+EventTraceBuffer::~EventTraceBuffer()
+{
+    BSLS_ASSERT(this != EventTrace::threadBuffer());
+
+    g_registryLock.lock();
+    EventTraceBuffer **link = &g_buffers_p;
+    while (*link != this) {
+        BSLS_ASSERT(*link);
+        link = &(*link)->d_next_p;
+    }
+    *link = d_next_p;
+    g_registryLock.unlock();
+}
+
+// ACCESSORS
+bool EventTraceBuffer::readEvent(EventTraceEvent *result,
+                                 Types::Int64     index) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= index);
+
+    const Types::Int64 capacity = d_mask + 1;
+
+    *result = d_events_p[static_cast<int>(index) & d_mask];
+
+    // The acquire fence pairs with the release fence in 'record': if the copy
+    // above observed any store of event 'index + capacity' (into the same
+    // slot), the load below observes that at least 'index + capacity' events
+    // were recorded, so the event is rejected.
+
+    AtomicOperations::fenceAcquire();
+
+    const Types::Int64 numRecorded =
+                           AtomicOperations::getInt64Relaxed(&d_numRecorded);
+
+    return index + capacity > numRecorded;
+}
+
+                              // ----------------
+                              // class EventTrace
+                              // ----------------
+
+// CLASS DATA
+BSLS_EVENTTRACE_THREAD_LOCAL
+EventTraceBuffer *EventTrace::s_threadBuffer_p = 0;
+
+// CLASS METHODS
+int EventTrace::writeChromeTrace(FILE *stream)
+{
+    BSLS_ASSERT(stream);
+
+    const int pid = processId();
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", stream);
+
+    bool first = true;
+
+    g_registryLock.lock();
+    for (const EventTraceBuffer *buffer = g_buffers_p;
+         buffer;
+         buffer = buffer->d_next_p) {
+        const int tid = buffer->d_threadId;
+
+        if (buffer->d_threadName_p) {
+            fprintf(stream,
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+                    "\"tid\":%d,\"args\":{\"name\":",
+                    first ? "" : ",\n",
+                    pid,
+                    tid);
+            writeJsonString(stream, buffer->d_threadName_p);
+            fputs("}}", stream);
+            first = false;
+        }
+
+        // The oldest slot may be overwritten while it is read, so at most
+        // 'capacity() - 1' events are written.
+
+        const Types::Int64 end   = buffer->numRecorded();
+        const Types::Int64 begin = end - buffer->capacity() + 1 > 0
+                                 ? end - buffer->capacity() + 1
+                                 : 0;
+
+        for (Types::Int64 index = begin; index < end; ++index) {
+            EventTraceEvent event;
+            if (buffer->readEvent(&event, index)) {
+                if (!first) {
+                    fputs(",\n", stream);
+                }
+                writeEvent(stream, event, pid, tid);
+                first = false;
+            }
+        }
+    }
+    g_registryLock.unlock();
+
+    fputs("\n]}\n", stream);
+
+    return ferror(stream) || 0 != fflush(stream) ? -1 : 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
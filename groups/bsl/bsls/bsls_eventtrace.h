@@ -0,0 +1,580 @@
+// bsls_eventtrace.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLS_EVENTTRACE
+#define INCLUDED_BSLS_EVENTTRACE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide low-overhead per-thread tracing of binary events.
+//
+//@CLASSES:
+//  bsls::EventTraceEvent: fixed-size binary trace event
+//  bsls::EventTraceBuffer: per-thread ring buffer of trace events
+//  bsls::EventTrace: namespace for recording and dumping trace events
+//  bsls::EventTraceScope: guard recording the beginning and end of a scope
+//
+//@MACROS:
+//  BSLS_EVENTTRACE_BEGIN(NAME): record the beginning of a duration
+//  BSLS_EVENTTRACE_END(NAME): record the end of a duration
+//  BSLS_EVENTTRACE_SCOPE(NAME): record a duration spanning the current scope
+//  BSLS_EVENTTRACE_INSTANT(NAME): record an instantaneous event
+//  BSLS_EVENTTRACE_INSTANT1(NAME, A0): ... having one integer argument
+//  BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1): ... having two integer arguments
+//  BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2): ... having three arguments
+//  BSLS_EVENTTRACE_COUNTER(NAME, VALUE): record the value of a counter
+//
+//@SEE_ALSO: bsls_timeutil
+//
+//@DESCRIPTION: This component provides a facility for recording what threads
+// are doing on hot paths, at a cost (typically a few tens of nanoseconds per
+// event) low enough to leave in production code, so that the events preceding
+// an anomaly such as a latency spike can be examined after the fact.
+//
+// Each event is a fixed-size binary record, a 'bsls::EventTraceEvent',
+// holding a timestamp (the raw value of the fast timer of 'bsls::TimeUtil'),
+// the address of a static string that names (and identifies) the event, a
+// phase, and up to three integer arguments.  Recording an event formats
+// nothing: it stores these values into the next slot of the calling thread's
+// 'bsls::EventTraceBuffer', a ring buffer that overwrites its oldest events
+// once full.  Recording neither allocates memory, nor takes a lock, nor
+// executes a read-modify-write atomic operation.
+//
+// Events are recorded using the macros below, each of which records into the
+// buffer installed for the calling thread by 'bsls::EventTrace::
+// setThreadBuffer', and does nothing if no buffer is installed.  'NAME' must
+// be a string literal.
+//..
+//  Macro                                       Phase
+//  ------------------------------------------  ----------------------------
+//  BSLS_EVENTTRACE_BEGIN(NAME)                 'B': beginning of a duration
+//  BSLS_EVENTTRACE_END(NAME)                   'E': end of a duration
+//  BSLS_EVENTTRACE_SCOPE(NAME)                 'B' now, and 'E' at the end of
+//                                              the enclosing scope
+//  BSLS_EVENTTRACE_INSTANT(NAME)               'i': instantaneous event
+//  BSLS_EVENTTRACE_INSTANT1(NAME, A0)          'i', having argument 'A0'
+//  BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1)      'i', having 'A0' and 'A1'
+//  BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2)  'i', having 'A0', 'A1', 'A2'
+//  BSLS_EVENTTRACE_COUNTER(NAME, VALUE)        'C': value of a counter
+//..
+// If the macro 'BSLS_EVENTTRACE_DISABLE' is defined when this header is
+// included, these macros expand to nothing (and their arguments are not
+// evaluated), removing the instrumentation at compile time.
+//
+// 'bsls::EventTrace::writeChromeTrace' writes the events held by every
+// buffer, in the JSON "Trace Event Format" understood by Chrome's
+// 'about://tracing' and by Perfetto ('https://ui.perfetto.dev'), which display
+// the durations of each thread on a timeline.  Timestamps are converted to
+// microseconds, referenced to the origin of 'bsls::TimeUtil::getTimer'.
+//
+///Buffers and Threads
+///-------------------
+// A 'bsls::EventTraceBuffer' uses storage for its events supplied by the
+// caller (e.g., a static array, or an array on the stack of the thread's
+// entry function), whose capacity must be a power of two.  A buffer registers
+// itself, on construction, with a process-wide list from which
+// 'writeChromeTrace' collects events, and unregisters on destruction; each
+// buffer is assigned a distinct thread id for the trace, and may be given a
+// thread name.  A buffer must be recorded into by only one thread at a time,
+// and must be uninstalled (by 'setThreadBuffer(0)') from the thread using it
+// before it is destroyed.
+//
+///Dumping Concurrently with Recording
+///-----------------------------------
+// 'writeChromeTrace' may be called while other threads record events.  It
+// copies each event, and then verifies (by re-reading the buffer's count of
+// recorded events) that the event's slot was not reused during the copy,
+// discarding the event otherwise; to allow for a slot being written as it is
+// copied, at most 'capacity() - 1' events of each buffer are written.  The
+// buffer is thus a sequence lock whose sequence number is the count of
+// recorded events: memory fences (see 'bsls_atomicoperations') ensure that an
+// event overwritten while being copied is always discarded, rather than
+// written with fields from two different events.  The registry of buffers is
+// locked during 'writeChromeTrace', so buffers cannot be created or destroyed
+// until it returns.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Tracing the Phases of Request Processing
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server occasionally takes much longer than usual to process
+// a request, and that we wish to find out which phase of the processing is
+// responsible.
+//
+// First, we instrument the processing of a request, recording a duration for
+// the whole request, a duration for one of its phases, and an instantaneous
+// event, having the request's size as an argument, in between:
+//..
+//  int parseRequest(int requestId)
+//  {
+//      BSLS_EVENTTRACE_SCOPE("parse");
+//      return requestId % 7;
+//  }
+//
+//  void processRequest(int requestId)
+//  {
+//      BSLS_EVENTTRACE_SCOPE("request");
+//
+//      int size = parseRequest(requestId);
+//      BSLS_EVENTTRACE_INSTANT2("parsed", requestId, size);
+//
+//      // ... process the request ...
+//  }
+//..
+// Then, on each thread processing requests, we install a buffer for the
+// thread's events, here having storage for 1024 events:
+//..
+//  static bsls::EventTraceEvent events[1024];
+//  bsls::EventTraceBuffer       buffer(events, 1024, "worker");
+//
+//  bsls::EventTrace::setThreadBuffer(&buffer);
+//..
+// Next, we process some requests:
+//..
+//  for (int i = 0; i < 3; ++i) {
+//      processRequest(i);
+//  }
+//..
+// Each request recorded five events:
+//..
+//  assert(15 == buffer.numRecorded());
+//..
+// Now, when a latency spike is detected, we write the recent events of every
+// thread to a file that can be loaded into Chrome or Perfetto:
+//..
+//  FILE *file = tmpfile();
+//  assert(file);
+//
+//  int rc = bsls::EventTrace::writeChromeTrace(file);
+//  assert(0 == rc);
+//
+//  fclose(file);
+//..
+// Finally, before 'buffer' is destroyed, we uninstall it:
+//..
+//  bsls::EventTrace::setThreadBuffer(0);
+//..
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO
+#include <stdio.h>
+#define INCLUDED_STDIO
+#endif
+
+                       // ============================
+                       // BSLS_EVENTTRACE_THREAD_LOCAL
+                       // ============================
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    #define BSLS_EVENTTRACE_THREAD_LOCAL __declspec(thread)
+#else
+    #define BSLS_EVENTTRACE_THREAD_LOCAL __thread
+#endif
+    // [!PRIVATE!] Storage-class specifier giving each thread its own instance
+    // of a variable.
+
+                             // ================
+                             // Recording Macros
+                             // ================
+
+#define BSLS_EVENTTRACE_CAT(X, Y) BSLS_EVENTTRACE_CAT_IMP(X, Y)
+#define BSLS_EVENTTRACE_CAT_IMP(X, Y) X##Y
+    // [!PRIVATE!] Paste the expansions of the specified 'X' and 'Y'.
+
+#if defined(BSLS_EVENTTRACE_DISABLE)
+
+#define BSLS_EVENTTRACE_BEGIN(NAME)
+#define BSLS_EVENTTRACE_END(NAME)
+#define BSLS_EVENTTRACE_SCOPE(NAME)
+#define BSLS_EVENTTRACE_INSTANT(NAME)
+#define BSLS_EVENTTRACE_INSTANT1(NAME, A0)
+#define BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1)
+#define BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2)
+#define BSLS_EVENTTRACE_COUNTER(NAME, VALUE)
+
+#else
+
+// The empty string literal concatenated with 'NAME' rejects, at compile time,
+// names that are not string literals (and so might not have static storage
+// duration).
+
+#define BSLS_EVENTTRACE_BEGIN(NAME)                                           \
+    BloombergLP::bsls::EventTrace::record('B', "" NAME, 0, 0, 0, 0)
+
+#define BSLS_EVENTTRACE_END(NAME)                                             \
+    BloombergLP::bsls::EventTrace::record('E', "" NAME, 0, 0, 0, 0)
+
+#define BSLS_EVENTTRACE_SCOPE(NAME)                                           \
+    BloombergLP::bsls::EventTraceScope                                        \
+           BSLS_EVENTTRACE_CAT(bslsEventTraceScope, __LINE__)("" NAME)
+
+#define BSLS_EVENTTRACE_INSTANT(NAME)                                         \
+    BloombergLP::bsls::EventTrace::record('i', "" NAME, 0, 0, 0, 0)
+
+#define BSLS_EVENTTRACE_INSTANT1(NAME, A0)                                    \
+    BloombergLP::bsls::EventTrace::record('i', "" NAME, 1, (A0), 0, 0)
+
+#define BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1)                                \
+    BloombergLP::bsls::EventTrace::record('i', "" NAME, 2, (A0), (A1), 0)
+
+#define BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2)                            \
+    BloombergLP::bsls::EventTrace::record('i', "" NAME, 3, (A0), (A1), (A2))
+
+#define BSLS_EVENTTRACE_COUNTER(NAME, VALUE)                                  \
+    BloombergLP::bsls::EventTrace::record('C', "" NAME, 1, (VALUE), 0, 0)
+
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+class EventTraceBuffer;
+
+                           // ======================
+                           // struct EventTraceEvent
+                           // ======================
+
+struct EventTraceEvent {
+    // This 'struct' holds a recorded trace event.
+
+    // TYPES
+    enum {
+        k_MAX_ARGS = 3  // maximum number of integer arguments of an event
+    };
+
+    // DATA
+    Types::Int64  d_timestamp;         // raw value of the fast timer
+
+    const char   *d_name_p;            // static name (identifies the event)
+
+    int           d_args[k_MAX_ARGS];  // integer arguments
+
+    char          d_phase;             // 'B', 'E', 'i', or 'C' (see the
+                                       // component-level documentation)
+
+    char          d_numArgs;           // number of arguments used
+};
+
+                           // ======================
+                           // class EventTraceBuffer
+                           // ======================
+
+class EventTraceBuffer {
+    // This class implements a ring buffer of trace events recorded by one
+    // thread, which overwrites its oldest events once full.  The events may
+    // be read concurrently by other threads (see "Dumping Concurrently with
+    // Recording" in the component-level documentation).
+
+    // DATA
+    AtomicOperations::AtomicTypes::Int64
+                      d_numRecorded;  // number of events ever recorded
+
+    EventTraceEvent  *d_events_p;     // storage for events (held, not owned)
+
+    int               d_mask;         // capacity - 1
+
+    int               d_threadId;     // thread id written to traces
+
+    const char       *d_threadName_p; // thread name, or 0 (held)
+
+    EventTraceBuffer *d_next_p;       // next buffer in registry
+
+    // FRIENDS
+    friend class EventTrace;
+
+  private:
+    // NOT IMPLEMENTED
+    EventTraceBuffer(const EventTraceBuffer&);
+    EventTraceBuffer& operator=(const EventTraceBuffer&);
+
+  public:
+    // CREATORS
+    EventTraceBuffer(EventTraceEvent *events,
+                     int              capacity,
+                     const char      *threadName = 0);
+        // Create a buffer storing up to the specified 'capacity' events in
+        // the specified 'events' array, register it with the process-wide
+        // list of buffers, and assign it a thread id distinct from those of
+        // the other registered buffers.  Optionally specify a 'threadName'
+        // written to traces.  The behavior is undefined unless 'capacity' is
+        // a positive power of two, 'events' has at least 'capacity' elements,
+        // and 'events' (and 'threadName', if specified) outlive this buffer.
+        // Note that this constructor calibrates the fast timer of
+        // 'bsls::TimeUtil' if it has not been calibrated.
+
+    ~EventTraceBuffer();
+        // Unregister this buffer, and destroy it.  The behavior is undefined
+        // if this buffer is installed for any thread.
+
+    // MANIPULATORS
+    void record(char        phase,
+                const char *name,
+                int         numArgs,
+                int         arg0,
+                int         arg1,
+                int         arg2);
+        // Record an event having the specified 'phase', 'name', and the first
+        // specified 'numArgs' of 'arg0', 'arg1', and 'arg2' as arguments,
+        // timestamped with the fast timer, overwriting the oldest event if
+        // this buffer is full.  The behavior is undefined unless 'name'
+        // has static storage duration, '0 <= numArgs <= 3', and no other
+        // thread records into this buffer concurrently.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the number of events this buffer can hold.
+
+    Types::Int64 numRecorded() const;
+        // Return the number of events ever recorded into this buffer.
+
+    bool readEvent(EventTraceEvent *result, Types::Int64 index) const;
+        // Load into the specified 'result' the event recorded at the
+        // specified 'index' (i.e., the 'index'th event recorded, counting
+        // from 0), and return 'true', or return 'false' (leaving 'result' in
+        // an unspecified state) if that event is no longer held by this
+        // buffer, or may have been overwritten while being read.  The
+        // behavior is undefined unless 'index < numRecorded()' held when
+        // this method was called.
+
+    int threadId() const;
+        // Return the thread id written to traces for the events of this
+        // buffer.
+
+    const char *threadName() const;
+        // Return the thread name written to traces for the events of this
+        // buffer, or 0 if it has none.
+};
+
+                              // ================
+                              // class EventTrace
+                              // ================
+
+class EventTrace {
+    // This class provides a namespace for functions that record events into
+    // the buffer installed for the calling thread, and that write the events
+    // of every buffer as a trace.
+
+    // CLASS DATA
+    static BSLS_EVENTTRACE_THREAD_LOCAL EventTraceBuffer *s_threadBuffer_p;
+                                              // buffer of the calling thread
+
+  public:
+    // CLASS METHODS
+    static void record(char        phase,
+                       const char *name,
+                       int         numArgs,
+                       int         arg0,
+                       int         arg1,
+                       int         arg2);
+        // Record, into the buffer installed for the calling thread, an event
+        // having the specified 'phase', 'name', and the first specified
+        // 'numArgs' of 'arg0', 'arg1', and 'arg2' as arguments; do nothing if
+        // no buffer is installed.  The behavior is undefined unless 'name' has
+        // static storage duration, and '0 <= numArgs <= 3'.  Note that this
+        // method is intended to be called by the 'BSLS_EVENTTRACE_*' macros.
+
+    static void setThreadBuffer(EventTraceBuffer *buffer);
+        // Install the specified 'buffer' to hold the events recorded by the
+        // calling thread, or, if 'buffer' is 0, discard the events it records
+        // subsequently.
+
+    static EventTraceBuffer *threadBuffer();
+        // Return the address of the buffer installed for the calling thread,
+        // or 0 if there is none.
+
+    static int writeChromeTrace(FILE *stream);
+        // Write, to the specified 'stream', the events held by every
+        // registered buffer as a JSON document in the Trace Event Format of
+        // Chrome and Perfetto.  Return 0 on success, and a non-zero value if
+        // an error occurred writing to 'stream'.
+};
+
+                           // =====================
+                           // class EventTraceScope
+                           // =====================
+
+class EventTraceScope {
+    // This class implements a guard recording the beginning of a duration
+    // on construction, and its end on destruction.
+
+    // DATA
+    const char *d_name_p;  // name of the duration (held)
+
+  private:
+    // NOT IMPLEMENTED
+    EventTraceScope(const EventTraceScope&);
+    EventTraceScope& operator=(const EventTraceScope&);
+
+  public:
+    // CREATORS
+    explicit EventTraceScope(const char *name);
+        // Record the beginning of a duration having the specified 'name', and
+        // create a guard that records its end upon destruction.  The
+        // behavior is undefined unless 'name' has static storage duration.
+
+    ~EventTraceScope();
+        // Record the end of the duration begun by this guard, and destroy
+        // this guard.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class EventTraceBuffer
+                           // ----------------------
+
+// MANIPULATORS
+inline
+void EventTraceBuffer::record(char        phase,
+                              const char *name,
+                              int         numArgs,
+                              int         arg0,
+                              int         arg1,
+                              int         arg2)
+{
+    // Only this thread updates 'd_numRecorded', so no read-modify-write
+    // operation is needed.  Readers treat the slot of event 'index' as being
+    // overwritten once 'index' events are recorded (see 'readEvent'), so the
+    // release fence orders the (earlier) store of 'index' to 'd_numRecorded'
+    // before the stores to the slot, and the release store publishes the
+    // event's fields to readers.
+
+    const Types::Int64 index =
+                           AtomicOperations::getInt64Relaxed(&d_numRecorded);
+
+    AtomicOperations::fenceRelease();
+
+    EventTraceEvent& event = d_events_p[static_cast<int>(index) & d_mask];
+    event.d_timestamp = TimeUtil::getFastTimerRaw();
+    event.d_name_p    = name;
+    event.d_args[0]   = arg0;
+    event.d_args[1]   = arg1;
+    event.d_args[2]   = arg2;
+    event.d_phase     = phase;
+    event.d_numArgs   = static_cast<char>(numArgs);
+
+    AtomicOperations::setInt64Release(&d_numRecorded, index + 1);
+}
+
+// ACCESSORS
+inline
+int EventTraceBuffer::capacity() const
+{
+    return d_mask + 1;
+}
+
+inline
+Types::Int64 EventTraceBuffer::numRecorded() const
+{
+    return AtomicOperations::getInt64Acquire(&d_numRecorded);
+}
+
+inline
+int EventTraceBuffer::threadId() const
+{
+    return d_threadId;
+}
+
+inline
+const char *EventTraceBuffer::threadName() const
+{
+    return d_threadName_p;
+}
+
+                              // ----------------
+                              // class EventTrace
+                              // ----------------
+
+// CLASS METHODS
+inline
+void EventTrace::record(char        phase,
+                        const char *name,
+                        int         numArgs,
+                        int         arg0,
+                        int         arg1,
+                        int         arg2)
+{
+    EventTraceBuffer *buffer = s_threadBuffer_p;
+    if (buffer) {
+        buffer->record(phase, name, numArgs, arg0, arg1, arg2);
+    }
+}
+
+inline
+void EventTrace::setThreadBuffer(EventTraceBuffer *buffer)
+{
+    s_threadBuffer_p = buffer;
+}
+
+inline
+EventTraceBuffer *EventTrace::threadBuffer()
+{
+    return s_threadBuffer_p;
+}
+
+                           // ---------------------
+                           // class EventTraceScope
+                           // ---------------------
+
+// CREATORS
+inline
+EventTraceScope::EventTraceScope(const char *name)
+: d_name_p(name)
+{
+    EventTrace::record('B', d_name_p, 0, 0, 0, 0);
+}
+
+inline
+EventTraceScope::~EventTraceScope()
+{
+    EventTrace::record('E', d_name_p, 0, 0, 0, 0);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
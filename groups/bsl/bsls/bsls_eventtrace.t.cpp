@@ -0,0 +1,978 @@
+// bsls_eventtrace.t.cpp                                              -*-C++-*-
+
+#include <bsls_eventtrace.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+#include <string.h>     // strstr(), strncmp()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test records events into per-thread ring buffers, and
+// writes them as a JSON trace.  We first test a buffer directly: the fields
+// of recorded events, the wrap-around of the ring, the conditions under which
+// 'readEvent' rejects an event, and the registration of buffers.  We then test
+// that each macro records the expected event into the buffer installed for
+// the calling thread only, and that the trace written for several buffers is
+// well-formed and holds the expected events.  A concurrency test reads
+// events while they are being recorded, verifying that no accepted event is
+// torn.  A performance test (negative case) measures the cost of recording.
+//-----------------------------------------------------------------------------
+// EventTraceBuffer
+// [ 2] EventTraceBuffer(EventTraceEvent *, int capacity, const char *name);
+// [ 2] ~EventTraceBuffer();
+// [ 2] void record(char phase, const char *name, int numArgs, int...);
+// [ 2] int capacity() const;
+// [ 2] Types::Int64 numRecorded() const;
+// [ 2] bool readEvent(EventTraceEvent *result, Types::Int64 index) const;
+// [ 2] int threadId() const;
+// [ 2] const char *threadName() const;
+//
+// EventTrace
+// [ 3] static void record(char, const char *, int, int, int, int);
+// [ 3] static void setThreadBuffer(EventTraceBuffer *buffer);
+// [ 3] static EventTraceBuffer *threadBuffer();
+// [ 4] static int writeChromeTrace(FILE *stream);
+//
+// EventTraceScope
+// [ 3] explicit EventTraceScope(const char *name);
+// [ 3] ~EventTraceScope();
+//
+// MACROS
+// [ 3] BSLS_EVENTTRACE_BEGIN(NAME)
+// [ 3] BSLS_EVENTTRACE_END(NAME)
+// [ 3] BSLS_EVENTTRACE_SCOPE(NAME)
+// [ 3] BSLS_EVENTTRACE_INSTANT(NAME)
+// [ 3] BSLS_EVENTTRACE_INSTANT1(NAME, A0)
+// [ 3] BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1)
+// [ 3] BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2)
+// [ 3] BSLS_EVENTTRACE_COUNTER(NAME, VALUE)
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY: READING WHILE RECORDING
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: COST OF RECORDING
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::EventTraceBuffer Obj;
+typedef bsls::EventTraceEvent  Event;
+typedef bsls::EventTrace       Util;
+typedef bsls::Types::Int64     Int64;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static int readTrace(char *result, int size)
+    // Write the trace of all registered buffers to a temporary file, load
+    // its contents, null-terminated, into the specified 'result' of the
+    // specified 'size', and return the length of the contents, or -1 on
+    // error.
+{
+    FILE *file = tmpfile();
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != Util::writeChromeTrace(file)) {
+        fclose(file);
+        return -1;                                                    // RETURN
+    }
+    rewind(file);
+    const int length = static_cast<int>(fread(result, 1, size - 1, file));
+    result[length] = '\0';
+    fclose(file);
+    return length;
+}
+
+static bool isWellFormed(const char *json)
+    // Return 'true' if the brackets and braces of the specified 'json'
+    // outside of strings are balanced, and its strings are terminated, and
+    // 'false' otherwise.
+{
+    char stack[64];
+    int  depth    = 0;
+    bool inString = false;
+    for (const char *p = json; *p; ++p) {
+        if (inString) {
+            if ('\\' == *p) {
+                if (!p[1]) {
+                    return false;                                     // RETURN
+                }
+                ++p;
+            }
+            else if ('"' == *p) {
+                inString = false;
+            }
+        }
+        else if ('"' == *p) {
+            inString = true;
+        }
+        else if ('{' == *p || '[' == *p) {
+            if (64 == depth) {
+                return false;                                         // RETURN
+            }
+            stack[depth++] = '{' == *p ? '}' : ']';
+        }
+        else if ('}' == *p || ']' == *p) {
+            if (0 == depth || stack[--depth] != *p) {
+                return false;                                         // RETURN
+            }
+        }
+    }
+    return !inString && 0 == depth;
+}
+
+static int countOccurrences(const char *string, const char *pattern)
+    // Return the number of non-overlapping occurrences of the specified
+    // 'pattern' in the specified 'string'.
+{
+    const int length = static_cast<int>(strlen(pattern));
+    int       count  = 0;
+    for (const char *p = strstr(string, pattern); p; p = strstr(p, pattern)) {
+        ++count;
+        p += length;
+    }
+    return count;
+}
+
+                           // ===================
+                           // struct RecorderArgs
+                           // ===================
+
+struct RecorderArgs {
+    // This 'struct' describes the work of a recording thread: record
+    // 'd_numEvents' events into '*d_buffer_p', event 'i' having arguments
+    // 'i', '-i', and '~i', and then set '*d_done_p'.
+
+    Obj             *d_buffer_p;   // buffer to record into
+    int              d_numEvents;  // number of events to record
+    bsls::AtomicInt *d_done_p;     // set when done
+};
+
+extern "C" void *recorderThread(void *arg)
+{
+    RecorderArgs *args = static_cast<RecorderArgs *>(arg);
+
+    Util::setThreadBuffer(args->d_buffer_p);
+    for (int i = 0; i < args->d_numEvents; ++i) {
+        BSLS_EVENTTRACE_INSTANT3("event", i, -i, ~i);
+    }
+    Util::setThreadBuffer(0);
+
+    args->d_done_p->storeRelease(1);
+    return 0;
+}
+
+extern "C" void *installThread(void *arg)
+    // Install the buffer at the specified 'arg' for this thread, record an
+    // event, and uninstall it.
+{
+    ASSERT(0 == Util::threadBuffer());
+
+    Util::setThreadBuffer(static_cast<Obj *>(arg));
+    BSLS_EVENTTRACE_INSTANT("other thread");
+    Util::setThreadBuffer(0);
+    return 0;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Tracing the Phases of Request Processing
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server occasionally takes much longer than usual to process
+// a request, and that we wish to find out which phase of the processing is
+// responsible.
+//
+// First, we instrument the processing of a request, recording a duration for
+// the whole request, a duration for one of its phases, and an instantaneous
+// event, having the request's size as an argument, in between:
+//..
+int parseRequest(int requestId)
+{
+    BSLS_EVENTTRACE_SCOPE("parse");
+    return requestId % 7;
+}
+
+void processRequest(int requestId)
+{
+    BSLS_EVENTTRACE_SCOPE("request");
+
+    int size = parseRequest(requestId);
+    BSLS_EVENTTRACE_INSTANT2("parsed", requestId, size);
+
+    // ... process the request ...
+}
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, on each thread processing requests, we install a buffer for the
+// thread's events, here having storage for 1024 events:
+//..
+        static bsls::EventTraceEvent events[1024];
+        bsls::EventTraceBuffer       buffer(events, 1024, "worker");
+
+        bsls::EventTrace::setThreadBuffer(&buffer);
+//..
+// Next, we process some requests:
+//..
+        for (int i = 0; i < 3; ++i) {
+            processRequest(i);
+        }
+//..
+// Each request recorded five events:
+//..
+        ASSERT(15 == buffer.numRecorded());
+//..
+// Now, when a latency spike is detected, we write the recent events of every
+// thread to a file that can be loaded into Chrome or Perfetto:
+//..
+        FILE *file = tmpfile();
+        ASSERT(file);
+
+        int rc = bsls::EventTrace::writeChromeTrace(file);
+        ASSERT(0 == rc);
+
+        fclose(file);
+//..
+// Finally, before 'buffer' is destroyed, we uninstall it:
+//..
+        bsls::EventTrace::setThreadBuffer(0);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: READING WHILE RECORDING
+        //
+        // Concerns:
+        //: 1 An event accepted by 'readEvent' while the recording thread
+        //:   records into the same buffer is the event recorded at the
+        //:   requested index, with all of its fields.
+        //:
+        //: 2 'writeChromeTrace' can be called while threads record.
+        //
+        // Plan:
+        //: 1 Record events, event 'i' having arguments 'i', '-i', and '~i', on
+        //:   several threads into small buffers, while the main thread
+        //:   repeatedly reads the most recent 'capacity()' events of each
+        //:   buffer, and verify that every accepted event has consistent
+        //:   arguments whose first is its index.  Also verify that some
+        //:   events are accepted.  (C-1)
+        //:
+        //: 2 Periodically write a trace while the threads record, and verify
+        //:   that it is well-formed.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY: READING WHILE RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: READING WHILE RECORDING"
+                            "\n====================================\n");
+
+        enum { k_NUM_THREADS = 4, k_CAPACITY = 16 };
+
+        const int NUM_EVENTS = 2000000;
+
+        static Event     storage[k_NUM_THREADS][k_CAPACITY];
+        static char      trace[1 << 16];
+        bsls::AtomicInt  done[k_NUM_THREADS];
+        my_thread_t      handles[k_NUM_THREADS];
+        RecorderArgs     args[k_NUM_THREADS];
+        Obj             *buffers[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            buffers[i]           = new Obj(storage[i], k_CAPACITY);
+            args[i].d_buffer_p   = buffers[i];
+            args[i].d_numEvents  = NUM_EVENTS;
+            args[i].d_done_p     = &done[i];
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == myCreateThread(&handles[i],
+                                       &recorderThread,
+                                       &args[i]));
+        }
+
+        Int64 numAccepted = 0;
+        Int64 numRejected = 0;
+        int   numTraces   = 0;
+        bool  running     = true;
+        for (int iteration = 0; running; ++iteration) {
+            running = false;
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                if (!done[t].loadAcquire()) {
+                    running = true;
+                }
+                const Obj&  X   = *buffers[t];
+                const Int64 END = X.numRecorded();
+                for (Int64 index = END > k_CAPACITY ? END - k_CAPACITY : 0;
+                     index < END;
+                     ++index) {
+                    Event event;
+                    if (X.readEvent(&event, index)) {
+                        const int I = static_cast<int>(index);
+                        LOOP2_ASSERT(index, event.d_args[0],
+                                     I  == event.d_args[0]);
+                        LOOP2_ASSERT(index, event.d_args[1],
+                                     -I == event.d_args[1]);
+                        LOOP2_ASSERT(index, event.d_args[2],
+                                     ~I == event.d_args[2]);
+                        ASSERT(3   == event.d_numArgs);
+                        ASSERT('i' == event.d_phase);
+                        ++numAccepted;
+                    }
+                    else {
+                        ++numRejected;
+                    }
+                }
+            }
+            if (0 == iteration % 1024) {
+                ASSERT(0 < readTrace(trace, sizeof trace));
+                ASSERT(isWellFormed(trace));
+                ++numTraces;
+            }
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            myJoinThread(handles[i]);
+            ASSERT(NUM_EVENTS == buffers[i]->numRecorded());
+            delete buffers[i];
+        }
+
+        if (verbose) {
+            P_(numAccepted) P_(numRejected) P(numTraces)
+        }
+        ASSERT(0 < numAccepted);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'writeChromeTrace'
+        //
+        // Concerns:
+        //: 1 The trace is a well-formed JSON object whose 'traceEvents' array
+        //:   holds one object for each event held by each registered buffer
+        //:   (at most 'capacity() - 1' per buffer), and one metadata object
+        //:   for each buffer having a thread name.
+        //:
+        //: 2 Each event object has the event's name, phase, thread id, and
+        //:   arguments; instantaneous events are scoped to their thread, and
+        //:   counters have a 'value' argument.
+        //:
+        //: 3 Names are escaped as JSON strings.
+        //:
+        //: 4 Timestamps are in microseconds, with nanosecond precision.
+        //
+        // Plan:
+        //: 1 Record known events into two buffers, one of which has wrapped,
+        //:   write a trace, and search it for the expected text.  (C-1..4)
+        //
+        // Testing:
+        //   static int writeChromeTrace(FILE *stream);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'writeChromeTrace'"
+                            "\n==========================\n");
+
+        static char trace[1 << 16];
+
+        {
+            Event events1[8];
+            Event events2[4];
+            Obj   mX(events1, 8, "main \"thread\"");
+            Obj   mY(events2, 4);
+
+            mX.record('B', "outer", 0, 0, 0, 0);
+            mX.record('i', "tab\there", 2, 7, -8, 0);
+            mX.record('C', "depth", 1, 42, 0, 0);
+            mX.record('E', "outer", 0, 0, 0, 0);
+
+            for (int i = 0; i < 10; ++i) {
+                mY.record('i', "wrapped", 1, i, 0, 0);
+            }
+
+            const int LENGTH = readTrace(trace, sizeof trace);
+            ASSERT(0 < LENGTH);
+            if (veryVerbose) printf("%s", trace);
+
+            ASSERT(isWellFormed(trace));
+            ASSERT(0 == strncmp(trace, "{\"displayTimeUnit\":\"ns\","
+                                       "\"traceEvents\":[", 38));
+
+            ASSERT(1 == countOccurrences(trace, "\"ph\":\"M\""));
+            ASSERT(1 == countOccurrences(
+                             trace,
+                             "\"args\":{\"name\":\"main \\\"thread\\\"\"}"));
+
+            ASSERT(1 == countOccurrences(trace, "\"ph\":\"B\""));
+            ASSERT(1 == countOccurrences(trace, "\"ph\":\"E\""));
+            ASSERT(1 == countOccurrences(trace, "\"ph\":\"C\""));
+            ASSERT(2 == countOccurrences(trace, "\"name\":\"outer\""));
+            ASSERT(1 == countOccurrences(trace,
+                                         "\"name\":\"tab\\u0009here\""));
+            ASSERT(1 == countOccurrences(trace,
+                                         "\"args\":{\"arg0\":7,\"arg1\":-8}"));
+            ASSERT(1 == countOccurrences(trace, "\"args\":{\"value\":42}"));
+
+            // 'mY' holds 4 events, of which the oldest is not written.
+
+            ASSERT(3 == countOccurrences(trace, "\"name\":\"wrapped\""));
+            ASSERT(0 == countOccurrences(trace, "\"arg0\":6}"));
+            ASSERT(1 == countOccurrences(trace, "\"arg0\":7}"));
+            ASSERT(1 == countOccurrences(trace, "\"arg0\":9}"));
+            ASSERT(4 == countOccurrences(trace, "\"s\":\"t\""));
+
+            char withArgs[32];
+            char withoutArgs[32];
+            sprintf(withArgs,    "\"tid\":%d,", mY.threadId());
+            sprintf(withoutArgs, "\"tid\":%d}", mY.threadId());
+            ASSERT(3 == countOccurrences(trace, withArgs));
+            ASSERT(0 == countOccurrences(trace, withoutArgs));
+            sprintf(withArgs,    "\"tid\":%d,", mX.threadId());
+            sprintf(withoutArgs, "\"tid\":%d}", mX.threadId());
+            ASSERT(3 == countOccurrences(trace, withArgs));
+            ASSERT(2 == countOccurrences(trace, withoutArgs));
+
+            // Verify the timestamp of the first event of 'mX'.
+
+            Event event;
+            ASSERT(mX.readEvent(&event, 0));
+            const Int64 NS =
+                      bsls::TimeUtil::convertFastTimerRaw(event.d_timestamp);
+            char timestamp[64];
+            sprintf(timestamp,
+                    "\"ts\":%lld.%03d,",
+                    static_cast<long long>(NS / 1000),
+                    static_cast<int>(NS % 1000));
+            ASSERT(1 == countOccurrences(trace, timestamp));
+        }
+
+        if (veryVerbose) printf("\tNo buffers.\n");
+
+        ASSERT(0 < readTrace(trace, sizeof trace));
+        ASSERT(0 == strcmp(trace, "{\"displayTimeUnit\":\"ns\","
+                                  "\"traceEvents\":[\n\n]}\n"));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MACROS AND 'EventTraceScope'
+        //
+        // Concerns:
+        //: 1 Each macro records one event (two, for 'BSLS_EVENTTRACE_SCOPE')
+        //:   having the expected name, phase, and arguments, into the buffer
+        //:   installed for the calling thread.
+        //:
+        //: 2 No event is recorded if no buffer is installed.
+        //:
+        //: 3 The installed buffer is specific to the calling thread.
+        //:
+        //: 4 'EventTraceScope' records the end of its duration on
+        //:   destruction, and several scopes may be used in one block.
+        //
+        // Plan:
+        //: 1 Invoke each macro with and without an installed buffer, and
+        //:   verify the recorded events.  (C-1..2, 4)
+        //:
+        //: 2 Install a buffer on another thread, and verify that the buffer
+        //:   of this thread is unaffected.  (C-3)
+        //
+        // Testing:
+        //   static void record(char, const char *, int, int, int, int);
+        //   static void setThreadBuffer(EventTraceBuffer *buffer);
+        //   static EventTraceBuffer *threadBuffer();
+        //   explicit EventTraceScope(const char *name);
+        //   ~EventTraceScope();
+        //   BSLS_EVENTTRACE_BEGIN(NAME)
+        //   BSLS_EVENTTRACE_END(NAME)
+        //   BSLS_EVENTTRACE_SCOPE(NAME)
+        //   BSLS_EVENTTRACE_INSTANT(NAME)
+        //   BSLS_EVENTTRACE_INSTANT1(NAME, A0)
+        //   BSLS_EVENTTRACE_INSTANT2(NAME, A0, A1)
+        //   BSLS_EVENTTRACE_INSTANT3(NAME, A0, A1, A2)
+        //   BSLS_EVENTTRACE_COUNTER(NAME, VALUE)
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING MACROS AND 'EventTraceScope'"
+                            "\n====================================\n");
+
+        Event events[32];
+        Obj   mX(events, 32);  const Obj& X = mX;
+
+        if (veryVerbose) printf("\tNo buffer installed.\n");
+
+        ASSERT(0 == Util::threadBuffer());
+
+        BSLS_EVENTTRACE_INSTANT("ignored");
+        { BSLS_EVENTTRACE_SCOPE("ignored"); }
+        ASSERT(0 == X.numRecorded());
+
+        if (veryVerbose) printf("\tEach macro.\n");
+
+        Util::setThreadBuffer(&mX);
+        ASSERT(&mX == Util::threadBuffer());
+
+        BSLS_EVENTTRACE_BEGIN("b");
+        BSLS_EVENTTRACE_END("e");
+        BSLS_EVENTTRACE_INSTANT("i0");
+        BSLS_EVENTTRACE_INSTANT1("i1", 1);
+        BSLS_EVENTTRACE_INSTANT2("i2", 1, 2);
+        BSLS_EVENTTRACE_INSTANT3("i3", 1, 2, 3);
+        BSLS_EVENTTRACE_COUNTER("c", 99);
+        {
+            BSLS_EVENTTRACE_SCOPE("s1");
+            BSLS_EVENTTRACE_SCOPE("s2");
+            ASSERT(9 == X.numRecorded());
+        }
+        Util::record('X', "direct", 0, 0, 0, 0);
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_name_p;   // expected name
+            char        d_phase;    // expected phase
+            int         d_numArgs;  // expected number of arguments
+            int         d_args[3];  // expected arguments
+        } DATA[] = {
+            //LINE  NAME      PHASE  #ARGS  ARGS
+            //----  --------  -----  -----  -----------
+            { L_,   "b",      'B',   0,     { 0, 0, 0 } },
+            { L_,   "e",      'E',   0,     { 0, 0, 0 } },
+            { L_,   "i0",     'i',   0,     { 0, 0, 0 } },
+            { L_,   "i1",     'i',   1,     { 1, 0, 0 } },
+            { L_,   "i2",     'i',   2,     { 1, 2, 0 } },
+            { L_,   "i3",     'i',   3,     { 1, 2, 3 } },
+            { L_,   "c",      'C',   1,     { 99, 0, 0 } },
+            { L_,   "s1",     'B',   0,     { 0, 0, 0 } },
+            { L_,   "s2",     'B',   0,     { 0, 0, 0 } },
+            { L_,   "s2",     'E',   0,     { 0, 0, 0 } },
+            { L_,   "s1",     'E',   0,     { 0, 0, 0 } },
+            { L_,   "direct", 'X',   0,     { 0, 0, 0 } },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        ASSERT(NUM_DATA == X.numRecorded());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            Event event;
+            LOOP_ASSERT(LINE, X.readEvent(&event, ti));
+            LOOP_ASSERT(LINE, 0 == strcmp(DATA[ti].d_name_p, event.d_name_p));
+            LOOP_ASSERT(LINE, DATA[ti].d_phase   == event.d_phase);
+            LOOP_ASSERT(LINE, DATA[ti].d_numArgs == event.d_numArgs);
+            for (int j = 0; j < DATA[ti].d_numArgs; ++j) {
+                LOOP2_ASSERT(LINE, j, DATA[ti].d_args[j] == event.d_args[j]);
+            }
+        }
+
+        if (veryVerbose) printf("\tOther threads.\n");
+        {
+            Event       otherEvents[4];
+            Obj         mY(otherEvents, 4);
+            my_thread_t handle;
+
+            ASSERT(0 == myCreateThread(&handle, &installThread, &mY));
+            myJoinThread(handle);
+
+            ASSERT(1        == mY.numRecorded());
+            ASSERT(NUM_DATA == X.numRecorded());
+            ASSERT(&mX      == Util::threadBuffer());
+        }
+
+        Util::setThreadBuffer(0);
+        ASSERT(0 == Util::threadBuffer());
+
+        BSLS_EVENTTRACE_INSTANT("ignored");
+        ASSERT(NUM_DATA == X.numRecorded());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'EventTraceBuffer'
+        //
+        // Concerns:
+        //: 1 'record' stores the specified fields and a non-decreasing
+        //:   timestamp, and increments 'numRecorded'.
+        //:
+        //: 2 Once full, the buffer overwrites its oldest events, and
+        //:   'readEvent' rejects events no longer held, and the oldest event
+        //:   held (whose slot is written next).
+        //:
+        //: 3 Each buffer is assigned a distinct thread id, and has the thread
+        //:   name supplied at construction, if any.
+        //:
+        //: 4 The buffer records only into the storage supplied.
+        //
+        // Plan:
+        //: 1 Record events having distinct arguments into buffers of several
+        //:   capacities, and verify 'numRecorded', 'capacity', and the events
+        //:   returned by 'readEvent' after each.  (C-1..2)
+        //:
+        //: 2 Surround the storage of a buffer with guard events, and verify
+        //:   that they are unchanged.  (C-4)
+        //:
+        //: 3 Create several buffers, and verify 'threadId' and 'threadName'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   EventTraceBuffer(EventTraceEvent *, int, const char *threadName);
+        //   ~EventTraceBuffer();
+        //   void record(char phase, const char *name, int numArgs, int...);
+        //   int capacity() const;
+        //   Types::Int64 numRecorded() const;
+        //   bool readEvent(EventTraceEvent *result, Types::Int64 index) const;
+        //   int threadId() const;
+        //   const char *threadName() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'EventTraceBuffer'"
+                            "\n==========================\n");
+
+        if (veryVerbose) printf("\tRecording and wrap-around.\n");
+
+        for (int capacity = 1; capacity <= 16; capacity *= 2) {
+            if (veryVerbose) { T_ P(capacity) }
+
+            Event storage[18];
+            memset(storage, 0x5a, sizeof storage);
+
+            Obj mX(storage + 1, capacity);  const Obj& X = mX;
+            ASSERT(capacity == X.capacity());
+            ASSERT(0        == X.numRecorded());
+
+            Int64 previousTimestamp = 0;
+            for (int n = 0; n < 3 * capacity + 2; ++n) {
+                mX.record('i', "e", 3, n, 10 * n, 100 * n);
+                LOOP2_ASSERT(capacity, n, n + 1 == X.numRecorded());
+
+                for (int index = 0; index <= n; ++index) {
+                    Event      event;
+                    const bool HELD     = index + capacity > n + 1;
+                    const bool ACCEPTED = X.readEvent(&event, index);
+
+                    LOOP3_ASSERT(capacity, n, index, HELD == ACCEPTED);
+                    if (ACCEPTED) {
+                        LOOP3_ASSERT(capacity, n, index,
+                                     index       == event.d_args[0]
+                                  && 10 * index  == event.d_args[1]
+                                  && 100 * index == event.d_args[2]);
+                        LOOP3_ASSERT(capacity, n, index,
+                                     3 == event.d_numArgs
+                                  && 'i' == event.d_phase
+                                  && 0 == strcmp("e", event.d_name_p));
+                    }
+                }
+
+                Event event;
+                if (X.readEvent(&event, n)) {
+                    LOOP2_ASSERT(capacity, n,
+                                 previousTimestamp <= event.d_timestamp);
+                    previousTimestamp = event.d_timestamp;
+                }
+                else {
+                    // A buffer of capacity 1 holds no readable event.
+
+                    LOOP2_ASSERT(capacity, n, 1 == capacity);
+                }
+            }
+
+            const unsigned char *guard =
+                                  reinterpret_cast<unsigned char *>(storage);
+            const int SIZE = static_cast<int>(sizeof(Event));
+            for (int i = 0; i < SIZE; ++i) {
+                LOOP2_ASSERT(capacity, i, 0x5a == guard[i]);
+                LOOP2_ASSERT(capacity, i,
+                             0x5a == guard[(capacity + 1) * SIZE + i]);
+            }
+        }
+
+        if (veryVerbose) printf("\tThread ids and names.\n");
+        {
+            Event events[3][2];
+            Obj   mX(events[0], 2);
+            Obj   mY(events[1], 2, "y");
+            {
+                Obj mZ(events[2], 2, "z");
+
+                ASSERT(0 == mX.threadName());
+                ASSERT(0 == strcmp("y", mY.threadName()));
+                ASSERT(0 == strcmp("z", mZ.threadName()));
+
+                ASSERT(0 < mX.threadId());
+                ASSERT(mX.threadId() != mY.threadId());
+                ASSERT(mX.threadId() != mZ.threadId());
+                ASSERT(mY.threadId() != mZ.threadId());
+            }
+            Obj mW(events[2], 2);
+            ASSERT(mX.threadId() != mW.threadId());
+            ASSERT(mY.threadId() != mW.threadId());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Install a buffer, record events using the macros, read them
+        //:   back, and write a trace.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Event events[8];
+        Obj   mX(events, 8, "breathing");  const Obj& X = mX;
+
+        Util::setThreadBuffer(&mX);
+        {
+            BSLS_EVENTTRACE_SCOPE("scope");
+            BSLS_EVENTTRACE_INSTANT1("instant", 5);
+        }
+        Util::setThreadBuffer(0);
+
+        ASSERT(3 == X.numRecorded());
+
+        Event event;
+        ASSERT(X.readEvent(&event, 1));
+        ASSERT(0 == strcmp("instant", event.d_name_p));
+        ASSERT(5 == event.d_args[0]);
+
+        static char trace[4096];
+        ASSERT(0 < readTrace(trace, sizeof trace));
+        if (veryVerbose) printf("%s", trace);
+        ASSERT(isWellFormed(trace));
+        ASSERT(0 != strstr(trace, "\"name\":\"instant\""));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF RECORDING
+        //
+        // Concerns:
+        //: 1 Recording an event costs a few tens of nanoseconds at most.
+        //
+        // Plan:
+        //: 1 Time the recording of many events using each kind of macro, with
+        //:   and without an installed buffer, and compare with the cost of
+        //:   reading the fast timer alone.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COST OF RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COST OF RECORDING"
+                            "\n==============================\n");
+
+        const int NUM_EVENTS = 10000000;
+
+        static Event events[4096];
+        Obj          mX(events, 4096);
+
+        printf("fast timer is %sa cycle counter\n",
+               bsls::TimeUtil::isFastTimerCycleCounter() ? "" : "not ");
+
+        {
+            Int64       sum   = 0;
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                sum += bsls::TimeUtil::getFastTimerRaw();
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("getFastTimerRaw:        %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_EVENTS);
+            ASSERT(0 != sum);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                BSLS_EVENTTRACE_INSTANT1("uninstalled", i);
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("no buffer installed:    %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_EVENTS);
+        }
+
+        Util::setThreadBuffer(&mX);
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                BSLS_EVENTTRACE_INSTANT("instant");
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("INSTANT:                %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_EVENTS);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_EVENTS; ++i) {
+                BSLS_EVENTTRACE_INSTANT3("instant3", i, i + 1, i + 2);
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("INSTANT3:               %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_EVENTS);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_EVENTS / 2; ++i) {
+                BSLS_EVENTTRACE_SCOPE("scope");
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("SCOPE (per event):      %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_EVENTS);
+        }
+        Util::setThreadBuffer(0);
+
+        ASSERT(NUM_EVENTS * 3 - NUM_EVENTS % 2 == mX.numRecorded());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,161 @@
+// bsls_latencyhistogram.cpp                                          -*-C++-*-
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <string.h>  // memset()
+
+namespace BloombergLP {
+
+namespace bsls {
+
+namespace {
+
+const Types::Int64 k_INT64_MAX = static_cast<Types::Int64>(
+                                         ~static_cast<Types::Uint64>(0) >> 1);
+    // greatest value representable by 'Types::Int64'
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// CREATORS
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+// MANIPULATORS
+void LatencyHistogram::add(const LatencyHistogram& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_counts[i] += other.d_counts[i];
+    }
+    d_count += other.d_count;
+    d_sum   += other.d_sum;
+    if (other.d_min < d_min) {
+        d_min = other.d_min;
+    }
+    if (other.d_max > d_max) {
+        d_max = other.d_max;
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    memset(d_counts, 0, sizeof d_counts);
+    d_count = 0;
+    d_sum   = 0;
+    d_min   = k_INT64_MAX;
+    d_max   = 0;
+}
+
+// ACCESSORS
+Types::Int64 LatencyHistogram::percentile(double percent) const
+{
+    BSLS_ASSERT(0 <= percent);
+    BSLS_ASSERT(percent <= 100);
+
+    if (0 == d_count) {
+        return 0;                                                     // RETURN
+    }
+
+    // Find the 1-based rank of the requested value among the recorded values,
+    // i.e., 'ceil(percent / 100 * d_count)', clamped to '[1 .. d_count]'.
+
+    const double target = percent / 100 * static_cast<double>(d_count);
+    Types::Int64 rank   = static_cast<Types::Int64>(target);
+    if (rank < target) {
+        ++rank;
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > d_count) {
+        rank = d_count;
+    }
+
+    // Only the buckets between those holding 'd_min' and 'd_max' can be
+    // non-empty.
+
+    const int    last       = bucketIndex(d_max);
+    Types::Int64 cumulative = 0;
+    for (int i = bucketIndex(d_min); i < last; ++i) {
+        cumulative += d_counts[i];
+        if (cumulative >= rank) {
+            const Types::Int64 upper = bucketUpperBound(i);
+            return upper < d_max ? upper : d_max;                     // RETURN
+        }
+    }
+    return d_max;
+}
+
+int LatencyHistogram::print(FILE *stream) const
+{
+    BSLS_ASSERT(stream);
+
+    static const double PERCENTS[] = { 50, 90, 99, 99.9, 99.99, 100 };
+    const int NUM_PERCENTS = sizeof PERCENTS / sizeof *PERCENTS;
+
+    fprintf(stream,
+            "count=%lld min=%lld mean=%.3f max=%lld\n",
+            static_cast<long long>(d_count),
+            static_cast<long long>(min()),
+            mean(),
+            static_cast<long long>(d_max));
+
+    for (int i = 0; i < NUM_PERCENTS; ++i) {
+        fprintf(stream,
+                "%sp%g=%lld",
+                i ? " " : "",
+                PERCENTS[i],
+                static_cast<long long>(percentile(PERCENTS[i])));
+    }
+    fprintf(stream, "\n");
+
+    Types::Int64 cumulative = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (0 == d_counts[i]) {
+            continue;                                               // CONTINUE
+        }
+        cumulative += d_counts[i];
+        fprintf(stream,
+                "[%lld, %lld]: %lld (%.3f%%)\n",
+                static_cast<long long>(bucketLowerBound(i)),
+                static_cast<long long>(bucketUpperBound(i)),
+                static_cast<long long>(d_counts[i]),
+                100.0 * static_cast<double>(cumulative)
+                                               / static_cast<double>(d_count));
+    }
+
+    return ferror(stream) || fflush(stream) ? -1 : 0;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,509 @@
+// bsls_latencyhistogram.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLS_LATENCYHISTOGRAM
+#define INCLUDED_BSLS_LATENCYHISTOGRAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-memory log-linear histogram of latencies.
+//
+//@CLASSES:
+//  bsls::LatencyHistogram: log-linear histogram with percentile queries
+//  bsls::LatencyHistogramScope: records the duration of a scope
+//
+//@SEE_ALSO: bsls_stopwatch, bsls_timeutil
+//
+//@DESCRIPTION: This component provides a histogram, 'bsls::LatencyHistogram',
+// that records non-negative 64-bit values (typically latencies in
+// nanoseconds) in constant time and fixed memory, and answers percentile
+// queries (e.g., the 99th or 99.9th percentile latency) from the recorded
+// distribution.  Unlike 'bsls::Stopwatch', which accumulates a total, a
+// histogram retains the *shape* of the distribution, so that the rare slow
+// executions of an operation are not hidden by the many fast ones.
+//
+// The histogram is *log-linear* (in the manner of "HDR" histograms): values
+// less than '2 * k_SUB_BUCKET_COUNT' (64) each have a bucket of their own,
+// and each subsequent power-of-two range of values, '[2^n, 2^(n+1))', is
+// divided into 'k_SUB_BUCKET_COUNT' (32) buckets of equal width.  Every
+// recorded value is therefore represented with a relative error of at most
+// '1 / 32' (about 3%) of its magnitude, over the whole range of
+// 'bsls::Types::Int64', using 'k_NUM_BUCKETS' (1888) counters.  The bucket of
+// a value is computed from the position of its most significant bit (a single
+// "count leading zeros" instruction on most platforms), a shift, and an
+// addition -- no loops, branches on the value, or floating-point arithmetic --
+// so that 'record' costs a few nanoseconds.
+//
+// A 'bsls::LatencyHistogram' is *not* thread-safe: to measure an operation
+// executed by several threads, each thread records into a histogram of its
+// own, and the histograms are combined, using 'add', once the recording
+// threads have been synchronized with the combining thread (e.g., joined).
+// Histograms merge exactly: the merged histogram is identical to one that
+// recorded every value itself.
+//
+///Timing Scopes
+///-------------
+// 'bsls::LatencyHistogramScope' records, on destruction, the time elapsed
+// since its construction, measured in nanoseconds using the fast timer of
+// 'bsls::TimeUtil' (see 'getFastTimerRaw').  Alternatively, the raw values of
+// the fast timer taken at the start and end of an operation may be supplied to
+// 'recordInterval'.  In either case, the raw values are converted to
+// nanoseconds only when recorded.
+//
+///Percentiles
+///-----------
+// 'percentile(p)' returns the smallest value 'v' such that at least 'p'
+// percent of the recorded values are less than or equal to 'v', rounded up to
+// the highest value of the bucket holding 'v' (and then down to 'max()', if
+// less), so that the returned value is an upper bound on the requested
+// percentile that is exact for values less than 64, and otherwise within the
+// relative error described above.  'percentile(100)' returns 'max()'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Distribution of an Operation's Latency
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we suspect that an operation occasionally takes much longer
+// than usual, and that we wish to measure its 99th percentile latency.
+//
+// First, we define the operation, which here is usually fast, but slow on
+// every fiftieth call:
+//..
+//  int lookup(int key)
+//  {
+//      static volatile int table[64];
+//
+//      const int numIterations = 0 == key % 50 ? 100000 : 10;
+//      int       result        = 0;
+//      for (int i = 0; i < numIterations; ++i) {
+//          result += table[(key + i) % 64];
+//      }
+//      return result;
+//  }
+//..
+// Then, we create a histogram and time each call to the operation by
+// constructing a 'bsls::LatencyHistogramScope' around it:
+//..
+//  bsls::LatencyHistogram histogram;
+//
+//  int sum = 0;
+//  for (int key = 0; key < 1000; ++key) {
+//      bsls::LatencyHistogramScope scope(&histogram);
+//      sum += lookup(key);
+//  }
+//  assert(1000 == histogram.count());
+//..
+// Next, we observe that the median latency is much less than the 99th
+// percentile latency, which is dominated by the slow calls:
+//..
+//  assert(histogram.percentile(50) <  histogram.percentile(99));
+//  assert(histogram.percentile(99) <= histogram.max());
+//..
+// Finally, we write a summary of the distribution, and the count of each
+// non-empty bucket, to a file:
+//..
+//  FILE *file = tmpfile();
+//  assert(file);
+//
+//  int rc = histogram.print(file);
+//  assert(0 == rc);
+//
+//  fclose(file);
+//..
+// The file begins with a summary resembling the following, in which the
+// latencies are in nanoseconds:
+//..
+//  count=1000 min=31 mean=3223.031 max=197822
+//  p50=44 p90=52 p99=159743 p99.9=197822 p99.99=197822 p100=197822
+//  [31, 31]: 1 (0.100%)
+//  [32, 32]: 1 (0.200%)
+//..
+// followed by a line for each of the remaining non-empty buckets.
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEUTIL
+#include <bsls_timeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDIO
+#include <stdio.h>
+#define INCLUDED_STDIO
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    #ifndef INCLUDED_INTRIN
+    #include <intrin.h>
+    #define INCLUDED_INTRIN
+    #endif
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                           // ======================
+                           // class LatencyHistogram
+                           // ======================
+
+class LatencyHistogram {
+    // This class provides a histogram of non-negative 64-bit values, having
+    // log-linear buckets, that records a value in constant time and answers
+    // percentile queries.  See the component-level documentation for the
+    // layout of the buckets and the accuracy of the results.  This class is
+    // not thread-safe.
+
+  public:
+    // TYPES
+    enum {
+        k_SUB_BUCKET_BITS  = 5,                       // log2 of the number of
+                                                      // buckets per power of
+                                                      // two
+
+        k_SUB_BUCKET_COUNT = 1 << k_SUB_BUCKET_BITS,  // number of buckets per
+                                                      // power of two
+
+        k_NUM_BUCKETS      = (64 - k_SUB_BUCKET_BITS) * k_SUB_BUCKET_COUNT
+                                                      // number of buckets
+    };
+
+  private:
+    // DATA
+    Types::Int64 d_counts[k_NUM_BUCKETS];  // number of values recorded in
+                                           // each bucket
+
+    Types::Int64 d_count;                  // number of values recorded
+
+    Types::Int64 d_sum;                    // sum of values recorded
+
+    Types::Int64 d_min;                    // least value recorded, or the
+                                           // greatest 'Int64' if none
+
+    Types::Int64 d_max;                    // greatest value recorded, or 0
+                                           // if none
+
+    // PRIVATE CLASS METHODS
+    static int mostSignificantBit(Types::Uint64 value);
+        // Return the index of the most significant set bit of the specified
+        // 'value'.  The behavior is undefined unless '0 != value'.
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(Types::Int64 value);
+        // Return the index of the bucket holding the specified 'value'.  The
+        // behavior is undefined unless '0 <= value'.
+
+    static Types::Int64 bucketLowerBound(int index);
+        // Return the least value held by the bucket at the specified 'index'.
+        // The behavior is undefined unless '0 <= index < k_NUM_BUCKETS'.
+
+    static Types::Int64 bucketUpperBound(int index);
+        // Return the greatest value held by the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    LatencyHistogram();
+        // Create an empty histogram.
+
+    // ~LatencyHistogram() = default;
+        // Destroy this histogram.
+
+    // MANIPULATORS
+    void add(const LatencyHistogram& other);
+        // Add the values recorded by the specified 'other' histogram to this
+        // histogram, as if each had been recorded by this histogram.  Note
+        // that 'other' may be this histogram.
+
+    void record(Types::Int64 value);
+        // Record the specified 'value' in this histogram.  The behavior is
+        // undefined unless '0 <= value'.
+
+    void recordInterval(Types::Int64 startRaw, Types::Int64 endRaw);
+        // Record in this histogram the number of nanoseconds between the
+        // specified 'startRaw' and 'endRaw' values returned by
+        // 'TimeUtil::getFastTimerRaw', or 0 if 'endRaw' precedes 'startRaw'.
+
+    void reset();
+        // Remove all values recorded by this histogram.
+
+    // ACCESSORS
+    Types::Int64 count() const;
+        // Return the number of values recorded by this histogram.
+
+    Types::Int64 countInBucket(int index) const;
+        // Return the number of values recorded by this histogram in the
+        // bucket at the specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    Types::Int64 max() const;
+        // Return the greatest value recorded by this histogram, or 0 if no
+        // values have been recorded.
+
+    double mean() const;
+        // Return the arithmetic mean of the values recorded by this
+        // histogram, or 0 if no values have been recorded.  Note that the
+        // mean is computed from the exact values recorded.
+
+    Types::Int64 min() const;
+        // Return the least value recorded by this histogram, or 0 if no
+        // values have been recorded.
+
+    Types::Int64 percentile(double percent) const;
+        // Return an upper bound on the specified 'percent' percentile of the
+        // values recorded by this histogram, i.e., the greatest value of the
+        // bucket holding the least recorded value that is greater than or
+        // equal to 'percent' percent of the recorded values, or 'max()' if
+        // less; return 0 if no values have been recorded.  The behavior is
+        // undefined unless '0 <= percent <= 100'.
+
+    int print(FILE *stream) const;
+        // Write to the specified 'stream' a line summarizing the values
+        // recorded by this histogram (count, minimum, mean, and maximum), a
+        // line of selected percentiles, and a line for each non-empty bucket
+        // giving its bounds, its count, and the cumulative percentage of
+        // values recorded in it and in lesser buckets.  Return 0 on success,
+        // and a non-zero value if an error occurred writing to 'stream'.
+
+    Types::Int64 sum() const;
+        // Return the sum of the values recorded by this histogram.  The
+        // behavior is undefined if the sum is not representable by
+        // 'Types::Int64'.
+};
+
+                        // ===========================
+                        // class LatencyHistogramScope
+                        // ===========================
+
+class LatencyHistogramScope {
+    // This class implements a guard that records, in a histogram supplied at
+    // construction, the number of nanoseconds elapsed between the
+    // construction and the destruction of the guard, measured using the fast
+    // timer of 'TimeUtil'.
+
+    // DATA
+    LatencyHistogram *d_histogram_p;  // histogram to record into (held, not
+                                      // owned)
+
+    Types::Int64      d_startRaw;     // raw fast timer value at construction
+
+  private:
+    // NOT IMPLEMENTED
+    LatencyHistogramScope(const LatencyHistogramScope&);
+    LatencyHistogramScope& operator=(const LatencyHistogramScope&);
+
+  public:
+    // CREATORS
+    explicit LatencyHistogramScope(LatencyHistogram *histogram);
+        // Create a guard that records into the specified 'histogram' the
+        // time elapsed until its destruction.
+
+    ~LatencyHistogramScope();
+        // Record the number of nanoseconds elapsed since the construction of
+        // this guard in the histogram supplied at construction, and destroy
+        // this guard.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class LatencyHistogram
+                           // ----------------------
+
+// PRIVATE CLASS METHODS
+inline
+int LatencyHistogram::mostSignificantBit(Types::Uint64 value)
+{
+#if defined(BSLS_PLATFORM_CMP_GNU)
+    return 63 - __builtin_clzll(value);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#else
+    int result = 0;
+    for (int shift = 32; 0 < shift; shift >>= 1) {
+        if (value >> shift) {
+            value  >>= shift;
+            result  += shift;
+        }
+    }
+    return result;
+#endif
+}
+
+// CLASS METHODS
+inline
+int LatencyHistogram::bucketIndex(Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    // Setting the bit at 'k_SUB_BUCKET_BITS' makes values less than
+    // 'k_SUB_BUCKET_COUNT' share the (zero) shift of the first power-of-two
+    // range, in which each value has a bucket of its own.
+
+    const Types::Uint64 bits  = static_cast<Types::Uint64>(value);
+    const int           shift = mostSignificantBit(bits | k_SUB_BUCKET_COUNT)
+                              - k_SUB_BUCKET_BITS;
+
+    return (shift << k_SUB_BUCKET_BITS) + static_cast<int>(bits >> shift);
+}
+
+inline
+Types::Int64 LatencyHistogram::bucketLowerBound(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    if (index < k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+    return static_cast<Types::Int64>(index - (shift << k_SUB_BUCKET_BITS))
+                                                                     << shift;
+}
+
+inline
+Types::Int64 LatencyHistogram::bucketUpperBound(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    if (index < k_SUB_BUCKET_COUNT) {
+        return index;                                                 // RETURN
+    }
+
+    const int shift = (index >> k_SUB_BUCKET_BITS) - 1;
+    return bucketLowerBound(index)
+         + ((static_cast<Types::Int64>(1) << shift) - 1);
+}
+
+// MANIPULATORS
+inline
+void LatencyHistogram::record(Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(0 <= value);
+
+    ++d_counts[bucketIndex(value)];
+    ++d_count;
+    d_sum += value;
+    if (value < d_min) {
+        d_min = value;
+    }
+    if (value > d_max) {
+        d_max = value;
+    }
+}
+
+inline
+void LatencyHistogram::recordInterval(Types::Int64 startRaw,
+                                      Types::Int64 endRaw)
+{
+    const Types::Int64 elapsed = TimeUtil::convertFastTimerRaw(endRaw)
+                               - TimeUtil::convertFastTimerRaw(startRaw);
+    record(elapsed < 0 ? 0 : elapsed);
+}
+
+// ACCESSORS
+inline
+Types::Int64 LatencyHistogram::count() const
+{
+    return d_count;
+}
+
+inline
+Types::Int64 LatencyHistogram::countInBucket(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    return d_counts[index];
+}
+
+inline
+Types::Int64 LatencyHistogram::max() const
+{
+    return d_max;
+}
+
+inline
+double LatencyHistogram::mean() const
+{
+    return d_count ? static_cast<double>(d_sum) / static_cast<double>(d_count)
+                   : 0.0;
+}
+
+inline
+Types::Int64 LatencyHistogram::min() const
+{
+    return d_count ? d_min : 0;
+}
+
+inline
+Types::Int64 LatencyHistogram::sum() const
+{
+    return d_sum;
+}
+
+                        // ---------------------------
+                        // class LatencyHistogramScope
+                        // ---------------------------
+
+// CREATORS
+inline
+LatencyHistogramScope::LatencyHistogramScope(LatencyHistogram *histogram)
+: d_histogram_p(histogram)
+, d_startRaw(TimeUtil::getFastTimerRaw())
+{
+    BSLS_ASSERT_SAFE(histogram);
+}
+
+inline
+LatencyHistogramScope::~LatencyHistogramScope()
+{
+    d_histogram_p->recordInterval(d_startRaw, TimeUtil::getFastTimerRaw());
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
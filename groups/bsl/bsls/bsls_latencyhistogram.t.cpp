@@ -0,0 +1,998 @@
+// bsls_latencyhistogram.t.cpp                                        -*-C++-*-
+
+#include <bsls_latencyhistogram.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi(), qsort()
+#include <string.h>     // strstr(), strncmp()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a histogram whose bucket layout is computed by
+// class methods.  We first verify the layout over every bucket: that buckets
+// are contiguous, that each value maps to the bucket whose bounds contain it,
+// and that the width of each bucket is within the documented relative error.
+// We then verify recording and the basic accessors, merging, and percentile
+// queries (against percentiles computed from the sorted recorded values), the
+// timing of intervals and scopes, and the printed representation.  A
+// performance test (negative case) measures the cost of recording.
+//-----------------------------------------------------------------------------
+// LatencyHistogram
+// [ 2] static int bucketIndex(Types::Int64 value);
+// [ 2] static Types::Int64 bucketLowerBound(int index);
+// [ 2] static Types::Int64 bucketUpperBound(int index);
+// [ 3] LatencyHistogram();
+// [ 3] ~LatencyHistogram();
+// [ 4] void add(const LatencyHistogram& other);
+// [ 3] void record(Types::Int64 value);
+// [ 6] void recordInterval(Types::Int64 startRaw, Types::Int64 endRaw);
+// [ 3] void reset();
+// [ 3] Types::Int64 count() const;
+// [ 3] Types::Int64 countInBucket(int index) const;
+// [ 3] Types::Int64 max() const;
+// [ 3] double mean() const;
+// [ 3] Types::Int64 min() const;
+// [ 5] Types::Int64 percentile(double percent) const;
+// [ 7] int print(FILE *stream) const;
+// [ 3] Types::Int64 sum() const;
+//
+// LatencyHistogramScope
+// [ 6] explicit LatencyHistogramScope(LatencyHistogram *histogram);
+// [ 6] ~LatencyHistogramScope();
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE: COST OF RECORDING
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::LatencyHistogram      Obj;
+typedef bsls::LatencyHistogramScope Scope;
+typedef bsls::Types::Int64          Int64;
+typedef bsls::Types::Uint64         Uint64;
+
+const Int64 INT64_MAX_VALUE = static_cast<Int64>(~static_cast<Uint64>(0) >> 1);
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+static Int64 nextRandom(Uint64 *state)
+    // Advance the specified linear congruential generator 'state', and return
+    // a pseudo-random non-negative value whose magnitude is itself randomly
+    // distributed over the range of 'Int64' (so that small values are as
+    // likely as large ones).
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const int bits = static_cast<int>(*state >> 58);  // '[0 .. 63]'
+    const Uint64 value = (*state >> 1) >> (63 - (bits ? bits : 1));
+    return static_cast<Int64>(value);
+}
+
+extern "C" int compareInt64(const void *lhs, const void *rhs)
+    // Return a negative value, 0, or a positive value if the 'Int64' at the
+    // specified 'lhs' is less than, equal to, or greater than that at the
+    // specified 'rhs', respectively.
+{
+    const Int64 a = *static_cast<const Int64 *>(lhs);
+    const Int64 b = *static_cast<const Int64 *>(rhs);
+    return a < b ? -1 : b < a ? 1 : 0;
+}
+
+static int readPrinted(char *result, int size, const Obj& histogram)
+    // Print the specified 'histogram' to a temporary file, load its contents,
+    // null-terminated, into the specified 'result' of the specified 'size',
+    // and return the length of the contents, or -1 on error.
+{
+    FILE *file = tmpfile();
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != histogram.print(file)) {
+        fclose(file);
+        return -1;                                                    // RETURN
+    }
+    rewind(file);
+    const int length = static_cast<int>(fread(result, 1, size - 1, file));
+    result[length] = '\0';
+    fclose(file);
+    return length;
+}
+
+static void spin(int numIterations)
+    // Execute a loop of the specified 'numIterations' that the compiler cannot
+    // remove.
+{
+    static volatile int sink;
+    for (int i = 0; i < numIterations; ++i) {
+        sink = sink + i;
+    }
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Measuring the Distribution of an Operation's Latency
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we suspect that an operation occasionally takes much longer
+// than usual, and that we wish to measure its 99th percentile latency.
+//
+// First, we define the operation, which here is usually fast, but slow on
+// every fiftieth call:
+//..
+int lookup(int key)
+{
+    static volatile int table[64];
+
+    const int numIterations = 0 == key % 50 ? 100000 : 10;
+    int       result        = 0;
+    for (int i = 0; i < numIterations; ++i) {
+        result += table[(key + i) % 64];
+    }
+    return result;
+}
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a histogram and time each call to the operation by
+// constructing a 'bsls::LatencyHistogramScope' around it:
+//..
+        bsls::LatencyHistogram histogram;
+
+        int sum = 0;
+        for (int key = 0; key < 1000; ++key) {
+            bsls::LatencyHistogramScope scope(&histogram);
+            sum += lookup(key);
+        }
+        ASSERT(1000 == histogram.count());
+//..
+// Next, we observe that the median latency is much less than the 99th
+// percentile latency, which is dominated by the slow calls:
+//..
+        ASSERT(histogram.percentile(50) <  histogram.percentile(99));
+        ASSERT(histogram.percentile(99) <= histogram.max());
+//..
+// Finally, we write a summary of the distribution, and the count of each
+// non-empty bucket, to a file:
+//..
+        FILE *file = tmpfile();
+        ASSERT(file);
+
+        int rc = histogram.print(file);
+        ASSERT(0 == rc);
+
+        fclose(file);
+//..
+        if (verbose) {
+            histogram.print(stdout);
+        }
+        (void)sum;
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'print'
+        //
+        // Concerns:
+        //: 1 The first line summarizes the count, minimum, mean, and maximum.
+        //:
+        //: 2 The second line gives the 50th, 90th, 99th, 99.9th, 99.99th, and
+        //:   100th percentiles.
+        //:
+        //: 3 Each non-empty bucket, and only those, is printed, in order, with
+        //:   its bounds, count, and cumulative percentage.
+        //:
+        //: 4 An empty histogram prints zeros.
+        //:
+        //: 5 'print' returns 0 on success.
+        //
+        // Plan:
+        //: 1 Print histograms having known contents, and compare with the
+        //:   expected text.  (C-1..5)
+        //
+        // Testing:
+        //   int print(FILE *stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'print'"
+                            "\n===============\n");
+
+        char buffer[4096];
+
+        if (veryVerbose) printf("\tEmpty histogram.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 < readPrinted(buffer, sizeof buffer, X));
+            if (veryVerbose) printf("%s", buffer);
+            ASSERT(0 == strcmp(buffer,
+                               "count=0 min=0 mean=0.000 max=0\n"
+                               "p50=0 p90=0 p99=0 p99.9=0 p99.99=0 p100=0\n"));
+        }
+
+        if (veryVerbose) printf("\tNon-empty histogram.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < 6; ++i) {
+                mX.record(3);
+            }
+            mX.record(5);
+            mX.record(5);
+            mX.record(100);
+            mX.record(103);
+
+            ASSERT(0 < readPrinted(buffer, sizeof buffer, X));
+            if (veryVerbose) printf("%s", buffer);
+            ASSERT(0 == strcmp(buffer,
+                               "count=10 min=3 mean=23.100 max=103\n"
+                               "p50=3 p90=101 p99=103 p99.9=103 p99.99=103"
+                                                                 " p100=103\n"
+                               "[3, 3]: 6 (60.000%)\n"
+                               "[5, 5]: 2 (80.000%)\n"
+                               "[100, 101]: 1 (90.000%)\n"
+                               "[102, 103]: 1 (100.000%)\n"));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'recordInterval' AND 'LatencyHistogramScope'
+        //
+        // Concerns:
+        //: 1 'recordInterval' records the number of nanoseconds between two
+        //:   raw fast timer values.
+        //:
+        //: 2 'recordInterval' records 0 if the end precedes the start.
+        //:
+        //: 3 A 'LatencyHistogramScope' records, on destruction, one value: the
+        //:   time elapsed since its construction.
+        //
+        // Plan:
+        //: 1 Record intervals between raw fast timer values taken around
+        //:   loops, and verify that the recorded values are bounded by
+        //:   intervals measured by 'getFastTimer' around the raw values.
+        //:   (C-1)
+        //:
+        //: 2 Record an interval whose end precedes its start.  (C-2)
+        //:
+        //: 3 Time loops using a scope, and verify the recorded values as in
+        //:   P-1.  (C-3)
+        //
+        // Testing:
+        //   void recordInterval(Types::Int64 startRaw, Types::Int64 endRaw);
+        //   explicit LatencyHistogramScope(LatencyHistogram *histogram);
+        //   ~LatencyHistogramScope();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'recordInterval' AND "
+                            "'LatencyHistogramScope'"
+                            "\n============================="
+                            "=======================\n");
+
+        bsls::TimeUtil::initializeFastTimer();
+
+        if (veryVerbose) printf("\t'recordInterval'.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                const Int64 outerStart = bsls::TimeUtil::getFastTimer();
+                const Int64 startRaw   = bsls::TimeUtil::getFastTimerRaw();
+                spin(i * 1000);
+                const Int64 endRaw     = bsls::TimeUtil::getFastTimerRaw();
+                const Int64 outerEnd   = bsls::TimeUtil::getFastTimer();
+
+                mX.recordInterval(startRaw, endRaw);
+
+                const Int64 EXPECTED = bsls::TimeUtil::convertFastTimerRaw(
+                                                                      endRaw)
+                                     - bsls::TimeUtil::convertFastTimerRaw(
+                                                                    startRaw);
+
+                LOOP_ASSERT(i, 1        == X.count());
+                LOOP_ASSERT(i, 0        <= EXPECTED);
+                LOOP_ASSERT(i, EXPECTED <= outerEnd - outerStart);
+                LOOP_ASSERT(i, 1 == X.countInBucket(Obj::bucketIndex(
+                                                                  EXPECTED)));
+                mX.reset();
+            }
+
+            mX.recordInterval(100, 50);
+            ASSERT(1 == X.count());
+            ASSERT(0 == X.max());
+        }
+
+        if (veryVerbose) printf("\t'LatencyHistogramScope'.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            Int64 totalElapsed = 0;
+            for (int i = 0; i < 10; ++i) {
+                const Int64 start = bsls::TimeUtil::getFastTimer();
+                {
+                    Scope scope(&mX);
+                    spin(i * 1000);
+                    LOOP_ASSERT(i, i == X.count());
+                }
+                totalElapsed += bsls::TimeUtil::getFastTimer() - start;
+                LOOP_ASSERT(i, i + 1 == X.count());
+            }
+            ASSERT(X.sum() <= totalElapsed);
+            ASSERT(X.max() <= totalElapsed);
+            ASSERT(0       <  X.max());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentile'
+        //
+        // Concerns:
+        //: 1 'percentile(p)' returns the upper bound of the bucket holding the
+        //:   value of rank 'ceil(p / 100 * count())' among the recorded
+        //:   values, or 'max()' if less.
+        //:
+        //: 2 'percentile(0)' reflects the least value, and 'percentile(100)'
+        //:   returns 'max()'.
+        //:
+        //: 3 'percentile' returns 0 for an empty histogram.
+        //:
+        //: 4 The result is within the documented relative error of the exact
+        //:   percentile.
+        //
+        // Plan:
+        //: 1 Using a table of known distributions and percentiles, verify the
+        //:   result of 'percentile'.  (C-1..3)
+        //:
+        //: 2 Record sets of pseudo-random values, sort a copy of each, and
+        //:   compare the result of 'percentile', for many percents, with the
+        //:   value computed from the sorted values.  (C-1, 4)
+        //
+        // Testing:
+        //   Types::Int64 percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'percentile'"
+                            "\n====================\n");
+
+        if (veryVerbose) printf("\tEmpty histogram.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.percentile(0));
+            ASSERT(0 == X.percentile(50));
+            ASSERT(0 == X.percentile(100));
+        }
+
+        if (veryVerbose) printf("\tTable of distributions.\n");
+        {
+            static const struct {
+                int    d_line;         // source line number
+                int    d_numValues;    // number of values, '1 .. numValues'
+                int    d_scale;        // multiplier of each value
+                double d_percent;      // requested percentile
+                Int64  d_expected;     // expected result
+            } DATA[] = {
+                //LINE  NUM    SCALE  PERCENT  EXPECTED
+                //----  -----  -----  -------  --------
+                { L_,       1,     1,       0,        1 },
+                { L_,       1,     1,      50,        1 },
+                { L_,       1,     1,     100,        1 },
+                { L_,      10,     1,       0,        1 },
+                { L_,      10,     1,      10,        1 },
+                { L_,      10,     1,      11,        2 },
+                { L_,      10,     1,      50,        5 },
+                { L_,      10,     1,      90,        9 },
+                { L_,      10,     1,   90.01,       10 },
+                { L_,      10,     1,     100,       10 },
+                { L_,     100,     1,      99,       99 },
+                { L_,     100,     1,    99.9,      100 },
+                { L_,    1000,     1,      50,      503 },
+                { L_,    1000,     1,      99,      991 },
+                { L_,    1000,     1,     100,     1000 },
+                { L_,     100,  1000,       0,     1007 },
+                { L_,     100,  1000,      50,    50175 },
+                { L_,     100,  1000,     100,   100000 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE     = DATA[ti].d_line;
+                const int    NUM      = DATA[ti].d_numValues;
+                const int    SCALE    = DATA[ti].d_scale;
+                const double PERCENT  = DATA[ti].d_percent;
+                const Int64  EXPECTED = DATA[ti].d_expected;
+
+                Obj mX;  const Obj& X = mX;
+
+                // Record the values in reverse order to verify that the order
+                // of recording is immaterial.
+
+                for (int i = NUM; 0 < i; --i) {
+                    mX.record(static_cast<Int64>(i) * SCALE);
+                }
+
+                const Int64 RESULT = X.percentile(PERCENT);
+                if (veryVerbose) { T_ P_(LINE) P_(PERCENT) P(RESULT) }
+                LOOP3_ASSERT(LINE, EXPECTED, RESULT, EXPECTED == RESULT);
+            }
+        }
+
+        if (veryVerbose) printf("\tPseudo-random values.\n");
+        {
+            enum { k_MAX_VALUES = 2000 };
+
+            static Int64 values[k_MAX_VALUES];
+            Uint64       state = 12345;
+
+            for (int numValues = 1;
+                 numValues <= k_MAX_VALUES;
+                 numValues *= 3) {
+                if (veryVerbose) { T_ P(numValues) }
+
+                Obj mX;  const Obj& X = mX;
+
+                for (int i = 0; i < numValues; ++i) {
+                    values[i] = nextRandom(&state);
+                    mX.record(values[i]);
+                }
+                qsort(values, numValues, sizeof *values, &compareInt64);
+
+                for (int p = 0; p <= 1000; ++p) {
+                    const double PERCENT = p / 10.0;
+
+                    Int64 rank = 0;
+                    while (rank * 1000 < static_cast<Int64>(p) * numValues) {
+                        ++rank;
+                    }
+                    if (0 == rank) {
+                        rank = 1;
+                    }
+
+                    const Int64 EXACT = values[rank - 1];
+                    const Int64 UPPER = Obj::bucketUpperBound(
+                                                     Obj::bucketIndex(EXACT));
+                    const Int64 EXPECTED = UPPER < X.max() ? UPPER : X.max();
+                    const Int64 RESULT   = X.percentile(PERCENT);
+
+                    LOOP3_ASSERT(numValues, p, RESULT, EXPECTED == RESULT);
+                    LOOP3_ASSERT(numValues, p, RESULT, EXACT    <= RESULT);
+                    LOOP3_ASSERT(numValues, p, RESULT,
+                                 RESULT - EXACT <= EXACT / 32);
+                }
+                ASSERT(values[numValues - 1] == X.percentile(100));
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'add'
+        //
+        // Concerns:
+        //: 1 Adding a histogram to another yields the histogram that would
+        //:   have recorded the values of both.
+        //:
+        //: 2 The added histogram is unchanged.
+        //:
+        //: 3 Adding an empty histogram, or adding to an empty histogram,
+        //:   works as expected.
+        //:
+        //: 4 A histogram can be added to itself.
+        //
+        // Plan:
+        //: 1 Record pseudo-random values alternately into two histograms and
+        //:   into a third, add the first two, and compare the result with the
+        //:   third, bucket by bucket.  (C-1..2)
+        //:
+        //: 2 Add empty histograms to non-empty ones, and vice versa.  (C-3)
+        //:
+        //: 3 Add a histogram to itself, and verify that every count doubles.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void add(const LatencyHistogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'add'"
+                            "\n=============\n");
+
+        Obj mA;  const Obj& A = mA;
+        Obj mB;  const Obj& B = mB;
+        Obj mC;  const Obj& C = mC;
+
+        Uint64 state = 54321;
+        for (int i = 0; i < 5000; ++i) {
+            const Int64 VALUE = nextRandom(&state) >> 8;
+            if (i % 3) {
+                mA.record(VALUE);
+            }
+            else {
+                mB.record(VALUE);
+            }
+            mC.record(VALUE);
+        }
+        const Int64 B_COUNT = B.count();
+
+        mA.add(B);
+
+        ASSERT(C.count() == A.count());
+        ASSERT(C.sum()   == A.sum());
+        ASSERT(C.min()   == A.min());
+        ASSERT(C.max()   == A.max());
+        ASSERT(B_COUNT   == B.count());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            LOOP_ASSERT(i, C.countInBucket(i) == A.countInBucket(i));
+        }
+
+        if (veryVerbose) printf("\tEmpty histograms.\n");
+        {
+            Obj mE;  const Obj& E = mE;
+
+            mA.add(E);
+            ASSERT(C.count() == A.count());
+            ASSERT(C.min()   == A.min());
+            ASSERT(C.max()   == A.max());
+
+            mE.add(C);
+            ASSERT(C.count() == E.count());
+            ASSERT(C.sum()   == E.sum());
+            ASSERT(C.min()   == E.min());
+            ASSERT(C.max()   == E.max());
+        }
+
+        if (veryVerbose) printf("\tSelf-addition.\n");
+
+        mA.add(A);
+
+        ASSERT(2 * C.count() == A.count());
+        ASSERT(2 * C.sum()   == A.sum());
+        ASSERT(C.min()       == A.min());
+        ASSERT(C.max()       == A.max());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            LOOP_ASSERT(i, 2 * C.countInBucket(i) == A.countInBucket(i));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'record', 'reset', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed histogram is empty: its count, sum, mean,
+        //:   minimum, maximum, and the count of each bucket are 0.
+        //:
+        //: 2 'record' increments the count of the bucket holding the value,
+        //:   and of no other, and updates the count, sum, mean, minimum, and
+        //:   maximum.
+        //:
+        //: 3 The extreme values 0 and the greatest 'Int64' can be recorded.
+        //:
+        //: 4 'reset' restores the default-constructed state.
+        //
+        // Plan:
+        //: 1 Verify the state of a default-constructed histogram.  (C-1)
+        //:
+        //: 2 Record a sequence of values from a table, verifying the state of
+        //:   the histogram after each.  (C-2..3)
+        //:
+        //: 3 Reset the histogram, and repeat P-1 and P-2.  (C-4)
+        //
+        // Testing:
+        //   LatencyHistogram();
+        //   ~LatencyHistogram();
+        //   void record(Types::Int64 value);
+        //   void reset();
+        //   Types::Int64 count() const;
+        //   Types::Int64 countInBucket(int index) const;
+        //   Types::Int64 max() const;
+        //   double mean() const;
+        //   Types::Int64 min() const;
+        //   Types::Int64 sum() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'record', 'reset', AND BASIC ACCESSORS"
+                            "\n=============================================="
+                            "\n");
+
+        static const struct {
+            int   d_line;   // source line number
+            Int64 d_value;  // value to record
+            Int64 d_min;    // expected minimum after recording
+            Int64 d_max;    // expected maximum after recording
+        } DATA[] = {
+            //LINE  VALUE           MIN    MAX
+            //----  --------------  -----  --------------
+            { L_,         1000,     1000,        1000 },
+            { L_,         1001,     1000,        1001 },
+            { L_,           10,       10,        1001 },
+            { L_,           10,       10,        1001 },
+            { L_,      1000000,       10,     1000000 },
+            { L_,            0,        0,     1000000 },
+            { L_,          999,        0,     1000000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj mX;  const Obj& X = mX;
+
+        for (int iteration = 0; iteration < 2; ++iteration) {
+            if (veryVerbose) { T_ P(iteration) }
+
+            ASSERT(0   == X.count());
+            ASSERT(0   == X.sum());
+            ASSERT(0.0 == X.mean());
+            ASSERT(0   == X.min());
+            ASSERT(0   == X.max());
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                LOOP_ASSERT(i, 0 == X.countInBucket(i));
+            }
+
+            Int64 sum = 0;
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE  = DATA[ti].d_line;
+                const Int64 VALUE = DATA[ti].d_value;
+                const int   INDEX = Obj::bucketIndex(VALUE);
+
+                const Int64 BUCKET_COUNT = X.countInBucket(INDEX);
+
+                mX.record(VALUE);
+                sum += VALUE;
+
+                LOOP_ASSERT(LINE, ti + 1 == X.count());
+                LOOP_ASSERT(LINE, sum    == X.sum());
+                LOOP_ASSERT(LINE, static_cast<double>(sum) / (ti + 1)
+                                                                == X.mean());
+                LOOP_ASSERT(LINE, DATA[ti].d_min == X.min());
+                LOOP_ASSERT(LINE, DATA[ti].d_max == X.max());
+                LOOP_ASSERT(LINE, BUCKET_COUNT + 1 == X.countInBucket(INDEX));
+            }
+
+            Int64 total = 0;
+            for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+                total += X.countInBucket(i);
+            }
+            ASSERT(NUM_DATA == total);
+            ASSERT(2        == X.countInBucket(Obj::bucketIndex(10)));
+
+            mX.reset();
+        }
+
+        if (veryVerbose) printf("\tExtreme values.\n");
+
+        mX.record(INT64_MAX_VALUE);
+        ASSERT(INT64_MAX_VALUE == X.min());
+        ASSERT(INT64_MAX_VALUE == X.max());
+        ASSERT(1 == X.countInBucket(Obj::k_NUM_BUCKETS - 1));
+
+        mX.record(0);
+        ASSERT(0               == X.min());
+        ASSERT(INT64_MAX_VALUE == X.max());
+        ASSERT(1 == X.countInBucket(0));
+        ASSERT(2 == X.count());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Each value less than '2 * k_SUB_BUCKET_COUNT' has a bucket of its
+        //:   own, whose index is the value.
+        //:
+        //: 2 The buckets are contiguous: the first holds 0, the last holds the
+        //:   greatest 'Int64', and each bucket begins just after the end of
+        //:   the previous one.
+        //:
+        //: 3 'bucketIndex' maps every value to the bucket whose bounds
+        //:   contain it.
+        //:
+        //: 4 Each power-of-two range at or above '2 * k_SUB_BUCKET_COUNT' is
+        //:   divided into 'k_SUB_BUCKET_COUNT' buckets of equal width.
+        //
+        // Plan:
+        //: 1 Verify the index of each value less than
+        //:   '2 * k_SUB_BUCKET_COUNT'.  (C-1)
+        //:
+        //: 2 For each bucket, verify that its bounds are ordered, that its
+        //:   lower bound follows the upper bound of the previous bucket, that
+        //:   'bucketIndex' maps both bounds (and the values adjacent to them)
+        //:   to the expected buckets, and that its width is that of its
+        //:   power-of-two range divided by 'k_SUB_BUCKET_COUNT'.
+        //:   (C-2..4)
+        //:
+        //: 3 Verify 'bucketIndex' for many pseudo-random values.  (C-3)
+        //
+        // Testing:
+        //   static int bucketIndex(Types::Int64 value);
+        //   static Types::Int64 bucketLowerBound(int index);
+        //   static Types::Int64 bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BUCKET LAYOUT"
+                            "\n=====================\n");
+
+        ASSERT(32   == Obj::k_SUB_BUCKET_COUNT);
+        ASSERT(1888 == Obj::k_NUM_BUCKETS);
+
+        if (veryVerbose) printf("\tExact values.\n");
+
+        for (int i = 0; i < 2 * Obj::k_SUB_BUCKET_COUNT; ++i) {
+            LOOP_ASSERT(i, i == Obj::bucketIndex(i));
+            LOOP_ASSERT(i, i == Obj::bucketLowerBound(i));
+            LOOP_ASSERT(i, i == Obj::bucketUpperBound(i));
+        }
+
+        if (veryVerbose) printf("\tEvery bucket.\n");
+
+        ASSERT(0               == Obj::bucketLowerBound(0));
+        ASSERT(INT64_MAX_VALUE ==
+                              Obj::bucketUpperBound(Obj::k_NUM_BUCKETS - 1));
+        ASSERT(Obj::k_NUM_BUCKETS - 1 == Obj::bucketIndex(INT64_MAX_VALUE));
+
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 UPPER = Obj::bucketUpperBound(i);
+
+            if (veryVeryVerbose) { T_ P_(i) P_(LOWER) P(UPPER) }
+
+            LOOP_ASSERT(i, LOWER <= UPPER);
+            LOOP_ASSERT(i, i == Obj::bucketIndex(LOWER));
+            LOOP_ASSERT(i, i == Obj::bucketIndex(UPPER));
+            if (0 < i) {
+                LOOP_ASSERT(i, Obj::bucketUpperBound(i - 1) + 1 == LOWER);
+                LOOP_ASSERT(i, i - 1 == Obj::bucketIndex(LOWER - 1));
+            }
+            if (i < Obj::k_NUM_BUCKETS - 1) {
+                LOOP_ASSERT(i, i + 1 == Obj::bucketIndex(UPPER + 1));
+            }
+
+            // The width of a bucket in '[2^n, 2^(n+1))' is
+            // '2^n / k_SUB_BUCKET_COUNT', for 'n' at least 6.
+
+            if (2 * Obj::k_SUB_BUCKET_COUNT <= LOWER) {
+                Int64 power = 1;
+                while (power <= LOWER / 2) {
+                    power *= 2;
+                }
+                LOOP_ASSERT(i, UPPER <= power + (power - 1));
+                LOOP2_ASSERT(i, UPPER - LOWER + 1,
+                      power / Obj::k_SUB_BUCKET_COUNT == UPPER - LOWER + 1);
+            }
+        }
+
+        if (veryVerbose) printf("\tPseudo-random values.\n");
+
+        Uint64 state = 1;
+        for (int i = 0; i < 100000; ++i) {
+            const Int64 VALUE = nextRandom(&state);
+            const int   INDEX = Obj::bucketIndex(VALUE);
+
+            LOOP2_ASSERT(i, VALUE, 0 <= INDEX);
+            LOOP2_ASSERT(i, VALUE, INDEX < Obj::k_NUM_BUCKETS);
+            LOOP2_ASSERT(i, VALUE, Obj::bucketLowerBound(INDEX) <= VALUE);
+            LOOP2_ASSERT(i, VALUE, VALUE <= Obj::bucketUpperBound(INDEX));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record values, query percentiles, merge two histograms, and time
+        //:   a scope.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        Obj mX;  const Obj& X = mX;
+        Obj mY;  const Obj& Y = mY;
+
+        ASSERT(0 == X.count());
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.record(i);
+        }
+        ASSERT(100  == X.count());
+        ASSERT(1    == X.min());
+        ASSERT(100  == X.max());
+        ASSERT(50.5 == X.mean());
+        ASSERT(50   == X.percentile(50));
+        ASSERT(100  == X.percentile(100));
+
+        mY.record(1000);
+        mX.add(Y);
+        ASSERT(101  == X.count());
+        ASSERT(1000 == X.max());
+
+        {
+            Scope scope(&mY);
+        }
+        ASSERT(2 == Y.count());
+
+        if (veryVerbose) {
+            X.print(stdout);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COST OF RECORDING
+        //
+        // Concerns:
+        //: 1 Recording a value costs a few nanoseconds.
+        //
+        // Plan:
+        //: 1 Time the recording of many values spread over the buckets, the
+        //:   timing of an empty scope, and, for comparison, reading the fast
+        //:   timer alone.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COST OF RECORDING
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COST OF RECORDING"
+                            "\n==============================\n");
+
+        const int NUM_VALUES = 10000000;
+
+        bsls::TimeUtil::initializeFastTimer();
+
+        Obj mX;  const Obj& X = mX;
+
+        {
+            Uint64      state = 1;
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                state = state * 6364136223846793005ULL + 1;
+                mX.record(static_cast<Int64>(state >> (1 + (i & 31))));
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("record:                 %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_VALUES);
+        }
+        {
+            Int64       sum   = 0;
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                sum += bsls::TimeUtil::getFastTimerRaw();
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("getFastTimerRaw:        %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_VALUES);
+            ASSERT(0 != sum);
+        }
+        {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                Scope scope(&mX);
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+            printf("LatencyHistogramScope:  %6.1f ns\n",
+                   static_cast<double>(elapsed) / NUM_VALUES);
+        }
+
+        ASSERT(2 * NUM_VALUES == X.count());
+        if (veryVerbose) {
+            X.print(stdout);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -16,6 +16,7 @@ BSLS_IDENT("$Id: $")
 //  BSLS_PLATFORM_OS_*: operating system type, sub-type, and version
 //  BSLS_PLATFORM_CPU_* instruction set, instruction width, and version
 //  BSLS_PLATFORM_CMP_*: compiler vendor, and version
+//  BSLS_PLATFORM_CACHE_LINE_SIZE: size of a processor cache line, in bytes
 //
 //@DESCRIPTION: This component implements a suite of preprocessor macros
 // and traits that identify and define platform-specific compile-time
@@ -138,6 +139,25 @@ BSLS_IDENT("$Id: $")
 //  #endif
 //  }
 //..
+// Finally, the size (in bytes) of a cache line of the target processor is
+// provided as a compile-time constant:
+//..
+//  BSLS_PLATFORM_CACHE_LINE_SIZE
+//..
+// This value is the unit in which processors transfer memory between caches,
+// and so the granularity at which concurrent writes to distinct objects
+// interfere with each other ("false sharing").  Objects that are written
+// frequently by different threads should not share a cache line:
+//..
+//  struct PerThreadCounter {
+//      int  d_count;
+//      char d_padding[BSLS_PLATFORM_CACHE_LINE_SIZE - sizeof(int)];
+//  };
+//..
+// The value is 128 on POWER and Itanium processors, and 64 elsewhere.  It may
+// be overridden by defining 'BSLS_PLATFORM_CACHE_LINE_SIZE' (to a power of 2)
+// on the command line.  Note that 'bsls_cachelinepadded' provides types that
+// perform such padding, and cache-line alignment, automatically.
 
 #ifdef __cplusplus
 namespace BloombergLP {
@@ -662,6 +682,14 @@ struct bsls_Platform_Assert;
 #if !defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)
    #define BSLS_PLATFORM_IS_BIG_ENDIAN 1
 #endif
+
+#if !defined(BSLS_PLATFORM_CACHE_LINE_SIZE)
+    #if defined(BSLS_PLATFORM_CPU_POWERPC) || defined(BSLS_PLATFORM_CPU_IA64)
+        #define BSLS_PLATFORM_CACHE_LINE_SIZE 128
+    #else
+        #define BSLS_PLATFORM_CACHE_LINE_SIZE 64
+    #endif
+#endif
 // ----------------------------------------------------------------------------
 
 
@@ -786,6 +814,13 @@ struct bsls_Platform_Assert;
     char die[sizeof(bsls_Platform_Assert)];          // if '#error' unsupported
 #endif
 
+// The cache-line size is a power of 2.
+#if BSLS_PLATFORM_CACHE_LINE_SIZE < 16                                        \
+ || (BSLS_PLATFORM_CACHE_LINE_SIZE & (BSLS_PLATFORM_CACHE_LINE_SIZE - 1)) != 0
+    #error "The cache-line size must be a power of 2 (and at least 16)."
+    char die[sizeof(bsls_Platform_Assert)];          // if '#error' unsupported
+#endif
+
 #if defined(BSLS_PLATFORM_OS_VER_MAJOR) \
          && BSLS_PLATFORM_OS_SUBTYPE_COUNT != 1
         // For OS, MAJOR VERSION implies SUBTYPE.
@@ -6,6 +6,10 @@
 #include <cstdlib>     // 'atoi'
 #include <iostream>
 
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <unistd.h>    // 'sysconf'
+#endif
+
 
 using namespace BloombergLP;
 using namespace std;
@@ -102,6 +106,7 @@ bool isLittleEndian()
 // [ 2] BSLS_PLATFORM_IS_LITTLE_ENDIAN
 // [ 2] BSLS_PLATFORM_IS_BIG_ENDIAN
 // [ 3] BSLS_PLATFORM_NO_64_BIT_LITERALS
+// [ 5] BSLS_PLATFORM_CACHE_LINE_SIZE
 // ============================================================================
 
 int main(int argc, char *argv[])
@@ -114,6 +119,46 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING BSLS_PLATFORM_CACHE_LINE_SIZE:
+        //
+        // Concerns:
+        //   1. The macro 'BSLS_PLATFORM_CACHE_LINE_SIZE' is a compile-time
+        //      constant that is a power of 2.
+        //   2. Where the operating system reports the cache-line size of the
+        //      host, the macro agrees with it.
+        //
+        // Plan:
+        //   Use the macro as an array bound and verify that it is a power of
+        //   2.  On Linux, compare it with the level-1 data cache line size
+        //   reported by 'sysconf', if that is available and non-zero.
+        //
+        // Testing:
+        //   BSLS_PLATFORM_CACHE_LINE_SIZE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Testing BSLS_PLATFORM_CACHE_LINE_SIZE" << endl
+                          << "=====================================" << endl;
+
+        char buffer[BSLS_PLATFORM_CACHE_LINE_SIZE];
+        const int SIZE = sizeof buffer;
+
+        if (veryVerbose) cout << "SIZE = " << SIZE << endl;
+
+        ASSERT(16 <= SIZE);
+        ASSERT(0 == (SIZE & (SIZE - 1)));
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(_SC_LEVEL1_DCACHE_LINESIZE)
+        const long hostSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+        if (veryVerbose) cout << "hostSize = " << hostSize << endl;
+        if (0 < hostSize) {
+            ASSERT(SIZE == hostSize);
+        }
+#endif
+
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // DUMPING VALUES OF OLD '__' LITERALS
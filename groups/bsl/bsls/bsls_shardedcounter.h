@@ -0,0 +1,248 @@
+// bsls_shardedcounter.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLS_SHARDEDCOUNTER
+#define INCLUDED_BSLS_SHARDEDCOUNTER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a counter that scales with the number of updating threads.
+//
+//@CLASSES:
+//  bsls::ShardedCounter: 64-bit counter spread over per-processor shards
+//
+//@SEE_ALSO: bsls_atomic, bsls_cachelinepadded
+//
+//@DESCRIPTION: This component provides a thread-safe 64-bit integer counter,
+// 'bsls::ShardedCounter', optimized for frequent updates from many threads and
+// infrequent reads, as is typical of statistics (e.g., the number of requests
+// processed, or bytes sent).  A single 'bsls::AtomicInt64' updated by every
+// thread becomes a point of contention: each update must take exclusive
+// ownership of the cache line holding the counter, and the line migrates
+// between processors on nearly every update.  A 'bsls::ShardedCounter' is
+// instead divided into 'k_NUM_SHARDS' shards, each on cache lines of its own
+// (see 'bsls_cachelinepadded'), and 'add' applies a relaxed atomic addition
+// to the shard associated with the calling thread's current processor.
+// Threads running on different processors therefore usually update different
+// cache lines, and 'add' costs about as much as an uncontended atomic
+// addition.  The price is paid by readers: 'total' and 'resetAndRead' visit
+// every shard.
+//
+///Consistency of Reads
+///--------------------
+// Each update is applied atomically to exactly one shard, so no update is ever
+// lost or counted twice: 'total' returns the sum of all updates whose effect
+// on their shard is visible when that shard is read, and 'resetAndRead'
+// atomically exchanges each shard with zero in turn, so that each update is
+// returned by exactly one call to 'resetAndRead' (or remains in the counter).
+// However, because the shards are read one at a time, a value returned while
+// updates are in progress need not equal the value of the counter at any
+// single instant.  For example, if one thread adds 1 and then subtracts 1,
+// and these updates are applied to different shards, a concurrent 'total' may
+// observe only the subtraction.  Once updates have ceased (and the updating
+// threads have been synchronized with the reader), 'total' is exact.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Requests and Reporting Rates
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server counts the requests it processes, on every worker
+// thread, and that a monitoring thread periodically reports, and resets, the
+// number of requests processed since its last report.
+//
+// First, we define the counter, shared by the worker threads:
+//..
+//  bsls::ShardedCounter numRequests;
+//..
+// Then, each worker thread records each request it processes:
+//..
+//  void processRequest(bsls::ShardedCounter *numRequests)
+//  {
+//      // ... process the request ...
+//
+//      numRequests->increment();
+//  }
+//..
+// Next, we process some requests (here, on a single thread):
+//..
+//  for (int i = 0; i < 5; ++i) {
+//      processRequest(&numRequests);
+//  }
+//  assert(5 == numRequests.total());
+//..
+// Now, the monitoring thread reads the number of requests processed since its
+// last report, resetting the counter for the next period:
+//..
+//  bsls::Types::Int64 numInPeriod = numRequests.resetAndRead();
+//  assert(5 == numInPeriod);
+//..
+// Finally, we observe that the counter starts afresh:
+//..
+//  processRequest(&numRequests);
+//  assert(1 == numRequests.total());
+//..
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINEPADDED
+#include <bsls_cachelinepadded.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ====================
+                            // class ShardedCounter
+                            // ====================
+
+class ShardedCounter {
+    // This class provides a thread-safe 64-bit integer counter whose updates
+    // are spread over per-processor shards, so that concurrent updates from
+    // different processors do not contend.  See the component-level
+    // documentation for the consistency of values read while updates are in
+    // progress.
+
+  public:
+    // TYPES
+    enum {
+        k_NUM_SHARDS = 32  // number of shards; the shard updated by a thread
+                           // is chosen by its processor, modulo this value
+    };
+
+  private:
+    // DATA
+    PerCoreArray<AtomicInt64, k_NUM_SHARDS> d_shards;  // shard values, each
+                                                       // on cache lines of
+                                                       // its own
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCounter(const ShardedCounter&);
+    ShardedCounter& operator=(const ShardedCounter&);
+
+  public:
+    // CREATORS
+    ShardedCounter();
+        // Create a counter having the value 0.
+
+    // ~ShardedCounter() = default;
+        // Destroy this counter.
+
+    // MANIPULATORS
+    void add(Types::Int64 value);
+        // Atomically add the specified 'value' to this counter, using relaxed
+        // memory ordering.
+
+    void increment();
+        // Atomically add 1 to this counter, using relaxed memory ordering.
+
+    void reset();
+        // Set the value of this counter to 0.  Note that updates concurrent
+        // with this call may or may not be discarded.
+
+    Types::Int64 resetAndRead();
+        // Set the value of this counter to 0, and return its value before
+        // the reset.  Each update to this counter is reflected in the value
+        // returned by exactly one call to this method, or remains in the
+        // counter.
+
+    // ACCESSORS
+    Types::Int64 total() const;
+        // Return the value of this counter, i.e., the sum of its shards.
+        // Note that, if updates are in progress, the returned value need not
+        // equal the value of the counter at any single instant.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // class ShardedCounter
+                            // --------------------
+
+// CREATORS
+inline
+ShardedCounter::ShardedCounter()
+{
+}
+
+// MANIPULATORS
+inline
+void ShardedCounter::add(Types::Int64 value)
+{
+    d_shards.local().addRelaxed(value);
+}
+
+inline
+void ShardedCounter::increment()
+{
+    d_shards.local().addRelaxed(1);
+}
+
+inline
+void ShardedCounter::reset()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_shards[i].storeRelaxed(0);
+    }
+}
+
+inline
+Types::Int64 ShardedCounter::resetAndRead()
+{
+    Types::Int64 result = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        result += d_shards[i].swap(0);
+    }
+    return result;
+}
+
+// ACCESSORS
+inline
+Types::Int64 ShardedCounter::total() const
+{
+    Types::Int64 result = 0;
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        result += d_shards[i].loadRelaxed();
+    }
+    return result;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
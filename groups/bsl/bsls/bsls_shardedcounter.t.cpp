@@ -0,0 +1,547 @@
+// bsls_shardedcounter.t.cpp                                          -*-C++-*-
+
+#include <bsls_shardedcounter.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a counter whose value is the sum of several
+// shards.  Its manipulators and accessor are first tested on a single thread,
+// and then with several threads updating the counter concurrently, with and
+// without a concurrent 'resetAndRead', verifying that no update is lost or
+// counted twice.  A performance test (negative case) compares the cost of
+// concurrent updates with that of a single 'bsls::AtomicInt64'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 1] ShardedCounter();
+//
+// MANIPULATORS
+// [ 1] void add(Types::Int64 value);
+// [ 1] void increment();
+// [ 1] void reset();
+// [ 1] Types::Int64 resetAndRead();
+//
+// ACCESSORS
+// [ 1] Types::Int64 total() const;
+//-----------------------------------------------------------------------------
+// [ 2] CONCURRENCY: UPDATES AND RESETS
+// [ 3] USAGE EXAMPLE
+// [-1] PERFORMANCE: COMPARISON WITH A SINGLE ATOMIC COUNTER
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::ShardedCounter Obj;
+typedef bsls::Types::Int64   Int64;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+                            // =================
+                            // struct WorkerArgs
+                            // =================
+
+struct WorkerArgs {
+    // This 'struct' describes the work of a worker thread: add 'd_value' to
+    // either '*d_counter_p' or (if 'd_counter_p' is 0) '*d_atomic_p',
+    // 'd_numIterations' times.
+
+    Obj               *d_counter_p;      // sharded counter to update, or 0
+    bsls::AtomicInt64 *d_atomic_p;       // atomic counter to update
+    Int64              d_value;          // value to add
+    int                d_numIterations;  // number of additions
+};
+
+extern "C" void *workerThread(void *arg)
+{
+    WorkerArgs *args = static_cast<WorkerArgs *>(arg);
+
+    const Int64 value = args->d_value;
+    if (args->d_counter_p) {
+        Obj *counter = args->d_counter_p;
+        for (int i = 0; i < args->d_numIterations; ++i) {
+            counter->add(value);
+        }
+    }
+    else {
+        bsls::AtomicInt64 *atomic = args->d_atomic_p;
+        for (int i = 0; i < args->d_numIterations; ++i) {
+            atomic->addRelaxed(value);
+        }
+    }
+    return 0;
+}
+
+                            // =================
+                            // struct ReaderArgs
+                            // =================
+
+struct ReaderArgs {
+    // This 'struct' describes the work of a reader thread: call
+    // 'resetAndRead' on '*d_counter_p' until '*d_stop_p' is non-zero,
+    // accumulating the returned values in 'd_sum'.
+
+    Obj             *d_counter_p;  // counter to read
+    bsls::AtomicInt *d_stop_p;     // non-zero to stop
+    Int64            d_sum;        // sum of values read, output
+    int              d_numReads;   // number of reads, output
+};
+
+extern "C" void *readerThread(void *arg)
+{
+    ReaderArgs *args = static_cast<ReaderArgs *>(arg);
+
+    args->d_sum      = 0;
+    args->d_numReads = 0;
+    while (!args->d_stop_p->loadAcquire()) {
+        args->d_sum += args->d_counter_p->resetAndRead();
+        ++args->d_numReads;
+    }
+    return 0;
+}
+
+static Int64 runWorkers(Obj               *counter,
+                        bsls::AtomicInt64 *atomic,
+                        int                numThreads,
+                        int                numIterations)
+    // Run the specified 'numThreads' worker threads, the thread 'i' adding
+    // 'i + 1' to the specified 'counter' (or, if 'counter' is 0, to the
+    // specified 'atomic') the specified 'numIterations' times.  Return the
+    // elapsed time in nanoseconds.
+{
+    my_thread_t handles[64];
+    WorkerArgs  args[64];
+
+    ASSERT(numThreads <= 64);
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_counter_p     = counter;
+        args[i].d_atomic_p      = atomic;
+        args[i].d_value         = i + 1;
+        args[i].d_numIterations = numIterations;
+        ASSERT(0 == myCreateThread(&handles[i], &workerThread, &args[i]));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        myJoinThread(handles[i]);
+    }
+    return bsls::TimeUtil::getTimer() - start;
+}
+
+static Int64 expectedTotal(int numThreads, int numIterations)
+    // Return the total added by 'runWorkers' for the specified 'numThreads'
+    // and 'numIterations'.
+{
+    return static_cast<Int64>(numThreads) * (numThreads + 1) / 2
+                                                               * numIterations;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Requests and Reporting Rates
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server counts the requests it processes, on every worker
+// thread, and that a monitoring thread periodically reports, and resets, the
+// number of requests processed since its last report.
+//
+// Then, each worker thread records each request it processes:
+//..
+    void processRequest(bsls::ShardedCounter *numRequests)
+    {
+        // ... process the request ...
+
+        numRequests->increment();
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// First, we define the counter, shared by the worker threads:
+//..
+    bsls::ShardedCounter numRequests;
+//..
+// Next, we process some requests (here, on a single thread):
+//..
+    for (int i = 0; i < 5; ++i) {
+        processRequest(&numRequests);
+    }
+    ASSERT(5 == numRequests.total());
+//..
+// Now, the monitoring thread reads the number of requests processed since its
+// last report, resetting the counter for the next period:
+//..
+    bsls::Types::Int64 numInPeriod = numRequests.resetAndRead();
+    ASSERT(5 == numInPeriod);
+//..
+// Finally, we observe that the counter starts afresh:
+//..
+    processRequest(&numRequests);
+    ASSERT(1 == numRequests.total());
+//..
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: UPDATES AND RESETS
+        //
+        // Concerns:
+        //: 1 Concurrent updates from several threads (and so, in general, to
+        //:   several shards) are neither lost nor counted twice.
+        //:
+        //: 2 When 'resetAndRead' is called concurrently with updates, every
+        //:   update is returned by exactly one call, or remains in the
+        //:   counter.
+        //
+        // Plan:
+        //: 1 For 2, 4, and 16 threads, have each thread add a distinct value
+        //:   a fixed number of times, and verify 'total'.  (C-1)
+        //:
+        //: 2 Repeat P-1 while a reader thread calls 'resetAndRead'
+        //:   repeatedly, and verify that the sum of the values read and the
+        //:   final 'total' is the expected total.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY: UPDATES AND RESETS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: UPDATES AND RESETS"
+                            "\n===============================\n");
+
+        const int NUM_ITERATIONS = 50000;
+        const int THREADS[]      = { 2, 4, 16 };
+        const int NUM_THREADS    = sizeof THREADS / sizeof *THREADS;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int   N   = THREADS[ti];
+            const Int64 EXP = expectedTotal(N, NUM_ITERATIONS);
+
+            {
+                Obj mX;  const Obj& X = mX;
+
+                runWorkers(&mX, 0, N, NUM_ITERATIONS);
+                LOOP2_ASSERT(N, X.total(), EXP == X.total());
+            }
+
+            {
+                Obj mX;  const Obj& X = mX;
+
+                bsls::AtomicInt stop(0);
+                ReaderArgs      reader;
+                reader.d_counter_p = &mX;
+                reader.d_stop_p    = &stop;
+
+                my_thread_t handle;
+                ASSERT(0 == myCreateThread(&handle, &readerThread, &reader));
+
+                runWorkers(&mX, 0, N, NUM_ITERATIONS);
+
+                stop.storeRelease(1);
+                myJoinThread(handle);
+
+                if (veryVerbose) {
+                    T_ P_(N) P_(reader.d_numReads) P(reader.d_sum)
+                }
+
+                LOOP3_ASSERT(N, reader.d_sum, X.total(),
+                             EXP == reader.d_sum + X.total());
+            }
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BASIC MANIPULATORS AND ACCESSOR
+        //
+        // Concerns:
+        //: 1 A default-constructed counter has the value 0.
+        //:
+        //: 2 'add' and 'increment' change the value by the given amount
+        //:   (which may be negative or exceed 32 bits), and 'total' returns
+        //:   the value.
+        //:
+        //: 3 'reset' sets the value to 0.
+        //:
+        //: 4 'resetAndRead' returns the value and sets it to 0.
+        //:
+        //: 5 Updates from different threads (and so, in general, to
+        //:   different shards) are all reflected in the value.
+        //
+        // Plan:
+        //: 1 Verify the value after each operation in a sequence.  (C-1..4)
+        //:
+        //: 2 Update the counter from several threads in turn, and verify
+        //:   the value, its reset, and its read-and-reset.  (C-5)
+        //
+        // Testing:
+        //   ShardedCounter();
+        //   void add(Types::Int64 value);
+        //   void increment();
+        //   void reset();
+        //   Types::Int64 resetAndRead();
+        //   Types::Int64 total() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBASIC MANIPULATORS AND ACCESSOR"
+                            "\n===============================\n");
+
+        const Int64 BIG = 0x123456789LL;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.total());
+
+        mX.increment();
+        ASSERT(1 == X.total());
+
+        mX.add(BIG);
+        ASSERT(BIG + 1 == X.total());
+
+        mX.add(-BIG - 3);
+        ASSERT(-2 == X.total());
+
+        mX.reset();
+        ASSERT(0 == X.total());
+
+        mX.add(7);
+        mX.increment();
+        ASSERT(8 == mX.resetAndRead());
+        ASSERT(0 == X.total());
+        ASSERT(0 == mX.resetAndRead());
+
+        for (int i = 0; i < 8; ++i) {
+            runWorkers(&mX, 0, 1, 10);  // one thread at a time
+        }
+        ASSERT(80 == X.total());
+
+        mX.reset();
+        ASSERT(0 == X.total());
+
+        runWorkers(&mX, 0, 4, 100);
+        ASSERT(expectedTotal(4, 100) == X.total());
+        ASSERT(expectedTotal(4, 100) == mX.resetAndRead());
+        ASSERT(0 == X.total());
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH A SINGLE ATOMIC COUNTER
+        //
+        // Concerns:
+        //: 1 The cost of 'add' does not grow with the number of updating
+        //:   threads, unlike that of a single atomic counter.
+        //
+        // Plan:
+        //: 1 For 1 to 64 threads, have each thread add to (a) a single
+        //:   'bsls::AtomicInt64' and (b) a 'bsls::ShardedCounter' a fixed
+        //:   number of times, and report the average time per addition and
+        //:   the cost of 'total'.  The number of additions per thread may be
+        //:   given as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: COMPARISON WITH A SINGLE ATOMIC COUNTER
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: COMPARISON WITH A SINGLE ATOMIC COUNTER"
+               "\n====================================================\n");
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 2000000;
+        const int MAX_THREADS    = 64;
+
+        printf("%8s %14s %14s\n", "threads", "atomic ns", "sharded ns");
+
+        for (int n = 1; n <= MAX_THREADS; n *= 2) {
+            bsls::AtomicInt64 atomic(0);
+            Obj               counter;
+
+            const Int64 atomicTime  = runWorkers(0,
+                                                 &atomic,
+                                                 n,
+                                                 NUM_ITERATIONS);
+            const Int64 shardedTime = runWorkers(&counter,
+                                                 &atomic,
+                                                 n,
+                                                 NUM_ITERATIONS);
+
+            LOOP_ASSERT(n, expectedTotal(n, NUM_ITERATIONS) == atomic);
+            LOOP_ASSERT(n, expectedTotal(n, NUM_ITERATIONS)
+                                                          == counter.total());
+
+            const double OPS = static_cast<double>(n) * NUM_ITERATIONS;
+            printf("%8d %14.2f %14.2f\n",
+                   n,
+                   static_cast<double>(atomicTime)  / OPS,
+                   static_cast<double>(shardedTime) / OPS);
+        }
+
+        {
+            const int NUM_READS = 1000000;
+
+            Obj   counter;
+            Int64 sum = 0;
+
+            const Int64 start = bsls::TimeUtil::getTimer();
+            for (int i = 0; i < NUM_READS; ++i) {
+                counter.increment();
+                sum += counter.total();
+            }
+            const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+            ASSERT(static_cast<Int64>(NUM_READS) * (NUM_READS + 1) / 2 == sum);
+            printf("'total': %.2f ns\n",
+                   static_cast<double>(elapsed) / NUM_READS);
+        }
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
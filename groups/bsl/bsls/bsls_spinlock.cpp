@@ -0,0 +1,137 @@
+// bsls_spinlock.cpp                                                  -*-C++-*-
+#include <bsls_spinlock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    #include <linux/futex.h>  // FUTEX_WAIT, FUTEX_WAKE
+    #include <sched.h>        // sched_yield()
+    #include <sys/syscall.h>  // SYS_futex
+    #include <unistd.h>       // syscall()
+#elif defined(BSLS_PLATFORM_OS_UNIX)
+    #include <sched.h>        // sched_yield()
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    #include <windows.h>      // SwitchToThread()
+#else
+    #error "Don't know how to yield the processor on this platform"
+#endif
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // ---------------------
+                            // struct SpinLock_Util
+                            // ---------------------
+
+// CLASS METHODS
+void SpinLock_Util::wait(AtomicOperations::AtomicTypes::Int *address,
+                         int                                 expected)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'FUTEX_WAIT' atomically checks that '*address' still holds 'expected'
+    // before sleeping, so that a 'wake' issued after the caller last examined
+    // '*address' is not lost.  'FUTEX_PRIVATE_FLAG' is omitted, because the
+    // lock may reside in memory shared between processes.
+
+    syscall(SYS_futex,
+            &address->d_value,
+            FUTEX_WAIT,
+            expected,
+            0,
+            0,
+            0);
+#else
+    (void)address;
+    (void)expected;
+    yield();
+#endif
+}
+
+void SpinLock_Util::wake(AtomicOperations::AtomicTypes::Int *address)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    syscall(SYS_futex, &address->d_value, FUTEX_WAKE, 1, 0, 0, 0);
+#else
+    (void)address;
+#endif
+}
+
+void SpinLock_Util::yield()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sched_yield();
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+    ::SwitchToThread();
+#endif
+}
+
+                              // ----------------
+                              // class HybridLock
+                              // ----------------
+
+// PRIVATE MANIPULATORS
+void HybridLock::lockContended()
+{
+    // Spin, with backoff, while the lock appears to be held without blocked
+    // waiters, attempting to acquire it whenever it appears free.
+
+    int numSpins = 0;
+    for (int i = 0; i < k_NUM_SPINS; ++i) {
+        const int state = AtomicOperations::getIntRelaxed(&d_state);
+        if (k_UNLOCKED == state) {
+            if (k_UNLOCKED == AtomicOperations::testAndSwapIntAcqRel(
+                                                                  &d_state,
+                                                                  k_UNLOCKED,
+                                                                  k_LOCKED)) {
+                return;                                               // RETURN
+            }
+        }
+        else if (k_CONTENDED == state) {
+            break;
+        }
+        SpinLock_Util::backoff(&numSpins);
+    }
+
+    // Mark the lock as contended, and block until it is released.  Having
+    // blocked, this thread cannot know whether other threads remain blocked,
+    // so it acquires the lock in the contended state, conservatively
+    // requiring 'unlock' to issue a wake-up.
+
+    while (k_UNLOCKED != AtomicOperations::swapIntAcqRel(&d_state,
+                                                         k_CONTENDED)) {
+        SpinLock_Util::wait(&d_state, k_CONTENDED);
+    }
+}
+
+void HybridLock::unlockContended()
+{
+    SpinLock_Util::wake(&d_state);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
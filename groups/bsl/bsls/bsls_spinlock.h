@@ -0,0 +1,678 @@
+// bsls_spinlock.h                                                    -*-C++-*-
+#ifndef INCLUDED_BSLS_SPINLOCK
+#define INCLUDED_BSLS_SPINLOCK
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lightweight spin locks for very short critical sections.
+//
+//@CLASSES:
+//  bsls::SpinLock: test-and-test-and-set spin lock with exponential backoff
+//  bsls::TicketLock: first-in, first-out spin lock
+//  bsls::HybridLock: spin lock that blocks in the kernel under contention
+//  bsls::SpinLockGuard: scoped guard that unlocks a lock on destruction
+//
+//@MACROS:
+//  BSLS_SPINLOCK_UNLOCKED: static initializer for 'bsls::SpinLock'
+//  BSLS_TICKETLOCK_UNLOCKED: static initializer for 'bsls::TicketLock'
+//  BSLS_HYBRIDLOCK_UNLOCKED: static initializer for 'bsls::HybridLock'
+//
+//@SEE_ALSO: bsls_atomicoperations
+//
+//@DESCRIPTION: This component provides three mutual-exclusion locks built
+// directly on 'bsls::AtomicOperations', intended to protect critical sections
+// that run for a few hundred instructions at most (for example, popping a free
+// list, or updating a small map), where the cost of an operating-system mutex
+// would dominate.  Each lock provides 'lock', 'tryLock', and 'unlock'
+// operations, and a scoped guard, 'bsls::SpinLockGuard', unlocks any of them
+// on destruction.  The three locks differ in their behavior under contention:
+//
+//: 'bsls::SpinLock':
+//:     A test-and-test-and-set lock: a waiting thread reads the lock word
+//:     (which does not write the shared cache line) and attempts to acquire
+//:     the lock only once it appears free.  This is the cheapest lock to
+//:     acquire and release, but makes no guarantee of fairness.
+//:
+//: 'bsls::TicketLock':
+//:     A lock that grants ownership in the order in which it was requested,
+//:     so that no waiting thread can be starved.  The price is that a
+//:     preempted waiter delays all waiters queued behind it.
+//:
+//: 'bsls::HybridLock':
+//:     A lock that spins briefly and then, on Linux, sleeps in the kernel
+//:     using a 'futex' until it is woken by 'unlock'.  Releasing an
+//:     uncontended lock requires no system call.  On other platforms,
+//:     waiting threads yield the processor instead of sleeping.
+//
+// None of these locks is recursive: the behavior is undefined if a thread
+// attempts to acquire a lock that it already holds.
+//
+///Backoff
+///-------
+// While waiting, 'bsls::SpinLock' and 'bsls::TicketLock' execute an
+// exponentially increasing number of "pause" instructions ('pause' on x86
+// processors) between successive reads of the lock word, reducing both the
+// traffic on the shared cache line and the power consumed by the spinning
+// core.  Once the number of pauses reaches an upper bound, a waiting thread
+// instead yields the remainder of its time slice, so that a thread that is
+// preempted while holding a lock is not indefinitely starved by its waiters
+// (which matters most when there are more threads than processors).
+// 'bsls::HybridLock' uses the same backoff for a bounded number of attempts
+// before it sleeps.
+//
+///Static Initialization
+///---------------------
+// Each lock type is an aggregate having no constructor, so that a lock having
+// static storage duration can be initialized (using
+// 'BSLS_SPINLOCK_UNLOCKED', 'BSLS_TICKETLOCK_UNLOCKED', or
+// 'BSLS_HYBRIDLOCK_UNLOCKED', respectively) before any dynamic initialization
+// takes place, and thus be used safely from other static initializers.  A
+// lock that is a data member, or that is otherwise not statically
+// initialized, must be put into the unlocked state by calling 'initialize'
+// before it is used.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Free List
+///- - - - - - - - - - - - - - - - -
+// Suppose that we maintain a pool of fixed-size blocks, whose free list is
+// shared by several threads.  Each operation on the free list takes a handful
+// of instructions, so a spin lock is appropriate.
+//
+// First, we define the pool, having a 'bsls::SpinLock' to protect its free
+// list:
+//..
+//  class BlockPool {
+//      // This class provides a thread-safe pool of fixed-size blocks.
+//
+//      // PRIVATE TYPES
+//      struct Link {
+//          Link *d_next_p;
+//      };
+//
+//      // DATA
+//      Link           *d_freeList_p;  // head of free list (owned)
+//      bsls::SpinLock  d_lock;        // protects 'd_freeList_p'
+//
+//    public:
+//      // CREATORS
+//      BlockPool()
+//      : d_freeList_p(0)
+//      {
+//          d_lock.initialize();
+//      }
+//
+//      // MANIPULATORS
+//      void *allocate()
+//          // Return a block from the free list, or 0 if the list is empty.
+//      {
+//          bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+//
+//          Link *link = d_freeList_p;
+//          if (link) {
+//              d_freeList_p = link->d_next_p;
+//          }
+//          return link;
+//      }
+//
+//      void deallocate(void *block)
+//          // Return the specified 'block' to the free list.
+//      {
+//          Link *link = static_cast<Link *>(block);
+//
+//          bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+//
+//          link->d_next_p = d_freeList_p;
+//          d_freeList_p   = link;
+//      }
+//  };
+//..
+// Then, we create a pool and give it two blocks:
+//..
+//  BlockPool pool;
+//
+//  void *blocks[2][4];
+//  pool.deallocate(blocks[0]);
+//  pool.deallocate(blocks[1]);
+//..
+// Now, we allocate the blocks back, in last-in, first-out order:
+//..
+//  assert(blocks[1] == pool.allocate());
+//  assert(blocks[0] == pool.allocate());
+//  assert(0         == pool.allocate());
+//..
+// Finally, we note that a lock having static storage duration is initialized
+// without a call to 'initialize', and may be used immediately:
+//..
+//  static bsls::TicketLock s_lock = BSLS_TICKETLOCK_UNLOCKED;
+//
+//  assert(0 == s_lock.tryLock());
+//  s_lock.unlock();
+//..
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)                                           \
+ && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+#ifndef INCLUDED_INTRIN
+#include <intrin.h>
+#define INCLUDED_INTRIN
+#endif
+#endif
+
+                        // ============================
+                        // BSLS_SPINLOCK_UNLOCKED, etc.
+                        // ============================
+
+#define BSLS_SPINLOCK_UNLOCKED   { { 0 } }
+    // Initializer for a 'bsls::SpinLock' in the unlocked state.
+
+#define BSLS_TICKETLOCK_UNLOCKED { { 0 }, { 0 } }
+    // Initializer for a 'bsls::TicketLock' in the unlocked state.
+
+#define BSLS_HYBRIDLOCK_UNLOCKED { { 0 } }
+    // Initializer for a 'bsls::HybridLock' in the unlocked state.
+
+namespace BloombergLP {
+
+namespace bsls {
+
+                            // =====================
+                            // struct SpinLock_Util
+                            // =====================
+
+struct SpinLock_Util {
+    // This 'struct' provides a namespace for the backoff procedures shared by
+    // the locks in this component, and is for use only by this component.
+
+    // TYPES
+    enum {
+        k_MAX_BACKOFF_SHIFT = 10  // 'backoff' pauses at most 2^10 times
+                                  // before yielding
+    };
+
+    // CLASS METHODS
+    static void backoff(int *numSpins);
+        // Delay the calling thread by an amount depending on, and then update,
+        // the specified '*numSpins', which must be 0 at the start of a wait.
+        // The delay doubles on each successive call until it reaches
+        // '1 << k_MAX_BACKOFF_SHIFT' pauses, after which each call yields the
+        // processor.
+
+    static void pause();
+        // Execute a processor hint indicating that the calling thread is
+        // spinning, or do nothing if the processor has no such hint.
+
+    static void wait(AtomicOperations::AtomicTypes::Int *address,
+                     int                                 expected);
+        // Block the calling thread until woken by 'wake', provided that the
+        // value of the specified '*address' is the specified 'expected' value
+        // at the time of the call; otherwise, return immediately.  This
+        // function may return spuriously.  Note that on platforms having no
+        // suitable kernel facility this function yields the processor.
+
+    static void wake(AtomicOperations::AtomicTypes::Int *address);
+        // Wake at least one thread, if any, blocked in 'wait' on the specified
+        // 'address'.
+
+    static void yield();
+        // Relinquish the remainder of the calling thread's time slice.
+};
+
+                               // ==============
+                               // class SpinLock
+                               // ==============
+
+class SpinLock {
+    // This aggregate 'class' provides a non-recursive, unfair mutual
+    // exclusion lock that waits by spinning with exponential backoff.  An
+    // object of this type must be initialized using 'BSLS_SPINLOCK_UNLOCKED'
+    // or 'initialize' before use.
+
+  public:
+    // PUBLIC DATA
+    AtomicOperations::AtomicTypes::Int d_state;  // 0 if unlocked, 1 if
+                                                 // locked; public only to
+                                                 // permit static
+                                                 // initialization
+
+    // MANIPULATORS
+    void initialize();
+        // Put this lock into the unlocked state.  The behavior is undefined
+        // if any thread holds, or is waiting for, this lock.
+
+    void lock();
+        // Acquire this lock, waiting for as long as is necessary.  The
+        // behavior is undefined if the calling thread already holds this
+        // lock.
+
+    int tryLock();
+        // Acquire this lock if it is available without waiting.  Return 0 on
+        // success, and a non-zero value (with no effect) if the lock is held
+        // by another thread.
+
+    void unlock();
+        // Release this lock.  The behavior is undefined unless the calling
+        // thread holds this lock.
+
+    // ACCESSORS
+    bool isLocked() const;
+        // Return 'true' if this lock is held by some thread, and 'false'
+        // otherwise.  Note that the returned value may be out of date before
+        // it is examined, and is intended for testing and diagnostics only.
+};
+
+                              // ================
+                              // class TicketLock
+                              // ================
+
+class TicketLock {
+    // This aggregate 'class' provides a non-recursive mutual exclusion lock
+    // that grants ownership in first-in, first-out order, and waits by
+    // spinning with backoff proportional to the number of waiters ahead.  An
+    // object of this type must be initialized using
+    // 'BSLS_TICKETLOCK_UNLOCKED' or 'initialize' before use.
+
+  public:
+    // TYPES
+    enum {
+        k_PAUSES_PER_WAITER   = 64,  // pauses per waiter ahead, per poll
+
+        k_MAX_PAUSING_WAITERS = 16   // with this many waiters ahead, or
+                                     // more, 'lock' yields instead of pausing
+    };
+
+    // PUBLIC DATA
+    AtomicOperations::AtomicTypes::Int d_nextTicket;  // ticket given to the
+                                                      // next requester
+
+    AtomicOperations::AtomicTypes::Int d_nowServing;  // ticket of the owner
+
+    // MANIPULATORS
+    void initialize();
+        // Put this lock into the unlocked state.  The behavior is undefined
+        // if any thread holds, or is waiting for, this lock.
+
+    void lock();
+        // Acquire this lock, after all threads that previously requested it,
+        // waiting for as long as is necessary.  The behavior is undefined if
+        // the calling thread already holds this lock.
+
+    int tryLock();
+        // Acquire this lock if it is neither held nor requested by another
+        // thread.  Return 0 on success, and a non-zero value (with no effect)
+        // otherwise.
+
+    void unlock();
+        // Release this lock, passing it to the longest-waiting thread, if
+        // any.  The behavior is undefined unless the calling thread holds this
+        // lock.
+
+    // ACCESSORS
+    bool isLocked() const;
+        // Return 'true' if this lock is held by some thread, and 'false'
+        // otherwise.  Note that the returned value may be out of date before
+        // it is examined, and is intended for testing and diagnostics only.
+};
+
+                              // ================
+                              // class HybridLock
+                              // ================
+
+class HybridLock {
+    // This aggregate 'class' provides a non-recursive, unfair mutual
+    // exclusion lock that spins with backoff for a bounded time, then blocks
+    // in the kernel (on Linux) until the lock is released.  An object of this
+    // type must be initialized using 'BSLS_HYBRIDLOCK_UNLOCKED' or
+    // 'initialize' before use.
+
+  public:
+    // TYPES
+    enum {
+        k_UNLOCKED  = 0,  // lock is free
+        k_LOCKED    = 1,  // lock is held, and no thread is blocked
+        k_CONTENDED = 2,  // lock is held, and threads may be blocked
+
+        k_NUM_SPINS = 16  // number of backoff steps before blocking
+    };
+
+    // PUBLIC DATA
+    AtomicOperations::AtomicTypes::Int d_state;  // one of the state values
+                                                 // above; public only to
+                                                 // permit static
+                                                 // initialization
+
+  private:
+    // PRIVATE MANIPULATORS
+    void lockContended();
+        // Acquire this lock, spinning and then blocking as necessary.  This
+        // method is called by 'lock' only if the lock was not acquired on the
+        // first attempt.
+
+    void unlockContended();
+        // Release this lock and wake a blocked thread.  This method is called
+        // by 'unlock' only if threads may be blocked.
+
+  public:
+    // MANIPULATORS
+    void initialize();
+        // Put this lock into the unlocked state.  The behavior is undefined
+        // if any thread holds, or is waiting for, this lock.
+
+    void lock();
+        // Acquire this lock, waiting for as long as is necessary.  The
+        // behavior is undefined if the calling thread already holds this
+        // lock.
+
+    int tryLock();
+        // Acquire this lock if it is available without waiting.  Return 0 on
+        // success, and a non-zero value (with no effect) if the lock is held
+        // by another thread.
+
+    void unlock();
+        // Release this lock, waking a blocked thread if there is one.  The
+        // behavior is undefined unless the calling thread holds this lock.
+
+    // ACCESSORS
+    bool isLocked() const;
+        // Return 'true' if this lock is held by some thread, and 'false'
+        // otherwise.  Note that the returned value may be out of date before
+        // it is examined, and is intended for testing and diagnostics only.
+};
+
+                            // ===================
+                            // class SpinLockGuard
+                            // ===================
+
+template <class LOCK>
+class SpinLockGuard {
+    // This class implements a scoped guard that acquires a lock of the
+    // parameterized 'LOCK' type (which must provide 'lock' and 'unlock'
+    // methods) on construction, and releases it on destruction unless
+    // 'release' has been called.
+
+    // DATA
+    LOCK *d_lock_p;  // guarded lock, or 0 if released (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SpinLockGuard(const SpinLockGuard&);
+    SpinLockGuard& operator=(const SpinLockGuard&);
+
+  public:
+    // CREATORS
+    explicit SpinLockGuard(LOCK *lock);
+        // Create a guard for the specified 'lock', and acquire 'lock'.
+
+    ~SpinLockGuard();
+        // Release the guarded lock, unless 'release' has been called.
+
+    // MANIPULATORS
+    LOCK *release();
+        // Return the address of the guarded lock, and release it from this
+        // guard's management without unlocking it, so that the lock remains
+        // held after this guard is destroyed.  Return 0 if 'release' has
+        // already been called.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ---------------------
+                            // struct SpinLock_Util
+                            // ---------------------
+
+// CLASS METHODS
+inline
+void SpinLock_Util::backoff(int *numSpins)
+{
+    if (*numSpins < k_MAX_BACKOFF_SHIFT) {
+        for (int i = 1 << *numSpins; i > 0; --i) {
+            pause();
+        }
+        ++*numSpins;
+    }
+    else {
+        yield();
+    }
+}
+
+inline
+void SpinLock_Util::pause()
+{
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    __asm__ __volatile__ ("pause" ::: "memory");
+#else
+    __asm__ __volatile__ ("" ::: "memory");
+#endif
+#elif defined(BSLS_PLATFORM_CMP_MSVC)                                         \
+   && (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))
+    _mm_pause();
+#endif
+}
+
+                               // --------------
+                               // class SpinLock
+                               // --------------
+
+// MANIPULATORS
+inline
+void SpinLock::initialize()
+{
+    AtomicOperations::initInt(&d_state, 0);
+}
+
+inline
+void SpinLock::lock()
+{
+    int numSpins = 0;
+    while (AtomicOperations::getIntRelaxed(&d_state)
+        || AtomicOperations::swapIntAcqRel(&d_state, 1)) {
+        SpinLock_Util::backoff(&numSpins);
+    }
+}
+
+inline
+int SpinLock::tryLock()
+{
+    return AtomicOperations::getIntRelaxed(&d_state)
+        || AtomicOperations::swapIntAcqRel(&d_state, 1);
+}
+
+inline
+void SpinLock::unlock()
+{
+    AtomicOperations::setIntRelease(&d_state, 0);
+}
+
+// ACCESSORS
+inline
+bool SpinLock::isLocked() const
+{
+    return 0 != AtomicOperations::getIntRelaxed(&d_state);
+}
+
+                              // ----------------
+                              // class TicketLock
+                              // ----------------
+
+// MANIPULATORS
+inline
+void TicketLock::initialize()
+{
+    AtomicOperations::initInt(&d_nextTicket, 0);
+    AtomicOperations::initInt(&d_nowServing, 0);
+}
+
+inline
+void TicketLock::lock()
+{
+    const int ticket = AtomicOperations::addIntNvAcqRel(&d_nextTicket, 1) - 1;
+
+    int numSpins = 0;
+    int serving;
+    while (ticket != (serving = AtomicOperations::getIntAcquire(
+                                                             &d_nowServing))) {
+        // Pause in proportion to the number of waiters ahead of this one, but
+        // yield if that number is large, or once this thread has waited for
+        // long enough that the owner has likely been preempted.
+
+        const unsigned int ahead = static_cast<unsigned int>(ticket)
+                                 - static_cast<unsigned int>(serving);
+        if (ahead < k_MAX_PAUSING_WAITERS
+         && numSpins < SpinLock_Util::k_MAX_BACKOFF_SHIFT) {
+            for (unsigned int i = ahead * k_PAUSES_PER_WAITER; i > 0; --i) {
+                SpinLock_Util::pause();
+            }
+            ++numSpins;
+        }
+        else {
+            SpinLock_Util::yield();
+        }
+    }
+}
+
+inline
+int TicketLock::tryLock()
+{
+    const int serving = AtomicOperations::getIntAcquire(&d_nowServing);
+    return serving != AtomicOperations::testAndSwapIntAcqRel(&d_nextTicket,
+                                                             serving,
+                                                             serving + 1);
+}
+
+inline
+void TicketLock::unlock()
+{
+    // Only the owner writes 'd_nowServing', so a relaxed load suffices.
+
+    AtomicOperations::setIntRelease(
+                         &d_nowServing,
+                         AtomicOperations::getIntRelaxed(&d_nowServing) + 1);
+}
+
+// ACCESSORS
+inline
+bool TicketLock::isLocked() const
+{
+    return AtomicOperations::getIntRelaxed(&d_nowServing)
+        != AtomicOperations::getIntRelaxed(&d_nextTicket);
+}
+
+                              // ----------------
+                              // class HybridLock
+                              // ----------------
+
+// MANIPULATORS
+inline
+void HybridLock::initialize()
+{
+    AtomicOperations::initInt(&d_state, k_UNLOCKED);
+}
+
+inline
+void HybridLock::lock()
+{
+    if (k_UNLOCKED != AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                             k_UNLOCKED,
+                                                             k_LOCKED)) {
+        lockContended();
+    }
+}
+
+inline
+int HybridLock::tryLock()
+{
+    return k_UNLOCKED != AtomicOperations::testAndSwapIntAcqRel(&d_state,
+                                                                k_UNLOCKED,
+                                                                k_LOCKED);
+}
+
+inline
+void HybridLock::unlock()
+{
+    if (k_CONTENDED == AtomicOperations::swapIntAcqRel(&d_state,
+                                                       k_UNLOCKED)) {
+        unlockContended();
+    }
+}
+
+// ACCESSORS
+inline
+bool HybridLock::isLocked() const
+{
+    return k_UNLOCKED != AtomicOperations::getIntRelaxed(&d_state);
+}
+
+                            // -------------------
+                            // class SpinLockGuard
+                            // -------------------
+
+// CREATORS
+template <class LOCK>
+inline
+SpinLockGuard<LOCK>::SpinLockGuard(LOCK *lock)
+: d_lock_p(lock)
+{
+    d_lock_p->lock();
+}
+
+template <class LOCK>
+inline
+SpinLockGuard<LOCK>::~SpinLockGuard()
+{
+    if (d_lock_p) {
+        d_lock_p->unlock();
+    }
+}
+
+// MANIPULATORS
+template <class LOCK>
+inline
+LOCK *SpinLockGuard<LOCK>::release()
+{
+    LOCK *lock = d_lock_p;
+    d_lock_p = 0;
+    return lock;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
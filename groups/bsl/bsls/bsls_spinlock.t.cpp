@@ -0,0 +1,910 @@
+// bsls_spinlock.t.cpp                                                -*-C++-*-
+
+#include <bsls_spinlock.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <limits.h>     // INT_MAX
+#include <stdio.h>
+#include <stdlib.h>     // atoi()
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides three lock types sharing one interface,
+// and a guard.  Each lock is first tested single-threaded, to verify its state
+// transitions (including those of a statically initialized object), and the
+// guard is tested with each lock type.  Mutual exclusion is then verified by
+// having several threads increment a non-atomic counter under each lock.  A
+// performance test (negative case) measures the throughput of each lock, and
+// of the system mutex, under contention from 1 to 64 threads.
+//-----------------------------------------------------------------------------
+// bsls::SpinLock
+// [ 1] BSLS_SPINLOCK_UNLOCKED
+// [ 1] void initialize();
+// [ 1] void lock();
+// [ 1] int tryLock();
+// [ 1] void unlock();
+// [ 1] bool isLocked() const;
+//
+// bsls::TicketLock
+// [ 2] BSLS_TICKETLOCK_UNLOCKED
+// [ 2] void initialize();
+// [ 2] void lock();
+// [ 2] int tryLock();
+// [ 2] void unlock();
+// [ 2] bool isLocked() const;
+//
+// bsls::HybridLock
+// [ 3] BSLS_HYBRIDLOCK_UNLOCKED
+// [ 3] void initialize();
+// [ 3] void lock();
+// [ 3] int tryLock();
+// [ 3] void unlock();
+// [ 3] bool isLocked() const;
+//
+// bsls::SpinLockGuard
+// [ 4] explicit SpinLockGuard(LOCK *lock);
+// [ 4] ~SpinLockGuard();
+// [ 4] LOCK *release();
+//-----------------------------------------------------------------------------
+// [ 5] CONCURRENCY: MUTUAL EXCLUSION
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: CONTENTION COMPARED WITH THE SYSTEM MUTEX
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+//=============================================================================
+//                              HELPER FUNCTIONS
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+                            // =================
+                            // class SystemMutex
+                            // =================
+
+class SystemMutex {
+    // This class wraps the operating system's mutex in the interface of the
+    // locks under test, for comparison.
+
+    // DATA
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    CRITICAL_SECTION d_mutex;
+#else
+    pthread_mutex_t  d_mutex;
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    SystemMutex(const SystemMutex&);
+    SystemMutex& operator=(const SystemMutex&);
+
+  public:
+    // CREATORS
+    SystemMutex()
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        InitializeCriticalSection(&d_mutex);
+#else
+        pthread_mutex_init(&d_mutex, 0);
+#endif
+    }
+
+    ~SystemMutex()
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        DeleteCriticalSection(&d_mutex);
+#else
+        pthread_mutex_destroy(&d_mutex);
+#endif
+    }
+
+    // MANIPULATORS
+    void lock()
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        EnterCriticalSection(&d_mutex);
+#else
+        pthread_mutex_lock(&d_mutex);
+#endif
+    }
+
+    void unlock()
+    {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        LeaveCriticalSection(&d_mutex);
+#else
+        pthread_mutex_unlock(&d_mutex);
+#endif
+    }
+};
+
+                            // =====================
+                            // struct CountingLock
+                            // =====================
+
+struct CountingLock {
+    // This 'struct' provides a lock-like type that counts the calls to its
+    // 'lock' and 'unlock' methods, for testing 'bsls::SpinLockGuard'.
+
+    // DATA
+    int d_numLocks;
+    int d_numUnlocks;
+
+    // MANIPULATORS
+    void lock()   { ++d_numLocks;   }
+    void unlock() { ++d_numUnlocks; }
+};
+
+                            // =================
+                            // struct WorkerArgs
+                            // =================
+
+enum LockType {
+    e_SPIN_LOCK,
+    e_TICKET_LOCK,
+    e_HYBRID_LOCK,
+    e_SYSTEM_MUTEX
+};
+
+struct WorkerArgs {
+    // This 'struct' describes the work of a worker thread: acquire the lock
+    // at 'd_lock_p' (of type 'd_lockType') 'd_numIterations' times, each time
+    // incrementing the shared, non-atomic '*d_counter_p' while holding the
+    // lock.
+
+    LockType          d_lockType;       // type of '*d_lock_p'
+    void             *d_lock_p;         // lock to acquire
+    volatile int     *d_counter_p;      // counter to increment under the lock
+    int               d_numIterations;  // number of increments to perform
+};
+
+template <class LOCK>
+void runWorker(WorkerArgs *args)
+    // Perform the work described by the specified 'args', whose lock is of
+    // the parameterized 'LOCK' type.  Read and write the counter in separate
+    // steps, so that any failure of mutual exclusion is likely to lose an
+    // increment.
+{
+    LOCK *lock = static_cast<LOCK *>(args->d_lock_p);
+
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        lock->lock();
+        const int value = *args->d_counter_p;
+        *args->d_counter_p = value + 1;
+        lock->unlock();
+    }
+}
+
+extern "C" void *workerThread(void *arg)
+{
+    WorkerArgs *args = static_cast<WorkerArgs *>(arg);
+
+    switch (args->d_lockType) {
+      case e_SPIN_LOCK: {
+        runWorker<bsls::SpinLock>(args);
+      } break;
+      case e_TICKET_LOCK: {
+        runWorker<bsls::TicketLock>(args);
+      } break;
+      case e_HYBRID_LOCK: {
+        runWorker<bsls::HybridLock>(args);
+      } break;
+      case e_SYSTEM_MUTEX: {
+        runWorker<SystemMutex>(args);
+      } break;
+    }
+    return 0;
+}
+
+static int runWorkers(LockType  lockType,
+                      void     *lock,
+                      int       numThreads,
+                      int       numIterations)
+    // Run the specified 'numThreads' worker threads, each of which acquires
+    // the specified 'lock' of the specified 'lockType' the specified
+    // 'numIterations' times, incrementing a shared counter under the lock.
+    // Return the final value of the counter.
+{
+    my_thread_t  handles[64];
+    WorkerArgs   args[64];
+    volatile int counter = 0;
+
+    ASSERT(numThreads <= 64);
+
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_lockType      = lockType;
+        args[i].d_lock_p        = lock;
+        args[i].d_counter_p     = &counter;
+        args[i].d_numIterations = numIterations;
+        ASSERT(0 == myCreateThread(&handles[i], &workerThread, &args[i]));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        myJoinThread(handles[i]);
+    }
+    return counter;
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Protecting a Free List
+///- - - - - - - - - - - - - - - - -
+// Suppose that we maintain a pool of fixed-size blocks, whose free list is
+// shared by several threads.  Each operation on the free list takes a handful
+// of instructions, so a spin lock is appropriate.
+//
+// First, we define the pool, having a 'bsls::SpinLock' to protect its free
+// list:
+//..
+    class BlockPool {
+        // This class provides a thread-safe pool of fixed-size blocks.
+
+        // PRIVATE TYPES
+        struct Link {
+            Link *d_next_p;
+        };
+
+        // DATA
+        Link           *d_freeList_p;  // head of free list (owned)
+        bsls::SpinLock  d_lock;        // protects 'd_freeList_p'
+
+      public:
+        // CREATORS
+        BlockPool()
+        : d_freeList_p(0)
+        {
+            d_lock.initialize();
+        }
+
+        // MANIPULATORS
+        void *allocate()
+            // Return a block from the free list, or 0 if the list is empty.
+        {
+            bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+
+            Link *link = d_freeList_p;
+            if (link) {
+                d_freeList_p = link->d_next_p;
+            }
+            return link;
+        }
+
+        void deallocate(void *block)
+            // Return the specified 'block' to the free list.
+        {
+            Link *link = static_cast<Link *>(block);
+
+            bsls::SpinLockGuard<bsls::SpinLock> guard(&d_lock);
+
+            link->d_next_p = d_freeList_p;
+            d_freeList_p   = link;
+        }
+    };
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a pool and give it two blocks:
+//..
+    BlockPool pool;
+
+    void *blocks[2][4];
+    pool.deallocate(blocks[0]);
+    pool.deallocate(blocks[1]);
+//..
+// Now, we allocate the blocks back, in last-in, first-out order:
+//..
+    ASSERT(blocks[1] == pool.allocate());
+    ASSERT(blocks[0] == pool.allocate());
+    ASSERT(0         == pool.allocate());
+//..
+// Finally, we note that a lock having static storage duration is initialized
+// without a call to 'initialize', and may be used immediately:
+//..
+    static bsls::TicketLock s_lock = BSLS_TICKETLOCK_UNLOCKED;
+
+    ASSERT(0 == s_lock.tryLock());
+    s_lock.unlock();
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: MUTUAL EXCLUSION
+        //
+        // Concerns:
+        //: 1 Each lock admits at most one thread at a time to its critical
+        //:   section, and a write made under the lock is visible to the next
+        //:   thread to acquire it.
+        //:
+        //: 2 Each lock makes progress when there are more threads than
+        //:   processors (i.e., a preempted owner is not starved by its
+        //:   waiters).
+        //
+        // Plan:
+        //: 1 For each lock type, and for 2, 4, and 16 threads, have each
+        //:   thread increment a shared, non-atomic counter a fixed number of
+        //:   times under the lock, and verify that no increment is lost.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY: MUTUAL EXCLUSION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: MUTUAL EXCLUSION"
+                            "\n=============================\n");
+
+        const int NUM_ITERATIONS = 20000;
+        const int THREADS[]      = { 2, 4, 16 };
+        const int NUM_THREADS    = sizeof THREADS / sizeof *THREADS;
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int N = THREADS[ti];
+
+            if (veryVerbose) { T_ P(N); }
+
+            bsls::SpinLock spinLock = BSLS_SPINLOCK_UNLOCKED;
+            LOOP_ASSERT(N, N * NUM_ITERATIONS ==
+                      runWorkers(e_SPIN_LOCK, &spinLock, N, NUM_ITERATIONS));
+            LOOP_ASSERT(N, !spinLock.isLocked());
+
+            bsls::TicketLock ticketLock = BSLS_TICKETLOCK_UNLOCKED;
+            LOOP_ASSERT(N, N * NUM_ITERATIONS ==
+                  runWorkers(e_TICKET_LOCK, &ticketLock, N, NUM_ITERATIONS));
+            LOOP_ASSERT(N, !ticketLock.isLocked());
+
+            bsls::HybridLock hybridLock = BSLS_HYBRIDLOCK_UNLOCKED;
+            LOOP_ASSERT(N, N * NUM_ITERATIONS ==
+                  runWorkers(e_HYBRID_LOCK, &hybridLock, N, NUM_ITERATIONS));
+            LOOP_ASSERT(N, !hybridLock.isLocked());
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'SpinLockGuard'
+        //
+        // Concerns:
+        //: 1 The guard acquires its lock on construction and releases it on
+        //:   destruction.
+        //:
+        //: 2 'release' returns the address of the lock, and prevents the
+        //:   destructor from releasing it.  A second call returns 0.
+        //:
+        //: 3 The guard may be used with each lock type in this component.
+        //
+        // Plan:
+        //: 1 Using a lock type that counts calls, verify the calls made by
+        //:   the guard's constructor, 'release', and destructor.  (C-1..2)
+        //:
+        //: 2 For each lock type in this component, verify the state of the
+        //:   lock within and after the scope of a guard.  (C-3)
+        //
+        // Testing:
+        //   explicit SpinLockGuard(LOCK *lock);
+        //   ~SpinLockGuard();
+        //   LOCK *release();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'SpinLockGuard'"
+                            "\n===============\n");
+
+        {
+            CountingLock mX = { 0, 0 };
+            {
+                bsls::SpinLockGuard<CountingLock> guard(&mX);
+                ASSERT(1 == mX.d_numLocks);
+                ASSERT(0 == mX.d_numUnlocks);
+            }
+            ASSERT(1 == mX.d_numLocks);
+            ASSERT(1 == mX.d_numUnlocks);
+
+            {
+                bsls::SpinLockGuard<CountingLock> guard(&mX);
+                ASSERT(2   == mX.d_numLocks);
+                ASSERT(&mX == guard.release());
+                ASSERT(0   == guard.release());
+            }
+            ASSERT(2 == mX.d_numLocks);
+            ASSERT(1 == mX.d_numUnlocks);
+        }
+
+        {
+            bsls::SpinLock mX = BSLS_SPINLOCK_UNLOCKED;
+            {
+                bsls::SpinLockGuard<bsls::SpinLock> guard(&mX);
+                ASSERT(mX.isLocked());
+            }
+            ASSERT(!mX.isLocked());
+        }
+
+        {
+            bsls::TicketLock mX = BSLS_TICKETLOCK_UNLOCKED;
+            {
+                bsls::SpinLockGuard<bsls::TicketLock> guard(&mX);
+                ASSERT(mX.isLocked());
+            }
+            ASSERT(!mX.isLocked());
+        }
+
+        {
+            bsls::HybridLock mX = BSLS_HYBRIDLOCK_UNLOCKED;
+            {
+                bsls::SpinLockGuard<bsls::HybridLock> guard(&mX);
+                ASSERT(mX.isLocked());
+            }
+            ASSERT(!mX.isLocked());
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'HybridLock'
+        //
+        // Concerns:
+        //: 1 A lock initialized by 'BSLS_HYBRIDLOCK_UNLOCKED', or by
+        //:   'initialize', is unlocked.
+        //:
+        //: 2 'lock' and a successful 'tryLock' put the lock in the locked
+        //:   (uncontended) state, and 'unlock' makes it available again.
+        //:
+        //: 3 'tryLock' fails, with no effect, on a locked lock (whether
+        //:   contended or not).
+        //:
+        //: 4 'unlock' of a contended lock, with no thread actually blocked,
+        //:   makes the lock available.
+        //:
+        //: 5 A thread blocked in 'lock' acquires the lock when it is released.
+        //
+        // Plan:
+        //: 1 Verify the state of the lock word and of 'isLocked' after each
+        //:   operation in a sequence.  Force the contended state by writing
+        //:   the lock word directly.  (C-1..4)
+        //:
+        //: 2 Hold the lock while a second thread calls 'lock', and release it
+        //:   after the second thread has had time to block; verify that the
+        //:   second thread then acquires the lock.  (C-5)
+        //
+        // Testing:
+        //   BSLS_HYBRIDLOCK_UNLOCKED
+        //   void initialize();
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        //   bool isLocked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'HybridLock'"
+                            "\n============\n");
+
+        typedef bsls::HybridLock Obj;
+
+        Obj mX = BSLS_HYBRIDLOCK_UNLOCKED;  const Obj& X = mX;
+        ASSERT(Obj::k_UNLOCKED == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        ASSERT(Obj::k_LOCKED == mX.d_state.d_value);
+        ASSERT(X.isLocked());
+        ASSERT(0 != mX.tryLock());
+        ASSERT(Obj::k_LOCKED == mX.d_state.d_value);
+
+        mX.unlock();
+        ASSERT(Obj::k_UNLOCKED == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        ASSERT(0 == mX.tryLock());
+        ASSERT(Obj::k_LOCKED == mX.d_state.d_value);
+
+        bsls::AtomicOperations::setInt(&mX.d_state, Obj::k_CONTENDED);
+        ASSERT(X.isLocked());
+        ASSERT(0 != mX.tryLock());
+        ASSERT(Obj::k_CONTENDED == mX.d_state.d_value);
+
+        mX.unlock();
+        ASSERT(Obj::k_UNLOCKED == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        mX.initialize();
+        ASSERT(Obj::k_UNLOCKED == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        {
+            mX.lock();
+
+            volatile int counter = 0;
+            WorkerArgs   args;
+            args.d_lockType      = e_HYBRID_LOCK;
+            args.d_lock_p        = &mX;
+            args.d_counter_p     = &counter;
+            args.d_numIterations = 1;
+
+            my_thread_t handle;
+            ASSERT(0 == myCreateThread(&handle, &workerThread, &args));
+
+            // Wait for the worker to mark the lock as contended (i.e., to
+            // block), or for a time limit to pass.
+
+            const Int64 start = bsls::TimeUtil::getTimer();
+            while (Obj::k_CONTENDED != bsls::AtomicOperations::getInt(
+                                                                 &mX.d_state)
+                && bsls::TimeUtil::getTimer() - start < 1000 * 1000 * 1000) {
+                bsls::SpinLock_Util::yield();
+            }
+            if (veryVerbose) { T_ P(mX.d_state.d_value); }
+            ASSERT(0 == counter);
+
+            mX.unlock();
+            myJoinThread(handle);
+
+            ASSERT(1 == counter);
+            ASSERT(!X.isLocked());
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'TicketLock'
+        //
+        // Concerns:
+        //: 1 A lock initialized by 'BSLS_TICKETLOCK_UNLOCKED', or by
+        //:   'initialize', is unlocked.
+        //:
+        //: 2 'lock' and a successful 'tryLock' each take one ticket, and
+        //:   'unlock' serves the next ticket.
+        //:
+        //: 3 'tryLock' fails, with no effect, on a locked lock.
+        //:
+        //: 4 The lock operates correctly when the ticket counters wrap
+        //:   around.
+        //
+        // Plan:
+        //: 1 Verify the ticket counters and 'isLocked' after each operation
+        //:   in a sequence.  (C-1..3)
+        //:
+        //: 2 Set both ticket counters to just below 'INT_MAX', and repeat the
+        //:   sequence across the wrap-around.  (C-4)
+        //
+        // Testing:
+        //   BSLS_TICKETLOCK_UNLOCKED
+        //   void initialize();
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        //   bool isLocked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'TicketLock'"
+                            "\n============\n");
+
+        typedef bsls::TicketLock Obj;
+
+        Obj mX = BSLS_TICKETLOCK_UNLOCKED;  const Obj& X = mX;
+        ASSERT(0 == mX.d_nextTicket.d_value);
+        ASSERT(0 == mX.d_nowServing.d_value);
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        ASSERT(1 == mX.d_nextTicket.d_value);
+        ASSERT(0 == mX.d_nowServing.d_value);
+        ASSERT(X.isLocked());
+        ASSERT(0 != mX.tryLock());
+        ASSERT(1 == mX.d_nextTicket.d_value);
+
+        mX.unlock();
+        ASSERT(1 == mX.d_nowServing.d_value);
+        ASSERT(!X.isLocked());
+
+        ASSERT(0 == mX.tryLock());
+        ASSERT(2 == mX.d_nextTicket.d_value);
+        ASSERT(X.isLocked());
+        mX.unlock();
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        mX.initialize();
+        ASSERT(0 == mX.d_nextTicket.d_value);
+        ASSERT(0 == mX.d_nowServing.d_value);
+        ASSERT(!X.isLocked());
+
+        if (veryVerbose) printf("\tTicket wrap-around.\n");
+
+        bsls::AtomicOperations::setInt(&mX.d_nextTicket, INT_MAX - 1);
+        bsls::AtomicOperations::setInt(&mX.d_nowServing, INT_MAX - 1);
+        ASSERT(!X.isLocked());
+
+        for (int i = 0; i < 4; ++i) {
+            mX.lock();
+            LOOP_ASSERT(i, X.isLocked());
+            LOOP_ASSERT(i, 0 != mX.tryLock());
+            mX.unlock();
+            LOOP_ASSERT(i, !X.isLocked());
+
+            LOOP_ASSERT(i, 0 == mX.tryLock());
+            LOOP_ASSERT(i, X.isLocked());
+            mX.unlock();
+            LOOP_ASSERT(i, !X.isLocked());
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // 'SpinLock'
+        //
+        // Concerns:
+        //: 1 A lock initialized by 'BSLS_SPINLOCK_UNLOCKED', or by
+        //:   'initialize', is unlocked.
+        //:
+        //: 2 'lock' and a successful 'tryLock' lock the lock, and 'unlock'
+        //:   unlocks it.
+        //:
+        //: 3 'tryLock' fails, with no effect, on a locked lock.
+        //:
+        //: 4 A statically initialized lock is unlocked before any dynamic
+        //:   initialization.
+        //
+        // Plan:
+        //: 1 Verify the lock word and 'isLocked' after each operation in a
+        //:   sequence.  (C-1..3)
+        //:
+        //: 2 Verify the state of a lock at namespace scope.  (C-4)
+        //
+        // Testing:
+        //   BSLS_SPINLOCK_UNLOCKED
+        //   void initialize();
+        //   void lock();
+        //   int tryLock();
+        //   void unlock();
+        //   bool isLocked() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'SpinLock'"
+                            "\n==========\n");
+
+        typedef bsls::SpinLock Obj;
+
+        Obj mX = BSLS_SPINLOCK_UNLOCKED;  const Obj& X = mX;
+        ASSERT(0 == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        ASSERT(1 == mX.d_state.d_value);
+        ASSERT(X.isLocked());
+        ASSERT(0 != mX.tryLock());
+        ASSERT(X.isLocked());
+
+        mX.unlock();
+        ASSERT(0 == mX.d_state.d_value);
+        ASSERT(!X.isLocked());
+
+        ASSERT(0 == mX.tryLock());
+        ASSERT(X.isLocked());
+        mX.unlock();
+        ASSERT(!X.isLocked());
+
+        mX.lock();
+        mX.initialize();
+        ASSERT(!X.isLocked());
+
+        static Obj s_lock = BSLS_SPINLOCK_UNLOCKED;
+        ASSERT(!s_lock.isLocked());
+        ASSERT(0 == s_lock.tryLock());
+        s_lock.unlock();
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: CONTENTION COMPARED WITH THE SYSTEM MUTEX
+        //
+        // Concerns:
+        //: 1 The locks in this component are cheaper than the system mutex
+        //:   when uncontended, and remain competitive under contention.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, 8, 16, 32, and 64 threads, have each thread acquire
+        //:   and release each lock type, and the system mutex, a fixed number
+        //:   of times (incrementing a shared counter under the lock), and
+        //:   report the average elapsed time per acquisition.  The number of
+        //:   iterations may be given as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: CONTENTION COMPARED WITH THE SYSTEM MUTEX
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: CONTENTION COMPARED WITH THE SYSTEM MUTEX"
+               "\n======================================================\n");
+
+        const int TOTAL_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+        const int MAX_THREADS      = 64;
+
+        bsls::SpinLock   spinLock   = BSLS_SPINLOCK_UNLOCKED;
+        bsls::TicketLock ticketLock = BSLS_TICKETLOCK_UNLOCKED;
+        bsls::HybridLock hybridLock = BSLS_HYBRIDLOCK_UNLOCKED;
+        SystemMutex      systemMutex;
+
+        const struct {
+            LockType    d_lockType;
+            void       *d_lock_p;
+            const char *d_name;
+        } LOCKS[] = {
+            { e_SPIN_LOCK,    &spinLock,    "SpinLock"    },
+            { e_TICKET_LOCK,  &ticketLock,  "TicketLock"  },
+            { e_HYBRID_LOCK,  &hybridLock,  "HybridLock"  },
+            { e_SYSTEM_MUTEX, &systemMutex, "SystemMutex" },
+        };
+        const int NUM_LOCKS = sizeof LOCKS / sizeof *LOCKS;
+
+        printf("%-12s %8s %12s\n", "lock", "threads", "ns/lock");
+
+        for (int li = 0; li < NUM_LOCKS; ++li) {
+            for (int n = 1; n <= MAX_THREADS; n *= 2) {
+                const int numIterations = TOTAL_ITERATIONS / n;
+
+                const Int64 start   = bsls::TimeUtil::getTimer();
+                const int   counter = runWorkers(LOCKS[li].d_lockType,
+                                                 LOCKS[li].d_lock_p,
+                                                 n,
+                                                 numIterations);
+                const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+                LOOP2_ASSERT(li, n, n * numIterations == counter);
+
+                printf("%-12s %8d %12.2f\n",
+                       LOCKS[li].d_name,
+                       n,
+                       static_cast<double>(elapsed) / (n * numIterations));
+            }
+        }
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
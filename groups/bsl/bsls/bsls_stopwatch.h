@@ -35,6 +35,19 @@ BSLS_IDENT("$Id: $")
 // 'bsls::Stopwatch' may be slow or inconsistent on some Windows machines.  See
 // the 'Accuracy and Precision' section of 'bsls_timeutil.h'.
 //
+///Fast Wall-Time Measurement
+///- - - - - - - - - - - - -
+// A stopwatch constructed with 'useFastTimer' set to 'true' measures wall
+// time with 'bsls::TimeUtil::getFastTimer' rather than
+// 'bsls::TimeUtil::getTimer'.  On platforms where the fast timer reads a
+// calibrated cycle counter, starting and stopping such a stopwatch costs a few
+// nanoseconds, making it suitable for timing short sections of hot code.  The
+// fast timer is calibrated (if necessary) when the stopwatch is constructed,
+// so the calibration cost is never included in a measurement.  Where no
+// suitable cycle counter is available, the fast timer (and hence the
+// stopwatch) falls back to 'bsls::TimeUtil::getTimer'.  System and user times
+// are collected identically in either mode.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate basic use of a 'bsls::Stopwatch'
@@ -120,6 +133,9 @@ class Stopwatch {
                                            // wall time when
                                            // started (nanoseconds)
 
+    Types::Int64 d_startFastTime;          // fast-timer wall time when
+                                           // started (nanoseconds)
+
     Types::Int64 d_accumulatedSystemTime;  // accumulated system
                                            // time (nanoseconds)
 
@@ -135,6 +151,9 @@ class Stopwatch {
     bool         d_collectCpuTimesFlag;    // 'true' if cpu times
                                            // are being collected
 
+    bool         d_useFastTimerFlag;       // 'true' if wall time is
+                                           // measured with the fast timer
+
     // CLASS DATA
     static const double      s_nanosecondsPerSecond;   // conversion factor
                                                        // (for nanoseconds to
@@ -150,17 +169,14 @@ class Stopwatch {
     void updateTimes();
         // Update the CPU times accumulated but this stopwatch.
 
-    // PRIVATE ACCESSORS
-    void accumulatedTimesRaw(Types::Int64               *systemTime,
-                             Types::Int64               *userTime,
-                             TimeUtil::OpaqueNativeTime *wallTime) const;
-        // Load into the specified 'systemTime', 'userTime', and 'wallTime' the
-        // values of the system time, user time, and wall time (in
-        // nanoseconds), respectively, as provided by 'TimeUtil'.
+    void startWallTime();
+        // Record the current wall time, as read from the timer selected at
+        // construction, as the time at which this stopwatch was started.
 
-    Types::Int64 elapsedWallTime(TimeUtil::OpaqueNativeTime rawWallTime) const;
-        // Return the elapsed time, in nanoseconds, between the current
-        // 'd_startWallTime' and the specified 'rawWallTime'.
+    // PRIVATE ACCESSORS
+    Types::Int64 elapsedWallTime() const;
+        // Return the elapsed wall time, in nanoseconds, between the time
+        // recorded by the most recent call to 'startWallTime' and now.
 
   public:
     // CREATORS
@@ -168,6 +184,14 @@ class Stopwatch {
         // Create a stopwatch in the STOPPED state having total accumulated
         // system, user, and wall times all equal to 0.0.
 
+    explicit Stopwatch(bool useFastTimer);
+        // Create a stopwatch in the STOPPED state having total accumulated
+        // system, user, and wall times all equal to 0.0 that measures wall
+        // time with 'TimeUtil::getFastTimer' if the specified 'useFastTimer'
+        // is 'true', and with 'TimeUtil::getTimer' otherwise.  Note that the
+        // fast timer is initialized (and calibrated, if necessary) by this
+        // constructor.
+
     //! ~Stopwatch();
         // Destroy this stopwatch.  Note that this method's definition is
         // compiler generated.
@@ -225,6 +249,10 @@ class Stopwatch {
     bool isRunning() const;
         // Return 'true' if this stopwatch is in the RUNNING state, and 'false'
         // otherwise.
+
+    bool usesFastTimer() const;
+        // Return 'true' if this stopwatch measures wall time with
+        // 'TimeUtil::getFastTimer', and 'false' otherwise.
 };
 
 // ============================================================================
@@ -235,25 +263,32 @@ class Stopwatch {
                             // class Stopwatch
                             // ---------------
 
-// PRIVATE ACCESSORS
+// PRIVATE MANIPULATORS
 inline
-void Stopwatch::accumulatedTimesRaw(Types::Int64               *systemTime,
-                                    Types::Int64               *userTime,
-                                    TimeUtil::OpaqueNativeTime *wallTime) const
+void Stopwatch::startWallTime()
 {
-    TimeUtil::getProcessTimers(systemTime, userTime);
-    TimeUtil::getTimerRaw(wallTime);
+    if (d_useFastTimerFlag) {
+        d_startFastTime = TimeUtil::getFastTimer();
+    }
+    else {
+        TimeUtil::getTimerRaw(&d_startWallTime);
+    }
 }
 
+// PRIVATE ACCESSORS
 inline
-Types::Int64 Stopwatch::elapsedWallTime(
-                                  TimeUtil::OpaqueNativeTime rawWallTime) const
+Types::Int64 Stopwatch::elapsedWallTime() const
 {
-    return TimeUtil::convertRawTime(rawWallTime)
+    if (d_useFastTimerFlag) {
+        return TimeUtil::getFastTimer() - d_startFastTime;            // RETURN
+    }
+
+    TimeUtil::OpaqueNativeTime now;
+    TimeUtil::getTimerRaw(&now);
+    return TimeUtil::convertRawTime(now)
          - TimeUtil::convertRawTime(d_startWallTime);
 }
 
-
 // CREATORS
 inline
 Stopwatch::Stopwatch()
@@ -262,10 +297,26 @@ Stopwatch::Stopwatch()
 , d_accumulatedWallTime(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
+, d_useFastTimerFlag(false)
 {
     TimeUtil::initialize();
 }
 
+inline
+Stopwatch::Stopwatch(bool useFastTimer)
+: d_accumulatedSystemTime(0)
+, d_accumulatedUserTime(0)
+, d_accumulatedWallTime(0)
+, d_isRunning(false)
+, d_collectCpuTimesFlag(false)
+, d_useFastTimerFlag(useFastTimer)
+{
+    TimeUtil::initialize();
+    if (d_useFastTimerFlag) {
+        TimeUtil::initializeFastTimer();
+    }
+}
+
 // MANIPULATORS
 inline
 void Stopwatch::reset()
@@ -282,13 +333,9 @@ void Stopwatch::start(bool collectCpuTimes)
     if (!d_isRunning) {
         d_collectCpuTimesFlag = collectCpuTimes;
         if (d_collectCpuTimesFlag) {
-            accumulatedTimesRaw(&d_startSystemTime,
-                                &d_startUserTime,
-                                &d_startWallTime);
-        }
-        else {
-            TimeUtil::getTimerRaw(&d_startWallTime);
+            TimeUtil::getProcessTimers(&d_startSystemTime, &d_startUserTime);
         }
+        startWallTime();
         d_isRunning = true;
     }
 }
@@ -301,9 +348,7 @@ void Stopwatch::stop()
             updateTimes();
         }
         else {
-            TimeUtil::OpaqueNativeTime now;
-            TimeUtil::getTimerRaw(&now);
-            d_accumulatedWallTime += elapsedWallTime(now);
+            d_accumulatedWallTime += elapsedWallTime();
         }
         d_isRunning = false;
     }
@@ -346,9 +391,7 @@ inline
 double Stopwatch::accumulatedWallTime() const
 {
     if (d_isRunning) {
-        TimeUtil::OpaqueNativeTime now;
-        TimeUtil::getTimerRaw(&now);
-        return (double)(d_accumulatedWallTime + elapsedWallTime(now))
+        return (double)(d_accumulatedWallTime + elapsedWallTime())
                                                       / s_nanosecondsPerSecond;
                                                                       // RETURN
     }
@@ -367,6 +410,12 @@ bool Stopwatch::isRunning() const
     return d_isRunning;
 }
 
+inline
+bool Stopwatch::usesFastTimer() const
+{
+    return d_useFastTimerFlag;
+}
+
 }  // close package namespace
 
 
@@ -47,10 +47,13 @@ using namespace std;
 // [ 4] double accumulatedWallTime() const;
 // [ 5] void accumulatedTimes(double*, double*, double*) const;
 // [ 4] double elapsedTime() const;
+// [ 7] explicit bsls::Stopwatch(bool useFastTimer);
+// [ 7] bool usesFastTimer() const;
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 6] USAGE Example
+// [ 6] Negative Times
+// [ 8] USAGE Example
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -237,7 +240,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -283,6 +286,139 @@ int main(int argc, char *argv[])
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING FAST-TIMER STOPWATCH
+        //
+        // Concerns:
+        //: 1 The default constructor creates a stopwatch that does not use
+        //:   the fast timer; 'bsls::Stopwatch(bool)' uses the fast timer
+        //:   exactly when its argument is 'true'.
+        //:
+        //: 2 A fast-timer stopwatch accumulates wall time across multiple
+        //:   runs, and the accumulated time is non-decreasing while it is
+        //:   running.
+        //:
+        //: 3 The wall time accumulated by a fast-timer stopwatch agrees with
+        //:   that measured by 'TimeUtil::getTimer'.
+        //:
+        //: 4 A fast-timer stopwatch collects system and user times when
+        //:   started with 'collectCpuTimes' set to 'true'.
+        //:
+        //: 5 'reset' restores a fast-timer stopwatch to the initial state,
+        //:   but does not change the timer it uses.
+        //
+        // Plan:
+        //: 1 Construct stopwatches with each constructor and check
+        //:   'usesFastTimer'.  (C-1)
+        //:
+        //: 2 Start and stop a fast-timer stopwatch several times, bracketing
+        //:   each run with calls to 'TimeUtil::getTimer', and verify that
+        //:   the accumulated wall time lies within the total bracketed time
+        //:   (allowing a small tolerance), and is non-decreasing when
+        //:   sampled while running.  (C-2..3)
+        //:
+        //: 3 Start a fast-timer stopwatch with 'collectCpuTimes' set, spin
+        //:   until some user time has elapsed, and verify 'accumulatedTimes'.
+        //:   (C-4)
+        //:
+        //: 4 Reset the stopwatch and verify the accumulated times and
+        //:   'usesFastTimer'.  (C-5)
+        //
+        // Testing:
+        //   explicit bsls::Stopwatch(bool useFastTimer);
+        //   bool usesFastTimer() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING FAST-TIMER STOPWATCH"
+                          << "\n============================" << endl;
+
+        {
+            Obj mX;         const Obj& X = mX;
+            Obj mY(false);  const Obj& Y = mY;
+            Obj mZ(true);   const Obj& Z = mZ;
+
+            ASSERT(false == X.usesFastTimer());
+            ASSERT(false == Y.usesFastTimer());
+            ASSERT(true  == Z.usesFastTimer());
+
+            ASSERT(false == Z.isRunning());
+            ASSERT(0.0   == Z.accumulatedWallTime());
+        }
+
+        const double TOLERANCE = 1e-4;  // 100 microseconds
+
+        Obj mX(true);  const Obj& X = mX;
+
+        {
+            Int64 bracketed = 0;
+            for (int i = 0; i < 5; ++i) {
+                const Int64 before = TU::getTimer();
+                mX.start();
+                LOOP_ASSERT(i, X.isRunning());
+
+                double previous = X.accumulatedWallTime();
+                for (int j = 0; j < 1000; ++j) {
+                    const double current = X.accumulatedWallTime();
+                    LOOP3_ASSERT(i, previous, current, previous <= current);
+                    previous = current;
+                }
+
+                mX.stop();
+                const Int64 after = TU::getTimer();
+                bracketed += after - before;
+
+                const double wall    = X.accumulatedWallTime();
+                const double maxWall = (double)bracketed / 1.0e9 + TOLERANCE;
+                if (veryVerbose) { T_(); P_(i); P_(wall); P(maxWall); }
+
+                LOOP3_ASSERT(i, wall, previous, previous <= wall);
+                LOOP3_ASSERT(i, wall, maxWall,  wall <= maxWall);
+            }
+        }
+
+        {
+            const double DELAY = 1e-2;
+
+            mX.reset();
+            const Int64 before = TU::getTimer();
+            mX.start();
+            shortDelay(DELAY, &TU::getTimer);
+            mX.stop();
+            const Int64 after = TU::getTimer();
+
+            const double wall    = X.accumulatedWallTime();
+            const double maxWall = (double)(after - before) / 1.0e9;
+            if (verbose) { T_(); P_(wall); P(maxWall); }
+
+            LOOP_ASSERT(wall, DELAY * 0.99 <= wall);
+            LOOP2_ASSERT(wall, maxWall, wall <= maxWall * 1.01 + TOLERANCE);
+        }
+
+        {
+            mX.reset();
+            mX.start(true);
+            shortDelay(1e-2, &TU::getProcessUserTimer);
+            mX.stop();
+
+            double systemTime, userTime, wallTime;
+            X.accumulatedTimes(&systemTime, &userTime, &wallTime);
+            if (verbose) { T_(); P_(systemTime); P_(userTime); P(wallTime); }
+
+            ASSERT(0.0 <= systemTime);
+            ASSERT(0.0 <  userTime);
+            ASSERT(0.0 <  wallTime);
+            ASSERT(userTime == X.accumulatedUserTime());
+            ASSERT(wallTime == X.accumulatedWallTime());
+        }
+
+        mX.reset();
+        ASSERT(false == X.isRunning());
+        ASSERT(true  == X.usesFastTimer());
+        ASSERT(0.0   == X.accumulatedSystemTime());
+        ASSERT(0.0   == X.accumulatedUserTime());
+        ASSERT(0.0   == X.accumulatedWallTime());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // ATTEMPT TO REPRODUCE BUG PRODUCING NEGATIVE TIMES
@@ -27,6 +27,10 @@ BSLS_IDENT("$Id$ $CSID$")
     #include <sys/time.h>  // gettimeofday()
 #endif
 
+#if defined(BSLS_TIMEUTIL_CYCLE_COUNTER) && !defined(BSLS_PLATFORM_CMP_MSVC)
+    #include <cpuid.h>     // __get_cpuid()
+#endif
+
 namespace BloombergLP {
 
 namespace {
@@ -449,10 +453,107 @@ bsls::Types::Int64 WindowsTimerUtil::getTimerRaw()
 
 #endif
 
+#ifdef BSLS_TIMEUTIL_CYCLE_COUNTER
+bool hasInvariantTimeStampCounter()
+    // Return 'true' if the processor provides an invariant time-stamp counter
+    // (i.e., one that runs at a constant rate in all power states, as
+    // reported by bit 8 of the 'EDX' register of CPUID leaf 0x80000007), and
+    // 'false' otherwise.
+{
+    const unsigned int POWER_MANAGEMENT_LEAF = 0x80000007;
+    const unsigned int INVARIANT_TSC_BIT     = 1 << 8;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    int registers[4];  // EAX, EBX, ECX, EDX
+
+    __cpuid(registers, 0x80000000);
+    if (static_cast<unsigned int>(registers[0]) < POWER_MANAGEMENT_LEAF) {
+        return false;                                                 // RETURN
+    }
+    __cpuid(registers, POWER_MANAGEMENT_LEAF);
+    return 0 != (static_cast<unsigned int>(registers[3]) & INVARIANT_TSC_BIT);
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(POWER_MANAGEMENT_LEAF, &eax, &ebx, &ecx, &edx)) {
+        return false;                                                 // RETURN
+    }
+    return 0 != (edx & INVARIANT_TSC_BIT);
+#endif
+}
+#endif
+
 }  // close unnamed namespace
 
 namespace bsls {
 
+                        // -------------------------
+                        // struct TimeUtil_FastTimer
+                        // -------------------------
+
+// CLASS DATA
+AtomicOperations::AtomicTypes::Int TimeUtil_FastTimer::s_mode =
+                                          { TimeUtil_FastTimer::UNINITIALIZED };
+Types::Int64                       TimeUtil_FastTimer::s_counterBase     = 0;
+Types::Int64                       TimeUtil_FastTimer::s_nanosecondsBase = 0;
+Types::Uint64                      TimeUtil_FastTimer::s_multiplier      = 0;
+
+// CLASS METHODS
+int TimeUtil_FastTimer::initialize()
+{
+    int mode = AtomicOperations::testAndSwapIntAcqRel(&s_mode,
+                                                      UNINITIALIZED,
+                                                      INITIALIZING);
+    if (UNINITIALIZED != mode) {
+        // Another thread has calibrated, or is calibrating, the timer.
+
+        while (INITIALIZING == mode) {
+            mode = AtomicOperations::getIntAcquire(&s_mode);
+        }
+        return mode;                                                  // RETURN
+    }
+
+    mode = SYSTEM_TIMER;
+
+#ifdef BSLS_TIMEUTIL_CYCLE_COUNTER
+    if (hasInvariantTimeStampCounter()) {
+        // Measure the rate of the counter against 'getTimer' over about 10
+        // milliseconds.  Busy-waiting (rather than sleeping) keeps the
+        // interval short and the reads of both clocks close together.
+
+        const Types::Int64 CALIBRATION_INTERVAL = 10 * 1000 * 1000;  // nsec
+
+        const Types::Int64 startTime    = TimeUtil::getTimer();
+        const Types::Int64 startCounter = readCounter();
+
+        Types::Int64 endTime;
+        Types::Int64 endCounter;
+        do {
+            endTime    = TimeUtil::getTimer();
+            endCounter = readCounter();
+        } while (endTime - startTime < CALIBRATION_INTERVAL);
+
+        const Types::Uint64 elapsedTime  = endTime    - startTime;
+        const Types::Uint64 elapsedTicks = endCounter - startCounter;
+
+        // The conversion arithmetic requires that the multiplier be less than
+        // 2^32, i.e., that the counter run faster than 1 GHz, which is the
+        // case for all processors providing an invariant counter.
+
+        if (elapsedTicks > elapsedTime) {
+            s_counterBase     = endCounter;
+            s_nanosecondsBase = endTime;
+            s_multiplier      = (elapsedTime << 32) / elapsedTicks;
+
+            mode = CYCLE_COUNTER;
+        }
+    }
+#endif
+
+    AtomicOperations::setIntRelease(&s_mode, mode);
+    return mode;
+}
+
                             // ---------------
                             // struct TimeUtil
                             // ---------------
@@ -76,6 +76,36 @@ BSLS_IDENT("$Id: $")
 // the 'bsls::TimeUtil' high-resolution functions from the nanosecond range to
 // the microsecond range (or worse).
 //
+///Fast Timer
+///----------
+// 'getTimer' and 'getTimerRaw' read the operating system's clock, which
+// typically costs 20 to 100 nanoseconds per call (and much more on some
+// platforms).  For instrumenting code whose own duration is comparable,
+// 'bsls::TimeUtil' also provides a *fast* timer: 'getFastTimerRaw' returns a
+// raw, platform-dependent 64-bit value that 'convertFastTimerRaw' converts to
+// nanoseconds, and 'getFastTimer' combines the two.
+//
+// On x86-64 processors advertising an *invariant* time-stamp counter (TSC) --
+// a counter that runs at a constant rate regardless of frequency scaling and
+// power states, and that is synchronized across cores -- 'getFastTimerRaw'
+// executes a single (inlined) 'rdtsc' instruction, and 'convertFastTimerRaw'
+// a few integer multiplications, so that a timing measurement costs a few
+// nanoseconds.  The conversion factor is computed once per process by
+// calibrating the counter against 'getTimer' over an interval of about 10
+// milliseconds, either when 'initializeFastTimer' is called or, lazily, on
+// first use of the fast timer.  Values returned by 'getFastTimer' are aligned
+// with (and so may be compared to) those returned by 'getTimer' at the time
+// of calibration, but may drift from them over time by the calibration error
+// (typically a few parts per million).  Note that 'rdtsc' is not a serializing
+// instruction, so the processor may execute it out of order with respect to
+// neighboring instructions; measurements of intervals shorter than a few tens
+// of nanoseconds are therefore unreliable.
+//
+// On all other platforms (and on x86-64 processors without an invariant TSC),
+// the fast timer falls back to 'getTimer': the raw value is already in
+// nanoseconds, and 'convertFastTimerRaw' returns it unchanged.
+// 'isFastTimerCycleCounter' indicates which implementation is in use.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use 'bsls::TimeUtil'
@@ -174,6 +204,10 @@ BSLS_IDENT("$Id: $")
 //  }
 //..
 
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -196,10 +230,73 @@ BSLS_IDENT("$Id: $")
     #endif
 #endif
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)      \
+                                    || defined(BSLS_PLATFORM_CMP_MSVC))
+    #define BSLS_TIMEUTIL_CYCLE_COUNTER 1
+        // The fast timer may read the processor's time-stamp counter.
+
+    #if defined(BSLS_PLATFORM_CMP_MSVC)
+        #ifndef INCLUDED_INTRIN
+        #include <intrin.h>
+        #define INCLUDED_INTRIN
+        #endif
+    #endif
+#endif
+
 namespace BloombergLP {
 
 namespace bsls {
 
+                        // =========================
+                        // struct TimeUtil_FastTimer
+                        // =========================
+
+struct TimeUtil_FastTimer {
+    // This 'struct' holds the state of the fast timer provided by 'TimeUtil',
+    // and is for use only by 'TimeUtil'.  The state is written once, by
+    // 'initialize', before 's_mode' is set (with release semantics) to a
+    // value other than 'UNINITIALIZED'.
+
+    // TYPES
+    enum {
+        UNINITIALIZED = 0,  // calibration not yet performed
+        CYCLE_COUNTER = 1,  // raw values are time-stamp counter ticks
+        SYSTEM_TIMER  = 2,  // raw values are 'TimeUtil::getTimer' values
+        INITIALIZING  = 3   // calibration in progress in some thread
+    };
+
+    // CLASS DATA
+    static AtomicOperations::AtomicTypes::Int s_mode;
+                                        // one of the above enumerators
+
+    static Types::Int64                       s_counterBase;
+                                        // counter value at calibration
+
+    static Types::Int64                       s_nanosecondsBase;
+                                        // 'getTimer' value at calibration
+
+    static Types::Uint64                      s_multiplier;
+                                        // nanoseconds per tick, scaled by
+                                        // 2^32 (less than 2^32)
+
+    // CLASS METHODS
+    static int initialize();
+        // Calibrate the fast timer if it has not already been calibrated
+        // (waiting for a calibration in progress in another thread to
+        // complete), and return the resulting mode (either 'CYCLE_COUNTER'
+        // or 'SYSTEM_TIMER').
+
+    static int mode();
+        // Return the mode of the fast timer, calibrating it first if
+        // necessary.
+
+    static Types::Int64 readCounter();
+        // Return the current value of the processor's time-stamp counter.
+        // The behavior is undefined unless 'BSLS_TIMEUTIL_CYCLE_COUNTER' is
+        // defined.
+};
+
                             // ===============
                             // struct TimeUtil
                             // ===============
@@ -233,12 +330,35 @@ struct TimeUtil {
 #endif
 
     // CLASS METHODS
+    static Types::Int64 convertFastTimerRaw(Types::Int64 rawTime);
+        // Convert the specified 'rawTime', obtained from 'getFastTimerRaw', to
+        // a value in nanoseconds, referenced to the same origin as 'getTimer'
+        // (see "Fast Timer" in the component-level documentation), and return
+        // the result of the conversion.  This method is thread-safe.
+
     static Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
         // Convert the specified 'rawTime' to a value in nanoseconds,
         // referenced to an arbitrary but fixed origin, and return the result
         // of the conversion.  Note that this method is thread-safe only if
         // 'initialize' has been called before.
 
+    static Types::Int64 getFastTimer();
+        // Return the instantaneous value of the fast timer in nanoseconds,
+        // referenced to the same origin as 'getTimer' (see "Fast Timer" in the
+        // component-level documentation).  This method is thread-safe.  Note
+        // that the first use of the fast timer in a process calibrates it,
+        // taking about 10 milliseconds, unless 'initializeFastTimer' has been
+        // called before.
+
+    static Types::Int64 getFastTimerRaw();
+        // Return a raw, platform-dependent value representing the current
+        // time, that must be converted by 'convertFastTimerRaw' to
+        // nanoseconds.  This method is intended for timing very small segments
+        // of code (see "Fast Timer" in the component-level documentation).
+        // This method is thread-safe.  Note that the first use of the fast
+        // timer in a process calibrates it, taking about 10 milliseconds,
+        // unless 'initializeFastTimer' has been called before.
+
     static Types::Int64 getProcessSystemTimer();
         // Return the instantaneous values of a platform-dependent timer for
         // the current process system time in absolute nanoseconds referenced
@@ -278,8 +398,109 @@ struct TimeUtil {
         // Do a platform-dependent initialization for the utilities.  Note that
         // only after a call to this method all the following methods are
         // guaranteed to be thread-safe.
+
+    static void initializeFastTimer();
+        // Calibrate the fast timer if it has not already been calibrated.
+        // Calling this method at startup avoids the delay of calibration on
+        // first use of the fast timer.  This method is thread-safe.
+
+    static bool isFastTimerCycleCounter();
+        // Return 'true' if the fast timer reads the processor's invariant
+        // time-stamp counter, and 'false' if it falls back to 'getTimer'.
+        // This method is thread-safe.
 };
 
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // struct TimeUtil_FastTimer
+                        // -------------------------
+
+// CLASS METHODS
+inline
+int TimeUtil_FastTimer::mode()
+{
+    const int mode = AtomicOperations::getIntAcquire(&s_mode);
+    return CYCLE_COUNTER == mode || SYSTEM_TIMER == mode ? mode
+                                                         : initialize();
+}
+
+#ifdef BSLS_TIMEUTIL_CYCLE_COUNTER
+inline
+Types::Int64 TimeUtil_FastTimer::readCounter()
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    return static_cast<Types::Int64>(__rdtsc());
+#else
+    unsigned int low, high;
+    __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+    return static_cast<Types::Int64>(
+                           (static_cast<Types::Uint64>(high) << 32) | low);
+#endif
+}
+#endif
+
+                            // ---------------
+                            // struct TimeUtil
+                            // ---------------
+
+// CLASS METHODS
+inline
+Types::Int64 TimeUtil::convertFastTimerRaw(Types::Int64 rawTime)
+{
+    if (TimeUtil_FastTimer::CYCLE_COUNTER != TimeUtil_FastTimer::mode()) {
+        return rawTime;                                               // RETURN
+    }
+
+    // Scale the (possibly negative) number of ticks since calibration by the
+    // multiplier, splitting the magnitude into 32-bit halves so that the
+    // intermediate products cannot overflow.
+
+    const Types::Int64  ticks = rawTime - TimeUtil_FastTimer::s_counterBase;
+    const Types::Uint64 magnitude = ticks < 0
+                                  ? 0 - static_cast<Types::Uint64>(ticks)
+                                  : static_cast<Types::Uint64>(ticks);
+    const Types::Uint64 multiplier = TimeUtil_FastTimer::s_multiplier;
+    const Types::Int64  nanoseconds = static_cast<Types::Int64>(
+                                  (magnitude >> 32) * multiplier
+                                + (((magnitude & 0xffffffffULL) * multiplier)
+                                                                      >> 32));
+
+    return TimeUtil_FastTimer::s_nanosecondsBase
+         + (ticks < 0 ? -nanoseconds : nanoseconds);
+}
+
+inline
+Types::Int64 TimeUtil::getFastTimer()
+{
+    return convertFastTimerRaw(getFastTimerRaw());
+}
+
+inline
+Types::Int64 TimeUtil::getFastTimerRaw()
+{
+#ifdef BSLS_TIMEUTIL_CYCLE_COUNTER
+    if (TimeUtil_FastTimer::CYCLE_COUNTER == TimeUtil_FastTimer::mode()) {
+        return TimeUtil_FastTimer::readCounter();                     // RETURN
+    }
+#endif
+    return getTimer();
+}
+
+inline
+void TimeUtil::initializeFastTimer()
+{
+    TimeUtil_FastTimer::mode();
+}
+
+inline
+bool TimeUtil::isFastTimerCycleCounter()
+{
+    return TimeUtil_FastTimer::CYCLE_COUNTER == TimeUtil_FastTimer::mode();
+}
+
 }  // close package namespace
 
 
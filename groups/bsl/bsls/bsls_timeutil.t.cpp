@@ -47,6 +47,11 @@ using namespace BloombergLP;
 // and the system results for plausible correct behavior.
 //-----------------------------------------------------------------------------
 // [11] bsls::Types::Int64 convertRawTime(OpaqueNativeTime rawTime);
+// [12] bsls::Types::Int64 convertFastTimerRaw(bsls::Types::Int64 rawTime);
+// [12] bsls::Types::Int64 getFastTimer();
+// [12] bsls::Types::Int64 getFastTimerRaw();
+// [12] void initializeFastTimer();
+// [12] bool isFastTimerCycleCounter();
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getProcessSystemTimer();
 // [ 1] void bsls::TimeUtil::getProcessTimers(bsls::Types::Int64);
 // [ 1] bsls::Types::Int64 bsls::TimeUtil::getTimer();
@@ -54,7 +59,7 @@ using namespace BloombergLP;
 // [11] OpaqueNativeTime getTimerRaw();
 //-----------------------------------------------------------------------------
 // [XX] Breathing Test -- NOT IMPLEMENTED
-// [ 2] USAGE
+// [13] USAGE
 // [ 3] Performance Test
 // [ 4] Test for unique, monotonically increasing return values (statistical)
 // [ 5] Test correct hooking of methods to underlying OS APIs (approximately)
@@ -509,7 +514,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header must build and
@@ -550,6 +555,166 @@ int main(int argc, char *argv[])
                        dTw, dTu, dTs);
         }
 
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING FAST TIMER
+        //
+        // Concerns:
+        //: 1 'initializeFastTimer' may be called any number of times, and
+        //:   'isFastTimerCycleCounter' is stable once it has been called.
+        //:
+        //: 2 Successive values returned by 'getFastTimer' are
+        //:   non-decreasing.
+        //:
+        //: 3 'getFastTimer' shares its origin with 'getTimer', so that a
+        //:   value returned by 'getFastTimer' lies between the values
+        //:   returned by 'getTimer' immediately before and after.
+        //:
+        //: 4 The fast timer measures intervals at the same rate as
+        //:   'getTimer' (i.e., the calibration is accurate).
+        //:
+        //: 5 'convertFastTimerRaw' applied to a value returned by
+        //:   'getFastTimerRaw' agrees with 'getFastTimer', and is
+        //:   non-decreasing in its argument.
+        //
+        // Plan:
+        //: 1 Call 'initializeFastTimer' several times and verify that
+        //:   'isFastTimerCycleCounter' returns the same value each time.
+        //:   (C-1)
+        //:
+        //: 2 Call 'getFastTimer' repeatedly and verify that the sequence of
+        //:   values is non-decreasing.  (C-2)
+        //:
+        //: 3 Bracket calls to 'getFastTimer' with calls to 'getTimer' and
+        //:   verify the ordering, allowing a small tolerance for the
+        //:   calibration rounding error.  (C-3)
+        //:
+        //: 4 Measure a busy-wait of about 50 milliseconds with both timers
+        //:   and verify that the measurements agree to within 1%.  (C-4)
+        //:
+        //: 5 Convert raw values bracketed by calls to 'getFastTimer' and
+        //:   verify the ordering; verify that converting increasing raw
+        //:   values yields non-decreasing results.  (C-5)
+        //
+        // Testing:
+        //   bsls::Types::Int64 convertFastTimerRaw(Types::Int64 rawTime);
+        //   bsls::Types::Int64 getFastTimer();
+        //   bsls::Types::Int64 getFastTimerRaw();
+        //   void initializeFastTimer();
+        //   bool isFastTimerCycleCounter();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING FAST TIMER"
+                            "\n==================\n");
+
+        // Calibration rounds the multiplier down, so the fast timer may lag
+        // 'getTimer' by a small amount that grows with the time since
+        // calibration.  A generous fixed tolerance suffices for this test.
+
+        const Int64 TOLERANCE = 100 * 1000;  // 100 microseconds
+
+        if (verbose) printf("\nInitialization is idempotent.\n");
+        {
+            TU::initializeFastTimer();
+            const bool IS_CYCLE_COUNTER = TU::isFastTimerCycleCounter();
+            if (verbose) { T_;  P(IS_CYCLE_COUNTER); }
+
+            for (int i = 0; i < 5; ++i) {
+                TU::initializeFastTimer();
+                LOOP_ASSERT(i,
+                            IS_CYCLE_COUNTER == TU::isFastTimerCycleCounter());
+            }
+        }
+
+        if (verbose) printf("\nSuccessive values are non-decreasing.\n");
+        {
+            Int64 previous = TU::getFastTimer();
+            for (int i = 0; i < 100000; ++i) {
+                const Int64 current = TU::getFastTimer();
+                LOOP3_ASSERT(i, previous, current, previous <= current);
+                previous = current;
+            }
+        }
+
+        if (verbose) printf("\nThe origin is shared with 'getTimer'.\n");
+        {
+            for (int i = 0; i < 1000; ++i) {
+                const Int64 before = TU::getTimer();
+                const Int64 fast   = TU::getFastTimer();
+                const Int64 after  = TU::getTimer();
+
+                LOOP3_ASSERT(i, before, fast, before - TOLERANCE <= fast);
+                LOOP3_ASSERT(i, fast,  after, fast <= after + TOLERANCE);
+            }
+        }
+
+        if (verbose) printf("\nIntervals agree with 'getTimer'.\n");
+        {
+            const Int64 INTERVAL = 50 * 1000 * 1000;  // 50 milliseconds
+
+            const Int64 timerStart = TU::getTimer();
+            const Int64 fastStart  = TU::getFastTimer();
+
+            while (TU::getTimer() - timerStart < INTERVAL) {
+            }
+
+            const Int64 fastElapsed  = TU::getFastTimer() - fastStart;
+            const Int64 timerElapsed = TU::getTimer()     - timerStart;
+
+            if (verbose) { T_;  P_(timerElapsed);  P(fastElapsed); }
+
+            const Int64 difference = timerElapsed > fastElapsed
+                                   ? timerElapsed - fastElapsed
+                                   : fastElapsed  - timerElapsed;
+            LOOP3_ASSERT(timerElapsed, fastElapsed, difference,
+                         difference <= timerElapsed / 100);
+        }
+
+        if (verbose) printf("\nRaw values convert consistently.\n");
+        {
+            Int64 previous = TU::convertFastTimerRaw(TU::getFastTimerRaw());
+            for (int i = 0; i < 1000; ++i) {
+                const Int64 before = TU::getFastTimer();
+                const Int64 raw    = TU::getFastTimerRaw();
+                const Int64 after  = TU::getFastTimer();
+
+                const Int64 converted = TU::convertFastTimerRaw(raw);
+
+                LOOP3_ASSERT(i, before, converted, before <= converted);
+                LOOP3_ASSERT(i, converted, after,  converted <= after);
+                LOOP3_ASSERT(i, previous, converted, previous <= converted);
+                previous = converted;
+            }
+        }
+
+        if (verbose) printf("\nMeasure the cost of the timers.\n");
+        {
+            const int NUM_CALLS = 1000000;
+
+            Int64 sum = 0;
+
+            const Int64 fastStart = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sum += TU::getFastTimerRaw();
+            }
+            const Int64 fastCost = TU::getTimer() - fastStart;
+
+            const Int64 timerStart = TU::getTimer();
+            for (int i = 0; i < NUM_CALLS; ++i) {
+                sum += TU::getTimer();
+            }
+            const Int64 timerCost = TU::getTimer() - timerStart;
+
+            if (verbose) {
+                printf("\tgetFastTimerRaw: %g ns/call\n"
+                       "\tgetTimer:        %g ns/call\n",
+                       (double)fastCost  / NUM_CALLS,
+                       (double)timerCost / NUM_CALLS);
+            }
+            if (veryVeryVerbose) { T_;  P(sum); }
+        }
+
       } break;
       case 11: {
         // --------------------------------------------------------------------
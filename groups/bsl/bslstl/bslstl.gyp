@@ -5,6 +5,7 @@
       'bslstl_allocatortraits.cpp',
       'bslstl_bidirectionaliterator.cpp',
       'bslstl_bidirectionalnodepool.cpp',
+      'bslstl_boundedqueue.cpp',
       'bslstl_deque.cpp',
       'bslstl_equalto.cpp',
       'bslstl_forwarditerator.cpp',
@@ -12,6 +13,7 @@
       'bslstl_hashtable.cpp',
       'bslstl_hashtablebucketiterator.cpp',
       'bslstl_hashtableiterator.cpp',
+      'bslstl_indexedpriorityqueue.cpp',
       'bslstl_iosfwd.cpp',
       'bslstl_istringstream.cpp',
       'bslstl_iterator.cpp',
@@ -26,6 +28,7 @@
       'bslstl_priorityqueue.cpp',
       'bslstl_queue.cpp',
       'bslstl_randomaccessiterator.cpp',
+      'bslstl_rankedset.cpp',
       'bslstl_set.cpp',
       'bslstl_setcomparator.cpp',
       'bslstl_simplepool.cpp',
@@ -53,6 +56,7 @@
       'bslstl_allocatortraits.t',
       'bslstl_bidirectionaliterator.t',
       'bslstl_bidirectionalnodepool.t',
+      'bslstl_boundedqueue.t',
       'bslstl_deque.t',
       'bslstl_equalto.t',
       'bslstl_forwarditerator.t',
@@ -60,6 +64,7 @@
       'bslstl_hashtable.t',
       'bslstl_hashtablebucketiterator.t',
       'bslstl_hashtableiterator.t',
+      'bslstl_indexedpriorityqueue.t',
       'bslstl_iosfwd.t',
       'bslstl_istringstream.t',
       'bslstl_iterator.t',
@@ -74,6 +79,7 @@
       'bslstl_priorityqueue.t',
       'bslstl_queue.t',
       'bslstl_randomaccessiterator.t',
+      'bslstl_rankedset.t',
       'bslstl_set.t',
       'bslstl_setcomparator.t',
       'bslstl_simplepool.t',
@@ -101,6 +107,7 @@
       '<(PRODUCT_DIR)/bslstl_allocatortraits.t',
       '<(PRODUCT_DIR)/bslstl_bidirectionaliterator.t',
       '<(PRODUCT_DIR)/bslstl_bidirectionalnodepool.t',
+      '<(PRODUCT_DIR)/bslstl_boundedqueue.t',
       '<(PRODUCT_DIR)/bslstl_deque.t',
       '<(PRODUCT_DIR)/bslstl_equalto.t',
       '<(PRODUCT_DIR)/bslstl_forwarditerator.t',
@@ -108,6 +115,7 @@
       '<(PRODUCT_DIR)/bslstl_hashtable.t',
       '<(PRODUCT_DIR)/bslstl_hashtablebucketiterator.t',
       '<(PRODUCT_DIR)/bslstl_hashtableiterator.t',
+      '<(PRODUCT_DIR)/bslstl_indexedpriorityqueue.t',
       '<(PRODUCT_DIR)/bslstl_iosfwd.t',
       '<(PRODUCT_DIR)/bslstl_istringstream.t',
       '<(PRODUCT_DIR)/bslstl_iterator.t',
@@ -122,6 +130,7 @@
       '<(PRODUCT_DIR)/bslstl_priorityqueue.t',
       '<(PRODUCT_DIR)/bslstl_queue.t',
       '<(PRODUCT_DIR)/bslstl_randomaccessiterator.t',
+      '<(PRODUCT_DIR)/bslstl_rankedset.t',
       '<(PRODUCT_DIR)/bslstl_set.t',
       '<(PRODUCT_DIR)/bslstl_setcomparator.t',
       '<(PRODUCT_DIR)/bslstl_simplepool.t',
@@ -233,6 +242,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_bidirectionalnodepool.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_boundedqueue.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_boundedqueue.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_deque.t',
       'type': 'executable',
@@ -289,6 +306,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_hashtableiterator.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_indexedpriorityqueue.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_indexedpriorityqueue.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_iosfwd.t',
       'type': 'executable',
@@ -401,6 +426,14 @@
       'include_dirs': [ '.' ],
       'sources': [ 'bslstl_randomaccessiterator.t.cpp' ],
     },
+    {
+      'target_name': 'bslstl_rankedset.t',
+      'type': 'executable',
+      'dependencies': [ '../bsl_deps.gyp:bsl_grpdeps',
+                        '<@(bslstl_pkgdeps)', 'bslstl' ],
+      'include_dirs': [ '.' ],
+      'sources': [ 'bslstl_rankedset.t.cpp' ],
+    },
     {
       'target_name': 'bslstl_set.t',
       'type': 'executable',
@@ -376,6 +376,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_isbitwiseequalitycomparable.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -489,14 +497,18 @@ class allocator {
     // MANIPULATORS
     pointer allocate(size_type n, const void *hint = 0);
         // Allocate enough (properly aligned) space for 'n' objects of type 'T'
-        // by calling 'allocate' on the mechanism object.  The 'hint' argument
+        // by calling 'allocate' on the mechanism object, or, if the alignment
+        // of 'T' exceeds 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT', by calling
+        // 'allocateAligned' with the alignment of 'T'.  The 'hint' argument
         // is ignored by this allocator type.  The behavior is undefined unless
         // 'n <= max_size()'.
 
     void deallocate(pointer p, size_type n = 1);
         // Return memory previously allocated with 'allocate' to the underlying
-        // mechanism object by calling 'deallocate' on the the mechanism
-        // object.  The 'n' argument is ignored by this allocator type.
+        // mechanism object by calling 'deallocateSized' (or, for over-aligned
+        // 'T', 'deallocateAligned') on the mechanism object with the size, in
+        // bytes, of 'n' objects of type 'T'.  The behavior is undefined unless
+        // 'p' was obtained from a call to 'allocate' with an argument of 'n'.
 
     void construct(pointer p, const T& val);
         // Copy-construct a 'T' object at the memory address specified by 'p'.
@@ -697,6 +709,15 @@ allocator<T>::allocate(typename allocator::size_type  n,
     // Hence the cast in the argument of 'allocate' below.
 
     (void) hint;  // suppress warning
+
+    const int ALIGNMENT = BloombergLP::bsls::AlignmentFromType<T>::VALUE;
+
+    if (ALIGNMENT > BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        return static_cast<pointer>(d_mechanism->allocateAligned(
+                       BloombergLP::bslma::Allocator::size_type(n * sizeof(T)),
+                       ALIGNMENT));                                   // RETURN
+    }
+
     return static_cast<pointer>(d_mechanism->allocate(
                      BloombergLP::bslma::Allocator::size_type(n * sizeof(T))));
 }
@@ -706,8 +727,18 @@ inline
 void allocator<T>::deallocate(typename allocator::pointer   p,
                               typename allocator::size_type n)
 {
-    (void) n;  // suppress warning
-    d_mechanism->deallocate(p);
+    const int ALIGNMENT = BloombergLP::bsls::AlignmentFromType<T>::VALUE;
+
+    if (ALIGNMENT > BloombergLP::bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        d_mechanism->deallocateAligned(
+                       p,
+                       BloombergLP::bslma::Allocator::size_type(n * sizeof(T)),
+                       ALIGNMENT);
+        return;                                                       // RETURN
+    }
+
+    d_mechanism->deallocateSized(p,
+                     BloombergLP::bslma::Allocator::size_type(n * sizeof(T)));
 }
 
 template <class T>
@@ -11,6 +11,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 
 #include <new>
 #include <limits>
@@ -63,7 +64,8 @@ using namespace std;
 // [ 5] template rebind<U>::other
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: over-aligned types are allocated with their alignment
+// [ 7] USAGE EXAMPLE
 
 //==========================================================================
 //                  STANDARD BDE ASSERT TEST MACRO
@@ -393,6 +395,20 @@ struct MyObject
     char d_s[10];
 };
 
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+                           // ======================
+                           // struct MyAlignedObject
+                           // ======================
+
+struct MyAlignedObject
+{
+    // An object whose alignment exceeds that of every primitive type.
+
+    // DATA
+    char d_s[40] __attribute__((__aligned__(64)));
+};
+#endif
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -409,7 +425,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -428,6 +444,49 @@ int main(int argc, char *argv[])
 
         usageExample();
 
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING OVER-ALIGNED TYPES
+        //
+        // Concerns:
+        //   Memory allocated for a type whose alignment exceeds the maximal
+        //   alignment is aligned for that type, is fully usable, and is
+        //   returned to the mechanism on 'deallocate'.
+        //
+        // Plan:
+        //   Using a test allocator as mechanism, allocate arrays of various
+        //   lengths of an over-aligned type, verify their alignment, write to
+        //   every byte, and deallocate them, verifying that no memory is in
+        //   use and that the sizes supplied to the mechanism match.
+        //
+        // Testing:
+        //   CONCERN: over-aligned types are allocated with their alignment
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING OVER-ALIGNED TYPES"
+                            "\n==========================\n");
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        bsl::allocator<MyAlignedObject> a(&ta);
+
+        for (std::size_t n = 1; n <= 16; ++n) {
+            MyAlignedObject *p = a.allocate(n);
+
+            LOOP_ASSERT(n, 0 == reinterpret_cast<std::size_t>(p) % 64);
+            LOOP_ASSERT(n, 1 == ta.numBlocksInUse());
+
+            memset(p, 0xa5, n * sizeof(MyAlignedObject));
+
+            a.deallocate(p, n);
+
+            LOOP_ASSERT(n, 0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numMismatches());
+#endif
+
       } break;
       case 5: {
         // --------------------------------------------------------------------
@@ -318,6 +318,16 @@ class BidirectionalNodePool {
         // The behavior is undefined unless 'node' refers to a
         // 'bslalg::BidirectionalNode<VALUE>' that was allocated by this pool.
 
+    void release();
+        // Relinquish all memory currently allocated via this pool object,
+        // including the memory footprint of every outstanding node, without
+        // destroying the 'VALUE' attribute of any node.  The behavior is
+        // undefined if any outstanding node is used after this call, or if
+        // the 'VALUE' of any outstanding node must be destroyed (e.g., it owns
+        // resources).  Note that this method allows a container whose
+        // elements need not be destroyed to dispose of all of its nodes at
+        // once, rather than deleting each node in turn.
+
     void reserveNodes(native_std::size_t numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numNodes' before the pool replenishes.
@@ -333,8 +343,6 @@ class BidirectionalNodePool {
         // those of the specified 'other' object.  This method provides the
         // no-throw exception-safety guarantee.
 
-    void release() { d_pool.release(); }
-
     // ACCESSORS
     const AllocatorType& allocator() const;
         // Return a reference providing non-modifiable access to the allocator
@@ -467,6 +475,13 @@ void BidirectionalNodePool<VALUE, ALLOCATOR>::deleteNode(
     d_pool.deallocate(node);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::release()
+{
+    d_pool.release();
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(
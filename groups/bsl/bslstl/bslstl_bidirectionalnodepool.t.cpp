@@ -85,6 +85,7 @@ using namespace bslstl;
 // [ 9] bslalg::BidirectionalLink *cloneNode(const BidirectionalLink&);
 // [ 5] void deleteNode(bslalg::BidirectionalLink *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
+// [12] void release();
 // [10] void swapRetainAllocators(other);
 // [10] void swapExchangeAllocators(other);
 //
@@ -95,6 +96,7 @@ using namespace bslstl;
 // [10] void swap(BidirectionalNodePool& a, b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [13] USAGE EXAMPLE
 // [ *] CONCERN: No memory is ever allocated from the global allocator.
 //-----------------------------------------------------------------------------
 //=============================================================================
@@ -470,6 +472,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase12();
+        // Test 'release'.
+
     static void testCase11();
         // Test type traits.
 
@@ -574,6 +579,67 @@ void TestDriver<VALUE>::testCase11()
     BSLMF_ASSERT((1 == bslmf::IsBitwiseMoveable<Obj>::value));
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase12()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'release'
+    //
+    // Concerns:
+    //: 1 'release' returns all memory allocated by the object to the
+    //:   allocator, including the memory of nodes that were never deleted.
+    //:
+    //: 2 The object can be used to create nodes after 'release'.
+    //:
+    //: 3 'release' has no effect on an object that allocated no memory.
+    //
+    // Plan:
+    //: 1 For each different values of i from 0 to 99:
+    //:
+    //:   1 Invoke 'createNode' 'i' times, and delete every other node.
+    //:
+    //:   2 Invoke 'release' and verify that no memory is in use by the object
+    //:     allocator.  (C-1, 3)
+    //:
+    //:   3 Invoke 'createNode' and 'deleteNode', and verify that memory is
+    //:     allocated and that all memory is deallocated on destruction.
+    //:     (C-2)
+    //
+    // Testing:
+    //   void release();
+    // --------------------------------------------------------------------
+
+    for (int ti = 0; ti < 100; ++ti) {
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);
+
+            for (int tj = 0; tj < ti; ++tj) {
+                Link *ptr = mX.createNode();
+                if (tj % 2) {
+                    mX.deleteNode(ptr);
+                }
+            }
+            ASSERTV(ti, (0 == ti) == (0 == oa.numBlocksInUse()));
+
+            mX.release();
+
+            ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            Link *ptr = mX.createNode();
+            ASSERTV(ti, 0 < oa.numBlocksInUse());
+            mX.deleteNode(ptr);
+        }
+
+        ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase10()
 {
@@ -2015,7 +2081,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2065,6 +2131,16 @@ int main(int argc, char *argv[])
         ASSERT(NUM_DATA == ti);
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // MANIPULATOR 'release'
+        // --------------------------------------------------------------------
+        if (verbose) printf("\nMANIPULATOR 'release'"
+                            "\n=====================\n");
+
+        TestDriver<int>::testCase12();
+        TestDriver<bsltf::SimpleTestType>::testCase12();
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TYPE TRAITS
@@ -0,0 +1,52 @@
+// bslstl_boundedqueue.cpp                                            -*-C++-*-
+#include <bslstl_boundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <limits.h>  // 'INT_MAX'
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // -----------------------
+                         // struct BoundedQueue_Util
+                         // -----------------------
+
+// CLASS METHODS
+std::size_t BoundedQueue_Util::roundUpCapacity(std::size_t capacity)
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= static_cast<std::size_t>(INT_MAX / 2 + 1));
+
+    std::size_t result = 1;
+    while (result < capacity) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
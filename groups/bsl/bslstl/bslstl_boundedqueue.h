@@ -0,0 +1,1157 @@
+// bslstl_boundedqueue.h                                              -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BOUNDEDQUEUE
+#define INCLUDED_BSLSTL_BOUNDEDQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide bounded lock-free queues to pass values between threads.
+//
+//@CLASSES:
+//  bslstl::SpscBoundedQueue: wait-free single-producer/single-consumer queue
+//  bslstl::MpmcBoundedQueue: lock-free multi-producer/multi-consumer queue
+//
+//@SEE_ALSO: bslstl_queue, bslstl_deque, bsls_atomicoperations
+//
+//@DESCRIPTION: This component provides two allocator-aware, fixed-capacity
+// ring-buffer queues that can be used concurrently without a mutex:
+// 'bslstl::SpscBoundedQueue', for exactly one producer thread and one consumer
+// thread, and 'bslstl::MpmcBoundedQueue', for any number of producer and
+// consumer threads.  Both are built directly on the acquire/release
+// operations of 'bsls::AtomicOperations', and keep the position updated by
+// producers and the position updated by consumers on separate cache lines
+// (see 'bsls_cachelinepadded'), so that producers and consumers do not
+// invalidate each other's cache lines except when handing off values.
+//
+// Neither queue blocks: 'tryPush' fails (returning a non-zero value) if the
+// queue is full, and 'tryPop' fails if the queue is empty, leaving it to the
+// caller to retry, back off, or do other work.  Both queues also provide
+// batched operations, 'tryPushBatch' and 'tryPopBatch', that transfer as many
+// values as possible (up to a specified maximum) in one operation, publishing
+// them to the other side with a single atomic update of the position (for
+// 'SpscBoundedQueue'), or claiming them with a single compare-and-swap (for
+// 'MpmcBoundedQueue'), which amortizes the cost of synchronization over the
+// batch.
+//
+///Capacity
+///--------
+// The capacity of each queue is fixed at construction: the requested capacity
+// is rounded up to a power of two (so that positions can be mapped to slots by
+// masking), and the storage for that many values is allocated up front from
+// the allocator supplied at construction.  The capacity of a
+// 'MpmcBoundedQueue' is at least 2, because the sequence number of the only
+// slot of a one-slot ring could not distinguish a slot freed for the next
+// push from a slot holding a value.  No memory is allocated by 'tryPush'
+// or 'tryPop' themselves, other than by the copy constructor of 'VALUE'.
+// Values are copy-constructed into the queue with
+// 'bsl::allocator_traits<ALLOCATOR>::construct', so that an allocator-aware
+// 'VALUE' uses the queue's allocator, and are destroyed when popped (or when
+// the queue is destroyed).
+//
+///'SpscBoundedQueue'
+///------------------
+// A 'bslstl::SpscBoundedQueue' is the classic single-producer/single-consumer
+// ring buffer: the producer owns the tail position and the consumer owns the
+// head position, so neither needs a read-modify-write operation.  Each side
+// also keeps a private copy of the other side's position, and reloads it only
+// when its copy indicates that the queue is full (for the producer) or empty
+// (for the consumer), so that in the steady state each operation touches only
+// the slot and the cache line of its own side.  'tryPush' and 'tryPop' are
+// wait-free.  The behavior is undefined if more than one thread pushes, or
+// more than one thread pops, concurrently.
+//
+///'MpmcBoundedQueue'
+///------------------
+// A 'bslstl::MpmcBoundedQueue' implements the bounded queue of Dmitry Vyukov:
+// each slot carries a sequence number that tells producers whether the slot
+// is free for the current pass over the ring, and consumers whether it holds
+// a value.  A thread claims a slot (or, for the batched operations, a run of
+// consecutive slots) with a single compare-and-swap on the shared position of
+// its side, and then hands the slot to the other side by storing its sequence
+// number with release semantics.  Operations are lock-free in the common case,
+// but a thread preempted between claiming a slot and publishing it delays the
+// threads on the other side that reach that slot.  Values pushed by a single
+// producer are popped in the order in which they were pushed.
+//
+///Exception Safety
+///----------------
+// If the copy constructor of 'VALUE' throws during a push, the value is not
+// added: 'SpscBoundedQueue' is unchanged (or, for a batch, keeps the values
+// pushed before the failure), and the slot claimed by 'MpmcBoundedQueue' is
+// released to consumers as holding no value, and is skipped by them.  If the
+// assignment operator of 'VALUE' throws during a pop, 'SpscBoundedQueue' is
+// unchanged (or, for a batch, keeps the value being popped and those after
+// it), while 'MpmcBoundedQueue' discards the values claimed by the failed
+// operation that have not yet been assigned.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Distributing Jobs to Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads generate jobs, each identified by an 'int', and
+// that a pool of worker threads processes them.  A
+// 'bslstl::MpmcBoundedQueue' can hand the jobs from the generating threads to
+// the workers without a mutex, and bounds the number of pending jobs.
+//
+// First, we define a function that generates jobs, retrying whenever the
+// queue is full:
+//..
+//  typedef bslstl::MpmcBoundedQueue<int> JobQueue;
+//
+//  void generateJobs(JobQueue *queue, int firstJob, int numJobs)
+//      // Push the specified 'numJobs' consecutive job identifiers, starting
+//      // at the specified 'firstJob', onto the specified 'queue'.
+//  {
+//      for (int i = 0; i < numJobs; ) {
+//          if (0 == queue->tryPush(firstJob + i)) {
+//              ++i;
+//          }
+//          else {
+//              // The queue is full: a real application would yield the
+//              // processor, or back off, before retrying.
+//          }
+//      }
+//  }
+//..
+// Then, we define the function that a worker calls to take the jobs to
+// process next; it takes up to 'maxJobs' jobs at once, so that the cost of
+// synchronizing with other workers is paid once per batch:
+//..
+//  int takeJobs(JobQueue *queue, int *jobs, int maxJobs)
+//      // Load into the specified 'jobs' array the next (at most the
+//      // specified 'maxJobs') jobs from the specified 'queue', and return the
+//      // number of jobs loaded.
+//  {
+//      return static_cast<int>(queue->tryPopBatch(jobs, maxJobs));
+//  }
+//..
+// Next, we create a queue that can hold 16 pending jobs, supplying its memory
+// from a test allocator:
+//..
+//  bslma::TestAllocator ta;
+//  JobQueue             queue(16, &ta);
+//  assert(16 == queue.capacity());
+//  assert( 0 == queue.size());
+//..
+// Then, a generating thread (here, the current thread) generates 10 jobs:
+//..
+//  generateJobs(&queue, 100, 10);
+//  assert(10 == queue.size());
+//..
+// Now, a worker takes the jobs in batches of 4:
+//..
+//  int jobs[4];
+//  assert(4 == takeJobs(&queue, jobs, 4));
+//  assert(100 == jobs[0]);  assert(103 == jobs[3]);
+//  assert(4 == takeJobs(&queue, jobs, 4));
+//  assert(104 == jobs[0]);  assert(107 == jobs[3]);
+//..
+// Finally, the last batch is short, after which the queue is empty:
+//..
+//  assert(2 == takeJobs(&queue, jobs, 4));
+//  assert(108 == jobs[0]);  assert(109 == jobs[1]);
+//  assert(0 == takeJobs(&queue, jobs, 4));
+//..
+// In a real application, several generating threads would call
+// 'generateJobs', and several workers would call 'takeJobs', concurrently.
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_boundedqueue.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_CACHELINEPADDED
+#include <bsls_cachelinepadded.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // =======================
+                         // struct BoundedQueue_Util
+                         // =======================
+
+struct BoundedQueue_Util {
+    // [!PRIVATE!] This 'struct' provides a namespace for utility functions
+    // shared by the queues in this component.
+
+    // CLASS METHODS
+    static std::size_t roundUpCapacity(std::size_t capacity);
+        // Return the smallest power of two that is not less than the
+        // specified 'capacity'.  The behavior is undefined unless
+        // '0 < capacity' and the result is representable as an 'int'.
+};
+
+                      // ==============================
+                      // class BoundedQueue_ReleaseGuard
+                      // ==============================
+
+class BoundedQueue_ReleaseGuard {
+    // [!PRIVATE!] This class implements a guard that, upon destruction,
+    // stores a position (held by the guard, and advanced by 'next') to an
+    // atomic position with release semantics.  It is used to publish the
+    // slots filled (or emptied) by a batched 'SpscBoundedQueue' operation with
+    // a single store, including if the operation is interrupted by an
+    // exception.
+
+    // DATA
+    bsls::AtomicOperations::AtomicTypes::Int64 *d_position_p;  // target
+
+    bsls::Types::Int64                          d_value;       // value to
+                                                               // store
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue_ReleaseGuard(const BoundedQueue_ReleaseGuard&);
+    BoundedQueue_ReleaseGuard& operator=(const BoundedQueue_ReleaseGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_ReleaseGuard(
+                       bsls::AtomicOperations::AtomicTypes::Int64 *position,
+                       bsls::Types::Int64                          value);
+        // Create a guard that will store the specified 'value', as advanced
+        // by calls to 'next', to the specified 'position'.
+
+    ~BoundedQueue_ReleaseGuard();
+        // Store the value of this guard to its position, with release
+        // semantics, and destroy this guard.
+
+    // MANIPULATORS
+    void next();
+        // Advance the value this guard will store by one.
+};
+
+                           // ======================
+                           // class SpscBoundedQueue
+                           // ======================
+
+template <class VALUE, class ALLOCATOR = bsl::allocator<VALUE> >
+class SpscBoundedQueue {
+    // This class implements a fixed-capacity, first-in, first-out queue of
+    // 'VALUE' objects, supporting one producer thread and one consumer thread
+    // concurrently.  'tryPush' and 'tryPop' are wait-free.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations             AtomicOps;
+    typedef AtomicOps::AtomicTypes::Int64      AtomicInt64;
+
+    struct Side {
+        // This 'struct' holds the state owned by one side (producer or
+        // consumer) of the queue.
+
+        AtomicInt64        d_position;     // next position to push (or pop)
+
+        bsls::Types::Int64 d_otherCached;  // last observed position of the
+                                           // other side
+    };
+
+  public:
+    // TYPES
+    typedef VALUE       value_type;
+    typedef std::size_t size_type;
+
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                  rebind_traits<VALUE> AllocatorTraits;
+        // Alias for the allocator traits rebound to allocate 'VALUE'.
+
+    typedef typename AllocatorTraits::allocator_type AllocatorType;
+        // Alias for the allocator type used to supply memory.
+
+  private:
+    // DATA
+    VALUE                        *d_slots_p;    // ring of 'd_mask + 1' slots
+
+    bsls::Types::Int64            d_mask;       // capacity minus one
+
+    AllocatorType                 d_allocator;  // supplies the slots
+
+    bsls::CacheLinePadded<Side>   d_producer;   // tail, and cached head
+
+    bsls::CacheLinePadded<Side>   d_consumer;   // head, and cached tail
+
+  private:
+    // NOT IMPLEMENTED
+    SpscBoundedQueue(const SpscBoundedQueue&);
+    SpscBoundedQueue& operator=(const SpscBoundedQueue&);
+
+  public:
+    // CREATORS
+    explicit SpscBoundedQueue(size_type        capacity,
+                              const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty queue having a capacity of at least the specified
+        // 'capacity' (rounded up to a power of two).  Optionally specify an
+        // 'allocator' used to supply memory for the queue and for its values.
+        // If 'allocator' is not specified, a default-constructed allocator is
+        // used.  The behavior is undefined unless '0 < capacity' and the
+        // rounded capacity is representable as an 'int'.
+
+    ~SpscBoundedQueue();
+        // Destroy this queue and the values it holds.  The behavior is
+        // undefined if other threads access this queue concurrently.
+
+    // MANIPULATORS
+    int tryPush(const VALUE& value);
+        // Append a copy of the specified 'value' to this queue if it is not
+        // full.  Return 0 on success, and a non-zero value (with no effect)
+        // if the queue is full.  The behavior is undefined if another thread
+        // pushes onto this queue concurrently.
+
+    size_type tryPushBatch(const VALUE *values, size_type numValues);
+        // Append copies of the leading values of the specified 'values' array,
+        // up to the specified 'numValues' or the free capacity of this queue,
+        // whichever is less, and publish them to the consumer together.
+        // Return the number of values appended.  The behavior is undefined
+        // unless 'values' refers to an array of at least 'numValues' values,
+        // or if another thread pushes onto this queue concurrently.
+
+    int tryPop(VALUE *value);
+        // Assign to the specified 'value' the value at the front of this
+        // queue, and remove it, if the queue is not empty.  Return 0 on
+        // success, and a non-zero value (with no effect) if the queue is
+        // empty.  The behavior is undefined if another thread pops from this
+        // queue concurrently.
+
+    size_type tryPopBatch(VALUE *values, size_type maxValues);
+        // Assign to the leading elements of the specified 'values' array the
+        // values at the front of this queue, up to the specified 'maxValues'
+        // or the number of values in the queue, whichever is less, and
+        // remove them, releasing their slots to the producer together.
+        // Return the number of values removed.  The behavior is undefined
+        // unless 'values' refers to an array of at least 'maxValues'
+        // elements, or if another thread pops from this queue concurrently.
+
+    // ACCESSORS
+    const AllocatorType& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // used by this queue to supply memory.
+
+    size_type capacity() const;
+        // Return the maximum number of values this queue can hold.
+
+    size_type size() const;
+        // Return the number of values in this queue.  Note that, if other
+        // threads access the queue concurrently, the value returned may be
+        // out of date by the time it is used.
+};
+
+                           // ======================
+                           // class MpmcBoundedQueue
+                           // ======================
+
+template <class VALUE, class ALLOCATOR = bsl::allocator<VALUE> >
+class MpmcBoundedQueue {
+    // This class implements a fixed-capacity queue of 'VALUE' objects,
+    // supporting any number of producer and consumer threads concurrently.
+    // Values pushed by one producer are popped in the order in which they were
+    // pushed.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations             AtomicOps;
+    typedef AtomicOps::AtomicTypes::Int64      AtomicInt64;
+
+    struct Cell {
+        // This 'struct' holds one slot of the ring.  A slot at position 'p'
+        // (modulo the capacity) is free for the pass of the producers over
+        // the ring that reaches 'p' if 'd_sequence == p', and holds a value
+        // (or, if 'd_hasValue' is 'false', the remains of a failed push) for
+        // the consumers if 'd_sequence == p + 1'.
+
+        AtomicInt64               d_sequence;  // state of the slot
+
+        bool                      d_hasValue;  // 'false' if the push that
+                                               // filled the slot threw
+
+        bsls::ObjectBuffer<VALUE> d_value;     // footprint of the value
+    };
+
+  public:
+    // TYPES
+    typedef VALUE       value_type;
+    typedef std::size_t size_type;
+
+    typedef typename bsl::allocator_traits<ALLOCATOR>::template
+                                   rebind_traits<Cell> AllocatorTraits;
+        // Alias for the allocator traits rebound to allocate slots.
+
+    typedef typename AllocatorTraits::allocator_type AllocatorType;
+        // Alias for the allocator type used to supply memory.
+
+  private:
+    // PRIVATE TYPES
+    class PushProctor {
+        // This class implements a proctor that publishes to consumers a run
+        // of slots claimed by producers.  Slots filled before 'publish' is
+        // called are published as holding a value; the remaining slots are
+        // published by the destructor as holding no value.
+
+        // DATA
+        Cell               *d_cells_p;   // ring of slots
+        bsls::Types::Int64  d_mask;      // capacity minus one
+        bsls::Types::Int64  d_position;  // next position to publish
+        bsls::Types::Int64  d_end;       // end of the claimed run
+
+      public:
+        // CREATORS
+        PushProctor(Cell               *cells,
+                    bsls::Types::Int64  mask,
+                    bsls::Types::Int64  begin,
+                    bsls::Types::Int64  end);
+            // Create a proctor for the slots of the specified 'cells' (having
+            // the capacity 'mask + 1', for the specified 'mask') at the
+            // positions in the specified range '[begin, end)'.
+
+        ~PushProctor();
+            // Publish the slots of this proctor that have not been published
+            // as holding no value, and destroy this proctor.
+
+        // MANIPULATORS
+        Cell& current();
+            // Return a reference providing modifiable access to the next
+            // slot to be published.
+
+        void publish();
+            // Publish the next slot as holding a value.
+    };
+
+    class PopProctor {
+        // This class implements a proctor that releases to producers a run of
+        // slots claimed by consumers, destroying any value each holds.  The
+        // slots not released by 'release' are released by the destructor.
+
+        // DATA
+        Cell               *d_cells_p;      // ring of slots
+        bsls::Types::Int64  d_mask;         // capacity minus one
+        bsls::Types::Int64  d_position;     // next position to release
+        bsls::Types::Int64  d_end;          // end of the claimed run
+        AllocatorType      *d_allocator_p;  // destroys values (held)
+
+      public:
+        // CREATORS
+        PopProctor(Cell               *cells,
+                   bsls::Types::Int64  mask,
+                   bsls::Types::Int64  begin,
+                   bsls::Types::Int64  end,
+                   AllocatorType      *allocator);
+            // Create a proctor for the slots of the specified 'cells' (having
+            // the capacity 'mask + 1', for the specified 'mask') at the
+            // positions in the specified range '[begin, end)', destroying
+            // values with the specified 'allocator'.
+
+        ~PopProctor();
+            // Release the slots of this proctor that have not been released,
+            // and destroy this proctor.
+
+        // MANIPULATORS
+        Cell& current();
+            // Return a reference providing modifiable access to the next
+            // slot to be released.
+
+        void release();
+            // Destroy the value (if any) in the next slot, and release it to
+            // producers.
+    };
+
+    // DATA
+    Cell                                *d_cells_p;    // ring of slots
+
+    bsls::Types::Int64                   d_mask;       // capacity minus one
+
+    AllocatorType                        d_allocator;  // supplies the slots
+
+    bsls::CacheLinePadded<AtomicInt64>   d_pushPosition;
+                                                       // next position to
+                                                       // claim for a push
+
+    bsls::CacheLinePadded<AtomicInt64>   d_popPosition;
+                                                       // next position to
+                                                       // claim for a pop
+
+  private:
+    // NOT IMPLEMENTED
+    MpmcBoundedQueue(const MpmcBoundedQueue&);
+    MpmcBoundedQueue& operator=(const MpmcBoundedQueue&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 claim(AtomicInt64        *position,
+                             bsls::Types::Int64  offset,
+                             size_type           maxCount,
+                             size_type          *count);
+        // Claim a run of consecutive slots, of at most the specified
+        // 'maxCount' length, starting at the specified shared 'position' and
+        // each ready for its side (i.e., whose sequence number is its
+        // position plus the specified 'offset'), and advance 'position' past
+        // the run.  Load the length of the run into the specified 'count',
+        // and return the position of its first slot.  Load 0 into 'count' if
+        // the slot at 'position' is not ready.
+
+  public:
+    // CREATORS
+    explicit MpmcBoundedQueue(size_type        capacity,
+                              const ALLOCATOR& allocator = ALLOCATOR());
+        // Create an empty queue having a capacity of at least the specified
+        // 'capacity' and at least 2 (rounded up to a power of two).
+        // Optionally specify an 'allocator' used to supply memory for the
+        // queue and for its values.  If 'allocator' is not specified, a
+        // default-constructed allocator is used.  The behavior is undefined
+        // unless '0 < capacity' and the rounded capacity is representable as
+        // an 'int'.
+
+    ~MpmcBoundedQueue();
+        // Destroy this queue and the values it holds.  The behavior is
+        // undefined if other threads access this queue concurrently.
+
+    // MANIPULATORS
+    int tryPush(const VALUE& value);
+        // Append a copy of the specified 'value' to this queue if it is not
+        // full.  Return 0 on success, and a non-zero value (with no effect)
+        // if the queue is full.
+
+    size_type tryPushBatch(const VALUE *values, size_type numValues);
+        // Append copies of the leading values of the specified 'values' array,
+        // up to the specified 'numValues' or the number of consecutive free
+        // slots, whichever is less, claiming their slots together.  Return
+        // the number of values appended.  The behavior is undefined unless
+        // 'values' refers to an array of at least 'numValues' values.
+
+    int tryPop(VALUE *value);
+        // Assign to the specified 'value' the value at the front of this
+        // queue, and remove it, if the queue is not empty.  Return 0 on
+        // success, and a non-zero value (with no effect) if the queue is
+        // empty.
+
+    size_type tryPopBatch(VALUE *values, size_type maxValues);
+        // Assign to the leading elements of the specified 'values' array the
+        // values at the front of this queue, up to the specified 'maxValues'
+        // or the number of consecutive available values, whichever is less,
+        // claiming their slots together, and remove them.  Return the number
+        // of values removed.  The behavior is undefined unless 'values'
+        // refers to an array of at least 'maxValues' elements.
+
+    // ACCESSORS
+    const AllocatorType& allocator() const;
+        // Return a reference providing non-modifiable access to the allocator
+        // used by this queue to supply memory.
+
+    size_type capacity() const;
+        // Return the maximum number of values this queue can hold.
+
+    size_type size() const;
+        // Return the number of values in this queue (counting slots claimed
+        // by pushes in progress).  Note that, if other threads access the
+        // queue concurrently, the value returned may be out of date by the
+        // time it is used.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // ------------------------------
+                      // class BoundedQueue_ReleaseGuard
+                      // ------------------------------
+
+// CREATORS
+inline
+BoundedQueue_ReleaseGuard::BoundedQueue_ReleaseGuard(
+                         bsls::AtomicOperations::AtomicTypes::Int64 *position,
+                         bsls::Types::Int64                          value)
+: d_position_p(position)
+, d_value(value)
+{
+}
+
+inline
+BoundedQueue_ReleaseGuard::~BoundedQueue_ReleaseGuard()
+{
+    bsls::AtomicOperations::setInt64Release(d_position_p, d_value);
+}
+
+// MANIPULATORS
+inline
+void BoundedQueue_ReleaseGuard::next()
+{
+    ++d_value;
+}
+
+                           // ----------------------
+                           // class SpscBoundedQueue
+                           // ----------------------
+
+// CREATORS
+template <class VALUE, class ALLOCATOR>
+SpscBoundedQueue<VALUE, ALLOCATOR>::SpscBoundedQueue(
+                                                size_type        capacity,
+                                                const ALLOCATOR& allocator)
+: d_slots_p(0)
+, d_mask(0)
+, d_allocator(allocator)
+{
+    BSLS_ASSERT(0 < capacity);
+
+    const size_type numSlots = BoundedQueue_Util::roundUpCapacity(capacity);
+
+    d_slots_p = AllocatorTraits::allocate(d_allocator, numSlots);
+    d_mask    = static_cast<bsls::Types::Int64>(numSlots) - 1;
+
+    AtomicOps::initInt64(&d_producer->d_position, 0);
+    AtomicOps::initInt64(&d_consumer->d_position, 0);
+    d_producer->d_otherCached = 0;
+    d_consumer->d_otherCached = 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+SpscBoundedQueue<VALUE, ALLOCATOR>::~SpscBoundedQueue()
+{
+    const bsls::Types::Int64 tail =
+                           AtomicOps::getInt64Relaxed(&d_producer->d_position);
+
+    for (bsls::Types::Int64 position =
+                           AtomicOps::getInt64Relaxed(&d_consumer->d_position);
+         position != tail;
+         ++position) {
+        AllocatorTraits::destroy(d_allocator, d_slots_p + (position & d_mask));
+    }
+    AllocatorTraits::deallocate(d_allocator, d_slots_p, capacity());
+}
+
+// MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+int SpscBoundedQueue<VALUE, ALLOCATOR>::tryPush(const VALUE& value)
+{
+    Side& producer = d_producer.object();
+
+    const bsls::Types::Int64 tail =
+                              AtomicOps::getInt64Relaxed(&producer.d_position);
+
+    if (tail - producer.d_otherCached > d_mask) {
+        producer.d_otherCached =
+                           AtomicOps::getInt64Acquire(&d_consumer->d_position);
+        if (tail - producer.d_otherCached > d_mask) {
+            return 1;                                                 // RETURN
+        }
+    }
+
+    AllocatorTraits::construct(d_allocator,
+                               d_slots_p + (tail & d_mask),
+                               value);
+    AtomicOps::setInt64Release(&producer.d_position, tail + 1);
+    return 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+typename SpscBoundedQueue<VALUE, ALLOCATOR>::size_type
+SpscBoundedQueue<VALUE, ALLOCATOR>::tryPushBatch(const VALUE *values,
+                                                 size_type    numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+
+    Side& producer = d_producer.object();
+
+    const bsls::Types::Int64 tail =
+                              AtomicOps::getInt64Relaxed(&producer.d_position);
+    const bsls::Types::Int64 count = static_cast<bsls::Types::Int64>(
+                                                                    numValues);
+
+    bsls::Types::Int64 numFree = d_mask + 1 - (tail - producer.d_otherCached);
+    if (numFree < count) {
+        producer.d_otherCached =
+                           AtomicOps::getInt64Acquire(&d_consumer->d_position);
+        numFree = d_mask + 1 - (tail - producer.d_otherCached);
+    }
+
+    const bsls::Types::Int64 numPushed = numFree < count ? numFree : count;
+
+    BoundedQueue_ReleaseGuard guard(&producer.d_position, tail);
+    for (bsls::Types::Int64 i = 0; i < numPushed; ++i) {
+        AllocatorTraits::construct(d_allocator,
+                                   d_slots_p + ((tail + i) & d_mask),
+                                   values[i]);
+        guard.next();
+    }
+    return static_cast<size_type>(numPushed);
+}
+
+template <class VALUE, class ALLOCATOR>
+int SpscBoundedQueue<VALUE, ALLOCATOR>::tryPop(VALUE *value)
+{
+    BSLS_ASSERT_SAFE(value);
+
+    Side& consumer = d_consumer.object();
+
+    const bsls::Types::Int64 head =
+                              AtomicOps::getInt64Relaxed(&consumer.d_position);
+
+    if (head == consumer.d_otherCached) {
+        consumer.d_otherCached =
+                           AtomicOps::getInt64Acquire(&d_producer->d_position);
+        if (head == consumer.d_otherCached) {
+            return 1;                                                 // RETURN
+        }
+    }
+
+    VALUE *slot = d_slots_p + (head & d_mask);
+    *value = *slot;
+    AllocatorTraits::destroy(d_allocator, slot);
+    AtomicOps::setInt64Release(&consumer.d_position, head + 1);
+    return 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+typename SpscBoundedQueue<VALUE, ALLOCATOR>::size_type
+SpscBoundedQueue<VALUE, ALLOCATOR>::tryPopBatch(VALUE     *values,
+                                                size_type  maxValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == maxValues);
+
+    Side& consumer = d_consumer.object();
+
+    const bsls::Types::Int64 head =
+                              AtomicOps::getInt64Relaxed(&consumer.d_position);
+    const bsls::Types::Int64 count = static_cast<bsls::Types::Int64>(
+                                                                    maxValues);
+
+    bsls::Types::Int64 numAvailable = consumer.d_otherCached - head;
+    if (numAvailable < count) {
+        consumer.d_otherCached =
+                           AtomicOps::getInt64Acquire(&d_producer->d_position);
+        numAvailable = consumer.d_otherCached - head;
+    }
+
+    const bsls::Types::Int64 numPopped = numAvailable < count
+                                       ? numAvailable
+                                       : count;
+
+    BoundedQueue_ReleaseGuard guard(&consumer.d_position, head);
+    for (bsls::Types::Int64 i = 0; i < numPopped; ++i) {
+        VALUE *slot = d_slots_p + ((head + i) & d_mask);
+        values[i] = *slot;
+        AllocatorTraits::destroy(d_allocator, slot);
+        guard.next();
+    }
+    return static_cast<size_type>(numPopped);
+}
+
+// ACCESSORS
+template <class VALUE, class ALLOCATOR>
+inline
+const typename SpscBoundedQueue<VALUE, ALLOCATOR>::AllocatorType&
+SpscBoundedQueue<VALUE, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+typename SpscBoundedQueue<VALUE, ALLOCATOR>::size_type
+SpscBoundedQueue<VALUE, ALLOCATOR>::capacity() const
+{
+    return static_cast<size_type>(d_mask + 1);
+}
+
+template <class VALUE, class ALLOCATOR>
+typename SpscBoundedQueue<VALUE, ALLOCATOR>::size_type
+SpscBoundedQueue<VALUE, ALLOCATOR>::size() const
+{
+    // Load the head first: as the tail is loaded later, it cannot trail the
+    // head.
+
+    const bsls::Types::Int64 head =
+                           AtomicOps::getInt64Acquire(&d_consumer->d_position);
+    const bsls::Types::Int64 tail =
+                           AtomicOps::getInt64Acquire(&d_producer->d_position);
+
+    return static_cast<size_type>(tail - head > d_mask ? d_mask + 1
+                                                       : tail - head);
+}
+
+                  // ------------------------------------
+                  // class MpmcBoundedQueue::PushProctor
+                  // ------------------------------------
+
+// CREATORS
+template <class VALUE, class ALLOCATOR>
+inline
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PushProctor::PushProctor(
+                                                 Cell               *cells,
+                                                 bsls::Types::Int64  mask,
+                                                 bsls::Types::Int64  begin,
+                                                 bsls::Types::Int64  end)
+: d_cells_p(cells)
+, d_mask(mask)
+, d_position(begin)
+, d_end(end)
+{
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PushProctor::~PushProctor()
+{
+    for (; d_position != d_end; ++d_position) {
+        Cell& cell = current();
+        cell.d_hasValue = false;
+        AtomicOps::setInt64Release(&cell.d_sequence, d_position + 1);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::Cell&
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PushProctor::current()
+{
+    return d_cells_p[d_position & d_mask];
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void MpmcBoundedQueue<VALUE, ALLOCATOR>::PushProctor::publish()
+{
+    Cell& cell = current();
+    cell.d_hasValue = true;
+    AtomicOps::setInt64Release(&cell.d_sequence, d_position + 1);
+    ++d_position;
+}
+
+                  // -----------------------------------
+                  // class MpmcBoundedQueue::PopProctor
+                  // -----------------------------------
+
+// CREATORS
+template <class VALUE, class ALLOCATOR>
+inline
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PopProctor::PopProctor(
+                                             Cell               *cells,
+                                             bsls::Types::Int64  mask,
+                                             bsls::Types::Int64  begin,
+                                             bsls::Types::Int64  end,
+                                             AllocatorType      *allocator)
+: d_cells_p(cells)
+, d_mask(mask)
+, d_position(begin)
+, d_end(end)
+, d_allocator_p(allocator)
+{
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PopProctor::~PopProctor()
+{
+    while (d_position != d_end) {
+        release();
+    }
+}
+
+// MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::Cell&
+MpmcBoundedQueue<VALUE, ALLOCATOR>::PopProctor::current()
+{
+    return d_cells_p[d_position & d_mask];
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void MpmcBoundedQueue<VALUE, ALLOCATOR>::PopProctor::release()
+{
+    Cell& cell = current();
+    if (cell.d_hasValue) {
+        AllocatorTraits::destroy(*d_allocator_p, &cell.d_value.object());
+    }
+    AtomicOps::setInt64Release(&cell.d_sequence, d_position + d_mask + 1);
+    ++d_position;
+}
+
+                           // ----------------------
+                           // class MpmcBoundedQueue
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+bsls::Types::Int64 MpmcBoundedQueue<VALUE, ALLOCATOR>::claim(
+                                               AtomicInt64        *position,
+                                               bsls::Types::Int64  offset,
+                                               size_type           maxCount,
+                                               size_type          *count)
+{
+    bsls::Types::Int64 start = AtomicOps::getInt64Relaxed(position);
+
+    if (0 == maxCount) {
+        *count = 0;
+        return start;                                                 // RETURN
+    }
+
+    for (;;) {
+        // Measure the run of ready slots at 'start'.  A slot that is ready
+        // for this side cannot cease to be so until this side's position
+        // passes it, so the run remains ready if the compare-and-swap below
+        // succeeds.
+
+        size_type          length = 0;
+        bsls::Types::Int64 diff   = 0;
+        while (length < maxCount) {
+            const bsls::Types::Int64 slot =
+                                     start + static_cast<bsls::Types::Int64>(
+                                                                       length);
+            diff = AtomicOps::getInt64Acquire(
+                                      &d_cells_p[slot & d_mask].d_sequence)
+                 - (slot + offset);
+            if (0 != diff) {
+                break;
+            }
+            ++length;
+        }
+
+        if (0 == length) {
+            if (diff < 0) {
+                // The slot has not yet been released by the other side for
+                // this pass: the queue is full (or empty).
+
+                *count = 0;
+                return start;                                         // RETURN
+            }
+
+            // Another thread of this side has claimed the slot; start again
+            // from the current position.
+
+            start = AtomicOps::getInt64Relaxed(position);
+            continue;
+        }
+
+        const bsls::Types::Int64 end =
+                            start + static_cast<bsls::Types::Int64>(length);
+        const bsls::Types::Int64 previous =
+                       AtomicOps::testAndSwapInt64AcqRel(position, start, end);
+        if (previous == start) {
+            *count = length;
+            return start;                                             // RETURN
+        }
+        start = previous;
+    }
+}
+
+// CREATORS
+template <class VALUE, class ALLOCATOR>
+MpmcBoundedQueue<VALUE, ALLOCATOR>::MpmcBoundedQueue(
+                                                size_type        capacity,
+                                                const ALLOCATOR& allocator)
+: d_cells_p(0)
+, d_mask(0)
+, d_allocator(allocator)
+{
+    BSLS_ASSERT(0 < capacity);
+
+    const size_type numCells = BoundedQueue_Util::roundUpCapacity(
+                                                 capacity < 2 ? 2 : capacity);
+
+    d_cells_p = AllocatorTraits::allocate(d_allocator, numCells);
+    d_mask    = static_cast<bsls::Types::Int64>(numCells) - 1;
+
+    for (size_type i = 0; i < numCells; ++i) {
+        AtomicOps::initInt64(&d_cells_p[i].d_sequence,
+                             static_cast<bsls::Types::Int64>(i));
+        d_cells_p[i].d_hasValue = false;
+    }
+    AtomicOps::initInt64(&d_pushPosition.object(), 0);
+    AtomicOps::initInt64(&d_popPosition.object(), 0);
+}
+
+template <class VALUE, class ALLOCATOR>
+MpmcBoundedQueue<VALUE, ALLOCATOR>::~MpmcBoundedQueue()
+{
+    const bsls::Types::Int64 end =
+                          AtomicOps::getInt64Relaxed(&d_pushPosition.object());
+
+    for (bsls::Types::Int64 position =
+                           AtomicOps::getInt64Relaxed(&d_popPosition.object());
+         position != end;
+         ++position) {
+        Cell& cell = d_cells_p[position & d_mask];
+        if (cell.d_hasValue) {
+            AllocatorTraits::destroy(d_allocator, &cell.d_value.object());
+        }
+    }
+    AllocatorTraits::deallocate(d_allocator, d_cells_p, capacity());
+}
+
+// MANIPULATORS
+template <class VALUE, class ALLOCATOR>
+inline
+int MpmcBoundedQueue<VALUE, ALLOCATOR>::tryPush(const VALUE& value)
+{
+    return 1 == tryPushBatch(&value, 1) ? 0 : 1;
+}
+
+template <class VALUE, class ALLOCATOR>
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::size_type
+MpmcBoundedQueue<VALUE, ALLOCATOR>::tryPushBatch(const VALUE *values,
+                                                 size_type    numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+
+    size_type                count = 0;
+    const bsls::Types::Int64 start = claim(&d_pushPosition.object(),
+                                           0,
+                                           numValues,
+                                           &count);
+
+    PushProctor proctor(d_cells_p,
+                        d_mask,
+                        start,
+                        start + static_cast<bsls::Types::Int64>(count));
+    for (size_type i = 0; i < count; ++i) {
+        AllocatorTraits::construct(d_allocator,
+                                   &proctor.current().d_value.object(),
+                                   values[i]);
+        proctor.publish();
+    }
+    return count;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+int MpmcBoundedQueue<VALUE, ALLOCATOR>::tryPop(VALUE *value)
+{
+    return 1 == tryPopBatch(value, 1) ? 0 : 1;
+}
+
+template <class VALUE, class ALLOCATOR>
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::size_type
+MpmcBoundedQueue<VALUE, ALLOCATOR>::tryPopBatch(VALUE     *values,
+                                                size_type  maxValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == maxValues);
+
+    size_type numPopped = 0;
+    while (numPopped < maxValues) {
+        size_type                count = 0;
+        const bsls::Types::Int64 start = claim(&d_popPosition.object(),
+                                               1,
+                                               maxValues - numPopped,
+                                               &count);
+        if (0 == count) {
+            break;
+        }
+
+        // Slots left by failed pushes hold no value, and are released without
+        // being counted; if any were claimed, try again to fill the batch.
+
+        PopProctor proctor(d_cells_p,
+                           d_mask,
+                           start,
+                           start + static_cast<bsls::Types::Int64>(count),
+                           &d_allocator);
+        for (size_type i = 0; i < count; ++i) {
+            Cell& cell = proctor.current();
+            if (cell.d_hasValue) {
+                values[numPopped] = cell.d_value.object();
+                ++numPopped;
+            }
+            proctor.release();
+        }
+    }
+    return numPopped;
+}
+
+// ACCESSORS
+template <class VALUE, class ALLOCATOR>
+inline
+const typename MpmcBoundedQueue<VALUE, ALLOCATOR>::AllocatorType&
+MpmcBoundedQueue<VALUE, ALLOCATOR>::allocator() const
+{
+    return d_allocator;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::size_type
+MpmcBoundedQueue<VALUE, ALLOCATOR>::capacity() const
+{
+    return static_cast<size_type>(d_mask + 1);
+}
+
+template <class VALUE, class ALLOCATOR>
+typename MpmcBoundedQueue<VALUE, ALLOCATOR>::size_type
+MpmcBoundedQueue<VALUE, ALLOCATOR>::size() const
+{
+    // Load the pop position first: as the push position is loaded later, it
+    // cannot trail the pop position.
+
+    const bsls::Types::Int64 head =
+                           AtomicOps::getInt64Acquire(&d_popPosition.object());
+    const bsls::Types::Int64 tail =
+                          AtomicOps::getInt64Acquire(&d_pushPosition.object());
+
+    return static_cast<size_type>(tail - head > d_mask ? d_mask + 1
+                                                       : tail - head);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
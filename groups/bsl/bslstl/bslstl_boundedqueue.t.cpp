@@ -0,0 +1,1482 @@
+// bslstl_boundedqueue.t.cpp                                          -*-C++-*-
+#include <bslstl_boundedqueue.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_deque.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_spinlock.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+typedef HANDLE my_thread_t;
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t my_thread_t;
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides two bounded queues.  Each is first tested
+// on a single thread: capacity rounding and memory allocation, first-in,
+// first-out order across the wrap-around of the ring, the full and empty
+// conditions of the single and batched operations, the destruction of values
+// left in the queue, the use of the queue's allocator by allocator-aware
+// values, and exception safety.  The queues are then tested with concurrent
+// producers and consumers, verifying that every value is popped exactly once
+// and that values from one producer are popped in order.  Negative cases
+// measure throughput and hand-off latency, comparing the queues with a
+// 'bsl::deque' protected by a lock.
+//-----------------------------------------------------------------------------
+// SpscBoundedQueue
+// [ 2] explicit SpscBoundedQueue(size_type capacity, const ALLOCATOR& a);
+// [ 2] ~SpscBoundedQueue();
+// [ 2] int tryPush(const VALUE& value);
+// [ 2] size_type tryPushBatch(const VALUE *values, size_type numValues);
+// [ 2] int tryPop(VALUE *value);
+// [ 2] size_type tryPopBatch(VALUE *values, size_type maxValues);
+// [ 2] const AllocatorType& allocator() const;
+// [ 2] size_type capacity() const;
+// [ 2] size_type size() const;
+//
+// MpmcBoundedQueue
+// [ 3] explicit MpmcBoundedQueue(size_type capacity, const ALLOCATOR& a);
+// [ 3] ~MpmcBoundedQueue();
+// [ 3] int tryPush(const VALUE& value);
+// [ 3] size_type tryPushBatch(const VALUE *values, size_type numValues);
+// [ 3] int tryPop(VALUE *value);
+// [ 3] size_type tryPopBatch(VALUE *values, size_type maxValues);
+// [ 3] const AllocatorType& allocator() const;
+// [ 3] size_type capacity() const;
+// [ 3] size_type size() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: EXCEPTION SAFETY
+// [ 5] CONCURRENCY: 'SpscBoundedQueue'
+// [ 6] CONCURRENCY: 'MpmcBoundedQueue'
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: THROUGHPUT
+// [-2] PERFORMANCE: HAND-OFF LATENCY
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+
+                            // =================
+                            // class CountedType
+                            // =================
+
+class CountedType {
+    // This class wraps an 'int' value, counts the number of live objects, and
+    // (in exception-enabled builds) can be made to throw from its copy
+    // constructor or copy-assignment operator.
+
+    // DATA
+    int d_value;  // wrapped value
+
+  public:
+    // CLASS DATA
+    static int s_numLive;               // number of live objects
+    static int s_copiesBeforeThrow;     // number of copy constructions
+                                        // before one throws, or -1
+    static int s_assignmentsBeforeThrow;
+                                        // number of assignments before one
+                                        // throws, or -1
+
+    // CREATORS
+    explicit CountedType(int value = 0)
+    : d_value(value)
+    {
+        ++s_numLive;
+    }
+
+    CountedType(const CountedType& original)
+    : d_value(original.d_value)
+    {
+        if (0 == s_copiesBeforeThrow) {
+#ifdef BDE_BUILD_TARGET_EXC
+            s_copiesBeforeThrow = -1;
+            throw original.d_value;
+#endif
+        }
+        else if (0 < s_copiesBeforeThrow) {
+            --s_copiesBeforeThrow;
+        }
+        ++s_numLive;
+    }
+
+    ~CountedType()
+    {
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    CountedType& operator=(const CountedType& rhs)
+    {
+        if (0 == s_assignmentsBeforeThrow) {
+#ifdef BDE_BUILD_TARGET_EXC
+            s_assignmentsBeforeThrow = -1;
+            throw rhs.d_value;
+#endif
+        }
+        else if (0 < s_assignmentsBeforeThrow) {
+            --s_assignmentsBeforeThrow;
+        }
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+int CountedType::s_numLive               = 0;
+int CountedType::s_copiesBeforeThrow     = -1;
+int CountedType::s_assignmentsBeforeThrow = -1;
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+extern "C" {
+    typedef void *(*THREAD_ENTRY)(void *arg);
+}
+
+static int myCreateThread(my_thread_t  *handle,
+                          THREAD_ENTRY  entry,
+                          void         *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    *handle = CreateThread(0, 0, (LPTHREAD_START_ROUTINE)entry, arg, 0, 0);
+    return *handle ? 0 : -1;
+#else
+    return pthread_create(handle, 0, entry, arg);
+#endif
+}
+
+static void myJoinThread(my_thread_t handle)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(handle, INFINITE);
+    CloseHandle(handle);
+#else
+    pthread_join(handle, 0);
+#endif
+}
+
+static void myYield()
+    // Yield the processor to another thread.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+                            // =================
+                            // struct ThreadTask
+                            // =================
+
+struct ThreadTask {
+    // This 'struct' describes the work of a thread: call 'd_function' with
+    // 'd_arg'.
+
+    void (*d_function)(void *);  // function to call
+    void  *d_arg;                // argument to pass
+};
+
+extern "C" void *threadEntry(void *arg)
+{
+    ThreadTask *task = static_cast<ThreadTask *>(arg);
+    task->d_function(task->d_arg);
+    return 0;
+}
+
+static void runThreads(ThreadTask *tasks, int numTasks)
+    // Run each of the specified 'numTasks' 'tasks' on a thread of its own,
+    // and wait for all of them to complete.
+{
+    my_thread_t handles[64];
+
+    ASSERT(numTasks <= 64);
+
+    for (int i = 0; i < numTasks; ++i) {
+        ASSERT(0 == myCreateThread(&handles[i], &threadEntry, &tasks[i]));
+    }
+    for (int i = 0; i < numTasks; ++i) {
+        myJoinThread(handles[i]);
+    }
+}
+
+                            // ================
+                            // class LockedQueue
+                            // ================
+
+template <class VALUE>
+class LockedQueue {
+    // This class implements a bounded queue of 'VALUE' objects as a
+    // 'bsl::deque' protected by a lock, providing the interface of the queues
+    // under test, for comparison in the performance tests.
+
+    // DATA
+    bsls::HybridLock  d_lock;      // protects 'd_deque'
+    bsl::deque<VALUE> d_deque;     // values
+    std::size_t       d_capacity;  // maximum size of 'd_deque'
+
+  public:
+    // CREATORS
+    explicit LockedQueue(std::size_t capacity)
+    : d_capacity(capacity)
+    {
+        d_lock.initialize();
+    }
+
+    // MANIPULATORS
+    int tryPush(const VALUE& value)
+    {
+        return 1 == tryPushBatch(&value, 1) ? 0 : 1;
+    }
+
+    std::size_t tryPushBatch(const VALUE *values, std::size_t numValues)
+    {
+        bsls::SpinLockGuard<bsls::HybridLock> guard(&d_lock);
+
+        std::size_t count = d_capacity - d_deque.size();
+        count = count < numValues ? count : numValues;
+        for (std::size_t i = 0; i < count; ++i) {
+            d_deque.push_back(values[i]);
+        }
+        return count;
+    }
+
+    int tryPop(VALUE *value)
+    {
+        return 1 == tryPopBatch(value, 1) ? 0 : 1;
+    }
+
+    std::size_t tryPopBatch(VALUE *values, std::size_t maxValues)
+    {
+        bsls::SpinLockGuard<bsls::HybridLock> guard(&d_lock);
+
+        std::size_t count = d_deque.size();
+        count = count < maxValues ? count : maxValues;
+        for (std::size_t i = 0; i < count; ++i) {
+            values[i] = d_deque.front();
+            d_deque.pop_front();
+        }
+        return count;
+    }
+};
+
+                           // ====================
+                           // struct TransferState
+                           // ====================
+
+template <class QUEUE>
+struct TransferState {
+    // This 'struct' holds the state shared by the producers and consumers of
+    // the concurrency and throughput tests.  Producer 'p' pushes the values
+    // 'p * k_RANGE + i', for 'i' in '[0, d_numPerProducer)'; the consumers pop
+    // until 'd_numPopped' reaches the total.
+
+    enum { k_RANGE = 1 << 24 };     // maximum number of values per producer
+
+    QUEUE             *d_queue_p;          // queue under test
+    int                d_numPerProducer;   // values pushed by each producer
+    int                d_numProducers;     // number of producers
+    int                d_batchSize;        // 1 for single operations
+    bsls::AtomicInt    d_nextId;           // identifies threads
+    bsls::AtomicInt64  d_numPopped;        // values popped, by all consumers
+    bsls::AtomicInt64  d_sumPopped;        // sum of the values popped
+    bsls::AtomicInt    d_numErrors;        // order violations observed
+};
+
+template <class QUEUE>
+void producerFunction(void *arg)
+    // Push the values of the producer identified by the next id of the
+    // specified 'arg' (a 'TransferState<QUEUE>') onto its queue, in batches
+    // if its batch size exceeds 1.
+{
+    TransferState<QUEUE> *state = static_cast<TransferState<QUEUE> *>(arg);
+
+    const int id    = state->d_nextId++;
+    const int n     = state->d_numPerProducer;
+    const int batch = state->d_batchSize;
+    QUEUE    *queue = state->d_queue_p;
+
+    int values[64];
+    ASSERT(batch <= 64);
+
+    for (int i = 0; i < n; ) {
+        int count = n - i < batch ? n - i : batch;
+        for (int j = 0; j < count; ++j) {
+            values[j] = id * TransferState<QUEUE>::k_RANGE + i + j;
+        }
+        const int pushed = 1 == batch
+                         ? (0 == queue->tryPush(values[0]) ? 1 : 0)
+                         : static_cast<int>(queue->tryPushBatch(values,
+                                                                count));
+        if (0 == pushed) {
+            myYield();
+        }
+        i += pushed;
+    }
+}
+
+template <class QUEUE>
+void consumerFunction(void *arg)
+    // Pop values from the queue of the specified 'arg' (a
+    // 'TransferState<QUEUE>'), in batches if its batch size exceeds 1, until
+    // all the values pushed by its producers have been popped, verifying that
+    // the values of each producer are popped in order.
+{
+    TransferState<QUEUE> *state = static_cast<TransferState<QUEUE> *>(arg);
+
+    const int   batch = state->d_batchSize;
+    const Int64 total = static_cast<Int64>(state->d_numPerProducer)
+                                                      * state->d_numProducers;
+    QUEUE      *queue = state->d_queue_p;
+
+    int   last[64];
+    int   values[64];
+    Int64 sum = 0;
+
+    for (int i = 0; i < 64; ++i) {
+        last[i] = -1;
+    }
+
+    while (state->d_numPopped < total) {
+        const int popped = 1 == batch
+                         ? (0 == queue->tryPop(values) ? 1 : 0)
+                         : static_cast<int>(queue->tryPopBatch(values,
+                                                               batch));
+        if (0 == popped) {
+            myYield();
+            continue;
+        }
+        for (int j = 0; j < popped; ++j) {
+            const int producer = values[j] / TransferState<QUEUE>::k_RANGE;
+            const int index    = values[j] % TransferState<QUEUE>::k_RANGE;
+            if (index <= last[producer]) {
+                ++state->d_numErrors;
+            }
+            last[producer] = index;
+            sum += values[j];
+        }
+        state->d_numPopped += popped;
+    }
+    state->d_sumPopped += sum;
+}
+
+template <class QUEUE>
+Int64 runTransfer(QUEUE *queue,
+                  int    numProducers,
+                  int    numConsumers,
+                  int    numPerProducer,
+                  int    batchSize)
+    // Transfer the specified 'numPerProducer' values from each of the
+    // specified 'numProducers' threads to the specified 'numConsumers'
+    // threads through the specified 'queue', pushing and popping in batches
+    // of the specified 'batchSize', verify that each value was popped once,
+    // in order for each producer, and return the elapsed time in
+    // nanoseconds.
+{
+    TransferState<QUEUE> state;
+    state.d_queue_p        = queue;
+    state.d_numPerProducer = numPerProducer;
+    state.d_numProducers   = numProducers;
+    state.d_batchSize      = batchSize;
+
+    ThreadTask tasks[64];
+    for (int i = 0; i < numProducers + numConsumers; ++i) {
+        tasks[i].d_function = i < numProducers ? &producerFunction<QUEUE>
+                                               : &consumerFunction<QUEUE>;
+        tasks[i].d_arg      = &state;
+    }
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    runThreads(tasks, numProducers + numConsumers);
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    Int64 expectedSum = 0;
+    for (int p = 0; p < numProducers; ++p) {
+        expectedSum += static_cast<Int64>(p) * TransferState<QUEUE>::k_RANGE
+                                                               * numPerProducer
+                     + static_cast<Int64>(numPerProducer)
+                                                  * (numPerProducer - 1) / 2;
+    }
+
+    ASSERTV(numProducers, numConsumers, batchSize, state.d_numPopped,
+            static_cast<Int64>(numProducers) * numPerProducer
+                                                       == state.d_numPopped);
+    ASSERTV(numProducers, numConsumers, batchSize, state.d_sumPopped,
+            expectedSum == state.d_sumPopped);
+    ASSERTV(numProducers, numConsumers, batchSize, state.d_numErrors,
+            0 == state.d_numErrors);
+
+    return elapsed;
+}
+
+template <class QUEUE>
+struct PingPongState {
+    // This 'struct' holds the state shared by the two threads of the latency
+    // test.
+
+    QUEUE *d_ping_p;         // values sent to the echoing thread
+    QUEUE *d_pong_p;         // values echoed back
+    int    d_numRoundTrips;  // number of values to echo
+};
+
+template <class QUEUE>
+void echoFunction(void *arg)
+    // Pop each value from the ping queue of the specified 'arg' (a
+    // 'PingPongState<QUEUE>') and push it onto its pong queue.
+{
+    PingPongState<QUEUE> *state = static_cast<PingPongState<QUEUE> *>(arg);
+
+    for (int i = 0; i < state->d_numRoundTrips; ++i) {
+        int value;
+        while (0 != state->d_ping_p->tryPop(&value)) {
+            myYield();
+        }
+        while (0 != state->d_pong_p->tryPush(value)) {
+            myYield();
+        }
+    }
+}
+
+template <class QUEUE>
+Int64 runPingPong(QUEUE *ping, QUEUE *pong, int numRoundTrips)
+    // Send the specified 'numRoundTrips' values, one at a time, through the
+    // specified 'ping' queue to a thread that echoes each through the
+    // specified 'pong' queue, and return the elapsed time in nanoseconds.
+{
+    PingPongState<QUEUE> state;
+    state.d_ping_p        = ping;
+    state.d_pong_p        = pong;
+    state.d_numRoundTrips = numRoundTrips;
+
+    ThreadTask task;
+    task.d_function = &echoFunction<QUEUE>;
+    task.d_arg      = &state;
+
+    my_thread_t handle;
+    ASSERT(0 == myCreateThread(&handle, &threadEntry, &task));
+
+    const Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numRoundTrips; ++i) {
+        while (0 != ping->tryPush(i)) {
+            myYield();
+        }
+        int value;
+        while (0 != pong->tryPop(&value)) {
+            myYield();
+        }
+        ASSERTV(i, value, i == value);
+    }
+    const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    myJoinThread(handle);
+    return elapsed;
+}
+
+                      // ===============================
+                      // single-threaded test functions
+                      // ===============================
+
+template <template <class, class> class QUEUE>
+void testSingleOperations(int minCapacity)
+    // Test the single-value operations, the accessors, and the destructor of
+    // the specified 'QUEUE', whose capacity is at least the specified
+    // 'minCapacity', on one thread.
+{
+    typedef QUEUE<CountedType, bsl::allocator<CountedType> > Obj;
+
+    bslma::TestAllocator         da("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    static const struct {
+        int d_line;
+        int d_capacity;
+        int d_expected;
+    } DATA[] = {
+        { L_,   1,   1 },
+        { L_,   2,   2 },
+        { L_,   3,   4 },
+        { L_,   4,   4 },
+        { L_,   5,   8 },
+        { L_,   8,   8 },
+        { L_,  33,  64 },
+        { L_, 100, 128 },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int CAPACITY = DATA[ti].d_capacity;
+        const int EXPECTED = DATA[ti].d_expected < minCapacity
+                           ? minCapacity
+                           : DATA[ti].d_expected;
+
+        if (veryVerbose) { T_ P_(LINE) P_(CAPACITY) P(EXPECTED) }
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(CAPACITY, &oa);  const Obj& X = mX;
+
+            ASSERTV(LINE, EXPECTED == static_cast<int>(X.capacity()));
+            ASSERTV(LINE, 0 == X.size());
+            ASSERTV(LINE, &oa == X.allocator().mechanism());
+            ASSERTV(LINE, 1 == oa.numBlocksInUse());
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+            ASSERTV(LINE, 0 == CountedType::s_numLive);
+
+            // Fill and drain the queue several times, each time starting
+            // at a different position in the ring.
+
+            int next     = 0;  // next value to push
+            int expected = 0;  // next value expected to be popped
+
+            for (int round = 0; round < 3 * EXPECTED + 2; ++round) {
+                const int offset = round % EXPECTED;
+                for (int i = 0; i < offset; ++i) {
+                    ASSERTV(LINE, 0 == mX.tryPush(CountedType(next++)));
+                }
+                for (int i = 0; i < offset; ++i) {
+                    CountedType value;
+                    ASSERTV(LINE, 0 == mX.tryPop(&value));
+                    ASSERTV(LINE, expected == value.value());
+                    ++expected;
+                }
+
+                for (int i = 0; i < EXPECTED; ++i) {
+                    ASSERTV(LINE, i, i == static_cast<int>(X.size()));
+                    ASSERTV(LINE, i, 0 == mX.tryPush(CountedType(next++)));
+                }
+                ASSERTV(LINE, EXPECTED == static_cast<int>(X.size()));
+                ASSERTV(LINE, 0 != mX.tryPush(CountedType(-1)));
+                ASSERTV(LINE, EXPECTED == static_cast<int>(X.size()));
+                ASSERTV(LINE, EXPECTED == CountedType::s_numLive);
+
+                for (int i = 0; i < EXPECTED; ++i) {
+                    CountedType value;
+                    ASSERTV(LINE, i, 0 == mX.tryPop(&value));
+                    ASSERTV(LINE, i, expected == value.value());
+                    ++expected;
+                }
+                CountedType value(-2);
+                ASSERTV(LINE, 0 != mX.tryPop(&value));
+                ASSERTV(LINE, -2 == value.value());
+                ASSERTV(LINE, 0 == X.size());
+            }
+            ASSERTV(LINE, 0 == CountedType::s_numLive);
+            ASSERTV(LINE, 1 == oa.numBlocksInUse());
+
+            // Leave values in the queue for the destructor.
+
+            for (int i = 0; i < (EXPECTED + 1) / 2; ++i) {
+                ASSERTV(LINE, 0 == mX.tryPush(CountedType(i)));
+            }
+            ASSERTV(LINE, (EXPECTED + 1) / 2 == CountedType::s_numLive);
+        }
+        ASSERTV(LINE, 0 == CountedType::s_numLive);
+        ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, 0 == da.numBlocksInUse());
+    }
+
+    if (veryVerbose) printf("\tAllocator-aware values use the queue's "
+                            "allocator.\n");
+    {
+        typedef QUEUE<bsltf::AllocTestType,
+                      bsl::allocator<bsltf::AllocTestType> > AllocObj;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        AllocObj mX(4, &oa);  const AllocObj& X = mX;
+        ASSERT(1 == oa.numBlocksInUse());
+
+        const bsltf::AllocTestType VALUE(17, &sa);
+        ASSERT(1 == sa.numBlocksInUse());
+
+        ASSERT(0 == mX.tryPush(VALUE));
+        ASSERT(2 == oa.numBlocksInUse());
+        ASSERT(1 == sa.numBlocksInUse());
+        ASSERT(1 == X.size());
+
+        bsltf::AllocTestType value(&sa);
+        ASSERT(0 == mX.tryPop(&value));
+        ASSERT(17 == value.data());
+        ASSERT(&sa == value.allocator());
+        ASSERT(1 == oa.numBlocksInUse());
+    }
+    ASSERT(0 == da.numBlocksInUse());
+}
+
+template <template <class, class> class QUEUE>
+void testBatchOperations()
+    // Test the batched operations of the specified 'QUEUE' on one thread,
+    // against a model of the queue's contents.
+{
+    typedef QUEUE<CountedType, bsl::allocator<CountedType> > Obj;
+
+    bslma::TestAllocator oa("object", veryVeryVerbose);
+
+    const int CAPACITIES[] = { 1, 4, 16 };
+    const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+    for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+        Obj mX(CAPACITIES[ti], &oa);  const Obj& X = mX;
+
+        const int CAPACITY = static_cast<int>(X.capacity());
+
+        CountedType values[40];
+        int         next     = 0;  // next value to push
+        int         expected = 0;  // next value expected to be popped
+
+        ASSERTV(CAPACITY, 0 == mX.tryPushBatch(values, 0));
+        ASSERTV(CAPACITY, 0 == mX.tryPopBatch(values, 0));
+        ASSERTV(CAPACITY, 0 == mX.tryPopBatch(values, 5));
+
+        for (int round = 0; round < 200; ++round) {
+            const int numToPush = (round * 7) % (2 * CAPACITY + 3);
+            const int numToPop  = (round * 5) % (2 * CAPACITY + 3);
+            const int size      = next - expected;
+
+            for (int i = 0; i < numToPush; ++i) {
+                values[i] = CountedType(next + i);
+            }
+            const int expPushed = numToPush < CAPACITY - size
+                                ? numToPush
+                                : CAPACITY - size;
+            const int pushed = static_cast<int>(mX.tryPushBatch(values,
+                                                                numToPush));
+            ASSERTV(CAPACITY, round, expPushed, pushed, expPushed == pushed);
+            next += pushed;
+            ASSERTV(CAPACITY, round, next - expected ==
+                                            static_cast<int>(X.size()));
+
+            const int expPopped = numToPop < next - expected
+                                ? numToPop
+                                : next - expected;
+            const int popped = static_cast<int>(mX.tryPopBatch(values,
+                                                               numToPop));
+            ASSERTV(CAPACITY, round, expPopped, popped, expPopped == popped);
+            for (int i = 0; i < popped; ++i) {
+                ASSERTV(CAPACITY, round, i, expected == values[i].value());
+                ++expected;
+            }
+            ASSERTV(CAPACITY, round, next - expected ==
+                                            static_cast<int>(X.size()));
+        }
+    }
+    ASSERT(0 == CountedType::s_numLive);
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Distributing Jobs to Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several threads generate jobs, each identified by an 'int', and
+// that a pool of worker threads processes them.  A
+// 'bslstl::MpmcBoundedQueue' can hand the jobs from the generating threads to
+// the workers without a mutex, and bounds the number of pending jobs.
+//
+// First, we define a function that generates jobs, retrying whenever the
+// queue is full:
+//..
+    typedef bslstl::MpmcBoundedQueue<int> JobQueue;
+
+    void generateJobs(JobQueue *queue, int firstJob, int numJobs)
+        // Push the specified 'numJobs' consecutive job identifiers, starting
+        // at the specified 'firstJob', onto the specified 'queue'.
+    {
+        for (int i = 0; i < numJobs; ) {
+            if (0 == queue->tryPush(firstJob + i)) {
+                ++i;
+            }
+            else {
+                // The queue is full: a real application would yield the
+                // processor, or back off, before retrying.
+            }
+        }
+    }
+//..
+// Then, we define the function that a worker calls to take the jobs to
+// process next; it takes up to 'maxJobs' jobs at once, so that the cost of
+// synchronizing with other workers is paid once per batch:
+//..
+    int takeJobs(JobQueue *queue, int *jobs, int maxJobs)
+        // Load into the specified 'jobs' array the next (at most the
+        // specified 'maxJobs') jobs from the specified 'queue', and return the
+        // number of jobs loaded.
+    {
+        return static_cast<int>(queue->tryPopBatch(jobs, maxJobs));
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Next, we create a queue that can hold 16 pending jobs, supplying its memory
+// from a test allocator:
+//..
+    bslma::TestAllocator ta;
+    JobQueue             queue(16, &ta);
+    ASSERT(16 == queue.capacity());
+    ASSERT( 0 == queue.size());
+//..
+// Then, a generating thread (here, the current thread) generates 10 jobs:
+//..
+    generateJobs(&queue, 100, 10);
+    ASSERT(10 == queue.size());
+//..
+// Now, a worker takes the jobs in batches of 4:
+//..
+    int jobs[4];
+    ASSERT(4 == takeJobs(&queue, jobs, 4));
+    ASSERT(100 == jobs[0]);  ASSERT(103 == jobs[3]);
+    ASSERT(4 == takeJobs(&queue, jobs, 4));
+    ASSERT(104 == jobs[0]);  ASSERT(107 == jobs[3]);
+//..
+// Finally, the last batch is short, after which the queue is empty:
+//..
+    ASSERT(2 == takeJobs(&queue, jobs, 4));
+    ASSERT(108 == jobs[0]);  ASSERT(109 == jobs[1]);
+    ASSERT(0 == takeJobs(&queue, jobs, 4));
+//..
+// In a real application, several generating threads would call
+// 'generateJobs', and several workers would call 'takeJobs', concurrently.
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: 'MpmcBoundedQueue'
+        //
+        // Concerns:
+        //: 1 With several producers and consumers, each value pushed is
+        //:   popped exactly once.
+        //:
+        //: 2 The values pushed by one producer are popped in order.
+        //:
+        //: 3 The batched operations are correct when concurrent.
+        //
+        // Plan:
+        //: 1 For several numbers of producers and consumers, queue capacities,
+        //:   and batch sizes, have each producer push a distinct sequence of
+        //:   values, and have the consumers verify that the values of each
+        //:   producer arrive in order, and (together) that their count and
+        //:   sum are as expected.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY: 'MpmcBoundedQueue'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: 'MpmcBoundedQueue'"
+                            "\n===============================\n");
+
+        typedef bslstl::MpmcBoundedQueue<int> Obj;
+
+        static const struct {
+            int d_line;
+            int d_numProducers;
+            int d_numConsumers;
+        } DATA[] = {
+            { L_, 1, 1 },
+            { L_, 2, 2 },
+            { L_, 4, 1 },
+            { L_, 1, 4 },
+            { L_, 4, 4 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const int CAPACITIES[]   = { 1, 8, 256 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+        const int BATCHES[]      = { 1, 16 };
+        const int NUM_BATCHES    = sizeof BATCHES / sizeof *BATCHES;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+            const int NP   = DATA[ti].d_numProducers;
+            const int NC   = DATA[ti].d_numConsumers;
+
+            for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+                for (int bi = 0; bi < NUM_BATCHES; ++bi) {
+                    const int CAPACITY = CAPACITIES[ci];
+                    const int BATCH    = BATCHES[bi];
+
+                    if (veryVerbose) {
+                        T_ P_(LINE) P_(NP) P_(NC) P_(CAPACITY) P(BATCH)
+                    }
+
+                    Obj mX(CAPACITY, &oa);
+                    runTransfer(&mX, NP, NC, 20000, BATCH);
+                    ASSERTV(LINE, CAPACITY, BATCH, 0 == mX.size());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: 'SpscBoundedQueue'
+        //
+        // Concerns:
+        //: 1 With one producer and one consumer, each value pushed is popped
+        //:   exactly once, and in order, including when the queue is
+        //:   repeatedly full or empty.
+        //:
+        //: 2 The batched operations are correct when concurrent.
+        //
+        // Plan:
+        //: 1 For several queue capacities and batch sizes, transfer a
+        //:   sequence of values from a producer thread to a consumer thread,
+        //:   verifying order, count, and sum.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY: 'SpscBoundedQueue'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY: 'SpscBoundedQueue'"
+                            "\n===============================\n");
+
+        typedef bslstl::SpscBoundedQueue<int> Obj;
+
+        const int CAPACITIES[]   = { 1, 4, 64, 1024 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+        const int BATCHES[]      = { 1, 3, 16 };
+        const int NUM_BATCHES    = sizeof BATCHES / sizeof *BATCHES;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int bi = 0; bi < NUM_BATCHES; ++bi) {
+                const int CAPACITY = CAPACITIES[ci];
+                const int BATCH    = BATCHES[bi];
+
+                if (veryVerbose) { T_ P_(CAPACITY) P(BATCH) }
+
+                Obj mX(CAPACITY, &oa);
+                runTransfer(&mX, 1, 1, 100000, BATCH);
+                ASSERTV(CAPACITY, BATCH, 0 == mX.size());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If the copy constructor of 'VALUE' throws during a push onto a
+        //:   'SpscBoundedQueue', the queue is unchanged (or, for a batch,
+        //:   holds the values pushed before the failure).
+        //:
+        //: 2 If the assignment operator of 'VALUE' throws during a pop from a
+        //:   'SpscBoundedQueue', the queue is unchanged (or, for a batch,
+        //:   holds the value being popped and those after it).
+        //:
+        //: 3 If the copy constructor throws during a push onto a
+        //:   'MpmcBoundedQueue', the slot is skipped by consumers, and the
+        //:   queue remains usable.
+        //:
+        //: 4 If the assignment operator throws during a pop from a
+        //:   'MpmcBoundedQueue', the values claimed by the pop that were not
+        //:   assigned are destroyed, and the queue remains usable.
+        //:
+        //: 5 No values are leaked.
+        //
+        // Plan:
+        //: 1 Using a value type that can be made to throw on its N'th copy
+        //:   construction or assignment, push and pop values, singly and in
+        //:   batches, verify the contents of the queue after each exception,
+        //:   and verify the number of live values.  (C-1..5)
+        //
+        // Testing:
+        //   CONCERN: EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCERN: EXCEPTION SAFETY"
+                            "\n=========================\n");
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) printf("\t'SpscBoundedQueue'\n");
+        {
+            typedef bslstl::SpscBoundedQueue<CountedType> Obj;
+
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            CountedType values[4];
+            for (int i = 0; i < 4; ++i) {
+                values[i] = CountedType(i);
+            }
+
+            ASSERT(0 == mX.tryPush(values[0]));
+            ASSERT(0 == mX.tryPush(values[1]));
+
+            bool caught = false;
+            CountedType::s_copiesBeforeThrow = 0;
+            try {
+                mX.tryPush(values[2]);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+            ASSERT(6 == CountedType::s_numLive);
+
+            caught = false;
+            CountedType::s_copiesBeforeThrow = 1;
+            try {
+                mX.tryPushBatch(values + 2, 2);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(3 == X.size());
+            ASSERT(7 == CountedType::s_numLive);
+
+            CountedType value(-1);
+            caught = false;
+            CountedType::s_assignmentsBeforeThrow = 0;
+            try {
+                mX.tryPop(&value);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(3 == X.size());
+            ASSERT(-1 == value.value());
+
+            caught = false;
+            CountedType::s_assignmentsBeforeThrow = 1;
+            try {
+                mX.tryPopBatch(values, 3);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+            ASSERT(0 == values[0].value());
+
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(1 == value.value());
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(2 == value.value());
+            ASSERT(0 != mX.tryPop(&value));
+            ASSERT(5 == CountedType::s_numLive);
+        }
+        ASSERT(0 == CountedType::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\t'MpmcBoundedQueue'\n");
+        {
+            typedef bslstl::MpmcBoundedQueue<CountedType> Obj;
+
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            CountedType values[4];
+            for (int i = 0; i < 4; ++i) {
+                values[i] = CountedType(i);
+            }
+
+            ASSERT(0 == mX.tryPush(values[0]));
+
+            bool caught = false;
+            CountedType::s_copiesBeforeThrow = 0;
+            try {
+                mX.tryPush(values[1]);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());  // the failed slot is counted
+            ASSERT(5 == CountedType::s_numLive);
+
+            CountedType value(-1);
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(0 == value.value());
+            ASSERT(0 != mX.tryPop(&value));  ASSERT(0 == value.value());
+            ASSERT(0 == X.size());
+
+            caught = false;
+            CountedType::s_copiesBeforeThrow = 1;
+            try {
+                mX.tryPushBatch(values + 1, 3);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(3 == X.size());
+            ASSERT(6 == CountedType::s_numLive);
+
+            CountedType popped[4];
+            ASSERT(1 == mX.tryPopBatch(popped, 4));
+            ASSERT(1 == popped[0].value());
+            ASSERT(0 == X.size());
+            ASSERT(9 == CountedType::s_numLive);
+
+            ASSERT(2 == mX.tryPushBatch(values + 2, 2));
+            ASSERT(11 == CountedType::s_numLive);
+
+            caught = false;
+            CountedType::s_assignmentsBeforeThrow = 0;
+            try {
+                mX.tryPopBatch(popped, 2);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == X.size());
+            ASSERT(9 == CountedType::s_numLive);
+
+            ASSERT(0 == mX.tryPush(values[3]));
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(3 == value.value());
+        }
+        ASSERT(0 == CountedType::s_numLive);
+        ASSERT(0 == oa.numBlocksInUse());
+#else
+        if (verbose) printf("\tSkipped: exceptions are disabled.\n");
+#endif
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'MpmcBoundedQueue' SINGLE-THREADED OPERATIONS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and at least 2, and the slots are allocated, once, from the
+        //:   allocator supplied at construction.
+        //:
+        //: 2 Values are popped in the order in which they were pushed,
+        //:   starting at any position in the ring.
+        //:
+        //: 3 'tryPush' fails, with no effect, if and only if the queue is
+        //:   full, and 'tryPop' if and only if the queue is empty.
+        //:
+        //: 4 'size' returns the number of values in the queue.
+        //:
+        //: 5 The destructor destroys the values in the queue, and returns the
+        //:   memory to the allocator.
+        //:
+        //: 6 Allocator-aware values are constructed with the queue's
+        //:   allocator.
+        //:
+        //: 7 The batched operations transfer as many values as are requested,
+        //:   or as fit (or are available), in order.
+        //
+        // Plan:
+        //: 1 For a table of capacities, fill and drain the queue repeatedly,
+        //:   starting at every offset, verifying order, sizes, and the full
+        //:   and empty conditions, and destroy the queue while it holds
+        //:   values, verifying the number of live values and the allocator
+        //:   usage.  (C-1..5)
+        //:
+        //: 2 Push and pop a 'bsltf::AllocTestType', verifying the allocator
+        //:   usage.  (C-6)
+        //:
+        //: 3 Push and pop batches of various sizes, verifying the results
+        //:   against a model of the queue's contents.  (C-7)
+        //
+        // Testing:
+        //   explicit MpmcBoundedQueue(size_type capacity, const ALLOCATOR& a);
+        //   ~MpmcBoundedQueue();
+        //   int tryPush(const VALUE& value);
+        //   size_type tryPushBatch(const VALUE *values, size_type numValues);
+        //   int tryPop(VALUE *value);
+        //   size_type tryPopBatch(VALUE *values, size_type maxValues);
+        //   const AllocatorType& allocator() const;
+        //   size_type capacity() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\n'MpmcBoundedQueue' SINGLE-THREADED OPERATIONS"
+                          "\n=============================================\n");
+
+        testSingleOperations<bslstl::MpmcBoundedQueue>(2);
+        testBatchOperations<bslstl::MpmcBoundedQueue>();
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'SpscBoundedQueue' SINGLE-THREADED OPERATIONS
+        //
+        // Concerns:
+        //: 1 The capacity is the requested capacity rounded up to a power of
+        //:   two, and the slots are allocated, once, from the allocator
+        //:   supplied at construction.
+        //:
+        //: 2 Values are popped in the order in which they were pushed,
+        //:   starting at any position in the ring.
+        //:
+        //: 3 'tryPush' fails, with no effect, if and only if the queue is
+        //:   full, and 'tryPop' if and only if the queue is empty.
+        //:
+        //: 4 'size' returns the number of values in the queue.
+        //:
+        //: 5 The destructor destroys the values in the queue, and returns the
+        //:   memory to the allocator.
+        //:
+        //: 6 Allocator-aware values are constructed with the queue's
+        //:   allocator.
+        //:
+        //: 7 The batched operations transfer as many values as are requested,
+        //:   or as fit (or are available), in order.
+        //
+        // Plan:
+        //: 1 For a table of capacities, fill and drain the queue repeatedly,
+        //:   starting at every offset, verifying order, sizes, and the full
+        //:   and empty conditions, and destroy the queue while it holds
+        //:   values, verifying the number of live values and the allocator
+        //:   usage.  (C-1..5)
+        //:
+        //: 2 Push and pop a 'bsltf::AllocTestType', verifying the allocator
+        //:   usage.  (C-6)
+        //:
+        //: 3 Push and pop batches of various sizes, verifying the results
+        //:   against a model of the queue's contents.  (C-7)
+        //
+        // Testing:
+        //   explicit SpscBoundedQueue(size_type capacity, const ALLOCATOR& a);
+        //   ~SpscBoundedQueue();
+        //   int tryPush(const VALUE& value);
+        //   size_type tryPushBatch(const VALUE *values, size_type numValues);
+        //   int tryPop(VALUE *value);
+        //   size_type tryPopBatch(VALUE *values, size_type maxValues);
+        //   const AllocatorType& allocator() const;
+        //   size_type capacity() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\n'SpscBoundedQueue' SINGLE-THREADED OPERATIONS"
+                          "\n=============================================\n");
+
+        testSingleOperations<bslstl::SpscBoundedQueue>(1);
+        testBatchOperations<bslstl::SpscBoundedQueue>();
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push and pop a few values through each queue.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        {
+            bslstl::SpscBoundedQueue<int> mX(2);
+            int value = 0;
+            ASSERT(2 == mX.capacity());
+            ASSERT(0 == mX.tryPush(1));
+            ASSERT(0 == mX.tryPush(2));
+            ASSERT(0 != mX.tryPush(3));
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(1 == value);
+            ASSERT(0 == mX.tryPush(3));
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(2 == value);
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(3 == value);
+            ASSERT(0 != mX.tryPop(&value));
+        }
+        {
+            bslstl::MpmcBoundedQueue<int> mX(2);
+            int value = 0;
+            ASSERT(2 == mX.capacity());
+            ASSERT(0 == mX.tryPush(1));
+            ASSERT(0 == mX.tryPush(2));
+            ASSERT(0 != mX.tryPush(3));
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(1 == value);
+            ASSERT(0 == mX.tryPush(3));
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(2 == value);
+            ASSERT(0 == mX.tryPop(&value));  ASSERT(3 == value);
+            ASSERT(0 != mX.tryPop(&value));
+        }
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: THROUGHPUT
+        //
+        // Concerns:
+        //: 1 The queues transfer values faster than a 'bsl::deque' protected
+        //:   by a lock, and batching amortizes the cost of synchronization.
+        //
+        // Plan:
+        //: 1 For 1:1, 2:2, 4:4, and 8:8 producers and consumers, and batch
+        //:   sizes 1 and 16, transfer a number of values per producer (which
+        //:   may be given as the second argument) through each queue, and
+        //:   report the throughput in millions of values per second.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: THROUGHPUT
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: THROUGHPUT"
+               "\n=======================\n");
+
+        const int NUM_PER_PRODUCER = argc > 2 ? atoi(argv[2]) : 1000000;
+        const int CAPACITY         = 1024;
+
+        printf("%6s %6s %12s %12s %12s\n",
+               "P:C", "batch", "spsc Mops/s", "mpmc Mops/s", "lock Mops/s");
+
+        for (int n = 1; n <= 8; n *= 2) {
+            for (int batch = 1; batch <= 16; batch *= 16) {
+                const double NUM_VALUES = static_cast<double>(n)
+                                                           * NUM_PER_PRODUCER;
+
+                double spsc = 0;
+                if (1 == n) {
+                    bslstl::SpscBoundedQueue<int> queue(CAPACITY);
+                    spsc = NUM_VALUES * 1000.0
+                         / static_cast<double>(runTransfer(&queue,
+                                                           1,
+                                                           1,
+                                                           NUM_PER_PRODUCER,
+                                                           batch));
+                }
+
+                bslstl::MpmcBoundedQueue<int> mpmcQueue(CAPACITY);
+                const double mpmc = NUM_VALUES * 1000.0
+                                  / static_cast<double>(
+                                              runTransfer(&mpmcQueue,
+                                                          n,
+                                                          n,
+                                                          NUM_PER_PRODUCER,
+                                                          batch));
+
+                LockedQueue<int> lockedQueue(CAPACITY);
+                const double locked = NUM_VALUES * 1000.0
+                                    / static_cast<double>(
+                                              runTransfer(&lockedQueue,
+                                                          n,
+                                                          n,
+                                                          NUM_PER_PRODUCER,
+                                                          batch));
+
+                char ratio[32];  // room for two formatted 'int' values
+                sprintf(ratio, "%d:%d", n, n);
+                if (1 == n) {
+                    printf("%6s %6d %12.2f %12.2f %12.2f\n",
+                           ratio, batch, spsc, mpmc, locked);
+                }
+                else {
+                    printf("%6s %6d %12s %12.2f %12.2f\n",
+                           ratio, batch, "-", mpmc, locked);
+                }
+            }
+        }
+
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: HAND-OFF LATENCY
+        //
+        // Concerns:
+        //: 1 The latency of handing one value from one thread to another is
+        //:   low.
+        //
+        // Plan:
+        //: 1 Bounce a value between two threads through a pair of queues
+        //:   (of each kind) a number of times (which may be given as the
+        //:   second argument), and report the average time of one hand-off,
+        //:   i.e., half a round trip.  Note that waiting threads yield the
+        //:   processor, so this measures the scheduler as well as the queue
+        //:   when there are fewer processors than threads.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: HAND-OFF LATENCY
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: HAND-OFF LATENCY"
+               "\n=============================\n");
+
+        const int NUM_ROUND_TRIPS = argc > 2 ? atoi(argv[2]) : 100000;
+
+        printf("%8s %12s\n", "queue", "ns/hand-off");
+
+        {
+            bslstl::SpscBoundedQueue<int> ping(16), pong(16);
+            const Int64 elapsed = runPingPong(&ping, &pong, NUM_ROUND_TRIPS);
+            printf("%8s %12.1f\n", "spsc",
+                   static_cast<double>(elapsed) / (2.0 * NUM_ROUND_TRIPS));
+        }
+        {
+            bslstl::MpmcBoundedQueue<int> ping(16), pong(16);
+            const Int64 elapsed = runPingPong(&ping, &pong, NUM_ROUND_TRIPS);
+            printf("%8s %12.1f\n", "mpmc",
+                   static_cast<double>(elapsed) / (2.0 * NUM_ROUND_TRIPS));
+        }
+        {
+            LockedQueue<int> ping(16), pong(16);
+            const Int64 elapsed = runPingPong(&ping, &pong, NUM_ROUND_TRIPS);
+            printf("%8s %12.1f\n", "lock",
+                   static_cast<double>(elapsed) / (2.0 * NUM_ROUND_TRIPS));
+        }
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
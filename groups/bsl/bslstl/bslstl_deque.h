@@ -194,8 +194,8 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_dequeprimitives.h>
 #endif
 
-#ifndef INCLUDED_BSLALG_RANGECOMPARE
-#include <bslalg_rangecompare.h>
+#ifndef INCLUDED_BSLALG_DEQUESEGMENTUTIL
+#include <bslalg_dequesegmentutil.h>
 #endif
 
 #ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
@@ -1161,6 +1161,10 @@ class Deque_Guard {
     std::size_t operator--();
         // Decrement the count of this guard, and return new count.
 
+    std::size_t operator+=(std::size_t numElements);
+        // Increase the count of this guard by the specified 'numElements',
+        // and return new count.
+
     void release();
         // Set the count of this tail guard to zero.  Note that this guard
         // destructor will do nothing if count is not incremented again after
@@ -1436,24 +1440,34 @@ deque<VALUE_TYPE,ALLOCATOR>::privateAppend(
                                 "deque<...>::insert(pos,n,v): deque too long");
     }
 
-    for ( ; first != last; ++first) {
-        IteratorImp insertPoint = guard.end();
+    // Allocate all the new blocks up front, then copy-construct the elements
+    // one block at a time, so that each block is filled by a single call to
+    // 'ArrayPrimitives::copyConstruct' (which uses 'std::memcpy' if possible),
+    // and the guard covers the elements of all the blocks filled so far.
 
-        // There must be room for the iterator to be incremented.  Allocate new
-        // block now if necessary.  We cannot wait until after the new element
-        // is constructed or else we won't be able to increment the guard right
-        // away and there will be a window where an exception will cause a
-        // resource leak.
+    size_type numNewBlocks = (this->d_finish.offsetInBlock() + numElements) /
+                                                                  BLOCK_LENGTH;
+    newBlocks.insertAtBack(numNewBlocks);
 
-        if (1 == insertPoint.remainingInBlock()) {
-            newBlocks.insertAtBack(1);
-            insertPoint = guard.end();  // 'insertAtBack(1)' invalidated iter
+    for (size_type numRemaining = numElements; 0 < numRemaining; ) {
+        IteratorImp insertPoint = guard.end();
+
+        size_type numToCopy = insertPoint.remainingInBlock();
+        if (numToCopy > numRemaining) {
+            numToCopy = numRemaining;
         }
-        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
-                                             BSLS_UTIL_ADDRESSOF(*insertPoint),
-                                             *first,
-                                             this->bslmaAllocator());
-        ++guard;
+
+        INPUT_ITER copyEnd = first;
+        bsl::advance(copyEnd, numToCopy);
+
+        BloombergLP::bslalg::ArrayPrimitives::copyConstruct(
+                                                      insertPoint.valuePtr(),
+                                                      first,
+                                                      copyEnd,
+                                                      this->bslmaAllocator());
+        guard += numToCopy;
+        first = copyEnd;
+        numRemaining -= numToCopy;
     }
 
     this->d_finish += guard.count();
@@ -2168,13 +2182,9 @@ deque<VALUE_TYPE,ALLOCATOR>::operator=(const deque<VALUE_TYPE,ALLOCATOR>& rhs)
 
     // Copy the smaller of the number of elements in 'rhs' and '*this'.
 
-    IteratorImp from = rhs.d_start;
-    IteratorImp to   = this->d_start;
-    for (size_type i = 0; i < minSize; ++i) {
-        *to = *from;
-        ++to;
-        ++from;
-    }
+    BloombergLP::bslalg::DequeSegmentUtil::copy(rhs.d_start,
+                                                rhs.d_start + minSize,
+                                                this->d_start);
 
     return *this;
 }
@@ -2240,11 +2250,9 @@ void deque<VALUE_TYPE,ALLOCATOR>::assign(size_type         numElements,
         privateAppendRaw(numElements - origSize, value);
     }
 
-    IteratorImp to = this->d_start;
-    for (size_type i = 0; i < minSize; ++i) {
-        *to = value;
-        ++to;
-    }
+    BloombergLP::bslalg::DequeSegmentUtil::fill(this->d_start,
+                                                this->d_start + minSize,
+                                                value);
 
     guard.release();
 }
@@ -2679,23 +2687,9 @@ bool operator==(const deque<VALUE_TYPE,ALLOCATOR>& lhs,
         return false;                                                 // RETURN
     }
 
-    enum {
-        BLOCK_LENGTH = Deque_BlockLengthCalcUtil<VALUE_TYPE>::BLOCK_LENGTH
-    };
-
-    typedef BloombergLP::bslalg::DequeIterator<VALUE_TYPE,
-                                               BLOCK_LENGTH> Iterator;
-
-    Iterator lhsBegin = lhs.begin().imp();
-    Iterator lhsEnd   = lhs.end().imp();
-    Iterator rhsBegin = rhs.begin().imp();
-
-    for (; !(lhsBegin == lhsEnd); ++lhsBegin, ++rhsBegin) {
-        if (!(*lhsBegin == *rhsBegin)) {
-            return false;                                             // RETURN
-        }
-    }
-    return true;
+    return BloombergLP::bslalg::DequeSegmentUtil::equal(lhs.begin().imp(),
+                                                        lhs.end().imp(),
+                                                        rhs.begin().imp());
 }
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -2711,12 +2705,11 @@ inline
 bool operator< (const deque<VALUE_TYPE,ALLOCATOR>& lhs,
                 const deque<VALUE_TYPE,ALLOCATOR>& rhs)
 {
-    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
-                                                                  lhs.end(),
-                                                                  lhs.size(),
-                                                                  rhs.begin(),
-                                                                  rhs.end(),
-                                                                  rhs.size());
+    return 0 > BloombergLP::bslalg::DequeSegmentUtil::lexicographical(
+                                                             lhs.begin().imp(),
+                                                             lhs.end().imp(),
+                                                             rhs.begin().imp(),
+                                                             rhs.end().imp());
 }
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -2998,6 +2991,14 @@ std::size_t Deque_Guard<VALUE_TYPE, ALLOCATOR>::operator--()
     return --d_count;
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+std::size_t
+Deque_Guard<VALUE_TYPE, ALLOCATOR>::operator+=(std::size_t numElements)
+{
+    return d_count += numElements;
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 inline
 void Deque_Guard<VALUE_TYPE, ALLOCATOR>::release()
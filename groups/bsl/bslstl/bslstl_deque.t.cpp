@@ -766,6 +766,9 @@ class SmallTestTypeNoAlloc {
     // also counts the number of default and copy constructions, assignments,
     // and destructions.  It does not allocate, and thus could have the
     // bit-wise copyable trait, but we defer this to the
+    // 'BitwiseCopyableTestType'.  The bytes of the footprint following the
+    // value are zero, so that two objects having the same value also have the
+    // same bytes, as required by the bit-wise equality comparable trait of
     // 'BitwiseCopyableTestType'.
 
     // DATA
@@ -778,6 +781,7 @@ class SmallTestTypeNoAlloc {
     // CREATORS
     SmallTestTypeNoAlloc()
     {
+        memset(d_u.d_fill, 0, sizeof d_u.d_fill);
         d_u.d_char = DEFAULT_VALUE;
         ++numDefaultCtorCalls;
     }
@@ -785,12 +789,14 @@ class SmallTestTypeNoAlloc {
     explicit
     SmallTestTypeNoAlloc(char c)
     {
+        memset(d_u.d_fill, 0, sizeof d_u.d_fill);
         d_u.d_char = c;
         ++numCharCtorCalls;
     }
 
     SmallTestTypeNoAlloc(const SmallTestTypeNoAlloc&  original)
     {
+        memset(d_u.d_fill, 0, sizeof d_u.d_fill);
         d_u.d_char = original.d_u.d_char;
         ++numCopyCtorCalls;
     }
@@ -169,6 +169,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -402,11 +406,14 @@ class HashTable {
 
     void removeAllAndDeallocate();
         // Erase all the nodes in this table, and deallocate their memory via
-        // the supplied node factory.  Destroy the array of buckets owned by
-        // this table.  If 'd_anchor.bucketAddress()' is the default (static)
-        // bucket address ('HashTable_ImpDetails::defaultBucketAddress'), as
-        // it is for a default constructed hashtable, then the bucket array is
-        // not destroyed.
+        // the supplied node factory; if 'ValueType' is trivially copyable
+        // (and so need not be destroyed), the node factory releases the
+        // memory of all nodes at once, without visiting each node.  Destroy
+        // the array of buckets owned by this table.  If
+        // 'd_anchor.bucketAddress()' is the default (static) bucket address
+        // ('HashTable_ImpDetails::defaultBucketAddress'), as it is for a
+        // default constructed hashtable, then the bucket array is not
+        // destroyed.
 
     // PRIVATE ACCESSORS
     native_std::size_t hashCodeForNode(bslalg::BidirectionalLink *node) const;
@@ -1725,7 +1732,12 @@ inline
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
 {
-    this->removeAllImp();
+    if (bsl::is_trivially_copyable<ValueType>::value) {
+        d_parameters.nodeFactory().release();
+    }
+    else {
+        this->removeAllImp();
+    }
     HashTable_Util<ALLOCATOR>::destroyBucketArray(
                                                  d_anchor.bucketArrayAddress(),
                                                  d_anchor.bucketArraySize(),
@@ -0,0 +1,977 @@
+// bslstl_indexedpriorityqueue.h                                      -*-C++-*-
+#ifndef INCLUDED_BSLSTL_INDEXEDPRIORITYQUEUE
+#define INCLUDED_BSLSTL_INDEXEDPRIORITYQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a priority queue whose elements can be updated or erased.
+//
+//@CLASSES:
+//  bslstl::IndexedPriorityQueue: addressable 4-ary heap priority queue
+//
+//@SEE_ALSO: bslstl_priorityqueue
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bslstl::IndexedPriorityQueue', implementing a highest-priority-first
+// priority queue (ordered, like 'bsl::priority_queue', by a parameterized
+// 'COMPARATOR' that returns 'true' if its first argument has a *lower*
+// priority than its second) whose elements remain addressable after they are
+// pushed: 'push' returns a 'Handle' identifying the new element, through which
+// the element can later be inspected ('value'), given a new value
+// ('increasePriority', 'decreasePriority', and 'update'), or removed from the
+// queue ('erase'), each in logarithmic time.
+//
+// A 'bsl::priority_queue' provides no access to the elements other than the
+// top one, so algorithms that change the priority of queued elements (e.g.,
+// Dijkstra's shortest-path algorithm, or a scheduler whose deadlines move)
+// typically push a duplicate of the element with its new priority, and skip
+// the stale copies as they reach the top.  The queue then grows with the
+// number of updates rather than with the number of elements, and every stale
+// copy must be pushed, popped, and recognized as stale.  An
+// 'IndexedPriorityQueue' updates the queued element in place instead.
+//
+///Handles
+///-------
+// A 'Handle' is a small non-negative integer: the handles of the elements in
+// a queue holding 'n' elements lie in the range '[0 .. n + m)', where 'm' is
+// the number of handles released (by 'pop' and 'erase') and not yet reused,
+// so handles can be used to index an array held by the client.  A handle
+// remains valid, and identifies the same element, until that element is
+// removed from the queue (by 'pop', 'erase', or 'clear'), after which it may
+// be reused by a subsequent 'push'.  'contains' reports whether a handle
+// currently identifies an element.  A copy of a queue uses the same handles
+// as the original.
+//
+///Implementation
+///--------------
+// The elements are held in an implicit 4-ary heap, i.e., an array in which
+// the children of the element at position 'i' are at positions '4 * i + 1'
+// through '4 * i + 4'.  Compared to a binary heap, a 4-ary heap has half the
+// height, so 'push' and 'increasePriority' (which move an element towards
+// the top) perform half as many steps, while 'pop' and 'decreasePriority'
+// (which move an element towards the bottom) compare the up to four children
+// of each visited element, which are adjacent in memory and usually share a
+// cache line.  The values are held in an array separate from the handles, so
+// that the comparisons that dominate the cost of 'pop' touch only values.
+//
+// An array indexed by handle records the heap position of each element, and
+// is updated whenever an element moves; a handle that is not in use holds the
+// next entry of a free list of handles instead.  An element of a trivially
+// copyable type is moved within the heap by copying it aside, shifting each
+// element it passes by one level, and copying it into its final position.
+// Elements of other types are moved by swapping them (see 'bslalg_swaputil'),
+// which is efficient for allocator-aware types that hold their data out of
+// place, and needs no temporary copy (and hence no allocator).
+//
+///Memory Allocation
+///-----------------
+// The type supplied as the 'ALLOCATOR' template parameter determines how
+// memory is allocated: the three arrays used by the queue are 'bsl::vector'
+// objects using (a rebound copy of) the allocator supplied at construction,
+// so that, if 'ALLOCATOR' is 'bsl::allocator' (the default), the queue and
+// its elements use the 'bslma::Allocator' supplied at construction (or the
+// default allocator, if none is supplied).  Memory is allocated only by
+// 'push', 'reserve', and the copy constructors and copy-assignment operator
+// (other than by the comparator and the value type).
+//
+///Exception Safety
+///----------------
+// 'push' provides the strong exception-safety guarantee: all the memory it
+// may need is reserved before the queue is modified.  'pop', 'erase',
+// 'clear', and 'swap' (for equal allocators) do not allocate memory, and
+// throw only if the comparator or the swap of two values throws.  If the
+// comparator throws, the queue holds the same elements (with the same
+// handles) as before, but may no longer satisfy the heap property.
+//
+///Operations
+///----------
+// The following table lists the run-time complexity of the operations of an
+// 'IndexedPriorityQueue' holding 'n' elements:
+//..
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | top, topHandle, value, contains, size, empty       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | push, increasePriority                             | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | pop, erase, decreasePriority, update               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | copy construction, assignment, clear               | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | swap                                               | O[1] if the        |
+//  |                                                    | allocators are     |
+//  |                                                    | equal, else O[n]   |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Finding Shortest Paths
+///- - - - - - - - - - - - - - - - -
+// Suppose we need to compute the length of the shortest path from one node of
+// a graph with weighted edges to every other node.  Dijkstra's algorithm
+// repeatedly visits the unvisited node nearest to the source, and then
+// shortens the tentative distances of the neighbors of that node, which
+// requires a priority queue in which the priority of a queued node can be
+// raised.
+//
+// First, we define a type describing an edge:
+//..
+//  struct Edge {
+//      int d_from;    // index of the node at which the edge starts
+//      int d_to;      // index of the node at which the edge ends
+//      int d_weight;  // non-negative length of the edge
+//  };
+//..
+// Then, we define a function computing the distances.  As a shorter distance
+// denotes a higher priority, we order the queue using 'std::greater', and we
+// keep the handle of each queued node in an array indexed by node, so that the
+// distance of a node can be shortened in place:
+//..
+//  void shortestDistances(bsl::vector<int> *distances,
+//                         const Edge       *edges,
+//                         int               numEdges,
+//                         int               numNodes,
+//                         int               source)
+//      // Load into the specified 'distances' the length of the shortest path
+//      // from the specified 'source' node to each of the specified
+//      // 'numNodes' nodes of the graph having the specified 'numEdges'
+//      // 'edges', or 'INT_MAX' for a node that cannot be reached from
+//      // 'source'.
+//  {
+//      typedef bsl::pair<int, int>                       Entry;  // (distance,
+//                                                                //  node)
+//      typedef bslstl::IndexedPriorityQueue<Entry, std::greater<Entry> >
+//                                                        Queue;
+//
+//      Queue                      queue;
+//      bsl::vector<Queue::Handle> handles(numNodes);
+//
+//      distances->assign(numNodes, INT_MAX);
+//      (*distances)[source] = 0;
+//      handles[source]      = queue.push(Entry(0, source));
+//
+//      while (!queue.empty()) {
+//          const int node = queue.top().second;
+//          queue.pop();
+//
+//          for (int i = 0; i < numEdges; ++i) {
+//              if (edges[i].d_from != node) {
+//                  continue;
+//              }
+//              const int to       = edges[i].d_to;
+//              const int distance = (*distances)[node] + edges[i].d_weight;
+//
+//              if (distance < (*distances)[to]) {
+//                  if (INT_MAX == (*distances)[to]) {
+//                      handles[to] = queue.push(Entry(distance, to));
+//                  }
+//                  else {
+//                      queue.increasePriority(handles[to],
+//                                             Entry(distance, to));
+//                  }
+//                  (*distances)[to] = distance;
+//              }
+//          }
+//      }
+//  }
+//..
+// Note that, as the edge weights are not negative, the distance of a node is
+// never shortened after the node has been popped from the queue, so a handle
+// is never used after the queue has released it.
+//
+// Finally, we compute the distances in a small graph:
+//..
+//  const Edge EDGES[] = {
+//      { 0, 1, 7 }, { 0, 2, 2 }, { 2, 1, 3 }, { 1, 3, 1 }, { 2, 3, 8 },
+//      { 3, 4, 2 }, { 2, 4, 9 }
+//  };
+//  const int NUM_EDGES = sizeof EDGES / sizeof *EDGES;
+//
+//  bsl::vector<int> distances;
+//  shortestDistances(&distances, EDGES, NUM_EDGES, 6, 0);
+//
+//  assert(0       == distances[0]);
+//  assert(5       == distances[1]);
+//  assert(2       == distances[2]);
+//  assert(6       == distances[3]);
+//  assert(8       == distances[4]);
+//  assert(INT_MAX == distances[5]);
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_queue.h> instead of <bslstl_indexedpriorityqueue.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ==========================
+                        // class IndexedPriorityQueue
+                        // ==========================
+
+template <class VALUE,
+          class COMPARATOR = std::less<VALUE>,
+          class ALLOCATOR  = bsl::allocator<VALUE> >
+class IndexedPriorityQueue {
+    // This class template implements a highest-priority-first priority queue
+    // of elements of the (template parameter) type 'VALUE', ordered by the
+    // (template parameter) type 'COMPARATOR', in which each element is
+    // identified by a 'Handle' returned when it is pushed, through which the
+    // element can be updated or erased.  See the component-level
+    // documentation for details.
+
+    // PRIVATE TYPES
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE                                     value_type;
+    typedef const VALUE&                              const_reference;
+    typedef COMPARATOR                                value_compare;
+    typedef ALLOCATOR                                 allocator_type;
+    typedef typename AllocatorTraits::size_type       size_type;
+
+    typedef size_type                                 Handle;
+        // 'Handle' is an alias for the type identifying an element of a
+        // queue.
+
+    enum {
+        k_ARITY = 4  // maximum number of children of an element in the heap
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef typename AllocatorTraits::template
+                     rebind_traits<size_type>::allocator_type  SizeAllocator;
+        // This 'typedef' is an alias for the allocator type used by the
+        // arrays of positions and handles.
+
+    typedef bsl::vector<VALUE, ALLOCATOR>                      ValueArray;
+    typedef bsl::vector<size_type, SizeAllocator>              IndexArray;
+
+    // DATA
+    ValueArray d_values;     // values, in heap order
+    IndexArray d_handles;    // handle of the element at each heap position
+    IndexArray d_positions;  // heap position of the element identified by
+                             // each handle in use, or next free handle
+
+    size_type  d_freeHead;   // first free handle, or 'd_positions.size()' if
+                             // every handle in 'd_positions' is in use
+
+    COMPARATOR d_comparator; // priority ordering
+
+    // PRIVATE MANIPULATORS
+    void moveDown(size_type position);
+        // Restore the heap property by moving the element at the specified
+        // 'position' towards the bottom of the heap, for as long as it has a
+        // lower priority than its highest-priority child.
+
+    void moveUp(size_type position);
+        // Restore the heap property by moving the element at the specified
+        // 'position' towards the top of the heap, for as long as it has a
+        // higher priority than its parent.
+
+    void moveElement(size_type to, size_type from);
+        // Copy the element at the specified 'from' heap position to the
+        // specified 'to' heap position, and record 'to' as the position of
+        // its handle.  The element previously at 'to' is overwritten.
+
+    void removeAt(size_type position);
+        // Remove the element at the specified 'position' in the heap, release
+        // its handle, and restore the heap property.
+
+    void swapElements(size_type lhs, size_type rhs);
+        // Exchange the elements at the specified 'lhs' and 'rhs' heap
+        // positions, and update the positions recorded for their handles.
+
+    // PRIVATE ACCESSORS
+    size_type highestPriorityChild(size_type position) const;
+        // Return the heap position of the highest-priority child of the
+        // element at the specified 'position', or 'size()' if that element
+        // has no children.
+
+  public:
+    // CREATORS
+    explicit IndexedPriorityQueue(
+                                const COMPARATOR& comparator = COMPARATOR(),
+                                const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Create an empty queue.  Optionally specify a 'comparator' used to
+        // order the priorities of the elements.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify an 'allocator' used
+        // to supply memory.  If 'allocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'allocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.
+
+    explicit IndexedPriorityQueue(const ALLOCATOR& allocator);
+        // Create an empty queue that uses the specified 'allocator' to supply
+        // memory, and a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the priorities of the
+        // elements.
+
+    IndexedPriorityQueue(const IndexedPriorityQueue& original);
+        // Create a queue having the same elements, identified by the same
+        // handles, and the same comparator as the specified 'original'.  Use
+        // the allocator returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.
+
+    IndexedPriorityQueue(const IndexedPriorityQueue& original,
+                         const ALLOCATOR&            allocator);
+        // Create a queue having the same elements, identified by the same
+        // handles, and the same comparator as the specified 'original', that
+        // uses the specified 'allocator' to supply memory.
+
+    // ~IndexedPriorityQueue() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    IndexedPriorityQueue& operator=(const IndexedPriorityQueue& rhs);
+        // Assign to this object the elements, handles, and comparator of the
+        // specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.  The allocator of this object is
+        // not changed.
+
+    Handle push(const value_type& value);
+        // Insert the specified 'value' into this queue, and return the handle
+        // identifying the new element.  This method provides the strong
+        // exception-safety guarantee.
+
+    void pop();
+        // Remove the highest-priority element from this queue, releasing its
+        // handle.  The behavior is undefined if this queue is empty.
+
+    void erase(Handle handle);
+        // Remove the element identified by the specified 'handle' from this
+        // queue, releasing 'handle'.  The behavior is undefined unless
+        // 'contains(handle)'.
+
+    void increasePriority(Handle handle, const value_type& value);
+        // Assign the specified 'value' to the element identified by the
+        // specified 'handle', and move the element towards the top of this
+        // queue accordingly.  The behavior is undefined unless
+        // 'contains(handle)', and 'value' does not have a lower priority than
+        // the current value of the element (i.e.,
+        // '!value_comp()(value, this->value(handle))').  Note that this
+        // operation is the "decrease-key" operation of a min-heap.
+
+    void decreasePriority(Handle handle, const value_type& value);
+        // Assign the specified 'value' to the element identified by the
+        // specified 'handle', and move the element towards the bottom of this
+        // queue accordingly.  The behavior is undefined unless
+        // 'contains(handle)', and 'value' does not have a higher priority
+        // than the current value of the element (i.e.,
+        // '!value_comp()(this->value(handle), value)').
+
+    void update(Handle handle, const value_type& value);
+        // Assign the specified 'value' to the element identified by the
+        // specified 'handle', and move the element within this queue
+        // accordingly.  The behavior is undefined unless 'contains(handle)'.
+        // Note that 'increasePriority' or 'decreasePriority' should be
+        // preferred when the direction of the change is known, as they
+        // perform one comparison fewer.
+
+    void reserve(size_type numElements);
+        // Reserve sufficient memory for this queue to hold at least the
+        // specified 'numElements' elements without allocating memory (other
+        // than by the value type) if no handle released by 'pop' or 'erase'
+        // is reused.
+
+    void clear();
+        // Remove all elements from this queue, releasing every handle.  Note
+        // that the first 'size()' handles returned by subsequent calls to
+        // 'push' are '0', '1', '2', etc.
+
+    void swap(IndexedPriorityQueue& other);
+        // Exchange the elements, handles, and comparator of this object with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee if the two objects use equal
+        // allocators.
+
+    // ACCESSORS
+    const_reference top() const;
+        // Return a reference providing non-modifiable access to the value of
+        // the highest-priority element in this queue.  The behavior is
+        // undefined if this queue is empty.
+
+    Handle topHandle() const;
+        // Return the handle identifying the highest-priority element in this
+        // queue.  The behavior is undefined if this queue is empty.
+
+    const_reference value(Handle handle) const;
+        // Return a reference providing non-modifiable access to the value of
+        // the element identified by the specified 'handle'.  The behavior is
+        // undefined unless 'contains(handle)'.
+
+    bool contains(Handle handle) const;
+        // Return 'true' if the specified 'handle' identifies an element of
+        // this queue, and 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this queue holds no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this queue.
+
+    value_compare value_comp() const;
+        // Return (a copy of) the comparator used to order the priorities of
+        // the elements of this queue.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used by this queue to supply
+        // memory.
+};
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>& a,
+          IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the elements, handles, and comparators of the specified 'a'
+    // and 'b' objects.  This method provides the no-throw exception-safety
+    // guarantee if the two objects use equal allocators.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class IndexedPriorityQueue
+                        // --------------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::moveDown(
+                                                            size_type position)
+{
+    if (!bsl::is_trivially_copyable<VALUE>::value) {
+        size_type child = highestPriorityChild(position);
+        while (child < d_values.size()
+            && d_comparator(d_values[position], d_values[child])) {
+            swapElements(position, child);
+            position = child;
+            child    = highestPriorityChild(position);
+        }
+        return;                                                       // RETURN
+    }
+
+    // Values that can be copied cheaply (and without an allocator) are moved
+    // by leaving a "hole" at 'position', into which each higher-priority
+    // child is copied, and copying the moving element only once, into its
+    // final position.
+
+    const VALUE  value  = d_values[position];
+    const Handle handle = d_handles[position];
+
+    size_type child = highestPriorityChild(position);
+    while (child < d_values.size() && d_comparator(value, d_values[child])) {
+        moveElement(position, child);
+        position = child;
+        child    = highestPriorityChild(position);
+    }
+    d_values[position]  = value;
+    d_handles[position] = handle;
+    d_positions[handle] = position;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::moveUp(
+                                                            size_type position)
+{
+    if (!bsl::is_trivially_copyable<VALUE>::value) {
+        while (0 < position) {
+            const size_type parent = (position - 1) / k_ARITY;
+            if (!d_comparator(d_values[parent], d_values[position])) {
+                return;                                               // RETURN
+            }
+            swapElements(position, parent);
+            position = parent;
+        }
+        return;                                                       // RETURN
+    }
+
+    // See 'moveDown'.
+
+    const VALUE  value  = d_values[position];
+    const Handle handle = d_handles[position];
+
+    while (0 < position) {
+        const size_type parent = (position - 1) / k_ARITY;
+        if (!d_comparator(d_values[parent], value)) {
+            break;
+        }
+        moveElement(position, parent);
+        position = parent;
+    }
+    d_values[position]  = value;
+    d_handles[position] = handle;
+    d_positions[handle] = position;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::moveElement(
+                                                          size_type to,
+                                                          size_type from)
+{
+    d_values[to]               = d_values[from];
+    d_handles[to]              = d_handles[from];
+    d_positions[d_handles[to]] = to;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::removeAt(
+                                                            size_type position)
+{
+    const size_type last = d_values.size() - 1;
+    if (position != last) {
+        swapElements(position, last);
+    }
+
+    // Release the handle of the removed element by pushing it onto the free
+    // list.
+
+    const Handle handle = d_handles[last];
+    d_positions[handle] = d_freeHead;
+    d_freeHead          = handle;
+
+    d_values.pop_back();
+    d_handles.pop_back();
+
+    if (position != last) {
+        // The element moved into 'position' from the bottom of the heap may
+        // belong either above or below it.
+
+        if (0 < position && d_comparator(d_values[(position - 1) / k_ARITY],
+                                         d_values[position])) {
+            moveUp(position);
+        }
+        else {
+            moveDown(position);
+        }
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::swapElements(
+                                                             size_type lhs,
+                                                             size_type rhs)
+{
+    bslalg::SwapUtil::swap(&d_values[lhs], &d_values[rhs]);
+
+    const Handle lhsHandle = d_handles[rhs];
+    const Handle rhsHandle = d_handles[lhs];
+    d_handles[lhs]         = lhsHandle;
+    d_handles[rhs]         = rhsHandle;
+    d_positions[lhsHandle] = lhs;
+    d_positions[rhsHandle] = rhs;
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::size_type
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::highestPriorityChild(
+                                                      size_type position) const
+{
+    const size_type numElements = d_values.size();
+    const size_type firstChild  = k_ARITY * position + 1;
+    if (firstChild >= numElements) {
+        return numElements;                                           // RETURN
+    }
+
+    // The children are adjacent in the array, so this loop usually touches a
+    // single cache line.
+
+    const size_type endChild = numElements - firstChild > k_ARITY
+                             ? firstChild + k_ARITY
+                             : numElements;
+    size_type best = firstChild;
+    for (size_type child = firstChild + 1; child < endChild; ++child) {
+        if (d_comparator(d_values[best], d_values[child])) {
+            best = child;
+        }
+    }
+    return best;
+}
+
+// CREATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::IndexedPriorityQueue(
+                                                  const COMPARATOR& comparator,
+                                                  const ALLOCATOR&  allocator)
+: d_values(allocator)
+, d_handles(SizeAllocator(allocator))
+, d_positions(SizeAllocator(allocator))
+, d_freeHead(0)
+, d_comparator(comparator)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::IndexedPriorityQueue(
+                                                    const ALLOCATOR& allocator)
+: d_values(allocator)
+, d_handles(SizeAllocator(allocator))
+, d_positions(SizeAllocator(allocator))
+, d_freeHead(0)
+, d_comparator()
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::IndexedPriorityQueue(
+                                          const IndexedPriorityQueue& original)
+: d_values(original.d_values,
+           AllocatorTraits::select_on_container_copy_construction(
+                                                  original.get_allocator()))
+, d_handles(original.d_handles, SizeAllocator(d_values.get_allocator()))
+, d_positions(original.d_positions, SizeAllocator(d_values.get_allocator()))
+, d_freeHead(original.d_freeHead)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::IndexedPriorityQueue(
+                                         const IndexedPriorityQueue& original,
+                                         const ALLOCATOR&            allocator)
+: d_values(original.d_values, allocator)
+, d_handles(original.d_handles, SizeAllocator(allocator))
+, d_positions(original.d_positions, SizeAllocator(allocator))
+, d_freeHead(original.d_freeHead)
+, d_comparator(original.d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>&
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                               const IndexedPriorityQueue& rhs)
+{
+    if (this != &rhs) {
+        IndexedPriorityQueue other(rhs, get_allocator());
+        swap(other);
+    }
+    return *this;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::Handle
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::push(
+                                                       const value_type& value)
+{
+    const bool newHandle = d_freeHead == d_positions.size();
+
+    // Reserve the memory needed by the index arrays first, so that the queue
+    // is not modified if an allocation fails.
+
+    if (d_handles.size() == d_handles.capacity()) {
+        d_handles.reserve(d_handles.empty() ? 8 : 2 * d_handles.size());
+    }
+    if (newHandle && d_positions.size() == d_positions.capacity()) {
+        d_positions.reserve(d_positions.empty() ? 8 : 2 * d_positions.size());
+    }
+    d_values.push_back(value);
+
+    // No operation below can throw (except for the comparator).
+
+    const size_type position = d_values.size() - 1;
+    Handle          handle;
+    if (newHandle) {
+        handle = d_positions.size();
+        d_positions.push_back(position);
+        d_freeHead = d_positions.size();
+    }
+    else {
+        handle              = d_freeHead;
+        d_freeHead          = d_positions[handle];
+        d_positions[handle] = position;
+    }
+    d_handles.push_back(handle);
+
+    moveUp(position);
+    return handle;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::pop()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    removeAt(0);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::erase(Handle handle)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    removeAt(d_positions[handle]);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::increasePriority(
+                                                      Handle            handle,
+                                                      const value_type& value)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+    BSLS_ASSERT_SAFE(!d_comparator(value, this->value(handle)));
+
+    const size_type position = d_positions[handle];
+    d_values[position] = value;
+    moveUp(position);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::decreasePriority(
+                                                      Handle            handle,
+                                                      const value_type& value)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+    BSLS_ASSERT_SAFE(!d_comparator(this->value(handle), value));
+
+    const size_type position = d_positions[handle];
+    d_values[position] = value;
+    moveDown(position);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::update(
+                                                      Handle            handle,
+                                                      const value_type& value)
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    const size_type position = d_positions[handle];
+    if (d_comparator(d_values[position], value)) {
+        d_values[position] = value;
+        moveUp(position);
+    }
+    else {
+        d_values[position] = value;
+        moveDown(position);
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_values.reserve(numElements);
+    d_handles.reserve(numElements);
+    d_positions.reserve(numElements);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_values.clear();
+    d_handles.clear();
+    d_positions.clear();
+    d_freeHead = 0;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                   IndexedPriorityQueue& other)
+{
+    d_values.swap(other.d_values);
+    d_handles.swap(other.d_handles);
+    d_positions.swap(other.d_positions);
+    bslalg::SwapUtil::swap(&d_freeHead, &other.d_freeHead);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::top() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_values.front();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::Handle
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::topHandle() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_handles.front();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::value(Handle handle) const
+{
+    BSLS_ASSERT_SAFE(contains(handle));
+
+    return d_values[d_positions[handle]];
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::contains(Handle handle)
+                                                                         const
+{
+    // A free handle may hold (as the next entry of the free list) any value,
+    // but the element at that position, if any, is identified by another
+    // handle.
+
+    return handle < d_positions.size()
+        && d_positions[handle] < d_handles.size()
+        && d_handles[d_positions[handle]] == handle;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_values.empty();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::size_type
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_values.size();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::value_compare
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_values.get_allocator();
+}
+
+}  // close namespace bslstl
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>& a,
+                  IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// TRAITS
+
+namespace bslma {
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                   bslstl::IndexedPriorityQueue<VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>::type
+{};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
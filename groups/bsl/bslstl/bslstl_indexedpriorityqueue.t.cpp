@@ -0,0 +1,1159 @@
+// bslstl_indexedpriorityqueue.t.cpp                                  -*-C++-*-
+#include <bslstl_indexedpriorityqueue.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_priorityqueue.h>
+#include <bslstl_vector.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_istriviallycopyable.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>                // for testing only
+#include <bsls_types.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>     // atoi(), rand(), srand()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a priority queue as a 4-ary heap whose
+// elements are addressed through handles.  The concerns are that every
+// manipulator preserves the heap property (so that the elements are popped in
+// priority order), and keeps the mapping between handles and elements
+// consistent (so that 'value', 'contains', and the handle-based manipulators
+// address the intended element) through arbitrary sequences of operations,
+// including the reuse of released handles.  We verify both against a simple
+// reference model (an array of values indexed by handle) over long
+// pseudo-random sequences of operations, and verify the invariants of the
+// heap directly after each operation by draining a copy of the queue.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 4] IndexedPriorityQueue(const COMPARATOR&, const ALLOCATOR&);
+// [ 4] IndexedPriorityQueue(const ALLOCATOR& allocator);
+// [ 4] IndexedPriorityQueue(const IndexedPriorityQueue& original);
+// [ 4] IndexedPriorityQueue(const IndexedPriorityQueue&, const ALLOC&);
+//
+// MANIPULATORS
+// [ 4] IndexedPriorityQueue& operator=(const IndexedPriorityQueue& rhs);
+// [ 2] Handle push(const value_type& value);
+// [ 2] void pop();
+// [ 3] void erase(Handle handle);
+// [ 3] void increasePriority(Handle handle, const value_type& value);
+// [ 3] void decreasePriority(Handle handle, const value_type& value);
+// [ 3] void update(Handle handle, const value_type& value);
+// [ 4] void reserve(size_type numElements);
+// [ 4] void clear();
+// [ 4] void swap(IndexedPriorityQueue& other);
+//
+// ACCESSORS
+// [ 2] const_reference top() const;
+// [ 2] Handle topHandle() const;
+// [ 2] const_reference value(Handle handle) const;
+// [ 2] bool contains(Handle handle) const;
+// [ 1] bool empty() const;
+// [ 1] size_type size() const;
+// [ 4] value_compare value_comp() const;
+// [ 4] allocator_type get_allocator() const;
+//
+// FREE FUNCTIONS
+// [ 4] void swap(IndexedPriorityQueue& a, IndexedPriorityQueue& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: The object allocates memory only from its allocator.
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: SHORTEST PATHS VS. 'bsl::priority_queue'
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::IndexedPriorityQueue<int> Obj;
+typedef Obj::Handle                       Handle;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct Ordering {
+    // This 'struct' provides a stateful comparator that orders integers in
+    // ascending or descending order.
+
+    bool d_ascending;  // 'true' if smaller integers have lower priority
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return d_ascending ? lhs < rhs : lhs > rhs;
+    }
+};
+
+class WrappedInt {
+    // This class provides an integer wrapper that is not trivially copyable,
+    // so that the elements of a queue holding it are moved by swapping.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit WrappedInt(int value) : d_value(value) {}
+
+    WrappedInt(const WrappedInt& original) : d_value(original.d_value) {}
+
+    // MANIPULATORS
+    WrappedInt& operator=(const WrappedInt& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+bool operator<(const WrappedInt& lhs, const WrappedInt& rhs)
+    // Return 'true' if the value of the specified 'lhs' is less than that of
+    // the specified 'rhs', and 'false' otherwise.
+{
+    return lhs.value() < rhs.value();
+}
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+int nextRandom(int modulus)
+    // Return a pseudo-random integer in the range '[0 .. modulus)'.
+{
+    return rand() % modulus;
+}
+
+class Model {
+    // This class provides a reference model of a queue of integers: the value
+    // of each element is held in an array indexed by its handle.
+
+    // DATA
+    bsl::vector<int>  d_values;  // value of the element having each handle
+    bsl::vector<bool> d_live;    // whether each handle identifies an element
+    int               d_size;    // number of elements
+
+  public:
+    // CREATORS
+    explicit Model(bslma::Allocator *allocator)
+    : d_values(allocator)
+    , d_live(allocator)
+    , d_size(0)
+    {
+    }
+
+    // MANIPULATORS
+    void add(Handle handle, int value)
+        // Record that the specified 'handle' identifies an element having the
+        // specified 'value'.
+    {
+        if (handle >= d_values.size()) {
+            d_values.resize(handle + 1);
+            d_live.resize(handle + 1);
+        }
+        ASSERT(!d_live[handle]);
+        d_values[handle] = value;
+        d_live[handle]   = true;
+        ++d_size;
+    }
+
+    void remove(Handle handle)
+        // Record that the element identified by the specified 'handle' has
+        // been removed.
+    {
+        ASSERT(d_live[handle]);
+        d_live[handle] = false;
+        --d_size;
+    }
+
+    void set(Handle handle, int value)
+        // Record that the element identified by the specified 'handle' has
+        // the specified 'value'.
+    {
+        d_values[handle] = value;
+    }
+
+    // ACCESSORS
+    Handle randomHandle() const
+        // Return the handle of a pseudo-randomly chosen element.  The
+        // behavior is undefined unless this model holds at least one element.
+    {
+        Handle handle;
+        do {
+            handle = nextRandom(static_cast<int>(d_values.size()));
+        } while (!d_live[handle]);
+        return handle;
+    }
+
+    int maxValue() const
+        // Return the greatest value held, or 'INT_MIN' if there is none.
+    {
+        int result = INT_MIN;
+        for (Handle i = 0; i < d_values.size(); ++i) {
+            if (d_live[i] && d_values[i] > result) {
+                result = d_values[i];
+            }
+        }
+        return result;
+    }
+
+    int size() const { return d_size; }
+
+    bool matches(const Obj& object) const
+        // Return 'true' if the specified 'object' holds exactly the elements
+        // recorded in this model, identified by the same handles, and
+        // 'false' otherwise.
+    {
+        if (static_cast<int>(object.size()) != d_size) {
+            return false;                                             // RETURN
+        }
+        for (Handle i = 0; i < d_values.size(); ++i) {
+            if (object.contains(i) != d_live[i]) {
+                return false;                                         // RETURN
+            }
+            if (d_live[i] && object.value(i) != d_values[i]) {
+                return false;                                         // RETURN
+            }
+        }
+        return !object.contains(d_values.size())
+            && !object.contains(d_values.size() + 100);
+    }
+};
+
+bool isHeapOrdered(const Obj& object)
+    // Return 'true' if popping every element from a copy of the specified
+    // 'object' yields its elements in non-increasing order, with 'top' and
+    // 'topHandle' consistent at every step, and 'false' otherwise.
+{
+    bslma::TestAllocator sa("scratch");
+    Obj                  copy(object, &sa);
+    int                  previous = INT_MAX;
+
+    while (!copy.empty()) {
+        if (copy.top() > previous
+         || copy.value(copy.topHandle()) != copy.top()) {
+            return false;                                             // RETURN
+        }
+        previous = copy.top();
+        copy.pop();
+    }
+    return true;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Finding Shortest Paths
+///- - - - - - - - - - - - - - - - -
+// Suppose we need to compute the length of the shortest path from one node of
+// a graph with weighted edges to every other node.  Dijkstra's algorithm
+// repeatedly visits the unvisited node nearest to the source, and then
+// shortens the tentative distances of the neighbors of that node, which
+// requires a priority queue in which the priority of a queued node can be
+// raised.
+//
+// First, we define a type describing an edge:
+//..
+    struct Edge {
+        int d_from;    // index of the node at which the edge starts
+        int d_to;      // index of the node at which the edge ends
+        int d_weight;  // non-negative length of the edge
+    };
+//..
+// Then, we define a function computing the distances.  As a shorter distance
+// denotes a higher priority, we order the queue using 'std::greater', and we
+// keep the handle of each queued node in an array indexed by node, so that the
+// distance of a node can be shortened in place:
+//..
+    void shortestDistances(bsl::vector<int> *distances,
+                           const Edge       *edges,
+                           int               numEdges,
+                           int               numNodes,
+                           int               source)
+        // Load into the specified 'distances' the length of the shortest path
+        // from the specified 'source' node to each of the specified
+        // 'numNodes' nodes of the graph having the specified 'numEdges'
+        // 'edges', or 'INT_MAX' for a node that cannot be reached from
+        // 'source'.
+    {
+        typedef bsl::pair<int, int>                       Entry;  // (distance,
+                                                                  //  node)
+        typedef bslstl::IndexedPriorityQueue<Entry, std::greater<Entry> >
+                                                          Queue;
+
+        Queue                      queue;
+        bsl::vector<Queue::Handle> handles(numNodes);
+
+        distances->assign(numNodes, INT_MAX);
+        (*distances)[source] = 0;
+        handles[source]      = queue.push(Entry(0, source));
+
+        while (!queue.empty()) {
+            const int node = queue.top().second;
+            queue.pop();
+
+            for (int i = 0; i < numEdges; ++i) {
+                if (edges[i].d_from != node) {
+                    continue;
+                }
+                const int to       = edges[i].d_to;
+                const int distance = (*distances)[node] + edges[i].d_weight;
+
+                if (distance < (*distances)[to]) {
+                    if (INT_MAX == (*distances)[to]) {
+                        handles[to] = queue.push(Entry(distance, to));
+                    }
+                    else {
+                        queue.increasePriority(handles[to],
+                                               Entry(distance, to));
+                    }
+                    (*distances)[to] = distance;
+                }
+            }
+        }
+    }
+//..
+
+//=============================================================================
+//                       BENCHMARK SUPPORT
+//-----------------------------------------------------------------------------
+
+namespace Benchmark {
+
+struct Graph {
+    // This 'struct' describes a directed graph in compressed sparse row form:
+    // the edges leaving node 'i' are those at positions
+    // '[d_firstEdge[i] .. d_firstEdge[i + 1])' in 'd_to' and 'd_weight'.
+
+    bsl::vector<int> d_firstEdge;
+    bsl::vector<int> d_to;
+    bsl::vector<int> d_weight;
+};
+
+void makeRandomGraph(Graph *graph, int numNodes, int degree)
+    // Load into the specified 'graph' a graph of the specified 'numNodes'
+    // nodes, each having the specified 'degree' edges of pseudo-random
+    // weights leading to pseudo-randomly chosen nodes.
+{
+    graph->d_firstEdge.resize(numNodes + 1);
+    for (int i = 0; i < numNodes; ++i) {
+        graph->d_firstEdge[i] = i * degree;
+        for (int j = 0; j < degree; ++j) {
+            graph->d_to.push_back(nextRandom(numNodes));
+            graph->d_weight.push_back(1 + nextRandom(1000));
+        }
+    }
+    graph->d_firstEdge[numNodes] = numNodes * degree;
+}
+
+long long dijkstraWithDuplicates(const Graph& graph, int *maxQueueSize)
+    // Return the sum of the distances from node 0 of the nodes of the
+    // specified 'graph' reachable from it, using a 'bsl::priority_queue' into
+    // which a node is pushed again whenever its distance is shortened, and
+    // load into the specified 'maxQueueSize' the greatest number of entries
+    // held by the queue.
+{
+    typedef bsl::pair<int, int> Entry;
+    typedef bsl::priority_queue<Entry,
+                                bsl::vector<Entry>,
+                                std::greater<Entry> > Queue;
+
+    const int numNodes = static_cast<int>(graph.d_firstEdge.size()) - 1;
+
+    bsl::vector<int> distances(numNodes, INT_MAX);
+    Queue            queue;
+
+    *maxQueueSize = 0;
+    distances[0]  = 0;
+    queue.push(Entry(0, 0));
+    while (!queue.empty()) {
+        const Entry top = queue.top();
+        queue.pop();
+        if (top.first != distances[top.second]) {
+            continue;  // stale entry
+        }
+        for (int e  = graph.d_firstEdge[top.second];
+                 e != graph.d_firstEdge[top.second + 1];
+               ++e) {
+            const int to       = graph.d_to[e];
+            const int distance = top.first + graph.d_weight[e];
+            if (distance < distances[to]) {
+                distances[to] = distance;
+                queue.push(Entry(distance, to));
+                if (static_cast<int>(queue.size()) > *maxQueueSize) {
+                    *maxQueueSize = static_cast<int>(queue.size());
+                }
+            }
+        }
+    }
+
+    long long sum = 0;
+    for (int i = 0; i < numNodes; ++i) {
+        sum += INT_MAX == distances[i] ? 0 : distances[i];
+    }
+    return sum;
+}
+
+long long dijkstraWithUpdates(const Graph& graph, int *maxQueueSize)
+    // Return the sum of the distances from node 0 of the nodes of the
+    // specified 'graph' reachable from it, using a
+    // 'bslstl::IndexedPriorityQueue' in which the distance of a queued node is
+    // shortened in place, and load into the specified 'maxQueueSize' the
+    // greatest number of entries held by the queue.
+{
+    typedef bsl::pair<int, int> Entry;
+    typedef bslstl::IndexedPriorityQueue<Entry, std::greater<Entry> > Queue;
+
+    const int numNodes = static_cast<int>(graph.d_firstEdge.size()) - 1;
+
+    bsl::vector<int>           distances(numNodes, INT_MAX);
+    bsl::vector<Queue::Handle> handles(numNodes);
+    Queue                      queue;
+
+    *maxQueueSize = 0;
+    distances[0]  = 0;
+    handles[0]    = queue.push(Entry(0, 0));
+    while (!queue.empty()) {
+        const Entry top = queue.top();
+        queue.pop();
+        for (int e  = graph.d_firstEdge[top.second];
+                 e != graph.d_firstEdge[top.second + 1];
+               ++e) {
+            const int to       = graph.d_to[e];
+            const int distance = top.first + graph.d_weight[e];
+            if (distance < distances[to]) {
+                if (INT_MAX == distances[to]) {
+                    handles[to] = queue.push(Entry(distance, to));
+                    if (static_cast<int>(queue.size()) > *maxQueueSize) {
+                        *maxQueueSize = static_cast<int>(queue.size());
+                    }
+                }
+                else {
+                    queue.increasePriority(handles[to], Entry(distance, to));
+                }
+                distances[to] = distance;
+            }
+        }
+    }
+
+    long long sum = 0;
+    for (int i = 0; i < numNodes; ++i) {
+        sum += INT_MAX == distances[i] ? 0 : distances[i];
+    }
+    return sum;
+}
+
+}  // close namespace Benchmark
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Finally, we compute the distances in a small graph:
+//..
+    const Edge EDGES[] = {
+        { 0, 1, 7 }, { 0, 2, 2 }, { 2, 1, 3 }, { 1, 3, 1 }, { 2, 3, 8 },
+        { 3, 4, 2 }, { 2, 4, 9 }
+    };
+    const int NUM_EDGES = sizeof EDGES / sizeof *EDGES;
+
+    bsl::vector<int> distances;
+    shortestDistances(&distances, EDGES, NUM_EDGES, 6, 0);
+
+    ASSERT(0       == distances[0]);
+    ASSERT(5       == distances[1]);
+    ASSERT(2       == distances[2]);
+    ASSERT(6       == distances[3]);
+    ASSERT(8       == distances[4]);
+    ASSERT(INT_MAX == distances[5]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, CLEAR, AND ALLOCATORS
+        //
+        // Concerns:
+        //: 1 A copy holds the same elements, identified by the same handles,
+        //:   as the original, and uses the intended allocator.
+        //:
+        //: 2 Assignment and swap exchange the elements and handles of two
+        //:   objects, without changing their allocators.
+        //:
+        //: 3 'clear' removes every element and releases every handle, after
+        //:   which handles are allocated from 0 again.
+        //:
+        //: 4 'reserve' allocates all the memory needed to push the reserved
+        //:   number of elements.
+        //:
+        //: 5 All memory is supplied by the object's allocator, and is returned
+        //:   on destruction.
+        //:
+        //: 6 The comparator is copied and swapped.
+        //
+        // Plan:
+        //: 1 Create objects holding varying numbers of elements (with some
+        //:   handles released), using test allocators, and verify their
+        //:   copies, assigned, swapped, and cleared objects against a
+        //:   reference model, and the memory usage of the allocators.
+        //:   (C-1..5)
+        //:
+        //: 2 Swap objects ordering their elements by 'std::less' and
+        //:   'std::greater' using a comparator class that holds its ordering,
+        //:   and verify the order in which their elements are popped.  (C-6)
+        //
+        // Testing:
+        //   IndexedPriorityQueue(const COMPARATOR&, const ALLOCATOR&);
+        //   IndexedPriorityQueue(const ALLOCATOR& allocator);
+        //   IndexedPriorityQueue(const IndexedPriorityQueue& original);
+        //   IndexedPriorityQueue(const IndexedPriorityQueue&, const ALLOC&);
+        //   IndexedPriorityQueue& operator=(const IndexedPriorityQueue& rhs);
+        //   void reserve(size_type numElements);
+        //   void clear();
+        //   void swap(IndexedPriorityQueue& other);
+        //   value_compare value_comp() const;
+        //   allocator_type get_allocator() const;
+        //   void swap(IndexedPriorityQueue& a, IndexedPriorityQueue& b);
+        //   CONCERN: The object allocates memory only from its allocator.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                        "\nCOPY, ASSIGNMENT, SWAP, CLEAR, AND ALLOCATORS"
+                        "\n=============================================\n");
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int SIZES[] = { 0, 1, 2, 4, 5, 6, 17, 21, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        if (verbose) printf("\tCopy construction.\n");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            const bsls::Types::Int64 NUM_DA = da.numBlocksTotal();
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+            for (int i = 0; i < SIZE; ++i) {
+                const int V = nextRandom(50);
+                model.add(mX.push(V), V);
+            }
+            for (int i = 0; i < SIZE / 3; ++i) {
+                const Handle H = model.randomHandle();
+                mX.erase(H);
+                model.remove(H);
+            }
+            LOOP_ASSERT(SIZE, model.matches(X));
+            LOOP_ASSERT(SIZE, NUM_DA == da.numBlocksTotal());
+
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                LOOP_ASSERT(SIZE, model.matches(Y));
+                LOOP_ASSERT(SIZE, isHeapOrdered(Y));
+                LOOP_ASSERT(SIZE, &da == Y.get_allocator().mechanism());
+
+                Obj mZ(X, &za);  const Obj& Z = mZ;
+                LOOP_ASSERT(SIZE, model.matches(Z));
+                LOOP_ASSERT(SIZE, &za == Z.get_allocator().mechanism());
+
+                // The copies reuse released handles in the same order as the
+                // original.
+
+                if (model.size() < SIZE) {
+                    const Handle H = mX.push(-1);
+                    LOOP_ASSERT(SIZE, H == mY.push(-1));
+                    LOOP_ASSERT(SIZE, H == mZ.push(-1));
+                    LOOP_ASSERT(SIZE, X.value(H) == Z.value(H));
+                    mX.erase(H);
+                }
+            }
+            LOOP_ASSERT(SIZE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAssignment and swap.\n");
+
+        const bsls::Types::Int64 NUM_DA = da.numBlocksTotal();
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int ISIZE = SIZES[ti];
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int JSIZE = SIZES[tj];
+
+                Obj   mX(&oa);  const Obj& X = mX;
+                Obj   mY(&oa);  const Obj& Y = mY;
+                Obj   mZ(&za);  const Obj& Z = mZ;
+                Model mI(&sa), mJ(&sa);
+                for (int i = 0; i < ISIZE; ++i) {
+                    mI.add(mX.push(i), i);
+                }
+                for (int j = 0; j < JSIZE; ++j) {
+                    mJ.add(mY.push(-j), -j);
+                    mZ.push(-j);
+                }
+
+                const bsls::Types::Int64 NUM_OA = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                LOOP2_ASSERT(ISIZE, JSIZE, mJ.matches(X));
+                LOOP2_ASSERT(ISIZE, JSIZE, mI.matches(Y));
+                LOOP2_ASSERT(ISIZE, JSIZE, NUM_OA == oa.numBlocksTotal());
+
+                swap(mX, mY);
+                LOOP2_ASSERT(ISIZE, JSIZE, mI.matches(X));
+                LOOP2_ASSERT(ISIZE, JSIZE, mJ.matches(Y));
+                LOOP2_ASSERT(ISIZE, JSIZE, NUM_OA == oa.numBlocksTotal());
+
+                mX.swap(mZ);
+                LOOP2_ASSERT(ISIZE, JSIZE, mJ.matches(X));
+                LOOP2_ASSERT(ISIZE, JSIZE, mI.matches(Z));
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &oa == X.get_allocator().mechanism());
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &za == Z.get_allocator().mechanism());
+
+                mX = Z;
+                LOOP2_ASSERT(ISIZE, JSIZE, mI.matches(X));
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &oa == X.get_allocator().mechanism());
+
+                mX = X;
+                LOOP2_ASSERT(ISIZE, JSIZE, mI.matches(X));
+
+                mZ = Y;
+                LOOP2_ASSERT(ISIZE, JSIZE, mJ.matches(Z));
+                LOOP2_ASSERT(ISIZE, JSIZE, isHeapOrdered(Z));
+
+                mX.clear();
+                LOOP2_ASSERT(ISIZE, JSIZE, X.empty());
+                LOOP2_ASSERT(ISIZE, JSIZE, !X.contains(0));
+                LOOP2_ASSERT(ISIZE, JSIZE, 0 == mX.push(5));
+                LOOP2_ASSERT(ISIZE, JSIZE, 1 == mX.push(7));
+                LOOP2_ASSERT(ISIZE, JSIZE, 1 == X.topHandle());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(NUM_DA == da.numBlocksTotal());
+
+        if (verbose) printf("\tReserve.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(100);
+
+            const bsls::Types::Int64 NUM_OA = oa.numBlocksTotal();
+            for (int i = 0; i < 100; ++i) {
+                mX.push(nextRandom(1000));
+            }
+            ASSERT(NUM_OA == oa.numBlocksTotal());
+            ASSERT(isHeapOrdered(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tComparator.\n");
+        {
+            const Ordering LESS    = { true  };
+            const Ordering GREATER = { false };
+
+            typedef bslstl::IndexedPriorityQueue<int, Ordering> CObj;
+
+            CObj mX(LESS, &oa);     const CObj& X = mX;
+            CObj mY(GREATER, &oa);  const CObj& Y = mY;
+            for (int i = 0; i < 10; ++i) {
+                mX.push(i);
+                mY.push(i);
+            }
+            ASSERT(9 == X.top());
+            ASSERT(0 == Y.top());
+
+            mX.swap(mY);
+            ASSERT(!X.value_comp().d_ascending);
+            ASSERT( Y.value_comp().d_ascending);
+
+            mX.push(-1);
+            mY.push(-1);
+            ASSERT(-1 == X.top());
+            ASSERT( 9 == Y.top());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(NUM_DA == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HANDLE-BASED MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'increasePriority', 'decreasePriority', and 'update' change the
+        //:   value of the intended element, and move it to a position
+        //:   consistent with the heap property, wherever it is in the heap.
+        //:
+        //: 2 'erase' removes the intended element, wherever it is in the
+        //:   heap, and releases its handle, leaving the handles of the other
+        //:   elements valid.
+        //:
+        //: 3 Released handles are reused, and a reused handle identifies the
+        //:   new element only.
+        //:
+        //: 4 Elements of types that are not trivially copyable (which are
+        //:   moved by swapping) are ordered correctly.
+        //
+        // Plan:
+        //: 1 Apply long pseudo-random sequences of 'push', 'pop', 'erase',
+        //:   'increasePriority', 'decreasePriority', and 'update' operations
+        //:   to queues of various sizes and to a reference model, verifying
+        //:   the top element after every operation, and the complete state
+        //:   and the heap property periodically.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for a queue of 'WrappedInt', a type that is not
+        //:   trivially copyable, verifying the top element after every
+        //:   operation, and the order in which the elements are finally
+        //:   popped.  (C-4)
+        //
+        // Testing:
+        //   void erase(Handle handle);
+        //   void increasePriority(Handle handle, const value_type& value);
+        //   void decreasePriority(Handle handle, const value_type& value);
+        //   void update(Handle handle, const value_type& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHANDLE-BASED MANIPULATORS"
+                            "\n=========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        const int SIZES[] = { 1, 2, 5, 6, 21, 22, 85, 86, 400 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        srand(3);
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int op = 0; op < 40 * SIZE + 100; ++op) {
+                const int V = nextRandom(4 * SIZE);
+
+                // Keep the number of elements around 'SIZE'.
+
+                const int KIND = model.size() < SIZE / 2 ? 0
+                               : model.size() > 2 * SIZE ? 1
+                               : nextRandom(6);
+
+                switch (model.size() ? KIND : 0) {
+                  case 0: {
+                    const Handle H = mX.push(V);
+                    model.add(H, V);
+                  } break;
+                  case 1: {
+                    const Handle H = model.randomHandle();
+                    mX.erase(H);
+                    model.remove(H);
+                    LOOP2_ASSERT(SIZE, op, !X.contains(H));
+                  } break;
+                  case 2: {
+                    const Handle H = X.topHandle();
+                    mX.pop();
+                    model.remove(H);
+                  } break;
+                  case 3: {
+                    const Handle H   = model.randomHandle();
+                    const int    NEW = X.value(H) + nextRandom(2 * SIZE);
+                    mX.increasePriority(H, NEW);
+                    model.set(H, NEW);
+                    LOOP2_ASSERT(SIZE, op, NEW == X.value(H));
+                  } break;
+                  case 4: {
+                    const Handle H   = model.randomHandle();
+                    const int    NEW = X.value(H) - nextRandom(2 * SIZE);
+                    mX.decreasePriority(H, NEW);
+                    model.set(H, NEW);
+                    LOOP2_ASSERT(SIZE, op, NEW == X.value(H));
+                  } break;
+                  default: {
+                    const Handle H = model.randomHandle();
+                    mX.update(H, V);
+                    model.set(H, V);
+                    LOOP2_ASSERT(SIZE, op, V == X.value(H));
+                  } break;
+                }
+
+                LOOP2_ASSERT(SIZE, op,
+                             model.size() == static_cast<int>(X.size()));
+                if (!X.empty()) {
+                    LOOP2_ASSERT(SIZE, op, model.maxValue() == X.top());
+                }
+                if (0 == op % 32) {
+                    LOOP2_ASSERT(SIZE, op, model.matches(X));
+                    LOOP2_ASSERT(SIZE, op, isHeapOrdered(X));
+                }
+            }
+            LOOP_ASSERT(SIZE, model.matches(X));
+            LOOP_ASSERT(SIZE, isHeapOrdered(X));
+
+            if (veryVerbose) {
+                T_ P_(SIZE) P(X.size())
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tValues that are not trivially copyable.\n");
+        {
+            typedef bslstl::IndexedPriorityQueue<WrappedInt> WObj;
+
+            ASSERT(!bsl::is_trivially_copyable<WrappedInt>::value);
+
+            WObj  mX(&oa);  const WObj& X = mX;
+            Model model(&sa);
+
+            for (int op = 0; op < 4000; ++op) {
+                const int V = nextRandom(1000);
+
+                switch (model.size() < 50 ? 0 : nextRandom(5)) {
+                  case 0: {
+                    model.add(mX.push(WrappedInt(V)), V);
+                  } break;
+                  case 1: {
+                    const Handle H = model.randomHandle();
+                    mX.erase(H);
+                    model.remove(H);
+                  } break;
+                  case 2: {
+                    model.remove(X.topHandle());
+                    mX.pop();
+                  } break;
+                  case 3: {
+                    const Handle H   = model.randomHandle();
+                    const int    NEW = X.value(H).value() + V;
+                    mX.increasePriority(H, WrappedInt(NEW));
+                    model.set(H, NEW);
+                  } break;
+                  default: {
+                    const Handle H = model.randomHandle();
+                    mX.update(H, WrappedInt(V));
+                    model.set(H, V);
+                  } break;
+                }
+                LOOP_ASSERT(op, model.size() == static_cast<int>(X.size()));
+                LOOP_ASSERT(op, model.maxValue() == X.top().value());
+            }
+
+            int previous = INT_MAX;
+            while (!X.empty()) {
+                LOOP_ASSERT(previous, X.top().value() <= previous);
+                previous = X.top().value();
+                mX.pop();
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PUSH, POP, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Elements are popped in priority order, with equal values in any
+        //:   order.
+        //:
+        //: 2 'top' and 'topHandle' identify the highest-priority element.
+        //:
+        //: 3 'push' returns distinct handles, through which 'value' provides
+        //:   the pushed values, until the elements are popped, after which
+        //:   'contains' returns 'false' for their handles.
+        //:
+        //: 4 The heap property holds for every number of elements, including
+        //:   those at which a level of the 4-ary heap is just filled or just
+        //:   started.
+        //
+        // Plan:
+        //: 1 For each size in a range covering three levels of the heap,
+        //:   push pseudo-random values (with duplicates), verify the handles
+        //:   against a reference model, and pop all the elements, verifying
+        //:   their order, 'top', 'topHandle', and 'contains'.  (C-1..4)
+        //
+        // Testing:
+        //   Handle push(const value_type& value);
+        //   void pop();
+        //   const_reference top() const;
+        //   Handle topHandle() const;
+        //   const_reference value(Handle handle) const;
+        //   bool contains(Handle handle) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPUSH, POP, AND ACCESSORS"
+                            "\n========================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        srand(2);
+        for (int size = 0; size <= 90; ++size) {
+            Obj   mX(&oa);  const Obj& X = mX;
+            Model model(&sa);
+
+            for (int i = 0; i < size; ++i) {
+                const int    V = nextRandom(size + 1);
+                const Handle H = mX.push(V);
+                LOOP2_ASSERT(size, i, static_cast<int>(H) == i);
+                LOOP2_ASSERT(size, i, V == X.value(H));
+                model.add(H, V);
+                LOOP2_ASSERT(size, i, model.maxValue() == X.top());
+            }
+            LOOP_ASSERT(size, model.matches(X));
+
+            int previous = INT_MAX;
+            while (!X.empty()) {
+                const Handle H = X.topHandle();
+                LOOP_ASSERT(size, X.top() == X.value(H));
+                LOOP_ASSERT(size, X.top() <= previous);
+                previous = X.top();
+
+                mX.pop();
+                model.remove(H);
+                LOOP_ASSERT(size, !X.contains(H));
+            }
+            LOOP_ASSERT(size, model.matches(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push, update, erase, and pop a handful of elements, and verify
+        //:   the results by hand.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   bool empty() const;
+        //   size_type size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(!X.contains(0));
+
+        const Handle H3 = mX.push(3);
+        const Handle H9 = mX.push(9);
+        const Handle H1 = mX.push(1);
+        const Handle H7 = mX.push(7);
+        const Handle H5 = mX.push(5);
+        ASSERT(5 == X.size());
+        ASSERT(0 == H3);
+        ASSERT(4 == H5);
+        ASSERT(9 == X.top());
+        ASSERT(H9 == X.topHandle());
+
+        mX.increasePriority(H1, 10);
+        ASSERT(10 == X.top());
+        ASSERT(H1 == X.topHandle());
+
+        mX.decreasePriority(H1, 0);
+        ASSERT(9 == X.top());
+        ASSERT(0 == X.value(H1));
+
+        mX.erase(H9);
+        ASSERT(!X.contains(H9));
+        ASSERT(7 == X.top());
+        ASSERT(4 == X.size());
+
+        const Handle H8 = mX.push(8);  // reuses the handle of '9'
+        ASSERT(H9 == H8);
+        ASSERT(8 == X.top());
+
+        mX.update(H3, 11);
+        mX.update(H7, 2);
+        ASSERT(11 == X.top());  mX.pop();
+        ASSERT( 8 == X.top());  mX.pop();
+        ASSERT( 5 == X.top());  mX.pop();
+        ASSERT( 2 == X.top());  mX.pop();
+        ASSERT( 0 == X.top());  mX.pop();
+        ASSERT(X.empty());
+        ASSERT(!X.contains(H5));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: SHORTEST PATHS VS. 'bsl::priority_queue'
+        //
+        // Concerns:
+        //: 1 Dijkstra's algorithm runs faster, and with a smaller queue, with
+        //:   an 'IndexedPriorityQueue' updated in place than with a
+        //:   'bsl::priority_queue' into which duplicates are pushed.
+        //
+        // Plan:
+        //: 1 Using 'bsls::Stopwatch', time both implementations of Dijkstra's
+        //:   algorithm on a pseudo-random graph of 'N' nodes with 'D' edges
+        //:   per node (where 'N' and 'D' are optionally given as the second
+        //:   and third arguments), and report the largest queue size reached
+        //:   by each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: SHORTEST PATHS VS. 'bsl::priority_queue'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: SHORTEST PATHS VS. 'bsl::priority_queue'"
+               "\n=====================================================\n");
+
+        const int N = argc > 2 ? atoi(argv[2]) : 200000;
+        const int D = argc > 3 ? atoi(argv[3]) : 16;
+        const int R = 3;
+
+        Benchmark::Graph graph;
+        Benchmark::makeRandomGraph(&graph, N, D);
+
+        bsls::Stopwatch timer;
+        long long       sum1 = 0, sum2 = 0;
+        int             max1 = 0, max2 = 0;
+
+        timer.reset();  timer.start();
+        for (int r = 0; r < R; ++r) {
+            sum1 = Benchmark::dijkstraWithDuplicates(graph, &max1);
+        }
+        timer.stop();
+        const double T1 = timer.elapsedTime() / R;
+
+        timer.reset();  timer.start();
+        for (int r = 0; r < R; ++r) {
+            sum2 = Benchmark::dijkstraWithUpdates(graph, &max2);
+        }
+        timer.stop();
+        const double T2 = timer.elapsedTime() / R;
+
+        ASSERT(sum1 == sum2);
+
+        printf("N = %d, D = %d\n", N, D);
+        printf("bsl::priority_queue (duplicates): %8.2f ms, max size %d\n",
+               T1 * 1000, max1);
+        printf("IndexedPriorityQueue (updates):   %8.2f ms, max size %d\n",
+               T2 * 1000, max2);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -9,6 +9,7 @@
 #include <bslma_allocator.h>
 #include <bslma_testallocator.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bslma_usesbslmaallocator.h>
 
@@ -18,6 +19,7 @@
 #include <bsls_alignmentutil.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
 
 #include <stdexcept>
 #include <algorithm>
@@ -159,6 +161,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [26] USAGE EXAMPLE
+// [-1] PERFORMANCE: COPY, ITERATE, AND CLEAR
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -6827,6 +6830,68 @@ int main(int argc, char *argv[])
                       testCase2,
                       BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
         TestDriver<TestKeyType, TestValueType>::testCase2();
+
+        if (verbose) printf("\nTesting 'clear' after shrinking"
+                            "\n-------------------------------\n");
+
+        // A map of trivially copyable elements returns its nodes to the pool
+        // wholesale on 'clear' only if they account for a large fraction of
+        // the pool, and otherwise deletes them one by one.  Shrink maps to
+        // sizes on both sides of that boundary, then 'clear' them, and verify
+        // that 'clear' allocates no memory and that every node is reused,
+        // exactly once, when the map is refilled to its peak size.
+
+        {
+            const int PEAK = 1000;
+
+            const int REMAINING[] = { 0, 1, 10, 100, 500, 900, 999, PEAK };
+            const int NUM_REMAINING = sizeof REMAINING / sizeof *REMAINING;
+
+            for (int ti = 0; ti < NUM_REMAINING; ++ti) {
+                const int NUM_KEPT = REMAINING[ti];
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                typedef bsl::map<int, int> Obj;
+
+                Obj mX(&oa);  const Obj& X = mX;
+
+                for (int tj = 0; tj < PEAK; ++tj) {
+                    mX[tj] = -tj;
+                }
+                mX.erase(X.find(NUM_KEPT), X.end());
+                ASSERTV(NUM_KEPT, X.size(),
+                        NUM_KEPT == static_cast<int>(X.size()));
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mX.clear();
+
+                ASSERTV(NUM_KEPT, X.empty());
+                ASSERTV(NUM_KEPT, X.begin() == X.end());
+                ASSERTV(NUM_KEPT, oam.isTotalSame());
+                ASSERTV(NUM_KEPT, oam.isInUseSame());
+
+                for (int tj = 0; tj < PEAK; ++tj) {
+                    mX[PEAK - tj] = tj;
+                }
+
+                ASSERTV(NUM_KEPT, PEAK == static_cast<int>(X.size()));
+                ASSERTV(NUM_KEPT, oam.isTotalSame());
+                ASSERTV(NUM_KEPT, oam.isInUseSame());
+
+                int expected = PEAK - 1;
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    ASSERTV(NUM_KEPT, expected, it->second,
+                            expected == it->second);
+                    --expected;
+                }
+                ASSERTV(NUM_KEPT, expected, -1 == expected);
+
+                mX.clear();
+                ASSERTV(NUM_KEPT, X.empty());
+            }
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -6863,6 +6928,101 @@ int main(int argc, char *argv[])
                                                              NUM_INT_VALUES);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COPY, ITERATE, AND CLEAR
+        //
+        // Concerns:
+        //: 1 Copying a large map whose nodes are scattered in memory overlaps
+        //:   the cache misses incurred reading the original, and yields a map
+        //:   whose nodes are compactly laid out, so that iterating the copy is
+        //:   much faster than iterating the original.
+        //:
+        //: 2 Clearing a large map of trivially copyable elements does not
+        //:   visit each node.
+        //
+        // Plan:
+        //: 1 Populate a map with the specified number of elements (1,000,000
+        //:   by default, or the number optionally specified as the second
+        //:   argument) inserted in random order, then time copying the map,
+        //:   iterating over the original and the copy, and clearing and
+        //:   destroying the copy.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: COPY, ITERATE, AND CLEAR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: COPY, ITERATE, AND CLEAR"
+                            "\n=====================================\n");
+
+        const int NUM_ELEMENTS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        bsl::vector<int> keys(allocator);
+        keys.reserve(NUM_ELEMENTS);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            keys.push_back(i);
+        }
+        native_std::random_shuffle(keys.begin(), keys.end());
+
+        typedef bsl::map<int, int> Obj;
+
+        Obj original(allocator);
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            original[keys[i]] = i;
+        }
+
+        bsls::Stopwatch timer;
+        double          elapsed[5];
+        int             sum = 0;
+
+        timer.start();
+        Obj *copy = new Obj(original, allocator);
+        timer.stop();
+        elapsed[0] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (Obj::const_iterator it = original.begin();
+             it != original.end();
+             ++it) {
+            sum += it->second;
+        }
+        timer.stop();
+        elapsed[1] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (Obj::const_iterator it = copy->begin(); it != copy->end(); ++it) {
+            sum -= it->second;
+        }
+        timer.stop();
+        elapsed[2] = timer.elapsedTime();
+        ASSERTV(sum, 0 == sum);
+
+        timer.reset();
+        timer.start();
+        copy->clear();
+        timer.stop();
+        elapsed[3] = timer.elapsedTime();
+        ASSERT(copy->empty());
+
+        timer.reset();
+        timer.start();
+        delete copy;
+        timer.stop();
+        elapsed[4] = timer.elapsedTime();
+
+        printf("%d elements (ms): copy %.1f, iterate original %.1f, "
+               "iterate copy %.1f, clear %.1f, destroy %.1f\n",
+               NUM_ELEMENTS,
+               elapsed[0] * 1000,
+               elapsed[1] * 1000,
+               elapsed[2] * 1000,
+               elapsed[3] * 1000,
+               elapsed[4] * 1000);
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
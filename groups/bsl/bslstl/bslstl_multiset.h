@@ -463,6 +463,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -674,7 +678,9 @@ class multiset {
         // (see {Requirements on 'KEY'}).
 
     ~multiset();
-        // Destroy this object.
+        // Destroy this object.  If 'value_type' is trivially copyable (and
+        // so need not be destroyed), the memory of all nodes is returned to
+        // the allocator at once, without visiting each node.
 
     // MANIPULATORS
     multiset<KEY, COMPARATOR, ALLOCATOR>&
@@ -772,7 +778,9 @@ class multiset {
     void clear();
         // Remove all entries from this multiset.  Note that the multiset is
         // empty after this call, but allocated memory may be retained for
-        // future use.
+        // future use.  If 'value_type' is trivially copyable (and so need not
+        // be destroyed), the nodes are returned to the pool at once, without
+        // visiting each node.
 
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the first
@@ -1231,7 +1239,15 @@ template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 multiset<KEY, COMPARATOR, ALLOCATOR>::~multiset()
 {
-    clear();
+    if (bsl::is_trivially_copyable<ValueType>::value) {
+        // The elements need not be destroyed, so release the nodes wholesale
+        // rather than walking the tree.
+
+        nodeFactory().release();
+    }
+    else {
+        clear();
+    }
 }
 
 
@@ -1429,7 +1445,21 @@ void multiset<KEY, COMPARATOR, ALLOCATOR>::clear()
         BSLS_ASSERT_SAFE(0 < d_tree.numNodes());
         BSLS_ASSERT_SAFE(d_tree.firstNode() != d_tree.sentinel());
 
-        BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
+        if (bsl::is_trivially_copyable<ValueType>::value
+         && nodeFactory().capacity() <= 2 * size()) {
+            // The elements need not be destroyed, and account for at least
+            // half of the pool, so return the nodes to the pool wholesale
+            // rather than walking the tree.  Rewinding visits every block the
+            // pool holds, so a tree that has shrunk well below the pool's
+            // peak size is cheaper to delete node by node.
+
+            nodeFactory().rewind();
+            d_tree.reset(0, d_tree.sentinel(), 0);
+        }
+        else {
+            BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree,
+                                                        &nodeFactory());
+        }
     }
 #if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
     else {
@@ -0,0 +1,1608 @@
+// bslstl_rankedset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BSLSTL_RANKEDSET
+#define INCLUDED_BSLSTL_RANKEDSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set supporting rank and select queries.
+//
+//@CLASSES:
+//   bslstl::RankedSet: ordered set of unique keys with order statistics
+//
+//@SEE_ALSO: bslstl_set, bslalg_rbtreecountutil
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bslstl::RankedSet', implementing an ordered set of unique keys that, in
+// addition to the interface of 'bsl::set', answers "order-statistic" queries
+// in logarithmic time:
+//..
+//  rank(key)               Return the number of keys less than 'key'.
+//
+//  select(index)           Return an iterator to the key at position 'index'.
+//
+//  distance(first, last)   Return the number of keys in '[first .. last)'.
+//..
+// With a 'bsl::set' these queries require walking the container from
+// 'begin()' (e.g., using 'bsl::distance' or 'bsl::advance'), which takes
+// time linear in the position (or distance) involved.  A 'RankedSet' stores,
+// in each node of its red-black tree, the number of nodes in the subtree
+// rooted at that node (see 'bslalg_rbtreecountutil'), which lets these
+// queries be answered by a single descent of (or ascent through) the tree.
+// Maintaining the counts adds a small constant to the cost of insertion and
+// removal, and a 'bslalg::RbTreeCountedNode' is typically one word larger
+// than the node used by 'bsl::set'; all other operations cost the same as
+// for 'bsl::set'.
+//
+// A 'RankedSet' meets the requirements of an associative container with
+// bidirectional iterators in the C++ standard [23.2.4], except that its
+// iterators are not invalidated by (and do not expose) the counts.  Note
+// that, as for 'bsl::set', the elements of a 'RankedSet' cannot be modified
+// through its iterators, so a container ranking objects by one attribute
+// while holding another that changes (e.g., an order book keyed by price) is
+// best expressed as a 'RankedSet' of keys used alongside a separate map of
+// the mutable data.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'RankedSet' is a fully "Value-Semantic Type" (see {'bsldoc_glossary'})
+// only if the supplied 'KEY' template parameter is fully value-semantic.  The
+// requirements on 'KEY' are the same as for 'bsl::set' (see {'bslstl_set'}).
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'RankedSet':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' type of the ranked set
+//  'a', 'b'        - two distinct objects of type 'RankedSet<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - an object of type 'K'
+//  'i'             - an index in the range '[0 .. n]'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | RankedSet<K> a; (default construction)             | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | RankedSet<K> a(b); (copy construction)             | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.~RankedSet<K>(); (destruction)                   | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;             (assignment)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k), a.erase(k), a.erase(p1)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.find(k), a.lower_bound(k), a.upper_bound(k),     | O[log(n)]          |
+//  | a.count(k), a.equal_range(k)                       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.rank(k), a.select(i), a.distance(p1, p2)         | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.size(), a.empty(), a.swap(b) | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b, a < b, a <= b, a > b, a >= b       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining a Leaderboard
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are maintaining the leaderboard of an online game, where the
+// scores of players change continually, and each player wants to know their
+// position on the board.  We identify each entry by its score and the
+// identifier of the player holding it, ordering higher scores first:
+//..
+//  typedef bsl::pair<int, int> Entry;  // (score, player)
+//
+//  struct HigherScoreFirst {
+//      bool operator()(const Entry& lhs, const Entry& rhs) const
+//          // Return 'true' if the specified 'lhs' is ordered before the
+//          // specified 'rhs' on the board, and 'false' otherwise.
+//      {
+//          return lhs.first > rhs.first
+//              || (lhs.first == rhs.first && lhs.second < rhs.second);
+//      }
+//  };
+//
+//  typedef bslstl::RankedSet<Entry, HigherScoreFirst> Leaderboard;
+//..
+// First, we create a leaderboard and record the initial scores of five
+// players:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVerbose);
+//  Leaderboard          board(&oa);
+//
+//  board.insert(Entry(1200, 1));
+//  board.insert(Entry( 900, 2));
+//  board.insert(Entry(1500, 3));
+//  board.insert(Entry(1100, 4));
+//  board.insert(Entry( 700, 5));
+//..
+// Then, we find the position (counting from 0) of player 4, whose entry is
+// preceded by those of players 3 and 1:
+//..
+//  assert(2 == board.rank(Entry(1100, 4)));
+//..
+// Next, player 5 scores 600 points; we replace the entry of that player,
+// which moves from last place to second place:
+//..
+//  board.erase(Entry(700, 5));
+//  board.insert(Entry(1300, 5));
+//  assert(1 == board.rank(Entry(1300, 5)));
+//..
+// Then, we display the page of the board holding positions 2 through 3,
+// which we locate directly, without walking past the entries before it:
+//..
+//  Leaderboard::const_iterator it = board.select(2);
+//  assert(1 == it->second);
+//  ++it;
+//  assert(4 == it->second);
+//..
+// Finally, we count the number of players whose scores lie in the range
+// '[900 .. 1300]', using the entries bounding that range on the board:
+//..
+//  Leaderboard::const_iterator first = board.lower_bound(Entry(1300, 0));
+//  Leaderboard::const_iterator last  = board.lower_bound(Entry( 899, 0));
+//  assert(4 == board.distance(first, last));
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "include <bsl_set.h> instead of <bslstl_rankedset.h> in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SETCOMPARATOR
+#include <bslstl_setcomparator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_TREEITERATOR
+#include <bslstl_treeiterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_TREENODEPOOL
+#include <bslstl_treenodepool.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEANCHOR
+#include <bslalg_rbtreeanchor.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREECOUNTUTIL
+#include <bslalg_rbtreecountutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREENODE
+#include <bslalg_rbtreenode.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RBTREEUTIL
+#include <bslalg_rbtreeutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ====================
+                          // class RankedSet_Node
+                          // ====================
+
+template <class VALUE>
+class RankedSet_Node : public bslalg::RbTreeCountedNode {
+    // This POD-like 'class' describes a node suitable for use in the
+    // red-black tree implementing a 'RankedSet': it holds, in addition to the
+    // links, color, and subtree size provided by 'bslalg::RbTreeCountedNode',
+    // a value of the parameterized 'VALUE' type.  Like 'bslstl::TreeNode',
+    // this class is never constructed or destroyed as a whole: its 'value' is
+    // constructed and destroyed in place by the node factory.
+
+    // DATA
+    VALUE d_value;  // payload value
+
+  private:
+    // The following functions are not defined because a 'RankedSet_Node'
+    // should never be constructed, destructed, or assigned.
+
+    RankedSet_Node();                                  // Declared but not
+                                                       // defined
+    RankedSet_Node(const RankedSet_Node&);             // Declared but not
+                                                       // defined
+    RankedSet_Node& operator=(const RankedSet_Node&);  // Declared but not
+                                                       // defined
+    ~RankedSet_Node();                                 // Declared but not
+                                                       // defined
+
+  public:
+    // MANIPULATORS
+    VALUE& value();
+        // Return a reference providing modifiable access to the 'value' of
+        // this object.
+
+    // ACCESSORS
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the 'value' of
+        // this object.
+};
+
+                      // ===============================
+                      // class RankedSet_CountingFactory
+                      // ===============================
+
+template <class FACTORY>
+class RankedSet_CountingFactory {
+    // This class provides a node factory, suitable for use with
+    // 'bslalg::RbTreeUtil::copyTree', that creates nodes using a node factory
+    // of the parameterized 'FACTORY' type, and copies the subtree size of
+    // each original 'bslalg::RbTreeCountedNode' into the node created from
+    // it, so that a copied tree is correctly counted.
+
+    // DATA
+    FACTORY *d_factory_p;  // node factory (held, not owned)
+
+  public:
+    // CREATORS
+    explicit RankedSet_CountingFactory(FACTORY *factory);
+        // Create a 'RankedSet_CountingFactory' object creating (and deleting)
+        // nodes using the specified 'factory'.
+
+    // MANIPULATORS
+    bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
+        // Return a node created by the held factory from the specified
+        // 'original', having the subtree size of 'original'.  The behavior is
+        // undefined unless 'original' refers to a
+        // 'bslalg::RbTreeCountedNode'.
+
+    void deleteNode(bslalg::RbTreeNode *node);
+        // Delete the specified 'node' using the held factory.
+};
+
+                             // ===============
+                             // class RankedSet
+                             // ===============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = bsl::allocator<KEY> >
+class RankedSet {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY'), that provides, in addition to the operations of 'bsl::set', the
+    // position of a key within the sequence, and the key at a position, in
+    // logarithmic time.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef const KEY                                           ValueType;
+        // This typedef is an alias for the type of key objects maintained by
+        // this ranked set.
+
+    typedef RankedSet_Node<KEY>                                 Node;
+        // This typedef is an alias for the type of nodes held by the tree (of
+        // nodes) used to implement this ranked set.
+
+    typedef SetComparator<KEY, COMPARATOR, Node>                Comparator;
+        // This typedef is an alias for the comparator used internally by this
+        // ranked set.
+
+    typedef TreeNodePool<KEY, ALLOCATOR, Node>                  NodeFactory;
+        // This typedef is an alias for the factory type used to create and
+        // destroy 'Node' objects.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    struct DataWrapper : public Comparator {
+        // This struct is wrapper around the comparator and allocator data
+        // members.  It takes advantage of the empty-base optimization (EBO) so
+        // that if the allocator is stateless, it takes up no space.
+
+        NodeFactory d_pool;  // pool of 'Node' objects
+
+        explicit DataWrapper(const COMPARATOR& comparator,
+                             const ALLOCATOR&  allocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and 'allocator'.
+    };
+
+    // DATA
+    DataWrapper          d_compAndAlloc;  // comparator and pool of 'Node'
+                                          // objects
+
+    bslalg::RbTreeAnchor d_tree;          // balanced, counted tree of 'Node'
+                                          // objects
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef TreeIterator<const value_type,
+                         Node,
+                         difference_type>              iterator;
+    typedef TreeIterator<const value_type,
+                         Node,
+                         difference_type>              const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    NodeFactory& nodeFactory();
+        // Return a reference providing modifiable access to the
+        // node-allocator for this tree.
+
+    Comparator& comparator();
+        // Return a reference providing modifiable access to the comparator
+        // for this tree.
+
+    void copyTree(const RankedSet& original);
+        // Load into this empty ranked set a copy of the nodes of the
+        // specified 'original', including their subtree sizes.
+
+    void quickSwap(RankedSet& other);
+        // Efficiently exchange the value and comparator of this object with
+        // the value of the specified 'other' object.  This method provides
+        // the no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // PRIVATE ACCESSORS
+    const NodeFactory& nodeFactory() const;
+        // Return a reference providing non-modifiable access to the
+        // node-allocator for this tree.
+
+    const Comparator& comparator() const;
+        // Return a reference providing non-modifiable access to the
+        // comparator for this tree.
+
+  public:
+    // CREATORS
+    explicit RankedSet(const COMPARATOR& comparator = COMPARATOR(),
+                       const ALLOCATOR&  allocator  = ALLOCATOR())
+        // Construct an empty ranked set.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify an
+        // 'allocator' used to supply memory.  If 'allocator' is not supplied,
+        // a default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' argument is of type
+        // 'bsl::allocator' (the default), then 'allocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR'
+        // argument is of type 'bsl::allocator' and 'allocator' is not
+        // supplied, the currently installed default allocator will be used
+        // to supply memory.
+    : d_compAndAlloc(comparator, allocator)
+    , d_tree()
+    {
+        // The implementation is placed here in the class definition to
+        // work around an AIX compiler bug (see 'bsl::set').
+    }
+
+    explicit RankedSet(const ALLOCATOR& allocator);
+        // Construct an empty ranked set that will use the specified
+        // 'allocator' to supply memory.  Use a default-constructed object of
+        // the (template parameter) type 'COMPARATOR' to order the keys
+        // contained in this ranked set.  If the template parameter
+        // 'ALLOCATOR' argument is of type 'bsl::allocator' (the default) then
+        // 'allocator' shall be convertible to 'bslma::Allocator *'.
+
+    RankedSet(const RankedSet& original);
+        // Construct a ranked set having the same value as the specified
+        // 'original'.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this ranked set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())'
+        // to allocate memory.
+
+    RankedSet(const RankedSet& original, const ALLOCATOR& allocator);
+        // Construct a ranked set having the same value as that of the
+        // specified 'original' that will use the specified 'allocator' to
+        // supply memory.  Use a copy of 'original.key_comp()' to order the
+        // keys contained in this ranked set.
+
+    template <class INPUT_ITERATOR>
+    RankedSet(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator = COMPARATOR(),
+              const ALLOCATOR&  allocator  = ALLOCATOR());
+        // Construct a ranked set, and insert each 'value_type' object in the
+        // sequence starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element, ignoring those
+        // keys appearing in the sequence that are already present.
+        // Optionally specify a 'comparator' used to order keys contained in
+        // this object, and an 'allocator' used to supply memory (see the
+        // default constructor).  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values
+        // of a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values
+        // where 'first' is at a position at or before 'last'.
+
+    ~RankedSet();
+        // Destroy this object.
+
+    // MANIPULATORS
+    RankedSet& operator=(const RankedSet& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if
+        // the 'ALLOCATOR' type has trait
+        // 'propagate_on_container_copy_assignment', and return a reference
+        // providing modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this ranked set, or the 'end' iterator if this
+        // ranked set is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this ranked set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this ranked set, or 'rend' if this ranked set is
+        // empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this ranked set.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this ranked set if a key
+        // equivalent to 'value' does not already exist in this ranked set;
+        // otherwise, if a key equivalent to 'value' already exists in this
+        // ranked set, this method has no effect.  Return a pair whose 'first'
+        // member is an iterator referring to the (possibly newly inserted)
+        // 'value_type' object in this ranked set that is equivalent to
+        // 'value', and whose 'second' member is 'true' if a new value was
+        // inserted, and 'false' if the value was already present.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this ranked set (in amortized
+        // constant time if the specified 'hint' is a valid immediate
+        // successor to 'value'), if a key equivalent to 'value' does not
+        // already exist in this ranked set.  Return an iterator referring to
+        // the (possibly newly inserted) 'value_type' object in this ranked
+        // set that is equivalent to 'value'.  The behavior is undefined
+        // unless 'hint' is a valid iterator into this ranked set.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this ranked set the value of each 'value_type' object
+        // in the range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this ranked set.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    iterator erase(const_iterator position);
+        // Remove from this ranked set the 'value_type' object at the
+        // specified 'position', and return an iterator referring to the
+        // element immediately following the removed element, or to the
+        // past-the-end position if the removed element was the last element
+        // in the sequence of elements maintained by this ranked set.  The
+        // behavior is undefined unless 'position' refers to a 'value_type'
+        // object in this ranked set.
+
+    size_type erase(const key_type& key);
+        // Remove from this ranked set the 'value_type' object equivalent to
+        // the specified 'key', if such an entry exists, and return 1;
+        // otherwise, if there is no 'value_type' object that is equivalent to
+        // 'key', return 0 with no other effect.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this ranked set the 'value_type' objects starting at
+        // the specified 'first' position up to, but not including the
+        // specified 'last' position, and return 'last'.  The behavior is
+        // undefined unless 'first' and 'last' either refer to elements in
+        // this ranked set or are the 'end' iterator, and the 'first' position
+        // is at or before the 'last' position in the ordered sequence
+        // provided by this container.
+
+    void swap(RankedSet& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  Additionally if
+        // 'bsl::allocator_traits<ALLOCATOR>::propagate_on_container_swap' is
+        // 'true' then exchange the allocator of this object with that of the
+        // 'other' object, and do not modify either allocator otherwise.  This
+        // method provides the no-throw exception-safety guarantee and
+        // guarantees O[1] complexity, unless the allocators of the two
+        // objects differ (in which case the objects are exchanged by copying,
+        // as for 'bsl::set').
+
+    void clear();
+        // Remove all entries from this ranked set.  Note that the ranked set
+        // is empty after this call, but allocated memory may be retained for
+        // future use.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this ranked set equivalent to the specified 'key', if
+        // such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this ranked set that is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this ranked set does not contain such an object.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this ranked set that is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this ranked set does not contain such an object.
+
+    bsl::pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this ranked set equivalent to
+        // the specified 'key', where the the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  Note that, as the keys are unique, the
+        // sequence holds at most one element.
+
+    iterator select(size_type index);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object at the specified (zero-based) 'index' in the ordered
+        // sequence maintained by this ranked set, and the past-the-end
+        // iterator if 'index' is 'size()'.  The behavior is undefined unless
+        // 'index <= size()'.  Note that this operation is O[log(n)], whereas
+        // advancing 'begin()' by 'index' positions is O[index].
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // ranked set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this ranked set, or the 'end' iterator if this
+        // ranked set is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this ranked set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this ranked set, or 'rend' if this ranked set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this ranked set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this ranked set, or the 'cend' iterator if this
+        // ranked set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this ranked set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this ranked set, or 'crend' if this ranked
+        // set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this ranked set.
+
+    bool empty() const;
+        // Return 'true' if this ranked set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this ranked set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this ranked set could possibly hold.  Note that there is no
+        // guarantee that the ranked set can successfully grow to the returned
+        // size, or even close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by
+        // this ranked set; if a comparator was supplied at construction,
+        // return its value, otherwise return a default constructed
+        // 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by
+        // comparing their respective keys using 'key_comp()'.  Note that
+        // this comparator is the same as that returned by 'key_comp()', as
+        // the keys are the values.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this ranked set equivalent to the specified
+        // 'key', if such an entry exists, and the past-the-end ('end')
+        // iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this ranked set
+        // that are equivalent to the specified 'key'.  Note that since a
+        // ranked set maintains unique keys, the returned value will be
+        // either 0 or 1.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this ranked set that
+        // is greater-than or equal-to the specified 'key', and the
+        // past-the-end iterator if this ranked set does not contain such an
+        // object.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this ranked set that
+        // is greater than the specified 'key', and the past-the-end iterator
+        // if this ranked set does not contain such an object.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this ranked set equivalent to
+        // the specified 'key', where the the first iterator is positioned at
+        // the start of the sequence, and the second is positioned one past
+        // the end of the sequence.  Note that, as the keys are unique, the
+        // sequence holds at most one element.
+
+                          // Order Statistics
+
+    size_type rank(const key_type& key) const;
+        // Return the number of keys in this ranked set that are ordered
+        // before (i.e., are less than) the specified 'key'.  Note that if
+        // 'key' is present, the returned value is its (zero-based) position
+        // in the ordered sequence maintained by this ranked set, and that
+        // 'select(rank(key))' returns 'lower_bound(key)'.
+
+    const_iterator select(size_type index) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object at the specified (zero-based) 'index' in the
+        // ordered sequence maintained by this ranked set, and the
+        // past-the-end iterator if 'index' is 'size()'.  The behavior is
+        // undefined unless 'index <= size()'.  Note that this operation is
+        // O[log(n)], whereas advancing 'begin()' by 'index' positions is
+        // O[index].
+
+    difference_type distance(const_iterator first,
+                             const_iterator last) const;
+        // Return the number of increments needed to reach the specified
+        // 'last' from the specified 'first' (a negative value if 'last'
+        // precedes 'first').  The behavior is undefined unless 'first' and
+        // 'last' are valid iterators into this ranked set.  Note that this
+        // operation is O[log(n)], whereas 'bsl::distance(first, last)' is
+        // O[distance].
+};
+
+}  // close namespace bslstl
+
+// TRAITS
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace bslalg {
+
+template <typename KEY,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct HasStlIterators<bslstl::RankedSet<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <typename KEY,
+          typename COMPARATOR,
+          typename ALLOCATOR>
+struct UsesBslmaAllocator<bslstl::RankedSet<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close namespace bslma
+
+namespace bslstl {
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'RankedSet' objects have the same
+    // value if they have the same number of keys, and each key that is
+    // contained in one of the objects is also contained in the other object.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'RankedSet' objects do not have
+    // the same value if they do not have the same number of keys, or some
+    // keys that are contained in one of the objects are not also contained in
+    // the other object.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator< (const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ranked set is
+    // lexicographically less than that of the specified 'rhs' ranked set,
+    // and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator> (const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ranked set is
+    // lexicographically greater than that of the specified 'rhs' ranked set,
+    // and 'false' otherwise.  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ranked set is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // ranked set, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' ranked set is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // ranked set, and 'false' otherwise.  This method requires that
+    // 'operator<', inducing a total order, be defined for 'value_type'.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(RankedSet<KEY, COMPARATOR, ALLOCATOR>& a,
+          RankedSet<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object
+    // with the value and comparator of the specified 'b' object.
+    // Additionally if 'bsl::allocator_traits<ALLOCATOR>::
+    // propagate_on_container_swap' is 'true' then exchange the allocator of
+    // 'a' with that of 'b', and do not modify either allocator otherwise.
+    // This method provides the no-throw exception-safety guarantee and
+    // guarantees O[1] complexity, unless the allocators of the two objects
+    // differ.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // --------------------
+                          // class RankedSet_Node
+                          // --------------------
+
+// MANIPULATORS
+template <class VALUE>
+inline
+VALUE& RankedSet_Node<VALUE>::value()
+{
+    return d_value;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+const VALUE& RankedSet_Node<VALUE>::value() const
+{
+    return d_value;
+}
+
+                      // -------------------------------
+                      // class RankedSet_CountingFactory
+                      // -------------------------------
+
+// CREATORS
+template <class FACTORY>
+inline
+RankedSet_CountingFactory<FACTORY>::RankedSet_CountingFactory(
+                                                              FACTORY *factory)
+: d_factory_p(factory)
+{
+}
+
+// MANIPULATORS
+template <class FACTORY>
+inline
+bslalg::RbTreeNode *RankedSet_CountingFactory<FACTORY>::createNode(
+                                            const bslalg::RbTreeNode& original)
+{
+    bslalg::RbTreeNode *node = d_factory_p->createNode(original);
+    static_cast<bslalg::RbTreeCountedNode *>(node)->setSubtreeSize(
+               static_cast<const bslalg::RbTreeCountedNode&>(original)
+                                                              .subtreeSize());
+    return node;
+}
+
+template <class FACTORY>
+inline
+void RankedSet_CountingFactory<FACTORY>::deleteNode(bslalg::RbTreeNode *node)
+{
+    d_factory_p->deleteNode(node);
+}
+
+                             // -----------------
+                             // class DataWrapper
+                             // -----------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                                  const COMPARATOR& comparator,
+                                                  const ALLOCATOR&  allocator)
+: RankedSet<KEY, COMPARATOR, ALLOCATOR>::Comparator(comparator)
+, d_pool(allocator)
+{
+}
+
+                             // ---------------
+                             // class RankedSet
+                             // ---------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::NodeFactory&
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::nodeFactory()
+{
+    return d_compAndAlloc.d_pool;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::Comparator&
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::comparator()
+{
+    return d_compAndAlloc;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void RankedSet<KEY, COMPARATOR, ALLOCATOR>::copyTree(
+                                                   const RankedSet& original)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.rootNode());
+
+    if (0 < original.size()) {
+        nodeFactory().reserveNodes(original.size());
+
+        RankedSet_CountingFactory<NodeFactory> factory(&nodeFactory());
+        bslalg::RbTreeUtil::copyTree(&d_tree, original.d_tree, &factory);
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedSet<KEY, COMPARATOR, ALLOCATOR>::quickSwap(RankedSet& other)
+{
+    bslalg::RbTreeUtil::swap(&d_tree, &other.d_tree);
+    nodeFactory().swap(other.nodeFactory());
+
+    // Work around to avoid the 1-byte swap problem on AIX for an empty class
+    // under empty-base optimization.
+
+    if (sizeof(NodeFactory) != sizeof(DataWrapper)) {
+        comparator().swap(other.comparator());
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::NodeFactory&
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::nodeFactory() const
+{
+    return d_compAndAlloc.d_pool;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::Comparator&
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_compAndAlloc;
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::RankedSet(const ALLOCATOR& allocator)
+: d_compAndAlloc(COMPARATOR(), allocator)
+, d_tree()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::RankedSet(const RankedSet& original)
+: d_compAndAlloc(original.comparator().keyComparator(),
+                 AllocatorTraits::select_on_container_copy_construction(
+                                           original.nodeFactory().allocator()))
+, d_tree()
+{
+    copyTree(original);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::RankedSet(const RankedSet& original,
+                                                 const ALLOCATOR& allocator)
+: d_compAndAlloc(original.comparator().keyComparator(), allocator)
+, d_tree()
+{
+    copyTree(original);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::RankedSet(INPUT_ITERATOR    first,
+                                                 INPUT_ITERATOR    last,
+                                                 const COMPARATOR& comparator,
+                                                 const ALLOCATOR&  allocator)
+: d_compAndAlloc(comparator, allocator)
+, d_tree()
+{
+    bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(&d_tree,
+                                                       &nodeFactory());
+    insert(first, last);
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::~RankedSet()
+{
+    if (bsl::is_trivially_copyable<ValueType>::value) {
+        // The elements need not be destroyed, so release the nodes wholesale
+        // rather than walking the tree.
+
+        nodeFactory().release();
+    }
+    else {
+        clear();
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+RankedSet<KEY, COMPARATOR, ALLOCATOR>&
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::operator=(const RankedSet& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            RankedSet other(rhs, rhs.nodeFactory().allocator());
+            bslalg::SwapUtil::swap(&nodeFactory().allocator(),
+                                   &other.nodeFactory().allocator());
+            quickSwap(other);
+        }
+        else {
+            RankedSet other(rhs, nodeFactory().allocator());
+            quickSwap(other);
+        }
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::begin()
+{
+    return iterator(d_tree.firstNode());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::end()
+{
+    return iterator(d_tree.sentinel());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    int comparisonResult;
+    bslalg::RbTreeNode *insertLocation =
+        bslalg::RbTreeUtil::findUniqueInsertLocation(&comparisonResult,
+                                                     &d_tree,
+                                                     this->comparator(),
+                                                     value);
+    if (!comparisonResult) {
+        return bsl::pair<iterator, bool>(iterator(insertLocation), false);
+                                                                      // RETURN
+    }
+    bslalg::RbTreeNode *node = nodeFactory().createNode(value);
+    bslalg::RbTreeCountUtil::insertAt(&d_tree,
+                                      insertLocation,
+                                      comparisonResult < 0,
+                                      node);
+    return bsl::pair<iterator, bool>(iterator(node), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                              const value_type& value)
+{
+    bslalg::RbTreeNode *hintNode =
+                             const_cast<bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    bslalg::RbTreeNode *insertLocation =
+        bslalg::RbTreeUtil::findUniqueInsertLocation(&comparisonResult,
+                                                     &d_tree,
+                                                     this->comparator(),
+                                                     value,
+                                                     hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    bslalg::RbTreeNode *node = nodeFactory().createNode(value);
+    bslalg::RbTreeCountUtil::insertAt(&d_tree,
+                                      insertLocation,
+                                      comparisonResult < 0,
+                                      node);
+    return iterator(node);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void RankedSet<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                   INPUT_ITERATOR last)
+{
+    // Supplying 'end()' as the hint makes the insertion of an ordered
+    // sequence take amortized constant time per element.
+
+    while (first != last) {
+        insert(cend(), *first);
+        ++first;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    bslalg::RbTreeNode *node =
+                         const_cast<bslalg::RbTreeNode *>(position.node());
+    bslalg::RbTreeNode *result = bslalg::RbTreeUtil::next(node);
+    bslalg::RbTreeCountUtil::remove(&d_tree, node);
+    nodeFactory().deleteNode(node);
+    return iterator(result);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::size_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    erase(it);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                             const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last.node());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedSet<KEY, COMPARATOR, ALLOCATOR>::swap(RankedSet& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        bslalg::SwapUtil::swap(&nodeFactory().allocator(),
+                               &other.nodeFactory().allocator());
+        quickSwap(other);
+    }
+    else {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               nodeFactory().allocator() == other.nodeFactory().allocator())) {
+            quickSwap(other);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            RankedSet thisCopy(*this, other.nodeFactory().allocator());
+            RankedSet otherCopy(other, nodeFactory().allocator());
+
+            quickSwap(otherCopy);
+            other.quickSwap(thisCopy);
+        }
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void RankedSet<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    if (d_tree.rootNode()) {
+        if (bsl::is_trivially_copyable<ValueType>::value
+         && nodeFactory().capacity() <= 2 * size()) {
+            // The elements need not be destroyed, and account for at least
+            // half of the pool, so return the nodes to the pool wholesale
+            // rather than walking the tree.  Rewinding visits every block the
+            // pool holds, so a tree that has shrunk well below the pool's
+            // peak size is cheaper to delete node by node.
+
+            nodeFactory().rewind();
+            d_tree.reset(0, d_tree.sentinel(), 0);
+        }
+        else {
+            bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
+        }
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return iterator(bslalg::RbTreeUtil::find(d_tree,
+                                             this->comparator(),
+                                             key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return iterator(bslalg::RbTreeUtil::lowerBound(d_tree,
+                                                   this->comparator(),
+                                                   key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return iterator(bslalg::RbTreeUtil::upperBound(d_tree,
+                                                   this->comparator(),
+                                                   key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator,
+          typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator>
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator startIt = lower_bound(key);
+    iterator endIt   = startIt;
+    if (endIt != end() && !comparator()(key, *endIt.node())) {
+        ++endIt;
+    }
+    return bsl::pair<iterator, iterator>(startIt, endIt);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::select(size_type index)
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return iterator(bslalg::RbTreeCountUtil::select(
+                                                 d_tree,
+                                                 static_cast<int>(index)));
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return nodeFactory().allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return cbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return crbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return crend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return const_iterator(d_tree.firstNode());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return const_iterator(d_tree.sentinel());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool RankedSet<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_tree.numNodes();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::size_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_tree.numNodes();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::size_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return AllocatorTraits::max_size(get_allocator());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::key_compare
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return comparator().keyComparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::value_compare
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(key_comp());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return const_iterator(bslalg::RbTreeUtil::find(d_tree,
+                                                   this->comparator(),
+                                                   key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::size_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return (find(key) != end()) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return const_iterator(bslalg::RbTreeUtil::lowerBound(d_tree,
+                                                         this->comparator(),
+                                                         key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return const_iterator(bslalg::RbTreeUtil::upperBound(d_tree,
+                                                         this->comparator(),
+                                                         key));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator startIt = lower_bound(key);
+    const_iterator endIt   = startIt;
+    if (endIt != end() && !comparator()(key, *endIt.node())) {
+        ++endIt;
+    }
+    return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::size_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::rank(const key_type& key) const
+{
+    return bslalg::RbTreeCountUtil::lowerBoundRank(d_tree,
+                                                   this->comparator(),
+                                                   key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::select(size_type index) const
+{
+    BSLS_ASSERT_SAFE(index <= size());
+
+    return const_iterator(bslalg::RbTreeCountUtil::select(
+                                                 d_tree,
+                                                 static_cast<int>(index)));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename RankedSet<KEY, COMPARATOR, ALLOCATOR>::difference_type
+RankedSet<KEY, COMPARATOR, ALLOCATOR>::distance(const_iterator first,
+                                                const_iterator last) const
+{
+    return static_cast<difference_type>(
+                        bslalg::RbTreeCountUtil::rank(d_tree, last.node()))
+         - static_cast<difference_type>(
+                        bslalg::RbTreeCountUtil::rank(d_tree, first.node()));
+}
+
+}  // close namespace bslstl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator==(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                        const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return bslalg::RangeCompare::equal(lhs.begin(),
+                                       lhs.end(),
+                                       lhs.size(),
+                                       rhs.begin(),
+                                       rhs.end(),
+                                       rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator!=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                        const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator<(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                       const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                     lhs.end(),
+                                                     lhs.size(),
+                                                     rhs.begin(),
+                                                     rhs.end(),
+                                                     rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator>(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                       const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator<=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                        const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bslstl::operator>=(const RankedSet<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                        const RankedSet<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bslstl::swap(RankedSet<KEY, COMPARATOR, ALLOCATOR>& a,
+                  RankedSet<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
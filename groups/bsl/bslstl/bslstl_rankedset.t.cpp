@@ -0,0 +1,893 @@
+// bslstl_rankedset.t.cpp                                             -*-C++-*-
+#include <bslstl_rankedset.h>
+
+#include <bslstl_pair.h>
+#include <bslstl_set.h>
+#include <bslstl_vector.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>                // for testing only
+#include <bsls_types.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>     // atoi(), rand(), srand()
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements an ordered set whose red-black tree is
+// augmented with subtree sizes.  The tree manipulation is delegated to
+// 'bslalg::RbTreeUtil' and 'bslalg::RbTreeCountUtil', and the node
+// management to 'bslstl::TreeNodePool', all of which are tested by their own
+// test drivers; the 'bsl::set' interface replicated here is implemented in
+// the same way as in 'bsl::set'.  We therefore concentrate on verifying that
+// every manipulator leaves the container consistent with a reference model
+// (a sorted 'bsl::vector'), so that the order-statistic accessors ('rank',
+// 'select', and 'distance') remain correct, and that copying, assignment,
+// and swapping preserve the counts and obey the allocator conventions of
+// 'bsl::set'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 3] RankedSet(const COMPARATOR&, const ALLOCATOR&);
+// [ 3] RankedSet(const ALLOCATOR&);
+// [ 3] RankedSet(const RankedSet& original);
+// [ 3] RankedSet(const RankedSet& original, const ALLOCATOR& allocator);
+// [ 2] RankedSet(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+// [ 3] ~RankedSet();
+//
+// MANIPULATORS
+// [ 3] RankedSet& operator=(const RankedSet& rhs);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] iterator insert(const_iterator hint, const value_type& value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] size_type erase(const key_type& key);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 3] void swap(RankedSet& other);
+// [ 3] void clear();
+// [ 2] iterator select(size_type index);
+//
+// ACCESSORS
+// [ 2] size_type rank(const key_type& key) const;
+// [ 2] const_iterator select(size_type index) const;
+// [ 2] difference_type distance(const_iterator, const_iterator) const;
+// [ 1] size_type size() const;
+// [ 2] iterator find(const key_type& key);
+// [ 2] size_type count(const key_type& key) const;
+// [ 2] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const RankedSet& lhs, const RankedSet& rhs);
+// [ 3] bool operator!=(const RankedSet& lhs, const RankedSet& rhs);
+// [ 3] bool operator< (const RankedSet& lhs, const RankedSet& rhs);
+// [ 3] void swap(RankedSet& a, RankedSet& b);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: The object allocates memory only from its allocator.
+// [ 3] CONCERN: All elements are destroyed.
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'rank' and 'distance' vs. 'bsl::set'
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                 GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslstl::RankedSet<int> Obj;
+typedef bsl::vector<int>       Model;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int numLiveCounted = 0;  // number of 'CountedInt' objects in existence
+
+class CountedInt {
+    // This class provides an integer wrapper that is not trivially copyable,
+    // and that counts the number of its instances in existence, so that the
+    // destruction of the elements of a container can be verified.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    explicit CountedInt(int value) : d_value(value) { ++numLiveCounted; }
+
+    CountedInt(const CountedInt& original)
+    : d_value(original.d_value)
+    {
+        ++numLiveCounted;
+    }
+
+    ~CountedInt() { --numLiveCounted; }
+
+    // MANIPULATORS
+    CountedInt& operator=(const CountedInt& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const { return d_value; }
+};
+
+bool operator<(const CountedInt& lhs, const CountedInt& rhs)
+    // Return 'true' if the value of the specified 'lhs' is less than that of
+    // the specified 'rhs', and 'false' otherwise.
+{
+    return lhs.value() < rhs.value();
+}
+
+bool operator==(const CountedInt& lhs, const CountedInt& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value, and
+    // 'false' otherwise.
+{
+    return lhs.value() == rhs.value();
+}
+
+//=============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+int nextRandom(int modulus)
+    // Return a pseudo-random integer in the range '[0 .. modulus)'.
+{
+    return rand() % modulus;
+}
+
+void modelInsert(Model *model, int value)
+    // Insert the specified 'value' into the specified sorted 'model', unless
+    // it is already present.
+{
+    Model::iterator it = std::lower_bound(model->begin(),
+                                          model->end(),
+                                          value);
+    if (it == model->end() || *it != value) {
+        model->insert(it, value);
+    }
+}
+
+bool matchesModel(const Obj& object, const Model& model)
+    // Return 'true' if the specified 'object' holds the same sequence of keys
+    // as the specified sorted 'model', and answers every order-statistic
+    // query consistently with 'model', and 'false' otherwise.
+{
+    if (object.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+    if (!std::equal(model.begin(), model.end(), object.begin())) {
+        return false;                                                 // RETURN
+    }
+
+    Obj::const_iterator it = object.begin();
+    for (int i = 0; i < static_cast<int>(model.size()); ++i, ++it) {
+        if (object.select(i) != it
+         || static_cast<int>(object.rank(model[i])) != i
+         || object.distance(object.begin(), it) != i
+         || object.distance(it, object.end())
+                                       != static_cast<int>(model.size()) - i) {
+            return false;                                             // RETURN
+        }
+
+        // The key preceding 'model[i]' ranks at its insertion position if it
+        // is absent.
+
+        const int EXP = (0 < i && model[i - 1] == model[i] - 1) ? i - 1 : i;
+        if (static_cast<int>(object.rank(model[i] - 1)) != EXP) {
+            return false;                                             // RETURN
+        }
+    }
+    return object.select(object.size()) == object.end();
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Example 1: Maintaining a Leaderboard
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are maintaining the leaderboard of an online game, where the
+// scores of players change continually, and each player wants to know their
+// position on the board.  We identify each entry by its score and the
+// identifier of the player holding it, ordering higher scores first:
+//..
+    typedef bsl::pair<int, int> Entry;  // (score, player)
+
+    struct HigherScoreFirst {
+        bool operator()(const Entry& lhs, const Entry& rhs) const
+            // Return 'true' if the specified 'lhs' is ordered before the
+            // specified 'rhs' on the board, and 'false' otherwise.
+        {
+            return lhs.first > rhs.first
+                || (lhs.first == rhs.first && lhs.second < rhs.second);
+        }
+    };
+
+    typedef bslstl::RankedSet<Entry, HigherScoreFirst> Leaderboard;
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+
+    setbuf(stdout, 0);    // Use unbuffered output
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// First, we create a leaderboard and record the initial scores of five
+// players:
+//..
+    bslma::TestAllocator oa("object", veryVeryVerbose);
+    Leaderboard          board(&oa);
+
+    board.insert(Entry(1200, 1));
+    board.insert(Entry( 900, 2));
+    board.insert(Entry(1500, 3));
+    board.insert(Entry(1100, 4));
+    board.insert(Entry( 700, 5));
+//..
+// Then, we find the position (counting from 0) of player 4, whose entry is
+// preceded by those of players 3 and 1:
+//..
+    ASSERT(2 == board.rank(Entry(1100, 4)));
+//..
+// Next, player 5 scores 600 points; we replace the entry of that player,
+// which moves from last place to second place:
+//..
+    board.erase(Entry(700, 5));
+    board.insert(Entry(1300, 5));
+    ASSERT(1 == board.rank(Entry(1300, 5)));
+//..
+// Then, we display the page of the board holding positions 2 through 3,
+// which we locate directly, without walking past the entries before it:
+//..
+    Leaderboard::const_iterator it = board.select(2);
+    ASSERT(1 == it->second);
+    ++it;
+    ASSERT(4 == it->second);
+//..
+// Finally, we count the number of players whose scores lie in the range
+// '[900 .. 1300]', using the entries bounding that range on the board:
+//..
+    Leaderboard::const_iterator first = board.lower_bound(Entry(1300, 0));
+    Leaderboard::const_iterator last  = board.lower_bound(Entry( 899, 0));
+    ASSERT(4 == board.distance(first, last));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND ALLOCATORS
+        //
+        // Concerns:
+        //: 1 A copy has the same value, and correct subtree sizes, whether or
+        //:   not an allocator is supplied.
+        //:
+        //: 2 A copy made without an allocator uses the default allocator.
+        //:
+        //: 3 Assignment and swap exchange values (and counts) between objects
+        //:   using the same or different allocators, without affecting their
+        //:   allocators.
+        //:
+        //: 4 The comparison operators compare the sequences of keys.
+        //:
+        //: 5 All memory is supplied by the object's allocator, and is
+        //:   returned on destruction.
+        //:
+        //: 6 Every element is destroyed by 'clear', 'erase', and the
+        //:   destructor, when the elements are not trivially copyable.
+        //
+        // Plan:
+        //: 1 Using objects of varying sizes created with test allocators,
+        //:   verify copies, assigned objects, and swapped objects against the
+        //:   reference model, and verify the memory usage of the allocators
+        //:   involved.  (C-1..5)
+        //:
+        //: 2 Fill, copy, partially erase, clear, and destroy ranked sets of
+        //:   'CountedInt', and verify the number of live objects at each step.
+        //:   (C-6)
+        //
+        // Testing:
+        //   RankedSet(const COMPARATOR&, const ALLOCATOR&);
+        //   RankedSet(const ALLOCATOR&);
+        //   RankedSet(const RankedSet& original);
+        //   RankedSet(const RankedSet& original, const ALLOCATOR& allocator);
+        //   ~RankedSet();
+        //   RankedSet& operator=(const RankedSet& rhs);
+        //   void swap(RankedSet& other);
+        //   void clear();
+        //   bool operator==(const RankedSet& lhs, const RankedSet& rhs);
+        //   bool operator!=(const RankedSet& lhs, const RankedSet& rhs);
+        //   bool operator< (const RankedSet& lhs, const RankedSet& rhs);
+        //   void swap(RankedSet& a, RankedSet& b);
+        //   CONCERN: The object allocates memory only from its allocator.
+        //   CONCERN: All elements are destroyed.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, ASSIGNMENT, SWAP, AND ALLOCATORS"
+                            "\n======================================\n");
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) printf("\tCopy construction.\n");
+
+        const int SIZES[] = { 0, 1, 2, 3, 5, 8, 17, 64, 200 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Model model(&za);
+            Obj   mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                const int V = nextRandom(4 * SIZE);
+                mX.insert(V);
+                modelInsert(&model, V);
+            }
+            LOOP_ASSERT(SIZE, matchesModel(X, model));
+            LOOP_ASSERT(SIZE, 0 == da.numBlocksInUse());
+
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                LOOP_ASSERT(SIZE, matchesModel(Y, model));
+                LOOP_ASSERT(SIZE, X == Y);
+                LOOP_ASSERT(SIZE, !(X != Y));
+                LOOP_ASSERT(SIZE, &da == Y.get_allocator().mechanism());
+                LOOP_ASSERT(SIZE, (0 == SIZE) == (0 == da.numBlocksInUse()));
+
+                Obj mZ(X, &za);  const Obj& Z = mZ;
+                LOOP_ASSERT(SIZE, matchesModel(Z, model));
+                LOOP_ASSERT(SIZE, &za == Z.get_allocator().mechanism());
+
+                // Modifying a copy leaves the counts of the original intact.
+
+                if (SIZE) {
+                    mY.erase(mY.select(SIZE / 2));
+                    LOOP_ASSERT(SIZE, X != Y);
+                    LOOP_ASSERT(SIZE, Y < X || X < Y);
+                    LOOP_ASSERT(SIZE, matchesModel(X, model));
+                }
+            }
+            LOOP_ASSERT(SIZE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAssignment and swap.\n");
+
+        const bsls::Types::Int64 NUM_DA = da.numBlocksTotal();
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int ISIZE = SIZES[ti];
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int JSIZE = SIZES[tj];
+
+                Model mI(&za), mJ(&za);
+                Obj   mX(&oa);  const Obj& X = mX;
+                Obj   mY(&oa);  const Obj& Y = mY;
+                Obj   mZ(&za);  const Obj& Z = mZ;
+                for (int i = 0; i < ISIZE; ++i) {
+                    mX.insert(2 * i);
+                    modelInsert(&mI, 2 * i);
+                }
+                for (int j = 0; j < JSIZE; ++j) {
+                    mY.insert(3 * j);
+                    mZ.insert(3 * j);
+                    modelInsert(&mJ, 3 * j);
+                }
+
+                const bsls::Types::Int64 NUM_OA = oa.numBlocksTotal();
+
+                mX.swap(mY);
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(X, mJ));
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(Y, mI));
+                LOOP2_ASSERT(ISIZE, JSIZE, NUM_OA == oa.numBlocksTotal());
+
+                swap(mX, mY);
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(X, mI));
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(Y, mJ));
+                LOOP2_ASSERT(ISIZE, JSIZE, NUM_OA == oa.numBlocksTotal());
+
+                mX.swap(mZ);
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(X, mJ));
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(Z, mI));
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &oa == X.get_allocator().mechanism());
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &za == Z.get_allocator().mechanism());
+
+                mX = Z;
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(X, mI));
+                LOOP2_ASSERT(ISIZE, JSIZE, X == Z);
+                LOOP2_ASSERT(ISIZE, JSIZE,
+                             &oa == X.get_allocator().mechanism());
+
+                mX = X;
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(X, mI));
+
+                mZ = Y;
+                LOOP2_ASSERT(ISIZE, JSIZE, matchesModel(Z, mJ));
+
+                mX.clear();
+                LOOP2_ASSERT(ISIZE, JSIZE, X.empty());
+                LOOP2_ASSERT(ISIZE, JSIZE, X.end() == X.select(0));
+                mX.insert(7);
+                LOOP2_ASSERT(ISIZE, JSIZE, 0 == X.rank(7));
+                LOOP2_ASSERT(ISIZE, JSIZE, 1 == X.rank(8));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+        ASSERT(NUM_DA == da.numBlocksTotal());
+
+        if (verbose) printf("\tElement destruction.\n");
+
+        {
+            typedef bslstl::RankedSet<CountedInt> CObj;
+
+            CObj mX(&oa);  const CObj& X = mX;
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(CountedInt((i * 37) % 100));
+            }
+            ASSERT(100 == numLiveCounted);
+            ASSERT(50  == X.rank(CountedInt(50)));
+            ASSERT(50  == X.select(50)->value());
+            {
+                CObj mY(X);  const CObj& Y = mY;
+                ASSERT(200 == numLiveCounted);
+                ASSERT(X == Y);
+                ASSERT(17 == Y.select(17)->value());
+
+                mY.erase(mY.select(10), mY.select(20));
+                ASSERT(190 == numLiveCounted);
+                ASSERT(90  == Y.size());
+                ASSERT(25  == Y.select(15)->value());
+                ASSERT(15  == Y.rank(CountedInt(25)));
+            }
+            ASSERT(100 == numLiveCounted);
+
+            mX.clear();
+            ASSERT(0 == numLiveCounted);
+
+            mX.insert(CountedInt(3));
+            ASSERT(1 == numLiveCounted);
+        }
+        ASSERT(0 == numLiveCounted);
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // MODIFICATION AND ORDER STATISTICS
+        //
+        // Concerns:
+        //: 1 Every form of 'insert' and 'erase' leaves the ranked set holding
+        //:   the expected sequence of keys.
+        //:
+        //: 2 After every modification, 'rank', 'select', and 'distance' agree
+        //:   with the positions of the keys in the sequence.
+        //:
+        //: 3 'rank' of an absent key is the position at which it would be
+        //:   inserted.
+        //:
+        //: 4 The range constructor and range 'insert' ignore duplicates.
+        //
+        // Plan:
+        //: 1 Apply long pseudo-random sequences of insertions and removals,
+        //:   using every form of 'insert' and 'erase', to a ranked set and to
+        //:   a sorted 'bsl::vector' reference model, and verify, periodically
+        //:   and at the end, that all queries are consistent with the model.
+        //:   (C-1..3)
+        //:
+        //: 2 Construct and extend ranked sets from sequences with duplicates,
+        //:   and verify them against the model.  (C-4)
+        //
+        // Testing:
+        //   RankedSet(INPUT_ITERATOR, INPUT_ITERATOR, const COMPARATOR&, ...);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   iterator insert(const_iterator hint, const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator erase(const_iterator position);
+        //   size_type erase(const key_type& key);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator select(size_type index);
+        //   size_type rank(const key_type& key) const;
+        //   const_iterator select(size_type index) const;
+        //   difference_type distance(const_iterator, const_iterator) const;
+        //   iterator find(const key_type& key);
+        //   size_type count(const key_type& key) const;
+        //   pair<iterator, iterator> equal_range(const key_type& key);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMODIFICATION AND ORDER STATISTICS"
+                            "\n=================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVerbose);
+
+        if (verbose) printf("\tRange construction and insertion.\n");
+        {
+            const int DATA[] = { 5, 3, 9, 3, 1, 5, 7, 9, 0, 2 };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            Model model(&sa);
+            for (int i = 0; i < NUM_DATA; ++i) {
+                modelInsert(&model, DATA[i]);
+            }
+
+            Obj mX(DATA, DATA + NUM_DATA, std::less<int>(), &oa);
+            const Obj& X = mX;
+            ASSERT(matchesModel(X, model));
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.insert(DATA, DATA + NUM_DATA);
+            ASSERT(matchesModel(Y, model));
+
+            // Inserting an ordered sequence uses the 'end()' hint.
+
+            Model ordered(&sa);
+            for (int i = 0; i < 100; ++i) {
+                ordered.push_back(i);
+            }
+            Obj mZ(ordered.begin(), ordered.end(), std::less<int>(), &oa);
+            ASSERT(matchesModel(mZ, ordered));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tRandom modification.\n");
+
+        const int RANGES[] = { 1, 2, 8, 50, 300 };
+        const int NUM_RANGES = sizeof RANGES / sizeof *RANGES;
+
+        srand(1);
+        for (int ti = 0; ti < NUM_RANGES; ++ti) {
+            const int RANGE = RANGES[ti];
+
+            Model model(&sa);
+            Obj   mX(&oa);  const Obj& X = mX;
+
+            for (int op = 0; op < 20 * RANGE + 50; ++op) {
+                const int V = nextRandom(RANGE);
+                Model::iterator mit = std::lower_bound(model.begin(),
+                                                       model.end(),
+                                                       V);
+                const bool PRESENT = mit != model.end() && *mit == V;
+
+                LOOP2_ASSERT(RANGE, op,
+                             PRESENT == (1 == X.count(V)));
+                LOOP2_ASSERT(RANGE, op,
+                             PRESENT == (X.find(V) != X.end()));
+                LOOP2_ASSERT(RANGE, op,
+                             mit - model.begin()
+                                          == static_cast<int>(X.rank(V)));
+                {
+                    bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                          mX.equal_range(V);
+                    LOOP2_ASSERT(RANGE, op,
+                                 (PRESENT ? 1 : 0) == X.distance(R.first,
+                                                                 R.second));
+                }
+
+                switch (nextRandom(6)) {
+                  case 0: {
+                    bsl::pair<Obj::iterator, bool> R = mX.insert(V);
+                    LOOP2_ASSERT(RANGE, op, V == *R.first);
+                    LOOP2_ASSERT(RANGE, op, !PRESENT == R.second);
+                    modelInsert(&model, V);
+                  } break;
+                  case 1: {
+                    // Insert with a hint that is correct only sometimes.
+
+                    Obj::const_iterator hint =
+                                     X.select(nextRandom(
+                                          static_cast<int>(X.size()) + 1));
+                    Obj::iterator it = mX.insert(hint, V);
+                    LOOP2_ASSERT(RANGE, op, V == *it);
+                    modelInsert(&model, V);
+                  } break;
+                  case 2: {
+                    LOOP2_ASSERT(RANGE, op,
+                                 (PRESENT ? 1u : 0u) == mX.erase(V));
+                    if (PRESENT) {
+                        model.erase(mit);
+                    }
+                  } break;
+                  case 3: {
+                    if (X.empty()) {
+                        break;
+                    }
+                    const int INDEX = nextRandom(
+                                               static_cast<int>(X.size()));
+                    Obj::iterator it = mX.erase(mX.select(INDEX));
+                    LOOP2_ASSERT(RANGE, op, mX.select(INDEX) == it);
+                    model.erase(model.begin() + INDEX);
+                  } break;
+                  case 4: {
+                    if (X.size() < 2 || nextRandom(4)) {
+                        break;
+                    }
+                    const int SIZE = static_cast<int>(X.size());
+                    const int A    = nextRandom(SIZE + 1);
+                    const int B    = A + nextRandom(SIZE + 1 - A) / 2;
+                    Obj::iterator it = mX.erase(X.select(A), X.select(B));
+                    LOOP2_ASSERT(RANGE, op, mX.select(A) == it);
+                    model.erase(model.begin() + A, model.begin() + B);
+                  } break;
+                  default: {
+                    mX.insert(V + RANGE);
+                    modelInsert(&model, V + RANGE);
+                  } break;
+                }
+
+                if (0 == op % 16) {
+                    LOOP2_ASSERT(RANGE, op, matchesModel(X, model));
+                }
+            }
+            LOOP_ASSERT(RANGE, matchesModel(X, model));
+
+            if (veryVerbose) {
+                T_ P_(RANGE) P(X.size())
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert and erase a handful of keys, and verify the
+        //:   order-statistic queries by hand.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.empty());
+        ASSERT(0 == X.rank(5));
+        ASSERT(X.end() == X.select(0));
+        ASSERT(0 == X.distance(X.begin(), X.end()));
+
+        for (int i = 10; i > 0; --i) {
+            ASSERT(mX.insert(i * 10).second);
+        }
+        ASSERT(!mX.insert(50).second);
+        ASSERT(10 == X.size());
+
+        ASSERT(0  == X.rank(10));
+        ASSERT(4  == X.rank(50));
+        ASSERT(5  == X.rank(55));
+        ASSERT(10 == X.rank(1000));
+        ASSERT(10 == *X.select(0));
+        ASSERT(70 == *X.select(6));
+        ASSERT(100 == *X.select(9));
+        ASSERT(X.end() == X.select(10));
+        ASSERT(10 == X.distance(X.begin(), X.end()));
+        ASSERT(-3 == X.distance(X.find(80), X.find(50)));
+
+        ASSERT(1 == mX.erase(30));
+        ASSERT(0 == mX.erase(30));
+        ASSERT(3 == X.rank(50));
+        ASSERT(40 == *X.select(2));
+        ASSERT(9 == X.distance(X.begin(), X.end()));
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(X.end() == X.select(0));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'rank' AND 'distance' VS. 'bsl::set'
+        //
+        // Concerns:
+        //: 1 'rank' and 'distance' are substantially faster than computing
+        //:   positions with 'bsl::distance' on a 'bsl::set'.
+        //:
+        //: 2 The cost of maintaining the counts on insertion and removal is
+        //:   modest relative to 'bsl::set'.
+        //
+        // Plan:
+        //: 1 Using 'bsls::Stopwatch', time the insertion of 'N' shuffled keys
+        //:   (where 'N' is optionally given as the second argument), the
+        //:   computation of the position of 1000 keys, and the removal of all
+        //:   keys, for both a 'RankedSet' and a 'bsl::set'.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE: 'rank' and 'distance' vs. 'bsl::set'
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: 'rank' AND 'distance' VS. 'bsl::set'"
+               "\n=================================================\n");
+
+        const int N = argc > 2 ? atoi(argv[2]) : 100000;
+        const int NUM_QUERIES = 1000;
+
+        bslma::Allocator *alloc = &bslma::NewDeleteAllocator::singleton();
+
+        Model keys(alloc);
+        for (int i = 0; i < N; ++i) {
+            keys.push_back(i);
+        }
+        std::random_shuffle(keys.begin(), keys.end());
+
+        bsls::Stopwatch timer;
+        long            checksum = 0;
+
+        {
+            bsl::set<int> mX(alloc);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < N; ++i) {
+                mX.insert(keys[i]);
+            }
+            timer.stop();
+            printf("bsl::set:           insert %8.2f ms\n",
+                   timer.elapsedTime() * 1000);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                checksum += bsl::distance(mX.begin(),
+                                          mX.lower_bound(keys[i]));
+            }
+            timer.stop();
+            printf("bsl::set:           %d x distance %8.2f ms\n",
+                   NUM_QUERIES,
+                   timer.elapsedTime() * 1000);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < N; ++i) {
+                mX.erase(keys[i]);
+            }
+            timer.stop();
+            printf("bsl::set:           erase  %8.2f ms\n",
+                   timer.elapsedTime() * 1000);
+        }
+        {
+            Obj mX(alloc);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < N; ++i) {
+                mX.insert(keys[i]);
+            }
+            timer.stop();
+            printf("bslstl::RankedSet:  insert %8.2f ms\n",
+                   timer.elapsedTime() * 1000);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < NUM_QUERIES; ++i) {
+                checksum -= mX.rank(keys[i]);
+            }
+            timer.stop();
+            printf("bslstl::RankedSet:  %d x rank     %8.2f ms\n",
+                   NUM_QUERIES,
+                   timer.elapsedTime() * 1000);
+
+            timer.reset();  timer.start();
+            for (int i = 0; i < N; ++i) {
+                mX.erase(keys[i]);
+            }
+            timer.stop();
+            printf("bslstl::RankedSet:  erase  %8.2f ms\n",
+                   timer.elapsedTime() * 1000);
+        }
+        ASSERT(0 == checksum);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+// ----------------------------------------------------------------------------
+// Copyright (C) 2013 Bloomberg L.P.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------- END-OF-FILE ----------------------------------
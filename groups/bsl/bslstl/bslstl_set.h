@@ -517,6 +517,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
 #ifndef INCLUDED_FUNCTIONAL
 #include <functional>
 #define INCLUDED_FUNCTIONAL
@@ -727,7 +731,9 @@ class set {
         // (see {Requirements on 'KEY'}).
 
     ~set();
-        // Destroy this object.
+        // Destroy this object.  If 'value_type' is trivially copyable (and
+        // so need not be destroyed), the memory of all nodes is returned to
+        // the allocator at once, without visiting each node.
 
     // MANIPULATORS
     set& operator=(const set& rhs);
@@ -831,7 +837,10 @@ class set {
 
     void clear();
         // Remove all entries from this set.  Note that the set is empty after
-        // this call, but allocated memory may be retained for future use.
+        // this call, but allocated memory may be retained for future use.  If
+        // 'value_type' is trivially copyable (and so need not be destroyed),
+        // the nodes are returned to the pool at once, without visiting each
+        // node.
 
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
@@ -1292,7 +1301,15 @@ template <class KEY, class COMPARATOR, class ALLOCATOR>
 inline
 set<KEY, COMPARATOR, ALLOCATOR>::~set()
 {
-    clear();
+    if (bsl::is_trivially_copyable<ValueType>::value) {
+        // The elements need not be destroyed, so release the nodes wholesale
+        // rather than walking the tree.
+
+        nodeFactory().release();
+    }
+    else {
+        clear();
+    }
 }
 
 // MANIPULATORS
@@ -1493,7 +1510,21 @@ void set<KEY, COMPARATOR, ALLOCATOR>::clear()
         BSLS_ASSERT_SAFE(0 < d_tree.numNodes());
         BSLS_ASSERT_SAFE(d_tree.firstNode() != d_tree.sentinel());
 
-        BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
+        if (bsl::is_trivially_copyable<ValueType>::value
+         && nodeFactory().capacity() <= 2 * size()) {
+            // The elements need not be destroyed, and account for at least
+            // half of the pool, so return the nodes to the pool wholesale
+            // rather than walking the tree.  Rewinding visits every block the
+            // pool holds, so a tree that has shrunk well below the pool's
+            // peak size is cheaper to delete node by node.
+
+            nodeFactory().rewind();
+            d_tree.reset(0, d_tree.sentinel(), 0);
+        }
+        else {
+            BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree,
+                                                        &nodeFactory());
+        }
     }
 #if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
     else {
@@ -20,7 +20,9 @@ BSLS_IDENT("$Id: $")
 // with a object of 'bslstl::TreeNode' type holding a object of 'KEY' type.
 // Note that this functor was designed to be supplied to functions in
 // 'bslalg::RbTreeUtil' primarily for the purpose of implementing a 'set'
-// container.
+// container.  A container using a node type other than 'bslstl::TreeNode'
+// (but likewise providing a 'value' method) may supply that type as the
+// optional 'NODE' parameter.
 //
 ///Usage
 ///-----
@@ -144,7 +146,7 @@ namespace bslstl {
                        // class SetComparator
                        // ===================
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE = TreeNode<KEY> >
 #ifdef BSLS_PLATFORM_CMP_MSVC
 // Visual studio compiler fails to resolve the conversion operator in
 // 'bslalg::FunctorAdapter_FunctionPointer' when using private inheritance.
@@ -157,7 +159,8 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
     // This class overloads the function-call operator to compare a referenced
     // 'bslalg::RbTreeNode' object with a object of the parameterized 'KEY'
     // type, assuming the reference to 'bslalg::RbTreeNode' is a base of a
-    // 'bslstl::TreeNode' holding an integer, using a functor of the
+    // node of the parameterized 'NODE' type (by default, 'bslstl::TreeNode')
+    // whose 'value' method returns the 'KEY' object, using a functor of the
     // parameterized 'COMPARATOR' type.
 
   private:
@@ -168,7 +171,7 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
 
   public:
     // TYPES
-    typedef TreeNode<KEY> NodeType;
+    typedef NODE NodeType;
         // This alias represents the type of node holding a 'KEY' object.
 
     // CREATORS
@@ -239,9 +242,9 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
 
 
 // FREE FUNCTIONS
-template <class KEY,  class COMPARATOR>
-void swap(SetComparator<KEY, COMPARATOR>& a,
-          SetComparator<KEY, COMPARATOR>& b);
+template <class KEY, class COMPARATOR, class NODE>
+void swap(SetComparator<KEY, COMPARATOR, NODE>& a,
+          SetComparator<KEY, COMPARATOR, NODE>& b);
     // Efficiently exchange the values of the specified 'a' and 'b' objects.
     // This function provides the no-throw exception-safety guarantee.
 
@@ -254,34 +257,34 @@ void swap(SetComparator<KEY, COMPARATOR>& a,
                     // -------------------
 
 // CREATORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-SetComparator<KEY, COMPARATOR>::SetComparator()
+SetComparator<KEY, COMPARATOR, NODE>::SetComparator()
 : bslalg::FunctorAdapter<COMPARATOR>::Type()
 {
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-SetComparator<KEY, COMPARATOR>::
+SetComparator<KEY, COMPARATOR, NODE>::
 SetComparator(const COMPARATOR& valueComparator)
 : bslalg::FunctorAdapter<COMPARATOR>::Type(valueComparator)
 {
 }
 
 // MANIPULATORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const KEY&                lhs,
                                            const bslalg::RbTreeNode& rhs)
 {
     return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const bslalg::RbTreeNode& lhs,
                                            const KEY&                rhs)
 
@@ -289,10 +292,10 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-void SetComparator<KEY, COMPARATOR>::swap(
-                                         SetComparator<KEY, COMPARATOR>& other)
+void SetComparator<KEY, COMPARATOR, NODE>::swap(
+                                   SetComparator<KEY, COMPARATOR, NODE>& other)
 {
     bslalg::SwapUtil::swap(
       static_cast<typename bslalg::FunctorAdapter<COMPARATOR>::Type*>(this),
@@ -301,18 +304,18 @@ void SetComparator<KEY, COMPARATOR>::swap(
 }
 
 // ACCESSORS
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const KEY&                lhs,
                                            const bslalg::RbTreeNode& rhs) const
 {
     return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-bool SetComparator<KEY, COMPARATOR>::operator()(
+bool SetComparator<KEY, COMPARATOR, NODE>::operator()(
                                            const bslalg::RbTreeNode& lhs,
                                            const KEY&                rhs) const
 
@@ -320,25 +323,25 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator()
+COMPARATOR& SetComparator<KEY, COMPARATOR, NODE>::keyComparator()
 {
     return *this;
 }
 
-template <class KEY, class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-const COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator() const
+const COMPARATOR& SetComparator<KEY, COMPARATOR, NODE>::keyComparator() const
 {
     return *this;
 }
 
 // FREE FUNCTIONS
-template <class KEY,  class COMPARATOR>
+template <class KEY, class COMPARATOR, class NODE>
 inline
-void swap(SetComparator<KEY, COMPARATOR>& a,
-          SetComparator<KEY, COMPARATOR>& b)
+void swap(SetComparator<KEY, COMPARATOR, NODE>& a,
+          SetComparator<KEY, COMPARATOR, NODE>& b)
 {
     a.swap(b);
 }
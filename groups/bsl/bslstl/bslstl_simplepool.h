@@ -213,6 +213,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_swaputil.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_CONDITIONAL
+#include <bslmf_conditional.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
 #include <bsls_alignmentfromtype.h>
 #endif
@@ -237,21 +241,37 @@ namespace bslstl {
                        // struct SimplePool_Type
                        // ======================
 
-template <class ALLOCATOR>
+template <class VALUE, class ALLOCATOR>
 struct SimplePool_Type {
     // For use only by 'bslstl::SimplePool'.  This 'struct' provides a
     // namespace for a set of types used to define the base-class of a
     // 'SimplePool'.  The parameterized 'ALLOCATOR' is bound to
-    // 'MaxAlignedType' to ensure the allocated memory is maximally aligned.
+    // 'MaxAlignedType' to ensure the allocated memory is maximally aligned,
+    // unless the alignment of the parameterized 'VALUE' exceeds the maximal
+    // alignment, in which case 'ALLOCATOR' is bound to 'VALUE' itself so that
+    // the allocator supplies memory suitably aligned for 'VALUE'.
+
+    enum {
+        VALUE_ALIGNMENT = bsls::AlignmentFromType<VALUE>::VALUE,
+            // alignment of 'VALUE'
+
+        MAX_ALIGNMENT   = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+            // maximal alignment of a fundamental type
+    };
+
+    typedef typename bsl::conditional<(VALUE_ALIGNMENT > MAX_ALIGNMENT),
+                                      VALUE,
+                                      bsls::AlignmentUtil::MaxAlignedType>
+                                                        ::type UnitType;
+        // Alias for the type in units of which memory is requested from the
+        // allocator.
 
     typedef typename bsl::allocator_traits<ALLOCATOR>::template
-            rebind_traits<bsls::AlignmentUtil::MaxAlignedType> AllocatorTraits;
-        // Alias for the allocator traits rebound to allocate
-        // 'bsls::AlignmentUtil::MaxAlignedType'.
+                                     rebind_traits<UnitType> AllocatorTraits;
+        // Alias for the allocator traits rebound to allocate 'UnitType'.
 
     typedef typename AllocatorTraits::allocator_type AllocatorType;
-        // Alias for the allocator type for
-        // 'bsls::AlignmentUtil::MaxAlignedType'.
+        // Alias for the allocator type for 'UnitType'.
 };
 
                        // ================
@@ -259,7 +279,7 @@ struct SimplePool_Type {
                        // ================
 
 template <class VALUE, class ALLOCATOR>
-class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
+class SimplePool : public SimplePool_Type<VALUE, ALLOCATOR>::AllocatorType {
     // This class provides methods for creating and deleting nodes using the
     // appropriate allocator-traits of the parameterized 'ALLOCATOR'.
     // This type is intended to be used as a private base-class for a
@@ -269,7 +289,7 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     // 'bslma::Allocator').
 
     // PRIVATE TYPES
-    typedef SimplePool_Type<ALLOCATOR> Types;
+    typedef SimplePool_Type<VALUE, ALLOCATOR> Types;
 
     union Block {
         // This 'union' implements a link data structure with the size no
@@ -286,16 +306,50 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
+    union Chunk;
+
+    struct ChunkHeader {
+        // This 'struct' holds the link to the next chunk in the list of
+        // managed chunks, and the size of the chunk, so that the chunk can be
+        // returned to the allocator with its size.
+
+        Chunk       *d_next_p;    // pointer to next Chunk
+
+        std::size_t  d_numUnits;  // size of this chunk, as the number of
+                                  // objects of the allocator's value type
+                                  // that were allocated
+    };
+
     union Chunk {
         // This 'union' prepends to the beginning of each managed block of
         // allocated memory, implementing a singly-linked list of managed
         // chunks, and thereby enabling constant-time additions to the list of
         // chunks.
 
-        Chunk *d_next_p;  // pointer to next Chunk
+        ChunkHeader d_header;     // link to next Chunk and size of this one
 
         typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
+                                  // ensure each block is correctly aligned
+    };
+
+    enum {
+        VALUE_ALIGNMENT = static_cast<int>(
+                                       bsls::AlignmentFromType<VALUE>::VALUE),
+            // alignment of 'VALUE'
+
+        LINK_ALIGNMENT  = static_cast<int>(
+                                       bsls::AlignmentFromType<Block>::VALUE),
+            // alignment of 'Block', which is at least that of a pointer
+
+        BLOCK_ALIGNMENT = VALUE_ALIGNMENT > LINK_ALIGNMENT
+                        ? VALUE_ALIGNMENT
+                        : LINK_ALIGNMENT,
+            // alignment of each block, which exceeds the alignment of 'Block'
+            // if 'VALUE' is over-aligned
+
+        HEADER_SIZE     = (sizeof(Chunk) + BLOCK_ALIGNMENT - 1)
+                        / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT
+            // offset of the first block in a chunk
     };
 
   private:
@@ -306,6 +360,10 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     int    d_blocksPerChunk;  // current chunk size (in blocks-per-chunk)
 
+    std::size_t
+           d_numBlocks;       // number of blocks, free or outstanding, carved
+                              // from the chunks in 'd_chunkList_p'
+
   private:
     // NOT IMPLEMENTED
     SimplePool& operator=(const SimplePool&);
@@ -330,7 +388,8 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     typedef typename Types::AllocatorType AllocatorType;
         // Alias for the allocator type for a
-        // 'bsls::AlignmentUtil::MaxAlignedType'.
+        // 'bsls::AlignmentUtil::MaxAlignedType' (or, if 'VALUE' is
+        // over-aligned, for 'VALUE').
 
     typedef typename Types::AllocatorTraits AllocatorTraits;
         // Alias for the allocator traits for the parameterized
@@ -374,6 +433,19 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     void release();
         // Relinquish all memory currently allocated via this pool object.
 
+    void rewind();
+        // Return every memory block to the free list of this pool, as if each
+        // outstanding block had been deallocated, retaining all of the chunks
+        // currently held by this pool.  The free list is rebuilt in address
+        // order within each chunk, in time proportional to the number of
+        // blocks held by this pool, without visiting the outstanding blocks
+        // individually.  The behavior is undefined if any outstanding block is
+        // used after this call.  Note that the cost of this method grows with
+        // 'capacity()' rather than with the number of outstanding blocks, so
+        // a client should prefer deallocating the outstanding blocks
+        // individually unless they account for a large fraction of
+        // 'capacity()'.
+
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
         // the specified 'other' object.  This method provides the no-throw
@@ -397,7 +469,9 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
         // allocator traits for the node-type.  Note that this operation
         // returns a base-class ('AllocatorType') reference to this object.
 
-
+    std::size_t capacity() const;
+        // Return the number of memory blocks, both free and outstanding, held
+        // by this pool.
 };
 
 // ============================================================================
@@ -410,23 +484,27 @@ typename SimplePool<VALUE, ALLOCATOR>::Block *
 SimplePool<VALUE, ALLOCATOR>::allocateChunk(std::size_t size)
 {
     // Determine the number of bytes we want to allocate and compute the number
-    // of 'MaxAlignedType' needed to contain those bytes.
+    // of 'UnitType' objects (i.e., 'MaxAlignedType', unless 'VALUE' is
+    // over-aligned) needed to contain those bytes.
 
-    std::size_t numBytes = sizeof (Chunk) + size;
-    std::size_t numMaxAlignedType =
-                       (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
-                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    typedef typename Types::UnitType UnitType;
+
+    std::size_t numBytes = HEADER_SIZE + size;
+    std::size_t numUnits = (numBytes + sizeof(UnitType) - 1)
+                         / sizeof(UnitType);
 
     Chunk *chunkPtr = reinterpret_cast<Chunk *>(
-                    AllocatorTraits::allocate(allocator(), numMaxAlignedType));
+                             AllocatorTraits::allocate(allocator(), numUnits));
 
     BSLS_ASSERT_SAFE(0 ==
-             reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
+           reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % BLOCK_ALIGNMENT);
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    chunkPtr->d_header.d_next_p   = d_chunkList_p;
+    chunkPtr->d_header.d_numUnits = numUnits;
+    d_chunkList_p                 = chunkPtr;
 
-    return reinterpret_cast<Block *>(chunkPtr + 1);
+    return reinterpret_cast<Block *>(reinterpret_cast<char *>(chunkPtr)
+                                                                + HEADER_SIZE);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -450,6 +528,7 @@ SimplePool<VALUE, ALLOCATOR>::SimplePool(const ALLOCATOR& allocator)
 , d_chunkList_p(0)
 , d_freeList_p(0)
 , d_blocksPerChunk(1)
+, d_numBlocks(0)
 {
 }
 
@@ -500,6 +579,7 @@ void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
     std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
     std::swap(d_freeList_p, other.d_freeList_p);
     std::swap(d_chunkList_p, other.d_chunkList_p);
+    std::swap(d_numBlocks, other.d_numBlocks);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -519,6 +599,7 @@ void SimplePool<VALUE, ALLOCATOR>::quickSwapExchangeAllocators(
     std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
     std::swap(d_freeList_p, other.d_freeList_p);
     std::swap(d_chunkList_p, other.d_chunkList_p);
+    std::swap(d_numBlocks, other.d_numBlocks);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -534,6 +615,7 @@ void SimplePool<VALUE, ALLOCATOR>::reserve(std::size_t numBlocks)
     }
     end->d_next_p = d_freeList_p;
     d_freeList_p  = begin;
+    d_numBlocks  += numBlocks;
 }
 
 // ACCESSORS
@@ -545,6 +627,13 @@ SimplePool<VALUE, ALLOCATOR>::allocator() const
     return *this;
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+std::size_t SimplePool<VALUE, ALLOCATOR>::capacity() const
+{
+    return d_numBlocks;
+}
+
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::release()
 {
@@ -552,10 +641,42 @@ void SimplePool<VALUE, ALLOCATOR>::release()
         typename AllocatorTraits::value_type *lastChunk =
                       reinterpret_cast<typename AllocatorTraits::value_type *>(
                                                                 d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+        const std::size_t numUnits = d_chunkList_p->d_header.d_numUnits;
+        d_chunkList_p = d_chunkList_p->d_header.d_next_p;
+        AllocatorTraits::deallocate(allocator(), lastChunk, numUnits);
     }
     d_freeList_p = 0;
+    d_numBlocks  = 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::rewind()
+{
+    typedef typename Types::UnitType UnitType;
+
+    Block       *freeList    = 0;
+    std::size_t  totalBlocks = 0;
+    Chunk       *chunk       = d_chunkList_p;
+    while (chunk) {
+        const std::size_t numBlocks =
+                  (chunk->d_header.d_numUnits * sizeof(UnitType) - HEADER_SIZE)
+                / sizeof(Block);
+
+        Block *begin = reinterpret_cast<Block *>(
+                                reinterpret_cast<char *>(chunk) + HEADER_SIZE);
+        Block *end   = begin + numBlocks - 1;
+
+        for (Block *p = begin; p < end; ++p) {
+            p->d_next_p = p + 1;
+        }
+        end->d_next_p = freeList;
+        freeList      = begin;
+        totalBlocks  += numBlocks;
+
+        chunk = chunk->d_header.d_next_p;
+    }
+    d_freeList_p = freeList;
+    d_numBlocks  = totalBlocks;  // includes any padding left by 'reserve'
 }
 
 }  // close namespace bslstl
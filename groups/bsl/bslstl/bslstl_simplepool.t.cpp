@@ -11,8 +11,10 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_alignmentfromtype.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
 
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_stdtestallocator.h>
@@ -48,14 +50,17 @@ using namespace bslstl;
 // [ 5] void deallocate(void *address);
 // [ 6] void reserve(std::size_t numBlocks);
 // [ 7] void release();
+// [11] void rewind();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
+// [11] std::size_t capacity() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
+// [10] CONCERN: Over-aligned 'VALUE' types are supported
 // [ 3] TEST APPARATUS
 
 //=============================================================================
@@ -139,6 +144,14 @@ struct TestType3 {
     char   x1[5];
 };
 
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+struct TestType4 {
+    // Over-aligned type, whose alignment exceeds that of every primitive type.
+
+    char   x1[24] __attribute__((__aligned__(64)));
+};
+#endif
+
 // Define all the types that is used for each test case.
 
 #define TEST_TYPES  int, \
@@ -213,6 +226,16 @@ class Stack {
     int size() { return d_size; }
         // Return the number of elements in the container.
 
+    void *operator[](int index)
+        // Return the value at the specified 'index' from the bottom of the
+        // stack.  The behavior is undefined unless '0 <= index < size()'.
+    {
+        BSLS_ASSERT(0 <= index);
+        BSLS_ASSERT(index < d_size);
+
+        return d_data[index];
+    }
+
     void *top()
         // Return the top value in the stack.
     {
@@ -258,6 +281,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase11();
+        // Test 'rewind'.
+
     static void testCase10();
         // Test usage example.
 
@@ -575,6 +601,173 @@ void TestDriver<VALUE>::testCase8()
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase11()
+{
+    // ------------------------------------------------------------------------
+    // MANIPULATOR 'rewind'
+    //
+    // Concerns:
+    //: 1 'rewind' neither allocates nor deallocates memory.
+    //:
+    //: 2 After a 'rewind', every block allocated before the 'rewind', whether
+    //:   it was in the free list or in use, is available without allocating
+    //:   memory from the heap.
+    //:
+    //: 3 After a 'rewind', the blocks of a chunk are supplied in increasing
+    //:   address order.
+    //:
+    //: 4 'capacity' reports the number of blocks carved from the chunks held
+    //:   by the pool, is not reduced by 'rewind', and is reset by 'release'.
+    //:
+    //: 5 Memory is deallocated on the destruction of the object.
+    //
+    // Plan:
+    //: 1 Invoke 'allocate' and 'deallocate' various number of time.
+    //:
+    //:   1 Call 'rewind' and verify no memory is allocated or deallocated,
+    //:     and that 'capacity' is not reduced.  (C-1, 4)
+    //:
+    //:   2 Call 'allocate' as many times as 'allocate' was originally called
+    //:     and verify that no memory is allocated from the heap, and that
+    //:     each block is distinct.  (C-2)
+    //:
+    //: 2 For a series of block counts, 'reserve' that many blocks in an empty
+    //:   pool, then allocate them all, deallocate them in reverse order, and
+    //:   'rewind'.  Verify that allocating the same number of blocks again
+    //:   supplies the blocks in increasing address order without allocating
+    //:   memory from the heap.  Verify that 'capacity' equals the number of
+    //:   blocks reserved, and is 0 after 'release'.  (C-2..4)
+    //:
+    //: 3 Verify all memory is deallocated on destruction.  (C-5)
+    //
+    // Testing:
+    //   void rewind();
+    //   std::size_t capacity() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'rewind'"
+                        "\n====================\n");
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    struct {
+        int d_line;
+        int d_numAlloc;
+        int d_numDealloc;
+    } DATA[] = {
+
+    //LINE  ALLOC  DEALLOC
+    //----  -----  -------
+
+    { L_,       0,       0 },
+    { L_,       1,       0 },
+    { L_,       1,       1 },
+    { L_,       2,       0 },
+    { L_,       2,       1 },
+    { L_,       2,       2 },
+    { L_,       3,       0 },
+    { L_,       3,       1 },
+    { L_,       3,       2 },
+    { L_,       3,       3 },
+    { L_,       4,       0 },
+    { L_,       4,       1 },
+    { L_,       4,       2 },
+    { L_,       4,       3 },
+    { L_,       4,       4 },
+    { L_,      40,      20 }
+
+    };
+    int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int LINE     = DATA[ti].d_line;
+        const int ALLOCS   = DATA[ti].d_numAlloc;
+        const int DEALLOCS = DATA[ti].d_numDealloc;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Stack usedX;
+            Stack freeX;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            init(&mX, &usedX, &freeX, ALLOCS, DEALLOCS);
+
+            const std::size_t CAPACITY = X.capacity();
+            ASSERTV(LINE, CAPACITY, ALLOCS <= static_cast<int>(CAPACITY));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.rewind();
+
+            ASSERTV(LINE, oam.isTotalSame());
+            ASSERTV(LINE, oam.isInUseSame());
+            ASSERTV(LINE, CAPACITY, X.capacity(), CAPACITY <= X.capacity());
+
+            Stack blocks;
+            for (int tj = 0; tj < ALLOCS; ++tj) {
+                VALUE *ptr = mX.allocate();
+                for (int tk = 0; tk < blocks.size(); ++tk) {
+                    ASSERTV(LINE, tj, tk, ptr != blocks[tk]);
+                }
+                blocks.push(ptr);
+            }
+
+            ASSERTV(LINE, oam.isTotalSame());
+            ASSERTV(LINE, oam.isInUseSame());
+        }
+
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    for (int ti = 1; ti < 64; ++ti) {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERTV(ti, X.capacity(), 0 == X.capacity());
+
+            mX.reserve(ti);
+            ASSERTV(ti, X.capacity(), ti == static_cast<int>(X.capacity()));
+
+            Stack blocks;
+            for (int tj = 0; tj < ti; ++tj) {
+                blocks.push(mX.allocate());
+            }
+            for (int tj = ti - 1; 0 <= tj; --tj) {
+                mX.deallocate(blocks[tj]);
+            }
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.rewind();
+
+            for (int tj = 0; tj < ti; ++tj) {
+                VALUE *ptr = mX.allocate();
+                ASSERTV(ti, tj, blocks[tj] == ptr);
+                if (tj) {
+                    ASSERTV(ti, tj, blocks[tj - 1] < blocks[tj]);
+                }
+            }
+
+            ASSERTV(ti, oam.isTotalSame());
+            ASSERTV(ti, oam.isInUseSame());
+            ASSERTV(ti, X.capacity(), ti <= static_cast<int>(X.capacity()));
+
+            mX.release();
+            ASSERTV(ti, X.capacity(), 0 == X.capacity());
+        }
+
+        ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+
+    // Verify no memory is allocated from the default allocator.
+
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase7()
 {
@@ -1264,7 +1457,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1309,6 +1502,68 @@ int main(int argc, char *argv[])
     ASSERT(0 == stack.size());
 //..
 
+      } break;
+      case 11: {
+          RUN_EACH_TYPE(TestDriver, testCase11, TEST_TYPES);
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // CONCERN: Over-aligned 'VALUE' types are supported
+        //
+        // Concerns:
+        //: 1 Blocks allocated for a 'VALUE' whose alignment exceeds the
+        //:   maximal alignment are aligned for 'VALUE'.
+        //:
+        //: 2 Every byte of an allocated block is usable.
+        //:
+        //: 3 All memory is returned to the allocator on 'release'.
+        //
+        // Plan:
+        //: 1 Using a test allocator, allocate a number of blocks of an
+        //:   over-aligned type, spanning several chunks, verify the alignment
+        //:   of each block, and write to every byte.  (C-1..2)
+        //:
+        //: 2 Invoke 'release' and verify that no memory is in use.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: Over-aligned 'VALUE' types are supported
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nOVER-ALIGNED VALUE TYPE"
+                            "\n=======================\n");
+
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        typedef bslstl::SimplePool<TestType4, bsl::allocator<TestType4> > Obj;
+
+        const int ALIGNMENT = bsls::AlignmentFromType<TestType4>::VALUE;
+        ASSERTV(ALIGNMENT, 64 == ALIGNMENT);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);
+
+            for (int ti = 0; ti < 100; ++ti) {
+                TestType4 *ptr = mX.allocate();
+
+                memset(ptr, 0xFF, sizeof(TestType4));
+                std::size_t address = reinterpret_cast<std::size_t>(ptr);
+                ASSERTV(ti, 0 == address % ALIGNMENT);
+            }
+            ASSERTV(0 < oa.numBlocksInUse());
+
+            mX.release();
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+            mX.reserve(3);
+            for (int ti = 0; ti < 3; ++ti) {
+                TestType4 *ptr = mX.allocate();
+                std::size_t address = reinterpret_cast<std::size_t>(ptr);
+                ASSERTV(ti, 0 == address % ALIGNMENT);
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(oa.numMismatches(), 0 == oa.numMismatches());
+#endif
       } break;
       case 9: {
         // --------------------------------------------------------------------
@@ -16,7 +16,12 @@ BSLS_IDENT("$Id: $")
 //
 //@DESCRIPTION: This component implements a mechanism that creates and deletes
 // 'bslstl::TreeNode' objects for the parameterized 'VALUE' type for use in a
-// tree-based container.
+// tree-based container.  A container whose nodes must hold additional data
+// (e.g., the subtree sizes of an order-statistic tree) may instead supply its
+// own node type as the optional 'NODE' parameter, provided that type derives
+// from 'bslalg::RbTreeNode' and, like 'TreeNode', provides access to its
+// 'VALUE' through a 'value' method (the additional data is left
+// uninitialized by 'createNode').
 //
 // A 'bslstl::TreeNodePool' contains a memory pool provided by the
 // 'bslstl_simplepool' component to provide memory for the nodes (see
@@ -26,6 +31,17 @@ BSLS_IDENT("$Id: $")
 // Subsequent allocations double the number of memory blocks of the previous
 // allocation up to an implementation defined maximum number of blocks.
 //
+// The 'release' method returns all of the memory held by the pool to the
+// underlying allocator at once, without destroying the values of any
+// outstanding nodes.  A container whose elements do not need to be destroyed
+// (e.g., are trivially copyable) can use 'release', rather than deleting each
+// node in turn, to dispose of all of its nodes in time proportional to the
+// number of chunks allocated by the pool, rather than the number of nodes.
+// Similarly, the 'rewind' method returns the memory footprint of every
+// outstanding node to the pool for reuse, without destroying any values,
+// rebuilding the pool's free list from its chunks in address order rather
+// than visiting the nodes of the container.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -147,8 +163,9 @@ BSLS_IDENT("$Id: $")
 //  template <class ALLOCATOR>
 //  bool IntSet<ALLOCATOR>::remove(int value)
 //  {
+//      IntNodeComparator comp;
 //      bslalg::RbTreeNode *node =
-//                bslalg::RbTreeUtil::find(d_tree, IntNodeComparator(), value);
+//                              bslalg::RbTreeUtil::find(d_tree, comp, value);
 //..
 // Here we use the 'TreeNodePool' object, 'd_nodePool', to delete a node that
 // was removed from the set.
@@ -165,7 +182,8 @@ BSLS_IDENT("$Id: $")
 //  inline
 //  bool IntSet<ALLOCATOR>::isElement(int value) const
 //  {
-//      return bslalg::RbTreeUtil::find(d_tree, IntNodeComparator(), value);
+//      IntNodeComparator comp;
+//      return bslalg::RbTreeUtil::find(d_tree, comp, value);
 //  }
 //
 //  template <class ALLOCATOR>
@@ -248,7 +266,7 @@ namespace bslstl {
                        // class TreeNodePool
                        // ==================
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE = TreeNode<VALUE> >
 class TreeNodePool {
     // This class provides methods for creating and deleting nodes using the
     // appropriate allocator-traits of the parameterized 'ALLOCATOR'.  This
@@ -256,8 +274,11 @@ class TreeNodePool {
     // container, in order to take advantage of the empty-base-class
     // optimization in the case where the base-class has 0 size (as may the
     // case if the parameterized 'ALLOCATOR' is not a 'bslma::Allocator').
+    // The nodes created are of the parameterized 'NODE' type, which must
+    // derive from 'bslalg::RbTreeNode' and provide a 'value' method returning
+    // a reference to its 'VALUE' (as does 'TreeNode<VALUE>', the default).
 
-    typedef SimplePool<TreeNode<VALUE>, ALLOCATOR> Pool;
+    typedef SimplePool<NODE, ALLOCATOR> Pool;
         // Alias for the memory pool allocator.
 
     typedef typename Pool::AllocatorTraits         AllocatorTraits;
@@ -294,7 +315,7 @@ class TreeNodePool {
     bslalg::RbTreeNode *createNode(const bslalg::RbTreeNode& original);
         // Allocate a node object having a copy-constructed 'VALUE' of
         // 'value()' of the specified 'original'.  The behavior is undefined
-        // unless 'original' refers to a 'TreeNode<VALUE>'.
+        // unless 'original' refers to a 'NODE'.
 
     bslalg::RbTreeNode *createNode(const VALUE& value);
         // Allocate a node object having the specified 'value'.  This operation
@@ -303,14 +324,31 @@ class TreeNodePool {
     void deleteNode(bslalg::RbTreeNode *node);
         // Destroy the 'VALUE' value of the specified 'node' and return the
         // memory footprint of 'node' to this pool for potential reuse.  The
-        // behavior is undefined unless 'node' refers to a 'TreeNode<VALUE>'.
+        // behavior is undefined unless 'node' refers to a 'NODE'.
+
+    void release();
+        // Relinquish all memory currently allocated via this pool object,
+        // including the memory footprint of every outstanding node, without
+        // destroying the 'VALUE' held by any node.  The behavior is undefined
+        // if any outstanding node is used after this call, or if the 'VALUE'
+        // of any outstanding node must be destroyed (e.g., it owns resources).
+
+    void rewind();
+        // Return the memory footprint of every outstanding node to this pool
+        // for reuse, without destroying the 'VALUE' held by any node, and
+        // retaining all of the memory currently allocated via this pool
+        // object.  The behavior is undefined if any outstanding node is used
+        // after this call, or if the 'VALUE' of any outstanding node must be
+        // destroyed (e.g., it owns resources).  Note that this method runs in
+        // time proportional to 'capacity()', rather than to the number of
+        // outstanding nodes.
 
     void reserveNodes(std::size_t numNodes);
         // Reserve memory from this pool to satisfy memory requests for at
         // least the specified 'numBlocks' before the pool replenishes.  The
         // behavior is undefined unless '0 < numBlocks'.
 
-    void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
+    void swap(TreeNodePool<VALUE, ALLOCATOR, NODE>& other);
         // Efficiently exchange the management of nodes of this object and
         // the specified 'other' object.  The behavior is undefined unless the
         // underlying mechanisms of 'allocator()' refers to the same allocator.
@@ -321,6 +359,9 @@ class TreeNodePool {
         // allocator traits for the node-type.  Note that this operation
         // returns a base-class ('NodeAlloc') reference to this object.
 
+    std::size_t capacity() const;
+        // Return the number of nodes, both free and outstanding, for which
+        // this pool currently holds memory.
 };
 
 // ===========================================================================
@@ -328,27 +369,27 @@ class TreeNodePool {
 // ===========================================================================
 
 // CREATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-TreeNodePool<VALUE, ALLOCATOR>::TreeNodePool(const ALLOCATOR& allocator)
+TreeNodePool<VALUE, ALLOCATOR, NODE>::TreeNodePool(const ALLOCATOR& allocator)
 : d_pool(allocator)
 {
 }
 
 // MANIPULATORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::AllocatorType&
-TreeNodePool<VALUE, ALLOCATOR>::allocator()
+typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+TreeNodePool<VALUE, ALLOCATOR, NODE>::allocator()
 {
     return d_pool.allocator();
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode()
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode()
 {
-    TreeNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -358,12 +399,12 @@ bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode()
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode(
                                                             const VALUE& value)
 {
-    TreeNode<VALUE> *node = d_pool.allocate();
+    NODE *node = d_pool.allocate();
     bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
 
     AllocatorTraits::construct(allocator(),
@@ -373,39 +414,55 @@ bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
     return node;
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR>::createNode(
+bslalg::RbTreeNode *TreeNodePool<VALUE, ALLOCATOR, NODE>::createNode(
                                             const bslalg::RbTreeNode& original)
 {
-    return createNode(static_cast<const TreeNode<VALUE>&>(original).value());
+    return createNode(static_cast<const NODE&>(original).value());
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::deleteNode(bslalg::RbTreeNode *node)
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::deleteNode(
+                                                      bslalg::RbTreeNode *node)
 {
     BSLS_ASSERT(node);
 
-    TreeNode<VALUE> *treeNode = static_cast<TreeNode<VALUE> *>(node);
+    NODE *treeNode = static_cast<NODE *>(node);
     AllocatorTraits::destroy(allocator(),
                              BSLS_UTIL_ADDRESSOF(treeNode->value()));
     d_pool.deallocate(treeNode);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::reserveNodes(std::size_t numNodes)
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::release()
+{
+    d_pool.release();
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::rewind()
+{
+    d_pool.rewind();
+}
+
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::reserveNodes(
+                                                          std::size_t numNodes)
 {
     BSLS_ASSERT_SAFE(0 < numNodes);
 
     d_pool.reserve(numNodes);
 }
 
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-void TreeNodePool<VALUE, ALLOCATOR>::swap(
-                                         TreeNodePool<VALUE, ALLOCATOR>& other)
+void TreeNodePool<VALUE, ALLOCATOR, NODE>::swap(
+                                   TreeNodePool<VALUE, ALLOCATOR, NODE>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
@@ -413,14 +470,21 @@ void TreeNodePool<VALUE, ALLOCATOR>::swap(
 }
 
 // ACCESSORS
-template <class VALUE, class ALLOCATOR>
+template <class VALUE, class ALLOCATOR, class NODE>
 inline
-const typename SimplePool<TreeNode<VALUE>, ALLOCATOR>::AllocatorType&
-TreeNodePool<VALUE, ALLOCATOR>::allocator() const
+const typename SimplePool<NODE, ALLOCATOR>::AllocatorType&
+TreeNodePool<VALUE, ALLOCATOR, NODE>::allocator() const
 {
     return d_pool.allocator();
 }
 
+template <class VALUE, class ALLOCATOR, class NODE>
+inline
+std::size_t TreeNodePool<VALUE, ALLOCATOR, NODE>::capacity() const
+{
+    return d_pool.capacity();
+}
+
 }  // close namespace bslstl
 }  // close enterprise namespace
 
@@ -54,12 +54,16 @@ using namespace bslstl;
 // [ 7] bslalg::RbTreeNode *createNode(const VALUE& value);
 // [ 5] void deleteNode(bslalg::RbTreeNode *node);
 // [ 6] void reserveNodes(std::size_t numNodes);
+// [ 9] void release();
+// [10] void rewind();
 // [ 8] void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
+// [10] std::size_t capacity() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [11] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 //=============================================================================
 
@@ -277,11 +281,14 @@ class TestDriver {
 
   public:
     // TEST CASES
-    // static void testCase10();
+    // static void testCase12();
         // Reserved for BSLX.
 
+    static void testCase10();
+        // Test 'rewind'.
+
     static void testCase9();
-        // Test usage example.
+        // Test 'release'.
 
     static void testCase8();
         // Test 'swap' member.
@@ -361,6 +368,174 @@ void TestDriver<VALUE>::createFreeBlocks(Obj   *result,
     }
 }
 
+template<class VALUE>
+void TestDriver<VALUE>::testCase10()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'rewind'
+    //
+    // Concerns:
+    //: 1 'rewind' neither allocates nor deallocates memory.
+    //:
+    //: 2 The memory of every node created before the 'rewind', whether the
+    //:   node was deleted or is outstanding, is reused by subsequent calls to
+    //:   'createNode' before any memory is allocated.
+    //:
+    //: 3 The values of outstanding nodes are not destroyed.
+    //:
+    //: 4 'capacity' counts every node for which the pool holds memory, grows
+    //:   by the number of nodes reserved, and is not reduced by 'rewind'.
+    //:
+    //: 5 All memory is deallocated on destruction.
+    //
+    // Plan:
+    //: 1 For each different values of i from 0 to 99:
+    //:
+    //:   1 Invoke 'createNode' 'i' times, and delete every other node.
+    //:     Verify that 'capacity' is at least the number of outstanding
+    //:     nodes.  (C-4)
+    //:
+    //:   2 Invoke 'rewind' and verify that the object allocator is unchanged,
+    //:     and that 'capacity' is not reduced.  (C-1, 3..4)
+    //:
+    //:   3 Invoke 'createNode' as many times as there were outstanding nodes
+    //:     before the 'rewind', and verify that no memory is allocated.
+    //:     (C-2)
+    //:
+    //:   4 Invoke 'reserveNodes' and verify that 'capacity' grows by the
+    //:     number of nodes reserved.  (C-4)
+    //:
+    //:   5 Verify all memory is deallocated on destruction.  (C-5)
+    //
+    // Testing:
+    //   void rewind();
+    //   std::size_t capacity() const;
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'rewind'"
+                        "\n====================\n");
+
+    for (int ti = 0; ti < 100; ++ti) {
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int tj = 0; tj < ti; ++tj) {
+                RbNode *ptr = mX.createNode();
+                if (tj % 2) {
+                    mX.deleteNode(ptr);
+                }
+            }
+
+            const std::size_t CAPACITY = X.capacity();
+            ASSERTV(ti, CAPACITY, (ti + 1) / 2 <= static_cast<int>(CAPACITY));
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.rewind();
+
+            ASSERTV(ti, oam.isTotalSame());
+            ASSERTV(ti, oam.isInUseSame());
+            ASSERTV(ti, CAPACITY, X.capacity(), CAPACITY <= X.capacity());
+
+            for (int tj = 0; tj < (ti + 1) / 2; ++tj) {
+                mX.createNode();
+            }
+
+            ASSERTV(ti, oam.isTotalSame());
+            ASSERTV(ti, oam.isInUseSame());
+
+            mX.rewind();
+
+            const std::size_t PRE_RESERVE = X.capacity();
+
+            mX.reserveNodes(ti + 1);
+
+            ASSERTV(ti, PRE_RESERVE, X.capacity(),
+                    PRE_RESERVE + ti + 1 == X.capacity());
+        }
+
+        ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
+template<class VALUE>
+void TestDriver<VALUE>::testCase9()
+{
+    // --------------------------------------------------------------------
+    // MANIPULATOR 'release'
+    //
+    // Concerns:
+    //: 1 'release' returns all memory allocated by the object to the
+    //:   allocator, including the memory of nodes that were never deleted.
+    //:
+    //: 2 The values of outstanding nodes are not destroyed.
+    //:
+    //: 3 The object can be used to create nodes after 'release'.
+    //:
+    //: 4 'release' has no effect on an object that allocated no memory.
+    //
+    // Plan:
+    //: 1 For each different values of i from 0 to 99:
+    //:
+    //:   1 Invoke 'createNode' 'i' times, and delete every other node.
+    //:
+    //:   2 Invoke 'release' and verify that no memory is in use by the object
+    //:     allocator, and that the number of deallocations equals the number
+    //:     of allocations.  (C-1..2, 4)
+    //:
+    //:   3 Invoke 'createNode' and 'deleteNode', and verify that memory is
+    //:     allocated and that all memory is deallocated on destruction.
+    //:     (C-3)
+    //
+    // Testing:
+    //   void release();
+    // --------------------------------------------------------------------
+
+    if (verbose) printf("\nMANIPULATOR 'release'"
+                        "\n=====================\n");
+
+    for (int ti = 0; ti < 100; ++ti) {
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);
+
+            Stack usedBlocks;
+            for (int tj = 0; tj < ti; ++tj) {
+                RbNode *ptr = mX.createNode();
+                if (tj % 2) {
+                    mX.deleteNode(ptr);
+                }
+                else {
+                    usedBlocks.push(ptr);
+                }
+            }
+            ASSERTV(ti, (0 == ti) == (0 == oa.numBlocksInUse()));
+
+            mX.release();
+
+            ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+            ASSERTV(ti, oa.numAllocations() == oa.numDeallocations());
+
+            RbNode *ptr = mX.createNode();
+            ASSERTV(ti, 0 < oa.numBlocksInUse());
+            mX.deleteNode(ptr);
+        }
+
+        ASSERTV(ti, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
 template<class VALUE>
 void TestDriver<VALUE>::testCase8()
 {
@@ -1261,8 +1436,9 @@ void TestDriver<VALUE>::testCase2()
     template <class ALLOCATOR>
     bool IntSet<ALLOCATOR>::remove(int value)
     {
+        IntNodeComparator comp;
         bslalg::RbTreeNode *node =
-                  bslalg::RbTreeUtil::find(d_tree, IntNodeComparator(), value);
+                                bslalg::RbTreeUtil::find(d_tree, comp, value);
 //..
 // Here we use the 'TreeNodePool' object, 'd_nodePool', to delete a node that
 // was removed from the set.
@@ -1306,7 +1482,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 9: {
+      case 11: {
         if (verbose) printf("\nUSAGE EXAMPLE"
                             "\n=============\n");
 
@@ -1341,6 +1517,14 @@ int main(int argc, char *argv[])
     ASSERT(0 <  objectAllocator.numBytesInUse());
 //..
       } break;
+      case 10: {
+        TestDriver<int>::testCase10();
+        TestDriver<bsltf::SimpleTestType>::testCase10();
+      } break;
+      case 9: {
+        TestDriver<int>::testCase9();
+        TestDriver<bsltf::SimpleTestType>::testCase9();
+      } break;
       case 8: {
         TestDriver<bsltf::AllocTestType>::testCase8();
       } break;